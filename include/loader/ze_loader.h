@@ -561,6 +561,28 @@ zelDisableTracingLayer();
 ZE_DLLEXPORT ze_result_t ZE_APICALL
 zelGetTracingLayerState(bool* enabled); // Pointer to bool to receive tracing layer state
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Retrieves the validation layer checker timing report.
+///
+/// The report ranks each validation checker, and the handle lifetime tracker,
+/// by the time spent in its prologues and epilogues. Timing is only collected
+/// when the validation layer is enabled with ZEL_VALIDATION_CHECKER_TIMING=1.
+///
+/// If pReport is null or *pSize is zero, *pSize is set to the size in bytes
+/// needed to hold the report, including the terminating null character.
+/// Otherwise up to *pSize - 1 characters are copied and null terminated.
+///
+/// @return
+///   - ZE_RESULT_SUCCESS on success.
+///   - ZE_RESULT_ERROR_INVALID_NULL_POINTER if pSize is null.
+///   - ZE_RESULT_ERROR_UNSUPPORTED_FEATURE if the validation layer is not loaded
+///     or checker timing is not enabled.
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zelGetValidationCheckerTimingReport(
+   size_t *pSize, // [in,out] size of pReport in bytes, or the required size on return
+   char *pReport  // [out][optional] buffer receiving the null terminated report
+);
+
 #if defined(__cplusplus)
 } // extern "C"
 #endif
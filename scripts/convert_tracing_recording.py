@@ -0,0 +1,113 @@
+"""
+ Copyright (C) 2025 Intel Corporation
+
+ SPDX-License-Identifier: MIT
+
+"""
+#!/usr/bin/env python3
+"""
+Convert a tracing layer recording to Chrome trace JSON.
+
+Usage:
+    python3 convert_tracing_recording.py <recording_file> <output_json>
+
+Example:
+    export ZE_ENABLE_TRACING_LAYER=1
+    export ZEL_TRACING_RECORD_FILE=calls.bin
+    ./my_level_zero_app
+    python3 convert_tracing_recording.py calls_pid12345.bin calls.json
+
+The output opens in chrome://tracing and in the Perfetto UI. Each call is a
+complete event on the thread that made it, with the first argument of the
+call and its result as arguments.
+"""
+
+import json
+import os
+import struct
+import sys
+from pathlib import Path
+
+# Must match traceRecorder::recordingFileHeader / callRecord /
+# recordingFileFooter in source/layers/tracing/tracing_recorder.h
+# (native byte order)
+RECORDING_MAGIC = b'ZELTREC\0'
+RECORDING_END_MAGIC = b'ZELTEND\0'
+RECORDING_HEADER = struct.Struct('=8sIIQ')
+RECORDING_RECORD = struct.Struct('=QQQQIHH')
+RECORDING_FOOTER = struct.Struct('=QQQQQQII8s')
+NAME_ENTRY = struct.Struct('=HH')
+
+
+def read_recording(path):
+    """Return (pid, calls, dropped count) with call times in nanoseconds."""
+    size = os.path.getsize(path)
+    with open(path, 'rb') as f:
+        magic, version, record_size, pid = RECORDING_HEADER.unpack(f.read(RECORDING_HEADER.size))
+        if magic != RECORDING_MAGIC or version != 1 or record_size != RECORDING_RECORD.size:
+            raise ValueError(f"Unsupported recording file '{path}' (version {version}, record size {record_size})")
+
+        f.seek(size - RECORDING_FOOTER.size)
+        (open_ticks, open_ns, close_ticks, close_ns, dropped, name_table_offset, name_count, _,
+         end_magic) = RECORDING_FOOTER.unpack(f.read(RECORDING_FOOTER.size))
+        if end_magic != RECORDING_END_MAGIC:
+            raise ValueError(f"Recording file '{path}' is incomplete, the process did not unload the tracing layer")
+
+        f.seek(name_table_offset)
+        names = {}
+        for _ in range(name_count):
+            api_id, length = NAME_ENTRY.unpack(f.read(NAME_ENTRY.size))
+            names[api_id] = f.read(length).decode('utf-8', errors='replace')
+
+        ns_per_tick = (close_ns - open_ns) / (close_ticks - open_ticks) if close_ticks > open_ticks else 1.0
+
+        def to_ns(ticks):
+            return (ticks - open_ticks) * ns_per_tick
+
+        calls = []
+        f.seek(RECORDING_HEADER.size)
+        for _ in range((name_table_offset - RECORDING_HEADER.size) // record_size):
+            start, end, handle, result, thread_id, api_id, _ = RECORDING_RECORD.unpack(f.read(record_size))
+            calls.append({
+                'name': names.get(api_id, f'api{api_id}'),
+                'start_ns': to_ns(start),
+                'duration_ns': (end - start) * ns_per_tick,
+                'thread': thread_id,
+                'handle': handle,
+                'result': result,
+            })
+    return pid, calls, dropped
+
+
+def write_chrome_trace(path, output):
+    pid, calls, dropped = read_recording(path)
+    events = []
+    for call in sorted(calls, key=lambda call: call['start_ns']):
+        events.append({
+            'name': call['name'],
+            'cat': 'ze',
+            'ph': 'X',
+            'ts': call['start_ns'] / 1e3,
+            'dur': call['duration_ns'] / 1e3,
+            'pid': pid,
+            'tid': call['thread'],
+            'args': {'handle': f"0x{call['handle']:x}", 'result': f"0x{call['result']:x}"},
+        })
+    with open(output, 'w') as f:
+        json.dump({'traceEvents': events, 'displayTimeUnit': 'ns'}, f)
+    print(f"{len(events)} calls written to {output}")
+    if dropped:
+        print(f"{dropped} calls dropped, the recorder could not keep up")
+
+
+if __name__ == '__main__':
+    if len(sys.argv) != 3:
+        print(__doc__)
+        sys.exit(1)
+
+    recording_file = sys.argv[1]
+    if not Path(recording_file).exists():
+        print(f"Error: File '{recording_file}' not found")
+        sys.exit(1)
+
+    write_chrome_trace(recording_file, sys.argv[2])
@@ -0,0 +1,129 @@
+"""
+ Copyright (C) 2025 Intel Corporation
+
+ SPDX-License-Identifier: MIT
+
+"""
+#!/usr/bin/env python3
+"""
+Decode a binary validation layer findings log.
+
+Usage:
+    python3 decode_validation_findings.py <findings_file>
+    python3 decode_validation_findings.py <findings_file> --csv <output_csv>
+
+Example:
+    export ZE_ENABLE_VALIDATION_LAYER=1
+    export ZEL_ENABLE_EVENTS_CHECKER=1
+    export ZEL_VALIDATION_FINDINGS_LOG=findings.bin
+    ./my_level_zero_app
+    python3 decode_validation_findings.py findings_pid12345.bin
+
+Each distinct finding is printed once with the number of times it occurred,
+most frequent first.
+"""
+
+import csv
+import struct
+import sys
+from pathlib import Path
+
+# Must match findingsLog::findingFileHeader / findingRecord in
+# source/layers/validation/validation_findings.h (native byte order)
+FINDINGS_MAGIC = b'ZELFIND\0'
+FINDINGS_HEADER = struct.Struct('=8sIIQ')
+FINDINGS_RECORD = struct.Struct('=IIQQQQII24s40s144s')
+
+FIRST_OCCURRENCE = 1
+REPEAT_COUNT = 2
+SUPPRESSED_BY_RATE_LIMIT = 3
+DROPPED_RING_FULL = 4
+
+SEVERITIES = ['info', 'warning', 'error']
+
+
+def _text(field):
+    return field.split(b'\0', 1)[0].decode('utf-8', errors='replace')
+
+
+def read_findings(path):
+    """Return (pid, findings by id, suppressed count, dropped count)."""
+    findings = {}
+    suppressed = 0
+    dropped = 0
+    with open(path, 'rb') as f:
+        magic, version, record_size, pid = FINDINGS_HEADER.unpack(f.read(FINDINGS_HEADER.size))
+        if magic != FINDINGS_MAGIC or version != 1 or record_size != FINDINGS_RECORD.size:
+            raise ValueError(f"Unsupported findings file '{path}' (version {version}, record size {record_size})")
+        while True:
+            data = f.read(record_size)
+            if len(data) < record_size:
+                break
+            (record_type, severity, timestamp_ns, finding_id, obj, count, thread_id, _,
+             checker, finding, message) = FINDINGS_RECORD.unpack(data)
+            if record_type == FIRST_OCCURRENCE:
+                findings[finding_id] = {
+                    'id': finding_id,
+                    'time_ms': timestamp_ns / 1e6,
+                    'severity': SEVERITIES[severity] if severity < len(SEVERITIES) else str(severity),
+                    'checker': _text(checker),
+                    'finding': _text(finding),
+                    'object': f'0x{obj:x}',
+                    'thread': thread_id,
+                    'message': _text(message),
+                    'count': findings.get(finding_id, {}).get('count', 0) + 1,
+                }
+            elif record_type == REPEAT_COUNT:
+                entry = findings.setdefault(finding_id, {
+                    'id': finding_id, 'time_ms': 0.0, 'severity': '', 'checker': '',
+                    'finding': '<first occurrence not written>', 'object': '', 'thread': 0,
+                    'message': '', 'count': 1,
+                })
+                entry['count'] += count
+            elif record_type == SUPPRESSED_BY_RATE_LIMIT:
+                suppressed += count
+            elif record_type == DROPPED_RING_FULL:
+                dropped += count
+    return pid, findings, suppressed, dropped
+
+
+def print_findings(path):
+    pid, findings, suppressed, dropped = read_findings(path)
+    ranked = sorted(findings.values(), key=lambda entry: (-entry['count'], entry['time_ms']))
+    print(f"Validation findings for pid {pid}: {len(ranked)} distinct, "
+          f"{sum(entry['count'] for entry in ranked)} total")
+    for entry in ranked:
+        print(f"{entry['count']:>10}  {entry['severity']:<7} {entry['checker']}/{entry['finding']} "
+              f"object={entry['object']} first at {entry['time_ms']:.3f} ms")
+        if entry['message']:
+            print(f"            {entry['message']}")
+    if suppressed:
+        print(f"{suppressed} findings not written, rate limit reached (ZEL_VALIDATION_FINDINGS_RATE)")
+    if dropped:
+        print(f"{dropped} findings dropped, writer could not keep up")
+
+
+def write_csv(path, output):
+    _, findings, _, _ = read_findings(path)
+    columns = ['id', 'count', 'time_ms', 'severity', 'checker', 'finding', 'object', 'thread', 'message']
+    with open(output, 'w', newline='') as f:
+        writer = csv.DictWriter(f, fieldnames=columns)
+        writer.writeheader()
+        for entry in sorted(findings.values(), key=lambda entry: entry['id']):
+            writer.writerow({column: entry[column] for column in columns})
+
+
+if __name__ == '__main__':
+    if len(sys.argv) not in (2, 4) or (len(sys.argv) == 4 and sys.argv[2] != '--csv'):
+        print(__doc__)
+        sys.exit(1)
+
+    findings_file = sys.argv[1]
+    if not Path(findings_file).exists():
+        print(f"Error: File '{findings_file}' not found")
+        sys.exit(1)
+
+    if len(sys.argv) == 4:
+        write_csv(findings_file, sys.argv[3])
+    else:
+        print_findings(findings_file)
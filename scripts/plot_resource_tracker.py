@@ -9,7 +9,8 @@
 Plot system resource tracking data from Level Zero resource tracker CSV output.
 
 Usage:
-    python3 plot_resource_tracker.py <csv_file>
+    python3 plot_resource_tracker.py <csv_or_binary_file>
+    python3 plot_resource_tracker.py <binary_file> --convert <output_csv>
 
 Example:
     export ZEL_ENABLE_SYSTEM_RESOURCE_TRACKER_CHECKER=1
@@ -18,18 +19,79 @@ Example:
     export ZEL_LOADER_LOGGING_LEVEL=debug
     ./my_level_zero_app
     python3 plot_resource_tracker.py tracker_output.csv
+
+Binary output (ZEL_SYSTEM_RESOURCE_TRACKER_BINARY=<path>) is detected automatically
+and can be converted to the CSV format with --convert.
 """
 
+import struct
 import sys
-import pandas as pd
-import matplotlib.pyplot as plt
 from pathlib import Path
 
+CSV_COLUMNS = [
+    'CallNumber', 'TimeMs', 'APICall', 'VmSize_KB', 'VmRSS_KB', 'VmData_KB', 'VmPeak_KB', 'Threads',
+    'Delta_VmSize_KB', 'Delta_VmRSS_KB', 'Delta_VmData_KB',
+    'Contexts', 'CommandQueues', 'Modules', 'Kernels', 'EventPools', 'CommandLists',
+    'Events', 'Fences', 'Images', 'Samplers', 'TotalMemory_Bytes',
+]
+
+# Must match ResourceTrackerFileHeader / ResourceTrackerRecord in
+# zel_system_resource_tracker_checker.cpp (native byte order)
+BINARY_MAGIC = b'ZELRTRK\0'
+BINARY_HEADER = struct.Struct('=8sII')
+BINARY_RECORD = struct.Struct('=21Q64s')
+
+
+def is_binary_tracker_file(path):
+    """Return True if the file starts with the binary tracker magic."""
+    with open(path, 'rb') as f:
+        return f.read(len(BINARY_MAGIC)) == BINARY_MAGIC
+
+
+def read_binary_records(path):
+    """Yield CSV-ordered rows from a binary tracker file."""
+    with open(path, 'rb') as f:
+        magic, version, record_size = BINARY_HEADER.unpack(f.read(BINARY_HEADER.size))
+        if magic != BINARY_MAGIC or version != 1 or record_size != BINARY_RECORD.size:
+            raise ValueError(f"Unsupported tracker file '{path}' (version {version}, record size {record_size})")
+        while True:
+            data = f.read(record_size)
+            if len(data) < record_size:
+                break
+            fields = BINARY_RECORD.unpack(data)
+            api_call = fields[21].split(b'\0', 1)[0].decode('ascii', 'replace')
+            yield list(fields[0:2]) + [api_call] + list(fields[2:21])
+
+
+def convert_binary_to_csv(binary_file, csv_file):
+    """Convert a binary tracker file into the CSV format written by the tracker."""
+    import csv
+    count = 0
+    with open(csv_file, 'w', newline='') as out:
+        writer = csv.writer(out)
+        writer.writerow(CSV_COLUMNS)
+        for row in read_binary_records(binary_file):
+            writer.writerow(row)
+            count += 1
+    print(f"Converted {count} records to: {csv_file}")
+
+
+def load_tracker_data(path):
+    """Load tracker output (CSV or binary) into a DataFrame."""
+    import pandas as pd
+    if is_binary_tracker_file(path):
+        df = pd.DataFrame(list(read_binary_records(path)), columns=CSV_COLUMNS)
+        # Records are written in drain order; restore call order for plotting
+        return df.sort_values('CallNumber').reset_index(drop=True)
+    return pd.read_csv(path)
+
+
 def plot_resource_tracker(csv_file):
-    """Plot resource tracking data from CSV file."""
+    """Plot resource tracking data from CSV or binary tracker output."""
+    import matplotlib.pyplot as plt
     
-    # Read CSV file
-    df = pd.read_csv(csv_file)
+    # Read tracker output
+    df = load_tracker_data(csv_file)
     
     # Check if CSV has any data rows
     if len(df) == 0:
@@ -342,7 +404,7 @@ def plot_resource_tracker(csv_file):
         print(f"  {api}: {mem:.2f} KB/call ({count} calls)")
 
 if __name__ == '__main__':
-    if len(sys.argv) != 2:
+    if len(sys.argv) not in (2, 4) or (len(sys.argv) == 4 and sys.argv[2] != '--convert'):
         print(__doc__)
         sys.exit(1)
     
@@ -351,6 +413,13 @@ if __name__ == '__main__':
         print(f"Error: File '{csv_file}' not found")
         sys.exit(1)
     
+    if len(sys.argv) == 4:
+        if not is_binary_tracker_file(csv_file):
+            print(f"Error: File '{csv_file}' is not a binary tracker file")
+            sys.exit(1)
+        convert_binary_to_csv(csv_file, sys.argv[3])
+        sys.exit(0)
+    
     try:
         import pandas
         import matplotlib
@@ -21,6 +21,8 @@ namespace validation_layer
             ${name}_checker.zeValidation = zeChecker;
             ${name}_checker.zetValidation = zetChecker;
             ${name}_checker.zesValidation = zesChecker;
+            ${name}_checker.checkerName = "${name}";
+            validation_layer::context.initSampleRate(${name}_checker, "ZEL_${env_name}_CHECKER_SAMPLE_RATE");
             validation_layer::context.validationHandlers.push_back(&${name}_checker);
         }
     }
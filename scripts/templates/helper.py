@@ -1518,6 +1518,110 @@ def make_param_checks(namespace, tags, obj, cpp=False, meta=None):
                     checks[key].append(subt(namespace, tags, code.group(1), False, cpp))
     return checks
 
+"""
+Private:
+    parses an operand of a parameter check: a parameter, or a field of a
+    parameter that points to a struct; returns (value index, field) where field
+    is None or (struct type, member name)
+"""
+def _parse_check_operand(expr, params, values):
+    m = re.match(r"^(\w+)(?:->(\w+))?$", expr.strip())
+    if not m or m.group(1) not in params:
+        return None
+    name, member = m.group(1), m.group(2)
+    field = None
+    if member:
+        ptype = re.sub(r"\bconst\b", "", params[name]).strip()
+        if not re.match(r"^\w+\s*\*$", ptype):
+            return None
+        field = (ptype.rstrip("*").strip(), member)
+    if name not in values:
+        values.append(name)
+    return (values.index(name), field)
+
+"""
+Private:
+    returns (kind, operand, count operand, bound) for a check expression as
+    emitted by make_param_checks, or None if the table cannot express it
+"""
+def _parse_param_check(expr, params, values):
+    m = re.match(r"^\(nullptr == (\w+)\) && \(0 < (\w+)\)$", expr)
+    if m:
+        operand = _parse_check_operand(m.group(1), params, values)
+        count = _parse_check_operand(m.group(2), params, values)
+        if operand and count and not count[1]:
+            return ("isNullWithCount", operand, count[0], "0")
+        return None
+    m = re.match(r"^nullptr == ([\w>-]+)$", expr)
+    if m:
+        operand = _parse_check_operand(m.group(1), params, values)
+        return ("isNull", operand, 0, "0") if operand else None
+    m = re.match(r"^0(?:x0)? == ([\w>-]+)$", expr)
+    if m:
+        operand = _parse_check_operand(m.group(1), params, values)
+        return ("isZero", operand, 0, "0") if operand else None
+    m = re.match(r"^(0x[0-9a-fA-F]+|[A-Z][A-Z0-9_]+) < ([\w>-]+)$", expr)
+    if m:
+        operand = _parse_check_operand(m.group(2), params, values)
+        return ("isAbove", operand, 0, m.group(1)) if operand else None
+    m = re.match(r"^0 != \(([\w>-]+) & \(([\w>-]+) - 1\)\)$", expr)
+    if m and m.group(1) == m.group(2):
+        operand = _parse_check_operand(m.group(1), params, values)
+        return ("isNotPowerOfTwo", operand, 0, "0") if operand else None
+    return None
+
+"""
+Private:
+    fewest checks for which a descriptor table is emitted; below this the
+    inline compares are smaller than the call into the table interpreter
+"""
+_param_check_table_min = 4
+
+"""
+Private:
+    builds a parameter check table from the checks of make_param_checks and the
+    (type, name) of each parameter; returns None if any check is unsupported or
+    there are too few checks for a table to be smaller than inline code
+"""
+def _make_check_table(checks, params):
+    if sum(len(exprs) for exprs in checks.values()) < _param_check_table_min:
+        return None
+    params = dict((name, tname) for tname, name in params)
+    values = []
+    entries = []
+    for result, exprs in checks.items():
+        for expr in exprs:
+            parsed = _parse_param_check(expr, params, values)
+            if not parsed:
+                return None
+            kind, (value, field), count, bound = parsed
+            if field:
+                width = "sizeof(%s::%s)"%field
+                offset = "offsetof(%s, %s)"%field
+            else:
+                width = "0"
+                offset = "0"
+            entries.append("{ paramCheck::%s, %s, %s, %s, %s, %s, %s }"%(
+                kind, value, count, width, offset, result, bound))
+    if len(values) > 255:
+        return None
+    return {'checks': entries, 'values': values}
+
+"""
+Public:
+    returns the prologue checks of a function as a descriptor table, as a dict
+    of 'checks' (paramCheck initializers, in check order) and 'values' (the
+    parameters they read), or None if the checks are emitted as code
+"""
+def make_param_check_table(namespace, tags, obj, meta=None):
+    checks = make_param_checks(namespace, tags, obj, meta=meta)
+    if len(checks) == 0:
+        return None
+    params = []
+    for item in obj['params']:
+        params.append((_get_type_name(namespace, tags, obj, item, False, meta), _get_param_name(namespace, tags, item, False)))
+    return _make_check_table(checks, params)
+
 """
 Public:
     returns a list of strings for possible return values
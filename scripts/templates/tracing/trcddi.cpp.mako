@@ -51,6 +51,13 @@ namespace tracing_layer
             return ${failure_return};
             %endif
 
+        if( !${N}_API_IS_TRACED(${th.get_callback_table_name(n, tags, obj)}, ${th.make_pfncb_name(n, tags, obj)}) )
+            %if is_void_params:
+            return ${th.make_pfn_name(n, tags, obj)}();
+            %else:
+            return ${th.make_pfn_name(n, tags, obj)}( ${", ".join(params_list)} );
+            %endif
+
         ZE_HANDLE_TRACER_RECURSION(context.${n}DdiTable.${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)}\
 %if not is_void_params:
 , ${", ".join(params_list)}\
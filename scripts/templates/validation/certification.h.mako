@@ -3,6 +3,9 @@ from templates import helper as th
 %><%
     n=namespace
     N=n.upper()
+
+    x=tags['$x']
+    X=x.upper()
 %>/*
  * ***THIS FILE IS GENERATED. ***
  *
@@ -14,23 +17,37 @@ from templates import helper as th
  *
  */
 #pragma once
-#include "../zel_global_certification_state.h"
-#include "${n}_entry_points.h"
+#include "${n}_ddi.h"
 
 namespace validation_layer {
-class ${N}certificationCheckerGenerated : public ${N}ValidationEntryPoints {
+// APIs newer than the certification version are redirected to an
+// Unsupported stub in the layer's DDI table; allowed APIs are left untouched.
+class ${N}certificationCheckerGenerated {
 public:
 %for obj in th.extract_objs(specs, r"function"):
-    virtual ze_result_t ${th.make_func_name(n, tags, obj)}Prologue( \
+<%
+    ret_type = obj['return_type']
+    failure_return = "ZE_RESULT_ERROR_UNSUPPORTED_VERSION"
+    if ret_type != 'ze_result_t':
+        failure_return = th.get_first_failure_return(obj)
+%>\
+    static ${ret_type} ${X}_APICALL ${th.make_func_name(n, tags, obj)}Unsupported( \
     %for line in th.make_param_lines(n, tags, obj, format=["type", "name", "delim"]):
 ${line} \
     %endfor
-) override {
-        if (GlobalCertificationState::getInstance().certification_version < ${th.get_version(obj)}) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
+) {
+        return ${failure_return};
     }
 %endfor
+
+    static void applyCertification(${n}_dditable_t &table, const ${n}_dditable_t &original, ze_api_version_t version) {
+%for obj in th.extract_objs(specs, r"function"):
+<%
+    tbl = th.get_table_name(n, tags, obj)
+    pfn = th.make_pfn_name(n, tags, obj)
+%>\
+        table.${tbl}.${pfn} = (original.${tbl}.${pfn} && version < ${th.get_version(obj)}) ? ${th.make_func_name(n, tags, obj)}Unsupported : original.${tbl}.${pfn};
+%endfor
+    }
 };
 } // namespace validation_layer
@@ -37,6 +37,8 @@ namespace validation_layer
             parameterChecker.zetValidation = zetChecker;
             parameterChecker.zesValidation = zesChecker;
             parameterChecker.zerValidation = zerChecker;
+            parameterChecker.checkerName = "parameter_validation";
+            validation_layer::context.getInstance().initSampleRate(parameterChecker, "ZEL_PARAMETER_VALIDATION_SAMPLE_RATE");
             validation_layer::context.getInstance().validationHandlers.push_back(&parameterChecker);
         }
     }
@@ -59,6 +61,20 @@ namespace validation_layer
         %endfor
         )
     {
+<%
+    table = th.make_param_check_table(n, tags, obj, meta=meta)
+%>\
+        %if table:
+        static constexpr paramCheck checks[] = {
+            %for check in table['checks']:
+            ${check},
+            %endfor
+        };
+        const uint64_t values[] = { ${", ".join("paramValue( %s )"%v for v in table['values'])} };
+        if( auto result = validateParams( checks, values ) )
+            return result;
+
+        %else:
         %for key, values in th.make_param_checks(n, tags, obj, meta=meta).items():
         %for val in values:
         if( ${val} )
@@ -66,6 +82,7 @@ namespace validation_layer
 
         %endfor
         %endfor
+        %endif
 <%
     descs = th.get_func_descs(n, tags, obj)
 %>\
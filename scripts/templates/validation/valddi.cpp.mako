@@ -34,8 +34,8 @@ namespace validation_layer
 
 %endif
     static ze_result_t logAndPropagateResult(const char* fname, ze_result_t result) {
-        if (result != ${X}_RESULT_SUCCESS) {
-            context.logger->log_trace("Error (" + loader::to_string(result) + ") in " + std::string(fname));
+        if (result != ${X}_RESULT_SUCCESS && context.logger->should_log(spdlog::level::trace)) {
+            context.logger->log_trace("Error ({}) in {}", loader::to_string(result), fname);
         }
         return result;
     }
@@ -48,6 +48,8 @@ namespace validation_layer
         failure_return = th.get_first_failure_return(obj)
     param_lines = [line for line in th.make_param_lines(n, tags, obj, format=['name','delim'])]
     is_void_params = len(param_lines) == 0
+    ## Create/destroy style APIs always run every checker so lifetime state stays exact
+    exact_call = re.match(r"\w+Create\w*$|\w+Destroy\w*$|\w+MemAlloc\w*$|\w+MemFree\w*$", th.make_func_name(n, tags, obj))
     %>///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for ${th.make_func_name(n, tags, obj)}
     %if 'condition' in obj:
@@ -72,7 +74,14 @@ namespace validation_layer
         %endif
 
         auto numValHandlers = context.validationHandlers.size();
+        %if not exact_call:
+        const auto sampleTick = context.nextSampleTick();
+        %endif
         for (size_t i = 0; i < numValHandlers; i++) {
+            %if not exact_call:
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            %endif
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "${th.make_func_name(n, tags, obj)}", timingPhase::prologue);
             auto result = context.validationHandlers[i]->${n}Validation->${th.make_func_name(n, tags, obj)}Prologue( \
 % for line in param_lines:
 ${line} \
@@ -96,6 +105,7 @@ return ${failure_return};
         generate_post_call = re.match(r"\w+Create\w*$|\w+Get$|\w+Get\w*Exp$|\w+GetIpcHandle$|\w+GetSubDevices$", func_name)
         %>
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "${th.make_func_name(n, tags, obj)}", timingPhase::handleLifetime);
             auto result = context.handleLifetime->${n}HandleLifetime.${th.make_func_name(n, tags, obj)}Prologue( \
 % for line in param_lines:
 ${line} \
@@ -110,6 +120,11 @@ return ${failure_return};
         }
 
         auto driver_result = ${th.make_pfn_name(n, tags, obj)}( ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))} );
+%if th.make_func_name(n, tags, obj) in ("zeInit", "zeInitDrivers", "zesInit"):
+
+        if( driver_result == ${X}_RESULT_SUCCESS )
+            context.notifyDdiTablesReady();
+%endif
 %if 'ppFunctionAddress' in [p.get('name', '') for p in obj.get('params', [])] and n == 'ze':
 
         // For Intel experimental extensions, we need to return our validation layer function
@@ -123,6 +138,23 @@ return ${failure_return};
 %endif
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            %if not exact_call:
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            %endif
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "${th.make_func_name(n, tags, obj)}", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->${n}Validation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "${th.make_func_name(n, tags, obj)}", [=]() { handler->${th.make_func_name(n, tags, obj)}Epilogue( \
+%if not is_void_params:
+% for line in param_lines:
+${line} \
+%endfor
+,driver_result); });
+%else:
+driver_result ); });
+%endif
+                continue;
+            }
             auto result = context.validationHandlers[i]->${n}Validation->${th.make_func_name(n, tags, obj)}Epilogue( \
 %if not is_void_params:
 % for line in param_lines:
@@ -202,6 +234,7 @@ return ${failure_return};
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zexCounterBasedEventCreate2", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zexCounterBasedEventCreate2Prologue( hContext, hDevice, desc, phEvent );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zexCounterBasedEventCreate2", result);
         }
@@ -211,6 +244,7 @@ return ${failure_return};
         }
 
         if(context.enableHandleLifetime){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zexCounterBasedEventCreate2", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zexCounterBasedEventCreate2Prologue( hContext, hDevice, desc, phEvent );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zexCounterBasedEventCreate2", result);
         }
@@ -253,6 +287,12 @@ return ${failure_return};
         }
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zexCounterBasedEventCreate2", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zexCounterBasedEventCreate2", [=]() { handler->zexCounterBasedEventCreate2Epilogue( hContext, hDevice, desc, phEvent, driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zexCounterBasedEventCreate2Epilogue( hContext, hDevice, desc, phEvent, driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zexCounterBasedEventCreate2", result);
         }
@@ -11,9 +11,14 @@ namespace tracing_layer
 {
     void __attribute__((constructor)) createAPITracerContextImp() {
         pGlobalAPITracerContextImp = new struct APITracerContextImp;
+        pTraceRecorder = traceRecorder::createFromEnvironment();
+        if (pTraceRecorder != nullptr)
+            pGlobalAPITracerContextImp->traceAllApis();
     }
 
     void __attribute__((destructor)) deleteAPITracerContextImp() {
+        delete pTraceRecorder;
+        pTraceRecorder = nullptr;
         delete pGlobalAPITracerContextImp;
     }
 }
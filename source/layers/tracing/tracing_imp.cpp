@@ -7,10 +7,14 @@
 
 #include "tracing_imp.h"
 
+#include <cstring>
+
 namespace tracing_layer {
 
 thread_local ze_bool_t tracingInProgress = 0;
 
+thread_local std::vector<void *> tracerInstanceUserDataScratch;
+
 struct APITracerContextImp *pGlobalAPITracerContextImp;
 
 APITracer *APITracer::create() {
@@ -40,11 +44,15 @@ ze_result_t createAPITracer(const zel_tracer_desc_t *desc,
 // Hence, this function is executing in a single threaded environment,
 // and requires no mutex.
 APITracerContextImp::~APITracerContextImp() {
-    std::list<ThreadPrivateTracerData *>::iterator itr =
-        threadTracerDataList.begin();
-    while (itr != threadTracerDataList.end()) {
-        (*itr)->clearThreadTracerDataOnList();
-        itr = threadTracerDataList.erase(itr);
+    tracerThreadRecord *record = threadRecords.load(std::memory_order_relaxed);
+    while (record != nullptr) {
+        tracerThreadRecord *next = record->next;
+        if (record->owner != nullptr) {
+            record->owner->record = nullptr;
+            record->owner->released = true;
+        }
+        delete record;
+        record = next;
     }
 }
 
@@ -251,53 +259,59 @@ void APITracerImp::copyCoreCbsToAllCbs(zel_ze_all_callbacks_t& allCbs, zel_core_
 
 }
     
-void APITracerContextImp::addThreadTracerDataToList(
-    ThreadPrivateTracerData *threadDataP) {
-    std::lock_guard<std::mutex> lock(threadTracerDataListMutex);
-    threadTracerDataList.push_back(threadDataP);
+//
+// Claim a free record of the registry for a thread, or link a new one at the
+// head.  Both are lock-free, so starting threads never wait on each other or
+// on tracer enable and disable.
+//
+tracerThreadRecord *
+APITracerContextImp::acquireThreadRecord(ThreadPrivateTracerData *owner) {
+    for (tracerThreadRecord *record = threadRecords.load(std::memory_order_acquire);
+         record != nullptr; record = record->next) {
+        bool inUse = false;
+        if (!record->inUse.load(std::memory_order_relaxed) &&
+            record->inUse.compare_exchange_strong(inUse, true,
+                                                  std::memory_order_acquire)) {
+            record->owner = owner;
+            return record;
+        }
+    }
+    tracerThreadRecord *record = new tracerThreadRecord;
+    record->epoch.store(0, std::memory_order_relaxed);
+    record->inUse.store(true, std::memory_order_relaxed);
+    record->owner = owner;
+    record->next = threadRecords.load(std::memory_order_relaxed);
+    while (!threadRecords.compare_exchange_weak(record->next, record,
+                                                std::memory_order_release,
+                                                std::memory_order_relaxed))
+        ;
+    return record;
 }
 
-void APITracerContextImp::removeThreadTracerDataFromList(
-    ThreadPrivateTracerData *threadDataP) {
-    std::lock_guard<std::mutex> lock(threadTracerDataListMutex);
-    if (threadTracerDataList.empty())
-        return;
-    threadTracerDataList.remove(threadDataP);
+void APITracerContextImp::releaseThreadRecord(tracerThreadRecord *record) {
+    record->owner = nullptr;
+    record->epoch.store(0, std::memory_order_release);
+    record->inUse.store(false, std::memory_order_release);
 }
 
 thread_local ThreadPrivateTracerData myThreadPrivateTracerData;
 
 ThreadPrivateTracerData::ThreadPrivateTracerData() {
-    isInitialized = false;
-    onList = false;
-    tracerArrayPointer.store(nullptr, std::memory_order_relaxed);
+    record = nullptr;
+    released = false;
 }
 
 ThreadPrivateTracerData::~ThreadPrivateTracerData() {
-    if (onList) {
-        pGlobalAPITracerContextImp->removeThreadTracerDataFromList(this);
-        onList = false;
-    }
-    tracerArrayPointer.store(nullptr, std::memory_order_relaxed);
+    if (record != nullptr)
+        pGlobalAPITracerContextImp->releaseThreadRecord(record);
+    record = nullptr;
+    released = true;
 }
 
-void ThreadPrivateTracerData::removeThreadTracerDataFromList(void) {
-    if (onList) {
-        pGlobalAPITracerContextImp->removeThreadTracerDataFromList(this);
-        onList = false;
-    }
-    tracerArrayPointer.store(nullptr, std::memory_order_relaxed);
-}
-
-bool ThreadPrivateTracerData::testAndSetThreadTracerDataInitializedAndOnList(
-    void) {
-    if (!isInitialized) {
-        isInitialized = true;
-        onList = true;
-        pGlobalAPITracerContextImp->addThreadTracerDataToList(
-            &myThreadPrivateTracerData);
-    }
-    return onList;
+tracerThreadRecord *ThreadPrivateTracerData::getRecord() {
+    if (record == nullptr && !released)
+        record = pGlobalAPITracerContextImp->acquireThreadRecord(this);
+    return record;
 }
 
 // bool APITracerContextImp::isTracingEnabled() { return
@@ -305,46 +319,91 @@ bool ThreadPrivateTracerData::testAndSetThreadTracerDataInitializedAndOnList(
 bool APITracerContextImp::isTracingEnabled() { return true; }
 
 //
-// Walk the list of per-thread private data structures, testing
-// whether any of them reference this array.
+// Walk the thread registry for the oldest epoch in which a call that is
+// still using a tracer array started.
 //
-// Return 1 if a reference is found.  Otherwise return 0.
+// Return UINT64_MAX if no thread is using a tracer array.
 //
-ze_bool_t
-APITracerContextImp::testForTracerArrayReferences(tracer_array_t *tracerArray) {
-    std::lock_guard<std::mutex> lock(threadTracerDataListMutex);
-    std::list<ThreadPrivateTracerData *>::iterator itr;
-    for (itr = threadTracerDataList.begin(); itr != threadTracerDataList.end();
-         itr++) {
-        if ((*itr)->tracerArrayPointer.load(std::memory_order_relaxed) ==
-            tracerArray)
-            return 1;
+uint64_t APITracerContextImp::oldestActiveEpoch() {
+    uint64_t oldest = UINT64_MAX;
+    for (tracerThreadRecord *record = threadRecords.load(std::memory_order_acquire);
+         record != nullptr; record = record->next) {
+        uint64_t epoch = record->epoch.load(std::memory_order_seq_cst);
+        if (epoch != 0 && epoch < oldest)
+            oldest = epoch;
     }
-    return 0;
+    return oldest;
 }
 
 //
-// Walk the retiring_tracer_array_list, checking each member of the list for
-// references by per thread tracer array pointer. Delete and free
-// each tracer array that has no per-thread references.
+// Walk the retiring_tracer_array_list, freeing each tracer array that
+// was retired no later than the oldest epoch still in use; any call
+// that could have loaded it has finished.
 //
 // Return the number of entries on the retiring tracer array list.
 //
 size_t APITracerContextImp::testAndFreeRetiredTracers() {
-    std::list<tracer_array_t *>::iterator itr =
+    if (retiringTracerArrayList.empty())
+        return 0;
+    uint64_t oldestEpoch = oldestActiveEpoch();
+    std::list<retiredTracerArray>::iterator itr =
         this->retiringTracerArrayList.begin();
     while (itr != this->retiringTracerArrayList.end()) {
-        tracer_array_t *retiringTracerArray = *itr;
-        itr++;
-        if (testForTracerArrayReferences(retiringTracerArray))
+        if (itr->retireEpoch > oldestEpoch) {
+            itr++;
             continue;
-        this->retiringTracerArrayList.remove(retiringTracerArray);
-        delete[] retiringTracerArray->tracerArrayEntries;
-        delete retiringTracerArray;
+        }
+        delete[] itr->tracerArray->tracerArrayEntries;
+        delete itr->tracerArray;
+        itr = this->retiringTracerArrayList.erase(itr);
     }
     return this->retiringTracerArrayList.size();
 }
 
+//
+// Set the interest bit of every callback slot that is non-null in the
+// callbacks table.
+//
+template <typename TCallbacks, size_t wordCount>
+static void addApiInterest(const TCallbacks &callbacks, uint64_t (&interest)[wordCount]) {
+    static_assert(sizeof(TCallbacks) % sizeof(void *) == 0,
+                  "callback tables hold only function pointers");
+    const size_t slotCount = sizeof(TCallbacks) / sizeof(void *);
+    auto bytes = reinterpret_cast<const unsigned char *>(&callbacks);
+    for (size_t slot = 0; slot < slotCount; slot++) {
+        uintptr_t callback;
+        memcpy(&callback, bytes + slot * sizeof(void *), sizeof(callback));
+        if (callback)
+            interest[slot / 64] |= uint64_t(1) << (slot % 64);
+    }
+}
+
+void APITracerContextImp::updateApiInterest(const tracer_array_t *tracerArray) {
+    uint64_t coreInterest[sizeof(coreApiInterest) / sizeof(coreApiInterest[0])] = {};
+    uint64_t runtimeInterest[sizeof(runtimeApiInterest) / sizeof(runtimeApiInterest[0])] = {};
+    for (size_t i = 0; i < tracerArray->tracerArrayCount; i++) {
+        auto &entry = tracerArray->tracerArrayEntries[i];
+        addApiInterest(entry.corePrologues, coreInterest);
+        addApiInterest(entry.coreEpilogues, coreInterest);
+        addApiInterest(entry.runtimePrologues, runtimeInterest);
+        addApiInterest(entry.runtimeEpilogues, runtimeInterest);
+    }
+    if (allApisTraced) {
+        memset(coreInterest, 0xff, sizeof(coreInterest));
+        memset(runtimeInterest, 0xff, sizeof(runtimeInterest));
+    }
+    for (size_t i = 0; i < sizeof(coreInterest) / sizeof(coreInterest[0]); i++)
+        coreApiInterest[i].store(coreInterest[i], std::memory_order_relaxed);
+    for (size_t i = 0; i < sizeof(runtimeInterest) / sizeof(runtimeInterest[0]); i++)
+        runtimeApiInterest[i].store(runtimeInterest[i], std::memory_order_relaxed);
+}
+
+void APITracerContextImp::traceAllApis() {
+    std::lock_guard<std::mutex> lock(traceTableMutex);
+    allApisTraced = true;
+    updateApiInterest(activeTracerArray.load(std::memory_order_relaxed));
+}
+
 size_t APITracerContextImp::updateTracerArrays() {
     tracer_array_t *newTracerArray;
     size_t newTracerArrayCount = this->enabledTracerImpList.size();
@@ -378,15 +437,24 @@ size_t APITracerContextImp::updateTracerArrays() {
     //
     tracer_array_t *active_tracer_array_shadow =
         activeTracerArray.load(std::memory_order_relaxed);
+    //
+    // The new array is published before the epoch advances, both in the
+    // single total order of seq_cst operations.  A call that observes the
+    // new epoch therefore loads the new array, and the old array is retired
+    // in the new epoch: only calls that started in an earlier one can hold it.
+    //
+    activeTracerArray.store(newTracerArray, std::memory_order_seq_cst);
+    uint64_t retireEpoch =
+        globalEpoch.fetch_add(1, std::memory_order_seq_cst) + 1;
     if (active_tracer_array_shadow != &emptyTracerArray) {
-        retiringTracerArrayList.push_back(active_tracer_array_shadow);
+        retiringTracerArrayList.push_back({active_tracer_array_shadow, retireEpoch});
     }
     //
-    // This active_tracer_array.store must use memory_order_release.
-    // This store DOES signal a logical transfer of tracer state information
-    // from this thread to the tracing threads.
+    // The interest bits only decide whether a call looks at the tracer array
+    // at all, so they can change after the array is published: a call that
+    // races with the update traces with either the old or the new tracers.
     //
-    activeTracerArray.store(newTracerArray, std::memory_order_release);
+    updateApiInterest(newTracerArray);
     return testAndFreeRetiredTracers();
 }
 
@@ -472,29 +540,23 @@ ze_result_t APITracerContextImp::finalizeDisableImpTracingWait(
 }
 
 void *APITracerContextImp::getActiveTracersList() {
-    tracer_array_t *stableTracerArray = nullptr;
-
-    if (!myThreadPrivateTracerData
-             .testAndSetThreadTracerDataInitializedAndOnList()) {
+    tracerThreadRecord *record = myThreadPrivateTracerData.getRecord();
+    if (record == nullptr)
         return nullptr;
-    }
 
-    do {
-        stableTracerArray = pGlobalAPITracerContextImp->activeTracerArray.load(
-            std::memory_order_acquire);
-        myThreadPrivateTracerData.tracerArrayPointer.store(
-            stableTracerArray, std::memory_order_relaxed);
-    } while (stableTracerArray !=
-             pGlobalAPITracerContextImp->activeTracerArray.load(
-                 std::memory_order_relaxed));
-    return (void *)stableTracerArray;
+    //
+    // Announce the epoch this call starts in before loading the array, so a
+    // writer that retires the array afterwards waits for this call to end.
+    //
+    record->epoch.store(globalEpoch.load(std::memory_order_seq_cst),
+                        std::memory_order_seq_cst);
+    return (void *)activeTracerArray.load(std::memory_order_seq_cst);
 }
 
 void APITracerContextImp::releaseActivetracersList() {
-    if (myThreadPrivateTracerData
-            .testAndSetThreadTracerDataInitializedAndOnList())
-        myThreadPrivateTracerData.tracerArrayPointer.store(
-            nullptr, std::memory_order_relaxed);
+    tracerThreadRecord *record = myThreadPrivateTracerData.record;
+    if (record != nullptr)
+        record->epoch.store(0, std::memory_order_release);
 }
 
 } // namespace tracing_layer
@@ -8,11 +8,14 @@
 #pragma once
 
 #include "tracing.h"
+#include "tracing_recorder.h"
 #include "ze_api.h"
 #include "ze_tracing_cb_structs.h"
 
 #include <atomic>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
 #include <list>
 #include <mutex>
@@ -68,17 +71,33 @@ struct APITracerImp : APITracer {
     void copyCoreCbsToAllCbs(zel_ze_all_callbacks_t& allCbs, zel_core_callbacks_t& Cbs);
 };
 
+//
+// A thread's slot in the lock-free registry of threads that make traced
+// calls.  While the thread uses a tracer array, epoch holds the global epoch
+// it observed before loading the array; otherwise it is zero.  Records are
+// never unlinked while tracing is loaded: a record released by an exiting
+// thread is claimed by the next thread that makes a traced call.
+//
+struct tracerThreadRecord {
+    std::atomic<uint64_t> epoch;
+    std::atomic<bool> inUse;
+    tracerThreadRecord *next;
+    class ThreadPrivateTracerData *owner;
+    // records are written by different threads; keep each on its own line
+    char padding[32];
+};
+
 class ThreadPrivateTracerData {
   public:
-    void clearThreadTracerDataOnList(void) { onList = false; }
-    void removeThreadTracerDataFromList(void);
-    bool testAndSetThreadTracerDataInitializedAndOnList(void);
-    bool onList;
-    bool isInitialized;
     ThreadPrivateTracerData();
     ~ThreadPrivateTracerData();
 
-    std::atomic<tracer_array_t *> tracerArrayPointer;
+    // This thread's record, claimed on its first traced call; null once
+    // the thread or the tracing context has gone away
+    tracerThreadRecord *getRecord();
+
+    tracerThreadRecord *record;
+    bool released;
 
   private:
     ThreadPrivateTracerData(const ThreadPrivateTracerData &);
@@ -89,6 +108,12 @@ struct APITracerContextImp : APITracerContext {
   public:
     APITracerContextImp() {
         activeTracerArray.store(&emptyTracerArray, std::memory_order_relaxed);
+        globalEpoch.store(1, std::memory_order_relaxed);
+        threadRecords.store(nullptr, std::memory_order_relaxed);
+        for (auto &word : coreApiInterest)
+            word.store(0, std::memory_order_relaxed);
+        for (auto &word : runtimeApiInterest)
+            word.store(0, std::memory_order_relaxed);
     };
 
     ~APITracerContextImp() override;
@@ -104,50 +129,96 @@ struct APITracerContextImp : APITracerContext {
 
     bool isTracingEnabled();
 
-    void addThreadTracerDataToList(ThreadPrivateTracerData *threadDataP);
-    void removeThreadTracerDataFromList(ThreadPrivateTracerData *threadDataP);
+    tracerThreadRecord *acquireThreadRecord(ThreadPrivateTracerData *owner);
+    void releaseThreadRecord(tracerThreadRecord *record);
+
+    // Mark every API as traced, for the recorder
+    void traceAllApis();
+
+    //
+    // Whether any enabled tracer has a prologue or epilogue for an API, by
+    // the slot of its callback in zel_ze_all_callbacks_t or
+    // zel_zer_all_callbacks_t.  Intercepts check this before anything else
+    // and call the driver directly when no tracer is interested.
+    //
+    bool isCoreApiTraced(size_t slot) const {
+        return (coreApiInterest[slot / 64].load(std::memory_order_relaxed) >> (slot % 64)) & 1;
+    }
+    bool isRuntimeApiTraced(size_t slot) const {
+        return (runtimeApiInterest[slot / 64].load(std::memory_order_relaxed) >> (slot % 64)) & 1;
+    }
 
   private:
+    static constexpr size_t coreCallbackSlots = sizeof(zel_ze_all_callbacks_t) / sizeof(void *);
+    static constexpr size_t runtimeCallbackSlots = sizeof(zel_zer_all_callbacks_t) / sizeof(void *);
+    std::atomic<uint64_t> coreApiInterest[(coreCallbackSlots + 63) / 64];
+    std::atomic<uint64_t> runtimeApiInterest[(runtimeCallbackSlots + 63) / 64];
+    bool allApisTraced = false;
+
     std::mutex traceTableMutex;
     tracer_array_t emptyTracerArray = {0, NULL};
     std::atomic<tracer_array_t *> activeTracerArray;
 
     //
     // a list of tracer arrays that were once active, but
-    // have been replaced by a new active array.  These
-    // once-active tracer arrays may continue for some time
-    // to have references to them among the per-thread
-    // tracer array pointers.
+    // have been replaced by a new active array, each with
+    // the epoch in which it was replaced.  A retired array
+    // may still be in use by threads whose calls started
+    // in an earlier epoch, and is freed once none remain.
     //
-    std::list<tracer_array_t *> retiringTracerArrayList;
+    struct retiredTracerArray {
+        tracer_array_t *tracerArray;
+        uint64_t retireEpoch;
+    };
+    std::list<retiredTracerArray> retiringTracerArrayList;
 
     std::list<struct APITracerImp *> enabledTracerImpList;
 
-    ze_bool_t testForTracerArrayReferences(tracer_array_t *tracerArray);
+    uint64_t oldestActiveEpoch();
     size_t testAndFreeRetiredTracers();
     size_t updateTracerArrays();
+    void updateApiInterest(const tracer_array_t *tracerArray);
 
-    std::list<ThreadPrivateTracerData *> threadTracerDataList;
-    std::mutex threadTracerDataListMutex;
+    std::atomic<uint64_t> globalEpoch;
+    std::atomic<tracerThreadRecord *> threadRecords;
 };
 
 extern thread_local ThreadPrivateTracerData myThreadPrivateTracerData;
 
+//
+// The callbacks of one API across the tracers of a stable tracer array, read
+// from the array entries in place so a traced call copies nothing.  The API's
+// recorder id and name travel with them.
+//
 template <class T>
-class APITracerCallbackStateImp {
+class APITracerCallbackListImp {
   public:
-    T current_api_callback;
-    void *pUserData;
+    tracer_array_t *tracerArray = nullptr;
+    T (*select)(const tracer_array_entry_t &entry) = nullptr;
+    uint16_t apiId = 0;
+    const char *apiName = nullptr;
+
+    size_t size() const { return tracerArray ? tracerArray->tracerArrayCount : 0; }
+    T callback(size_t i) const { return select(tracerArray->tracerArrayEntries[i]); }
+    void *pUserData(size_t i) const { return tracerArray->tracerArrayEntries[i].pUserData; }
 };
 
 template <class T>
 class APITracerCallbackDataImp {
   public:
     T apiOrdinal = nullptr;
-    std::vector<tracing_layer::APITracerCallbackStateImp<T>> prologCallbacks;
-    std::vector<tracing_layer::APITracerCallbackStateImp<T>> epilogCallbacks;
+    APITracerCallbackListImp<T> prologCallbacks;
+    APITracerCallbackListImp<T> epilogCallbacks;
 };
 
+//
+// Per-instance user data lives on the stack for up to this many tracers; more
+// tracers share a thread-local scratch buffer, which is safe because tracing
+// does not recurse on a thread.
+//
+constexpr size_t maxStackTracerInstances = 8;
+extern thread_local std::vector<void *> tracerInstanceUserDataScratch;
+
 #define ZE_HANDLE_TRACER_RECURSION(ze_api_ptr, ...) \
     do {                                            \
         if (tracing_layer::tracingInProgress) {     \
@@ -156,75 +227,58 @@ class APITracerCallbackDataImp {
         tracing_layer::tracingInProgress = 1;       \
     } while (0)
 
-#define ZE_GEN_TRACER_ARRAY_ENTRY(callbackPtr, tracerArray, tracerArrayIndex, \
-                                  callbackType, callbackCategory,             \
-                                  callbackFunction)                           \
-    do {                                                                      \
-        callbackPtr = tracerArray->tracerArrayEntries[tracerArrayIndex]       \
-                          .callbackType.callbackCategory.callbackFunction;    \
-    } while (0)
-
-#define ZE_GEN_PER_API_CALLBACK_STATE(perApiCallbackData, tracerType,               \
-                                      callbackCategory, callbackFunctionType)       \
-    tracing_layer::tracer_array_t *currentTracerArray;                              \
-    currentTracerArray =                                                            \
-        (tracing_layer::tracer_array_t *)                                           \
-            tracing_layer::pGlobalAPITracerContextImp->getActiveTracersList();      \
-    if (currentTracerArray) {                                                       \
-        for (size_t i = 0; i < currentTracerArray->tracerArrayCount; i++) {         \
-            tracerType prologueCallbackPtr;                                         \
-            tracerType epilogue_callback_ptr;                                       \
-            ZE_GEN_TRACER_ARRAY_ENTRY(prologueCallbackPtr, currentTracerArray, i,   \
-                                      corePrologues, callbackCategory,              \
-                                      callbackFunctionType);                        \
-            ZE_GEN_TRACER_ARRAY_ENTRY(epilogue_callback_ptr, currentTracerArray, i, \
-                                      coreEpilogues, callbackCategory,              \
-                                      callbackFunctionType);                        \
-                                                                                    \
-            tracing_layer::APITracerCallbackStateImp<tracerType> prologCallback;    \
-            prologCallback.current_api_callback = prologueCallbackPtr;              \
-            prologCallback.pUserData =                                              \
-                currentTracerArray->tracerArrayEntries[i].pUserData;                \
-            perApiCallbackData.prologCallbacks.push_back(prologCallback);           \
-                                                                                    \
-            tracing_layer::APITracerCallbackStateImp<tracerType> epilogCallback;    \
-            epilogCallback.current_api_callback = epilogue_callback_ptr;            \
-            epilogCallback.pUserData =                                              \
-                currentTracerArray->tracerArrayEntries[i].pUserData;                \
-            perApiCallbackData.epilogCallbacks.push_back(epilogCallback);           \
-        }                                                                           \
-    }
-
-#define ZER_GEN_PER_API_CALLBACK_STATE(perApiCallbackData, tracerType,               \
-                                       callbackCategory, callbackFunctionType)       \
-    tracing_layer::tracer_array_t *currentTracerArray;                               \
-    currentTracerArray =                                                             \
-        (tracing_layer::tracer_array_t *)                                            \
-            tracing_layer::pGlobalAPITracerContextImp->getActiveTracersList();       \
-    if (currentTracerArray) {                                                        \
-        for (size_t i = 0; i < currentTracerArray->tracerArrayCount; i++){           \
-            tracerType prologueCallbackPtr;                                          \
-            tracerType epilogue_callback_ptr;                                        \
-            ZE_GEN_TRACER_ARRAY_ENTRY(prologueCallbackPtr, currentTracerArray, i,    \
-                                       runtimePrologues, callbackCategory,           \
-                                       callbackFunctionType);                        \
-            ZE_GEN_TRACER_ARRAY_ENTRY(epilogue_callback_ptr, currentTracerArray, i,  \
-                                       runtimeEpilogues, callbackCategory,           \
-                                       callbackFunctionType);                        \
-                                                                                     \
-            tracing_layer::APITracerCallbackStateImp<tracerType> prologCallback;     \
-            prologCallback.current_api_callback = prologueCallbackPtr;               \
-            prologCallback.pUserData =                                               \
-                currentTracerArray->tracerArrayEntries[i].pUserData;                 \
-            perApiCallbackData.prologCallbacks.push_back(prologCallback);            \
-                                                                                     \
-            tracing_layer::APITracerCallbackStateImp<tracerType> epilogCallback;     \
-            epilogCallback.current_api_callback = epilogue_callback_ptr;             \
-            epilogCallback.pUserData =                                               \
-                currentTracerArray->tracerArrayEntries[i].pUserData;                 \
-            perApiCallbackData.epilogCallbacks.push_back(epilogCallback);            \
-        }                                                                            \
-    }
+#define ZE_API_IS_TRACED(callbackCategory, callbackFunctionType)              \
+    tracing_layer::pGlobalAPITracerContextImp->isCoreApiTraced(               \
+        offsetof(zel_ze_all_callbacks_t,                                      \
+                 callbackCategory.callbackFunctionType) / sizeof(void *))
+
+#define ZER_API_IS_TRACED(callbackCategory, callbackFunctionType)             \
+    tracing_layer::pGlobalAPITracerContextImp->isRuntimeApiTraced(            \
+        offsetof(zel_zer_all_callbacks_t,                                     \
+                 callbackCategory.callbackFunctionType) / sizeof(void *))
+
+#define ZE_GEN_PER_API_CALLBACK_STATE(perApiCallbackData, tracerType,                 \
+                                      callbackCategory, callbackFunctionType)         \
+    tracing_layer::tracer_array_t *currentTracerArray;                                \
+    currentTracerArray =                                                              \
+        (tracing_layer::tracer_array_t *)                                             \
+            tracing_layer::pGlobalAPITracerContextImp->getActiveTracersList();        \
+    perApiCallbackData.prologCallbacks.apiId = static_cast<uint16_t>(                 \
+        offsetof(zel_ze_all_callbacks_t,                                              \
+                 callbackCategory.callbackFunctionType) / sizeof(void *));            \
+    perApiCallbackData.prologCallbacks.apiName = __func__;                            \
+    perApiCallbackData.prologCallbacks.tracerArray = currentTracerArray;              \
+    perApiCallbackData.prologCallbacks.select =                                       \
+        [](const tracing_layer::tracer_array_entry_t &entry) -> tracerType {          \
+            return entry.corePrologues.callbackCategory.callbackFunctionType;         \
+        };                                                                            \
+    perApiCallbackData.epilogCallbacks.tracerArray = currentTracerArray;              \
+    perApiCallbackData.epilogCallbacks.select =                                       \
+        [](const tracing_layer::tracer_array_entry_t &entry) -> tracerType {          \
+            return entry.coreEpilogues.callbackCategory.callbackFunctionType;         \
+        };
+
+#define ZER_GEN_PER_API_CALLBACK_STATE(perApiCallbackData, tracerType,                \
+                                       callbackCategory, callbackFunctionType)        \
+    tracing_layer::tracer_array_t *currentTracerArray;                                \
+    currentTracerArray =                                                              \
+        (tracing_layer::tracer_array_t *)                                             \
+            tracing_layer::pGlobalAPITracerContextImp->getActiveTracersList();        \
+    perApiCallbackData.prologCallbacks.apiId = static_cast<uint16_t>(                 \
+        tracing_layer::traceRecorder::coreApiCount +                                  \
+        offsetof(zel_zer_all_callbacks_t,                                             \
+                 callbackCategory.callbackFunctionType) / sizeof(void *));            \
+    perApiCallbackData.prologCallbacks.apiName = __func__;                            \
+    perApiCallbackData.prologCallbacks.tracerArray = currentTracerArray;              \
+    perApiCallbackData.prologCallbacks.select =                                       \
+        [](const tracing_layer::tracer_array_entry_t &entry) -> tracerType {          \
+            return entry.runtimePrologues.callbackCategory.callbackFunctionType;      \
+        };                                                                            \
+    perApiCallbackData.epilogCallbacks.tracerArray = currentTracerArray;              \
+    perApiCallbackData.epilogCallbacks.select =                                       \
+        [](const tracing_layer::tracer_array_entry_t &entry) -> tracerType {          \
+            return entry.runtimeEpilogues.callbackCategory.callbackFunctionType;      \
+        };
 
 template <typename TRet, typename TFunction_pointer, typename TParams, typename TTracer,
           typename TTracerPrologCallbacks, typename TTracerEpilogCallbacks,
@@ -235,26 +289,35 @@ APITracerWrapperImp(TFunction_pointer zeApiPtr, TParams paramsStruct,
                     TTracerEpilogCallbacks epilogCallbacks, Args &&...args)
 {
     TRet ret {};
-    std::vector<APITracerCallbackStateImp<TTracer>> *callbacks_prologs =
-        &prologCallbacks;
+    size_t tracerCount = prologCallbacks.size();
 
-    std::vector<void *> ppTracerInstanceUserData;
-    ppTracerInstanceUserData.resize(callbacks_prologs->size());
+    void *stackInstanceUserData[maxStackTracerInstances] = {};
+    void **ppTracerInstanceUserData = stackInstanceUserData;
+    if (tracerCount > maxStackTracerInstances) {
+        tracerInstanceUserDataScratch.assign(tracerCount, nullptr);
+        ppTracerInstanceUserData = tracerInstanceUserDataScratch.data();
+    }
 
-    for (size_t i = 0; i < callbacks_prologs->size(); i++) {
-        if (callbacks_prologs->at(i).current_api_callback != nullptr)
-            callbacks_prologs->at(i).current_api_callback(
-                paramsStruct, ret, callbacks_prologs->at(i).pUserData,
-                &ppTracerInstanceUserData[i]);
+    for (size_t i = 0; i < tracerCount; i++) {
+        auto callback = prologCallbacks.callback(i);
+        if (callback != nullptr)
+            callback(paramsStruct, ret, prologCallbacks.pUserData(i),
+                     &ppTracerInstanceUserData[i]);
+    }
+    if (pTraceRecorder != nullptr) {
+        uint64_t startTicks = traceRecorder::ticks();
+        ret = zeApiPtr(args...);
+        pTraceRecorder->record(prologCallbacks.apiId, prologCallbacks.apiName,
+                               startTicks, traceRecorder::ticks(),
+                               recordedFirstArgument(args...), recordedValue(ret));
+    } else {
+        ret = zeApiPtr(args...);
     }
-    ret = zeApiPtr(args...);
-    std::vector<APITracerCallbackStateImp<TTracer>> *callbacksEpilogs =
-        &epilogCallbacks;
-    for (size_t i = 0; i < callbacksEpilogs->size(); i++) {
-        if (callbacksEpilogs->at(i).current_api_callback != nullptr)
-            callbacksEpilogs->at(i).current_api_callback(
-                paramsStruct, ret, callbacksEpilogs->at(i).pUserData,
-                &ppTracerInstanceUserData[i]);
+    for (size_t i = 0; i < tracerCount; i++) {
+        auto callback = epilogCallbacks.callback(i);
+        if (callback != nullptr)
+            callback(paramsStruct, ret, epilogCallbacks.pUserData(i),
+                     &ppTracerInstanceUserData[i]);
     }
     tracing_layer::tracingInProgress = 0;
     tracing_layer::pGlobalAPITracerContextImp->releaseActivetracersList();
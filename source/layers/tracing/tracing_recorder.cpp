@@ -0,0 +1,222 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "tracing_recorder.h"
+
+#include <cstdlib>
+#include <cstring>
+
+#if defined(_WIN32)
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace tracing_layer {
+
+traceRecorder *pTraceRecorder = nullptr;
+
+static constexpr char recordingMagic[8] = {'Z', 'E', 'L', 'T', 'R', 'E', 'C', '\0'};
+static constexpr char recordingEndMagic[8] = {'Z', 'E', 'L', 'T', 'E', 'N', 'D', '\0'};
+static constexpr uint32_t recordingVersion = 1;
+
+static thread_local recorderThreadState myRecorderThreadState;
+
+traceRecorder *traceRecorder::createFromEnvironment() {
+    auto requestedPath = getenv("ZEL_TRACING_RECORD_FILE");
+    if (requestedPath == nullptr || *requestedPath == '\0')
+        return nullptr;
+
+    // Unique filename per process, with the PID inserted before the extension
+#if defined(_WIN32)
+    auto pid = _getpid();
+#else
+    auto pid = getpid();
+#endif
+    std::string path = requestedPath;
+    size_t dotPos = path.find_last_of('.');
+    if (dotPos != std::string::npos) {
+        path.insert(dotPos, "_pid" + std::to_string(pid));
+    } else {
+        path += "_pid" + std::to_string(pid);
+    }
+
+    FILE *file = fopen(path.c_str(), "wb");
+    if (file == nullptr)
+        return nullptr;
+    return new traceRecorder(file, static_cast<uint64_t>(pid));
+}
+
+traceRecorder::traceRecorder(FILE *file, uint64_t pid) : file(file) {
+    setvbuf(file, nullptr, _IOFBF, 1 << 20);
+
+    recordingFileHeader header = {};
+    memcpy(header.magic, recordingMagic, sizeof(header.magic));
+    header.version = recordingVersion;
+    header.recordSize = sizeof(callRecord);
+    header.pid = pid;
+    fwrite(&header, sizeof(header), 1, file);
+
+    apiNames.reset(new std::atomic<const char *>[apiCount]);
+    for (size_t i = 0; i < apiCount; i++)
+        apiNames[i].store(nullptr, std::memory_order_relaxed);
+
+    openTicks = ticks();
+    openNs = steadyNs();
+    flusher = std::thread(&traceRecorder::flusherLoop, this);
+}
+
+// Called while the tracing layer unloads, after the application's threads
+// have stopped making calls.
+traceRecorder::~traceRecorder() {
+    {
+        std::lock_guard<std::mutex> lock(flusherMutex);
+        stopFlusher = true;
+    }
+    flusherWake.notify_one();
+    flusher.join();
+    drain();
+
+    recordingFileFooter footer = {};
+    footer.closeTicks = ticks();
+    footer.closeNs = steadyNs();
+    footer.openTicks = openTicks;
+    footer.openNs = openNs;
+    footer.dropped = dropped.load(std::memory_order_relaxed);
+    footer.nameTableOffset = static_cast<uint64_t>(ftell(file));
+    for (size_t i = 0; i < apiCount; i++) {
+        const char *name = apiNames[i].load(std::memory_order_relaxed);
+        if (name == nullptr)
+            continue;
+        uint16_t entry[2] = {static_cast<uint16_t>(i), static_cast<uint16_t>(strlen(name))};
+        fwrite(entry, sizeof(entry), 1, file);
+        fwrite(name, 1, entry[1], file);
+        footer.nameCount++;
+    }
+    memcpy(footer.magic, recordingEndMagic, sizeof(footer.magic));
+    fwrite(&footer, sizeof(footer), 1, file);
+    fclose(file);
+
+    threadRing *ring = rings.load(std::memory_order_relaxed);
+    while (ring != nullptr) {
+        threadRing *next = ring->next;
+        if (ring->owner != nullptr) {
+            ring->owner->ring = nullptr;
+            ring->owner->released = true;
+        }
+        delete ring;
+        ring = next;
+    }
+}
+
+//
+// Claim a ring released by an exited thread, or link a new one at the head.
+// Both are lock-free, like the tracing context's thread registry.
+//
+traceRecorder::threadRing *traceRecorder::acquireRing(recorderThreadState *owner) {
+    for (threadRing *ring = rings.load(std::memory_order_acquire); ring != nullptr;
+         ring = ring->next) {
+        bool inUse = false;
+        if (!ring->inUse.load(std::memory_order_relaxed) &&
+            ring->inUse.compare_exchange_strong(inUse, true, std::memory_order_acquire)) {
+            ring->owner = owner;
+            return ring;
+        }
+    }
+    threadRing *ring = new threadRing;
+    ring->head.store(0, std::memory_order_relaxed);
+    ring->tail.store(0, std::memory_order_relaxed);
+    ring->inUse.store(true, std::memory_order_relaxed);
+    ring->owner = owner;
+    ring->next = rings.load(std::memory_order_relaxed);
+    while (!rings.compare_exchange_weak(ring->next, ring, std::memory_order_release,
+                                        std::memory_order_relaxed))
+        ;
+    return ring;
+}
+
+void traceRecorder::releaseRing(threadRing *ring) {
+    ring->owner = nullptr;
+    ring->inUse.store(false, std::memory_order_release);
+}
+
+recorderThreadState::~recorderThreadState() {
+    if (ring != nullptr && pTraceRecorder != nullptr)
+        pTraceRecorder->releaseRing(ring);
+    ring = nullptr;
+    released = true;
+}
+
+void traceRecorder::record(uint16_t apiId, const char *apiName, uint64_t startTicks,
+                           uint64_t endTicks, uint64_t handle, uint64_t result) {
+    recorderThreadState &state = myRecorderThreadState;
+    if (state.ring == nullptr) {
+        if (state.released)
+            return;
+        state.ring = acquireRing(&state);
+        state.threadId = nextThreadId.fetch_add(1, std::memory_order_relaxed);
+    }
+    threadRing *ring = state.ring;
+
+    if (apiNames[apiId].load(std::memory_order_relaxed) == nullptr)
+        apiNames[apiId].store(apiName, std::memory_order_relaxed);
+
+    uint64_t tail = ring->tail.load(std::memory_order_relaxed);
+    if (tail - ring->head.load(std::memory_order_acquire) >= ringCapacity) {
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    callRecord &slot = ring->records[tail & (ringCapacity - 1)];
+    slot.startTicks = startTicks;
+    slot.endTicks = endTicks;
+    slot.handle = handle;
+    slot.result = result;
+    slot.threadId = state.threadId;
+    slot.apiId = apiId;
+    slot.reserved = 0;
+    ring->tail.store(tail + 1, std::memory_order_release);
+}
+
+//
+// Write every record published so far and hand the slots back to the
+// owning threads.  Only the flusher, or the destructor once the flusher has
+// stopped, drains.
+//
+// Return the number of records written.
+//
+size_t traceRecorder::drain() {
+    size_t written = 0;
+    for (threadRing *ring = rings.load(std::memory_order_acquire); ring != nullptr;
+         ring = ring->next) {
+        uint64_t head = ring->head.load(std::memory_order_relaxed);
+        uint64_t tail = ring->tail.load(std::memory_order_acquire);
+        while (head != tail) {
+            size_t index = static_cast<size_t>(head & (ringCapacity - 1));
+            size_t count = static_cast<size_t>(tail - head);
+            if (count > ringCapacity - index)
+                count = ringCapacity - index;
+            fwrite(&ring->records[index], sizeof(callRecord), count, file);
+            head += count;
+            written += count;
+        }
+        ring->head.store(head, std::memory_order_release);
+    }
+    return written;
+}
+
+void traceRecorder::flusherLoop() {
+    std::unique_lock<std::mutex> lock(flusherMutex);
+    while (!stopFlusher) {
+        flusherWake.wait_for(lock, std::chrono::milliseconds(20));
+        lock.unlock();
+        if (drain() != 0)
+            fflush(file);
+        lock.lock();
+    }
+}
+
+} // namespace tracing_layer
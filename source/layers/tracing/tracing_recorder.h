@@ -0,0 +1,190 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "ze_tracing_cb_structs.h"
+#include "zer_tracing_cb_structs.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define ZEL_RECORDER_HAS_TSC 1
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define ZEL_RECORDER_HAS_TSC 1
+#endif
+
+namespace tracing_layer {
+
+//
+// Built-in recorder of every traced call, enabled with
+// ZEL_TRACING_RECORD_FILE.  Each call is one fixed-size record written to a
+// ring owned by the calling thread; a flusher thread drains the rings into a
+// binary file every few milliseconds, so the calling thread never takes a lock
+// or touches the file.  A full ring drops the record and counts the drop.
+// The file is converted to Chrome trace JSON with
+// scripts/convert_tracing_recording.py.
+//
+class traceRecorder {
+  public:
+    // Null unless ZEL_TRACING_RECORD_FILE names a file that could be opened
+    static traceRecorder *createFromEnvironment();
+    ~traceRecorder();
+
+    // Time stamp counter where available, steady clock nanoseconds elsewhere;
+    // the file footer calibrates ticks against the steady clock
+    static uint64_t ticks() {
+#if defined(ZEL_RECORDER_HAS_TSC)
+        return __rdtsc();
+#else
+        return steadyNs();
+#endif
+    }
+
+    // API ids are callback slots: core APIs first, then runtime APIs
+    static constexpr size_t coreApiCount = sizeof(zel_ze_all_callbacks_t) / sizeof(void *);
+    static constexpr size_t runtimeApiCount = sizeof(zel_zer_all_callbacks_t) / sizeof(void *);
+    static constexpr size_t apiCount = coreApiCount + runtimeApiCount;
+
+    // apiName must be a string literal
+    void record(uint16_t apiId, const char *apiName, uint64_t startTicks,
+                uint64_t endTicks, uint64_t handle, uint64_t result);
+
+    // Native byte order; must match convert_tracing_recording.py
+    struct callRecord {
+        uint64_t startTicks;
+        uint64_t endTicks;
+        uint64_t handle; // first argument of the call
+        uint64_t result;
+        uint32_t threadId;
+        uint16_t apiId;
+        uint16_t reserved;
+    };
+    static_assert(sizeof(callRecord) == 40, "recording file records are 40 bytes");
+
+    struct recordingFileHeader {
+        char magic[8]; // "ZELTREC\0"
+        uint32_t version;
+        uint32_t recordSize;
+        uint64_t pid;
+    };
+
+    //
+    // Written last, after the API name table: apiId, name length and the
+    // name for each API that was called, without terminators.
+    //
+    struct recordingFileFooter {
+        uint64_t openTicks;
+        uint64_t openNs;
+        uint64_t closeTicks;
+        uint64_t closeNs;
+        uint64_t dropped;
+        uint64_t nameTableOffset;
+        uint32_t nameCount;
+        uint32_t reserved;
+        char magic[8]; // "ZELTEND\0"
+    };
+
+    //
+    // A thread's ring.  Rings are never unlinked while the recorder exists: a
+    // ring released by an exiting thread is claimed by the next thread that
+    // records, and keeps any records the flusher has not drained yet.
+    //
+    static constexpr size_t ringCapacity = 4096;
+    struct threadRing {
+        std::atomic<uint64_t> head; // advanced by the flusher
+        std::atomic<uint64_t> tail; // advanced by the owning thread
+        std::atomic<bool> inUse;
+        threadRing *next;
+        class recorderThreadState *owner;
+        callRecord records[ringCapacity];
+    };
+
+    threadRing *acquireRing(recorderThreadState *owner);
+    void releaseRing(threadRing *ring);
+
+  private:
+    explicit traceRecorder(FILE *file, uint64_t pid);
+
+    static uint64_t steadyNs() {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    size_t drain();
+    void flusherLoop();
+
+    FILE *file;
+    uint64_t openTicks;
+    uint64_t openNs;
+
+    std::atomic<threadRing *> rings{nullptr};
+    std::atomic<uint32_t> nextThreadId{1};
+    std::atomic<uint64_t> dropped{0};
+    std::unique_ptr<std::atomic<const char *>[]> apiNames;
+
+    std::mutex flusherMutex;
+    std::condition_variable flusherWake;
+    bool stopFlusher = false;
+    std::thread flusher;
+};
+
+class recorderThreadState {
+  public:
+    ~recorderThreadState();
+
+    traceRecorder::threadRing *ring = nullptr;
+    uint32_t threadId = 0;
+    bool released = false;
+};
+
+extern traceRecorder *pTraceRecorder;
+
+//
+// The value of a call's first argument or result as recorded: handles and
+// pointers by address, integers and enums by value, anything else as zero.
+//
+template <typename T>
+typename std::enable_if<std::is_pointer<T>::value, uint64_t>::type
+recordedValue(T value) {
+    return reinterpret_cast<uintptr_t>(value);
+}
+
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value || std::is_enum<T>::value, uint64_t>::type
+recordedValue(T value) {
+    return static_cast<uint64_t>(value);
+}
+
+template <typename T>
+typename std::enable_if<!std::is_pointer<T>::value && !std::is_integral<T>::value &&
+                            !std::is_enum<T>::value,
+                        uint64_t>::type
+recordedValue(const T &) {
+    return 0;
+}
+
+inline uint64_t recordedFirstArgument() { return 0; }
+
+template <typename TFirst, typename... Rest>
+uint64_t recordedFirstArgument(const TFirst &first, const Rest &...) {
+    return recordedValue<TFirst>(first);
+}
+
+} // namespace tracing_layer
@@ -17,9 +17,14 @@ namespace tracing_layer {
  */
 extern "C" BOOL APIENTRY DllMain(HINSTANCE hinstDLL, DWORD fdwReason, LPVOID lpvReserved) {
     if (fdwReason == DLL_PROCESS_DETACH) {
+      delete pTraceRecorder;
+      pTraceRecorder = nullptr;
       delete pGlobalAPITracerContextImp;
     } else if (fdwReason == DLL_PROCESS_ATTACH) {
       pGlobalAPITracerContextImp = new APITracerContextImp;
+      pTraceRecorder = traceRecorder::createFromEnvironment();
+      if (pTraceRecorder != nullptr)
+          pGlobalAPITracerContextImp->traceAllApis();
     }
    return TRUE;
 }
@@ -26,6 +26,9 @@ namespace tracing_layer
         if( nullptr == pfnInit)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Global, pfnInitCb) )
+            return pfnInit( flags );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Global.pfnInit, flags);
 
         // capture parameters
@@ -65,6 +68,9 @@ namespace tracing_layer
         if( nullptr == pfnGet)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Driver, pfnGetCb) )
+            return pfnGet( pCount, phDrivers );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Driver.pfnGet, pCount, phDrivers);
 
         // capture parameters
@@ -108,6 +114,9 @@ namespace tracing_layer
         if( nullptr == pfnInitDrivers)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Global, pfnInitDriversCb) )
+            return pfnInitDrivers( pCount, phDrivers, desc );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Global.pfnInitDrivers, pCount, phDrivers, desc);
 
         // capture parameters
@@ -145,6 +154,9 @@ namespace tracing_layer
         if( nullptr == pfnGetApiVersion)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Driver, pfnGetApiVersionCb) )
+            return pfnGetApiVersion( hDriver, version );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Driver.pfnGetApiVersion, hDriver, version);
 
         // capture parameters
@@ -180,6 +192,9 @@ namespace tracing_layer
         if( nullptr == pfnGetProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Driver, pfnGetPropertiesCb) )
+            return pfnGetProperties( hDriver, pDriverProperties );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Driver.pfnGetProperties, hDriver, pDriverProperties);
 
         // capture parameters
@@ -215,6 +230,9 @@ namespace tracing_layer
         if( nullptr == pfnGetIpcProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Driver, pfnGetIpcPropertiesCb) )
+            return pfnGetIpcProperties( hDriver, pIpcProperties );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Driver.pfnGetIpcProperties, hDriver, pIpcProperties);
 
         // capture parameters
@@ -259,6 +277,9 @@ namespace tracing_layer
         if( nullptr == pfnGetExtensionProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Driver, pfnGetExtensionPropertiesCb) )
+            return pfnGetExtensionProperties( hDriver, pCount, pExtensionProperties );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Driver.pfnGetExtensionProperties, hDriver, pCount, pExtensionProperties);
 
         // capture parameters
@@ -297,6 +318,9 @@ namespace tracing_layer
         if( nullptr == pfnGetExtensionFunctionAddress)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Driver, pfnGetExtensionFunctionAddressCb) )
+            return pfnGetExtensionFunctionAddress( hDriver, name, ppFunctionAddress );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Driver.pfnGetExtensionFunctionAddress, hDriver, name, ppFunctionAddress);
 
         // capture parameters
@@ -335,6 +359,9 @@ namespace tracing_layer
         if( nullptr == pfnGetLastErrorDescription)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Driver, pfnGetLastErrorDescriptionCb) )
+            return pfnGetLastErrorDescription( hDriver, ppString );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Driver.pfnGetLastErrorDescription, hDriver, ppString);
 
         // capture parameters
@@ -369,6 +396,9 @@ namespace tracing_layer
         if( nullptr == pfnGetDefaultContext)
             return nullptr;
 
+        if( !ZE_API_IS_TRACED(Driver, pfnGetDefaultContextCb) )
+            return pfnGetDefaultContext( hDriver );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Driver.pfnGetDefaultContext, hDriver);
 
         // capture parameters
@@ -409,6 +439,9 @@ namespace tracing_layer
         if( nullptr == pfnGet)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Device, pfnGetCb) )
+            return pfnGet( hDriver, pCount, phDevices );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGet, hDriver, pCount, phDevices);
 
         // capture parameters
@@ -446,6 +479,9 @@ namespace tracing_layer
         if( nullptr == pfnGetRootDevice)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Device, pfnGetRootDeviceCb) )
+            return pfnGetRootDevice( hDevice, phRootDevice );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGetRootDevice, hDevice, phRootDevice);
 
         // capture parameters
@@ -488,6 +524,9 @@ namespace tracing_layer
         if( nullptr == pfnGetSubDevices)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Device, pfnGetSubDevicesCb) )
+            return pfnGetSubDevices( hDevice, pCount, phSubdevices );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGetSubDevices, hDevice, pCount, phSubdevices);
 
         // capture parameters
@@ -525,6 +564,9 @@ namespace tracing_layer
         if( nullptr == pfnGetProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Device, pfnGetPropertiesCb) )
+            return pfnGetProperties( hDevice, pDeviceProperties );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGetProperties, hDevice, pDeviceProperties);
 
         // capture parameters
@@ -560,6 +602,9 @@ namespace tracing_layer
         if( nullptr == pfnGetComputeProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Device, pfnGetComputePropertiesCb) )
+            return pfnGetComputeProperties( hDevice, pComputeProperties );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGetComputeProperties, hDevice, pComputeProperties);
 
         // capture parameters
@@ -595,6 +640,9 @@ namespace tracing_layer
         if( nullptr == pfnGetModuleProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Device, pfnGetModulePropertiesCb) )
+            return pfnGetModuleProperties( hDevice, pModuleProperties );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGetModuleProperties, hDevice, pModuleProperties);
 
         // capture parameters
@@ -644,6 +692,9 @@ namespace tracing_layer
         if( nullptr == pfnGetCommandQueueGroupProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Device, pfnGetCommandQueueGroupPropertiesCb) )
+            return pfnGetCommandQueueGroupProperties( hDevice, pCount, pCommandQueueGroupProperties );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGetCommandQueueGroupProperties, hDevice, pCount, pCommandQueueGroupProperties);
 
         // capture parameters
@@ -690,6 +741,9 @@ namespace tracing_layer
         if( nullptr == pfnGetMemoryProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Device, pfnGetMemoryPropertiesCb) )
+            return pfnGetMemoryProperties( hDevice, pCount, pMemProperties );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGetMemoryProperties, hDevice, pCount, pMemProperties);
 
         // capture parameters
@@ -727,6 +781,9 @@ namespace tracing_layer
         if( nullptr == pfnGetMemoryAccessProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Device, pfnGetMemoryAccessPropertiesCb) )
+            return pfnGetMemoryAccessProperties( hDevice, pMemAccessProperties );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGetMemoryAccessProperties, hDevice, pMemAccessProperties);
 
         // capture parameters
@@ -770,6 +827,9 @@ namespace tracing_layer
         if( nullptr == pfnGetCacheProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Device, pfnGetCachePropertiesCb) )
+            return pfnGetCacheProperties( hDevice, pCount, pCacheProperties );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGetCacheProperties, hDevice, pCount, pCacheProperties);
 
         // capture parameters
@@ -807,6 +867,9 @@ namespace tracing_layer
         if( nullptr == pfnGetImageProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Device, pfnGetImagePropertiesCb) )
+            return pfnGetImageProperties( hDevice, pImageProperties );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGetImageProperties, hDevice, pImageProperties);
 
         // capture parameters
@@ -842,6 +905,9 @@ namespace tracing_layer
         if( nullptr == pfnGetExternalMemoryProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Device, pfnGetExternalMemoryPropertiesCb) )
+            return pfnGetExternalMemoryProperties( hDevice, pExternalMemoryProperties );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGetExternalMemoryProperties, hDevice, pExternalMemoryProperties);
 
         // capture parameters
@@ -878,6 +944,9 @@ namespace tracing_layer
         if( nullptr == pfnGetP2PProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Device, pfnGetP2PPropertiesCb) )
+            return pfnGetP2PProperties( hDevice, hPeerDevice, pP2PProperties );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGetP2PProperties, hDevice, hPeerDevice, pP2PProperties);
 
         // capture parameters
@@ -916,6 +985,9 @@ namespace tracing_layer
         if( nullptr == pfnCanAccessPeer)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Device, pfnCanAccessPeerCb) )
+            return pfnCanAccessPeer( hDevice, hPeerDevice, value );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnCanAccessPeer, hDevice, hPeerDevice, value);
 
         // capture parameters
@@ -952,6 +1024,9 @@ namespace tracing_layer
         if( nullptr == pfnGetStatus)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Device, pfnGetStatusCb) )
+            return pfnGetStatus( hDevice );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGetStatus, hDevice);
 
         // capture parameters
@@ -988,6 +1063,9 @@ namespace tracing_layer
         if( nullptr == pfnGetGlobalTimestamps)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Device, pfnGetGlobalTimestampsCb) )
+            return pfnGetGlobalTimestamps( hDevice, hostTimestamp, deviceTimestamp );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGetGlobalTimestamps, hDevice, hostTimestamp, deviceTimestamp);
 
         // capture parameters
@@ -1024,6 +1102,9 @@ namespace tracing_layer
         if( nullptr == pfnSynchronize)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Device, pfnSynchronizeCb) )
+            return pfnSynchronize( hDevice );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnSynchronize, hDevice);
 
         // capture parameters
@@ -1057,6 +1138,9 @@ namespace tracing_layer
         if( nullptr == pfnGetAggregatedCopyOffloadIncrementValue)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Device, pfnGetAggregatedCopyOffloadIncrementValueCb) )
+            return pfnGetAggregatedCopyOffloadIncrementValue( hDevice, incrementValue );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGetAggregatedCopyOffloadIncrementValue, hDevice, incrementValue);
 
         // capture parameters
@@ -1093,6 +1177,9 @@ namespace tracing_layer
         if( nullptr == pfnCreate)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Context, pfnCreateCb) )
+            return pfnCreate( hDriver, desc, phContext );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Context.pfnCreate, hDriver, desc, phContext);
 
         // capture parameters
@@ -1141,6 +1228,9 @@ namespace tracing_layer
         if( nullptr == pfnCreateEx)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Context, pfnCreateExCb) )
+            return pfnCreateEx( hDriver, desc, numDevices, phDevices, phContext );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Context.pfnCreateEx, hDriver, desc, numDevices, phDevices, phContext);
 
         // capture parameters
@@ -1181,6 +1271,9 @@ namespace tracing_layer
         if( nullptr == pfnDestroy)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Context, pfnDestroyCb) )
+            return pfnDestroy( hContext );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Context.pfnDestroy, hContext);
 
         // capture parameters
@@ -1213,6 +1306,9 @@ namespace tracing_layer
         if( nullptr == pfnGetStatus)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Context, pfnGetStatusCb) )
+            return pfnGetStatus( hContext );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Context.pfnGetStatus, hContext);
 
         // capture parameters
@@ -1248,6 +1344,9 @@ namespace tracing_layer
         if( nullptr == pfnCreate)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(CommandQueue, pfnCreateCb) )
+            return pfnCreate( hContext, hDevice, desc, phCommandQueue );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandQueue.pfnCreate, hContext, hDevice, desc, phCommandQueue);
 
         // capture parameters
@@ -1286,6 +1385,9 @@ namespace tracing_layer
         if( nullptr == pfnDestroy)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(CommandQueue, pfnDestroyCb) )
+            return pfnDestroy( hCommandQueue );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandQueue.pfnDestroy, hCommandQueue);
 
         // capture parameters
@@ -1322,6 +1424,9 @@ namespace tracing_layer
         if( nullptr == pfnExecuteCommandLists)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(CommandQueue, pfnExecuteCommandListsCb) )
+            return pfnExecuteCommandLists( hCommandQueue, numCommandLists, phCommandLists, hFence );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandQueue.pfnExecuteCommandLists, hCommandQueue, numCommandLists, phCommandLists, hFence);
 
         // capture parameters
@@ -1367,6 +1472,9 @@ namespace tracing_layer
         if( nullptr == pfnSynchronize)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(CommandQueue, pfnSynchronizeCb) )
+            return pfnSynchronize( hCommandQueue, timeout );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandQueue.pfnSynchronize, hCommandQueue, timeout);
 
         // capture parameters
@@ -1402,6 +1510,9 @@ namespace tracing_layer
         if( nullptr == pfnGetOrdinal)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(CommandQueue, pfnGetOrdinalCb) )
+            return pfnGetOrdinal( hCommandQueue, pOrdinal );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandQueue.pfnGetOrdinal, hCommandQueue, pOrdinal);
 
         // capture parameters
@@ -1437,6 +1548,9 @@ namespace tracing_layer
         if( nullptr == pfnGetIndex)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(CommandQueue, pfnGetIndexCb) )
+            return pfnGetIndex( hCommandQueue, pIndex );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandQueue.pfnGetIndex, hCommandQueue, pIndex);
 
         // capture parameters
@@ -1474,6 +1588,9 @@ namespace tracing_layer
         if( nullptr == pfnCreate)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(CommandList, pfnCreateCb) )
+            return pfnCreate( hContext, hDevice, desc, phCommandList );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnCreate, hContext, hDevice, desc, phCommandList);
 
         // capture parameters
@@ -1515,6 +1632,9 @@ namespace tracing_layer
         if( nullptr == pfnCreateImmediate)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(CommandList, pfnCreateImmediateCb) )
+            return pfnCreateImmediate( hContext, hDevice, altdesc, phCommandList );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnCreateImmediate, hContext, hDevice, altdesc, phCommandList);
 
         // capture parameters
@@ -1553,6 +1673,9 @@ namespace tracing_layer
         if( nullptr == pfnDestroy)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(CommandList, pfnDestroyCb) )
+            return pfnDestroy( hCommandList );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnDestroy, hCommandList);
 
         // capture parameters
@@ -1585,6 +1708,9 @@ namespace tracing_layer
         if( nullptr == pfnClose)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(CommandList, pfnCloseCb) )
+            return pfnClose( hCommandList );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnClose, hCommandList);
 
         // capture parameters
@@ -1617,6 +1743,9 @@ namespace tracing_layer
         if( nullptr == pfnReset)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(CommandList, pfnResetCb) )
+            return pfnReset( hCommandList );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnReset, hCommandList);
 
         // capture parameters
@@ -1656,6 +1785,9 @@ namespace tracing_layer
         if( nullptr == pfnAppendWriteGlobalTimestamp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(CommandList, pfnAppendWriteGlobalTimestampCb) )
+            return pfnAppendWriteGlobalTimestamp( hCommandList, dstptr, hSignalEvent, numWaitEvents, phWaitEvents );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendWriteGlobalTimestamp, hCommandList, dstptr, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -1703,6 +1835,9 @@ namespace tracing_layer
         if( nullptr == pfnHostSynchronize)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(CommandList, pfnHostSynchronizeCb) )
+            return pfnHostSynchronize( hCommandList, timeout );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnHostSynchronize, hCommandList, timeout);
 
         // capture parameters
@@ -1738,6 +1873,9 @@ namespace tracing_layer
         if( nullptr == pfnGetDeviceHandle)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(CommandList, pfnGetDeviceHandleCb) )
+            return pfnGetDeviceHandle( hCommandList, phDevice );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnGetDeviceHandle, hCommandList, phDevice);
 
         // capture parameters
@@ -1773,6 +1911,9 @@ namespace tracing_layer
         if( nullptr == pfnGetContextHandle)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(CommandList, pfnGetContextHandleCb) )
+            return pfnGetContextHandle( hCommandList, phContext );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnGetContextHandle, hCommandList, phContext);
 
         // capture parameters
@@ -1808,6 +1949,9 @@ namespace tracing_layer
         if( nullptr == pfnGetOrdinal)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(CommandList, pfnGetOrdinalCb) )
+            return pfnGetOrdinal( hCommandList, pOrdinal );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnGetOrdinal, hCommandList, pOrdinal);
 
         // capture parameters
@@ -1844,6 +1988,9 @@ namespace tracing_layer
         if( nullptr == pfnImmediateGetIndex)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(CommandList, pfnImmediateGetIndexCb) )
+            return pfnImmediateGetIndex( hCommandListImmediate, pIndex );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnImmediateGetIndex, hCommandListImmediate, pIndex);
 
         // capture parameters
@@ -1880,6 +2027,9 @@ namespace tracing_layer
         if( nullptr == pfnIsImmediate)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(CommandList, pfnIsImmediateCb) )
+            return pfnIsImmediate( hCommandList, pIsImmediate );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnIsImmediate, hCommandList, pIsImmediate);
 
         // capture parameters
@@ -1919,6 +2069,9 @@ namespace tracing_layer
         if( nullptr == pfnAppendBarrier)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(CommandList, pfnAppendBarrierCb) )
+            return pfnAppendBarrier( hCommandList, hSignalEvent, numWaitEvents, phWaitEvents );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendBarrier, hCommandList, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -1965,6 +2118,9 @@ namespace tracing_layer
         if( nullptr == pfnAppendMemoryRangesBarrier)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(CommandList, pfnAppendMemoryRangesBarrierCb) )
+            return pfnAppendMemoryRangesBarrier( hCommandList, numRanges, pRangeSizes, pRanges, hSignalEvent, numWaitEvents, phWaitEvents );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendMemoryRangesBarrier, hCommandList, numRanges, pRangeSizes, pRanges, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -2010,6 +2166,9 @@ namespace tracing_layer
         if( nullptr == pfnSystemBarrier)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Context, pfnSystemBarrierCb) )
+            return pfnSystemBarrier( hContext, hDevice );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Context.pfnSystemBarrier, hContext, hDevice);
 
         // capture parameters
@@ -2052,6 +2211,9 @@ namespace tracing_layer
         if( nullptr == pfnAppendMemoryCopy)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(CommandList, pfnAppendMemoryCopyCb) )
+            return pfnAppendMemoryCopy( hCommandList, dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendMemoryCopy, hCommandList, dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -2105,6 +2267,9 @@ namespace tracing_layer
         if( nullptr == pfnAppendMemoryFill)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(CommandList, pfnAppendMemoryFillCb) )
+            return pfnAppendMemoryFill( hCommandList, ptr, pattern, pattern_size, size, hSignalEvent, numWaitEvents, phWaitEvents );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendMemoryFill, hCommandList, ptr, pattern, pattern_size, size, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -2168,6 +2333,9 @@ namespace tracing_layer
         if( nullptr == pfnAppendMemoryCopyRegion)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(CommandList, pfnAppendMemoryCopyRegionCb) )
+            return pfnAppendMemoryCopyRegion( hCommandList, dstptr, dstRegion, dstPitch, dstSlicePitch, srcptr, srcRegion, srcPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendMemoryCopyRegion, hCommandList, dstptr, dstRegion, dstPitch, dstSlicePitch, srcptr, srcRegion, srcPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -2231,6 +2399,9 @@ namespace tracing_layer
         if( nullptr == pfnAppendMemoryCopyFromContext)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(CommandList, pfnAppendMemoryCopyFromContextCb) )
+            return pfnAppendMemoryCopyFromContext( hCommandList, dstptr, hContextSrc, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendMemoryCopyFromContext, hCommandList, dstptr, hContextSrc, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -2284,6 +2455,9 @@ namespace tracing_layer
         if( nullptr == pfnAppendImageCopy)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(CommandList, pfnAppendImageCopyCb) )
+            return pfnAppendImageCopy( hCommandList, hDstImage, hSrcImage, hSignalEvent, numWaitEvents, phWaitEvents );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendImageCopy, hCommandList, hDstImage, hSrcImage, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -2335,6 +2509,9 @@ namespace tracing_layer
         if( nullptr == pfnAppendImageCopyRegion)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(CommandList, pfnAppendImageCopyRegionCb) )
+            return pfnAppendImageCopyRegion( hCommandList, hDstImage, hSrcImage, pDstRegion, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendImageCopyRegion, hCommandList, hDstImage, hSrcImage, pDstRegion, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -2389,6 +2566,9 @@ namespace tracing_layer
         if( nullptr == pfnAppendImageCopyToMemory)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(CommandList, pfnAppendImageCopyToMemoryCb) )
+            return pfnAppendImageCopyToMemory( hCommandList, dstptr, hSrcImage, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendImageCopyToMemory, hCommandList, dstptr, hSrcImage, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -2441,6 +2621,9 @@ namespace tracing_layer
         if( nullptr == pfnAppendImageCopyFromMemory)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(CommandList, pfnAppendImageCopyFromMemoryCb) )
+            return pfnAppendImageCopyFromMemory( hCommandList, hDstImage, srcptr, pDstRegion, hSignalEvent, numWaitEvents, phWaitEvents );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendImageCopyFromMemory, hCommandList, hDstImage, srcptr, pDstRegion, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -2487,6 +2670,9 @@ namespace tracing_layer
         if( nullptr == pfnAppendMemoryPrefetch)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(CommandList, pfnAppendMemoryPrefetchCb) )
+            return pfnAppendMemoryPrefetch( hCommandList, ptr, size );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendMemoryPrefetch, hCommandList, ptr, size);
 
         // capture parameters
@@ -2527,6 +2713,9 @@ namespace tracing_layer
         if( nullptr == pfnAppendMemAdvise)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(CommandList, pfnAppendMemAdviseCb) )
+            return pfnAppendMemAdvise( hCommandList, hDevice, ptr, size, advice );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendMemAdvise, hCommandList, hDevice, ptr, size, advice);
 
         // capture parameters
@@ -2575,6 +2764,9 @@ namespace tracing_layer
         if( nullptr == pfnCreate)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(EventPool, pfnCreateCb) )
+            return pfnCreate( hContext, desc, numDevices, phDevices, phEventPool );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.EventPool.pfnCreate, hContext, desc, numDevices, phDevices, phEventPool);
 
         // capture parameters
@@ -2615,6 +2807,9 @@ namespace tracing_layer
         if( nullptr == pfnDestroy)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(EventPool, pfnDestroyCb) )
+            return pfnDestroy( hEventPool );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.EventPool.pfnDestroy, hEventPool);
 
         // capture parameters
@@ -2649,6 +2844,9 @@ namespace tracing_layer
         if( nullptr == pfnCreate)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Event, pfnCreateCb) )
+            return pfnCreate( hEventPool, desc, phEvent );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Event.pfnCreate, hEventPool, desc, phEvent);
 
         // capture parameters
@@ -2688,6 +2886,9 @@ namespace tracing_layer
         if( nullptr == pfnCounterBasedCreate)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Event, pfnCounterBasedCreateCb) )
+            return pfnCounterBasedCreate( hContext, hDevice, desc, phEvent );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Event.pfnCounterBasedCreate, hContext, hDevice, desc, phEvent);
 
         // capture parameters
@@ -2726,6 +2927,9 @@ namespace tracing_layer
         if( nullptr == pfnDestroy)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Event, pfnDestroyCb) )
+            return pfnDestroy( hEvent );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Event.pfnDestroy, hEvent);
 
         // capture parameters
@@ -2759,6 +2963,9 @@ namespace tracing_layer
         if( nullptr == pfnGetIpcHandle)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(EventPool, pfnGetIpcHandleCb) )
+            return pfnGetIpcHandle( hEventPool, phIpc );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.EventPool.pfnGetIpcHandle, hEventPool, phIpc);
 
         // capture parameters
@@ -2795,6 +3002,9 @@ namespace tracing_layer
         if( nullptr == pfnPutIpcHandle)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(EventPool, pfnPutIpcHandleCb) )
+            return pfnPutIpcHandle( hContext, hIpc );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.EventPool.pfnPutIpcHandle, hContext, hIpc);
 
         // capture parameters
@@ -2832,6 +3042,9 @@ namespace tracing_layer
         if( nullptr == pfnOpenIpcHandle)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(EventPool, pfnOpenIpcHandleCb) )
+            return pfnOpenIpcHandle( hContext, hIpc, phEventPool );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.EventPool.pfnOpenIpcHandle, hContext, hIpc, phEventPool);
 
         // capture parameters
@@ -2868,6 +3081,9 @@ namespace tracing_layer
         if( nullptr == pfnCloseIpcHandle)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(EventPool, pfnCloseIpcHandleCb) )
+            return pfnCloseIpcHandle( hEventPool );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.EventPool.pfnCloseIpcHandle, hEventPool);
 
         // capture parameters
@@ -2901,6 +3117,9 @@ namespace tracing_layer
         if( nullptr == pfnCounterBasedGetIpcHandle)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Event, pfnCounterBasedGetIpcHandleCb) )
+            return pfnCounterBasedGetIpcHandle( hEvent, phIpc );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Event.pfnCounterBasedGetIpcHandle, hEvent, phIpc);
 
         // capture parameters
@@ -2938,6 +3157,9 @@ namespace tracing_layer
         if( nullptr == pfnCounterBasedOpenIpcHandle)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Event, pfnCounterBasedOpenIpcHandleCb) )
+            return pfnCounterBasedOpenIpcHandle( hContext, hIpc, phEvent );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Event.pfnCounterBasedOpenIpcHandle, hContext, hIpc, phEvent);
 
         // capture parameters
@@ -2974,6 +3196,9 @@ namespace tracing_layer
         if( nullptr == pfnCounterBasedCloseIpcHandle)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Event, pfnCounterBasedCloseIpcHandleCb) )
+            return pfnCounterBasedCloseIpcHandle( hEvent );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Event.pfnCounterBasedCloseIpcHandle, hEvent);
 
         // capture parameters
@@ -3008,6 +3233,9 @@ namespace tracing_layer
         if( nullptr == pfnCounterBasedGetDeviceAddress)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Event, pfnCounterBasedGetDeviceAddressCb) )
+            return pfnCounterBasedGetDeviceAddress( hEvent, completionValue, deviceAddress );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Event.pfnCounterBasedGetDeviceAddress, hEvent, completionValue, deviceAddress);
 
         // capture parameters
@@ -3045,6 +3273,9 @@ namespace tracing_layer
         if( nullptr == pfnAppendSignalEvent)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(CommandList, pfnAppendSignalEventCb) )
+            return pfnAppendSignalEvent( hCommandList, hEvent );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendSignalEvent, hCommandList, hEvent);
 
         // capture parameters
@@ -3082,6 +3313,9 @@ namespace tracing_layer
         if( nullptr == pfnAppendWaitOnEvents)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(CommandList, pfnAppendWaitOnEventsCb) )
+            return pfnAppendWaitOnEvents( hCommandList, numEvents, phEvents );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendWaitOnEvents, hCommandList, numEvents, phEvents);
 
         // capture parameters
@@ -3118,6 +3352,9 @@ namespace tracing_layer
         if( nullptr == pfnHostSignal)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Event, pfnHostSignalCb) )
+            return pfnHostSignal( hEvent );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Event.pfnHostSignal, hEvent);
 
         // capture parameters
@@ -3157,6 +3394,9 @@ namespace tracing_layer
         if( nullptr == pfnHostSynchronize)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Event, pfnHostSynchronizeCb) )
+            return pfnHostSynchronize( hEvent, timeout );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Event.pfnHostSynchronize, hEvent, timeout);
 
         // capture parameters
@@ -3191,6 +3431,9 @@ namespace tracing_layer
         if( nullptr == pfnQueryStatus)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Event, pfnQueryStatusCb) )
+            return pfnQueryStatus( hEvent );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Event.pfnQueryStatus, hEvent);
 
         // capture parameters
@@ -3224,6 +3467,9 @@ namespace tracing_layer
         if( nullptr == pfnAppendEventReset)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(CommandList, pfnAppendEventResetCb) )
+            return pfnAppendEventReset( hCommandList, hEvent );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendEventReset, hCommandList, hEvent);
 
         // capture parameters
@@ -3258,6 +3504,9 @@ namespace tracing_layer
         if( nullptr == pfnHostReset)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Event, pfnHostResetCb) )
+            return pfnHostReset( hEvent );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Event.pfnHostReset, hEvent);
 
         // capture parameters
@@ -3291,6 +3540,9 @@ namespace tracing_layer
         if( nullptr == pfnQueryKernelTimestamp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Event, pfnQueryKernelTimestampCb) )
+            return pfnQueryKernelTimestamp( hEvent, dstptr );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Event.pfnQueryKernelTimestamp, hEvent, dstptr);
 
         // capture parameters
@@ -3337,6 +3589,9 @@ namespace tracing_layer
         if( nullptr == pfnAppendQueryKernelTimestamps)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(CommandList, pfnAppendQueryKernelTimestampsCb) )
+            return pfnAppendQueryKernelTimestamps( hCommandList, numEvents, phEvents, dstptr, pOffsets, hSignalEvent, numWaitEvents, phWaitEvents );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendQueryKernelTimestamps, hCommandList, numEvents, phEvents, dstptr, pOffsets, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -3384,6 +3639,9 @@ namespace tracing_layer
         if( nullptr == pfnGetEventPool)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Event, pfnGetEventPoolCb) )
+            return pfnGetEventPool( hEvent, phEventPool );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Event.pfnGetEventPool, hEvent, phEventPool);
 
         // capture parameters
@@ -3421,6 +3679,9 @@ namespace tracing_layer
         if( nullptr == pfnGetSignalScope)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Event, pfnGetSignalScopeCb) )
+            return pfnGetSignalScope( hEvent, pSignalScope );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Event.pfnGetSignalScope, hEvent, pSignalScope);
 
         // capture parameters
@@ -3458,6 +3719,9 @@ namespace tracing_layer
         if( nullptr == pfnGetWaitScope)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Event, pfnGetWaitScopeCb) )
+            return pfnGetWaitScope( hEvent, pWaitScope );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Event.pfnGetWaitScope, hEvent, pWaitScope);
 
         // capture parameters
@@ -3493,6 +3757,9 @@ namespace tracing_layer
         if( nullptr == pfnGetContextHandle)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(EventPool, pfnGetContextHandleCb) )
+            return pfnGetContextHandle( hEventPool, phContext );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.EventPool.pfnGetContextHandle, hEventPool, phContext);
 
         // capture parameters
@@ -3529,6 +3796,9 @@ namespace tracing_layer
         if( nullptr == pfnGetFlags)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(EventPool, pfnGetFlagsCb) )
+            return pfnGetFlags( hEventPool, pFlags );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.EventPool.pfnGetFlags, hEventPool, pFlags);
 
         // capture parameters
@@ -3565,6 +3835,9 @@ namespace tracing_layer
         if( nullptr == pfnCreate)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Fence, pfnCreateCb) )
+            return pfnCreate( hCommandQueue, desc, phFence );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Fence.pfnCreate, hCommandQueue, desc, phFence);
 
         // capture parameters
@@ -3601,6 +3874,9 @@ namespace tracing_layer
         if( nullptr == pfnDestroy)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Fence, pfnDestroyCb) )
+            return pfnDestroy( hFence );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Fence.pfnDestroy, hFence);
 
         // capture parameters
@@ -3640,6 +3916,9 @@ namespace tracing_layer
         if( nullptr == pfnHostSynchronize)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Fence, pfnHostSynchronizeCb) )
+            return pfnHostSynchronize( hFence, timeout );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Fence.pfnHostSynchronize, hFence, timeout);
 
         // capture parameters
@@ -3674,6 +3953,9 @@ namespace tracing_layer
         if( nullptr == pfnQueryStatus)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Fence, pfnQueryStatusCb) )
+            return pfnQueryStatus( hFence );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Fence.pfnQueryStatus, hFence);
 
         // capture parameters
@@ -3706,6 +3988,9 @@ namespace tracing_layer
         if( nullptr == pfnReset)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Fence, pfnResetCb) )
+            return pfnReset( hFence );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Fence.pfnReset, hFence);
 
         // capture parameters
@@ -3740,6 +4025,9 @@ namespace tracing_layer
         if( nullptr == pfnGetProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Image, pfnGetPropertiesCb) )
+            return pfnGetProperties( hDevice, desc, pImageProperties );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Image.pfnGetProperties, hDevice, desc, pImageProperties);
 
         // capture parameters
@@ -3779,6 +4067,9 @@ namespace tracing_layer
         if( nullptr == pfnCreate)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Image, pfnCreateCb) )
+            return pfnCreate( hContext, hDevice, desc, phImage );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Image.pfnCreate, hContext, hDevice, desc, phImage);
 
         // capture parameters
@@ -3817,6 +4108,9 @@ namespace tracing_layer
         if( nullptr == pfnDestroy)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Image, pfnDestroyCb) )
+            return pfnDestroy( hImage );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Image.pfnDestroy, hImage);
 
         // capture parameters
@@ -3857,6 +4151,9 @@ namespace tracing_layer
         if( nullptr == pfnAllocShared)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Mem, pfnAllocSharedCb) )
+            return pfnAllocShared( hContext, device_desc, host_desc, size, alignment, hDevice, pptr );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Mem.pfnAllocShared, hContext, device_desc, host_desc, size, alignment, hDevice, pptr);
 
         // capture parameters
@@ -3908,6 +4205,9 @@ namespace tracing_layer
         if( nullptr == pfnAllocDevice)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Mem, pfnAllocDeviceCb) )
+            return pfnAllocDevice( hContext, device_desc, size, alignment, hDevice, pptr );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Mem.pfnAllocDevice, hContext, device_desc, size, alignment, hDevice, pptr);
 
         // capture parameters
@@ -3956,6 +4256,9 @@ namespace tracing_layer
         if( nullptr == pfnAllocHost)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Mem, pfnAllocHostCb) )
+            return pfnAllocHost( hContext, host_desc, size, alignment, pptr );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Mem.pfnAllocHost, hContext, host_desc, size, alignment, pptr);
 
         // capture parameters
@@ -3997,6 +4300,9 @@ namespace tracing_layer
         if( nullptr == pfnFree)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Mem, pfnFreeCb) )
+            return pfnFree( hContext, ptr );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Mem.pfnFree, hContext, ptr);
 
         // capture parameters
@@ -4034,6 +4340,9 @@ namespace tracing_layer
         if( nullptr == pfnGetAllocProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Mem, pfnGetAllocPropertiesCb) )
+            return pfnGetAllocProperties( hContext, ptr, pMemAllocProperties, phDevice );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Mem.pfnGetAllocProperties, hContext, ptr, pMemAllocProperties, phDevice);
 
         // capture parameters
@@ -4075,6 +4384,9 @@ namespace tracing_layer
         if( nullptr == pfnGetAddressRange)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Mem, pfnGetAddressRangeCb) )
+            return pfnGetAddressRange( hContext, ptr, pBase, pSize );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Mem.pfnGetAddressRange, hContext, ptr, pBase, pSize);
 
         // capture parameters
@@ -4115,6 +4427,9 @@ namespace tracing_layer
         if( nullptr == pfnGetIpcHandle)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Mem, pfnGetIpcHandleCb) )
+            return pfnGetIpcHandle( hContext, ptr, pIpcHandle );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Mem.pfnGetIpcHandle, hContext, ptr, pIpcHandle);
 
         // capture parameters
@@ -4153,6 +4468,9 @@ namespace tracing_layer
         if( nullptr == pfnGetIpcHandleFromFileDescriptorExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Mem, pfnGetIpcHandleFromFileDescriptorExpCb) )
+            return pfnGetIpcHandleFromFileDescriptorExp( hContext, handle, pIpcHandle );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.MemExp.pfnGetIpcHandleFromFileDescriptorExp, hContext, handle, pIpcHandle);
 
         // capture parameters
@@ -4191,6 +4509,9 @@ namespace tracing_layer
         if( nullptr == pfnGetFileDescriptorFromIpcHandleExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Mem, pfnGetFileDescriptorFromIpcHandleExpCb) )
+            return pfnGetFileDescriptorFromIpcHandleExp( hContext, ipcHandle, pHandle );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.MemExp.pfnGetFileDescriptorFromIpcHandleExp, hContext, ipcHandle, pHandle);
 
         // capture parameters
@@ -4228,6 +4549,9 @@ namespace tracing_layer
         if( nullptr == pfnPutIpcHandle)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Mem, pfnPutIpcHandleCb) )
+            return pfnPutIpcHandle( hContext, handle );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Mem.pfnPutIpcHandle, hContext, handle);
 
         // capture parameters
@@ -4267,6 +4591,9 @@ namespace tracing_layer
         if( nullptr == pfnOpenIpcHandle)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Mem, pfnOpenIpcHandleCb) )
+            return pfnOpenIpcHandle( hContext, hDevice, handle, flags, pptr );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Mem.pfnOpenIpcHandle, hContext, hDevice, handle, flags, pptr);
 
         // capture parameters
@@ -4308,6 +4635,9 @@ namespace tracing_layer
         if( nullptr == pfnCloseIpcHandle)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Mem, pfnCloseIpcHandleCb) )
+            return pfnCloseIpcHandle( hContext, ptr );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Mem.pfnCloseIpcHandle, hContext, ptr);
 
         // capture parameters
@@ -4347,6 +4677,9 @@ namespace tracing_layer
         if( nullptr == pfnSetAtomicAccessAttributeExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Mem, pfnSetAtomicAccessAttributeExpCb) )
+            return pfnSetAtomicAccessAttributeExp( hContext, hDevice, ptr, size, attr );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.MemExp.pfnSetAtomicAccessAttributeExp, hContext, hDevice, ptr, size, attr);
 
         // capture parameters
@@ -4391,6 +4724,9 @@ namespace tracing_layer
         if( nullptr == pfnGetAtomicAccessAttributeExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Mem, pfnGetAtomicAccessAttributeExpCb) )
+            return pfnGetAtomicAccessAttributeExp( hContext, hDevice, ptr, size, pAttr );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.MemExp.pfnGetAtomicAccessAttributeExp, hContext, hDevice, ptr, size, pAttr);
 
         // capture parameters
@@ -4435,6 +4771,9 @@ namespace tracing_layer
         if( nullptr == pfnCreate)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Module, pfnCreateCb) )
+            return pfnCreate( hContext, hDevice, desc, phModule, phBuildLog );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Module.pfnCreate, hContext, hDevice, desc, phModule, phBuildLog);
 
         // capture parameters
@@ -4475,6 +4814,9 @@ namespace tracing_layer
         if( nullptr == pfnDestroy)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Module, pfnDestroyCb) )
+            return pfnDestroy( hModule );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Module.pfnDestroy, hModule);
 
         // capture parameters
@@ -4510,6 +4852,9 @@ namespace tracing_layer
         if( nullptr == pfnDynamicLink)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Module, pfnDynamicLinkCb) )
+            return pfnDynamicLink( numModules, phModules, phLinkLog );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Module.pfnDynamicLink, numModules, phModules, phLinkLog);
 
         // capture parameters
@@ -4546,6 +4891,9 @@ namespace tracing_layer
         if( nullptr == pfnDestroy)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(ModuleBuildLog, pfnDestroyCb) )
+            return pfnDestroy( hModuleBuildLog );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.ModuleBuildLog.pfnDestroy, hModuleBuildLog);
 
         // capture parameters
@@ -4580,6 +4928,9 @@ namespace tracing_layer
         if( nullptr == pfnGetString)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(ModuleBuildLog, pfnGetStringCb) )
+            return pfnGetString( hModuleBuildLog, pSize, pBuildLog );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.ModuleBuildLog.pfnGetString, hModuleBuildLog, pSize, pBuildLog);
 
         // capture parameters
@@ -4618,6 +4969,9 @@ namespace tracing_layer
         if( nullptr == pfnGetNativeBinary)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Module, pfnGetNativeBinaryCb) )
+            return pfnGetNativeBinary( hModule, pSize, pModuleNativeBinary );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Module.pfnGetNativeBinary, hModule, pSize, pModuleNativeBinary);
 
         // capture parameters
@@ -4657,6 +5011,9 @@ namespace tracing_layer
         if( nullptr == pfnGetGlobalPointer)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Module, pfnGetGlobalPointerCb) )
+            return pfnGetGlobalPointer( hModule, pGlobalName, pSize, pptr );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Module.pfnGetGlobalPointer, hModule, pGlobalName, pSize, pptr);
 
         // capture parameters
@@ -4703,6 +5060,9 @@ namespace tracing_layer
         if( nullptr == pfnGetKernelNames)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Module, pfnGetKernelNamesCb) )
+            return pfnGetKernelNames( hModule, pCount, pNames );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Module.pfnGetKernelNames, hModule, pCount, pNames);
 
         // capture parameters
@@ -4740,6 +5100,9 @@ namespace tracing_layer
         if( nullptr == pfnGetProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Module, pfnGetPropertiesCb) )
+            return pfnGetProperties( hModule, pModuleProperties );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Module.pfnGetProperties, hModule, pModuleProperties);
 
         // capture parameters
@@ -4776,6 +5139,9 @@ namespace tracing_layer
         if( nullptr == pfnCreate)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Kernel, pfnCreateCb) )
+            return pfnCreate( hModule, desc, phKernel );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Kernel.pfnCreate, hModule, desc, phKernel);
 
         // capture parameters
@@ -4812,6 +5178,9 @@ namespace tracing_layer
         if( nullptr == pfnDestroy)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Kernel, pfnDestroyCb) )
+            return pfnDestroy( hKernel );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Kernel.pfnDestroy, hKernel);
 
         // capture parameters
@@ -4846,6 +5215,9 @@ namespace tracing_layer
         if( nullptr == pfnGetFunctionPointer)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Module, pfnGetFunctionPointerCb) )
+            return pfnGetFunctionPointer( hModule, pFunctionName, pfnFunction );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Module.pfnGetFunctionPointer, hModule, pFunctionName, pfnFunction);
 
         // capture parameters
@@ -4885,6 +5257,9 @@ namespace tracing_layer
         if( nullptr == pfnSetGroupSize)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Kernel, pfnSetGroupSizeCb) )
+            return pfnSetGroupSize( hKernel, groupSizeX, groupSizeY, groupSizeZ );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Kernel.pfnSetGroupSize, hKernel, groupSizeX, groupSizeY, groupSizeZ);
 
         // capture parameters
@@ -4929,6 +5304,9 @@ namespace tracing_layer
         if( nullptr == pfnSuggestGroupSize)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Kernel, pfnSuggestGroupSizeCb) )
+            return pfnSuggestGroupSize( hKernel, globalSizeX, globalSizeY, globalSizeZ, groupSizeX, groupSizeY, groupSizeZ );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Kernel.pfnSuggestGroupSize, hKernel, globalSizeX, globalSizeY, globalSizeZ, groupSizeX, groupSizeY, groupSizeZ);
 
         // capture parameters
@@ -4974,6 +5352,9 @@ namespace tracing_layer
         if( nullptr == pfnSuggestMaxCooperativeGroupCount)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Kernel, pfnSuggestMaxCooperativeGroupCountCb) )
+            return pfnSuggestMaxCooperativeGroupCount( hKernel, totalGroupCount );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Kernel.pfnSuggestMaxCooperativeGroupCount, hKernel, totalGroupCount);
 
         // capture parameters
@@ -5012,6 +5393,9 @@ namespace tracing_layer
         if( nullptr == pfnSetArgumentValue)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Kernel, pfnSetArgumentValueCb) )
+            return pfnSetArgumentValue( hKernel, argIndex, argSize, pArgValue );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Kernel.pfnSetArgumentValue, hKernel, argIndex, argSize, pArgValue);
 
         // capture parameters
@@ -5051,6 +5435,9 @@ namespace tracing_layer
         if( nullptr == pfnSetIndirectAccess)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Kernel, pfnSetIndirectAccessCb) )
+            return pfnSetIndirectAccess( hKernel, flags );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Kernel.pfnSetIndirectAccess, hKernel, flags);
 
         // capture parameters
@@ -5086,6 +5473,9 @@ namespace tracing_layer
         if( nullptr == pfnGetIndirectAccess)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Kernel, pfnGetIndirectAccessCb) )
+            return pfnGetIndirectAccess( hKernel, pFlags );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Kernel.pfnGetIndirectAccess, hKernel, pFlags);
 
         // capture parameters
@@ -5133,6 +5523,9 @@ namespace tracing_layer
         if( nullptr == pfnGetSourceAttributes)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Kernel, pfnGetSourceAttributesCb) )
+            return pfnGetSourceAttributes( hKernel, pSize, pString );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Kernel.pfnGetSourceAttributes, hKernel, pSize, pString);
 
         // capture parameters
@@ -5171,6 +5564,9 @@ namespace tracing_layer
         if( nullptr == pfnSetCacheConfig)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Kernel, pfnSetCacheConfigCb) )
+            return pfnSetCacheConfig( hKernel, flags );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Kernel.pfnSetCacheConfig, hKernel, flags);
 
         // capture parameters
@@ -5206,6 +5602,9 @@ namespace tracing_layer
         if( nullptr == pfnGetProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Kernel, pfnGetPropertiesCb) )
+            return pfnGetProperties( hKernel, pKernelProperties );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Kernel.pfnGetProperties, hKernel, pKernelProperties);
 
         // capture parameters
@@ -5243,6 +5642,9 @@ namespace tracing_layer
         if( nullptr == pfnGetName)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Kernel, pfnGetNameCb) )
+            return pfnGetName( hKernel, pSize, pName );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Kernel.pfnGetName, hKernel, pSize, pName);
 
         // capture parameters
@@ -5286,6 +5688,9 @@ namespace tracing_layer
         if( nullptr == pfnAppendLaunchKernel)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(CommandList, pfnAppendLaunchKernelCb) )
+            return pfnAppendLaunchKernel( hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendLaunchKernel, hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -5336,6 +5741,9 @@ namespace tracing_layer
         if( nullptr == pfnAppendLaunchKernelWithParameters)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(CommandList, pfnAppendLaunchKernelWithParametersCb) )
+            return pfnAppendLaunchKernelWithParameters( hCommandList, hKernel, pGroupCounts, pNext, hSignalEvent, numWaitEvents, phWaitEvents );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendLaunchKernelWithParameters, hCommandList, hKernel, pGroupCounts, pNext, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -5390,6 +5798,9 @@ namespace tracing_layer
         if( nullptr == pfnAppendLaunchKernelWithArguments)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(CommandList, pfnAppendLaunchKernelWithArgumentsCb) )
+            return pfnAppendLaunchKernelWithArguments( hCommandList, hKernel, groupCounts, groupSizes, pArguments, pNext, hSignalEvent, numWaitEvents, phWaitEvents );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendLaunchKernelWithArguments, hCommandList, hKernel, groupCounts, groupSizes, pArguments, pNext, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -5445,6 +5856,9 @@ namespace tracing_layer
         if( nullptr == pfnAppendLaunchCooperativeKernel)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(CommandList, pfnAppendLaunchCooperativeKernelCb) )
+            return pfnAppendLaunchCooperativeKernel( hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendLaunchCooperativeKernel, hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -5495,6 +5909,9 @@ namespace tracing_layer
         if( nullptr == pfnAppendLaunchKernelIndirect)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(CommandList, pfnAppendLaunchKernelIndirectCb) )
+            return pfnAppendLaunchKernelIndirect( hCommandList, hKernel, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendLaunchKernelIndirect, hCommandList, hKernel, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -5549,6 +5966,9 @@ namespace tracing_layer
         if( nullptr == pfnAppendLaunchMultipleKernelsIndirect)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(CommandList, pfnAppendLaunchMultipleKernelsIndirectCb) )
+            return pfnAppendLaunchMultipleKernelsIndirect( hCommandList, numKernels, phKernels, pCountBuffer, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendLaunchMultipleKernelsIndirect, hCommandList, numKernels, phKernels, pCountBuffer, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -5598,6 +6018,9 @@ namespace tracing_layer
         if( nullptr == pfnMakeMemoryResident)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Context, pfnMakeMemoryResidentCb) )
+            return pfnMakeMemoryResident( hContext, hDevice, ptr, size );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Context.pfnMakeMemoryResident, hContext, hDevice, ptr, size);
 
         // capture parameters
@@ -5639,6 +6062,9 @@ namespace tracing_layer
         if( nullptr == pfnEvictMemory)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Context, pfnEvictMemoryCb) )
+            return pfnEvictMemory( hContext, hDevice, ptr, size );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Context.pfnEvictMemory, hContext, hDevice, ptr, size);
 
         // capture parameters
@@ -5679,6 +6105,9 @@ namespace tracing_layer
         if( nullptr == pfnMakeImageResident)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Context, pfnMakeImageResidentCb) )
+            return pfnMakeImageResident( hContext, hDevice, hImage );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Context.pfnMakeImageResident, hContext, hDevice, hImage);
 
         // capture parameters
@@ -5717,6 +6146,9 @@ namespace tracing_layer
         if( nullptr == pfnEvictImage)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Context, pfnEvictImageCb) )
+            return pfnEvictImage( hContext, hDevice, hImage );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Context.pfnEvictImage, hContext, hDevice, hImage);
 
         // capture parameters
@@ -5756,6 +6188,9 @@ namespace tracing_layer
         if( nullptr == pfnCreate)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Sampler, pfnCreateCb) )
+            return pfnCreate( hContext, hDevice, desc, phSampler );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Sampler.pfnCreate, hContext, hDevice, desc, phSampler);
 
         // capture parameters
@@ -5794,6 +6229,9 @@ namespace tracing_layer
         if( nullptr == pfnDestroy)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Sampler, pfnDestroyCb) )
+            return pfnDestroy( hSampler );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Sampler.pfnDestroy, hSampler);
 
         // capture parameters
@@ -5830,6 +6268,9 @@ namespace tracing_layer
         if( nullptr == pfnReserve)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(VirtualMem, pfnReserveCb) )
+            return pfnReserve( hContext, pStart, size, pptr );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.VirtualMem.pfnReserve, hContext, pStart, size, pptr);
 
         // capture parameters
@@ -5870,6 +6311,9 @@ namespace tracing_layer
         if( nullptr == pfnFree)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(VirtualMem, pfnFreeCb) )
+            return pfnFree( hContext, ptr, size );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.VirtualMem.pfnFree, hContext, ptr, size);
 
         // capture parameters
@@ -5910,6 +6354,9 @@ namespace tracing_layer
         if( nullptr == pfnQueryPageSize)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(VirtualMem, pfnQueryPageSizeCb) )
+            return pfnQueryPageSize( hContext, hDevice, size, pagesize );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.VirtualMem.pfnQueryPageSize, hContext, hDevice, size, pagesize);
 
         // capture parameters
@@ -5950,6 +6397,9 @@ namespace tracing_layer
         if( nullptr == pfnGetProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(PhysicalMem, pfnGetPropertiesCb) )
+            return pfnGetProperties( hContext, hPhysicalMem, pMemProperties );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.PhysicalMem.pfnGetProperties, hContext, hPhysicalMem, pMemProperties);
 
         // capture parameters
@@ -5990,6 +6440,9 @@ namespace tracing_layer
         if( nullptr == pfnCreate)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(PhysicalMem, pfnCreateCb) )
+            return pfnCreate( hContext, hDevice, desc, phPhysicalMemory );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.PhysicalMem.pfnCreate, hContext, hDevice, desc, phPhysicalMemory);
 
         // capture parameters
@@ -6029,6 +6482,9 @@ namespace tracing_layer
         if( nullptr == pfnDestroy)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(PhysicalMem, pfnDestroyCb) )
+            return pfnDestroy( hContext, hPhysicalMemory );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.PhysicalMem.pfnDestroy, hContext, hPhysicalMemory);
 
         // capture parameters
@@ -6071,6 +6527,9 @@ namespace tracing_layer
         if( nullptr == pfnMap)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(VirtualMem, pfnMapCb) )
+            return pfnMap( hContext, ptr, size, hPhysicalMemory, offset, access );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.VirtualMem.pfnMap, hContext, ptr, size, hPhysicalMemory, offset, access);
 
         // capture parameters
@@ -6115,6 +6574,9 @@ namespace tracing_layer
         if( nullptr == pfnUnmap)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(VirtualMem, pfnUnmapCb) )
+            return pfnUnmap( hContext, ptr, size );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.VirtualMem.pfnUnmap, hContext, ptr, size);
 
         // capture parameters
@@ -6155,6 +6617,9 @@ namespace tracing_layer
         if( nullptr == pfnSetAccessAttribute)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(VirtualMem, pfnSetAccessAttributeCb) )
+            return pfnSetAccessAttribute( hContext, ptr, size, access );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.VirtualMem.pfnSetAccessAttribute, hContext, ptr, size, access);
 
         // capture parameters
@@ -6198,6 +6663,9 @@ namespace tracing_layer
         if( nullptr == pfnGetAccessAttribute)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(VirtualMem, pfnGetAccessAttributeCb) )
+            return pfnGetAccessAttribute( hContext, ptr, size, access, outSize );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.VirtualMem.pfnGetAccessAttribute, hContext, ptr, size, access, outSize);
 
         // capture parameters
@@ -6241,6 +6709,9 @@ namespace tracing_layer
         if( nullptr == pfnSetGlobalOffsetExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Kernel, pfnSetGlobalOffsetExpCb) )
+            return pfnSetGlobalOffsetExp( hKernel, offsetX, offsetY, offsetZ );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.KernelExp.pfnSetGlobalOffsetExp, hKernel, offsetX, offsetY, offsetZ);
 
         // capture parameters
@@ -6281,6 +6752,9 @@ namespace tracing_layer
         if( nullptr == pfnGetBinaryExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Kernel, pfnGetBinaryExpCb) )
+            return pfnGetBinaryExp( hKernel, pSize, pKernelBinary );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.KernelExp.pfnGetBinaryExp, hKernel, pSize, pKernelBinary);
 
         // capture parameters
@@ -6319,6 +6793,9 @@ namespace tracing_layer
         if( nullptr == pfnImportExternalSemaphoreExt)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Device, pfnImportExternalSemaphoreExtCb) )
+            return pfnImportExternalSemaphoreExt( hDevice, desc, phSemaphore );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnImportExternalSemaphoreExt, hDevice, desc, phSemaphore);
 
         // capture parameters
@@ -6355,6 +6832,9 @@ namespace tracing_layer
         if( nullptr == pfnReleaseExternalSemaphoreExt)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Device, pfnReleaseExternalSemaphoreExtCb) )
+            return pfnReleaseExternalSemaphoreExt( hSemaphore );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnReleaseExternalSemaphoreExt, hSemaphore);
 
         // capture parameters
@@ -6396,6 +6876,9 @@ namespace tracing_layer
         if( nullptr == pfnAppendSignalExternalSemaphoreExt)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(CommandList, pfnAppendSignalExternalSemaphoreExtCb) )
+            return pfnAppendSignalExternalSemaphoreExt( hCommandList, numSemaphores, phSemaphores, signalParams, hSignalEvent, numWaitEvents, phWaitEvents );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendSignalExternalSemaphoreExt, hCommandList, numSemaphores, phSemaphores, signalParams, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -6449,6 +6932,9 @@ namespace tracing_layer
         if( nullptr == pfnAppendWaitExternalSemaphoreExt)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(CommandList, pfnAppendWaitExternalSemaphoreExtCb) )
+            return pfnAppendWaitExternalSemaphoreExt( hCommandList, numSemaphores, phSemaphores, waitParams, hSignalEvent, numWaitEvents, phWaitEvents );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendWaitExternalSemaphoreExt, hCommandList, numSemaphores, phSemaphores, waitParams, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -6495,6 +6981,9 @@ namespace tracing_layer
         if( nullptr == pfnCreateExt)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(RTASBuilder, pfnCreateExtCb) )
+            return pfnCreateExt( hDriver, pDescriptor, phBuilder );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.RTASBuilder.pfnCreateExt, hDriver, pDescriptor, phBuilder);
 
         // capture parameters
@@ -6533,6 +7022,9 @@ namespace tracing_layer
         if( nullptr == pfnGetBuildPropertiesExt)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(RTASBuilder, pfnGetBuildPropertiesExtCb) )
+            return pfnGetBuildPropertiesExt( hBuilder, pBuildOpDescriptor, pProperties );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.RTASBuilder.pfnGetBuildPropertiesExt, hBuilder, pBuildOpDescriptor, pProperties);
 
         // capture parameters
@@ -6571,6 +7063,9 @@ namespace tracing_layer
         if( nullptr == pfnRTASFormatCompatibilityCheckExt)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Driver, pfnRTASFormatCompatibilityCheckExtCb) )
+            return pfnRTASFormatCompatibilityCheckExt( hDriver, rtasFormatA, rtasFormatB );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Driver.pfnRTASFormatCompatibilityCheckExt, hDriver, rtasFormatA, rtasFormatB);
 
         // capture parameters
@@ -6619,6 +7114,9 @@ namespace tracing_layer
         if( nullptr == pfnBuildExt)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(RTASBuilder, pfnBuildExtCb) )
+            return pfnBuildExt( hBuilder, pBuildOpDescriptor, pScratchBuffer, scratchBufferSizeBytes, pRtasBuffer, rtasBufferSizeBytes, hParallelOperation, pBuildUserPtr, pBounds, pRtasBufferSizeBytes );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.RTASBuilder.pfnBuildExt, hBuilder, pBuildOpDescriptor, pScratchBuffer, scratchBufferSizeBytes, pRtasBuffer, rtasBufferSizeBytes, hParallelOperation, pBuildUserPtr, pBounds, pRtasBufferSizeBytes);
 
         // capture parameters
@@ -6679,6 +7177,9 @@ namespace tracing_layer
         if( nullptr == pfnCommandListAppendCopyExt)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(RTASBuilder, pfnCommandListAppendCopyExtCb) )
+            return pfnCommandListAppendCopyExt( hCommandList, dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.RTASBuilder.pfnCommandListAppendCopyExt, hCommandList, dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -6723,6 +7224,9 @@ namespace tracing_layer
         if( nullptr == pfnDestroyExt)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(RTASBuilder, pfnDestroyExtCb) )
+            return pfnDestroyExt( hBuilder );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.RTASBuilder.pfnDestroyExt, hBuilder);
 
         // capture parameters
@@ -6756,6 +7260,9 @@ namespace tracing_layer
         if( nullptr == pfnCreateExt)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(RTASParallelOperation, pfnCreateExtCb) )
+            return pfnCreateExt( hDriver, phParallelOperation );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.RTASParallelOperation.pfnCreateExt, hDriver, phParallelOperation);
 
         // capture parameters
@@ -6791,6 +7298,9 @@ namespace tracing_layer
         if( nullptr == pfnGetPropertiesExt)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(RTASParallelOperation, pfnGetPropertiesExtCb) )
+            return pfnGetPropertiesExt( hParallelOperation, pProperties );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.RTASParallelOperation.pfnGetPropertiesExt, hParallelOperation, pProperties);
 
         // capture parameters
@@ -6825,6 +7335,9 @@ namespace tracing_layer
         if( nullptr == pfnJoinExt)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(RTASParallelOperation, pfnJoinExtCb) )
+            return pfnJoinExt( hParallelOperation );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.RTASParallelOperation.pfnJoinExt, hParallelOperation);
 
         // capture parameters
@@ -6857,6 +7370,9 @@ namespace tracing_layer
         if( nullptr == pfnDestroyExt)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(RTASParallelOperation, pfnDestroyExtCb) )
+            return pfnDestroyExt( hParallelOperation );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.RTASParallelOperation.pfnDestroyExt, hParallelOperation);
 
         // capture parameters
@@ -6898,6 +7414,9 @@ namespace tracing_layer
         if( nullptr == pfnGetVectorWidthPropertiesExt)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Device, pfnGetVectorWidthPropertiesExtCb) )
+            return pfnGetVectorWidthPropertiesExt( hDevice, pCount, pVectorWidthProperties );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGetVectorWidthPropertiesExt, hDevice, pCount, pVectorWidthProperties);
 
         // capture parameters
@@ -6944,6 +7463,9 @@ namespace tracing_layer
         if( nullptr == pfnGetAllocationPropertiesExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Kernel, pfnGetAllocationPropertiesExpCb) )
+            return pfnGetAllocationPropertiesExp( hKernel, pCount, pAllocationProperties );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.KernelExp.pfnGetAllocationPropertiesExp, hKernel, pCount, pAllocationProperties);
 
         // capture parameters
@@ -6983,6 +7505,9 @@ namespace tracing_layer
         if( nullptr == pfnGetIpcHandleWithProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Mem, pfnGetIpcHandleWithPropertiesCb) )
+            return pfnGetIpcHandleWithProperties( hContext, ptr, pNext, pIpcHandle );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Mem.pfnGetIpcHandleWithProperties, hContext, ptr, pNext, pIpcHandle);
 
         // capture parameters
@@ -7026,6 +7551,9 @@ namespace tracing_layer
         if( nullptr == pfnReserveCacheExt)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Device, pfnReserveCacheExtCb) )
+            return pfnReserveCacheExt( hDevice, cacheLevel, cacheReservationSize );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnReserveCacheExt, hDevice, cacheLevel, cacheReservationSize);
 
         // capture parameters
@@ -7065,6 +7593,9 @@ namespace tracing_layer
         if( nullptr == pfnSetCacheAdviceExt)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Device, pfnSetCacheAdviceExtCb) )
+            return pfnSetCacheAdviceExt( hDevice, ptr, regionSize, cacheRegion );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnSetCacheAdviceExt, hDevice, ptr, regionSize, cacheRegion);
 
         // capture parameters
@@ -7112,6 +7643,9 @@ namespace tracing_layer
         if( nullptr == pfnQueryTimestampsExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Event, pfnQueryTimestampsExpCb) )
+            return pfnQueryTimestampsExp( hEvent, hDevice, pCount, pTimestamps );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.EventExp.pfnQueryTimestampsExp, hEvent, hDevice, pCount, pTimestamps);
 
         // capture parameters
@@ -7151,6 +7685,9 @@ namespace tracing_layer
         if( nullptr == pfnGetMemoryPropertiesExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Image, pfnGetMemoryPropertiesExpCb) )
+            return pfnGetMemoryPropertiesExp( hImage, pMemoryProperties );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.ImageExp.pfnGetMemoryPropertiesExp, hImage, pMemoryProperties);
 
         // capture parameters
@@ -7189,6 +7726,9 @@ namespace tracing_layer
         if( nullptr == pfnViewCreateExt)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Image, pfnViewCreateExtCb) )
+            return pfnViewCreateExt( hContext, hDevice, desc, hImage, phImageView );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Image.pfnViewCreateExt, hContext, hDevice, desc, hImage, phImageView);
 
         // capture parameters
@@ -7233,6 +7773,9 @@ namespace tracing_layer
         if( nullptr == pfnViewCreateExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Image, pfnViewCreateExpCb) )
+            return pfnViewCreateExp( hContext, hDevice, desc, hImage, phImageView );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.ImageExp.pfnViewCreateExp, hContext, hDevice, desc, hImage, phImageView);
 
         // capture parameters
@@ -7274,6 +7817,9 @@ namespace tracing_layer
         if( nullptr == pfnSchedulingHintExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Kernel, pfnSchedulingHintExpCb) )
+            return pfnSchedulingHintExp( hKernel, pHint );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.KernelExp.pfnSchedulingHintExp, hKernel, pHint);
 
         // capture parameters
@@ -7309,6 +7855,9 @@ namespace tracing_layer
         if( nullptr == pfnPciGetPropertiesExt)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Device, pfnPciGetPropertiesExtCb) )
+            return pfnPciGetPropertiesExt( hDevice, pPciProperties );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnPciGetPropertiesExt, hDevice, pPciProperties);
 
         // capture parameters
@@ -7355,6 +7904,9 @@ namespace tracing_layer
         if( nullptr == pfnAppendImageCopyToMemoryExt)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(CommandList, pfnAppendImageCopyToMemoryExtCb) )
+            return pfnAppendImageCopyToMemoryExt( hCommandList, dstptr, hSrcImage, pSrcRegion, destRowPitch, destSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendImageCopyToMemoryExt, hCommandList, dstptr, hSrcImage, pSrcRegion, destRowPitch, destSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -7415,6 +7967,9 @@ namespace tracing_layer
         if( nullptr == pfnAppendImageCopyFromMemoryExt)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(CommandList, pfnAppendImageCopyFromMemoryExtCb) )
+            return pfnAppendImageCopyFromMemoryExt( hCommandList, hDstImage, srcptr, pDstRegion, srcRowPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendImageCopyFromMemoryExt, hCommandList, hDstImage, srcptr, pDstRegion, srcRowPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -7465,6 +8020,9 @@ namespace tracing_layer
         if( nullptr == pfnGetAllocPropertiesExt)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Image, pfnGetAllocPropertiesExtCb) )
+            return pfnGetAllocPropertiesExt( hContext, hImage, pImageAllocProperties );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Image.pfnGetAllocPropertiesExt, hContext, hImage, pImageAllocProperties);
 
         // capture parameters
@@ -7506,6 +8064,9 @@ namespace tracing_layer
         if( nullptr == pfnInspectLinkageExt)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Module, pfnInspectLinkageExtCb) )
+            return pfnInspectLinkageExt( pInspectDesc, numModules, phModules, phLog );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Module.pfnInspectLinkageExt, pInspectDesc, numModules, phModules, phLog);
 
         // capture parameters
@@ -7546,6 +8107,9 @@ namespace tracing_layer
         if( nullptr == pfnFreeExt)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Mem, pfnFreeExtCb) )
+            return pfnFreeExt( hContext, pMemFreeDesc, ptr );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Mem.pfnFreeExt, hContext, pMemFreeDesc, ptr);
 
         // capture parameters
@@ -7591,6 +8155,9 @@ namespace tracing_layer
         if( nullptr == pfnGetExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(FabricVertex, pfnGetExpCb) )
+            return pfnGetExp( hDriver, pCount, phVertices );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.FabricVertexExp.pfnGetExp, hDriver, pCount, phVertices);
 
         // capture parameters
@@ -7636,6 +8203,9 @@ namespace tracing_layer
         if( nullptr == pfnGetSubVerticesExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(FabricVertex, pfnGetSubVerticesExpCb) )
+            return pfnGetSubVerticesExp( hVertex, pCount, phSubvertices );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.FabricVertexExp.pfnGetSubVerticesExp, hVertex, pCount, phSubvertices);
 
         // capture parameters
@@ -7673,6 +8243,9 @@ namespace tracing_layer
         if( nullptr == pfnGetPropertiesExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(FabricVertex, pfnGetPropertiesExpCb) )
+            return pfnGetPropertiesExp( hVertex, pVertexProperties );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.FabricVertexExp.pfnGetPropertiesExp, hVertex, pVertexProperties);
 
         // capture parameters
@@ -7708,6 +8281,9 @@ namespace tracing_layer
         if( nullptr == pfnGetDeviceExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(FabricVertex, pfnGetDeviceExpCb) )
+            return pfnGetDeviceExp( hVertex, phDevice );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.FabricVertexExp.pfnGetDeviceExp, hVertex, phDevice);
 
         // capture parameters
@@ -7743,6 +8319,9 @@ namespace tracing_layer
         if( nullptr == pfnGetFabricVertexExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Device, pfnGetFabricVertexExpCb) )
+            return pfnGetFabricVertexExp( hDevice, phVertex );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.DeviceExp.pfnGetFabricVertexExp, hDevice, phVertex);
 
         // capture parameters
@@ -7787,6 +8366,9 @@ namespace tracing_layer
         if( nullptr == pfnGetExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(FabricEdge, pfnGetExpCb) )
+            return pfnGetExp( hVertexA, hVertexB, pCount, phEdges );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.FabricEdgeExp.pfnGetExp, hVertexA, hVertexB, pCount, phEdges);
 
         // capture parameters
@@ -7827,6 +8409,9 @@ namespace tracing_layer
         if( nullptr == pfnGetVerticesExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(FabricEdge, pfnGetVerticesExpCb) )
+            return pfnGetVerticesExp( hEdge, phVertexA, phVertexB );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.FabricEdgeExp.pfnGetVerticesExp, hEdge, phVertexA, phVertexB);
 
         // capture parameters
@@ -7864,6 +8449,9 @@ namespace tracing_layer
         if( nullptr == pfnGetPropertiesExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(FabricEdge, pfnGetPropertiesExpCb) )
+            return pfnGetPropertiesExp( hEdge, pEdgeProperties );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.FabricEdgeExp.pfnGetPropertiesExp, hEdge, pEdgeProperties);
 
         // capture parameters
@@ -7914,6 +8502,9 @@ namespace tracing_layer
         if( nullptr == pfnQueryKernelTimestampsExt)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Event, pfnQueryKernelTimestampsExtCb) )
+            return pfnQueryKernelTimestampsExt( hEvent, hDevice, pCount, pResults );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Event.pfnQueryKernelTimestampsExt, hEvent, hDevice, pCount, pResults);
 
         // capture parameters
@@ -7954,6 +8545,9 @@ namespace tracing_layer
         if( nullptr == pfnCreateExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(RTASBuilder, pfnCreateExpCb) )
+            return pfnCreateExp( hDriver, pDescriptor, phBuilder );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.RTASBuilderExp.pfnCreateExp, hDriver, pDescriptor, phBuilder);
 
         // capture parameters
@@ -7992,6 +8586,9 @@ namespace tracing_layer
         if( nullptr == pfnGetBuildPropertiesExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(RTASBuilder, pfnGetBuildPropertiesExpCb) )
+            return pfnGetBuildPropertiesExp( hBuilder, pBuildOpDescriptor, pProperties );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.RTASBuilderExp.pfnGetBuildPropertiesExp, hBuilder, pBuildOpDescriptor, pProperties);
 
         // capture parameters
@@ -8030,6 +8627,9 @@ namespace tracing_layer
         if( nullptr == pfnRTASFormatCompatibilityCheckExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Driver, pfnRTASFormatCompatibilityCheckExpCb) )
+            return pfnRTASFormatCompatibilityCheckExp( hDriver, rtasFormatA, rtasFormatB );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.DriverExp.pfnRTASFormatCompatibilityCheckExp, hDriver, rtasFormatA, rtasFormatB);
 
         // capture parameters
@@ -8078,6 +8678,9 @@ namespace tracing_layer
         if( nullptr == pfnBuildExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(RTASBuilder, pfnBuildExpCb) )
+            return pfnBuildExp( hBuilder, pBuildOpDescriptor, pScratchBuffer, scratchBufferSizeBytes, pRtasBuffer, rtasBufferSizeBytes, hParallelOperation, pBuildUserPtr, pBounds, pRtasBufferSizeBytes );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.RTASBuilderExp.pfnBuildExp, hBuilder, pBuildOpDescriptor, pScratchBuffer, scratchBufferSizeBytes, pRtasBuffer, rtasBufferSizeBytes, hParallelOperation, pBuildUserPtr, pBounds, pRtasBufferSizeBytes);
 
         // capture parameters
@@ -8128,6 +8731,9 @@ namespace tracing_layer
         if( nullptr == pfnDestroyExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(RTASBuilder, pfnDestroyExpCb) )
+            return pfnDestroyExp( hBuilder );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.RTASBuilderExp.pfnDestroyExp, hBuilder);
 
         // capture parameters
@@ -8161,6 +8767,9 @@ namespace tracing_layer
         if( nullptr == pfnCreateExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(RTASParallelOperation, pfnCreateExpCb) )
+            return pfnCreateExp( hDriver, phParallelOperation );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.RTASParallelOperationExp.pfnCreateExp, hDriver, phParallelOperation);
 
         // capture parameters
@@ -8196,6 +8805,9 @@ namespace tracing_layer
         if( nullptr == pfnGetPropertiesExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(RTASParallelOperation, pfnGetPropertiesExpCb) )
+            return pfnGetPropertiesExp( hParallelOperation, pProperties );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.RTASParallelOperationExp.pfnGetPropertiesExp, hParallelOperation, pProperties);
 
         // capture parameters
@@ -8230,6 +8842,9 @@ namespace tracing_layer
         if( nullptr == pfnJoinExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(RTASParallelOperation, pfnJoinExpCb) )
+            return pfnJoinExp( hParallelOperation );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.RTASParallelOperationExp.pfnJoinExp, hParallelOperation);
 
         // capture parameters
@@ -8262,6 +8877,9 @@ namespace tracing_layer
         if( nullptr == pfnDestroyExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(RTASParallelOperation, pfnDestroyExpCb) )
+            return pfnDestroyExp( hParallelOperation );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.RTASParallelOperationExp.pfnDestroyExp, hParallelOperation);
 
         // capture parameters
@@ -8299,6 +8917,9 @@ namespace tracing_layer
         if( nullptr == pfnGetPitchFor2dImage)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Mem, pfnGetPitchFor2dImageCb) )
+            return pfnGetPitchFor2dImage( hContext, hDevice, imageWidth, imageHeight, elementSizeInBytes, rowPitch );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Mem.pfnGetPitchFor2dImage, hContext, hDevice, imageWidth, imageHeight, elementSizeInBytes, rowPitch);
 
         // capture parameters
@@ -8342,6 +8963,9 @@ namespace tracing_layer
         if( nullptr == pfnGetDeviceOffsetExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(Image, pfnGetDeviceOffsetExpCb) )
+            return pfnGetDeviceOffsetExp( hImage, pDeviceOffset );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.ImageExp.pfnGetDeviceOffsetExp, hImage, pDeviceOffset);
 
         // capture parameters
@@ -8377,6 +9001,9 @@ namespace tracing_layer
         if( nullptr == pfnCreateCloneExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(CommandList, pfnCreateCloneExpCb) )
+            return pfnCreateCloneExp( hCommandList, phClonedCommandList );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandListExp.pfnCreateCloneExp, hCommandList, phClonedCommandList);
 
         // capture parameters
@@ -8422,6 +9049,9 @@ namespace tracing_layer
         if( nullptr == pfnImmediateAppendCommandListsExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(CommandList, pfnImmediateAppendCommandListsExpCb) )
+            return pfnImmediateAppendCommandListsExp( hCommandListImmediate, numCommandLists, phCommandLists, hSignalEvent, numWaitEvents, phWaitEvents );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandListExp.pfnImmediateAppendCommandListsExp, hCommandListImmediate, numCommandLists, phCommandLists, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -8466,6 +9096,9 @@ namespace tracing_layer
         if( nullptr == pfnGetNextCommandIdExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(CommandList, pfnGetNextCommandIdExpCb) )
+            return pfnGetNextCommandIdExp( hCommandList, desc, pCommandId );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandListExp.pfnGetNextCommandIdExp, hCommandList, desc, pCommandId);
 
         // capture parameters
@@ -8508,6 +9141,9 @@ namespace tracing_layer
         if( nullptr == pfnGetNextCommandIdWithKernelsExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(CommandList, pfnGetNextCommandIdWithKernelsExpCb) )
+            return pfnGetNextCommandIdWithKernelsExp( hCommandList, desc, numKernels, phKernels, pCommandId );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandListExp.pfnGetNextCommandIdWithKernelsExp, hCommandList, desc, numKernels, phKernels, pCommandId);
 
         // capture parameters
@@ -8550,6 +9186,9 @@ namespace tracing_layer
         if( nullptr == pfnUpdateMutableCommandsExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(CommandList, pfnUpdateMutableCommandsExpCb) )
+            return pfnUpdateMutableCommandsExp( hCommandList, desc );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandListExp.pfnUpdateMutableCommandsExp, hCommandList, desc);
 
         // capture parameters
@@ -8586,6 +9225,9 @@ namespace tracing_layer
         if( nullptr == pfnUpdateMutableCommandSignalEventExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(CommandList, pfnUpdateMutableCommandSignalEventExpCb) )
+            return pfnUpdateMutableCommandSignalEventExp( hCommandList, commandId, hSignalEvent );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandListExp.pfnUpdateMutableCommandSignalEventExp, hCommandList, commandId, hSignalEvent);
 
         // capture parameters
@@ -8626,6 +9268,9 @@ namespace tracing_layer
         if( nullptr == pfnUpdateMutableCommandWaitEventsExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(CommandList, pfnUpdateMutableCommandWaitEventsExpCb) )
+            return pfnUpdateMutableCommandWaitEventsExp( hCommandList, commandId, numWaitEvents, phWaitEvents );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandListExp.pfnUpdateMutableCommandWaitEventsExp, hCommandList, commandId, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -8668,6 +9313,9 @@ namespace tracing_layer
         if( nullptr == pfnUpdateMutableCommandKernelsExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZE_API_IS_TRACED(CommandList, pfnUpdateMutableCommandKernelsExpCb) )
+            return pfnUpdateMutableCommandKernelsExp( hCommandList, numKernels, pCommandId, phKernels );
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandListExp.pfnUpdateMutableCommandKernelsExp, hCommandList, numKernels, pCommandId, phKernels);
 
         // capture parameters
@@ -26,6 +26,9 @@ namespace tracing_layer
         if( nullptr == pfnGetLastErrorDescription)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !ZER_API_IS_TRACED(Global, pfnGetLastErrorDescriptionCb) )
+            return pfnGetLastErrorDescription( ppString );
+
         ZE_HANDLE_TRACER_RECURSION(context.zerDdiTable.Global.pfnGetLastErrorDescription, ppString);
 
         // capture parameters
@@ -58,6 +61,9 @@ namespace tracing_layer
         if( nullptr == pfnTranslateDeviceHandleToIdentifier)
             return UINT32_MAX;
 
+        if( !ZER_API_IS_TRACED(Global, pfnTranslateDeviceHandleToIdentifierCb) )
+            return pfnTranslateDeviceHandleToIdentifier( hDevice );
+
         ZE_HANDLE_TRACER_RECURSION(context.zerDdiTable.Global.pfnTranslateDeviceHandleToIdentifier, hDevice);
 
         // capture parameters
@@ -90,6 +96,9 @@ namespace tracing_layer
         if( nullptr == pfnTranslateIdentifierToDeviceHandle)
             return nullptr;
 
+        if( !ZER_API_IS_TRACED(Global, pfnTranslateIdentifierToDeviceHandleCb) )
+            return pfnTranslateIdentifierToDeviceHandle( identifier );
+
         ZE_HANDLE_TRACER_RECURSION(context.zerDdiTable.Global.pfnTranslateIdentifierToDeviceHandle, identifier);
 
         // capture parameters
@@ -122,6 +131,9 @@ namespace tracing_layer
         if( nullptr == pfnGetDefaultContext)
             return nullptr;
 
+        if( !ZER_API_IS_TRACED(Global, pfnGetDefaultContextCb) )
+            return pfnGetDefaultContext();
+
         ZE_HANDLE_TRACER_RECURSION(context.zerDdiTable.Global.pfnGetDefaultContext);
 
         // capture parameters
@@ -28,12 +28,19 @@ namespace validation_layer
             basic_leak_checker.zetValidation = zetChecker;
             basic_leak_checker.zesValidation = zesChecker;
             basic_leak_checker.zerValidation = zerChecker;
+            basic_leak_checker.checkerName = "basic_leak";
+            // Epilogues only count successful calls, so they can run off the calling thread,
+            // unless they also capture the caller's stack and read the created handles
+            basic_leak_checker.deferEpilogues = !validation_layer::context.getInstance().allocationSites;
+            validation_layer::context.getInstance().initSampleRate(basic_leak_checker, "ZEL_BASIC_LEAK_CHECKER_SAMPLE_RATE");
             validation_layer::context.getInstance().validationHandlers.push_back(&basic_leak_checker);
         }
     }
 
     basic_leakChecker::~basic_leakChecker() {
         if(enablebasic_leak) {
+            // Queued epilogues must be counted before the report, and hold pointers to the entry points
+            validation_layer::context.stopDeferredEpilogues();
             delete basic_leak_checker.zeValidation;
             delete basic_leak_checker.zetValidation;
             delete basic_leak_checker.zesValidation;
@@ -41,250 +48,369 @@ namespace validation_layer
         }
     }
 
+    using countedFunction = basic_leakChecker::ZEbasic_leakChecker::countedFunction;
+
+    // Names used in the report, indexed by countedFunction
+    static const char *countedFunctionNames[countedFunction::countedFunctionCount] = {
+        "zeContextCreate",
+        "zeContextDestroy",
+        "zeCommandQueueCreate",
+        "zeCommandQueueDestroy",
+        "zeModuleCreate",
+        "zeModuleDestroy",
+        "zeKernelCreate",
+        "zeKernelDestroy",
+        "zeEventPoolCreate",
+        "zeEventPoolDestroy",
+        "zeCommandListCreateImmediate",
+        "zeCommandListCreate",
+        "zeCommandListDestroy",
+        "zeEventCreate",
+        "zexCounterBasedEventCreate2",
+        "zeEventDestroy",
+        "zeFenceCreate",
+        "zeFenceDestroy",
+        "zeImageCreate",
+        "zeImageViewCreateExt",
+        "zeImageDestroy",
+        "zeSamplerCreate",
+        "zeSamplerDestroy",
+        "zeMemAllocDevice",
+        "zeMemAllocHost",
+        "zeMemAllocShared",
+        "zeMemFree",
+        "zeMemFreeExt",
+    };
+
     struct ctorsAndDtors {
-        std::vector<std::string> ctors;
-        std::vector<std::string> dtors;
+        std::vector<countedFunction> ctors;
+        std::vector<countedFunction> dtors;
     };
 
     static std::vector<ctorsAndDtors> createDestroySet() {
+        using F = countedFunction;
         return {
-            {{"zeContextCreate"}, {"zeContextDestroy"}},
-            {{"zeCommandQueueCreate"}, {"zeCommandQueueDestroy"}},
-            {{"zeModuleCreate"}, {"zeModuleDestroy"}},
-            {{"zeKernelCreate"}, {"zeKernelDestroy"}},
-            {{"zeEventPoolCreate"}, {"zeEventPoolDestroy"}},
-            {{"zeCommandListCreateImmediate", "zeCommandListCreate"}, {"zeCommandListDestroy"}},
-            {{"zeEventCreate", "zexCounterBasedEventCreate2"}, {"zeEventDestroy"}},
-            {{"zeFenceCreate"}, {"zeFenceDestroy"}},
-            {{"zeImageCreate", "zeImageViewCreateExt"}, {"zeImageDestroy"}},
-            {{"zeSamplerCreate"}, {"zeSamplerDestroy"}},
-            {{"zeMemAllocDevice", "zeMemAllocHost", "zeMemAllocShared"}, {"zeMemFree", "zeMemFreeExt"}}
+            {{F::zeContextCreate_}, {F::zeContextDestroy_}},
+            {{F::zeCommandQueueCreate_}, {F::zeCommandQueueDestroy_}},
+            {{F::zeModuleCreate_}, {F::zeModuleDestroy_}},
+            {{F::zeKernelCreate_}, {F::zeKernelDestroy_}},
+            {{F::zeEventPoolCreate_}, {F::zeEventPoolDestroy_}},
+            {{F::zeCommandListCreateImmediate_, F::zeCommandListCreate_}, {F::zeCommandListDestroy_}},
+            {{F::zeEventCreate_, F::zexCounterBasedEventCreate2_}, {F::zeEventDestroy_}},
+            {{F::zeFenceCreate_}, {F::zeFenceDestroy_}},
+            {{F::zeImageCreate_, F::zeImageViewCreateExt_}, {F::zeImageDestroy_}},
+            {{F::zeSamplerCreate_}, {F::zeSamplerDestroy_}},
+            {{F::zeMemAllocDevice_, F::zeMemAllocHost_, F::zeMemAllocShared_}, {F::zeMemFree_, F::zeMemFreeExt_}}
         };
     }
 
-    basic_leakChecker::ZEbasic_leakChecker::ZEbasic_leakChecker() {
-        // initialize counts for all functions that should be tracked
-        auto set = createDestroySet();
-        for (const auto &s : set) {
-            for (auto &name : s.ctors) {
-                counts[name] = 0;
-            }
-            for (auto &name : s.dtors) {
-                counts[name] = 0;
-            }
+    basic_leakChecker::ZEbasic_leakChecker::threadCounters::threadCounters() {
+        for (auto &count : counts) {
+            count.store(0, std::memory_order_relaxed);
         }
     }
 
-    ze_result_t basic_leakChecker::ZEbasic_leakChecker::zeContextCreateEpilogue(ze_driver_handle_t, const ze_context_desc_t *, ze_context_handle_t*, ze_result_t result) {
+    void *basic_leakChecker::ZEbasic_leakChecker::threadCounters::operator new(size_t size) {
+        // Over-allocate, align, and keep the original pointer just below the block
+        auto raw = static_cast<char *>(::operator new(size + alignof(threadCounters) + sizeof(void *)));
+        auto aligned = reinterpret_cast<uintptr_t>(raw + sizeof(void *) + alignof(threadCounters) - 1) &
+                       ~static_cast<uintptr_t>(alignof(threadCounters) - 1);
+        reinterpret_cast<void **>(aligned)[-1] = raw;
+        return reinterpret_cast<void *>(aligned);
+    }
+
+    void basic_leakChecker::ZEbasic_leakChecker::threadCounters::operator delete(void *block) {
+        if (block)
+            ::operator delete(static_cast<void **>(block)[-1]);
+    }
+
+    // Checker that thread counter blocks may still be folded into; cleared when it
+    // is destroyed so threads exiting afterwards leave the counters alone
+    static std::atomic<basic_leakChecker::ZEbasic_leakChecker *> liveLeakChecker{nullptr};
+
+    basic_leakChecker::ZEbasic_leakChecker::ZEbasic_leakChecker() {
+        liveLeakChecker.store(this, std::memory_order_release);
+    }
+
+    ze_result_t basic_leakChecker::ZEbasic_leakChecker::zeContextCreateEpilogue(ze_driver_handle_t, const ze_context_desc_t *, ze_context_handle_t *phContext, ze_result_t result) {
         if (result == ZE_RESULT_SUCCESS) {
-            countFunctionCall("zeContextCreate");
+            countFunctionCall(zeContextCreate_);
+            context.recordAllocationSite("zeContextCreate", phContext);
         }
         return result;
     }
 
-    ze_result_t basic_leakChecker::ZEbasic_leakChecker::zeContextDestroyEpilogue(ze_context_handle_t, ze_result_t result) {
+    ze_result_t basic_leakChecker::ZEbasic_leakChecker::zeContextDestroyEpilogue(ze_context_handle_t hContext, ze_result_t result) {
         if (result == ZE_RESULT_SUCCESS) {
-            countFunctionCall("zeContextDestroy");
+            countFunctionCall(zeContextDestroy_);
+            context.releaseAllocationSite(hContext);
         }
         return result;
     }
 
-    ze_result_t basic_leakChecker::ZEbasic_leakChecker::zeCommandQueueCreateEpilogue(ze_context_handle_t, ze_device_handle_t, const ze_command_queue_desc_t *, ze_command_queue_handle_t *, ze_result_t result) {
+    ze_result_t basic_leakChecker::ZEbasic_leakChecker::zeCommandQueueCreateEpilogue(ze_context_handle_t, ze_device_handle_t, const ze_command_queue_desc_t *, ze_command_queue_handle_t *phCommandQueue, ze_result_t result) {
         if (result == ZE_RESULT_SUCCESS) {
-            countFunctionCall("zeCommandQueueCreate");
+            countFunctionCall(zeCommandQueueCreate_);
+            context.recordAllocationSite("zeCommandQueueCreate", phCommandQueue);
         }
         return result;
     }
 
-    ze_result_t basic_leakChecker::ZEbasic_leakChecker::zeCommandQueueDestroyEpilogue(ze_command_queue_handle_t, ze_result_t result) {
+    ze_result_t basic_leakChecker::ZEbasic_leakChecker::zeCommandQueueDestroyEpilogue(ze_command_queue_handle_t hCommandQueue, ze_result_t result) {
         if (result == ZE_RESULT_SUCCESS) {
-            countFunctionCall("zeCommandQueueDestroy");
+            countFunctionCall(zeCommandQueueDestroy_);
+            context.releaseAllocationSite(hCommandQueue);
         }
         return result;
     }
 
-    ze_result_t basic_leakChecker::ZEbasic_leakChecker::zeModuleCreateEpilogue(ze_context_handle_t, ze_device_handle_t, const ze_module_desc_t*, ze_module_handle_t*, ze_module_build_log_handle_t*, ze_result_t result) {
+    ze_result_t basic_leakChecker::ZEbasic_leakChecker::zeModuleCreateEpilogue(ze_context_handle_t, ze_device_handle_t, const ze_module_desc_t*, ze_module_handle_t *phModule, ze_module_build_log_handle_t*, ze_result_t result) {
         if (result == ZE_RESULT_SUCCESS) {
-            countFunctionCall("zeModuleCreate");
+            countFunctionCall(zeModuleCreate_);
+            context.recordAllocationSite("zeModuleCreate", phModule);
         }
         return result;
     }
 
-    ze_result_t basic_leakChecker::ZEbasic_leakChecker::zeModuleDestroyEpilogue(ze_module_handle_t, ze_result_t result) {
+    ze_result_t basic_leakChecker::ZEbasic_leakChecker::zeModuleDestroyEpilogue(ze_module_handle_t hModule, ze_result_t result) {
         if (result == ZE_RESULT_SUCCESS) {
-            countFunctionCall("zeModuleDestroy");
+            countFunctionCall(zeModuleDestroy_);
+            context.releaseAllocationSite(hModule);
         }
         return result;
     }
 
-    ze_result_t basic_leakChecker::ZEbasic_leakChecker::zeKernelCreateEpilogue(ze_module_handle_t, const ze_kernel_desc_t*, ze_kernel_handle_t*, ze_result_t result) {
+    ze_result_t basic_leakChecker::ZEbasic_leakChecker::zeKernelCreateEpilogue(ze_module_handle_t, const ze_kernel_desc_t*, ze_kernel_handle_t *phKernel, ze_result_t result) {
         if (result == ZE_RESULT_SUCCESS) {
-            countFunctionCall("zeKernelCreate");
+            countFunctionCall(zeKernelCreate_);
+            context.recordAllocationSite("zeKernelCreate", phKernel);
         }
         return result;
     }
 
-    ze_result_t basic_leakChecker::ZEbasic_leakChecker::zeKernelDestroyEpilogue(ze_kernel_handle_t, ze_result_t result) {
+    ze_result_t basic_leakChecker::ZEbasic_leakChecker::zeKernelDestroyEpilogue(ze_kernel_handle_t hKernel, ze_result_t result) {
         if (result == ZE_RESULT_SUCCESS) {
-            countFunctionCall("zeKernelDestroy");
+            countFunctionCall(zeKernelDestroy_);
+            context.releaseAllocationSite(hKernel);
         }
         return result;
     }
 
-    ze_result_t basic_leakChecker::ZEbasic_leakChecker::zeEventPoolCreateEpilogue(ze_context_handle_t, const ze_event_pool_desc_t*, uint32_t, ze_device_handle_t*, ze_event_pool_handle_t*, ze_result_t result) {
+    ze_result_t basic_leakChecker::ZEbasic_leakChecker::zeEventPoolCreateEpilogue(ze_context_handle_t, const ze_event_pool_desc_t*, uint32_t, ze_device_handle_t*, ze_event_pool_handle_t *phEventPool, ze_result_t result) {
         if (result == ZE_RESULT_SUCCESS) {
-            countFunctionCall("zeEventPoolCreate");
+            countFunctionCall(zeEventPoolCreate_);
+            context.recordAllocationSite("zeEventPoolCreate", phEventPool);
         }
         return result;
     }
 
-    ze_result_t basic_leakChecker::ZEbasic_leakChecker::zeEventPoolDestroyEpilogue(ze_event_pool_handle_t, ze_result_t result) {
+    ze_result_t basic_leakChecker::ZEbasic_leakChecker::zeEventPoolDestroyEpilogue(ze_event_pool_handle_t hEventPool, ze_result_t result) {
         if (result == ZE_RESULT_SUCCESS) {
-            countFunctionCall("zeEventPoolDestroy");
+            countFunctionCall(zeEventPoolDestroy_);
+            context.releaseAllocationSite(hEventPool);
         }
         return result;
     }
 
-    ze_result_t basic_leakChecker::ZEbasic_leakChecker::zeCommandListCreateImmediateEpilogue(ze_context_handle_t, ze_device_handle_t, const ze_command_queue_desc_t*, ze_command_list_handle_t*, ze_result_t result) {
+    ze_result_t basic_leakChecker::ZEbasic_leakChecker::zeCommandListCreateImmediateEpilogue(ze_context_handle_t, ze_device_handle_t, const ze_command_queue_desc_t*, ze_command_list_handle_t *phCommandList, ze_result_t result) {
         if (result == ZE_RESULT_SUCCESS) {
-            countFunctionCall("zeCommandListCreateImmediate");
+            countFunctionCall(zeCommandListCreateImmediate_);
+            context.recordAllocationSite("zeCommandListCreateImmediate", phCommandList);
         }
         return result;
     }
 
-    ze_result_t basic_leakChecker::ZEbasic_leakChecker::zeCommandListCreateEpilogue(ze_context_handle_t, ze_device_handle_t, const ze_command_list_desc_t*, ze_command_list_handle_t*, ze_result_t result) {
+    ze_result_t basic_leakChecker::ZEbasic_leakChecker::zeCommandListCreateEpilogue(ze_context_handle_t, ze_device_handle_t, const ze_command_list_desc_t*, ze_command_list_handle_t *phCommandList, ze_result_t result) {
         if (result == ZE_RESULT_SUCCESS) {
-            countFunctionCall("zeCommandListCreate");
+            countFunctionCall(zeCommandListCreate_);
+            context.recordAllocationSite("zeCommandListCreate", phCommandList);
         }
         return result;
     }
 
-    ze_result_t basic_leakChecker::ZEbasic_leakChecker::zeCommandListDestroyEpilogue(ze_command_list_handle_t, ze_result_t result) {
+    ze_result_t basic_leakChecker::ZEbasic_leakChecker::zeCommandListDestroyEpilogue(ze_command_list_handle_t hCommandList, ze_result_t result) {
         if (result == ZE_RESULT_SUCCESS) {
-            countFunctionCall("zeCommandListDestroy");
+            countFunctionCall(zeCommandListDestroy_);
+            context.releaseAllocationSite(hCommandList);
         }
         return result;
     }
 
-    ze_result_t basic_leakChecker::ZEbasic_leakChecker::zeEventCreateEpilogue(ze_event_pool_handle_t, const ze_event_desc_t *, ze_event_handle_t *, ze_result_t result) {
+    ze_result_t basic_leakChecker::ZEbasic_leakChecker::zeEventCreateEpilogue(ze_event_pool_handle_t, const ze_event_desc_t *, ze_event_handle_t *phEvent, ze_result_t result) {
         if (result == ZE_RESULT_SUCCESS) {
-            countFunctionCall("zeEventCreate");
+            countFunctionCall(zeEventCreate_);
+            context.recordAllocationSite("zeEventCreate", phEvent);
         }
         return result;
     }
 
-    ze_result_t basic_leakChecker::ZEbasic_leakChecker::zeEventDestroyEpilogue(ze_event_handle_t, ze_result_t result) {
+    ze_result_t basic_leakChecker::ZEbasic_leakChecker::zeEventDestroyEpilogue(ze_event_handle_t hEvent, ze_result_t result) {
         if (result == ZE_RESULT_SUCCESS) {
-            countFunctionCall("zeEventDestroy");
+            countFunctionCall(zeEventDestroy_);
+            context.releaseAllocationSite(hEvent);
         }
         return result;
     }
 
-    ze_result_t basic_leakChecker::ZEbasic_leakChecker::zexCounterBasedEventCreate2Epilogue(ze_context_handle_t, ze_device_handle_t, const void *, ze_event_handle_t *, ze_result_t result) {
+    ze_result_t basic_leakChecker::ZEbasic_leakChecker::zexCounterBasedEventCreate2Epilogue(ze_context_handle_t, ze_device_handle_t, const void *, ze_event_handle_t *phEvent, ze_result_t result) {
         if (result == ZE_RESULT_SUCCESS) {
-            countFunctionCall("zexCounterBasedEventCreate2");
+            countFunctionCall(zexCounterBasedEventCreate2_);
+            context.recordAllocationSite("zexCounterBasedEventCreate2", phEvent);
         }
         return result;
     }
 
-    ze_result_t basic_leakChecker::ZEbasic_leakChecker::zeFenceCreateEpilogue(ze_command_queue_handle_t, const ze_fence_desc_t *, ze_fence_handle_t*, ze_result_t result) {
+    ze_result_t basic_leakChecker::ZEbasic_leakChecker::zeFenceCreateEpilogue(ze_command_queue_handle_t, const ze_fence_desc_t *, ze_fence_handle_t *phFence, ze_result_t result) {
         if (result == ZE_RESULT_SUCCESS) {
-            countFunctionCall("zeFenceCreate");
+            countFunctionCall(zeFenceCreate_);
+            context.recordAllocationSite("zeFenceCreate", phFence);
         }
         return result;
     }
 
-    ze_result_t basic_leakChecker::ZEbasic_leakChecker::zeFenceDestroyEpilogue(ze_fence_handle_t, ze_result_t result) {
+    ze_result_t basic_leakChecker::ZEbasic_leakChecker::zeFenceDestroyEpilogue(ze_fence_handle_t hFence, ze_result_t result) {
         if (result == ZE_RESULT_SUCCESS) {
-            countFunctionCall("zeFenceDestroy");
+            countFunctionCall(zeFenceDestroy_);
+            context.releaseAllocationSite(hFence);
         }
         return result;
     }
 
-    ze_result_t basic_leakChecker::ZEbasic_leakChecker::zeImageCreateEpilogue(ze_context_handle_t, ze_device_handle_t, const ze_image_desc_t*, ze_image_handle_t*, ze_result_t result) {
+    ze_result_t basic_leakChecker::ZEbasic_leakChecker::zeImageCreateEpilogue(ze_context_handle_t, ze_device_handle_t, const ze_image_desc_t*, ze_image_handle_t *phImage, ze_result_t result) {
         if (result == ZE_RESULT_SUCCESS) {
-            countFunctionCall("zeImageCreate");
+            countFunctionCall(zeImageCreate_);
+            context.recordAllocationSite("zeImageCreate", phImage);
         }
         return result;
     }
 
     ze_result_t basic_leakChecker::ZEbasic_leakChecker::zeImageViewCreateExtEpilogue(ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_image_desc_t* desc, ze_image_handle_t hImage, ze_image_handle_t* phImageView , ze_result_t result) {
         if (result == ZE_RESULT_SUCCESS) {
-            countFunctionCall("zeImageViewCreateExt");
+            countFunctionCall(zeImageViewCreateExt_);
+            context.recordAllocationSite("zeImageViewCreateExt", phImageView);
         }
         return result;
     }
 
-    ze_result_t basic_leakChecker::ZEbasic_leakChecker::zeImageDestroyEpilogue(ze_image_handle_t, ze_result_t result) {
+    ze_result_t basic_leakChecker::ZEbasic_leakChecker::zeImageDestroyEpilogue(ze_image_handle_t hImage, ze_result_t result) {
         if (result == ZE_RESULT_SUCCESS) {
-            countFunctionCall("zeImageDestroy");
+            countFunctionCall(zeImageDestroy_);
+            context.releaseAllocationSite(hImage);
         }
         return result;
     }
 
-    ze_result_t basic_leakChecker::ZEbasic_leakChecker::zeSamplerCreateEpilogue(ze_context_handle_t, ze_device_handle_t, const ze_sampler_desc_t*, ze_sampler_handle_t*, ze_result_t result) {
+    ze_result_t basic_leakChecker::ZEbasic_leakChecker::zeSamplerCreateEpilogue(ze_context_handle_t, ze_device_handle_t, const ze_sampler_desc_t*, ze_sampler_handle_t *phSampler, ze_result_t result) {
         if (result == ZE_RESULT_SUCCESS) {
-            countFunctionCall("zeSamplerCreate");
+            countFunctionCall(zeSamplerCreate_);
+            context.recordAllocationSite("zeSamplerCreate", phSampler);
         }
         return result;
     }
 
-    ze_result_t basic_leakChecker::ZEbasic_leakChecker::zeSamplerDestroyEpilogue(ze_sampler_handle_t, ze_result_t result) {
+    ze_result_t basic_leakChecker::ZEbasic_leakChecker::zeSamplerDestroyEpilogue(ze_sampler_handle_t hSampler, ze_result_t result) {
         if (result == ZE_RESULT_SUCCESS) {
-            countFunctionCall("zeSamplerDestroy");
+            countFunctionCall(zeSamplerDestroy_);
+            context.releaseAllocationSite(hSampler);
         }
         return result;
     }
 
-    ze_result_t basic_leakChecker::ZEbasic_leakChecker::zeMemAllocDeviceEpilogue(ze_context_handle_t, const ze_device_mem_alloc_desc_t *, size_t, size_t, ze_device_handle_t, void **, ze_result_t result) {
+    ze_result_t basic_leakChecker::ZEbasic_leakChecker::zeMemAllocDeviceEpilogue(ze_context_handle_t, const ze_device_mem_alloc_desc_t *, size_t, size_t, ze_device_handle_t, void **pptr, ze_result_t result) {
         if (result == ZE_RESULT_SUCCESS) {
-            countFunctionCall("zeMemAllocDevice");
+            countFunctionCall(zeMemAllocDevice_);
+            context.recordAllocationSite("zeMemAllocDevice", pptr);
         }
         return result;
     }
 
-    ze_result_t basic_leakChecker::ZEbasic_leakChecker::zeMemAllocHostEpilogue(ze_context_handle_t, const ze_host_mem_alloc_desc_t *, size_t, size_t, void **, ze_result_t result) {
+    ze_result_t basic_leakChecker::ZEbasic_leakChecker::zeMemAllocHostEpilogue(ze_context_handle_t, const ze_host_mem_alloc_desc_t *, size_t, size_t, void **pptr, ze_result_t result) {
         if (result == ZE_RESULT_SUCCESS) {
-            countFunctionCall("zeMemAllocHost");
+            countFunctionCall(zeMemAllocHost_);
+            context.recordAllocationSite("zeMemAllocHost", pptr);
         }
         return result;
     }
 
-    ze_result_t basic_leakChecker::ZEbasic_leakChecker::zeMemAllocSharedEpilogue(ze_context_handle_t, const ze_device_mem_alloc_desc_t *, const ze_host_mem_alloc_desc_t *, size_t, size_t, ze_device_handle_t, void **, ze_result_t result) {
+    ze_result_t basic_leakChecker::ZEbasic_leakChecker::zeMemAllocSharedEpilogue(ze_context_handle_t, const ze_device_mem_alloc_desc_t *, const ze_host_mem_alloc_desc_t *, size_t, size_t, ze_device_handle_t, void **pptr, ze_result_t result) {
         if (result == ZE_RESULT_SUCCESS) {
-            countFunctionCall("zeMemAllocShared");
+            countFunctionCall(zeMemAllocShared_);
+            context.recordAllocationSite("zeMemAllocShared", pptr);
         }
         return result;
     }
 
-    ze_result_t basic_leakChecker::ZEbasic_leakChecker::zeMemFreeEpilogue(ze_context_handle_t, void *, ze_result_t result) {
+    ze_result_t basic_leakChecker::ZEbasic_leakChecker::zeMemFreeEpilogue(ze_context_handle_t, void *ptr, ze_result_t result) {
         if (result == ZE_RESULT_SUCCESS) {
-            countFunctionCall("zeMemFree");
+            countFunctionCall(zeMemFree_);
+            context.releaseAllocationSite(ptr);
         }
         return result;
     }
 
-    ze_result_t basic_leakChecker::ZEbasic_leakChecker::zeMemFreeExtEpilogue(ze_context_handle_t, const ze_memory_free_ext_desc_t*, void *, ze_result_t result) {
+    ze_result_t basic_leakChecker::ZEbasic_leakChecker::zeMemFreeExtEpilogue(ze_context_handle_t, const ze_memory_free_ext_desc_t*, void *ptr, ze_result_t result) {
         if (result == ZE_RESULT_SUCCESS) {
-            countFunctionCall("zeMemFreeExt");
+            countFunctionCall(zeMemFreeExt_);
+            context.releaseAllocationSite(ptr);
         }
         return result;
     }
 
-    void basic_leakChecker::ZEbasic_leakChecker::countFunctionCall(const std::string &functionName)
+    basic_leakChecker::ZEbasic_leakChecker::threadCounters &basic_leakChecker::ZEbasic_leakChecker::getThreadCounters()
     {
-        auto it = counts.find(functionName);
+        // Each thread registers its counter block once; when the thread exits the
+        // block is folded into retiredCounts and freed
+        struct threadCountersOwner {
+            ZEbasic_leakChecker *checker = nullptr;
+            threadCounters *counters = nullptr;
+            ~threadCountersOwner() {
+                if (checker && liveLeakChecker.load(std::memory_order_acquire) == checker)
+                    checker->retireThreadCounters(counters);
+            }
+        };
+        static thread_local threadCountersOwner owner;
+        if (owner.checker != this) {
+            std::lock_guard<std::mutex> lock(countersMutex);
+            allCounters.emplace_back(new threadCounters);
+            owner.counters = allCounters.back().get();
+            owner.checker = this;
+        }
+        return *owner.counters;
+    }
 
-        // make sure there is no insertion happening during program exeuction
-        // as inserting to the map is not thread safe
-        if (it == counts.end()) {
+    void basic_leakChecker::ZEbasic_leakChecker::retireThreadCounters(threadCounters *counters)
+    {
+        std::lock_guard<std::mutex> lock(countersMutex);
+        for (size_t i = 0; i < allCounters.size(); i++) {
+            if (allCounters[i].get() != counters)
+                continue;
+            for (size_t function = 0; function < countedFunctionCount; function++) {
+                retiredCounts[function] += counters->counts[function].load(std::memory_order_relaxed);
+            }
+            allCounters[i] = std::move(allCounters.back());
+            allCounters.pop_back();
             return;
         }
+    }
 
-        it->second.fetch_add(1, std::memory_order_relaxed);
+    void basic_leakChecker::ZEbasic_leakChecker::countFunctionCall(countedFunction function)
+    {
+        auto &count = getThreadCounters().counts[function];
+        count.store(count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    int64_t basic_leakChecker::ZEbasic_leakChecker::getTotal(countedFunction function)
+    {
+        std::lock_guard<std::mutex> lock(countersMutex);
+        int64_t total = retiredCounts[function];
+        for (const auto &counters : allCounters) {
+            total += counters->counts[function].load(std::memory_order_relaxed);
+        }
+        return total;
     }
 
     basic_leakChecker::ZEbasic_leakChecker::~ZEbasic_leakChecker() {
+        liveLeakChecker.store(nullptr, std::memory_order_release);
         std::cerr << "Check balance of create/destroy calls\n";
         std::cerr << "----------------------------------------------------------\n";
         auto set = createDestroySet();
@@ -293,8 +419,8 @@ namespace validation_layer
             auto &dtors = s.dtors;
             int64_t diff = 0;
             for (size_t i = 0; i < ctors.size(); i++) {
-                const auto& name = ctors[i];
-                auto zeCount = counts[name].load();
+                const auto name = countedFunctionNames[ctors[i]];
+                auto zeCount = getTotal(ctors[i]);
                 diff += zeCount;
 
                 if (i > 0) {
@@ -309,8 +435,8 @@ namespace validation_layer
             std::cerr << " \\--->";
 
             for (size_t i = 0; i < dtors.size(); i++) {
-                const auto& name = dtors[i];
-                auto zeCount = counts[name].load();
+                const auto name = countedFunctionNames[dtors[i]];
+                auto zeCount = getTotal(dtors[i]);
                 diff -= zeCount;
 
                 if (i > 0) {
@@ -325,6 +451,11 @@ namespace validation_layer
 
             if (diff) {
                 std::cerr << " ---> LEAK = " << diff;
+                auto &findings = validation_layer::context.getInstance().findings;
+                if (findings) {
+                    findings->report("basic_leak", countedFunctionNames[ctors[0]], findingSeverity::warning, nullptr,
+                                     [&]() { return "LEAK = " + std::to_string(diff); });
+                }
             }
 
             std::cerr << std::endl;
@@ -11,8 +11,9 @@
 #pragma once
 
 #include <atomic>
-#include <string>
-#include <unordered_map>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 #include "ze_api.h"
 #include "ze_validation_layer.h"
@@ -82,9 +83,61 @@ namespace validation_layer
                 ze_result_t zeMemFreeExtEpilogue(ze_context_handle_t, const ze_memory_free_ext_desc_t*, void *, ze_result_t result) override;
                 // Experimental function for Intel counter-based events
                 ze_result_t zexCounterBasedEventCreate2Epilogue(ze_context_handle_t, ze_device_handle_t, const void *, ze_event_handle_t *, ze_result_t result) override;
+
+                // One counter slot per tracked function, fixed at compile time
+                enum countedFunction : size_t {
+                    zeContextCreate_,
+                    zeContextDestroy_,
+                    zeCommandQueueCreate_,
+                    zeCommandQueueDestroy_,
+                    zeModuleCreate_,
+                    zeModuleDestroy_,
+                    zeKernelCreate_,
+                    zeKernelDestroy_,
+                    zeEventPoolCreate_,
+                    zeEventPoolDestroy_,
+                    zeCommandListCreateImmediate_,
+                    zeCommandListCreate_,
+                    zeCommandListDestroy_,
+                    zeEventCreate_,
+                    zexCounterBasedEventCreate2_,
+                    zeEventDestroy_,
+                    zeFenceCreate_,
+                    zeFenceDestroy_,
+                    zeImageCreate_,
+                    zeImageViewCreateExt_,
+                    zeImageDestroy_,
+                    zeSamplerCreate_,
+                    zeSamplerDestroy_,
+                    zeMemAllocDevice_,
+                    zeMemAllocHost_,
+                    zeMemAllocShared_,
+                    zeMemFree_,
+                    zeMemFreeExt_,
+                    countedFunctionCount
+                };
+
             private:
-                void countFunctionCall(const std::string &functionName);
-                std::unordered_map<std::string, std::atomic<int64_t>> counts;
+                // Counters owned by a single thread. Only the owning thread writes,
+                // so increments are a relaxed load/store rather than an atomic RMW.
+                // Blocks are cache line aligned so neighbouring blocks never share a line;
+                // C++14 new ignores over-alignment, so the class allocates them itself.
+                struct alignas(64) threadCounters {
+                    std::atomic<int64_t> counts[countedFunctionCount];
+                    threadCounters();
+                    static void *operator new(size_t size);
+                    static void operator delete(void *block);
+                };
+
+                void countFunctionCall(countedFunction function);
+                threadCounters &getThreadCounters();
+                void retireThreadCounters(threadCounters *counters);
+                int64_t getTotal(countedFunction function);
+
+                std::mutex countersMutex;
+                std::vector<std::unique_ptr<threadCounters>> allCounters;
+                // Counts folded in from threads that have exited
+                int64_t retiredCounts[countedFunctionCount] = {};
             };
 
             class ZESbasic_leakChecker : public ZESValidationEntryPoints {};
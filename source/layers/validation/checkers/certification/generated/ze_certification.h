@@ -9,1307 +9,879 @@
  *
  */
 #pragma once
-#include "../zel_global_certification_state.h"
-#include "ze_entry_points.h"
+#include "ze_ddi.h"
 
 namespace validation_layer {
-class ZEcertificationCheckerGenerated : public ZEValidationEntryPoints {
+// APIs newer than the certification version are redirected to an
+// Unsupported stub in the layer's DDI table; allowed APIs are left untouched.
+class ZEcertificationCheckerGenerated {
 public:
-    virtual ze_result_t zeInitPrologue( ze_init_flags_t flags ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeDriverGetPrologue( uint32_t* pCount, ze_driver_handle_t* phDrivers ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeInitDriversPrologue( uint32_t* pCount, ze_driver_handle_t* phDrivers, ze_init_driver_type_desc_t* desc ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_10) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeDriverGetApiVersionPrologue( ze_driver_handle_t hDriver, ze_api_version_t* version ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeDriverGetPropertiesPrologue( ze_driver_handle_t hDriver, ze_driver_properties_t* pDriverProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeDriverGetIpcPropertiesPrologue( ze_driver_handle_t hDriver, ze_driver_ipc_properties_t* pIpcProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeDriverGetExtensionPropertiesPrologue( ze_driver_handle_t hDriver, uint32_t* pCount, ze_driver_extension_properties_t* pExtensionProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeDriverGetExtensionFunctionAddressPrologue( ze_driver_handle_t hDriver, const char* name, void** ppFunctionAddress ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_1) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeDriverGetLastErrorDescriptionPrologue( ze_driver_handle_t hDriver, const char** ppString ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_6) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeDriverGetDefaultContextPrologue( ze_driver_handle_t hDriver ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_14) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeDeviceGetPrologue( ze_driver_handle_t hDriver, uint32_t* pCount, ze_device_handle_t* phDevices ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeDeviceGetRootDevicePrologue( ze_device_handle_t hDevice, ze_device_handle_t* phRootDevice ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_7) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeDeviceGetSubDevicesPrologue( ze_device_handle_t hDevice, uint32_t* pCount, ze_device_handle_t* phSubdevices ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeDeviceGetPropertiesPrologue( ze_device_handle_t hDevice, ze_device_properties_t* pDeviceProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeDeviceGetComputePropertiesPrologue( ze_device_handle_t hDevice, ze_device_compute_properties_t* pComputeProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeDeviceGetModulePropertiesPrologue( ze_device_handle_t hDevice, ze_device_module_properties_t* pModuleProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeDeviceGetCommandQueueGroupPropertiesPrologue( ze_device_handle_t hDevice, uint32_t* pCount, ze_command_queue_group_properties_t* pCommandQueueGroupProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeDeviceGetMemoryPropertiesPrologue( ze_device_handle_t hDevice, uint32_t* pCount, ze_device_memory_properties_t* pMemProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeDeviceGetMemoryAccessPropertiesPrologue( ze_device_handle_t hDevice, ze_device_memory_access_properties_t* pMemAccessProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeDeviceGetCachePropertiesPrologue( ze_device_handle_t hDevice, uint32_t* pCount, ze_device_cache_properties_t* pCacheProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeDeviceGetImagePropertiesPrologue( ze_device_handle_t hDevice, ze_device_image_properties_t* pImageProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeDeviceGetExternalMemoryPropertiesPrologue( ze_device_handle_t hDevice, ze_device_external_memory_properties_t* pExternalMemoryProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeDeviceGetP2PPropertiesPrologue( ze_device_handle_t hDevice, ze_device_handle_t hPeerDevice, ze_device_p2p_properties_t* pP2PProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeDeviceCanAccessPeerPrologue( ze_device_handle_t hDevice, ze_device_handle_t hPeerDevice, ze_bool_t* value ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeDeviceGetStatusPrologue( ze_device_handle_t hDevice ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeDeviceGetGlobalTimestampsPrologue( ze_device_handle_t hDevice, uint64_t* hostTimestamp, uint64_t* deviceTimestamp ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_1) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeDeviceSynchronizePrologue( ze_device_handle_t hDevice ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_14) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeDeviceGetAggregatedCopyOffloadIncrementValuePrologue( ze_device_handle_t hDevice, uint32_t* incrementValue ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_15) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeContextCreatePrologue( ze_driver_handle_t hDriver, const ze_context_desc_t* desc, ze_context_handle_t* phContext ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeContextCreateExPrologue( ze_driver_handle_t hDriver, const ze_context_desc_t* desc, uint32_t numDevices, ze_device_handle_t* phDevices, ze_context_handle_t* phContext ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_1) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeContextDestroyPrologue( ze_context_handle_t hContext ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeContextGetStatusPrologue( ze_context_handle_t hContext ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeCommandQueueCreatePrologue( ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_command_queue_desc_t* desc, ze_command_queue_handle_t* phCommandQueue ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeCommandQueueDestroyPrologue( ze_command_queue_handle_t hCommandQueue ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeCommandQueueExecuteCommandListsPrologue( ze_command_queue_handle_t hCommandQueue, uint32_t numCommandLists, ze_command_list_handle_t* phCommandLists, ze_fence_handle_t hFence ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeCommandQueueSynchronizePrologue( ze_command_queue_handle_t hCommandQueue, uint64_t timeout ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeCommandQueueGetOrdinalPrologue( ze_command_queue_handle_t hCommandQueue, uint32_t* pOrdinal ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_9) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeCommandQueueGetIndexPrologue( ze_command_queue_handle_t hCommandQueue, uint32_t* pIndex ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_9) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeCommandListCreatePrologue( ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_command_list_desc_t* desc, ze_command_list_handle_t* phCommandList ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeCommandListCreateImmediatePrologue( ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_command_queue_desc_t* altdesc, ze_command_list_handle_t* phCommandList ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeCommandListDestroyPrologue( ze_command_list_handle_t hCommandList ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeCommandListClosePrologue( ze_command_list_handle_t hCommandList ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeCommandListResetPrologue( ze_command_list_handle_t hCommandList ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeCommandListAppendWriteGlobalTimestampPrologue( ze_command_list_handle_t hCommandList, uint64_t* dstptr, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeCommandListHostSynchronizePrologue( ze_command_list_handle_t hCommandList, uint64_t timeout ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_6) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeCommandListGetDeviceHandlePrologue( ze_command_list_handle_t hCommandList, ze_device_handle_t* phDevice ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_9) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeCommandListGetContextHandlePrologue( ze_command_list_handle_t hCommandList, ze_context_handle_t* phContext ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_9) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeCommandListGetOrdinalPrologue( ze_command_list_handle_t hCommandList, uint32_t* pOrdinal ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_9) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeCommandListImmediateGetIndexPrologue( ze_command_list_handle_t hCommandListImmediate, uint32_t* pIndex ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_9) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeCommandListIsImmediatePrologue( ze_command_list_handle_t hCommandList, ze_bool_t* pIsImmediate ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_9) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeCommandListAppendBarrierPrologue( ze_command_list_handle_t hCommandList, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeCommandListAppendMemoryRangesBarrierPrologue( ze_command_list_handle_t hCommandList, uint32_t numRanges, const size_t* pRangeSizes, const void** pRanges, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeContextSystemBarrierPrologue( ze_context_handle_t hContext, ze_device_handle_t hDevice ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeCommandListAppendMemoryCopyPrologue( ze_command_list_handle_t hCommandList, void* dstptr, const void* srcptr, size_t size, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeCommandListAppendMemoryFillPrologue( ze_command_list_handle_t hCommandList, void* ptr, const void* pattern, size_t pattern_size, size_t size, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeCommandListAppendMemoryCopyRegionPrologue( ze_command_list_handle_t hCommandList, void* dstptr, const ze_copy_region_t* dstRegion, uint32_t dstPitch, uint32_t dstSlicePitch, const void* srcptr, const ze_copy_region_t* srcRegion, uint32_t srcPitch, uint32_t srcSlicePitch, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeCommandListAppendMemoryCopyFromContextPrologue( ze_command_list_handle_t hCommandList, void* dstptr, ze_context_handle_t hContextSrc, const void* srcptr, size_t size, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeCommandListAppendImageCopyPrologue( ze_command_list_handle_t hCommandList, ze_image_handle_t hDstImage, ze_image_handle_t hSrcImage, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeCommandListAppendImageCopyRegionPrologue( ze_command_list_handle_t hCommandList, ze_image_handle_t hDstImage, ze_image_handle_t hSrcImage, const ze_image_region_t* pDstRegion, const ze_image_region_t* pSrcRegion, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeCommandListAppendImageCopyToMemoryPrologue( ze_command_list_handle_t hCommandList, void* dstptr, ze_image_handle_t hSrcImage, const ze_image_region_t* pSrcRegion, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeCommandListAppendImageCopyFromMemoryPrologue( ze_command_list_handle_t hCommandList, ze_image_handle_t hDstImage, const void* srcptr, const ze_image_region_t* pDstRegion, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeCommandListAppendMemoryPrefetchPrologue( ze_command_list_handle_t hCommandList, const void* ptr, size_t size ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeCommandListAppendMemAdvisePrologue( ze_command_list_handle_t hCommandList, ze_device_handle_t hDevice, const void* ptr, size_t size, ze_memory_advice_t advice ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeEventPoolCreatePrologue( ze_context_handle_t hContext, const ze_event_pool_desc_t* desc, uint32_t numDevices, ze_device_handle_t* phDevices, ze_event_pool_handle_t* phEventPool ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeEventPoolDestroyPrologue( ze_event_pool_handle_t hEventPool ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeEventCreatePrologue( ze_event_pool_handle_t hEventPool, const ze_event_desc_t* desc, ze_event_handle_t* phEvent ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeEventCounterBasedCreatePrologue( ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_event_counter_based_desc_t* desc, ze_event_handle_t* phEvent ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_15) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeEventDestroyPrologue( ze_event_handle_t hEvent ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeEventPoolGetIpcHandlePrologue( ze_event_pool_handle_t hEventPool, ze_ipc_event_pool_handle_t* phIpc ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeEventPoolPutIpcHandlePrologue( ze_context_handle_t hContext, ze_ipc_event_pool_handle_t hIpc ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_6) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeEventPoolOpenIpcHandlePrologue( ze_context_handle_t hContext, ze_ipc_event_pool_handle_t hIpc, ze_event_pool_handle_t* phEventPool ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeEventPoolCloseIpcHandlePrologue( ze_event_pool_handle_t hEventPool ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeEventCounterBasedGetIpcHandlePrologue( ze_event_handle_t hEvent, ze_ipc_event_counter_based_handle_t* phIpc ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_15) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeEventCounterBasedOpenIpcHandlePrologue( ze_context_handle_t hContext, ze_ipc_event_counter_based_handle_t hIpc, ze_event_handle_t* phEvent ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_15) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeEventCounterBasedCloseIpcHandlePrologue( ze_event_handle_t hEvent ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_15) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeEventCounterBasedGetDeviceAddressPrologue( ze_event_handle_t hEvent, uint64_t* completionValue, uint64_t* deviceAddress ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_15) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeCommandListAppendSignalEventPrologue( ze_command_list_handle_t hCommandList, ze_event_handle_t hEvent ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeCommandListAppendWaitOnEventsPrologue( ze_command_list_handle_t hCommandList, uint32_t numEvents, ze_event_handle_t* phEvents ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeEventHostSignalPrologue( ze_event_handle_t hEvent ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeEventHostSynchronizePrologue( ze_event_handle_t hEvent, uint64_t timeout ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeEventQueryStatusPrologue( ze_event_handle_t hEvent ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeCommandListAppendEventResetPrologue( ze_command_list_handle_t hCommandList, ze_event_handle_t hEvent ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeEventHostResetPrologue( ze_event_handle_t hEvent ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeEventQueryKernelTimestampPrologue( ze_event_handle_t hEvent, ze_kernel_timestamp_result_t* dstptr ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeCommandListAppendQueryKernelTimestampsPrologue( ze_command_list_handle_t hCommandList, uint32_t numEvents, ze_event_handle_t* phEvents, void* dstptr, const size_t* pOffsets, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeEventGetEventPoolPrologue( ze_event_handle_t hEvent, ze_event_pool_handle_t* phEventPool ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_9) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeEventGetSignalScopePrologue( ze_event_handle_t hEvent, ze_event_scope_flags_t* pSignalScope ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_9) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeEventGetWaitScopePrologue( ze_event_handle_t hEvent, ze_event_scope_flags_t* pWaitScope ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_9) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeEventPoolGetContextHandlePrologue( ze_event_pool_handle_t hEventPool, ze_context_handle_t* phContext ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_9) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeEventPoolGetFlagsPrologue( ze_event_pool_handle_t hEventPool, ze_event_pool_flags_t* pFlags ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_9) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeFenceCreatePrologue( ze_command_queue_handle_t hCommandQueue, const ze_fence_desc_t* desc, ze_fence_handle_t* phFence ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeFenceDestroyPrologue( ze_fence_handle_t hFence ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeFenceHostSynchronizePrologue( ze_fence_handle_t hFence, uint64_t timeout ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeFenceQueryStatusPrologue( ze_fence_handle_t hFence ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeFenceResetPrologue( ze_fence_handle_t hFence ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeImageGetPropertiesPrologue( ze_device_handle_t hDevice, const ze_image_desc_t* desc, ze_image_properties_t* pImageProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeImageCreatePrologue( ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_image_desc_t* desc, ze_image_handle_t* phImage ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeImageDestroyPrologue( ze_image_handle_t hImage ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeMemAllocSharedPrologue( ze_context_handle_t hContext, const ze_device_mem_alloc_desc_t* device_desc, const ze_host_mem_alloc_desc_t* host_desc, size_t size, size_t alignment, ze_device_handle_t hDevice, void** pptr ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeMemAllocDevicePrologue( ze_context_handle_t hContext, const ze_device_mem_alloc_desc_t* device_desc, size_t size, size_t alignment, ze_device_handle_t hDevice, void** pptr ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeMemAllocHostPrologue( ze_context_handle_t hContext, const ze_host_mem_alloc_desc_t* host_desc, size_t size, size_t alignment, void** pptr ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeMemFreePrologue( ze_context_handle_t hContext, void* ptr ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeMemGetAllocPropertiesPrologue( ze_context_handle_t hContext, const void* ptr, ze_memory_allocation_properties_t* pMemAllocProperties, ze_device_handle_t* phDevice ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeMemGetAddressRangePrologue( ze_context_handle_t hContext, const void* ptr, void** pBase, size_t* pSize ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeMemGetIpcHandlePrologue( ze_context_handle_t hContext, const void* ptr, ze_ipc_mem_handle_t* pIpcHandle ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeMemGetIpcHandleFromFileDescriptorExpPrologue( ze_context_handle_t hContext, uint64_t handle, ze_ipc_mem_handle_t* pIpcHandle ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_6) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeMemGetFileDescriptorFromIpcHandleExpPrologue( ze_context_handle_t hContext, ze_ipc_mem_handle_t ipcHandle, uint64_t* pHandle ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_6) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeMemPutIpcHandlePrologue( ze_context_handle_t hContext, ze_ipc_mem_handle_t handle ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_6) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeMemOpenIpcHandlePrologue( ze_context_handle_t hContext, ze_device_handle_t hDevice, ze_ipc_mem_handle_t handle, ze_ipc_memory_flags_t flags, void** pptr ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeMemCloseIpcHandlePrologue( ze_context_handle_t hContext, const void* ptr ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeMemSetAtomicAccessAttributeExpPrologue( ze_context_handle_t hContext, ze_device_handle_t hDevice, const void* ptr, size_t size, ze_memory_atomic_attr_exp_flags_t attr ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_7) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeMemGetAtomicAccessAttributeExpPrologue( ze_context_handle_t hContext, ze_device_handle_t hDevice, const void* ptr, size_t size, ze_memory_atomic_attr_exp_flags_t* pAttr ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_7) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeModuleCreatePrologue( ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_module_desc_t* desc, ze_module_handle_t* phModule, ze_module_build_log_handle_t* phBuildLog ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeModuleDestroyPrologue( ze_module_handle_t hModule ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeModuleDynamicLinkPrologue( uint32_t numModules, ze_module_handle_t* phModules, ze_module_build_log_handle_t* phLinkLog ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeModuleBuildLogDestroyPrologue( ze_module_build_log_handle_t hModuleBuildLog ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeModuleBuildLogGetStringPrologue( ze_module_build_log_handle_t hModuleBuildLog, size_t* pSize, char* pBuildLog ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeModuleGetNativeBinaryPrologue( ze_module_handle_t hModule, size_t* pSize, uint8_t* pModuleNativeBinary ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeModuleGetGlobalPointerPrologue( ze_module_handle_t hModule, const char* pGlobalName, size_t* pSize, void** pptr ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeModuleGetKernelNamesPrologue( ze_module_handle_t hModule, uint32_t* pCount, const char** pNames ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeModuleGetPropertiesPrologue( ze_module_handle_t hModule, ze_module_properties_t* pModuleProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeKernelCreatePrologue( ze_module_handle_t hModule, const ze_kernel_desc_t* desc, ze_kernel_handle_t* phKernel ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeKernelDestroyPrologue( ze_kernel_handle_t hKernel ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeModuleGetFunctionPointerPrologue( ze_module_handle_t hModule, const char* pFunctionName, void** pfnFunction ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeKernelSetGroupSizePrologue( ze_kernel_handle_t hKernel, uint32_t groupSizeX, uint32_t groupSizeY, uint32_t groupSizeZ ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeKernelSuggestGroupSizePrologue( ze_kernel_handle_t hKernel, uint32_t globalSizeX, uint32_t globalSizeY, uint32_t globalSizeZ, uint32_t* groupSizeX, uint32_t* groupSizeY, uint32_t* groupSizeZ ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeKernelSuggestMaxCooperativeGroupCountPrologue( ze_kernel_handle_t hKernel, uint32_t* totalGroupCount ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeKernelSetArgumentValuePrologue( ze_kernel_handle_t hKernel, uint32_t argIndex, size_t argSize, const void* pArgValue ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeKernelSetIndirectAccessPrologue( ze_kernel_handle_t hKernel, ze_kernel_indirect_access_flags_t flags ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeKernelGetIndirectAccessPrologue( ze_kernel_handle_t hKernel, ze_kernel_indirect_access_flags_t* pFlags ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeKernelGetSourceAttributesPrologue( ze_kernel_handle_t hKernel, uint32_t* pSize, char** pString ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeKernelSetCacheConfigPrologue( ze_kernel_handle_t hKernel, ze_cache_config_flags_t flags ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeKernelGetPropertiesPrologue( ze_kernel_handle_t hKernel, ze_kernel_properties_t* pKernelProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeKernelGetNamePrologue( ze_kernel_handle_t hKernel, size_t* pSize, char* pName ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeCommandListAppendLaunchKernelPrologue( ze_command_list_handle_t hCommandList, ze_kernel_handle_t hKernel, const ze_group_count_t* pLaunchFuncArgs, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeCommandListAppendLaunchKernelWithParametersPrologue( ze_command_list_handle_t hCommandList, ze_kernel_handle_t hKernel, const ze_group_count_t* pGroupCounts, const void * pNext, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_14) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeCommandListAppendLaunchKernelWithArgumentsPrologue( ze_command_list_handle_t hCommandList, ze_kernel_handle_t hKernel, const ze_group_count_t groupCounts, const ze_group_size_t groupSizes, void ** pArguments, const void * pNext, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_14) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeCommandListAppendLaunchCooperativeKernelPrologue( ze_command_list_handle_t hCommandList, ze_kernel_handle_t hKernel, const ze_group_count_t* pLaunchFuncArgs, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeCommandListAppendLaunchKernelIndirectPrologue( ze_command_list_handle_t hCommandList, ze_kernel_handle_t hKernel, const ze_group_count_t* pLaunchArgumentsBuffer, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeCommandListAppendLaunchMultipleKernelsIndirectPrologue( ze_command_list_handle_t hCommandList, uint32_t numKernels, ze_kernel_handle_t* phKernels, const uint32_t* pCountBuffer, const ze_group_count_t* pLaunchArgumentsBuffer, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeContextMakeMemoryResidentPrologue( ze_context_handle_t hContext, ze_device_handle_t hDevice, void* ptr, size_t size ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeContextEvictMemoryPrologue( ze_context_handle_t hContext, ze_device_handle_t hDevice, void* ptr, size_t size ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeContextMakeImageResidentPrologue( ze_context_handle_t hContext, ze_device_handle_t hDevice, ze_image_handle_t hImage ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeContextEvictImagePrologue( ze_context_handle_t hContext, ze_device_handle_t hDevice, ze_image_handle_t hImage ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeSamplerCreatePrologue( ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_sampler_desc_t* desc, ze_sampler_handle_t* phSampler ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeSamplerDestroyPrologue( ze_sampler_handle_t hSampler ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeVirtualMemReservePrologue( ze_context_handle_t hContext, const void* pStart, size_t size, void** pptr ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeVirtualMemFreePrologue( ze_context_handle_t hContext, const void* ptr, size_t size ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeVirtualMemQueryPageSizePrologue( ze_context_handle_t hContext, ze_device_handle_t hDevice, size_t size, size_t* pagesize ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zePhysicalMemGetPropertiesPrologue( ze_context_handle_t hContext, ze_physical_mem_handle_t hPhysicalMem, ze_physical_mem_properties_t* pMemProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_15) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zePhysicalMemCreatePrologue( ze_context_handle_t hContext, ze_device_handle_t hDevice, ze_physical_mem_desc_t* desc, ze_physical_mem_handle_t* phPhysicalMemory ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zePhysicalMemDestroyPrologue( ze_context_handle_t hContext, ze_physical_mem_handle_t hPhysicalMemory ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeVirtualMemMapPrologue( ze_context_handle_t hContext, const void* ptr, size_t size, ze_physical_mem_handle_t hPhysicalMemory, size_t offset, ze_memory_access_attribute_t access ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeVirtualMemUnmapPrologue( ze_context_handle_t hContext, const void* ptr, size_t size ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeVirtualMemSetAccessAttributePrologue( ze_context_handle_t hContext, const void* ptr, size_t size, ze_memory_access_attribute_t access ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeVirtualMemGetAccessAttributePrologue( ze_context_handle_t hContext, const void* ptr, size_t size, ze_memory_access_attribute_t* access, size_t* outSize ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeKernelSetGlobalOffsetExpPrologue( ze_kernel_handle_t hKernel, uint32_t offsetX, uint32_t offsetY, uint32_t offsetZ ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_1) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeKernelGetBinaryExpPrologue( ze_kernel_handle_t hKernel, size_t* pSize, uint8_t* pKernelBinary ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_11) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeDeviceImportExternalSemaphoreExtPrologue( ze_device_handle_t hDevice, const ze_external_semaphore_ext_desc_t* desc, ze_external_semaphore_ext_handle_t* phSemaphore ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_12) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeDeviceReleaseExternalSemaphoreExtPrologue( ze_external_semaphore_ext_handle_t hSemaphore ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_12) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeCommandListAppendSignalExternalSemaphoreExtPrologue( ze_command_list_handle_t hCommandList, uint32_t numSemaphores, ze_external_semaphore_ext_handle_t* phSemaphores, ze_external_semaphore_signal_params_ext_t* signalParams, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_12) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeCommandListAppendWaitExternalSemaphoreExtPrologue( ze_command_list_handle_t hCommandList, uint32_t numSemaphores, ze_external_semaphore_ext_handle_t* phSemaphores, ze_external_semaphore_wait_params_ext_t* waitParams, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_12) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeRTASBuilderCreateExtPrologue( ze_driver_handle_t hDriver, const ze_rtas_builder_ext_desc_t* pDescriptor, ze_rtas_builder_ext_handle_t* phBuilder ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_13) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeRTASBuilderGetBuildPropertiesExtPrologue( ze_rtas_builder_ext_handle_t hBuilder, const ze_rtas_builder_build_op_ext_desc_t* pBuildOpDescriptor, ze_rtas_builder_ext_properties_t* pProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_13) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeDriverRTASFormatCompatibilityCheckExtPrologue( ze_driver_handle_t hDriver, ze_rtas_format_ext_t rtasFormatA, ze_rtas_format_ext_t rtasFormatB ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_13) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeRTASBuilderBuildExtPrologue( ze_rtas_builder_ext_handle_t hBuilder, const ze_rtas_builder_build_op_ext_desc_t* pBuildOpDescriptor, void* pScratchBuffer, size_t scratchBufferSizeBytes, void* pRtasBuffer, size_t rtasBufferSizeBytes, ze_rtas_parallel_operation_ext_handle_t hParallelOperation, void* pBuildUserPtr, ze_rtas_aabb_ext_t* pBounds, size_t* pRtasBufferSizeBytes ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_13) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeRTASBuilderCommandListAppendCopyExtPrologue( ze_command_list_handle_t hCommandList, void* dstptr, const void* srcptr, size_t size, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_13) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeRTASBuilderDestroyExtPrologue( ze_rtas_builder_ext_handle_t hBuilder ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_13) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeRTASParallelOperationCreateExtPrologue( ze_driver_handle_t hDriver, ze_rtas_parallel_operation_ext_handle_t* phParallelOperation ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_13) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeRTASParallelOperationGetPropertiesExtPrologue( ze_rtas_parallel_operation_ext_handle_t hParallelOperation, ze_rtas_parallel_operation_ext_properties_t* pProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_13) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeRTASParallelOperationJoinExtPrologue( ze_rtas_parallel_operation_ext_handle_t hParallelOperation ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_13) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeRTASParallelOperationDestroyExtPrologue( ze_rtas_parallel_operation_ext_handle_t hParallelOperation ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_13) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeDeviceGetVectorWidthPropertiesExtPrologue( ze_device_handle_t hDevice, uint32_t* pCount, ze_device_vector_width_properties_ext_t* pVectorWidthProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_13) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeKernelGetAllocationPropertiesExpPrologue( ze_kernel_handle_t hKernel, uint32_t* pCount, ze_kernel_allocation_exp_properties_t* pAllocationProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_14) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeMemGetIpcHandleWithPropertiesPrologue( ze_context_handle_t hContext, const void* ptr, void* pNext, ze_ipc_mem_handle_t* pIpcHandle ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_15) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeDeviceReserveCacheExtPrologue( ze_device_handle_t hDevice, size_t cacheLevel, size_t cacheReservationSize ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_2) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeDeviceSetCacheAdviceExtPrologue( ze_device_handle_t hDevice, void* ptr, size_t regionSize, ze_cache_ext_region_t cacheRegion ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_2) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeEventQueryTimestampsExpPrologue( ze_event_handle_t hEvent, ze_device_handle_t hDevice, uint32_t* pCount, ze_kernel_timestamp_result_t* pTimestamps ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_2) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeImageGetMemoryPropertiesExpPrologue( ze_image_handle_t hImage, ze_image_memory_properties_exp_t* pMemoryProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_2) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeImageViewCreateExtPrologue( ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_image_desc_t* desc, ze_image_handle_t hImage, ze_image_handle_t* phImageView ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_5) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeImageViewCreateExpPrologue( ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_image_desc_t* desc, ze_image_handle_t hImage, ze_image_handle_t* phImageView ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_2) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeKernelSchedulingHintExpPrologue( ze_kernel_handle_t hKernel, ze_scheduling_hint_exp_desc_t* pHint ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_2) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeDevicePciGetPropertiesExtPrologue( ze_device_handle_t hDevice, ze_pci_ext_properties_t* pPciProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_3) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeCommandListAppendImageCopyToMemoryExtPrologue( ze_command_list_handle_t hCommandList, void* dstptr, ze_image_handle_t hSrcImage, const ze_image_region_t* pSrcRegion, uint32_t destRowPitch, uint32_t destSlicePitch, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_3) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeCommandListAppendImageCopyFromMemoryExtPrologue( ze_command_list_handle_t hCommandList, ze_image_handle_t hDstImage, const void* srcptr, const ze_image_region_t* pDstRegion, uint32_t srcRowPitch, uint32_t srcSlicePitch, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_3) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeImageGetAllocPropertiesExtPrologue( ze_context_handle_t hContext, ze_image_handle_t hImage, ze_image_allocation_ext_properties_t* pImageAllocProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_3) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeModuleInspectLinkageExtPrologue( ze_linkage_inspection_ext_desc_t* pInspectDesc, uint32_t numModules, ze_module_handle_t* phModules, ze_module_build_log_handle_t* phLog ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_3) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeMemFreeExtPrologue( ze_context_handle_t hContext, const ze_memory_free_ext_desc_t* pMemFreeDesc, void* ptr ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_3) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeFabricVertexGetExpPrologue( ze_driver_handle_t hDriver, uint32_t* pCount, ze_fabric_vertex_handle_t* phVertices ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_4) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeFabricVertexGetSubVerticesExpPrologue( ze_fabric_vertex_handle_t hVertex, uint32_t* pCount, ze_fabric_vertex_handle_t* phSubvertices ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_4) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeFabricVertexGetPropertiesExpPrologue( ze_fabric_vertex_handle_t hVertex, ze_fabric_vertex_exp_properties_t* pVertexProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_4) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeFabricVertexGetDeviceExpPrologue( ze_fabric_vertex_handle_t hVertex, ze_device_handle_t* phDevice ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_4) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeDeviceGetFabricVertexExpPrologue( ze_device_handle_t hDevice, ze_fabric_vertex_handle_t* phVertex ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_4) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeFabricEdgeGetExpPrologue( ze_fabric_vertex_handle_t hVertexA, ze_fabric_vertex_handle_t hVertexB, uint32_t* pCount, ze_fabric_edge_handle_t* phEdges ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_4) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeFabricEdgeGetVerticesExpPrologue( ze_fabric_edge_handle_t hEdge, ze_fabric_vertex_handle_t* phVertexA, ze_fabric_vertex_handle_t* phVertexB ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_4) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeFabricEdgeGetPropertiesExpPrologue( ze_fabric_edge_handle_t hEdge, ze_fabric_edge_exp_properties_t* pEdgeProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_4) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeEventQueryKernelTimestampsExtPrologue( ze_event_handle_t hEvent, ze_device_handle_t hDevice, uint32_t* pCount, ze_event_query_kernel_timestamps_results_ext_properties_t* pResults ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_6) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeRTASBuilderCreateExpPrologue( ze_driver_handle_t hDriver, const ze_rtas_builder_exp_desc_t* pDescriptor, ze_rtas_builder_exp_handle_t* phBuilder ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_7) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeRTASBuilderGetBuildPropertiesExpPrologue( ze_rtas_builder_exp_handle_t hBuilder, const ze_rtas_builder_build_op_exp_desc_t* pBuildOpDescriptor, ze_rtas_builder_exp_properties_t* pProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_7) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeDriverRTASFormatCompatibilityCheckExpPrologue( ze_driver_handle_t hDriver, ze_rtas_format_exp_t rtasFormatA, ze_rtas_format_exp_t rtasFormatB ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_7) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeRTASBuilderBuildExpPrologue( ze_rtas_builder_exp_handle_t hBuilder, const ze_rtas_builder_build_op_exp_desc_t* pBuildOpDescriptor, void* pScratchBuffer, size_t scratchBufferSizeBytes, void* pRtasBuffer, size_t rtasBufferSizeBytes, ze_rtas_parallel_operation_exp_handle_t hParallelOperation, void* pBuildUserPtr, ze_rtas_aabb_exp_t* pBounds, size_t* pRtasBufferSizeBytes ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_7) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeRTASBuilderDestroyExpPrologue( ze_rtas_builder_exp_handle_t hBuilder ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_7) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeRTASParallelOperationCreateExpPrologue( ze_driver_handle_t hDriver, ze_rtas_parallel_operation_exp_handle_t* phParallelOperation ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_7) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeRTASParallelOperationGetPropertiesExpPrologue( ze_rtas_parallel_operation_exp_handle_t hParallelOperation, ze_rtas_parallel_operation_exp_properties_t* pProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_7) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeRTASParallelOperationJoinExpPrologue( ze_rtas_parallel_operation_exp_handle_t hParallelOperation ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_7) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeRTASParallelOperationDestroyExpPrologue( ze_rtas_parallel_operation_exp_handle_t hParallelOperation ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_7) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeMemGetPitchFor2dImagePrologue( ze_context_handle_t hContext, ze_device_handle_t hDevice, size_t imageWidth, size_t imageHeight, unsigned int elementSizeInBytes, size_t * rowPitch ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_9) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeImageGetDeviceOffsetExpPrologue( ze_image_handle_t hImage, uint64_t* pDeviceOffset ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_9) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeCommandListCreateCloneExpPrologue( ze_command_list_handle_t hCommandList, ze_command_list_handle_t* phClonedCommandList ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_9) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeCommandListImmediateAppendCommandListsExpPrologue( ze_command_list_handle_t hCommandListImmediate, uint32_t numCommandLists, ze_command_list_handle_t* phCommandLists, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_9) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeCommandListGetNextCommandIdExpPrologue( ze_command_list_handle_t hCommandList, const ze_mutable_command_id_exp_desc_t* desc, uint64_t* pCommandId ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_9) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeCommandListGetNextCommandIdWithKernelsExpPrologue( ze_command_list_handle_t hCommandList, const ze_mutable_command_id_exp_desc_t* desc, uint32_t numKernels, ze_kernel_handle_t* phKernels, uint64_t* pCommandId ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_10) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeCommandListUpdateMutableCommandsExpPrologue( ze_command_list_handle_t hCommandList, const ze_mutable_commands_exp_desc_t* desc ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_9) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeCommandListUpdateMutableCommandSignalEventExpPrologue( ze_command_list_handle_t hCommandList, uint64_t commandId, ze_event_handle_t hSignalEvent ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_9) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeCommandListUpdateMutableCommandWaitEventsExpPrologue( ze_command_list_handle_t hCommandList, uint64_t commandId, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_9) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zeCommandListUpdateMutableCommandKernelsExpPrologue( ze_command_list_handle_t hCommandList, uint32_t numKernels, uint64_t* pCommandId, ze_kernel_handle_t* phKernels ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_10) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
+    static ze_result_t ZE_APICALL zeInitUnsupported( ze_init_flags_t flags ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeDriverGetUnsupported( uint32_t* pCount, ze_driver_handle_t* phDrivers ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeInitDriversUnsupported( uint32_t* pCount, ze_driver_handle_t* phDrivers, ze_init_driver_type_desc_t* desc ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeDriverGetApiVersionUnsupported( ze_driver_handle_t hDriver, ze_api_version_t* version ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeDriverGetPropertiesUnsupported( ze_driver_handle_t hDriver, ze_driver_properties_t* pDriverProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeDriverGetIpcPropertiesUnsupported( ze_driver_handle_t hDriver, ze_driver_ipc_properties_t* pIpcProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeDriverGetExtensionPropertiesUnsupported( ze_driver_handle_t hDriver, uint32_t* pCount, ze_driver_extension_properties_t* pExtensionProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeDriverGetExtensionFunctionAddressUnsupported( ze_driver_handle_t hDriver, const char* name, void** ppFunctionAddress ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeDriverGetLastErrorDescriptionUnsupported( ze_driver_handle_t hDriver, const char** ppString ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_context_handle_t ZE_APICALL zeDriverGetDefaultContextUnsupported( ze_driver_handle_t hDriver ) {
+        return nullptr;
+    }
+    static ze_result_t ZE_APICALL zeDeviceGetUnsupported( ze_driver_handle_t hDriver, uint32_t* pCount, ze_device_handle_t* phDevices ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeDeviceGetRootDeviceUnsupported( ze_device_handle_t hDevice, ze_device_handle_t* phRootDevice ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeDeviceGetSubDevicesUnsupported( ze_device_handle_t hDevice, uint32_t* pCount, ze_device_handle_t* phSubdevices ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeDeviceGetPropertiesUnsupported( ze_device_handle_t hDevice, ze_device_properties_t* pDeviceProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeDeviceGetComputePropertiesUnsupported( ze_device_handle_t hDevice, ze_device_compute_properties_t* pComputeProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeDeviceGetModulePropertiesUnsupported( ze_device_handle_t hDevice, ze_device_module_properties_t* pModuleProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeDeviceGetCommandQueueGroupPropertiesUnsupported( ze_device_handle_t hDevice, uint32_t* pCount, ze_command_queue_group_properties_t* pCommandQueueGroupProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeDeviceGetMemoryPropertiesUnsupported( ze_device_handle_t hDevice, uint32_t* pCount, ze_device_memory_properties_t* pMemProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeDeviceGetMemoryAccessPropertiesUnsupported( ze_device_handle_t hDevice, ze_device_memory_access_properties_t* pMemAccessProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeDeviceGetCachePropertiesUnsupported( ze_device_handle_t hDevice, uint32_t* pCount, ze_device_cache_properties_t* pCacheProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeDeviceGetImagePropertiesUnsupported( ze_device_handle_t hDevice, ze_device_image_properties_t* pImageProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeDeviceGetExternalMemoryPropertiesUnsupported( ze_device_handle_t hDevice, ze_device_external_memory_properties_t* pExternalMemoryProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeDeviceGetP2PPropertiesUnsupported( ze_device_handle_t hDevice, ze_device_handle_t hPeerDevice, ze_device_p2p_properties_t* pP2PProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeDeviceCanAccessPeerUnsupported( ze_device_handle_t hDevice, ze_device_handle_t hPeerDevice, ze_bool_t* value ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeDeviceGetStatusUnsupported( ze_device_handle_t hDevice ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeDeviceGetGlobalTimestampsUnsupported( ze_device_handle_t hDevice, uint64_t* hostTimestamp, uint64_t* deviceTimestamp ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeDeviceSynchronizeUnsupported( ze_device_handle_t hDevice ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeDeviceGetAggregatedCopyOffloadIncrementValueUnsupported( ze_device_handle_t hDevice, uint32_t* incrementValue ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeContextCreateUnsupported( ze_driver_handle_t hDriver, const ze_context_desc_t* desc, ze_context_handle_t* phContext ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeContextCreateExUnsupported( ze_driver_handle_t hDriver, const ze_context_desc_t* desc, uint32_t numDevices, ze_device_handle_t* phDevices, ze_context_handle_t* phContext ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeContextDestroyUnsupported( ze_context_handle_t hContext ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeContextGetStatusUnsupported( ze_context_handle_t hContext ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeCommandQueueCreateUnsupported( ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_command_queue_desc_t* desc, ze_command_queue_handle_t* phCommandQueue ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeCommandQueueDestroyUnsupported( ze_command_queue_handle_t hCommandQueue ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeCommandQueueExecuteCommandListsUnsupported( ze_command_queue_handle_t hCommandQueue, uint32_t numCommandLists, ze_command_list_handle_t* phCommandLists, ze_fence_handle_t hFence ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeCommandQueueSynchronizeUnsupported( ze_command_queue_handle_t hCommandQueue, uint64_t timeout ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeCommandQueueGetOrdinalUnsupported( ze_command_queue_handle_t hCommandQueue, uint32_t* pOrdinal ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeCommandQueueGetIndexUnsupported( ze_command_queue_handle_t hCommandQueue, uint32_t* pIndex ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeCommandListCreateUnsupported( ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_command_list_desc_t* desc, ze_command_list_handle_t* phCommandList ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeCommandListCreateImmediateUnsupported( ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_command_queue_desc_t* altdesc, ze_command_list_handle_t* phCommandList ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeCommandListDestroyUnsupported( ze_command_list_handle_t hCommandList ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeCommandListCloseUnsupported( ze_command_list_handle_t hCommandList ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeCommandListResetUnsupported( ze_command_list_handle_t hCommandList ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeCommandListAppendWriteGlobalTimestampUnsupported( ze_command_list_handle_t hCommandList, uint64_t* dstptr, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeCommandListHostSynchronizeUnsupported( ze_command_list_handle_t hCommandList, uint64_t timeout ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeCommandListGetDeviceHandleUnsupported( ze_command_list_handle_t hCommandList, ze_device_handle_t* phDevice ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeCommandListGetContextHandleUnsupported( ze_command_list_handle_t hCommandList, ze_context_handle_t* phContext ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeCommandListGetOrdinalUnsupported( ze_command_list_handle_t hCommandList, uint32_t* pOrdinal ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeCommandListImmediateGetIndexUnsupported( ze_command_list_handle_t hCommandListImmediate, uint32_t* pIndex ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeCommandListIsImmediateUnsupported( ze_command_list_handle_t hCommandList, ze_bool_t* pIsImmediate ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeCommandListAppendBarrierUnsupported( ze_command_list_handle_t hCommandList, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeCommandListAppendMemoryRangesBarrierUnsupported( ze_command_list_handle_t hCommandList, uint32_t numRanges, const size_t* pRangeSizes, const void** pRanges, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeContextSystemBarrierUnsupported( ze_context_handle_t hContext, ze_device_handle_t hDevice ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeCommandListAppendMemoryCopyUnsupported( ze_command_list_handle_t hCommandList, void* dstptr, const void* srcptr, size_t size, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeCommandListAppendMemoryFillUnsupported( ze_command_list_handle_t hCommandList, void* ptr, const void* pattern, size_t pattern_size, size_t size, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeCommandListAppendMemoryCopyRegionUnsupported( ze_command_list_handle_t hCommandList, void* dstptr, const ze_copy_region_t* dstRegion, uint32_t dstPitch, uint32_t dstSlicePitch, const void* srcptr, const ze_copy_region_t* srcRegion, uint32_t srcPitch, uint32_t srcSlicePitch, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeCommandListAppendMemoryCopyFromContextUnsupported( ze_command_list_handle_t hCommandList, void* dstptr, ze_context_handle_t hContextSrc, const void* srcptr, size_t size, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeCommandListAppendImageCopyUnsupported( ze_command_list_handle_t hCommandList, ze_image_handle_t hDstImage, ze_image_handle_t hSrcImage, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeCommandListAppendImageCopyRegionUnsupported( ze_command_list_handle_t hCommandList, ze_image_handle_t hDstImage, ze_image_handle_t hSrcImage, const ze_image_region_t* pDstRegion, const ze_image_region_t* pSrcRegion, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeCommandListAppendImageCopyToMemoryUnsupported( ze_command_list_handle_t hCommandList, void* dstptr, ze_image_handle_t hSrcImage, const ze_image_region_t* pSrcRegion, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeCommandListAppendImageCopyFromMemoryUnsupported( ze_command_list_handle_t hCommandList, ze_image_handle_t hDstImage, const void* srcptr, const ze_image_region_t* pDstRegion, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeCommandListAppendMemoryPrefetchUnsupported( ze_command_list_handle_t hCommandList, const void* ptr, size_t size ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeCommandListAppendMemAdviseUnsupported( ze_command_list_handle_t hCommandList, ze_device_handle_t hDevice, const void* ptr, size_t size, ze_memory_advice_t advice ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeEventPoolCreateUnsupported( ze_context_handle_t hContext, const ze_event_pool_desc_t* desc, uint32_t numDevices, ze_device_handle_t* phDevices, ze_event_pool_handle_t* phEventPool ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeEventPoolDestroyUnsupported( ze_event_pool_handle_t hEventPool ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeEventCreateUnsupported( ze_event_pool_handle_t hEventPool, const ze_event_desc_t* desc, ze_event_handle_t* phEvent ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeEventCounterBasedCreateUnsupported( ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_event_counter_based_desc_t* desc, ze_event_handle_t* phEvent ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeEventDestroyUnsupported( ze_event_handle_t hEvent ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeEventPoolGetIpcHandleUnsupported( ze_event_pool_handle_t hEventPool, ze_ipc_event_pool_handle_t* phIpc ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeEventPoolPutIpcHandleUnsupported( ze_context_handle_t hContext, ze_ipc_event_pool_handle_t hIpc ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeEventPoolOpenIpcHandleUnsupported( ze_context_handle_t hContext, ze_ipc_event_pool_handle_t hIpc, ze_event_pool_handle_t* phEventPool ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeEventPoolCloseIpcHandleUnsupported( ze_event_pool_handle_t hEventPool ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeEventCounterBasedGetIpcHandleUnsupported( ze_event_handle_t hEvent, ze_ipc_event_counter_based_handle_t* phIpc ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeEventCounterBasedOpenIpcHandleUnsupported( ze_context_handle_t hContext, ze_ipc_event_counter_based_handle_t hIpc, ze_event_handle_t* phEvent ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeEventCounterBasedCloseIpcHandleUnsupported( ze_event_handle_t hEvent ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeEventCounterBasedGetDeviceAddressUnsupported( ze_event_handle_t hEvent, uint64_t* completionValue, uint64_t* deviceAddress ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeCommandListAppendSignalEventUnsupported( ze_command_list_handle_t hCommandList, ze_event_handle_t hEvent ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeCommandListAppendWaitOnEventsUnsupported( ze_command_list_handle_t hCommandList, uint32_t numEvents, ze_event_handle_t* phEvents ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeEventHostSignalUnsupported( ze_event_handle_t hEvent ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeEventHostSynchronizeUnsupported( ze_event_handle_t hEvent, uint64_t timeout ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeEventQueryStatusUnsupported( ze_event_handle_t hEvent ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeCommandListAppendEventResetUnsupported( ze_command_list_handle_t hCommandList, ze_event_handle_t hEvent ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeEventHostResetUnsupported( ze_event_handle_t hEvent ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeEventQueryKernelTimestampUnsupported( ze_event_handle_t hEvent, ze_kernel_timestamp_result_t* dstptr ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeCommandListAppendQueryKernelTimestampsUnsupported( ze_command_list_handle_t hCommandList, uint32_t numEvents, ze_event_handle_t* phEvents, void* dstptr, const size_t* pOffsets, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeEventGetEventPoolUnsupported( ze_event_handle_t hEvent, ze_event_pool_handle_t* phEventPool ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeEventGetSignalScopeUnsupported( ze_event_handle_t hEvent, ze_event_scope_flags_t* pSignalScope ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeEventGetWaitScopeUnsupported( ze_event_handle_t hEvent, ze_event_scope_flags_t* pWaitScope ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeEventPoolGetContextHandleUnsupported( ze_event_pool_handle_t hEventPool, ze_context_handle_t* phContext ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeEventPoolGetFlagsUnsupported( ze_event_pool_handle_t hEventPool, ze_event_pool_flags_t* pFlags ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeFenceCreateUnsupported( ze_command_queue_handle_t hCommandQueue, const ze_fence_desc_t* desc, ze_fence_handle_t* phFence ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeFenceDestroyUnsupported( ze_fence_handle_t hFence ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeFenceHostSynchronizeUnsupported( ze_fence_handle_t hFence, uint64_t timeout ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeFenceQueryStatusUnsupported( ze_fence_handle_t hFence ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeFenceResetUnsupported( ze_fence_handle_t hFence ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeImageGetPropertiesUnsupported( ze_device_handle_t hDevice, const ze_image_desc_t* desc, ze_image_properties_t* pImageProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeImageCreateUnsupported( ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_image_desc_t* desc, ze_image_handle_t* phImage ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeImageDestroyUnsupported( ze_image_handle_t hImage ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeMemAllocSharedUnsupported( ze_context_handle_t hContext, const ze_device_mem_alloc_desc_t* device_desc, const ze_host_mem_alloc_desc_t* host_desc, size_t size, size_t alignment, ze_device_handle_t hDevice, void** pptr ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeMemAllocDeviceUnsupported( ze_context_handle_t hContext, const ze_device_mem_alloc_desc_t* device_desc, size_t size, size_t alignment, ze_device_handle_t hDevice, void** pptr ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeMemAllocHostUnsupported( ze_context_handle_t hContext, const ze_host_mem_alloc_desc_t* host_desc, size_t size, size_t alignment, void** pptr ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeMemFreeUnsupported( ze_context_handle_t hContext, void* ptr ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeMemGetAllocPropertiesUnsupported( ze_context_handle_t hContext, const void* ptr, ze_memory_allocation_properties_t* pMemAllocProperties, ze_device_handle_t* phDevice ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeMemGetAddressRangeUnsupported( ze_context_handle_t hContext, const void* ptr, void** pBase, size_t* pSize ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeMemGetIpcHandleUnsupported( ze_context_handle_t hContext, const void* ptr, ze_ipc_mem_handle_t* pIpcHandle ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeMemGetIpcHandleFromFileDescriptorExpUnsupported( ze_context_handle_t hContext, uint64_t handle, ze_ipc_mem_handle_t* pIpcHandle ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeMemGetFileDescriptorFromIpcHandleExpUnsupported( ze_context_handle_t hContext, ze_ipc_mem_handle_t ipcHandle, uint64_t* pHandle ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeMemPutIpcHandleUnsupported( ze_context_handle_t hContext, ze_ipc_mem_handle_t handle ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeMemOpenIpcHandleUnsupported( ze_context_handle_t hContext, ze_device_handle_t hDevice, ze_ipc_mem_handle_t handle, ze_ipc_memory_flags_t flags, void** pptr ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeMemCloseIpcHandleUnsupported( ze_context_handle_t hContext, const void* ptr ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeMemSetAtomicAccessAttributeExpUnsupported( ze_context_handle_t hContext, ze_device_handle_t hDevice, const void* ptr, size_t size, ze_memory_atomic_attr_exp_flags_t attr ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeMemGetAtomicAccessAttributeExpUnsupported( ze_context_handle_t hContext, ze_device_handle_t hDevice, const void* ptr, size_t size, ze_memory_atomic_attr_exp_flags_t* pAttr ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeModuleCreateUnsupported( ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_module_desc_t* desc, ze_module_handle_t* phModule, ze_module_build_log_handle_t* phBuildLog ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeModuleDestroyUnsupported( ze_module_handle_t hModule ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeModuleDynamicLinkUnsupported( uint32_t numModules, ze_module_handle_t* phModules, ze_module_build_log_handle_t* phLinkLog ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeModuleBuildLogDestroyUnsupported( ze_module_build_log_handle_t hModuleBuildLog ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeModuleBuildLogGetStringUnsupported( ze_module_build_log_handle_t hModuleBuildLog, size_t* pSize, char* pBuildLog ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeModuleGetNativeBinaryUnsupported( ze_module_handle_t hModule, size_t* pSize, uint8_t* pModuleNativeBinary ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeModuleGetGlobalPointerUnsupported( ze_module_handle_t hModule, const char* pGlobalName, size_t* pSize, void** pptr ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeModuleGetKernelNamesUnsupported( ze_module_handle_t hModule, uint32_t* pCount, const char** pNames ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeModuleGetPropertiesUnsupported( ze_module_handle_t hModule, ze_module_properties_t* pModuleProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeKernelCreateUnsupported( ze_module_handle_t hModule, const ze_kernel_desc_t* desc, ze_kernel_handle_t* phKernel ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeKernelDestroyUnsupported( ze_kernel_handle_t hKernel ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeModuleGetFunctionPointerUnsupported( ze_module_handle_t hModule, const char* pFunctionName, void** pfnFunction ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeKernelSetGroupSizeUnsupported( ze_kernel_handle_t hKernel, uint32_t groupSizeX, uint32_t groupSizeY, uint32_t groupSizeZ ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeKernelSuggestGroupSizeUnsupported( ze_kernel_handle_t hKernel, uint32_t globalSizeX, uint32_t globalSizeY, uint32_t globalSizeZ, uint32_t* groupSizeX, uint32_t* groupSizeY, uint32_t* groupSizeZ ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeKernelSuggestMaxCooperativeGroupCountUnsupported( ze_kernel_handle_t hKernel, uint32_t* totalGroupCount ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeKernelSetArgumentValueUnsupported( ze_kernel_handle_t hKernel, uint32_t argIndex, size_t argSize, const void* pArgValue ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeKernelSetIndirectAccessUnsupported( ze_kernel_handle_t hKernel, ze_kernel_indirect_access_flags_t flags ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeKernelGetIndirectAccessUnsupported( ze_kernel_handle_t hKernel, ze_kernel_indirect_access_flags_t* pFlags ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeKernelGetSourceAttributesUnsupported( ze_kernel_handle_t hKernel, uint32_t* pSize, char** pString ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeKernelSetCacheConfigUnsupported( ze_kernel_handle_t hKernel, ze_cache_config_flags_t flags ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeKernelGetPropertiesUnsupported( ze_kernel_handle_t hKernel, ze_kernel_properties_t* pKernelProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeKernelGetNameUnsupported( ze_kernel_handle_t hKernel, size_t* pSize, char* pName ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeCommandListAppendLaunchKernelUnsupported( ze_command_list_handle_t hCommandList, ze_kernel_handle_t hKernel, const ze_group_count_t* pLaunchFuncArgs, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeCommandListAppendLaunchKernelWithParametersUnsupported( ze_command_list_handle_t hCommandList, ze_kernel_handle_t hKernel, const ze_group_count_t* pGroupCounts, const void * pNext, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeCommandListAppendLaunchKernelWithArgumentsUnsupported( ze_command_list_handle_t hCommandList, ze_kernel_handle_t hKernel, const ze_group_count_t groupCounts, const ze_group_size_t groupSizes, void ** pArguments, const void * pNext, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeCommandListAppendLaunchCooperativeKernelUnsupported( ze_command_list_handle_t hCommandList, ze_kernel_handle_t hKernel, const ze_group_count_t* pLaunchFuncArgs, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeCommandListAppendLaunchKernelIndirectUnsupported( ze_command_list_handle_t hCommandList, ze_kernel_handle_t hKernel, const ze_group_count_t* pLaunchArgumentsBuffer, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeCommandListAppendLaunchMultipleKernelsIndirectUnsupported( ze_command_list_handle_t hCommandList, uint32_t numKernels, ze_kernel_handle_t* phKernels, const uint32_t* pCountBuffer, const ze_group_count_t* pLaunchArgumentsBuffer, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeContextMakeMemoryResidentUnsupported( ze_context_handle_t hContext, ze_device_handle_t hDevice, void* ptr, size_t size ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeContextEvictMemoryUnsupported( ze_context_handle_t hContext, ze_device_handle_t hDevice, void* ptr, size_t size ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeContextMakeImageResidentUnsupported( ze_context_handle_t hContext, ze_device_handle_t hDevice, ze_image_handle_t hImage ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeContextEvictImageUnsupported( ze_context_handle_t hContext, ze_device_handle_t hDevice, ze_image_handle_t hImage ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeSamplerCreateUnsupported( ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_sampler_desc_t* desc, ze_sampler_handle_t* phSampler ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeSamplerDestroyUnsupported( ze_sampler_handle_t hSampler ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeVirtualMemReserveUnsupported( ze_context_handle_t hContext, const void* pStart, size_t size, void** pptr ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeVirtualMemFreeUnsupported( ze_context_handle_t hContext, const void* ptr, size_t size ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeVirtualMemQueryPageSizeUnsupported( ze_context_handle_t hContext, ze_device_handle_t hDevice, size_t size, size_t* pagesize ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zePhysicalMemGetPropertiesUnsupported( ze_context_handle_t hContext, ze_physical_mem_handle_t hPhysicalMem, ze_physical_mem_properties_t* pMemProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zePhysicalMemCreateUnsupported( ze_context_handle_t hContext, ze_device_handle_t hDevice, ze_physical_mem_desc_t* desc, ze_physical_mem_handle_t* phPhysicalMemory ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zePhysicalMemDestroyUnsupported( ze_context_handle_t hContext, ze_physical_mem_handle_t hPhysicalMemory ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeVirtualMemMapUnsupported( ze_context_handle_t hContext, const void* ptr, size_t size, ze_physical_mem_handle_t hPhysicalMemory, size_t offset, ze_memory_access_attribute_t access ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeVirtualMemUnmapUnsupported( ze_context_handle_t hContext, const void* ptr, size_t size ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeVirtualMemSetAccessAttributeUnsupported( ze_context_handle_t hContext, const void* ptr, size_t size, ze_memory_access_attribute_t access ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeVirtualMemGetAccessAttributeUnsupported( ze_context_handle_t hContext, const void* ptr, size_t size, ze_memory_access_attribute_t* access, size_t* outSize ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeKernelSetGlobalOffsetExpUnsupported( ze_kernel_handle_t hKernel, uint32_t offsetX, uint32_t offsetY, uint32_t offsetZ ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeKernelGetBinaryExpUnsupported( ze_kernel_handle_t hKernel, size_t* pSize, uint8_t* pKernelBinary ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeDeviceImportExternalSemaphoreExtUnsupported( ze_device_handle_t hDevice, const ze_external_semaphore_ext_desc_t* desc, ze_external_semaphore_ext_handle_t* phSemaphore ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeDeviceReleaseExternalSemaphoreExtUnsupported( ze_external_semaphore_ext_handle_t hSemaphore ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeCommandListAppendSignalExternalSemaphoreExtUnsupported( ze_command_list_handle_t hCommandList, uint32_t numSemaphores, ze_external_semaphore_ext_handle_t* phSemaphores, ze_external_semaphore_signal_params_ext_t* signalParams, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeCommandListAppendWaitExternalSemaphoreExtUnsupported( ze_command_list_handle_t hCommandList, uint32_t numSemaphores, ze_external_semaphore_ext_handle_t* phSemaphores, ze_external_semaphore_wait_params_ext_t* waitParams, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeRTASBuilderCreateExtUnsupported( ze_driver_handle_t hDriver, const ze_rtas_builder_ext_desc_t* pDescriptor, ze_rtas_builder_ext_handle_t* phBuilder ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeRTASBuilderGetBuildPropertiesExtUnsupported( ze_rtas_builder_ext_handle_t hBuilder, const ze_rtas_builder_build_op_ext_desc_t* pBuildOpDescriptor, ze_rtas_builder_ext_properties_t* pProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeDriverRTASFormatCompatibilityCheckExtUnsupported( ze_driver_handle_t hDriver, ze_rtas_format_ext_t rtasFormatA, ze_rtas_format_ext_t rtasFormatB ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeRTASBuilderBuildExtUnsupported( ze_rtas_builder_ext_handle_t hBuilder, const ze_rtas_builder_build_op_ext_desc_t* pBuildOpDescriptor, void* pScratchBuffer, size_t scratchBufferSizeBytes, void* pRtasBuffer, size_t rtasBufferSizeBytes, ze_rtas_parallel_operation_ext_handle_t hParallelOperation, void* pBuildUserPtr, ze_rtas_aabb_ext_t* pBounds, size_t* pRtasBufferSizeBytes ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeRTASBuilderCommandListAppendCopyExtUnsupported( ze_command_list_handle_t hCommandList, void* dstptr, const void* srcptr, size_t size, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeRTASBuilderDestroyExtUnsupported( ze_rtas_builder_ext_handle_t hBuilder ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeRTASParallelOperationCreateExtUnsupported( ze_driver_handle_t hDriver, ze_rtas_parallel_operation_ext_handle_t* phParallelOperation ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeRTASParallelOperationGetPropertiesExtUnsupported( ze_rtas_parallel_operation_ext_handle_t hParallelOperation, ze_rtas_parallel_operation_ext_properties_t* pProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeRTASParallelOperationJoinExtUnsupported( ze_rtas_parallel_operation_ext_handle_t hParallelOperation ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeRTASParallelOperationDestroyExtUnsupported( ze_rtas_parallel_operation_ext_handle_t hParallelOperation ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeDeviceGetVectorWidthPropertiesExtUnsupported( ze_device_handle_t hDevice, uint32_t* pCount, ze_device_vector_width_properties_ext_t* pVectorWidthProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeKernelGetAllocationPropertiesExpUnsupported( ze_kernel_handle_t hKernel, uint32_t* pCount, ze_kernel_allocation_exp_properties_t* pAllocationProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeMemGetIpcHandleWithPropertiesUnsupported( ze_context_handle_t hContext, const void* ptr, void* pNext, ze_ipc_mem_handle_t* pIpcHandle ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeDeviceReserveCacheExtUnsupported( ze_device_handle_t hDevice, size_t cacheLevel, size_t cacheReservationSize ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeDeviceSetCacheAdviceExtUnsupported( ze_device_handle_t hDevice, void* ptr, size_t regionSize, ze_cache_ext_region_t cacheRegion ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeEventQueryTimestampsExpUnsupported( ze_event_handle_t hEvent, ze_device_handle_t hDevice, uint32_t* pCount, ze_kernel_timestamp_result_t* pTimestamps ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeImageGetMemoryPropertiesExpUnsupported( ze_image_handle_t hImage, ze_image_memory_properties_exp_t* pMemoryProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeImageViewCreateExtUnsupported( ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_image_desc_t* desc, ze_image_handle_t hImage, ze_image_handle_t* phImageView ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeImageViewCreateExpUnsupported( ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_image_desc_t* desc, ze_image_handle_t hImage, ze_image_handle_t* phImageView ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeKernelSchedulingHintExpUnsupported( ze_kernel_handle_t hKernel, ze_scheduling_hint_exp_desc_t* pHint ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeDevicePciGetPropertiesExtUnsupported( ze_device_handle_t hDevice, ze_pci_ext_properties_t* pPciProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeCommandListAppendImageCopyToMemoryExtUnsupported( ze_command_list_handle_t hCommandList, void* dstptr, ze_image_handle_t hSrcImage, const ze_image_region_t* pSrcRegion, uint32_t destRowPitch, uint32_t destSlicePitch, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeCommandListAppendImageCopyFromMemoryExtUnsupported( ze_command_list_handle_t hCommandList, ze_image_handle_t hDstImage, const void* srcptr, const ze_image_region_t* pDstRegion, uint32_t srcRowPitch, uint32_t srcSlicePitch, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeImageGetAllocPropertiesExtUnsupported( ze_context_handle_t hContext, ze_image_handle_t hImage, ze_image_allocation_ext_properties_t* pImageAllocProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeModuleInspectLinkageExtUnsupported( ze_linkage_inspection_ext_desc_t* pInspectDesc, uint32_t numModules, ze_module_handle_t* phModules, ze_module_build_log_handle_t* phLog ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeMemFreeExtUnsupported( ze_context_handle_t hContext, const ze_memory_free_ext_desc_t* pMemFreeDesc, void* ptr ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeFabricVertexGetExpUnsupported( ze_driver_handle_t hDriver, uint32_t* pCount, ze_fabric_vertex_handle_t* phVertices ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeFabricVertexGetSubVerticesExpUnsupported( ze_fabric_vertex_handle_t hVertex, uint32_t* pCount, ze_fabric_vertex_handle_t* phSubvertices ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeFabricVertexGetPropertiesExpUnsupported( ze_fabric_vertex_handle_t hVertex, ze_fabric_vertex_exp_properties_t* pVertexProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeFabricVertexGetDeviceExpUnsupported( ze_fabric_vertex_handle_t hVertex, ze_device_handle_t* phDevice ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeDeviceGetFabricVertexExpUnsupported( ze_device_handle_t hDevice, ze_fabric_vertex_handle_t* phVertex ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeFabricEdgeGetExpUnsupported( ze_fabric_vertex_handle_t hVertexA, ze_fabric_vertex_handle_t hVertexB, uint32_t* pCount, ze_fabric_edge_handle_t* phEdges ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeFabricEdgeGetVerticesExpUnsupported( ze_fabric_edge_handle_t hEdge, ze_fabric_vertex_handle_t* phVertexA, ze_fabric_vertex_handle_t* phVertexB ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeFabricEdgeGetPropertiesExpUnsupported( ze_fabric_edge_handle_t hEdge, ze_fabric_edge_exp_properties_t* pEdgeProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeEventQueryKernelTimestampsExtUnsupported( ze_event_handle_t hEvent, ze_device_handle_t hDevice, uint32_t* pCount, ze_event_query_kernel_timestamps_results_ext_properties_t* pResults ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeRTASBuilderCreateExpUnsupported( ze_driver_handle_t hDriver, const ze_rtas_builder_exp_desc_t* pDescriptor, ze_rtas_builder_exp_handle_t* phBuilder ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeRTASBuilderGetBuildPropertiesExpUnsupported( ze_rtas_builder_exp_handle_t hBuilder, const ze_rtas_builder_build_op_exp_desc_t* pBuildOpDescriptor, ze_rtas_builder_exp_properties_t* pProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeDriverRTASFormatCompatibilityCheckExpUnsupported( ze_driver_handle_t hDriver, ze_rtas_format_exp_t rtasFormatA, ze_rtas_format_exp_t rtasFormatB ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeRTASBuilderBuildExpUnsupported( ze_rtas_builder_exp_handle_t hBuilder, const ze_rtas_builder_build_op_exp_desc_t* pBuildOpDescriptor, void* pScratchBuffer, size_t scratchBufferSizeBytes, void* pRtasBuffer, size_t rtasBufferSizeBytes, ze_rtas_parallel_operation_exp_handle_t hParallelOperation, void* pBuildUserPtr, ze_rtas_aabb_exp_t* pBounds, size_t* pRtasBufferSizeBytes ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeRTASBuilderDestroyExpUnsupported( ze_rtas_builder_exp_handle_t hBuilder ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeRTASParallelOperationCreateExpUnsupported( ze_driver_handle_t hDriver, ze_rtas_parallel_operation_exp_handle_t* phParallelOperation ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeRTASParallelOperationGetPropertiesExpUnsupported( ze_rtas_parallel_operation_exp_handle_t hParallelOperation, ze_rtas_parallel_operation_exp_properties_t* pProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeRTASParallelOperationJoinExpUnsupported( ze_rtas_parallel_operation_exp_handle_t hParallelOperation ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeRTASParallelOperationDestroyExpUnsupported( ze_rtas_parallel_operation_exp_handle_t hParallelOperation ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeMemGetPitchFor2dImageUnsupported( ze_context_handle_t hContext, ze_device_handle_t hDevice, size_t imageWidth, size_t imageHeight, unsigned int elementSizeInBytes, size_t * rowPitch ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeImageGetDeviceOffsetExpUnsupported( ze_image_handle_t hImage, uint64_t* pDeviceOffset ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeCommandListCreateCloneExpUnsupported( ze_command_list_handle_t hCommandList, ze_command_list_handle_t* phClonedCommandList ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeCommandListImmediateAppendCommandListsExpUnsupported( ze_command_list_handle_t hCommandListImmediate, uint32_t numCommandLists, ze_command_list_handle_t* phCommandLists, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeCommandListGetNextCommandIdExpUnsupported( ze_command_list_handle_t hCommandList, const ze_mutable_command_id_exp_desc_t* desc, uint64_t* pCommandId ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeCommandListGetNextCommandIdWithKernelsExpUnsupported( ze_command_list_handle_t hCommandList, const ze_mutable_command_id_exp_desc_t* desc, uint32_t numKernels, ze_kernel_handle_t* phKernels, uint64_t* pCommandId ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeCommandListUpdateMutableCommandsExpUnsupported( ze_command_list_handle_t hCommandList, const ze_mutable_commands_exp_desc_t* desc ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeCommandListUpdateMutableCommandSignalEventExpUnsupported( ze_command_list_handle_t hCommandList, uint64_t commandId, ze_event_handle_t hSignalEvent ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeCommandListUpdateMutableCommandWaitEventsExpUnsupported( ze_command_list_handle_t hCommandList, uint64_t commandId, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zeCommandListUpdateMutableCommandKernelsExpUnsupported( ze_command_list_handle_t hCommandList, uint32_t numKernels, uint64_t* pCommandId, ze_kernel_handle_t* phKernels ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+
+    static void applyCertification(ze_dditable_t &table, const ze_dditable_t &original, ze_api_version_t version) {
+        table.Global.pfnInit = (original.Global.pfnInit && version < ZE_API_VERSION_1_0) ? zeInitUnsupported : original.Global.pfnInit;
+        table.Driver.pfnGet = (original.Driver.pfnGet && version < ZE_API_VERSION_1_0) ? zeDriverGetUnsupported : original.Driver.pfnGet;
+        table.Global.pfnInitDrivers = (original.Global.pfnInitDrivers && version < ZE_API_VERSION_1_10) ? zeInitDriversUnsupported : original.Global.pfnInitDrivers;
+        table.Driver.pfnGetApiVersion = (original.Driver.pfnGetApiVersion && version < ZE_API_VERSION_1_0) ? zeDriverGetApiVersionUnsupported : original.Driver.pfnGetApiVersion;
+        table.Driver.pfnGetProperties = (original.Driver.pfnGetProperties && version < ZE_API_VERSION_1_0) ? zeDriverGetPropertiesUnsupported : original.Driver.pfnGetProperties;
+        table.Driver.pfnGetIpcProperties = (original.Driver.pfnGetIpcProperties && version < ZE_API_VERSION_1_0) ? zeDriverGetIpcPropertiesUnsupported : original.Driver.pfnGetIpcProperties;
+        table.Driver.pfnGetExtensionProperties = (original.Driver.pfnGetExtensionProperties && version < ZE_API_VERSION_1_0) ? zeDriverGetExtensionPropertiesUnsupported : original.Driver.pfnGetExtensionProperties;
+        table.Driver.pfnGetExtensionFunctionAddress = (original.Driver.pfnGetExtensionFunctionAddress && version < ZE_API_VERSION_1_1) ? zeDriverGetExtensionFunctionAddressUnsupported : original.Driver.pfnGetExtensionFunctionAddress;
+        table.Driver.pfnGetLastErrorDescription = (original.Driver.pfnGetLastErrorDescription && version < ZE_API_VERSION_1_6) ? zeDriverGetLastErrorDescriptionUnsupported : original.Driver.pfnGetLastErrorDescription;
+        table.Driver.pfnGetDefaultContext = (original.Driver.pfnGetDefaultContext && version < ZE_API_VERSION_1_14) ? zeDriverGetDefaultContextUnsupported : original.Driver.pfnGetDefaultContext;
+        table.Device.pfnGet = (original.Device.pfnGet && version < ZE_API_VERSION_1_0) ? zeDeviceGetUnsupported : original.Device.pfnGet;
+        table.Device.pfnGetRootDevice = (original.Device.pfnGetRootDevice && version < ZE_API_VERSION_1_7) ? zeDeviceGetRootDeviceUnsupported : original.Device.pfnGetRootDevice;
+        table.Device.pfnGetSubDevices = (original.Device.pfnGetSubDevices && version < ZE_API_VERSION_1_0) ? zeDeviceGetSubDevicesUnsupported : original.Device.pfnGetSubDevices;
+        table.Device.pfnGetProperties = (original.Device.pfnGetProperties && version < ZE_API_VERSION_1_0) ? zeDeviceGetPropertiesUnsupported : original.Device.pfnGetProperties;
+        table.Device.pfnGetComputeProperties = (original.Device.pfnGetComputeProperties && version < ZE_API_VERSION_1_0) ? zeDeviceGetComputePropertiesUnsupported : original.Device.pfnGetComputeProperties;
+        table.Device.pfnGetModuleProperties = (original.Device.pfnGetModuleProperties && version < ZE_API_VERSION_1_0) ? zeDeviceGetModulePropertiesUnsupported : original.Device.pfnGetModuleProperties;
+        table.Device.pfnGetCommandQueueGroupProperties = (original.Device.pfnGetCommandQueueGroupProperties && version < ZE_API_VERSION_1_0) ? zeDeviceGetCommandQueueGroupPropertiesUnsupported : original.Device.pfnGetCommandQueueGroupProperties;
+        table.Device.pfnGetMemoryProperties = (original.Device.pfnGetMemoryProperties && version < ZE_API_VERSION_1_0) ? zeDeviceGetMemoryPropertiesUnsupported : original.Device.pfnGetMemoryProperties;
+        table.Device.pfnGetMemoryAccessProperties = (original.Device.pfnGetMemoryAccessProperties && version < ZE_API_VERSION_1_0) ? zeDeviceGetMemoryAccessPropertiesUnsupported : original.Device.pfnGetMemoryAccessProperties;
+        table.Device.pfnGetCacheProperties = (original.Device.pfnGetCacheProperties && version < ZE_API_VERSION_1_0) ? zeDeviceGetCachePropertiesUnsupported : original.Device.pfnGetCacheProperties;
+        table.Device.pfnGetImageProperties = (original.Device.pfnGetImageProperties && version < ZE_API_VERSION_1_0) ? zeDeviceGetImagePropertiesUnsupported : original.Device.pfnGetImageProperties;
+        table.Device.pfnGetExternalMemoryProperties = (original.Device.pfnGetExternalMemoryProperties && version < ZE_API_VERSION_1_0) ? zeDeviceGetExternalMemoryPropertiesUnsupported : original.Device.pfnGetExternalMemoryProperties;
+        table.Device.pfnGetP2PProperties = (original.Device.pfnGetP2PProperties && version < ZE_API_VERSION_1_0) ? zeDeviceGetP2PPropertiesUnsupported : original.Device.pfnGetP2PProperties;
+        table.Device.pfnCanAccessPeer = (original.Device.pfnCanAccessPeer && version < ZE_API_VERSION_1_0) ? zeDeviceCanAccessPeerUnsupported : original.Device.pfnCanAccessPeer;
+        table.Device.pfnGetStatus = (original.Device.pfnGetStatus && version < ZE_API_VERSION_1_0) ? zeDeviceGetStatusUnsupported : original.Device.pfnGetStatus;
+        table.Device.pfnGetGlobalTimestamps = (original.Device.pfnGetGlobalTimestamps && version < ZE_API_VERSION_1_1) ? zeDeviceGetGlobalTimestampsUnsupported : original.Device.pfnGetGlobalTimestamps;
+        table.Device.pfnSynchronize = (original.Device.pfnSynchronize && version < ZE_API_VERSION_1_14) ? zeDeviceSynchronizeUnsupported : original.Device.pfnSynchronize;
+        table.Device.pfnGetAggregatedCopyOffloadIncrementValue = (original.Device.pfnGetAggregatedCopyOffloadIncrementValue && version < ZE_API_VERSION_1_15) ? zeDeviceGetAggregatedCopyOffloadIncrementValueUnsupported : original.Device.pfnGetAggregatedCopyOffloadIncrementValue;
+        table.Context.pfnCreate = (original.Context.pfnCreate && version < ZE_API_VERSION_1_0) ? zeContextCreateUnsupported : original.Context.pfnCreate;
+        table.Context.pfnCreateEx = (original.Context.pfnCreateEx && version < ZE_API_VERSION_1_1) ? zeContextCreateExUnsupported : original.Context.pfnCreateEx;
+        table.Context.pfnDestroy = (original.Context.pfnDestroy && version < ZE_API_VERSION_1_0) ? zeContextDestroyUnsupported : original.Context.pfnDestroy;
+        table.Context.pfnGetStatus = (original.Context.pfnGetStatus && version < ZE_API_VERSION_1_0) ? zeContextGetStatusUnsupported : original.Context.pfnGetStatus;
+        table.CommandQueue.pfnCreate = (original.CommandQueue.pfnCreate && version < ZE_API_VERSION_1_0) ? zeCommandQueueCreateUnsupported : original.CommandQueue.pfnCreate;
+        table.CommandQueue.pfnDestroy = (original.CommandQueue.pfnDestroy && version < ZE_API_VERSION_1_0) ? zeCommandQueueDestroyUnsupported : original.CommandQueue.pfnDestroy;
+        table.CommandQueue.pfnExecuteCommandLists = (original.CommandQueue.pfnExecuteCommandLists && version < ZE_API_VERSION_1_0) ? zeCommandQueueExecuteCommandListsUnsupported : original.CommandQueue.pfnExecuteCommandLists;
+        table.CommandQueue.pfnSynchronize = (original.CommandQueue.pfnSynchronize && version < ZE_API_VERSION_1_0) ? zeCommandQueueSynchronizeUnsupported : original.CommandQueue.pfnSynchronize;
+        table.CommandQueue.pfnGetOrdinal = (original.CommandQueue.pfnGetOrdinal && version < ZE_API_VERSION_1_9) ? zeCommandQueueGetOrdinalUnsupported : original.CommandQueue.pfnGetOrdinal;
+        table.CommandQueue.pfnGetIndex = (original.CommandQueue.pfnGetIndex && version < ZE_API_VERSION_1_9) ? zeCommandQueueGetIndexUnsupported : original.CommandQueue.pfnGetIndex;
+        table.CommandList.pfnCreate = (original.CommandList.pfnCreate && version < ZE_API_VERSION_1_0) ? zeCommandListCreateUnsupported : original.CommandList.pfnCreate;
+        table.CommandList.pfnCreateImmediate = (original.CommandList.pfnCreateImmediate && version < ZE_API_VERSION_1_0) ? zeCommandListCreateImmediateUnsupported : original.CommandList.pfnCreateImmediate;
+        table.CommandList.pfnDestroy = (original.CommandList.pfnDestroy && version < ZE_API_VERSION_1_0) ? zeCommandListDestroyUnsupported : original.CommandList.pfnDestroy;
+        table.CommandList.pfnClose = (original.CommandList.pfnClose && version < ZE_API_VERSION_1_0) ? zeCommandListCloseUnsupported : original.CommandList.pfnClose;
+        table.CommandList.pfnReset = (original.CommandList.pfnReset && version < ZE_API_VERSION_1_0) ? zeCommandListResetUnsupported : original.CommandList.pfnReset;
+        table.CommandList.pfnAppendWriteGlobalTimestamp = (original.CommandList.pfnAppendWriteGlobalTimestamp && version < ZE_API_VERSION_1_0) ? zeCommandListAppendWriteGlobalTimestampUnsupported : original.CommandList.pfnAppendWriteGlobalTimestamp;
+        table.CommandList.pfnHostSynchronize = (original.CommandList.pfnHostSynchronize && version < ZE_API_VERSION_1_6) ? zeCommandListHostSynchronizeUnsupported : original.CommandList.pfnHostSynchronize;
+        table.CommandList.pfnGetDeviceHandle = (original.CommandList.pfnGetDeviceHandle && version < ZE_API_VERSION_1_9) ? zeCommandListGetDeviceHandleUnsupported : original.CommandList.pfnGetDeviceHandle;
+        table.CommandList.pfnGetContextHandle = (original.CommandList.pfnGetContextHandle && version < ZE_API_VERSION_1_9) ? zeCommandListGetContextHandleUnsupported : original.CommandList.pfnGetContextHandle;
+        table.CommandList.pfnGetOrdinal = (original.CommandList.pfnGetOrdinal && version < ZE_API_VERSION_1_9) ? zeCommandListGetOrdinalUnsupported : original.CommandList.pfnGetOrdinal;
+        table.CommandList.pfnImmediateGetIndex = (original.CommandList.pfnImmediateGetIndex && version < ZE_API_VERSION_1_9) ? zeCommandListImmediateGetIndexUnsupported : original.CommandList.pfnImmediateGetIndex;
+        table.CommandList.pfnIsImmediate = (original.CommandList.pfnIsImmediate && version < ZE_API_VERSION_1_9) ? zeCommandListIsImmediateUnsupported : original.CommandList.pfnIsImmediate;
+        table.CommandList.pfnAppendBarrier = (original.CommandList.pfnAppendBarrier && version < ZE_API_VERSION_1_0) ? zeCommandListAppendBarrierUnsupported : original.CommandList.pfnAppendBarrier;
+        table.CommandList.pfnAppendMemoryRangesBarrier = (original.CommandList.pfnAppendMemoryRangesBarrier && version < ZE_API_VERSION_1_0) ? zeCommandListAppendMemoryRangesBarrierUnsupported : original.CommandList.pfnAppendMemoryRangesBarrier;
+        table.Context.pfnSystemBarrier = (original.Context.pfnSystemBarrier && version < ZE_API_VERSION_1_0) ? zeContextSystemBarrierUnsupported : original.Context.pfnSystemBarrier;
+        table.CommandList.pfnAppendMemoryCopy = (original.CommandList.pfnAppendMemoryCopy && version < ZE_API_VERSION_1_0) ? zeCommandListAppendMemoryCopyUnsupported : original.CommandList.pfnAppendMemoryCopy;
+        table.CommandList.pfnAppendMemoryFill = (original.CommandList.pfnAppendMemoryFill && version < ZE_API_VERSION_1_0) ? zeCommandListAppendMemoryFillUnsupported : original.CommandList.pfnAppendMemoryFill;
+        table.CommandList.pfnAppendMemoryCopyRegion = (original.CommandList.pfnAppendMemoryCopyRegion && version < ZE_API_VERSION_1_0) ? zeCommandListAppendMemoryCopyRegionUnsupported : original.CommandList.pfnAppendMemoryCopyRegion;
+        table.CommandList.pfnAppendMemoryCopyFromContext = (original.CommandList.pfnAppendMemoryCopyFromContext && version < ZE_API_VERSION_1_0) ? zeCommandListAppendMemoryCopyFromContextUnsupported : original.CommandList.pfnAppendMemoryCopyFromContext;
+        table.CommandList.pfnAppendImageCopy = (original.CommandList.pfnAppendImageCopy && version < ZE_API_VERSION_1_0) ? zeCommandListAppendImageCopyUnsupported : original.CommandList.pfnAppendImageCopy;
+        table.CommandList.pfnAppendImageCopyRegion = (original.CommandList.pfnAppendImageCopyRegion && version < ZE_API_VERSION_1_0) ? zeCommandListAppendImageCopyRegionUnsupported : original.CommandList.pfnAppendImageCopyRegion;
+        table.CommandList.pfnAppendImageCopyToMemory = (original.CommandList.pfnAppendImageCopyToMemory && version < ZE_API_VERSION_1_0) ? zeCommandListAppendImageCopyToMemoryUnsupported : original.CommandList.pfnAppendImageCopyToMemory;
+        table.CommandList.pfnAppendImageCopyFromMemory = (original.CommandList.pfnAppendImageCopyFromMemory && version < ZE_API_VERSION_1_0) ? zeCommandListAppendImageCopyFromMemoryUnsupported : original.CommandList.pfnAppendImageCopyFromMemory;
+        table.CommandList.pfnAppendMemoryPrefetch = (original.CommandList.pfnAppendMemoryPrefetch && version < ZE_API_VERSION_1_0) ? zeCommandListAppendMemoryPrefetchUnsupported : original.CommandList.pfnAppendMemoryPrefetch;
+        table.CommandList.pfnAppendMemAdvise = (original.CommandList.pfnAppendMemAdvise && version < ZE_API_VERSION_1_0) ? zeCommandListAppendMemAdviseUnsupported : original.CommandList.pfnAppendMemAdvise;
+        table.EventPool.pfnCreate = (original.EventPool.pfnCreate && version < ZE_API_VERSION_1_0) ? zeEventPoolCreateUnsupported : original.EventPool.pfnCreate;
+        table.EventPool.pfnDestroy = (original.EventPool.pfnDestroy && version < ZE_API_VERSION_1_0) ? zeEventPoolDestroyUnsupported : original.EventPool.pfnDestroy;
+        table.Event.pfnCreate = (original.Event.pfnCreate && version < ZE_API_VERSION_1_0) ? zeEventCreateUnsupported : original.Event.pfnCreate;
+        table.Event.pfnCounterBasedCreate = (original.Event.pfnCounterBasedCreate && version < ZE_API_VERSION_1_15) ? zeEventCounterBasedCreateUnsupported : original.Event.pfnCounterBasedCreate;
+        table.Event.pfnDestroy = (original.Event.pfnDestroy && version < ZE_API_VERSION_1_0) ? zeEventDestroyUnsupported : original.Event.pfnDestroy;
+        table.EventPool.pfnGetIpcHandle = (original.EventPool.pfnGetIpcHandle && version < ZE_API_VERSION_1_0) ? zeEventPoolGetIpcHandleUnsupported : original.EventPool.pfnGetIpcHandle;
+        table.EventPool.pfnPutIpcHandle = (original.EventPool.pfnPutIpcHandle && version < ZE_API_VERSION_1_6) ? zeEventPoolPutIpcHandleUnsupported : original.EventPool.pfnPutIpcHandle;
+        table.EventPool.pfnOpenIpcHandle = (original.EventPool.pfnOpenIpcHandle && version < ZE_API_VERSION_1_0) ? zeEventPoolOpenIpcHandleUnsupported : original.EventPool.pfnOpenIpcHandle;
+        table.EventPool.pfnCloseIpcHandle = (original.EventPool.pfnCloseIpcHandle && version < ZE_API_VERSION_1_0) ? zeEventPoolCloseIpcHandleUnsupported : original.EventPool.pfnCloseIpcHandle;
+        table.Event.pfnCounterBasedGetIpcHandle = (original.Event.pfnCounterBasedGetIpcHandle && version < ZE_API_VERSION_1_15) ? zeEventCounterBasedGetIpcHandleUnsupported : original.Event.pfnCounterBasedGetIpcHandle;
+        table.Event.pfnCounterBasedOpenIpcHandle = (original.Event.pfnCounterBasedOpenIpcHandle && version < ZE_API_VERSION_1_15) ? zeEventCounterBasedOpenIpcHandleUnsupported : original.Event.pfnCounterBasedOpenIpcHandle;
+        table.Event.pfnCounterBasedCloseIpcHandle = (original.Event.pfnCounterBasedCloseIpcHandle && version < ZE_API_VERSION_1_15) ? zeEventCounterBasedCloseIpcHandleUnsupported : original.Event.pfnCounterBasedCloseIpcHandle;
+        table.Event.pfnCounterBasedGetDeviceAddress = (original.Event.pfnCounterBasedGetDeviceAddress && version < ZE_API_VERSION_1_15) ? zeEventCounterBasedGetDeviceAddressUnsupported : original.Event.pfnCounterBasedGetDeviceAddress;
+        table.CommandList.pfnAppendSignalEvent = (original.CommandList.pfnAppendSignalEvent && version < ZE_API_VERSION_1_0) ? zeCommandListAppendSignalEventUnsupported : original.CommandList.pfnAppendSignalEvent;
+        table.CommandList.pfnAppendWaitOnEvents = (original.CommandList.pfnAppendWaitOnEvents && version < ZE_API_VERSION_1_0) ? zeCommandListAppendWaitOnEventsUnsupported : original.CommandList.pfnAppendWaitOnEvents;
+        table.Event.pfnHostSignal = (original.Event.pfnHostSignal && version < ZE_API_VERSION_1_0) ? zeEventHostSignalUnsupported : original.Event.pfnHostSignal;
+        table.Event.pfnHostSynchronize = (original.Event.pfnHostSynchronize && version < ZE_API_VERSION_1_0) ? zeEventHostSynchronizeUnsupported : original.Event.pfnHostSynchronize;
+        table.Event.pfnQueryStatus = (original.Event.pfnQueryStatus && version < ZE_API_VERSION_1_0) ? zeEventQueryStatusUnsupported : original.Event.pfnQueryStatus;
+        table.CommandList.pfnAppendEventReset = (original.CommandList.pfnAppendEventReset && version < ZE_API_VERSION_1_0) ? zeCommandListAppendEventResetUnsupported : original.CommandList.pfnAppendEventReset;
+        table.Event.pfnHostReset = (original.Event.pfnHostReset && version < ZE_API_VERSION_1_0) ? zeEventHostResetUnsupported : original.Event.pfnHostReset;
+        table.Event.pfnQueryKernelTimestamp = (original.Event.pfnQueryKernelTimestamp && version < ZE_API_VERSION_1_0) ? zeEventQueryKernelTimestampUnsupported : original.Event.pfnQueryKernelTimestamp;
+        table.CommandList.pfnAppendQueryKernelTimestamps = (original.CommandList.pfnAppendQueryKernelTimestamps && version < ZE_API_VERSION_1_0) ? zeCommandListAppendQueryKernelTimestampsUnsupported : original.CommandList.pfnAppendQueryKernelTimestamps;
+        table.Event.pfnGetEventPool = (original.Event.pfnGetEventPool && version < ZE_API_VERSION_1_9) ? zeEventGetEventPoolUnsupported : original.Event.pfnGetEventPool;
+        table.Event.pfnGetSignalScope = (original.Event.pfnGetSignalScope && version < ZE_API_VERSION_1_9) ? zeEventGetSignalScopeUnsupported : original.Event.pfnGetSignalScope;
+        table.Event.pfnGetWaitScope = (original.Event.pfnGetWaitScope && version < ZE_API_VERSION_1_9) ? zeEventGetWaitScopeUnsupported : original.Event.pfnGetWaitScope;
+        table.EventPool.pfnGetContextHandle = (original.EventPool.pfnGetContextHandle && version < ZE_API_VERSION_1_9) ? zeEventPoolGetContextHandleUnsupported : original.EventPool.pfnGetContextHandle;
+        table.EventPool.pfnGetFlags = (original.EventPool.pfnGetFlags && version < ZE_API_VERSION_1_9) ? zeEventPoolGetFlagsUnsupported : original.EventPool.pfnGetFlags;
+        table.Fence.pfnCreate = (original.Fence.pfnCreate && version < ZE_API_VERSION_1_0) ? zeFenceCreateUnsupported : original.Fence.pfnCreate;
+        table.Fence.pfnDestroy = (original.Fence.pfnDestroy && version < ZE_API_VERSION_1_0) ? zeFenceDestroyUnsupported : original.Fence.pfnDestroy;
+        table.Fence.pfnHostSynchronize = (original.Fence.pfnHostSynchronize && version < ZE_API_VERSION_1_0) ? zeFenceHostSynchronizeUnsupported : original.Fence.pfnHostSynchronize;
+        table.Fence.pfnQueryStatus = (original.Fence.pfnQueryStatus && version < ZE_API_VERSION_1_0) ? zeFenceQueryStatusUnsupported : original.Fence.pfnQueryStatus;
+        table.Fence.pfnReset = (original.Fence.pfnReset && version < ZE_API_VERSION_1_0) ? zeFenceResetUnsupported : original.Fence.pfnReset;
+        table.Image.pfnGetProperties = (original.Image.pfnGetProperties && version < ZE_API_VERSION_1_0) ? zeImageGetPropertiesUnsupported : original.Image.pfnGetProperties;
+        table.Image.pfnCreate = (original.Image.pfnCreate && version < ZE_API_VERSION_1_0) ? zeImageCreateUnsupported : original.Image.pfnCreate;
+        table.Image.pfnDestroy = (original.Image.pfnDestroy && version < ZE_API_VERSION_1_0) ? zeImageDestroyUnsupported : original.Image.pfnDestroy;
+        table.Mem.pfnAllocShared = (original.Mem.pfnAllocShared && version < ZE_API_VERSION_1_0) ? zeMemAllocSharedUnsupported : original.Mem.pfnAllocShared;
+        table.Mem.pfnAllocDevice = (original.Mem.pfnAllocDevice && version < ZE_API_VERSION_1_0) ? zeMemAllocDeviceUnsupported : original.Mem.pfnAllocDevice;
+        table.Mem.pfnAllocHost = (original.Mem.pfnAllocHost && version < ZE_API_VERSION_1_0) ? zeMemAllocHostUnsupported : original.Mem.pfnAllocHost;
+        table.Mem.pfnFree = (original.Mem.pfnFree && version < ZE_API_VERSION_1_0) ? zeMemFreeUnsupported : original.Mem.pfnFree;
+        table.Mem.pfnGetAllocProperties = (original.Mem.pfnGetAllocProperties && version < ZE_API_VERSION_1_0) ? zeMemGetAllocPropertiesUnsupported : original.Mem.pfnGetAllocProperties;
+        table.Mem.pfnGetAddressRange = (original.Mem.pfnGetAddressRange && version < ZE_API_VERSION_1_0) ? zeMemGetAddressRangeUnsupported : original.Mem.pfnGetAddressRange;
+        table.Mem.pfnGetIpcHandle = (original.Mem.pfnGetIpcHandle && version < ZE_API_VERSION_1_0) ? zeMemGetIpcHandleUnsupported : original.Mem.pfnGetIpcHandle;
+        table.MemExp.pfnGetIpcHandleFromFileDescriptorExp = (original.MemExp.pfnGetIpcHandleFromFileDescriptorExp && version < ZE_API_VERSION_1_6) ? zeMemGetIpcHandleFromFileDescriptorExpUnsupported : original.MemExp.pfnGetIpcHandleFromFileDescriptorExp;
+        table.MemExp.pfnGetFileDescriptorFromIpcHandleExp = (original.MemExp.pfnGetFileDescriptorFromIpcHandleExp && version < ZE_API_VERSION_1_6) ? zeMemGetFileDescriptorFromIpcHandleExpUnsupported : original.MemExp.pfnGetFileDescriptorFromIpcHandleExp;
+        table.Mem.pfnPutIpcHandle = (original.Mem.pfnPutIpcHandle && version < ZE_API_VERSION_1_6) ? zeMemPutIpcHandleUnsupported : original.Mem.pfnPutIpcHandle;
+        table.Mem.pfnOpenIpcHandle = (original.Mem.pfnOpenIpcHandle && version < ZE_API_VERSION_1_0) ? zeMemOpenIpcHandleUnsupported : original.Mem.pfnOpenIpcHandle;
+        table.Mem.pfnCloseIpcHandle = (original.Mem.pfnCloseIpcHandle && version < ZE_API_VERSION_1_0) ? zeMemCloseIpcHandleUnsupported : original.Mem.pfnCloseIpcHandle;
+        table.MemExp.pfnSetAtomicAccessAttributeExp = (original.MemExp.pfnSetAtomicAccessAttributeExp && version < ZE_API_VERSION_1_7) ? zeMemSetAtomicAccessAttributeExpUnsupported : original.MemExp.pfnSetAtomicAccessAttributeExp;
+        table.MemExp.pfnGetAtomicAccessAttributeExp = (original.MemExp.pfnGetAtomicAccessAttributeExp && version < ZE_API_VERSION_1_7) ? zeMemGetAtomicAccessAttributeExpUnsupported : original.MemExp.pfnGetAtomicAccessAttributeExp;
+        table.Module.pfnCreate = (original.Module.pfnCreate && version < ZE_API_VERSION_1_0) ? zeModuleCreateUnsupported : original.Module.pfnCreate;
+        table.Module.pfnDestroy = (original.Module.pfnDestroy && version < ZE_API_VERSION_1_0) ? zeModuleDestroyUnsupported : original.Module.pfnDestroy;
+        table.Module.pfnDynamicLink = (original.Module.pfnDynamicLink && version < ZE_API_VERSION_1_0) ? zeModuleDynamicLinkUnsupported : original.Module.pfnDynamicLink;
+        table.ModuleBuildLog.pfnDestroy = (original.ModuleBuildLog.pfnDestroy && version < ZE_API_VERSION_1_0) ? zeModuleBuildLogDestroyUnsupported : original.ModuleBuildLog.pfnDestroy;
+        table.ModuleBuildLog.pfnGetString = (original.ModuleBuildLog.pfnGetString && version < ZE_API_VERSION_1_0) ? zeModuleBuildLogGetStringUnsupported : original.ModuleBuildLog.pfnGetString;
+        table.Module.pfnGetNativeBinary = (original.Module.pfnGetNativeBinary && version < ZE_API_VERSION_1_0) ? zeModuleGetNativeBinaryUnsupported : original.Module.pfnGetNativeBinary;
+        table.Module.pfnGetGlobalPointer = (original.Module.pfnGetGlobalPointer && version < ZE_API_VERSION_1_0) ? zeModuleGetGlobalPointerUnsupported : original.Module.pfnGetGlobalPointer;
+        table.Module.pfnGetKernelNames = (original.Module.pfnGetKernelNames && version < ZE_API_VERSION_1_0) ? zeModuleGetKernelNamesUnsupported : original.Module.pfnGetKernelNames;
+        table.Module.pfnGetProperties = (original.Module.pfnGetProperties && version < ZE_API_VERSION_1_0) ? zeModuleGetPropertiesUnsupported : original.Module.pfnGetProperties;
+        table.Kernel.pfnCreate = (original.Kernel.pfnCreate && version < ZE_API_VERSION_1_0) ? zeKernelCreateUnsupported : original.Kernel.pfnCreate;
+        table.Kernel.pfnDestroy = (original.Kernel.pfnDestroy && version < ZE_API_VERSION_1_0) ? zeKernelDestroyUnsupported : original.Kernel.pfnDestroy;
+        table.Module.pfnGetFunctionPointer = (original.Module.pfnGetFunctionPointer && version < ZE_API_VERSION_1_0) ? zeModuleGetFunctionPointerUnsupported : original.Module.pfnGetFunctionPointer;
+        table.Kernel.pfnSetGroupSize = (original.Kernel.pfnSetGroupSize && version < ZE_API_VERSION_1_0) ? zeKernelSetGroupSizeUnsupported : original.Kernel.pfnSetGroupSize;
+        table.Kernel.pfnSuggestGroupSize = (original.Kernel.pfnSuggestGroupSize && version < ZE_API_VERSION_1_0) ? zeKernelSuggestGroupSizeUnsupported : original.Kernel.pfnSuggestGroupSize;
+        table.Kernel.pfnSuggestMaxCooperativeGroupCount = (original.Kernel.pfnSuggestMaxCooperativeGroupCount && version < ZE_API_VERSION_1_0) ? zeKernelSuggestMaxCooperativeGroupCountUnsupported : original.Kernel.pfnSuggestMaxCooperativeGroupCount;
+        table.Kernel.pfnSetArgumentValue = (original.Kernel.pfnSetArgumentValue && version < ZE_API_VERSION_1_0) ? zeKernelSetArgumentValueUnsupported : original.Kernel.pfnSetArgumentValue;
+        table.Kernel.pfnSetIndirectAccess = (original.Kernel.pfnSetIndirectAccess && version < ZE_API_VERSION_1_0) ? zeKernelSetIndirectAccessUnsupported : original.Kernel.pfnSetIndirectAccess;
+        table.Kernel.pfnGetIndirectAccess = (original.Kernel.pfnGetIndirectAccess && version < ZE_API_VERSION_1_0) ? zeKernelGetIndirectAccessUnsupported : original.Kernel.pfnGetIndirectAccess;
+        table.Kernel.pfnGetSourceAttributes = (original.Kernel.pfnGetSourceAttributes && version < ZE_API_VERSION_1_0) ? zeKernelGetSourceAttributesUnsupported : original.Kernel.pfnGetSourceAttributes;
+        table.Kernel.pfnSetCacheConfig = (original.Kernel.pfnSetCacheConfig && version < ZE_API_VERSION_1_0) ? zeKernelSetCacheConfigUnsupported : original.Kernel.pfnSetCacheConfig;
+        table.Kernel.pfnGetProperties = (original.Kernel.pfnGetProperties && version < ZE_API_VERSION_1_0) ? zeKernelGetPropertiesUnsupported : original.Kernel.pfnGetProperties;
+        table.Kernel.pfnGetName = (original.Kernel.pfnGetName && version < ZE_API_VERSION_1_0) ? zeKernelGetNameUnsupported : original.Kernel.pfnGetName;
+        table.CommandList.pfnAppendLaunchKernel = (original.CommandList.pfnAppendLaunchKernel && version < ZE_API_VERSION_1_0) ? zeCommandListAppendLaunchKernelUnsupported : original.CommandList.pfnAppendLaunchKernel;
+        table.CommandList.pfnAppendLaunchKernelWithParameters = (original.CommandList.pfnAppendLaunchKernelWithParameters && version < ZE_API_VERSION_1_14) ? zeCommandListAppendLaunchKernelWithParametersUnsupported : original.CommandList.pfnAppendLaunchKernelWithParameters;
+        table.CommandList.pfnAppendLaunchKernelWithArguments = (original.CommandList.pfnAppendLaunchKernelWithArguments && version < ZE_API_VERSION_1_14) ? zeCommandListAppendLaunchKernelWithArgumentsUnsupported : original.CommandList.pfnAppendLaunchKernelWithArguments;
+        table.CommandList.pfnAppendLaunchCooperativeKernel = (original.CommandList.pfnAppendLaunchCooperativeKernel && version < ZE_API_VERSION_1_0) ? zeCommandListAppendLaunchCooperativeKernelUnsupported : original.CommandList.pfnAppendLaunchCooperativeKernel;
+        table.CommandList.pfnAppendLaunchKernelIndirect = (original.CommandList.pfnAppendLaunchKernelIndirect && version < ZE_API_VERSION_1_0) ? zeCommandListAppendLaunchKernelIndirectUnsupported : original.CommandList.pfnAppendLaunchKernelIndirect;
+        table.CommandList.pfnAppendLaunchMultipleKernelsIndirect = (original.CommandList.pfnAppendLaunchMultipleKernelsIndirect && version < ZE_API_VERSION_1_0) ? zeCommandListAppendLaunchMultipleKernelsIndirectUnsupported : original.CommandList.pfnAppendLaunchMultipleKernelsIndirect;
+        table.Context.pfnMakeMemoryResident = (original.Context.pfnMakeMemoryResident && version < ZE_API_VERSION_1_0) ? zeContextMakeMemoryResidentUnsupported : original.Context.pfnMakeMemoryResident;
+        table.Context.pfnEvictMemory = (original.Context.pfnEvictMemory && version < ZE_API_VERSION_1_0) ? zeContextEvictMemoryUnsupported : original.Context.pfnEvictMemory;
+        table.Context.pfnMakeImageResident = (original.Context.pfnMakeImageResident && version < ZE_API_VERSION_1_0) ? zeContextMakeImageResidentUnsupported : original.Context.pfnMakeImageResident;
+        table.Context.pfnEvictImage = (original.Context.pfnEvictImage && version < ZE_API_VERSION_1_0) ? zeContextEvictImageUnsupported : original.Context.pfnEvictImage;
+        table.Sampler.pfnCreate = (original.Sampler.pfnCreate && version < ZE_API_VERSION_1_0) ? zeSamplerCreateUnsupported : original.Sampler.pfnCreate;
+        table.Sampler.pfnDestroy = (original.Sampler.pfnDestroy && version < ZE_API_VERSION_1_0) ? zeSamplerDestroyUnsupported : original.Sampler.pfnDestroy;
+        table.VirtualMem.pfnReserve = (original.VirtualMem.pfnReserve && version < ZE_API_VERSION_1_0) ? zeVirtualMemReserveUnsupported : original.VirtualMem.pfnReserve;
+        table.VirtualMem.pfnFree = (original.VirtualMem.pfnFree && version < ZE_API_VERSION_1_0) ? zeVirtualMemFreeUnsupported : original.VirtualMem.pfnFree;
+        table.VirtualMem.pfnQueryPageSize = (original.VirtualMem.pfnQueryPageSize && version < ZE_API_VERSION_1_0) ? zeVirtualMemQueryPageSizeUnsupported : original.VirtualMem.pfnQueryPageSize;
+        table.PhysicalMem.pfnGetProperties = (original.PhysicalMem.pfnGetProperties && version < ZE_API_VERSION_1_15) ? zePhysicalMemGetPropertiesUnsupported : original.PhysicalMem.pfnGetProperties;
+        table.PhysicalMem.pfnCreate = (original.PhysicalMem.pfnCreate && version < ZE_API_VERSION_1_0) ? zePhysicalMemCreateUnsupported : original.PhysicalMem.pfnCreate;
+        table.PhysicalMem.pfnDestroy = (original.PhysicalMem.pfnDestroy && version < ZE_API_VERSION_1_0) ? zePhysicalMemDestroyUnsupported : original.PhysicalMem.pfnDestroy;
+        table.VirtualMem.pfnMap = (original.VirtualMem.pfnMap && version < ZE_API_VERSION_1_0) ? zeVirtualMemMapUnsupported : original.VirtualMem.pfnMap;
+        table.VirtualMem.pfnUnmap = (original.VirtualMem.pfnUnmap && version < ZE_API_VERSION_1_0) ? zeVirtualMemUnmapUnsupported : original.VirtualMem.pfnUnmap;
+        table.VirtualMem.pfnSetAccessAttribute = (original.VirtualMem.pfnSetAccessAttribute && version < ZE_API_VERSION_1_0) ? zeVirtualMemSetAccessAttributeUnsupported : original.VirtualMem.pfnSetAccessAttribute;
+        table.VirtualMem.pfnGetAccessAttribute = (original.VirtualMem.pfnGetAccessAttribute && version < ZE_API_VERSION_1_0) ? zeVirtualMemGetAccessAttributeUnsupported : original.VirtualMem.pfnGetAccessAttribute;
+        table.KernelExp.pfnSetGlobalOffsetExp = (original.KernelExp.pfnSetGlobalOffsetExp && version < ZE_API_VERSION_1_1) ? zeKernelSetGlobalOffsetExpUnsupported : original.KernelExp.pfnSetGlobalOffsetExp;
+        table.KernelExp.pfnGetBinaryExp = (original.KernelExp.pfnGetBinaryExp && version < ZE_API_VERSION_1_11) ? zeKernelGetBinaryExpUnsupported : original.KernelExp.pfnGetBinaryExp;
+        table.Device.pfnImportExternalSemaphoreExt = (original.Device.pfnImportExternalSemaphoreExt && version < ZE_API_VERSION_1_12) ? zeDeviceImportExternalSemaphoreExtUnsupported : original.Device.pfnImportExternalSemaphoreExt;
+        table.Device.pfnReleaseExternalSemaphoreExt = (original.Device.pfnReleaseExternalSemaphoreExt && version < ZE_API_VERSION_1_12) ? zeDeviceReleaseExternalSemaphoreExtUnsupported : original.Device.pfnReleaseExternalSemaphoreExt;
+        table.CommandList.pfnAppendSignalExternalSemaphoreExt = (original.CommandList.pfnAppendSignalExternalSemaphoreExt && version < ZE_API_VERSION_1_12) ? zeCommandListAppendSignalExternalSemaphoreExtUnsupported : original.CommandList.pfnAppendSignalExternalSemaphoreExt;
+        table.CommandList.pfnAppendWaitExternalSemaphoreExt = (original.CommandList.pfnAppendWaitExternalSemaphoreExt && version < ZE_API_VERSION_1_12) ? zeCommandListAppendWaitExternalSemaphoreExtUnsupported : original.CommandList.pfnAppendWaitExternalSemaphoreExt;
+        table.RTASBuilder.pfnCreateExt = (original.RTASBuilder.pfnCreateExt && version < ZE_API_VERSION_1_13) ? zeRTASBuilderCreateExtUnsupported : original.RTASBuilder.pfnCreateExt;
+        table.RTASBuilder.pfnGetBuildPropertiesExt = (original.RTASBuilder.pfnGetBuildPropertiesExt && version < ZE_API_VERSION_1_13) ? zeRTASBuilderGetBuildPropertiesExtUnsupported : original.RTASBuilder.pfnGetBuildPropertiesExt;
+        table.Driver.pfnRTASFormatCompatibilityCheckExt = (original.Driver.pfnRTASFormatCompatibilityCheckExt && version < ZE_API_VERSION_1_13) ? zeDriverRTASFormatCompatibilityCheckExtUnsupported : original.Driver.pfnRTASFormatCompatibilityCheckExt;
+        table.RTASBuilder.pfnBuildExt = (original.RTASBuilder.pfnBuildExt && version < ZE_API_VERSION_1_13) ? zeRTASBuilderBuildExtUnsupported : original.RTASBuilder.pfnBuildExt;
+        table.RTASBuilder.pfnCommandListAppendCopyExt = (original.RTASBuilder.pfnCommandListAppendCopyExt && version < ZE_API_VERSION_1_13) ? zeRTASBuilderCommandListAppendCopyExtUnsupported : original.RTASBuilder.pfnCommandListAppendCopyExt;
+        table.RTASBuilder.pfnDestroyExt = (original.RTASBuilder.pfnDestroyExt && version < ZE_API_VERSION_1_13) ? zeRTASBuilderDestroyExtUnsupported : original.RTASBuilder.pfnDestroyExt;
+        table.RTASParallelOperation.pfnCreateExt = (original.RTASParallelOperation.pfnCreateExt && version < ZE_API_VERSION_1_13) ? zeRTASParallelOperationCreateExtUnsupported : original.RTASParallelOperation.pfnCreateExt;
+        table.RTASParallelOperation.pfnGetPropertiesExt = (original.RTASParallelOperation.pfnGetPropertiesExt && version < ZE_API_VERSION_1_13) ? zeRTASParallelOperationGetPropertiesExtUnsupported : original.RTASParallelOperation.pfnGetPropertiesExt;
+        table.RTASParallelOperation.pfnJoinExt = (original.RTASParallelOperation.pfnJoinExt && version < ZE_API_VERSION_1_13) ? zeRTASParallelOperationJoinExtUnsupported : original.RTASParallelOperation.pfnJoinExt;
+        table.RTASParallelOperation.pfnDestroyExt = (original.RTASParallelOperation.pfnDestroyExt && version < ZE_API_VERSION_1_13) ? zeRTASParallelOperationDestroyExtUnsupported : original.RTASParallelOperation.pfnDestroyExt;
+        table.Device.pfnGetVectorWidthPropertiesExt = (original.Device.pfnGetVectorWidthPropertiesExt && version < ZE_API_VERSION_1_13) ? zeDeviceGetVectorWidthPropertiesExtUnsupported : original.Device.pfnGetVectorWidthPropertiesExt;
+        table.KernelExp.pfnGetAllocationPropertiesExp = (original.KernelExp.pfnGetAllocationPropertiesExp && version < ZE_API_VERSION_1_14) ? zeKernelGetAllocationPropertiesExpUnsupported : original.KernelExp.pfnGetAllocationPropertiesExp;
+        table.Mem.pfnGetIpcHandleWithProperties = (original.Mem.pfnGetIpcHandleWithProperties && version < ZE_API_VERSION_1_15) ? zeMemGetIpcHandleWithPropertiesUnsupported : original.Mem.pfnGetIpcHandleWithProperties;
+        table.Device.pfnReserveCacheExt = (original.Device.pfnReserveCacheExt && version < ZE_API_VERSION_1_2) ? zeDeviceReserveCacheExtUnsupported : original.Device.pfnReserveCacheExt;
+        table.Device.pfnSetCacheAdviceExt = (original.Device.pfnSetCacheAdviceExt && version < ZE_API_VERSION_1_2) ? zeDeviceSetCacheAdviceExtUnsupported : original.Device.pfnSetCacheAdviceExt;
+        table.EventExp.pfnQueryTimestampsExp = (original.EventExp.pfnQueryTimestampsExp && version < ZE_API_VERSION_1_2) ? zeEventQueryTimestampsExpUnsupported : original.EventExp.pfnQueryTimestampsExp;
+        table.ImageExp.pfnGetMemoryPropertiesExp = (original.ImageExp.pfnGetMemoryPropertiesExp && version < ZE_API_VERSION_1_2) ? zeImageGetMemoryPropertiesExpUnsupported : original.ImageExp.pfnGetMemoryPropertiesExp;
+        table.Image.pfnViewCreateExt = (original.Image.pfnViewCreateExt && version < ZE_API_VERSION_1_5) ? zeImageViewCreateExtUnsupported : original.Image.pfnViewCreateExt;
+        table.ImageExp.pfnViewCreateExp = (original.ImageExp.pfnViewCreateExp && version < ZE_API_VERSION_1_2) ? zeImageViewCreateExpUnsupported : original.ImageExp.pfnViewCreateExp;
+        table.KernelExp.pfnSchedulingHintExp = (original.KernelExp.pfnSchedulingHintExp && version < ZE_API_VERSION_1_2) ? zeKernelSchedulingHintExpUnsupported : original.KernelExp.pfnSchedulingHintExp;
+        table.Device.pfnPciGetPropertiesExt = (original.Device.pfnPciGetPropertiesExt && version < ZE_API_VERSION_1_3) ? zeDevicePciGetPropertiesExtUnsupported : original.Device.pfnPciGetPropertiesExt;
+        table.CommandList.pfnAppendImageCopyToMemoryExt = (original.CommandList.pfnAppendImageCopyToMemoryExt && version < ZE_API_VERSION_1_3) ? zeCommandListAppendImageCopyToMemoryExtUnsupported : original.CommandList.pfnAppendImageCopyToMemoryExt;
+        table.CommandList.pfnAppendImageCopyFromMemoryExt = (original.CommandList.pfnAppendImageCopyFromMemoryExt && version < ZE_API_VERSION_1_3) ? zeCommandListAppendImageCopyFromMemoryExtUnsupported : original.CommandList.pfnAppendImageCopyFromMemoryExt;
+        table.Image.pfnGetAllocPropertiesExt = (original.Image.pfnGetAllocPropertiesExt && version < ZE_API_VERSION_1_3) ? zeImageGetAllocPropertiesExtUnsupported : original.Image.pfnGetAllocPropertiesExt;
+        table.Module.pfnInspectLinkageExt = (original.Module.pfnInspectLinkageExt && version < ZE_API_VERSION_1_3) ? zeModuleInspectLinkageExtUnsupported : original.Module.pfnInspectLinkageExt;
+        table.Mem.pfnFreeExt = (original.Mem.pfnFreeExt && version < ZE_API_VERSION_1_3) ? zeMemFreeExtUnsupported : original.Mem.pfnFreeExt;
+        table.FabricVertexExp.pfnGetExp = (original.FabricVertexExp.pfnGetExp && version < ZE_API_VERSION_1_4) ? zeFabricVertexGetExpUnsupported : original.FabricVertexExp.pfnGetExp;
+        table.FabricVertexExp.pfnGetSubVerticesExp = (original.FabricVertexExp.pfnGetSubVerticesExp && version < ZE_API_VERSION_1_4) ? zeFabricVertexGetSubVerticesExpUnsupported : original.FabricVertexExp.pfnGetSubVerticesExp;
+        table.FabricVertexExp.pfnGetPropertiesExp = (original.FabricVertexExp.pfnGetPropertiesExp && version < ZE_API_VERSION_1_4) ? zeFabricVertexGetPropertiesExpUnsupported : original.FabricVertexExp.pfnGetPropertiesExp;
+        table.FabricVertexExp.pfnGetDeviceExp = (original.FabricVertexExp.pfnGetDeviceExp && version < ZE_API_VERSION_1_4) ? zeFabricVertexGetDeviceExpUnsupported : original.FabricVertexExp.pfnGetDeviceExp;
+        table.DeviceExp.pfnGetFabricVertexExp = (original.DeviceExp.pfnGetFabricVertexExp && version < ZE_API_VERSION_1_4) ? zeDeviceGetFabricVertexExpUnsupported : original.DeviceExp.pfnGetFabricVertexExp;
+        table.FabricEdgeExp.pfnGetExp = (original.FabricEdgeExp.pfnGetExp && version < ZE_API_VERSION_1_4) ? zeFabricEdgeGetExpUnsupported : original.FabricEdgeExp.pfnGetExp;
+        table.FabricEdgeExp.pfnGetVerticesExp = (original.FabricEdgeExp.pfnGetVerticesExp && version < ZE_API_VERSION_1_4) ? zeFabricEdgeGetVerticesExpUnsupported : original.FabricEdgeExp.pfnGetVerticesExp;
+        table.FabricEdgeExp.pfnGetPropertiesExp = (original.FabricEdgeExp.pfnGetPropertiesExp && version < ZE_API_VERSION_1_4) ? zeFabricEdgeGetPropertiesExpUnsupported : original.FabricEdgeExp.pfnGetPropertiesExp;
+        table.Event.pfnQueryKernelTimestampsExt = (original.Event.pfnQueryKernelTimestampsExt && version < ZE_API_VERSION_1_6) ? zeEventQueryKernelTimestampsExtUnsupported : original.Event.pfnQueryKernelTimestampsExt;
+        table.RTASBuilderExp.pfnCreateExp = (original.RTASBuilderExp.pfnCreateExp && version < ZE_API_VERSION_1_7) ? zeRTASBuilderCreateExpUnsupported : original.RTASBuilderExp.pfnCreateExp;
+        table.RTASBuilderExp.pfnGetBuildPropertiesExp = (original.RTASBuilderExp.pfnGetBuildPropertiesExp && version < ZE_API_VERSION_1_7) ? zeRTASBuilderGetBuildPropertiesExpUnsupported : original.RTASBuilderExp.pfnGetBuildPropertiesExp;
+        table.DriverExp.pfnRTASFormatCompatibilityCheckExp = (original.DriverExp.pfnRTASFormatCompatibilityCheckExp && version < ZE_API_VERSION_1_7) ? zeDriverRTASFormatCompatibilityCheckExpUnsupported : original.DriverExp.pfnRTASFormatCompatibilityCheckExp;
+        table.RTASBuilderExp.pfnBuildExp = (original.RTASBuilderExp.pfnBuildExp && version < ZE_API_VERSION_1_7) ? zeRTASBuilderBuildExpUnsupported : original.RTASBuilderExp.pfnBuildExp;
+        table.RTASBuilderExp.pfnDestroyExp = (original.RTASBuilderExp.pfnDestroyExp && version < ZE_API_VERSION_1_7) ? zeRTASBuilderDestroyExpUnsupported : original.RTASBuilderExp.pfnDestroyExp;
+        table.RTASParallelOperationExp.pfnCreateExp = (original.RTASParallelOperationExp.pfnCreateExp && version < ZE_API_VERSION_1_7) ? zeRTASParallelOperationCreateExpUnsupported : original.RTASParallelOperationExp.pfnCreateExp;
+        table.RTASParallelOperationExp.pfnGetPropertiesExp = (original.RTASParallelOperationExp.pfnGetPropertiesExp && version < ZE_API_VERSION_1_7) ? zeRTASParallelOperationGetPropertiesExpUnsupported : original.RTASParallelOperationExp.pfnGetPropertiesExp;
+        table.RTASParallelOperationExp.pfnJoinExp = (original.RTASParallelOperationExp.pfnJoinExp && version < ZE_API_VERSION_1_7) ? zeRTASParallelOperationJoinExpUnsupported : original.RTASParallelOperationExp.pfnJoinExp;
+        table.RTASParallelOperationExp.pfnDestroyExp = (original.RTASParallelOperationExp.pfnDestroyExp && version < ZE_API_VERSION_1_7) ? zeRTASParallelOperationDestroyExpUnsupported : original.RTASParallelOperationExp.pfnDestroyExp;
+        table.Mem.pfnGetPitchFor2dImage = (original.Mem.pfnGetPitchFor2dImage && version < ZE_API_VERSION_1_9) ? zeMemGetPitchFor2dImageUnsupported : original.Mem.pfnGetPitchFor2dImage;
+        table.ImageExp.pfnGetDeviceOffsetExp = (original.ImageExp.pfnGetDeviceOffsetExp && version < ZE_API_VERSION_1_9) ? zeImageGetDeviceOffsetExpUnsupported : original.ImageExp.pfnGetDeviceOffsetExp;
+        table.CommandListExp.pfnCreateCloneExp = (original.CommandListExp.pfnCreateCloneExp && version < ZE_API_VERSION_1_9) ? zeCommandListCreateCloneExpUnsupported : original.CommandListExp.pfnCreateCloneExp;
+        table.CommandListExp.pfnImmediateAppendCommandListsExp = (original.CommandListExp.pfnImmediateAppendCommandListsExp && version < ZE_API_VERSION_1_9) ? zeCommandListImmediateAppendCommandListsExpUnsupported : original.CommandListExp.pfnImmediateAppendCommandListsExp;
+        table.CommandListExp.pfnGetNextCommandIdExp = (original.CommandListExp.pfnGetNextCommandIdExp && version < ZE_API_VERSION_1_9) ? zeCommandListGetNextCommandIdExpUnsupported : original.CommandListExp.pfnGetNextCommandIdExp;
+        table.CommandListExp.pfnGetNextCommandIdWithKernelsExp = (original.CommandListExp.pfnGetNextCommandIdWithKernelsExp && version < ZE_API_VERSION_1_10) ? zeCommandListGetNextCommandIdWithKernelsExpUnsupported : original.CommandListExp.pfnGetNextCommandIdWithKernelsExp;
+        table.CommandListExp.pfnUpdateMutableCommandsExp = (original.CommandListExp.pfnUpdateMutableCommandsExp && version < ZE_API_VERSION_1_9) ? zeCommandListUpdateMutableCommandsExpUnsupported : original.CommandListExp.pfnUpdateMutableCommandsExp;
+        table.CommandListExp.pfnUpdateMutableCommandSignalEventExp = (original.CommandListExp.pfnUpdateMutableCommandSignalEventExp && version < ZE_API_VERSION_1_9) ? zeCommandListUpdateMutableCommandSignalEventExpUnsupported : original.CommandListExp.pfnUpdateMutableCommandSignalEventExp;
+        table.CommandListExp.pfnUpdateMutableCommandWaitEventsExp = (original.CommandListExp.pfnUpdateMutableCommandWaitEventsExp && version < ZE_API_VERSION_1_9) ? zeCommandListUpdateMutableCommandWaitEventsExpUnsupported : original.CommandListExp.pfnUpdateMutableCommandWaitEventsExp;
+        table.CommandListExp.pfnUpdateMutableCommandKernelsExp = (original.CommandListExp.pfnUpdateMutableCommandKernelsExp && version < ZE_API_VERSION_1_10) ? zeCommandListUpdateMutableCommandKernelsExpUnsupported : original.CommandListExp.pfnUpdateMutableCommandKernelsExp;
     }
 };
 } // namespace validation_layer
@@ -9,35 +9,31 @@
  *
  */
 #pragma once
-#include "../zel_global_certification_state.h"
-#include "zer_entry_points.h"
+#include "zer_ddi.h"
 
 namespace validation_layer {
-class ZERcertificationCheckerGenerated : public ZERValidationEntryPoints {
+// APIs newer than the certification version are redirected to an
+// Unsupported stub in the layer's DDI table; allowed APIs are left untouched.
+class ZERcertificationCheckerGenerated {
 public:
-    virtual ze_result_t zerGetLastErrorDescriptionPrologue( const char** ppString ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_14) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
+    static ze_result_t ZE_APICALL zerGetLastErrorDescriptionUnsupported( const char** ppString ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
-    virtual ze_result_t zerTranslateDeviceHandleToIdentifierPrologue( ze_device_handle_t hDevice ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_14) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
+    static uint32_t ZE_APICALL zerTranslateDeviceHandleToIdentifierUnsupported( ze_device_handle_t hDevice ) {
+        return UINT32_MAX;
     }
-    virtual ze_result_t zerTranslateIdentifierToDeviceHandlePrologue( uint32_t identifier ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_14) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
+    static ze_device_handle_t ZE_APICALL zerTranslateIdentifierToDeviceHandleUnsupported( uint32_t identifier ) {
+        return nullptr;
     }
-    virtual ze_result_t zerGetDefaultContextPrologue( void ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_14) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
+    static ze_context_handle_t ZE_APICALL zerGetDefaultContextUnsupported( void ) {
+        return nullptr;
+    }
+
+    static void applyCertification(zer_dditable_t &table, const zer_dditable_t &original, ze_api_version_t version) {
+        table.Global.pfnGetLastErrorDescription = (original.Global.pfnGetLastErrorDescription && version < ZE_API_VERSION_1_14) ? zerGetLastErrorDescriptionUnsupported : original.Global.pfnGetLastErrorDescription;
+        table.Global.pfnTranslateDeviceHandleToIdentifier = (original.Global.pfnTranslateDeviceHandleToIdentifier && version < ZE_API_VERSION_1_14) ? zerTranslateDeviceHandleToIdentifierUnsupported : original.Global.pfnTranslateDeviceHandleToIdentifier;
+        table.Global.pfnTranslateIdentifierToDeviceHandle = (original.Global.pfnTranslateIdentifierToDeviceHandle && version < ZE_API_VERSION_1_14) ? zerTranslateIdentifierToDeviceHandleUnsupported : original.Global.pfnTranslateIdentifierToDeviceHandle;
+        table.Global.pfnGetDefaultContext = (original.Global.pfnGetDefaultContext && version < ZE_API_VERSION_1_14) ? zerGetDefaultContextUnsupported : original.Global.pfnGetDefaultContext;
     }
 };
 } // namespace validation_layer
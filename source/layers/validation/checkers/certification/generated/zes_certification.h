@@ -9,911 +9,615 @@
  *
  */
 #pragma once
-#include "../zel_global_certification_state.h"
-#include "zes_entry_points.h"
+#include "zes_ddi.h"
 
 namespace validation_layer {
-class ZEScertificationCheckerGenerated : public ZESValidationEntryPoints {
+// APIs newer than the certification version are redirected to an
+// Unsupported stub in the layer's DDI table; allowed APIs are left untouched.
+class ZEScertificationCheckerGenerated {
 public:
-    virtual ze_result_t zesInitPrologue( zes_init_flags_t flags ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_5) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesDriverGetPrologue( uint32_t* pCount, zes_driver_handle_t* phDrivers ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_5) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesDriverGetExtensionPropertiesPrologue( zes_driver_handle_t hDriver, uint32_t* pCount, zes_driver_extension_properties_t* pExtensionProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_8) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesDriverGetExtensionFunctionAddressPrologue( zes_driver_handle_t hDriver, const char* name, void** ppFunctionAddress ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_8) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesDeviceGetPrologue( zes_driver_handle_t hDriver, uint32_t* pCount, zes_device_handle_t* phDevices ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_5) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesDeviceGetPropertiesPrologue( zes_device_handle_t hDevice, zes_device_properties_t* pProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesDeviceGetStatePrologue( zes_device_handle_t hDevice, zes_device_state_t* pState ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesDeviceResetPrologue( zes_device_handle_t hDevice, ze_bool_t force ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesDeviceResetExtPrologue( zes_device_handle_t hDevice, zes_reset_properties_t* pProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_7) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesDeviceProcessesGetStatePrologue( zes_device_handle_t hDevice, uint32_t* pCount, zes_process_state_t* pProcesses ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesDevicePciGetPropertiesPrologue( zes_device_handle_t hDevice, zes_pci_properties_t* pProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesDevicePciGetStatePrologue( zes_device_handle_t hDevice, zes_pci_state_t* pState ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesDevicePciGetBarsPrologue( zes_device_handle_t hDevice, uint32_t* pCount, zes_pci_bar_properties_t* pProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesDevicePciGetStatsPrologue( zes_device_handle_t hDevice, zes_pci_stats_t* pStats ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesDeviceSetOverclockWaiverPrologue( zes_device_handle_t hDevice ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_5) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesDeviceGetOverclockDomainsPrologue( zes_device_handle_t hDevice, uint32_t* pOverclockDomains ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_5) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesDeviceGetOverclockControlsPrologue( zes_device_handle_t hDevice, zes_overclock_domain_t domainType, uint32_t* pAvailableControls ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_5) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesDeviceResetOverclockSettingsPrologue( zes_device_handle_t hDevice, ze_bool_t onShippedState ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_5) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesDeviceReadOverclockStatePrologue( zes_device_handle_t hDevice, zes_overclock_mode_t* pOverclockMode, ze_bool_t* pWaiverSetting, ze_bool_t* pOverclockState, zes_pending_action_t* pPendingAction, ze_bool_t* pPendingReset ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_5) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesDeviceEnumOverclockDomainsPrologue( zes_device_handle_t hDevice, uint32_t* pCount, zes_overclock_handle_t* phDomainHandle ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_5) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesOverclockGetDomainPropertiesPrologue( zes_overclock_handle_t hDomainHandle, zes_overclock_properties_t* pDomainProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_5) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesOverclockGetDomainVFPropertiesPrologue( zes_overclock_handle_t hDomainHandle, zes_vf_property_t* pVFProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_5) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesOverclockGetDomainControlPropertiesPrologue( zes_overclock_handle_t hDomainHandle, zes_overclock_control_t DomainControl, zes_control_property_t* pControlProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_5) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesOverclockGetControlCurrentValuePrologue( zes_overclock_handle_t hDomainHandle, zes_overclock_control_t DomainControl, double* pValue ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_5) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesOverclockGetControlPendingValuePrologue( zes_overclock_handle_t hDomainHandle, zes_overclock_control_t DomainControl, double* pValue ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_5) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesOverclockSetControlUserValuePrologue( zes_overclock_handle_t hDomainHandle, zes_overclock_control_t DomainControl, double pValue, zes_pending_action_t* pPendingAction ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_5) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesOverclockGetControlStatePrologue( zes_overclock_handle_t hDomainHandle, zes_overclock_control_t DomainControl, zes_control_state_t* pControlState, zes_pending_action_t* pPendingAction ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_5) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesOverclockGetVFPointValuesPrologue( zes_overclock_handle_t hDomainHandle, zes_vf_type_t VFType, zes_vf_array_type_t VFArrayType, uint32_t PointIndex, uint32_t* PointValue ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_5) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesOverclockSetVFPointValuesPrologue( zes_overclock_handle_t hDomainHandle, zes_vf_type_t VFType, uint32_t PointIndex, uint32_t PointValue ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_5) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesDeviceEnumDiagnosticTestSuitesPrologue( zes_device_handle_t hDevice, uint32_t* pCount, zes_diag_handle_t* phDiagnostics ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesDiagnosticsGetPropertiesPrologue( zes_diag_handle_t hDiagnostics, zes_diag_properties_t* pProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesDiagnosticsGetTestsPrologue( zes_diag_handle_t hDiagnostics, uint32_t* pCount, zes_diag_test_t* pTests ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesDiagnosticsRunTestsPrologue( zes_diag_handle_t hDiagnostics, uint32_t startIndex, uint32_t endIndex, zes_diag_result_t* pResult ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesDeviceEccAvailablePrologue( zes_device_handle_t hDevice, ze_bool_t* pAvailable ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_4) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesDeviceEccConfigurablePrologue( zes_device_handle_t hDevice, ze_bool_t* pConfigurable ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_4) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesDeviceGetEccStatePrologue( zes_device_handle_t hDevice, zes_device_ecc_properties_t* pState ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_4) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesDeviceSetEccStatePrologue( zes_device_handle_t hDevice, const zes_device_ecc_desc_t* newState, zes_device_ecc_properties_t* pState ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_4) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesDeviceEnumEngineGroupsPrologue( zes_device_handle_t hDevice, uint32_t* pCount, zes_engine_handle_t* phEngine ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesEngineGetPropertiesPrologue( zes_engine_handle_t hEngine, zes_engine_properties_t* pProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesEngineGetActivityPrologue( zes_engine_handle_t hEngine, zes_engine_stats_t* pStats ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_7) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesDeviceEventRegisterPrologue( zes_device_handle_t hDevice, zes_event_type_flags_t events ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesDriverEventListenPrologue( ze_driver_handle_t hDriver, uint32_t timeout, uint32_t count, zes_device_handle_t* phDevices, uint32_t* pNumDeviceEvents, zes_event_type_flags_t* pEvents ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesDriverEventListenExPrologue( ze_driver_handle_t hDriver, uint64_t timeout, uint32_t count, zes_device_handle_t* phDevices, uint32_t* pNumDeviceEvents, zes_event_type_flags_t* pEvents ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_1) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesDeviceEnumFabricPortsPrologue( zes_device_handle_t hDevice, uint32_t* pCount, zes_fabric_port_handle_t* phPort ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesFabricPortGetPropertiesPrologue( zes_fabric_port_handle_t hPort, zes_fabric_port_properties_t* pProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesFabricPortGetLinkTypePrologue( zes_fabric_port_handle_t hPort, zes_fabric_link_type_t* pLinkType ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesFabricPortGetConfigPrologue( zes_fabric_port_handle_t hPort, zes_fabric_port_config_t* pConfig ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesFabricPortSetConfigPrologue( zes_fabric_port_handle_t hPort, const zes_fabric_port_config_t* pConfig ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesFabricPortGetStatePrologue( zes_fabric_port_handle_t hPort, zes_fabric_port_state_t* pState ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesFabricPortGetThroughputPrologue( zes_fabric_port_handle_t hPort, zes_fabric_port_throughput_t* pThroughput ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesFabricPortGetFabricErrorCountersPrologue( zes_fabric_port_handle_t hPort, zes_fabric_port_error_counters_t* pErrors ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_7) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesFabricPortGetMultiPortThroughputPrologue( zes_device_handle_t hDevice, uint32_t numPorts, zes_fabric_port_handle_t* phPort, zes_fabric_port_throughput_t** pThroughput ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_7) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesDeviceEnumFansPrologue( zes_device_handle_t hDevice, uint32_t* pCount, zes_fan_handle_t* phFan ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesFanGetPropertiesPrologue( zes_fan_handle_t hFan, zes_fan_properties_t* pProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesFanGetConfigPrologue( zes_fan_handle_t hFan, zes_fan_config_t* pConfig ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesFanSetDefaultModePrologue( zes_fan_handle_t hFan ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesFanSetFixedSpeedModePrologue( zes_fan_handle_t hFan, const zes_fan_speed_t* speed ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesFanSetSpeedTableModePrologue( zes_fan_handle_t hFan, const zes_fan_speed_table_t* speedTable ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesFanGetStatePrologue( zes_fan_handle_t hFan, zes_fan_speed_units_t units, int32_t* pSpeed ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesDeviceEnumFirmwaresPrologue( zes_device_handle_t hDevice, uint32_t* pCount, zes_firmware_handle_t* phFirmware ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesFirmwareGetPropertiesPrologue( zes_firmware_handle_t hFirmware, zes_firmware_properties_t* pProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesFirmwareFlashPrologue( zes_firmware_handle_t hFirmware, void* pImage, uint32_t size ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesFirmwareGetFlashProgressPrologue( zes_firmware_handle_t hFirmware, uint32_t* pCompletionPercent ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_8) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesFirmwareGetConsoleLogsPrologue( zes_firmware_handle_t hFirmware, size_t* pSize, char* pFirmwareLog ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_9) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesDeviceEnumFrequencyDomainsPrologue( zes_device_handle_t hDevice, uint32_t* pCount, zes_freq_handle_t* phFrequency ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesFrequencyGetPropertiesPrologue( zes_freq_handle_t hFrequency, zes_freq_properties_t* pProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesFrequencyGetAvailableClocksPrologue( zes_freq_handle_t hFrequency, uint32_t* pCount, double* phFrequency ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesFrequencyGetRangePrologue( zes_freq_handle_t hFrequency, zes_freq_range_t* pLimits ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesFrequencySetRangePrologue( zes_freq_handle_t hFrequency, const zes_freq_range_t* pLimits ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesFrequencyGetStatePrologue( zes_freq_handle_t hFrequency, zes_freq_state_t* pState ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesFrequencyGetThrottleTimePrologue( zes_freq_handle_t hFrequency, zes_freq_throttle_time_t* pThrottleTime ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesFrequencyOcGetCapabilitiesPrologue( zes_freq_handle_t hFrequency, zes_oc_capabilities_t* pOcCapabilities ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesFrequencyOcGetFrequencyTargetPrologue( zes_freq_handle_t hFrequency, double* pCurrentOcFrequency ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesFrequencyOcSetFrequencyTargetPrologue( zes_freq_handle_t hFrequency, double CurrentOcFrequency ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesFrequencyOcGetVoltageTargetPrologue( zes_freq_handle_t hFrequency, double* pCurrentVoltageTarget, double* pCurrentVoltageOffset ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesFrequencyOcSetVoltageTargetPrologue( zes_freq_handle_t hFrequency, double CurrentVoltageTarget, double CurrentVoltageOffset ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesFrequencyOcSetModePrologue( zes_freq_handle_t hFrequency, zes_oc_mode_t CurrentOcMode ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesFrequencyOcGetModePrologue( zes_freq_handle_t hFrequency, zes_oc_mode_t* pCurrentOcMode ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesFrequencyOcGetIccMaxPrologue( zes_freq_handle_t hFrequency, double* pOcIccMax ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesFrequencyOcSetIccMaxPrologue( zes_freq_handle_t hFrequency, double ocIccMax ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesFrequencyOcGetTjMaxPrologue( zes_freq_handle_t hFrequency, double* pOcTjMax ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesFrequencyOcSetTjMaxPrologue( zes_freq_handle_t hFrequency, double ocTjMax ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesDeviceEnumLedsPrologue( zes_device_handle_t hDevice, uint32_t* pCount, zes_led_handle_t* phLed ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesLedGetPropertiesPrologue( zes_led_handle_t hLed, zes_led_properties_t* pProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesLedGetStatePrologue( zes_led_handle_t hLed, zes_led_state_t* pState ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesLedSetStatePrologue( zes_led_handle_t hLed, ze_bool_t enable ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesLedSetColorPrologue( zes_led_handle_t hLed, const zes_led_color_t* pColor ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesDeviceEnumMemoryModulesPrologue( zes_device_handle_t hDevice, uint32_t* pCount, zes_mem_handle_t* phMemory ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesMemoryGetPropertiesPrologue( zes_mem_handle_t hMemory, zes_mem_properties_t* pProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesMemoryGetStatePrologue( zes_mem_handle_t hMemory, zes_mem_state_t* pState ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesMemoryGetBandwidthPrologue( zes_mem_handle_t hMemory, zes_mem_bandwidth_t* pBandwidth ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesDeviceEnumPerformanceFactorDomainsPrologue( zes_device_handle_t hDevice, uint32_t* pCount, zes_perf_handle_t* phPerf ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesPerformanceFactorGetPropertiesPrologue( zes_perf_handle_t hPerf, zes_perf_properties_t* pProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesPerformanceFactorGetConfigPrologue( zes_perf_handle_t hPerf, double* pFactor ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesPerformanceFactorSetConfigPrologue( zes_perf_handle_t hPerf, double factor ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesDeviceEnumPowerDomainsPrologue( zes_device_handle_t hDevice, uint32_t* pCount, zes_pwr_handle_t* phPower ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesDeviceGetCardPowerDomainPrologue( zes_device_handle_t hDevice, zes_pwr_handle_t* phPower ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesPowerGetPropertiesPrologue( zes_pwr_handle_t hPower, zes_power_properties_t* pProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesPowerGetEnergyCounterPrologue( zes_pwr_handle_t hPower, zes_power_energy_counter_t* pEnergy ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesPowerGetLimitsPrologue( zes_pwr_handle_t hPower, zes_power_sustained_limit_t* pSustained, zes_power_burst_limit_t* pBurst, zes_power_peak_limit_t* pPeak ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesPowerSetLimitsPrologue( zes_pwr_handle_t hPower, const zes_power_sustained_limit_t* pSustained, const zes_power_burst_limit_t* pBurst, const zes_power_peak_limit_t* pPeak ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesPowerGetEnergyThresholdPrologue( zes_pwr_handle_t hPower, zes_energy_threshold_t* pThreshold ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesPowerSetEnergyThresholdPrologue( zes_pwr_handle_t hPower, double threshold ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesDeviceEnumPsusPrologue( zes_device_handle_t hDevice, uint32_t* pCount, zes_psu_handle_t* phPsu ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesPsuGetPropertiesPrologue( zes_psu_handle_t hPsu, zes_psu_properties_t* pProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesPsuGetStatePrologue( zes_psu_handle_t hPsu, zes_psu_state_t* pState ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesDeviceEnumRasErrorSetsPrologue( zes_device_handle_t hDevice, uint32_t* pCount, zes_ras_handle_t* phRas ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesRasGetPropertiesPrologue( zes_ras_handle_t hRas, zes_ras_properties_t* pProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesRasGetConfigPrologue( zes_ras_handle_t hRas, zes_ras_config_t* pConfig ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesRasSetConfigPrologue( zes_ras_handle_t hRas, const zes_ras_config_t* pConfig ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesRasGetStatePrologue( zes_ras_handle_t hRas, ze_bool_t clear, zes_ras_state_t* pState ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesDeviceEnumSchedulersPrologue( zes_device_handle_t hDevice, uint32_t* pCount, zes_sched_handle_t* phScheduler ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesSchedulerGetPropertiesPrologue( zes_sched_handle_t hScheduler, zes_sched_properties_t* pProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesSchedulerGetCurrentModePrologue( zes_sched_handle_t hScheduler, zes_sched_mode_t* pMode ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesSchedulerGetTimeoutModePropertiesPrologue( zes_sched_handle_t hScheduler, ze_bool_t getDefaults, zes_sched_timeout_properties_t* pConfig ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesSchedulerGetTimesliceModePropertiesPrologue( zes_sched_handle_t hScheduler, ze_bool_t getDefaults, zes_sched_timeslice_properties_t* pConfig ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesSchedulerSetTimeoutModePrologue( zes_sched_handle_t hScheduler, zes_sched_timeout_properties_t* pProperties, ze_bool_t* pNeedReload ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesSchedulerSetTimesliceModePrologue( zes_sched_handle_t hScheduler, zes_sched_timeslice_properties_t* pProperties, ze_bool_t* pNeedReload ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesSchedulerSetExclusiveModePrologue( zes_sched_handle_t hScheduler, ze_bool_t* pNeedReload ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesSchedulerSetComputeUnitDebugModePrologue( zes_sched_handle_t hScheduler, ze_bool_t* pNeedReload ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesDeviceEnumStandbyDomainsPrologue( zes_device_handle_t hDevice, uint32_t* pCount, zes_standby_handle_t* phStandby ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesStandbyGetPropertiesPrologue( zes_standby_handle_t hStandby, zes_standby_properties_t* pProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesStandbyGetModePrologue( zes_standby_handle_t hStandby, zes_standby_promo_mode_t* pMode ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesStandbySetModePrologue( zes_standby_handle_t hStandby, zes_standby_promo_mode_t mode ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesDeviceEnumTemperatureSensorsPrologue( zes_device_handle_t hDevice, uint32_t* pCount, zes_temp_handle_t* phTemperature ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesTemperatureGetPropertiesPrologue( zes_temp_handle_t hTemperature, zes_temp_properties_t* pProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesTemperatureGetConfigPrologue( zes_temp_handle_t hTemperature, zes_temp_config_t* pConfig ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesTemperatureSetConfigPrologue( zes_temp_handle_t hTemperature, const zes_temp_config_t* pConfig ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesTemperatureGetStatePrologue( zes_temp_handle_t hTemperature, double* pTemperature ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesDevicePciLinkSpeedUpdateExtPrologue( zes_device_handle_t hDevice, ze_bool_t shouldDowngrade, zes_device_action_t* pendingAction ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_15) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesPowerGetLimitsExtPrologue( zes_pwr_handle_t hPower, uint32_t* pCount, zes_power_limit_ext_desc_t* pSustained ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesPowerSetLimitsExtPrologue( zes_pwr_handle_t hPower, uint32_t* pCount, zes_power_limit_ext_desc_t* pSustained ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesEngineGetActivityExtPrologue( zes_engine_handle_t hEngine, uint32_t* pCount, zes_engine_stats_t* pStats ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_7) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesRasGetStateExpPrologue( zes_ras_handle_t hRas, uint32_t* pCount, zes_ras_state_exp_t* pState ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesRasClearStateExpPrologue( zes_ras_handle_t hRas, zes_ras_error_category_exp_t category ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesFirmwareGetSecurityVersionExpPrologue( zes_firmware_handle_t hFirmware, char* pVersion ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_9) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesFirmwareSetSecurityVersionExpPrologue( zes_firmware_handle_t hFirmware ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_9) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesDeviceGetSubDevicePropertiesExpPrologue( zes_device_handle_t hDevice, uint32_t* pCount, zes_subdevice_exp_properties_t* pSubdeviceProps ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_9) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesDriverGetDeviceByUuidExpPrologue( zes_driver_handle_t hDriver, zes_uuid_t uuid, zes_device_handle_t* phDevice, ze_bool_t* onSubdevice, uint32_t* subdeviceId ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_9) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesDeviceEnumActiveVFExpPrologue( zes_device_handle_t hDevice, uint32_t* pCount, zes_vf_handle_t* phVFhandle ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_9) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesVFManagementGetVFPropertiesExpPrologue( zes_vf_handle_t hVFhandle, zes_vf_exp_properties_t* pProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_9) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesVFManagementGetVFMemoryUtilizationExpPrologue( zes_vf_handle_t hVFhandle, uint32_t* pCount, zes_vf_util_mem_exp_t* pMemUtil ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_9) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesVFManagementGetVFEngineUtilizationExpPrologue( zes_vf_handle_t hVFhandle, uint32_t* pCount, zes_vf_util_engine_exp_t* pEngineUtil ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_9) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesVFManagementSetVFTelemetryModeExpPrologue( zes_vf_handle_t hVFhandle, zes_vf_info_util_exp_flags_t flags, ze_bool_t enable ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_9) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesVFManagementSetVFTelemetrySamplingIntervalExpPrologue( zes_vf_handle_t hVFhandle, zes_vf_info_util_exp_flags_t flag, uint64_t samplingInterval ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_9) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesDeviceEnumEnabledVFExpPrologue( zes_device_handle_t hDevice, uint32_t* pCount, zes_vf_handle_t* phVFhandle ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_10) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesVFManagementGetVFCapabilitiesExpPrologue( zes_vf_handle_t hVFhandle, zes_vf_exp_capabilities_t* pCapability ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_10) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesVFManagementGetVFMemoryUtilizationExp2Prologue( zes_vf_handle_t hVFhandle, uint32_t* pCount, zes_vf_util_mem_exp2_t* pMemUtil ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_10) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesVFManagementGetVFEngineUtilizationExp2Prologue( zes_vf_handle_t hVFhandle, uint32_t* pCount, zes_vf_util_engine_exp2_t* pEngineUtil ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_10) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zesVFManagementGetVFCapabilitiesExp2Prologue( zes_vf_handle_t hVFhandle, zes_vf_exp2_capabilities_t* pCapability ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_12) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
+    static ze_result_t ZE_APICALL zesInitUnsupported( zes_init_flags_t flags ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesDriverGetUnsupported( uint32_t* pCount, zes_driver_handle_t* phDrivers ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesDriverGetExtensionPropertiesUnsupported( zes_driver_handle_t hDriver, uint32_t* pCount, zes_driver_extension_properties_t* pExtensionProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesDriverGetExtensionFunctionAddressUnsupported( zes_driver_handle_t hDriver, const char* name, void** ppFunctionAddress ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesDeviceGetUnsupported( zes_driver_handle_t hDriver, uint32_t* pCount, zes_device_handle_t* phDevices ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesDeviceGetPropertiesUnsupported( zes_device_handle_t hDevice, zes_device_properties_t* pProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesDeviceGetStateUnsupported( zes_device_handle_t hDevice, zes_device_state_t* pState ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesDeviceResetUnsupported( zes_device_handle_t hDevice, ze_bool_t force ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesDeviceResetExtUnsupported( zes_device_handle_t hDevice, zes_reset_properties_t* pProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesDeviceProcessesGetStateUnsupported( zes_device_handle_t hDevice, uint32_t* pCount, zes_process_state_t* pProcesses ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesDevicePciGetPropertiesUnsupported( zes_device_handle_t hDevice, zes_pci_properties_t* pProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesDevicePciGetStateUnsupported( zes_device_handle_t hDevice, zes_pci_state_t* pState ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesDevicePciGetBarsUnsupported( zes_device_handle_t hDevice, uint32_t* pCount, zes_pci_bar_properties_t* pProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesDevicePciGetStatsUnsupported( zes_device_handle_t hDevice, zes_pci_stats_t* pStats ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesDeviceSetOverclockWaiverUnsupported( zes_device_handle_t hDevice ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesDeviceGetOverclockDomainsUnsupported( zes_device_handle_t hDevice, uint32_t* pOverclockDomains ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesDeviceGetOverclockControlsUnsupported( zes_device_handle_t hDevice, zes_overclock_domain_t domainType, uint32_t* pAvailableControls ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesDeviceResetOverclockSettingsUnsupported( zes_device_handle_t hDevice, ze_bool_t onShippedState ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesDeviceReadOverclockStateUnsupported( zes_device_handle_t hDevice, zes_overclock_mode_t* pOverclockMode, ze_bool_t* pWaiverSetting, ze_bool_t* pOverclockState, zes_pending_action_t* pPendingAction, ze_bool_t* pPendingReset ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesDeviceEnumOverclockDomainsUnsupported( zes_device_handle_t hDevice, uint32_t* pCount, zes_overclock_handle_t* phDomainHandle ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesOverclockGetDomainPropertiesUnsupported( zes_overclock_handle_t hDomainHandle, zes_overclock_properties_t* pDomainProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesOverclockGetDomainVFPropertiesUnsupported( zes_overclock_handle_t hDomainHandle, zes_vf_property_t* pVFProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesOverclockGetDomainControlPropertiesUnsupported( zes_overclock_handle_t hDomainHandle, zes_overclock_control_t DomainControl, zes_control_property_t* pControlProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesOverclockGetControlCurrentValueUnsupported( zes_overclock_handle_t hDomainHandle, zes_overclock_control_t DomainControl, double* pValue ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesOverclockGetControlPendingValueUnsupported( zes_overclock_handle_t hDomainHandle, zes_overclock_control_t DomainControl, double* pValue ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesOverclockSetControlUserValueUnsupported( zes_overclock_handle_t hDomainHandle, zes_overclock_control_t DomainControl, double pValue, zes_pending_action_t* pPendingAction ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesOverclockGetControlStateUnsupported( zes_overclock_handle_t hDomainHandle, zes_overclock_control_t DomainControl, zes_control_state_t* pControlState, zes_pending_action_t* pPendingAction ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesOverclockGetVFPointValuesUnsupported( zes_overclock_handle_t hDomainHandle, zes_vf_type_t VFType, zes_vf_array_type_t VFArrayType, uint32_t PointIndex, uint32_t* PointValue ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesOverclockSetVFPointValuesUnsupported( zes_overclock_handle_t hDomainHandle, zes_vf_type_t VFType, uint32_t PointIndex, uint32_t PointValue ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesDeviceEnumDiagnosticTestSuitesUnsupported( zes_device_handle_t hDevice, uint32_t* pCount, zes_diag_handle_t* phDiagnostics ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesDiagnosticsGetPropertiesUnsupported( zes_diag_handle_t hDiagnostics, zes_diag_properties_t* pProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesDiagnosticsGetTestsUnsupported( zes_diag_handle_t hDiagnostics, uint32_t* pCount, zes_diag_test_t* pTests ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesDiagnosticsRunTestsUnsupported( zes_diag_handle_t hDiagnostics, uint32_t startIndex, uint32_t endIndex, zes_diag_result_t* pResult ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesDeviceEccAvailableUnsupported( zes_device_handle_t hDevice, ze_bool_t* pAvailable ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesDeviceEccConfigurableUnsupported( zes_device_handle_t hDevice, ze_bool_t* pConfigurable ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesDeviceGetEccStateUnsupported( zes_device_handle_t hDevice, zes_device_ecc_properties_t* pState ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesDeviceSetEccStateUnsupported( zes_device_handle_t hDevice, const zes_device_ecc_desc_t* newState, zes_device_ecc_properties_t* pState ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesDeviceEnumEngineGroupsUnsupported( zes_device_handle_t hDevice, uint32_t* pCount, zes_engine_handle_t* phEngine ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesEngineGetPropertiesUnsupported( zes_engine_handle_t hEngine, zes_engine_properties_t* pProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesEngineGetActivityUnsupported( zes_engine_handle_t hEngine, zes_engine_stats_t* pStats ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesDeviceEventRegisterUnsupported( zes_device_handle_t hDevice, zes_event_type_flags_t events ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesDriverEventListenUnsupported( ze_driver_handle_t hDriver, uint32_t timeout, uint32_t count, zes_device_handle_t* phDevices, uint32_t* pNumDeviceEvents, zes_event_type_flags_t* pEvents ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesDriverEventListenExUnsupported( ze_driver_handle_t hDriver, uint64_t timeout, uint32_t count, zes_device_handle_t* phDevices, uint32_t* pNumDeviceEvents, zes_event_type_flags_t* pEvents ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesDeviceEnumFabricPortsUnsupported( zes_device_handle_t hDevice, uint32_t* pCount, zes_fabric_port_handle_t* phPort ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesFabricPortGetPropertiesUnsupported( zes_fabric_port_handle_t hPort, zes_fabric_port_properties_t* pProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesFabricPortGetLinkTypeUnsupported( zes_fabric_port_handle_t hPort, zes_fabric_link_type_t* pLinkType ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesFabricPortGetConfigUnsupported( zes_fabric_port_handle_t hPort, zes_fabric_port_config_t* pConfig ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesFabricPortSetConfigUnsupported( zes_fabric_port_handle_t hPort, const zes_fabric_port_config_t* pConfig ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesFabricPortGetStateUnsupported( zes_fabric_port_handle_t hPort, zes_fabric_port_state_t* pState ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesFabricPortGetThroughputUnsupported( zes_fabric_port_handle_t hPort, zes_fabric_port_throughput_t* pThroughput ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesFabricPortGetFabricErrorCountersUnsupported( zes_fabric_port_handle_t hPort, zes_fabric_port_error_counters_t* pErrors ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesFabricPortGetMultiPortThroughputUnsupported( zes_device_handle_t hDevice, uint32_t numPorts, zes_fabric_port_handle_t* phPort, zes_fabric_port_throughput_t** pThroughput ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesDeviceEnumFansUnsupported( zes_device_handle_t hDevice, uint32_t* pCount, zes_fan_handle_t* phFan ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesFanGetPropertiesUnsupported( zes_fan_handle_t hFan, zes_fan_properties_t* pProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesFanGetConfigUnsupported( zes_fan_handle_t hFan, zes_fan_config_t* pConfig ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesFanSetDefaultModeUnsupported( zes_fan_handle_t hFan ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesFanSetFixedSpeedModeUnsupported( zes_fan_handle_t hFan, const zes_fan_speed_t* speed ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesFanSetSpeedTableModeUnsupported( zes_fan_handle_t hFan, const zes_fan_speed_table_t* speedTable ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesFanGetStateUnsupported( zes_fan_handle_t hFan, zes_fan_speed_units_t units, int32_t* pSpeed ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesDeviceEnumFirmwaresUnsupported( zes_device_handle_t hDevice, uint32_t* pCount, zes_firmware_handle_t* phFirmware ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesFirmwareGetPropertiesUnsupported( zes_firmware_handle_t hFirmware, zes_firmware_properties_t* pProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesFirmwareFlashUnsupported( zes_firmware_handle_t hFirmware, void* pImage, uint32_t size ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesFirmwareGetFlashProgressUnsupported( zes_firmware_handle_t hFirmware, uint32_t* pCompletionPercent ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesFirmwareGetConsoleLogsUnsupported( zes_firmware_handle_t hFirmware, size_t* pSize, char* pFirmwareLog ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesDeviceEnumFrequencyDomainsUnsupported( zes_device_handle_t hDevice, uint32_t* pCount, zes_freq_handle_t* phFrequency ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesFrequencyGetPropertiesUnsupported( zes_freq_handle_t hFrequency, zes_freq_properties_t* pProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesFrequencyGetAvailableClocksUnsupported( zes_freq_handle_t hFrequency, uint32_t* pCount, double* phFrequency ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesFrequencyGetRangeUnsupported( zes_freq_handle_t hFrequency, zes_freq_range_t* pLimits ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesFrequencySetRangeUnsupported( zes_freq_handle_t hFrequency, const zes_freq_range_t* pLimits ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesFrequencyGetStateUnsupported( zes_freq_handle_t hFrequency, zes_freq_state_t* pState ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesFrequencyGetThrottleTimeUnsupported( zes_freq_handle_t hFrequency, zes_freq_throttle_time_t* pThrottleTime ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesFrequencyOcGetCapabilitiesUnsupported( zes_freq_handle_t hFrequency, zes_oc_capabilities_t* pOcCapabilities ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesFrequencyOcGetFrequencyTargetUnsupported( zes_freq_handle_t hFrequency, double* pCurrentOcFrequency ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesFrequencyOcSetFrequencyTargetUnsupported( zes_freq_handle_t hFrequency, double CurrentOcFrequency ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesFrequencyOcGetVoltageTargetUnsupported( zes_freq_handle_t hFrequency, double* pCurrentVoltageTarget, double* pCurrentVoltageOffset ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesFrequencyOcSetVoltageTargetUnsupported( zes_freq_handle_t hFrequency, double CurrentVoltageTarget, double CurrentVoltageOffset ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesFrequencyOcSetModeUnsupported( zes_freq_handle_t hFrequency, zes_oc_mode_t CurrentOcMode ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesFrequencyOcGetModeUnsupported( zes_freq_handle_t hFrequency, zes_oc_mode_t* pCurrentOcMode ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesFrequencyOcGetIccMaxUnsupported( zes_freq_handle_t hFrequency, double* pOcIccMax ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesFrequencyOcSetIccMaxUnsupported( zes_freq_handle_t hFrequency, double ocIccMax ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesFrequencyOcGetTjMaxUnsupported( zes_freq_handle_t hFrequency, double* pOcTjMax ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesFrequencyOcSetTjMaxUnsupported( zes_freq_handle_t hFrequency, double ocTjMax ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesDeviceEnumLedsUnsupported( zes_device_handle_t hDevice, uint32_t* pCount, zes_led_handle_t* phLed ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesLedGetPropertiesUnsupported( zes_led_handle_t hLed, zes_led_properties_t* pProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesLedGetStateUnsupported( zes_led_handle_t hLed, zes_led_state_t* pState ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesLedSetStateUnsupported( zes_led_handle_t hLed, ze_bool_t enable ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesLedSetColorUnsupported( zes_led_handle_t hLed, const zes_led_color_t* pColor ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesDeviceEnumMemoryModulesUnsupported( zes_device_handle_t hDevice, uint32_t* pCount, zes_mem_handle_t* phMemory ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesMemoryGetPropertiesUnsupported( zes_mem_handle_t hMemory, zes_mem_properties_t* pProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesMemoryGetStateUnsupported( zes_mem_handle_t hMemory, zes_mem_state_t* pState ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesMemoryGetBandwidthUnsupported( zes_mem_handle_t hMemory, zes_mem_bandwidth_t* pBandwidth ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesDeviceEnumPerformanceFactorDomainsUnsupported( zes_device_handle_t hDevice, uint32_t* pCount, zes_perf_handle_t* phPerf ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesPerformanceFactorGetPropertiesUnsupported( zes_perf_handle_t hPerf, zes_perf_properties_t* pProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesPerformanceFactorGetConfigUnsupported( zes_perf_handle_t hPerf, double* pFactor ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesPerformanceFactorSetConfigUnsupported( zes_perf_handle_t hPerf, double factor ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesDeviceEnumPowerDomainsUnsupported( zes_device_handle_t hDevice, uint32_t* pCount, zes_pwr_handle_t* phPower ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesDeviceGetCardPowerDomainUnsupported( zes_device_handle_t hDevice, zes_pwr_handle_t* phPower ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesPowerGetPropertiesUnsupported( zes_pwr_handle_t hPower, zes_power_properties_t* pProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesPowerGetEnergyCounterUnsupported( zes_pwr_handle_t hPower, zes_power_energy_counter_t* pEnergy ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesPowerGetLimitsUnsupported( zes_pwr_handle_t hPower, zes_power_sustained_limit_t* pSustained, zes_power_burst_limit_t* pBurst, zes_power_peak_limit_t* pPeak ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesPowerSetLimitsUnsupported( zes_pwr_handle_t hPower, const zes_power_sustained_limit_t* pSustained, const zes_power_burst_limit_t* pBurst, const zes_power_peak_limit_t* pPeak ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesPowerGetEnergyThresholdUnsupported( zes_pwr_handle_t hPower, zes_energy_threshold_t* pThreshold ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesPowerSetEnergyThresholdUnsupported( zes_pwr_handle_t hPower, double threshold ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesDeviceEnumPsusUnsupported( zes_device_handle_t hDevice, uint32_t* pCount, zes_psu_handle_t* phPsu ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesPsuGetPropertiesUnsupported( zes_psu_handle_t hPsu, zes_psu_properties_t* pProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesPsuGetStateUnsupported( zes_psu_handle_t hPsu, zes_psu_state_t* pState ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesDeviceEnumRasErrorSetsUnsupported( zes_device_handle_t hDevice, uint32_t* pCount, zes_ras_handle_t* phRas ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesRasGetPropertiesUnsupported( zes_ras_handle_t hRas, zes_ras_properties_t* pProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesRasGetConfigUnsupported( zes_ras_handle_t hRas, zes_ras_config_t* pConfig ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesRasSetConfigUnsupported( zes_ras_handle_t hRas, const zes_ras_config_t* pConfig ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesRasGetStateUnsupported( zes_ras_handle_t hRas, ze_bool_t clear, zes_ras_state_t* pState ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesDeviceEnumSchedulersUnsupported( zes_device_handle_t hDevice, uint32_t* pCount, zes_sched_handle_t* phScheduler ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesSchedulerGetPropertiesUnsupported( zes_sched_handle_t hScheduler, zes_sched_properties_t* pProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesSchedulerGetCurrentModeUnsupported( zes_sched_handle_t hScheduler, zes_sched_mode_t* pMode ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesSchedulerGetTimeoutModePropertiesUnsupported( zes_sched_handle_t hScheduler, ze_bool_t getDefaults, zes_sched_timeout_properties_t* pConfig ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesSchedulerGetTimesliceModePropertiesUnsupported( zes_sched_handle_t hScheduler, ze_bool_t getDefaults, zes_sched_timeslice_properties_t* pConfig ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesSchedulerSetTimeoutModeUnsupported( zes_sched_handle_t hScheduler, zes_sched_timeout_properties_t* pProperties, ze_bool_t* pNeedReload ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesSchedulerSetTimesliceModeUnsupported( zes_sched_handle_t hScheduler, zes_sched_timeslice_properties_t* pProperties, ze_bool_t* pNeedReload ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesSchedulerSetExclusiveModeUnsupported( zes_sched_handle_t hScheduler, ze_bool_t* pNeedReload ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesSchedulerSetComputeUnitDebugModeUnsupported( zes_sched_handle_t hScheduler, ze_bool_t* pNeedReload ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesDeviceEnumStandbyDomainsUnsupported( zes_device_handle_t hDevice, uint32_t* pCount, zes_standby_handle_t* phStandby ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesStandbyGetPropertiesUnsupported( zes_standby_handle_t hStandby, zes_standby_properties_t* pProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesStandbyGetModeUnsupported( zes_standby_handle_t hStandby, zes_standby_promo_mode_t* pMode ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesStandbySetModeUnsupported( zes_standby_handle_t hStandby, zes_standby_promo_mode_t mode ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesDeviceEnumTemperatureSensorsUnsupported( zes_device_handle_t hDevice, uint32_t* pCount, zes_temp_handle_t* phTemperature ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesTemperatureGetPropertiesUnsupported( zes_temp_handle_t hTemperature, zes_temp_properties_t* pProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesTemperatureGetConfigUnsupported( zes_temp_handle_t hTemperature, zes_temp_config_t* pConfig ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesTemperatureSetConfigUnsupported( zes_temp_handle_t hTemperature, const zes_temp_config_t* pConfig ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesTemperatureGetStateUnsupported( zes_temp_handle_t hTemperature, double* pTemperature ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesDevicePciLinkSpeedUpdateExtUnsupported( zes_device_handle_t hDevice, ze_bool_t shouldDowngrade, zes_device_action_t* pendingAction ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesPowerGetLimitsExtUnsupported( zes_pwr_handle_t hPower, uint32_t* pCount, zes_power_limit_ext_desc_t* pSustained ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesPowerSetLimitsExtUnsupported( zes_pwr_handle_t hPower, uint32_t* pCount, zes_power_limit_ext_desc_t* pSustained ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesEngineGetActivityExtUnsupported( zes_engine_handle_t hEngine, uint32_t* pCount, zes_engine_stats_t* pStats ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesRasGetStateExpUnsupported( zes_ras_handle_t hRas, uint32_t* pCount, zes_ras_state_exp_t* pState ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesRasClearStateExpUnsupported( zes_ras_handle_t hRas, zes_ras_error_category_exp_t category ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesFirmwareGetSecurityVersionExpUnsupported( zes_firmware_handle_t hFirmware, char* pVersion ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesFirmwareSetSecurityVersionExpUnsupported( zes_firmware_handle_t hFirmware ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesDeviceGetSubDevicePropertiesExpUnsupported( zes_device_handle_t hDevice, uint32_t* pCount, zes_subdevice_exp_properties_t* pSubdeviceProps ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesDriverGetDeviceByUuidExpUnsupported( zes_driver_handle_t hDriver, zes_uuid_t uuid, zes_device_handle_t* phDevice, ze_bool_t* onSubdevice, uint32_t* subdeviceId ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesDeviceEnumActiveVFExpUnsupported( zes_device_handle_t hDevice, uint32_t* pCount, zes_vf_handle_t* phVFhandle ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesVFManagementGetVFPropertiesExpUnsupported( zes_vf_handle_t hVFhandle, zes_vf_exp_properties_t* pProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesVFManagementGetVFMemoryUtilizationExpUnsupported( zes_vf_handle_t hVFhandle, uint32_t* pCount, zes_vf_util_mem_exp_t* pMemUtil ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesVFManagementGetVFEngineUtilizationExpUnsupported( zes_vf_handle_t hVFhandle, uint32_t* pCount, zes_vf_util_engine_exp_t* pEngineUtil ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesVFManagementSetVFTelemetryModeExpUnsupported( zes_vf_handle_t hVFhandle, zes_vf_info_util_exp_flags_t flags, ze_bool_t enable ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesVFManagementSetVFTelemetrySamplingIntervalExpUnsupported( zes_vf_handle_t hVFhandle, zes_vf_info_util_exp_flags_t flag, uint64_t samplingInterval ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesDeviceEnumEnabledVFExpUnsupported( zes_device_handle_t hDevice, uint32_t* pCount, zes_vf_handle_t* phVFhandle ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesVFManagementGetVFCapabilitiesExpUnsupported( zes_vf_handle_t hVFhandle, zes_vf_exp_capabilities_t* pCapability ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesVFManagementGetVFMemoryUtilizationExp2Unsupported( zes_vf_handle_t hVFhandle, uint32_t* pCount, zes_vf_util_mem_exp2_t* pMemUtil ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesVFManagementGetVFEngineUtilizationExp2Unsupported( zes_vf_handle_t hVFhandle, uint32_t* pCount, zes_vf_util_engine_exp2_t* pEngineUtil ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zesVFManagementGetVFCapabilitiesExp2Unsupported( zes_vf_handle_t hVFhandle, zes_vf_exp2_capabilities_t* pCapability ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+
+    static void applyCertification(zes_dditable_t &table, const zes_dditable_t &original, ze_api_version_t version) {
+        table.Global.pfnInit = (original.Global.pfnInit && version < ZE_API_VERSION_1_5) ? zesInitUnsupported : original.Global.pfnInit;
+        table.Driver.pfnGet = (original.Driver.pfnGet && version < ZE_API_VERSION_1_5) ? zesDriverGetUnsupported : original.Driver.pfnGet;
+        table.Driver.pfnGetExtensionProperties = (original.Driver.pfnGetExtensionProperties && version < ZE_API_VERSION_1_8) ? zesDriverGetExtensionPropertiesUnsupported : original.Driver.pfnGetExtensionProperties;
+        table.Driver.pfnGetExtensionFunctionAddress = (original.Driver.pfnGetExtensionFunctionAddress && version < ZE_API_VERSION_1_8) ? zesDriverGetExtensionFunctionAddressUnsupported : original.Driver.pfnGetExtensionFunctionAddress;
+        table.Device.pfnGet = (original.Device.pfnGet && version < ZE_API_VERSION_1_5) ? zesDeviceGetUnsupported : original.Device.pfnGet;
+        table.Device.pfnGetProperties = (original.Device.pfnGetProperties && version < ZE_API_VERSION_1_0) ? zesDeviceGetPropertiesUnsupported : original.Device.pfnGetProperties;
+        table.Device.pfnGetState = (original.Device.pfnGetState && version < ZE_API_VERSION_1_0) ? zesDeviceGetStateUnsupported : original.Device.pfnGetState;
+        table.Device.pfnReset = (original.Device.pfnReset && version < ZE_API_VERSION_1_0) ? zesDeviceResetUnsupported : original.Device.pfnReset;
+        table.Device.pfnResetExt = (original.Device.pfnResetExt && version < ZE_API_VERSION_1_7) ? zesDeviceResetExtUnsupported : original.Device.pfnResetExt;
+        table.Device.pfnProcessesGetState = (original.Device.pfnProcessesGetState && version < ZE_API_VERSION_1_0) ? zesDeviceProcessesGetStateUnsupported : original.Device.pfnProcessesGetState;
+        table.Device.pfnPciGetProperties = (original.Device.pfnPciGetProperties && version < ZE_API_VERSION_1_0) ? zesDevicePciGetPropertiesUnsupported : original.Device.pfnPciGetProperties;
+        table.Device.pfnPciGetState = (original.Device.pfnPciGetState && version < ZE_API_VERSION_1_0) ? zesDevicePciGetStateUnsupported : original.Device.pfnPciGetState;
+        table.Device.pfnPciGetBars = (original.Device.pfnPciGetBars && version < ZE_API_VERSION_1_0) ? zesDevicePciGetBarsUnsupported : original.Device.pfnPciGetBars;
+        table.Device.pfnPciGetStats = (original.Device.pfnPciGetStats && version < ZE_API_VERSION_1_0) ? zesDevicePciGetStatsUnsupported : original.Device.pfnPciGetStats;
+        table.Device.pfnSetOverclockWaiver = (original.Device.pfnSetOverclockWaiver && version < ZE_API_VERSION_1_5) ? zesDeviceSetOverclockWaiverUnsupported : original.Device.pfnSetOverclockWaiver;
+        table.Device.pfnGetOverclockDomains = (original.Device.pfnGetOverclockDomains && version < ZE_API_VERSION_1_5) ? zesDeviceGetOverclockDomainsUnsupported : original.Device.pfnGetOverclockDomains;
+        table.Device.pfnGetOverclockControls = (original.Device.pfnGetOverclockControls && version < ZE_API_VERSION_1_5) ? zesDeviceGetOverclockControlsUnsupported : original.Device.pfnGetOverclockControls;
+        table.Device.pfnResetOverclockSettings = (original.Device.pfnResetOverclockSettings && version < ZE_API_VERSION_1_5) ? zesDeviceResetOverclockSettingsUnsupported : original.Device.pfnResetOverclockSettings;
+        table.Device.pfnReadOverclockState = (original.Device.pfnReadOverclockState && version < ZE_API_VERSION_1_5) ? zesDeviceReadOverclockStateUnsupported : original.Device.pfnReadOverclockState;
+        table.Device.pfnEnumOverclockDomains = (original.Device.pfnEnumOverclockDomains && version < ZE_API_VERSION_1_5) ? zesDeviceEnumOverclockDomainsUnsupported : original.Device.pfnEnumOverclockDomains;
+        table.Overclock.pfnGetDomainProperties = (original.Overclock.pfnGetDomainProperties && version < ZE_API_VERSION_1_5) ? zesOverclockGetDomainPropertiesUnsupported : original.Overclock.pfnGetDomainProperties;
+        table.Overclock.pfnGetDomainVFProperties = (original.Overclock.pfnGetDomainVFProperties && version < ZE_API_VERSION_1_5) ? zesOverclockGetDomainVFPropertiesUnsupported : original.Overclock.pfnGetDomainVFProperties;
+        table.Overclock.pfnGetDomainControlProperties = (original.Overclock.pfnGetDomainControlProperties && version < ZE_API_VERSION_1_5) ? zesOverclockGetDomainControlPropertiesUnsupported : original.Overclock.pfnGetDomainControlProperties;
+        table.Overclock.pfnGetControlCurrentValue = (original.Overclock.pfnGetControlCurrentValue && version < ZE_API_VERSION_1_5) ? zesOverclockGetControlCurrentValueUnsupported : original.Overclock.pfnGetControlCurrentValue;
+        table.Overclock.pfnGetControlPendingValue = (original.Overclock.pfnGetControlPendingValue && version < ZE_API_VERSION_1_5) ? zesOverclockGetControlPendingValueUnsupported : original.Overclock.pfnGetControlPendingValue;
+        table.Overclock.pfnSetControlUserValue = (original.Overclock.pfnSetControlUserValue && version < ZE_API_VERSION_1_5) ? zesOverclockSetControlUserValueUnsupported : original.Overclock.pfnSetControlUserValue;
+        table.Overclock.pfnGetControlState = (original.Overclock.pfnGetControlState && version < ZE_API_VERSION_1_5) ? zesOverclockGetControlStateUnsupported : original.Overclock.pfnGetControlState;
+        table.Overclock.pfnGetVFPointValues = (original.Overclock.pfnGetVFPointValues && version < ZE_API_VERSION_1_5) ? zesOverclockGetVFPointValuesUnsupported : original.Overclock.pfnGetVFPointValues;
+        table.Overclock.pfnSetVFPointValues = (original.Overclock.pfnSetVFPointValues && version < ZE_API_VERSION_1_5) ? zesOverclockSetVFPointValuesUnsupported : original.Overclock.pfnSetVFPointValues;
+        table.Device.pfnEnumDiagnosticTestSuites = (original.Device.pfnEnumDiagnosticTestSuites && version < ZE_API_VERSION_1_0) ? zesDeviceEnumDiagnosticTestSuitesUnsupported : original.Device.pfnEnumDiagnosticTestSuites;
+        table.Diagnostics.pfnGetProperties = (original.Diagnostics.pfnGetProperties && version < ZE_API_VERSION_1_0) ? zesDiagnosticsGetPropertiesUnsupported : original.Diagnostics.pfnGetProperties;
+        table.Diagnostics.pfnGetTests = (original.Diagnostics.pfnGetTests && version < ZE_API_VERSION_1_0) ? zesDiagnosticsGetTestsUnsupported : original.Diagnostics.pfnGetTests;
+        table.Diagnostics.pfnRunTests = (original.Diagnostics.pfnRunTests && version < ZE_API_VERSION_1_0) ? zesDiagnosticsRunTestsUnsupported : original.Diagnostics.pfnRunTests;
+        table.Device.pfnEccAvailable = (original.Device.pfnEccAvailable && version < ZE_API_VERSION_1_4) ? zesDeviceEccAvailableUnsupported : original.Device.pfnEccAvailable;
+        table.Device.pfnEccConfigurable = (original.Device.pfnEccConfigurable && version < ZE_API_VERSION_1_4) ? zesDeviceEccConfigurableUnsupported : original.Device.pfnEccConfigurable;
+        table.Device.pfnGetEccState = (original.Device.pfnGetEccState && version < ZE_API_VERSION_1_4) ? zesDeviceGetEccStateUnsupported : original.Device.pfnGetEccState;
+        table.Device.pfnSetEccState = (original.Device.pfnSetEccState && version < ZE_API_VERSION_1_4) ? zesDeviceSetEccStateUnsupported : original.Device.pfnSetEccState;
+        table.Device.pfnEnumEngineGroups = (original.Device.pfnEnumEngineGroups && version < ZE_API_VERSION_1_0) ? zesDeviceEnumEngineGroupsUnsupported : original.Device.pfnEnumEngineGroups;
+        table.Engine.pfnGetProperties = (original.Engine.pfnGetProperties && version < ZE_API_VERSION_1_0) ? zesEngineGetPropertiesUnsupported : original.Engine.pfnGetProperties;
+        table.Engine.pfnGetActivity = (original.Engine.pfnGetActivity && version < ZE_API_VERSION_1_7) ? zesEngineGetActivityUnsupported : original.Engine.pfnGetActivity;
+        table.Device.pfnEventRegister = (original.Device.pfnEventRegister && version < ZE_API_VERSION_1_0) ? zesDeviceEventRegisterUnsupported : original.Device.pfnEventRegister;
+        table.Driver.pfnEventListen = (original.Driver.pfnEventListen && version < ZE_API_VERSION_1_0) ? zesDriverEventListenUnsupported : original.Driver.pfnEventListen;
+        table.Driver.pfnEventListenEx = (original.Driver.pfnEventListenEx && version < ZE_API_VERSION_1_1) ? zesDriverEventListenExUnsupported : original.Driver.pfnEventListenEx;
+        table.Device.pfnEnumFabricPorts = (original.Device.pfnEnumFabricPorts && version < ZE_API_VERSION_1_0) ? zesDeviceEnumFabricPortsUnsupported : original.Device.pfnEnumFabricPorts;
+        table.FabricPort.pfnGetProperties = (original.FabricPort.pfnGetProperties && version < ZE_API_VERSION_1_0) ? zesFabricPortGetPropertiesUnsupported : original.FabricPort.pfnGetProperties;
+        table.FabricPort.pfnGetLinkType = (original.FabricPort.pfnGetLinkType && version < ZE_API_VERSION_1_0) ? zesFabricPortGetLinkTypeUnsupported : original.FabricPort.pfnGetLinkType;
+        table.FabricPort.pfnGetConfig = (original.FabricPort.pfnGetConfig && version < ZE_API_VERSION_1_0) ? zesFabricPortGetConfigUnsupported : original.FabricPort.pfnGetConfig;
+        table.FabricPort.pfnSetConfig = (original.FabricPort.pfnSetConfig && version < ZE_API_VERSION_1_0) ? zesFabricPortSetConfigUnsupported : original.FabricPort.pfnSetConfig;
+        table.FabricPort.pfnGetState = (original.FabricPort.pfnGetState && version < ZE_API_VERSION_1_0) ? zesFabricPortGetStateUnsupported : original.FabricPort.pfnGetState;
+        table.FabricPort.pfnGetThroughput = (original.FabricPort.pfnGetThroughput && version < ZE_API_VERSION_1_0) ? zesFabricPortGetThroughputUnsupported : original.FabricPort.pfnGetThroughput;
+        table.FabricPort.pfnGetFabricErrorCounters = (original.FabricPort.pfnGetFabricErrorCounters && version < ZE_API_VERSION_1_7) ? zesFabricPortGetFabricErrorCountersUnsupported : original.FabricPort.pfnGetFabricErrorCounters;
+        table.FabricPort.pfnGetMultiPortThroughput = (original.FabricPort.pfnGetMultiPortThroughput && version < ZE_API_VERSION_1_7) ? zesFabricPortGetMultiPortThroughputUnsupported : original.FabricPort.pfnGetMultiPortThroughput;
+        table.Device.pfnEnumFans = (original.Device.pfnEnumFans && version < ZE_API_VERSION_1_0) ? zesDeviceEnumFansUnsupported : original.Device.pfnEnumFans;
+        table.Fan.pfnGetProperties = (original.Fan.pfnGetProperties && version < ZE_API_VERSION_1_0) ? zesFanGetPropertiesUnsupported : original.Fan.pfnGetProperties;
+        table.Fan.pfnGetConfig = (original.Fan.pfnGetConfig && version < ZE_API_VERSION_1_0) ? zesFanGetConfigUnsupported : original.Fan.pfnGetConfig;
+        table.Fan.pfnSetDefaultMode = (original.Fan.pfnSetDefaultMode && version < ZE_API_VERSION_1_0) ? zesFanSetDefaultModeUnsupported : original.Fan.pfnSetDefaultMode;
+        table.Fan.pfnSetFixedSpeedMode = (original.Fan.pfnSetFixedSpeedMode && version < ZE_API_VERSION_1_0) ? zesFanSetFixedSpeedModeUnsupported : original.Fan.pfnSetFixedSpeedMode;
+        table.Fan.pfnSetSpeedTableMode = (original.Fan.pfnSetSpeedTableMode && version < ZE_API_VERSION_1_0) ? zesFanSetSpeedTableModeUnsupported : original.Fan.pfnSetSpeedTableMode;
+        table.Fan.pfnGetState = (original.Fan.pfnGetState && version < ZE_API_VERSION_1_0) ? zesFanGetStateUnsupported : original.Fan.pfnGetState;
+        table.Device.pfnEnumFirmwares = (original.Device.pfnEnumFirmwares && version < ZE_API_VERSION_1_0) ? zesDeviceEnumFirmwaresUnsupported : original.Device.pfnEnumFirmwares;
+        table.Firmware.pfnGetProperties = (original.Firmware.pfnGetProperties && version < ZE_API_VERSION_1_0) ? zesFirmwareGetPropertiesUnsupported : original.Firmware.pfnGetProperties;
+        table.Firmware.pfnFlash = (original.Firmware.pfnFlash && version < ZE_API_VERSION_1_0) ? zesFirmwareFlashUnsupported : original.Firmware.pfnFlash;
+        table.Firmware.pfnGetFlashProgress = (original.Firmware.pfnGetFlashProgress && version < ZE_API_VERSION_1_8) ? zesFirmwareGetFlashProgressUnsupported : original.Firmware.pfnGetFlashProgress;
+        table.Firmware.pfnGetConsoleLogs = (original.Firmware.pfnGetConsoleLogs && version < ZE_API_VERSION_1_9) ? zesFirmwareGetConsoleLogsUnsupported : original.Firmware.pfnGetConsoleLogs;
+        table.Device.pfnEnumFrequencyDomains = (original.Device.pfnEnumFrequencyDomains && version < ZE_API_VERSION_1_0) ? zesDeviceEnumFrequencyDomainsUnsupported : original.Device.pfnEnumFrequencyDomains;
+        table.Frequency.pfnGetProperties = (original.Frequency.pfnGetProperties && version < ZE_API_VERSION_1_0) ? zesFrequencyGetPropertiesUnsupported : original.Frequency.pfnGetProperties;
+        table.Frequency.pfnGetAvailableClocks = (original.Frequency.pfnGetAvailableClocks && version < ZE_API_VERSION_1_0) ? zesFrequencyGetAvailableClocksUnsupported : original.Frequency.pfnGetAvailableClocks;
+        table.Frequency.pfnGetRange = (original.Frequency.pfnGetRange && version < ZE_API_VERSION_1_0) ? zesFrequencyGetRangeUnsupported : original.Frequency.pfnGetRange;
+        table.Frequency.pfnSetRange = (original.Frequency.pfnSetRange && version < ZE_API_VERSION_1_0) ? zesFrequencySetRangeUnsupported : original.Frequency.pfnSetRange;
+        table.Frequency.pfnGetState = (original.Frequency.pfnGetState && version < ZE_API_VERSION_1_0) ? zesFrequencyGetStateUnsupported : original.Frequency.pfnGetState;
+        table.Frequency.pfnGetThrottleTime = (original.Frequency.pfnGetThrottleTime && version < ZE_API_VERSION_1_0) ? zesFrequencyGetThrottleTimeUnsupported : original.Frequency.pfnGetThrottleTime;
+        table.Frequency.pfnOcGetCapabilities = (original.Frequency.pfnOcGetCapabilities && version < ZE_API_VERSION_1_0) ? zesFrequencyOcGetCapabilitiesUnsupported : original.Frequency.pfnOcGetCapabilities;
+        table.Frequency.pfnOcGetFrequencyTarget = (original.Frequency.pfnOcGetFrequencyTarget && version < ZE_API_VERSION_1_0) ? zesFrequencyOcGetFrequencyTargetUnsupported : original.Frequency.pfnOcGetFrequencyTarget;
+        table.Frequency.pfnOcSetFrequencyTarget = (original.Frequency.pfnOcSetFrequencyTarget && version < ZE_API_VERSION_1_0) ? zesFrequencyOcSetFrequencyTargetUnsupported : original.Frequency.pfnOcSetFrequencyTarget;
+        table.Frequency.pfnOcGetVoltageTarget = (original.Frequency.pfnOcGetVoltageTarget && version < ZE_API_VERSION_1_0) ? zesFrequencyOcGetVoltageTargetUnsupported : original.Frequency.pfnOcGetVoltageTarget;
+        table.Frequency.pfnOcSetVoltageTarget = (original.Frequency.pfnOcSetVoltageTarget && version < ZE_API_VERSION_1_0) ? zesFrequencyOcSetVoltageTargetUnsupported : original.Frequency.pfnOcSetVoltageTarget;
+        table.Frequency.pfnOcSetMode = (original.Frequency.pfnOcSetMode && version < ZE_API_VERSION_1_0) ? zesFrequencyOcSetModeUnsupported : original.Frequency.pfnOcSetMode;
+        table.Frequency.pfnOcGetMode = (original.Frequency.pfnOcGetMode && version < ZE_API_VERSION_1_0) ? zesFrequencyOcGetModeUnsupported : original.Frequency.pfnOcGetMode;
+        table.Frequency.pfnOcGetIccMax = (original.Frequency.pfnOcGetIccMax && version < ZE_API_VERSION_1_0) ? zesFrequencyOcGetIccMaxUnsupported : original.Frequency.pfnOcGetIccMax;
+        table.Frequency.pfnOcSetIccMax = (original.Frequency.pfnOcSetIccMax && version < ZE_API_VERSION_1_0) ? zesFrequencyOcSetIccMaxUnsupported : original.Frequency.pfnOcSetIccMax;
+        table.Frequency.pfnOcGetTjMax = (original.Frequency.pfnOcGetTjMax && version < ZE_API_VERSION_1_0) ? zesFrequencyOcGetTjMaxUnsupported : original.Frequency.pfnOcGetTjMax;
+        table.Frequency.pfnOcSetTjMax = (original.Frequency.pfnOcSetTjMax && version < ZE_API_VERSION_1_0) ? zesFrequencyOcSetTjMaxUnsupported : original.Frequency.pfnOcSetTjMax;
+        table.Device.pfnEnumLeds = (original.Device.pfnEnumLeds && version < ZE_API_VERSION_1_0) ? zesDeviceEnumLedsUnsupported : original.Device.pfnEnumLeds;
+        table.Led.pfnGetProperties = (original.Led.pfnGetProperties && version < ZE_API_VERSION_1_0) ? zesLedGetPropertiesUnsupported : original.Led.pfnGetProperties;
+        table.Led.pfnGetState = (original.Led.pfnGetState && version < ZE_API_VERSION_1_0) ? zesLedGetStateUnsupported : original.Led.pfnGetState;
+        table.Led.pfnSetState = (original.Led.pfnSetState && version < ZE_API_VERSION_1_0) ? zesLedSetStateUnsupported : original.Led.pfnSetState;
+        table.Led.pfnSetColor = (original.Led.pfnSetColor && version < ZE_API_VERSION_1_0) ? zesLedSetColorUnsupported : original.Led.pfnSetColor;
+        table.Device.pfnEnumMemoryModules = (original.Device.pfnEnumMemoryModules && version < ZE_API_VERSION_1_0) ? zesDeviceEnumMemoryModulesUnsupported : original.Device.pfnEnumMemoryModules;
+        table.Memory.pfnGetProperties = (original.Memory.pfnGetProperties && version < ZE_API_VERSION_1_0) ? zesMemoryGetPropertiesUnsupported : original.Memory.pfnGetProperties;
+        table.Memory.pfnGetState = (original.Memory.pfnGetState && version < ZE_API_VERSION_1_0) ? zesMemoryGetStateUnsupported : original.Memory.pfnGetState;
+        table.Memory.pfnGetBandwidth = (original.Memory.pfnGetBandwidth && version < ZE_API_VERSION_1_0) ? zesMemoryGetBandwidthUnsupported : original.Memory.pfnGetBandwidth;
+        table.Device.pfnEnumPerformanceFactorDomains = (original.Device.pfnEnumPerformanceFactorDomains && version < ZE_API_VERSION_1_0) ? zesDeviceEnumPerformanceFactorDomainsUnsupported : original.Device.pfnEnumPerformanceFactorDomains;
+        table.PerformanceFactor.pfnGetProperties = (original.PerformanceFactor.pfnGetProperties && version < ZE_API_VERSION_1_0) ? zesPerformanceFactorGetPropertiesUnsupported : original.PerformanceFactor.pfnGetProperties;
+        table.PerformanceFactor.pfnGetConfig = (original.PerformanceFactor.pfnGetConfig && version < ZE_API_VERSION_1_0) ? zesPerformanceFactorGetConfigUnsupported : original.PerformanceFactor.pfnGetConfig;
+        table.PerformanceFactor.pfnSetConfig = (original.PerformanceFactor.pfnSetConfig && version < ZE_API_VERSION_1_0) ? zesPerformanceFactorSetConfigUnsupported : original.PerformanceFactor.pfnSetConfig;
+        table.Device.pfnEnumPowerDomains = (original.Device.pfnEnumPowerDomains && version < ZE_API_VERSION_1_0) ? zesDeviceEnumPowerDomainsUnsupported : original.Device.pfnEnumPowerDomains;
+        table.Device.pfnGetCardPowerDomain = (original.Device.pfnGetCardPowerDomain && version < ZE_API_VERSION_1_0) ? zesDeviceGetCardPowerDomainUnsupported : original.Device.pfnGetCardPowerDomain;
+        table.Power.pfnGetProperties = (original.Power.pfnGetProperties && version < ZE_API_VERSION_1_0) ? zesPowerGetPropertiesUnsupported : original.Power.pfnGetProperties;
+        table.Power.pfnGetEnergyCounter = (original.Power.pfnGetEnergyCounter && version < ZE_API_VERSION_1_0) ? zesPowerGetEnergyCounterUnsupported : original.Power.pfnGetEnergyCounter;
+        table.Power.pfnGetLimits = (original.Power.pfnGetLimits && version < ZE_API_VERSION_1_0) ? zesPowerGetLimitsUnsupported : original.Power.pfnGetLimits;
+        table.Power.pfnSetLimits = (original.Power.pfnSetLimits && version < ZE_API_VERSION_1_0) ? zesPowerSetLimitsUnsupported : original.Power.pfnSetLimits;
+        table.Power.pfnGetEnergyThreshold = (original.Power.pfnGetEnergyThreshold && version < ZE_API_VERSION_1_0) ? zesPowerGetEnergyThresholdUnsupported : original.Power.pfnGetEnergyThreshold;
+        table.Power.pfnSetEnergyThreshold = (original.Power.pfnSetEnergyThreshold && version < ZE_API_VERSION_1_0) ? zesPowerSetEnergyThresholdUnsupported : original.Power.pfnSetEnergyThreshold;
+        table.Device.pfnEnumPsus = (original.Device.pfnEnumPsus && version < ZE_API_VERSION_1_0) ? zesDeviceEnumPsusUnsupported : original.Device.pfnEnumPsus;
+        table.Psu.pfnGetProperties = (original.Psu.pfnGetProperties && version < ZE_API_VERSION_1_0) ? zesPsuGetPropertiesUnsupported : original.Psu.pfnGetProperties;
+        table.Psu.pfnGetState = (original.Psu.pfnGetState && version < ZE_API_VERSION_1_0) ? zesPsuGetStateUnsupported : original.Psu.pfnGetState;
+        table.Device.pfnEnumRasErrorSets = (original.Device.pfnEnumRasErrorSets && version < ZE_API_VERSION_1_0) ? zesDeviceEnumRasErrorSetsUnsupported : original.Device.pfnEnumRasErrorSets;
+        table.Ras.pfnGetProperties = (original.Ras.pfnGetProperties && version < ZE_API_VERSION_1_0) ? zesRasGetPropertiesUnsupported : original.Ras.pfnGetProperties;
+        table.Ras.pfnGetConfig = (original.Ras.pfnGetConfig && version < ZE_API_VERSION_1_0) ? zesRasGetConfigUnsupported : original.Ras.pfnGetConfig;
+        table.Ras.pfnSetConfig = (original.Ras.pfnSetConfig && version < ZE_API_VERSION_1_0) ? zesRasSetConfigUnsupported : original.Ras.pfnSetConfig;
+        table.Ras.pfnGetState = (original.Ras.pfnGetState && version < ZE_API_VERSION_1_0) ? zesRasGetStateUnsupported : original.Ras.pfnGetState;
+        table.Device.pfnEnumSchedulers = (original.Device.pfnEnumSchedulers && version < ZE_API_VERSION_1_0) ? zesDeviceEnumSchedulersUnsupported : original.Device.pfnEnumSchedulers;
+        table.Scheduler.pfnGetProperties = (original.Scheduler.pfnGetProperties && version < ZE_API_VERSION_1_0) ? zesSchedulerGetPropertiesUnsupported : original.Scheduler.pfnGetProperties;
+        table.Scheduler.pfnGetCurrentMode = (original.Scheduler.pfnGetCurrentMode && version < ZE_API_VERSION_1_0) ? zesSchedulerGetCurrentModeUnsupported : original.Scheduler.pfnGetCurrentMode;
+        table.Scheduler.pfnGetTimeoutModeProperties = (original.Scheduler.pfnGetTimeoutModeProperties && version < ZE_API_VERSION_1_0) ? zesSchedulerGetTimeoutModePropertiesUnsupported : original.Scheduler.pfnGetTimeoutModeProperties;
+        table.Scheduler.pfnGetTimesliceModeProperties = (original.Scheduler.pfnGetTimesliceModeProperties && version < ZE_API_VERSION_1_0) ? zesSchedulerGetTimesliceModePropertiesUnsupported : original.Scheduler.pfnGetTimesliceModeProperties;
+        table.Scheduler.pfnSetTimeoutMode = (original.Scheduler.pfnSetTimeoutMode && version < ZE_API_VERSION_1_0) ? zesSchedulerSetTimeoutModeUnsupported : original.Scheduler.pfnSetTimeoutMode;
+        table.Scheduler.pfnSetTimesliceMode = (original.Scheduler.pfnSetTimesliceMode && version < ZE_API_VERSION_1_0) ? zesSchedulerSetTimesliceModeUnsupported : original.Scheduler.pfnSetTimesliceMode;
+        table.Scheduler.pfnSetExclusiveMode = (original.Scheduler.pfnSetExclusiveMode && version < ZE_API_VERSION_1_0) ? zesSchedulerSetExclusiveModeUnsupported : original.Scheduler.pfnSetExclusiveMode;
+        table.Scheduler.pfnSetComputeUnitDebugMode = (original.Scheduler.pfnSetComputeUnitDebugMode && version < ZE_API_VERSION_1_0) ? zesSchedulerSetComputeUnitDebugModeUnsupported : original.Scheduler.pfnSetComputeUnitDebugMode;
+        table.Device.pfnEnumStandbyDomains = (original.Device.pfnEnumStandbyDomains && version < ZE_API_VERSION_1_0) ? zesDeviceEnumStandbyDomainsUnsupported : original.Device.pfnEnumStandbyDomains;
+        table.Standby.pfnGetProperties = (original.Standby.pfnGetProperties && version < ZE_API_VERSION_1_0) ? zesStandbyGetPropertiesUnsupported : original.Standby.pfnGetProperties;
+        table.Standby.pfnGetMode = (original.Standby.pfnGetMode && version < ZE_API_VERSION_1_0) ? zesStandbyGetModeUnsupported : original.Standby.pfnGetMode;
+        table.Standby.pfnSetMode = (original.Standby.pfnSetMode && version < ZE_API_VERSION_1_0) ? zesStandbySetModeUnsupported : original.Standby.pfnSetMode;
+        table.Device.pfnEnumTemperatureSensors = (original.Device.pfnEnumTemperatureSensors && version < ZE_API_VERSION_1_0) ? zesDeviceEnumTemperatureSensorsUnsupported : original.Device.pfnEnumTemperatureSensors;
+        table.Temperature.pfnGetProperties = (original.Temperature.pfnGetProperties && version < ZE_API_VERSION_1_0) ? zesTemperatureGetPropertiesUnsupported : original.Temperature.pfnGetProperties;
+        table.Temperature.pfnGetConfig = (original.Temperature.pfnGetConfig && version < ZE_API_VERSION_1_0) ? zesTemperatureGetConfigUnsupported : original.Temperature.pfnGetConfig;
+        table.Temperature.pfnSetConfig = (original.Temperature.pfnSetConfig && version < ZE_API_VERSION_1_0) ? zesTemperatureSetConfigUnsupported : original.Temperature.pfnSetConfig;
+        table.Temperature.pfnGetState = (original.Temperature.pfnGetState && version < ZE_API_VERSION_1_0) ? zesTemperatureGetStateUnsupported : original.Temperature.pfnGetState;
+        table.Device.pfnPciLinkSpeedUpdateExt = (original.Device.pfnPciLinkSpeedUpdateExt && version < ZE_API_VERSION_1_15) ? zesDevicePciLinkSpeedUpdateExtUnsupported : original.Device.pfnPciLinkSpeedUpdateExt;
+        table.Power.pfnGetLimitsExt = (original.Power.pfnGetLimitsExt && version < ZE_API_VERSION_1_0) ? zesPowerGetLimitsExtUnsupported : original.Power.pfnGetLimitsExt;
+        table.Power.pfnSetLimitsExt = (original.Power.pfnSetLimitsExt && version < ZE_API_VERSION_1_0) ? zesPowerSetLimitsExtUnsupported : original.Power.pfnSetLimitsExt;
+        table.Engine.pfnGetActivityExt = (original.Engine.pfnGetActivityExt && version < ZE_API_VERSION_1_7) ? zesEngineGetActivityExtUnsupported : original.Engine.pfnGetActivityExt;
+        table.RasExp.pfnGetStateExp = (original.RasExp.pfnGetStateExp && version < ZE_API_VERSION_1_0) ? zesRasGetStateExpUnsupported : original.RasExp.pfnGetStateExp;
+        table.RasExp.pfnClearStateExp = (original.RasExp.pfnClearStateExp && version < ZE_API_VERSION_1_0) ? zesRasClearStateExpUnsupported : original.RasExp.pfnClearStateExp;
+        table.FirmwareExp.pfnGetSecurityVersionExp = (original.FirmwareExp.pfnGetSecurityVersionExp && version < ZE_API_VERSION_1_9) ? zesFirmwareGetSecurityVersionExpUnsupported : original.FirmwareExp.pfnGetSecurityVersionExp;
+        table.FirmwareExp.pfnSetSecurityVersionExp = (original.FirmwareExp.pfnSetSecurityVersionExp && version < ZE_API_VERSION_1_9) ? zesFirmwareSetSecurityVersionExpUnsupported : original.FirmwareExp.pfnSetSecurityVersionExp;
+        table.DeviceExp.pfnGetSubDevicePropertiesExp = (original.DeviceExp.pfnGetSubDevicePropertiesExp && version < ZE_API_VERSION_1_9) ? zesDeviceGetSubDevicePropertiesExpUnsupported : original.DeviceExp.pfnGetSubDevicePropertiesExp;
+        table.DriverExp.pfnGetDeviceByUuidExp = (original.DriverExp.pfnGetDeviceByUuidExp && version < ZE_API_VERSION_1_9) ? zesDriverGetDeviceByUuidExpUnsupported : original.DriverExp.pfnGetDeviceByUuidExp;
+        table.DeviceExp.pfnEnumActiveVFExp = (original.DeviceExp.pfnEnumActiveVFExp && version < ZE_API_VERSION_1_9) ? zesDeviceEnumActiveVFExpUnsupported : original.DeviceExp.pfnEnumActiveVFExp;
+        table.VFManagementExp.pfnGetVFPropertiesExp = (original.VFManagementExp.pfnGetVFPropertiesExp && version < ZE_API_VERSION_1_9) ? zesVFManagementGetVFPropertiesExpUnsupported : original.VFManagementExp.pfnGetVFPropertiesExp;
+        table.VFManagementExp.pfnGetVFMemoryUtilizationExp = (original.VFManagementExp.pfnGetVFMemoryUtilizationExp && version < ZE_API_VERSION_1_9) ? zesVFManagementGetVFMemoryUtilizationExpUnsupported : original.VFManagementExp.pfnGetVFMemoryUtilizationExp;
+        table.VFManagementExp.pfnGetVFEngineUtilizationExp = (original.VFManagementExp.pfnGetVFEngineUtilizationExp && version < ZE_API_VERSION_1_9) ? zesVFManagementGetVFEngineUtilizationExpUnsupported : original.VFManagementExp.pfnGetVFEngineUtilizationExp;
+        table.VFManagementExp.pfnSetVFTelemetryModeExp = (original.VFManagementExp.pfnSetVFTelemetryModeExp && version < ZE_API_VERSION_1_9) ? zesVFManagementSetVFTelemetryModeExpUnsupported : original.VFManagementExp.pfnSetVFTelemetryModeExp;
+        table.VFManagementExp.pfnSetVFTelemetrySamplingIntervalExp = (original.VFManagementExp.pfnSetVFTelemetrySamplingIntervalExp && version < ZE_API_VERSION_1_9) ? zesVFManagementSetVFTelemetrySamplingIntervalExpUnsupported : original.VFManagementExp.pfnSetVFTelemetrySamplingIntervalExp;
+        table.DeviceExp.pfnEnumEnabledVFExp = (original.DeviceExp.pfnEnumEnabledVFExp && version < ZE_API_VERSION_1_10) ? zesDeviceEnumEnabledVFExpUnsupported : original.DeviceExp.pfnEnumEnabledVFExp;
+        table.VFManagementExp.pfnGetVFCapabilitiesExp = (original.VFManagementExp.pfnGetVFCapabilitiesExp && version < ZE_API_VERSION_1_10) ? zesVFManagementGetVFCapabilitiesExpUnsupported : original.VFManagementExp.pfnGetVFCapabilitiesExp;
+        table.VFManagementExp.pfnGetVFMemoryUtilizationExp2 = (original.VFManagementExp.pfnGetVFMemoryUtilizationExp2 && version < ZE_API_VERSION_1_10) ? zesVFManagementGetVFMemoryUtilizationExp2Unsupported : original.VFManagementExp.pfnGetVFMemoryUtilizationExp2;
+        table.VFManagementExp.pfnGetVFEngineUtilizationExp2 = (original.VFManagementExp.pfnGetVFEngineUtilizationExp2 && version < ZE_API_VERSION_1_10) ? zesVFManagementGetVFEngineUtilizationExp2Unsupported : original.VFManagementExp.pfnGetVFEngineUtilizationExp2;
+        table.VFManagementExp.pfnGetVFCapabilitiesExp2 = (original.VFManagementExp.pfnGetVFCapabilitiesExp2 && version < ZE_API_VERSION_1_12) ? zesVFManagementGetVFCapabilitiesExp2Unsupported : original.VFManagementExp.pfnGetVFCapabilitiesExp2;
     }
 };
 } // namespace validation_layer
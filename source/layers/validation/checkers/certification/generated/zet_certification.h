@@ -9,425 +9,291 @@
  *
  */
 #pragma once
-#include "../zel_global_certification_state.h"
-#include "zet_entry_points.h"
+#include "zet_ddi.h"
 
 namespace validation_layer {
-class ZETcertificationCheckerGenerated : public ZETValidationEntryPoints {
+// APIs newer than the certification version are redirected to an
+// Unsupported stub in the layer's DDI table; allowed APIs are left untouched.
+class ZETcertificationCheckerGenerated {
 public:
-    virtual ze_result_t zetModuleGetDebugInfoPrologue( zet_module_handle_t hModule, zet_module_debug_info_format_t format, size_t* pSize, uint8_t* pDebugInfo ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetDeviceGetDebugPropertiesPrologue( zet_device_handle_t hDevice, zet_device_debug_properties_t* pDebugProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetDebugAttachPrologue( zet_device_handle_t hDevice, const zet_debug_config_t* config, zet_debug_session_handle_t* phDebug ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetDebugDetachPrologue( zet_debug_session_handle_t hDebug ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetDebugReadEventPrologue( zet_debug_session_handle_t hDebug, uint64_t timeout, zet_debug_event_t* event ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetDebugAcknowledgeEventPrologue( zet_debug_session_handle_t hDebug, const zet_debug_event_t* event ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetDebugInterruptPrologue( zet_debug_session_handle_t hDebug, ze_device_thread_t thread ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetDebugResumePrologue( zet_debug_session_handle_t hDebug, ze_device_thread_t thread ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetDebugReadMemoryPrologue( zet_debug_session_handle_t hDebug, ze_device_thread_t thread, const zet_debug_memory_space_desc_t* desc, size_t size, void* buffer ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetDebugWriteMemoryPrologue( zet_debug_session_handle_t hDebug, ze_device_thread_t thread, const zet_debug_memory_space_desc_t* desc, size_t size, const void* buffer ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetDebugGetRegisterSetPropertiesPrologue( zet_device_handle_t hDevice, uint32_t* pCount, zet_debug_regset_properties_t* pRegisterSetProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetDebugGetThreadRegisterSetPropertiesPrologue( zet_debug_session_handle_t hDebug, ze_device_thread_t thread, uint32_t* pCount, zet_debug_regset_properties_t* pRegisterSetProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_5) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetDebugReadRegistersPrologue( zet_debug_session_handle_t hDebug, ze_device_thread_t thread, uint32_t type, uint32_t start, uint32_t count, void* pRegisterValues ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetDebugWriteRegistersPrologue( zet_debug_session_handle_t hDebug, ze_device_thread_t thread, uint32_t type, uint32_t start, uint32_t count, void* pRegisterValues ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetMetricGroupGetPrologue( zet_device_handle_t hDevice, uint32_t* pCount, zet_metric_group_handle_t* phMetricGroups ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetMetricGroupGetPropertiesPrologue( zet_metric_group_handle_t hMetricGroup, zet_metric_group_properties_t* pProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetMetricGroupCalculateMetricValuesPrologue( zet_metric_group_handle_t hMetricGroup, zet_metric_group_calculation_type_t type, size_t rawDataSize, const uint8_t* pRawData, uint32_t* pMetricValueCount, zet_typed_value_t* pMetricValues ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetMetricGetPrologue( zet_metric_group_handle_t hMetricGroup, uint32_t* pCount, zet_metric_handle_t* phMetrics ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetMetricGetPropertiesPrologue( zet_metric_handle_t hMetric, zet_metric_properties_t* pProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetContextActivateMetricGroupsPrologue( zet_context_handle_t hContext, zet_device_handle_t hDevice, uint32_t count, zet_metric_group_handle_t* phMetricGroups ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetMetricStreamerOpenPrologue( zet_context_handle_t hContext, zet_device_handle_t hDevice, zet_metric_group_handle_t hMetricGroup, zet_metric_streamer_desc_t* desc, ze_event_handle_t hNotificationEvent, zet_metric_streamer_handle_t* phMetricStreamer ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetCommandListAppendMetricStreamerMarkerPrologue( zet_command_list_handle_t hCommandList, zet_metric_streamer_handle_t hMetricStreamer, uint32_t value ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetMetricStreamerClosePrologue( zet_metric_streamer_handle_t hMetricStreamer ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetMetricStreamerReadDataPrologue( zet_metric_streamer_handle_t hMetricStreamer, uint32_t maxReportCount, size_t* pRawDataSize, uint8_t* pRawData ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetMetricQueryPoolCreatePrologue( zet_context_handle_t hContext, zet_device_handle_t hDevice, zet_metric_group_handle_t hMetricGroup, const zet_metric_query_pool_desc_t* desc, zet_metric_query_pool_handle_t* phMetricQueryPool ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetMetricQueryPoolDestroyPrologue( zet_metric_query_pool_handle_t hMetricQueryPool ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetMetricQueryCreatePrologue( zet_metric_query_pool_handle_t hMetricQueryPool, uint32_t index, zet_metric_query_handle_t* phMetricQuery ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetMetricQueryDestroyPrologue( zet_metric_query_handle_t hMetricQuery ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetMetricQueryResetPrologue( zet_metric_query_handle_t hMetricQuery ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetCommandListAppendMetricQueryBeginPrologue( zet_command_list_handle_t hCommandList, zet_metric_query_handle_t hMetricQuery ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetCommandListAppendMetricQueryEndPrologue( zet_command_list_handle_t hCommandList, zet_metric_query_handle_t hMetricQuery, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetCommandListAppendMetricMemoryBarrierPrologue( zet_command_list_handle_t hCommandList ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetMetricQueryGetDataPrologue( zet_metric_query_handle_t hMetricQuery, size_t* pRawDataSize, uint8_t* pRawData ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetKernelGetProfileInfoPrologue( zet_kernel_handle_t hKernel, zet_profile_properties_t* pProfileProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetTracerExpCreatePrologue( zet_context_handle_t hContext, const zet_tracer_exp_desc_t* desc, zet_tracer_exp_handle_t* phTracer ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetTracerExpDestroyPrologue( zet_tracer_exp_handle_t hTracer ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetTracerExpSetProloguesPrologue( zet_tracer_exp_handle_t hTracer, zet_core_callbacks_t* pCoreCbs ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetTracerExpSetEpiloguesPrologue( zet_tracer_exp_handle_t hTracer, zet_core_callbacks_t* pCoreCbs ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetTracerExpSetEnabledPrologue( zet_tracer_exp_handle_t hTracer, ze_bool_t enable ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_0) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetDeviceGetConcurrentMetricGroupsExpPrologue( zet_device_handle_t hDevice, uint32_t metricGroupCount, zet_metric_group_handle_t * phMetricGroups, uint32_t * pMetricGroupsCountPerConcurrentGroup, uint32_t * pConcurrentGroupCount ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_10) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetMetricTracerCreateExpPrologue( zet_context_handle_t hContext, zet_device_handle_t hDevice, uint32_t metricGroupCount, zet_metric_group_handle_t* phMetricGroups, zet_metric_tracer_exp_desc_t* desc, ze_event_handle_t hNotificationEvent, zet_metric_tracer_exp_handle_t* phMetricTracer ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_10) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetMetricTracerDestroyExpPrologue( zet_metric_tracer_exp_handle_t hMetricTracer ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_10) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetMetricTracerEnableExpPrologue( zet_metric_tracer_exp_handle_t hMetricTracer, ze_bool_t synchronous ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_10) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetMetricTracerDisableExpPrologue( zet_metric_tracer_exp_handle_t hMetricTracer, ze_bool_t synchronous ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_10) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetMetricTracerReadDataExpPrologue( zet_metric_tracer_exp_handle_t hMetricTracer, size_t* pRawDataSize, uint8_t* pRawData ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_10) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetMetricDecoderCreateExpPrologue( zet_metric_tracer_exp_handle_t hMetricTracer, zet_metric_decoder_exp_handle_t* phMetricDecoder ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_10) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetMetricDecoderDestroyExpPrologue( zet_metric_decoder_exp_handle_t phMetricDecoder ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_10) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetMetricDecoderGetDecodableMetricsExpPrologue( zet_metric_decoder_exp_handle_t hMetricDecoder, uint32_t* pCount, zet_metric_handle_t* phMetrics ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_10) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetMetricTracerDecodeExpPrologue( zet_metric_decoder_exp_handle_t phMetricDecoder, size_t* pRawDataSize, uint8_t* pRawData, uint32_t metricsCount, zet_metric_handle_t* phMetrics, uint32_t* pSetCount, uint32_t* pMetricEntriesCountPerSet, uint32_t* pMetricEntriesCount, zet_metric_entry_exp_t* pMetricEntries ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_10) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetCommandListAppendMarkerExpPrologue( zet_command_list_handle_t hCommandList, zet_metric_group_handle_t hMetricGroup, uint32_t value ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_13) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetDeviceEnableMetricsExpPrologue( zet_device_handle_t hDevice ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_13) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetDeviceDisableMetricsExpPrologue( zet_device_handle_t hDevice ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_13) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetMetricGroupCalculateMultipleMetricValuesExpPrologue( zet_metric_group_handle_t hMetricGroup, zet_metric_group_calculation_type_t type, size_t rawDataSize, const uint8_t* pRawData, uint32_t* pSetCount, uint32_t* pTotalMetricValueCount, uint32_t* pMetricCounts, zet_typed_value_t* pMetricValues ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_2) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetMetricGroupGetGlobalTimestampsExpPrologue( zet_metric_group_handle_t hMetricGroup, ze_bool_t synchronizedWithHost, uint64_t* globalTimestamp, uint64_t* metricTimestamp ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_5) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetMetricGroupGetExportDataExpPrologue( zet_metric_group_handle_t hMetricGroup, const uint8_t* pRawData, size_t rawDataSize, size_t* pExportDataSize, uint8_t * pExportData ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_6) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetMetricGroupCalculateMetricExportDataExpPrologue( ze_driver_handle_t hDriver, zet_metric_group_calculation_type_t type, size_t exportDataSize, const uint8_t* pExportData, zet_metric_calculate_exp_desc_t* pCalculateDescriptor, uint32_t* pSetCount, uint32_t* pTotalMetricValueCount, uint32_t* pMetricCounts, zet_typed_value_t* pMetricValues ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_6) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetMetricProgrammableGetExpPrologue( zet_device_handle_t hDevice, uint32_t* pCount, zet_metric_programmable_exp_handle_t* phMetricProgrammables ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_9) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetMetricProgrammableGetPropertiesExpPrologue( zet_metric_programmable_exp_handle_t hMetricProgrammable, zet_metric_programmable_exp_properties_t* pProperties ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_9) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetMetricProgrammableGetParamInfoExpPrologue( zet_metric_programmable_exp_handle_t hMetricProgrammable, uint32_t* pParameterCount, zet_metric_programmable_param_info_exp_t* pParameterInfo ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_9) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetMetricProgrammableGetParamValueInfoExpPrologue( zet_metric_programmable_exp_handle_t hMetricProgrammable, uint32_t parameterOrdinal, uint32_t* pValueInfoCount, zet_metric_programmable_param_value_info_exp_t* pValueInfo ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_9) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetMetricCreateFromProgrammableExp2Prologue( zet_metric_programmable_exp_handle_t hMetricProgrammable, uint32_t parameterCount, zet_metric_programmable_param_value_exp_t* pParameterValues, const char* pName, const char* pDescription, uint32_t* pMetricHandleCount, zet_metric_handle_t* phMetricHandles ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_11) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetMetricCreateFromProgrammableExpPrologue( zet_metric_programmable_exp_handle_t hMetricProgrammable, zet_metric_programmable_param_value_exp_t* pParameterValues, uint32_t parameterCount, const char* pName, const char* pDescription, uint32_t* pMetricHandleCount, zet_metric_handle_t* phMetricHandles ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_9) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetDeviceCreateMetricGroupsFromMetricsExpPrologue( zet_device_handle_t hDevice, uint32_t metricCount, zet_metric_handle_t * phMetrics, const char * pMetricGroupNamePrefix, const char * pDescription, uint32_t * pMetricGroupCount, zet_metric_group_handle_t* phMetricGroup ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_10) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetMetricGroupCreateExpPrologue( zet_device_handle_t hDevice, const char* pName, const char* pDescription, zet_metric_group_sampling_type_flags_t samplingType, zet_metric_group_handle_t* phMetricGroup ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_9) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetMetricGroupAddMetricExpPrologue( zet_metric_group_handle_t hMetricGroup, zet_metric_handle_t hMetric, size_t * pErrorStringSize, char* pErrorString ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_9) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetMetricGroupRemoveMetricExpPrologue( zet_metric_group_handle_t hMetricGroup, zet_metric_handle_t hMetric ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_9) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetMetricGroupCloseExpPrologue( zet_metric_group_handle_t hMetricGroup ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_9) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetMetricGroupDestroyExpPrologue( zet_metric_group_handle_t hMetricGroup ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_9) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
-    }
-    virtual ze_result_t zetMetricDestroyExpPrologue( zet_metric_handle_t hMetric ) override {
-        if (GlobalCertificationState::getInstance().certification_version < ZE_API_VERSION_1_9) {
-            return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-        }
-        return ZE_RESULT_SUCCESS;
+    static ze_result_t ZE_APICALL zetModuleGetDebugInfoUnsupported( zet_module_handle_t hModule, zet_module_debug_info_format_t format, size_t* pSize, uint8_t* pDebugInfo ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetDeviceGetDebugPropertiesUnsupported( zet_device_handle_t hDevice, zet_device_debug_properties_t* pDebugProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetDebugAttachUnsupported( zet_device_handle_t hDevice, const zet_debug_config_t* config, zet_debug_session_handle_t* phDebug ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetDebugDetachUnsupported( zet_debug_session_handle_t hDebug ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetDebugReadEventUnsupported( zet_debug_session_handle_t hDebug, uint64_t timeout, zet_debug_event_t* event ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetDebugAcknowledgeEventUnsupported( zet_debug_session_handle_t hDebug, const zet_debug_event_t* event ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetDebugInterruptUnsupported( zet_debug_session_handle_t hDebug, ze_device_thread_t thread ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetDebugResumeUnsupported( zet_debug_session_handle_t hDebug, ze_device_thread_t thread ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetDebugReadMemoryUnsupported( zet_debug_session_handle_t hDebug, ze_device_thread_t thread, const zet_debug_memory_space_desc_t* desc, size_t size, void* buffer ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetDebugWriteMemoryUnsupported( zet_debug_session_handle_t hDebug, ze_device_thread_t thread, const zet_debug_memory_space_desc_t* desc, size_t size, const void* buffer ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetDebugGetRegisterSetPropertiesUnsupported( zet_device_handle_t hDevice, uint32_t* pCount, zet_debug_regset_properties_t* pRegisterSetProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetDebugGetThreadRegisterSetPropertiesUnsupported( zet_debug_session_handle_t hDebug, ze_device_thread_t thread, uint32_t* pCount, zet_debug_regset_properties_t* pRegisterSetProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetDebugReadRegistersUnsupported( zet_debug_session_handle_t hDebug, ze_device_thread_t thread, uint32_t type, uint32_t start, uint32_t count, void* pRegisterValues ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetDebugWriteRegistersUnsupported( zet_debug_session_handle_t hDebug, ze_device_thread_t thread, uint32_t type, uint32_t start, uint32_t count, void* pRegisterValues ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetMetricGroupGetUnsupported( zet_device_handle_t hDevice, uint32_t* pCount, zet_metric_group_handle_t* phMetricGroups ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetMetricGroupGetPropertiesUnsupported( zet_metric_group_handle_t hMetricGroup, zet_metric_group_properties_t* pProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetMetricGroupCalculateMetricValuesUnsupported( zet_metric_group_handle_t hMetricGroup, zet_metric_group_calculation_type_t type, size_t rawDataSize, const uint8_t* pRawData, uint32_t* pMetricValueCount, zet_typed_value_t* pMetricValues ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetMetricGetUnsupported( zet_metric_group_handle_t hMetricGroup, uint32_t* pCount, zet_metric_handle_t* phMetrics ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetMetricGetPropertiesUnsupported( zet_metric_handle_t hMetric, zet_metric_properties_t* pProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetContextActivateMetricGroupsUnsupported( zet_context_handle_t hContext, zet_device_handle_t hDevice, uint32_t count, zet_metric_group_handle_t* phMetricGroups ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetMetricStreamerOpenUnsupported( zet_context_handle_t hContext, zet_device_handle_t hDevice, zet_metric_group_handle_t hMetricGroup, zet_metric_streamer_desc_t* desc, ze_event_handle_t hNotificationEvent, zet_metric_streamer_handle_t* phMetricStreamer ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetCommandListAppendMetricStreamerMarkerUnsupported( zet_command_list_handle_t hCommandList, zet_metric_streamer_handle_t hMetricStreamer, uint32_t value ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetMetricStreamerCloseUnsupported( zet_metric_streamer_handle_t hMetricStreamer ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetMetricStreamerReadDataUnsupported( zet_metric_streamer_handle_t hMetricStreamer, uint32_t maxReportCount, size_t* pRawDataSize, uint8_t* pRawData ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetMetricQueryPoolCreateUnsupported( zet_context_handle_t hContext, zet_device_handle_t hDevice, zet_metric_group_handle_t hMetricGroup, const zet_metric_query_pool_desc_t* desc, zet_metric_query_pool_handle_t* phMetricQueryPool ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetMetricQueryPoolDestroyUnsupported( zet_metric_query_pool_handle_t hMetricQueryPool ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetMetricQueryCreateUnsupported( zet_metric_query_pool_handle_t hMetricQueryPool, uint32_t index, zet_metric_query_handle_t* phMetricQuery ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetMetricQueryDestroyUnsupported( zet_metric_query_handle_t hMetricQuery ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetMetricQueryResetUnsupported( zet_metric_query_handle_t hMetricQuery ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetCommandListAppendMetricQueryBeginUnsupported( zet_command_list_handle_t hCommandList, zet_metric_query_handle_t hMetricQuery ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetCommandListAppendMetricQueryEndUnsupported( zet_command_list_handle_t hCommandList, zet_metric_query_handle_t hMetricQuery, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetCommandListAppendMetricMemoryBarrierUnsupported( zet_command_list_handle_t hCommandList ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetMetricQueryGetDataUnsupported( zet_metric_query_handle_t hMetricQuery, size_t* pRawDataSize, uint8_t* pRawData ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetKernelGetProfileInfoUnsupported( zet_kernel_handle_t hKernel, zet_profile_properties_t* pProfileProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetTracerExpCreateUnsupported( zet_context_handle_t hContext, const zet_tracer_exp_desc_t* desc, zet_tracer_exp_handle_t* phTracer ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetTracerExpDestroyUnsupported( zet_tracer_exp_handle_t hTracer ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetTracerExpSetProloguesUnsupported( zet_tracer_exp_handle_t hTracer, zet_core_callbacks_t* pCoreCbs ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetTracerExpSetEpiloguesUnsupported( zet_tracer_exp_handle_t hTracer, zet_core_callbacks_t* pCoreCbs ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetTracerExpSetEnabledUnsupported( zet_tracer_exp_handle_t hTracer, ze_bool_t enable ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetDeviceGetConcurrentMetricGroupsExpUnsupported( zet_device_handle_t hDevice, uint32_t metricGroupCount, zet_metric_group_handle_t * phMetricGroups, uint32_t * pMetricGroupsCountPerConcurrentGroup, uint32_t * pConcurrentGroupCount ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetMetricTracerCreateExpUnsupported( zet_context_handle_t hContext, zet_device_handle_t hDevice, uint32_t metricGroupCount, zet_metric_group_handle_t* phMetricGroups, zet_metric_tracer_exp_desc_t* desc, ze_event_handle_t hNotificationEvent, zet_metric_tracer_exp_handle_t* phMetricTracer ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetMetricTracerDestroyExpUnsupported( zet_metric_tracer_exp_handle_t hMetricTracer ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetMetricTracerEnableExpUnsupported( zet_metric_tracer_exp_handle_t hMetricTracer, ze_bool_t synchronous ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetMetricTracerDisableExpUnsupported( zet_metric_tracer_exp_handle_t hMetricTracer, ze_bool_t synchronous ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetMetricTracerReadDataExpUnsupported( zet_metric_tracer_exp_handle_t hMetricTracer, size_t* pRawDataSize, uint8_t* pRawData ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetMetricDecoderCreateExpUnsupported( zet_metric_tracer_exp_handle_t hMetricTracer, zet_metric_decoder_exp_handle_t* phMetricDecoder ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetMetricDecoderDestroyExpUnsupported( zet_metric_decoder_exp_handle_t phMetricDecoder ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetMetricDecoderGetDecodableMetricsExpUnsupported( zet_metric_decoder_exp_handle_t hMetricDecoder, uint32_t* pCount, zet_metric_handle_t* phMetrics ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetMetricTracerDecodeExpUnsupported( zet_metric_decoder_exp_handle_t phMetricDecoder, size_t* pRawDataSize, uint8_t* pRawData, uint32_t metricsCount, zet_metric_handle_t* phMetrics, uint32_t* pSetCount, uint32_t* pMetricEntriesCountPerSet, uint32_t* pMetricEntriesCount, zet_metric_entry_exp_t* pMetricEntries ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetCommandListAppendMarkerExpUnsupported( zet_command_list_handle_t hCommandList, zet_metric_group_handle_t hMetricGroup, uint32_t value ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetDeviceEnableMetricsExpUnsupported( zet_device_handle_t hDevice ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetDeviceDisableMetricsExpUnsupported( zet_device_handle_t hDevice ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetMetricGroupCalculateMultipleMetricValuesExpUnsupported( zet_metric_group_handle_t hMetricGroup, zet_metric_group_calculation_type_t type, size_t rawDataSize, const uint8_t* pRawData, uint32_t* pSetCount, uint32_t* pTotalMetricValueCount, uint32_t* pMetricCounts, zet_typed_value_t* pMetricValues ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetMetricGroupGetGlobalTimestampsExpUnsupported( zet_metric_group_handle_t hMetricGroup, ze_bool_t synchronizedWithHost, uint64_t* globalTimestamp, uint64_t* metricTimestamp ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetMetricGroupGetExportDataExpUnsupported( zet_metric_group_handle_t hMetricGroup, const uint8_t* pRawData, size_t rawDataSize, size_t* pExportDataSize, uint8_t * pExportData ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetMetricGroupCalculateMetricExportDataExpUnsupported( ze_driver_handle_t hDriver, zet_metric_group_calculation_type_t type, size_t exportDataSize, const uint8_t* pExportData, zet_metric_calculate_exp_desc_t* pCalculateDescriptor, uint32_t* pSetCount, uint32_t* pTotalMetricValueCount, uint32_t* pMetricCounts, zet_typed_value_t* pMetricValues ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetMetricProgrammableGetExpUnsupported( zet_device_handle_t hDevice, uint32_t* pCount, zet_metric_programmable_exp_handle_t* phMetricProgrammables ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetMetricProgrammableGetPropertiesExpUnsupported( zet_metric_programmable_exp_handle_t hMetricProgrammable, zet_metric_programmable_exp_properties_t* pProperties ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetMetricProgrammableGetParamInfoExpUnsupported( zet_metric_programmable_exp_handle_t hMetricProgrammable, uint32_t* pParameterCount, zet_metric_programmable_param_info_exp_t* pParameterInfo ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetMetricProgrammableGetParamValueInfoExpUnsupported( zet_metric_programmable_exp_handle_t hMetricProgrammable, uint32_t parameterOrdinal, uint32_t* pValueInfoCount, zet_metric_programmable_param_value_info_exp_t* pValueInfo ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetMetricCreateFromProgrammableExp2Unsupported( zet_metric_programmable_exp_handle_t hMetricProgrammable, uint32_t parameterCount, zet_metric_programmable_param_value_exp_t* pParameterValues, const char* pName, const char* pDescription, uint32_t* pMetricHandleCount, zet_metric_handle_t* phMetricHandles ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetMetricCreateFromProgrammableExpUnsupported( zet_metric_programmable_exp_handle_t hMetricProgrammable, zet_metric_programmable_param_value_exp_t* pParameterValues, uint32_t parameterCount, const char* pName, const char* pDescription, uint32_t* pMetricHandleCount, zet_metric_handle_t* phMetricHandles ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetDeviceCreateMetricGroupsFromMetricsExpUnsupported( zet_device_handle_t hDevice, uint32_t metricCount, zet_metric_handle_t * phMetrics, const char * pMetricGroupNamePrefix, const char * pDescription, uint32_t * pMetricGroupCount, zet_metric_group_handle_t* phMetricGroup ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetMetricGroupCreateExpUnsupported( zet_device_handle_t hDevice, const char* pName, const char* pDescription, zet_metric_group_sampling_type_flags_t samplingType, zet_metric_group_handle_t* phMetricGroup ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetMetricGroupAddMetricExpUnsupported( zet_metric_group_handle_t hMetricGroup, zet_metric_handle_t hMetric, size_t * pErrorStringSize, char* pErrorString ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetMetricGroupRemoveMetricExpUnsupported( zet_metric_group_handle_t hMetricGroup, zet_metric_handle_t hMetric ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetMetricGroupCloseExpUnsupported( zet_metric_group_handle_t hMetricGroup ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetMetricGroupDestroyExpUnsupported( zet_metric_group_handle_t hMetricGroup ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+    static ze_result_t ZE_APICALL zetMetricDestroyExpUnsupported( zet_metric_handle_t hMetric ) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+
+    static void applyCertification(zet_dditable_t &table, const zet_dditable_t &original, ze_api_version_t version) {
+        table.Module.pfnGetDebugInfo = (original.Module.pfnGetDebugInfo && version < ZE_API_VERSION_1_0) ? zetModuleGetDebugInfoUnsupported : original.Module.pfnGetDebugInfo;
+        table.Device.pfnGetDebugProperties = (original.Device.pfnGetDebugProperties && version < ZE_API_VERSION_1_0) ? zetDeviceGetDebugPropertiesUnsupported : original.Device.pfnGetDebugProperties;
+        table.Debug.pfnAttach = (original.Debug.pfnAttach && version < ZE_API_VERSION_1_0) ? zetDebugAttachUnsupported : original.Debug.pfnAttach;
+        table.Debug.pfnDetach = (original.Debug.pfnDetach && version < ZE_API_VERSION_1_0) ? zetDebugDetachUnsupported : original.Debug.pfnDetach;
+        table.Debug.pfnReadEvent = (original.Debug.pfnReadEvent && version < ZE_API_VERSION_1_0) ? zetDebugReadEventUnsupported : original.Debug.pfnReadEvent;
+        table.Debug.pfnAcknowledgeEvent = (original.Debug.pfnAcknowledgeEvent && version < ZE_API_VERSION_1_0) ? zetDebugAcknowledgeEventUnsupported : original.Debug.pfnAcknowledgeEvent;
+        table.Debug.pfnInterrupt = (original.Debug.pfnInterrupt && version < ZE_API_VERSION_1_0) ? zetDebugInterruptUnsupported : original.Debug.pfnInterrupt;
+        table.Debug.pfnResume = (original.Debug.pfnResume && version < ZE_API_VERSION_1_0) ? zetDebugResumeUnsupported : original.Debug.pfnResume;
+        table.Debug.pfnReadMemory = (original.Debug.pfnReadMemory && version < ZE_API_VERSION_1_0) ? zetDebugReadMemoryUnsupported : original.Debug.pfnReadMemory;
+        table.Debug.pfnWriteMemory = (original.Debug.pfnWriteMemory && version < ZE_API_VERSION_1_0) ? zetDebugWriteMemoryUnsupported : original.Debug.pfnWriteMemory;
+        table.Debug.pfnGetRegisterSetProperties = (original.Debug.pfnGetRegisterSetProperties && version < ZE_API_VERSION_1_0) ? zetDebugGetRegisterSetPropertiesUnsupported : original.Debug.pfnGetRegisterSetProperties;
+        table.Debug.pfnGetThreadRegisterSetProperties = (original.Debug.pfnGetThreadRegisterSetProperties && version < ZE_API_VERSION_1_5) ? zetDebugGetThreadRegisterSetPropertiesUnsupported : original.Debug.pfnGetThreadRegisterSetProperties;
+        table.Debug.pfnReadRegisters = (original.Debug.pfnReadRegisters && version < ZE_API_VERSION_1_0) ? zetDebugReadRegistersUnsupported : original.Debug.pfnReadRegisters;
+        table.Debug.pfnWriteRegisters = (original.Debug.pfnWriteRegisters && version < ZE_API_VERSION_1_0) ? zetDebugWriteRegistersUnsupported : original.Debug.pfnWriteRegisters;
+        table.MetricGroup.pfnGet = (original.MetricGroup.pfnGet && version < ZE_API_VERSION_1_0) ? zetMetricGroupGetUnsupported : original.MetricGroup.pfnGet;
+        table.MetricGroup.pfnGetProperties = (original.MetricGroup.pfnGetProperties && version < ZE_API_VERSION_1_0) ? zetMetricGroupGetPropertiesUnsupported : original.MetricGroup.pfnGetProperties;
+        table.MetricGroup.pfnCalculateMetricValues = (original.MetricGroup.pfnCalculateMetricValues && version < ZE_API_VERSION_1_0) ? zetMetricGroupCalculateMetricValuesUnsupported : original.MetricGroup.pfnCalculateMetricValues;
+        table.Metric.pfnGet = (original.Metric.pfnGet && version < ZE_API_VERSION_1_0) ? zetMetricGetUnsupported : original.Metric.pfnGet;
+        table.Metric.pfnGetProperties = (original.Metric.pfnGetProperties && version < ZE_API_VERSION_1_0) ? zetMetricGetPropertiesUnsupported : original.Metric.pfnGetProperties;
+        table.Context.pfnActivateMetricGroups = (original.Context.pfnActivateMetricGroups && version < ZE_API_VERSION_1_0) ? zetContextActivateMetricGroupsUnsupported : original.Context.pfnActivateMetricGroups;
+        table.MetricStreamer.pfnOpen = (original.MetricStreamer.pfnOpen && version < ZE_API_VERSION_1_0) ? zetMetricStreamerOpenUnsupported : original.MetricStreamer.pfnOpen;
+        table.CommandList.pfnAppendMetricStreamerMarker = (original.CommandList.pfnAppendMetricStreamerMarker && version < ZE_API_VERSION_1_0) ? zetCommandListAppendMetricStreamerMarkerUnsupported : original.CommandList.pfnAppendMetricStreamerMarker;
+        table.MetricStreamer.pfnClose = (original.MetricStreamer.pfnClose && version < ZE_API_VERSION_1_0) ? zetMetricStreamerCloseUnsupported : original.MetricStreamer.pfnClose;
+        table.MetricStreamer.pfnReadData = (original.MetricStreamer.pfnReadData && version < ZE_API_VERSION_1_0) ? zetMetricStreamerReadDataUnsupported : original.MetricStreamer.pfnReadData;
+        table.MetricQueryPool.pfnCreate = (original.MetricQueryPool.pfnCreate && version < ZE_API_VERSION_1_0) ? zetMetricQueryPoolCreateUnsupported : original.MetricQueryPool.pfnCreate;
+        table.MetricQueryPool.pfnDestroy = (original.MetricQueryPool.pfnDestroy && version < ZE_API_VERSION_1_0) ? zetMetricQueryPoolDestroyUnsupported : original.MetricQueryPool.pfnDestroy;
+        table.MetricQuery.pfnCreate = (original.MetricQuery.pfnCreate && version < ZE_API_VERSION_1_0) ? zetMetricQueryCreateUnsupported : original.MetricQuery.pfnCreate;
+        table.MetricQuery.pfnDestroy = (original.MetricQuery.pfnDestroy && version < ZE_API_VERSION_1_0) ? zetMetricQueryDestroyUnsupported : original.MetricQuery.pfnDestroy;
+        table.MetricQuery.pfnReset = (original.MetricQuery.pfnReset && version < ZE_API_VERSION_1_0) ? zetMetricQueryResetUnsupported : original.MetricQuery.pfnReset;
+        table.CommandList.pfnAppendMetricQueryBegin = (original.CommandList.pfnAppendMetricQueryBegin && version < ZE_API_VERSION_1_0) ? zetCommandListAppendMetricQueryBeginUnsupported : original.CommandList.pfnAppendMetricQueryBegin;
+        table.CommandList.pfnAppendMetricQueryEnd = (original.CommandList.pfnAppendMetricQueryEnd && version < ZE_API_VERSION_1_0) ? zetCommandListAppendMetricQueryEndUnsupported : original.CommandList.pfnAppendMetricQueryEnd;
+        table.CommandList.pfnAppendMetricMemoryBarrier = (original.CommandList.pfnAppendMetricMemoryBarrier && version < ZE_API_VERSION_1_0) ? zetCommandListAppendMetricMemoryBarrierUnsupported : original.CommandList.pfnAppendMetricMemoryBarrier;
+        table.MetricQuery.pfnGetData = (original.MetricQuery.pfnGetData && version < ZE_API_VERSION_1_0) ? zetMetricQueryGetDataUnsupported : original.MetricQuery.pfnGetData;
+        table.Kernel.pfnGetProfileInfo = (original.Kernel.pfnGetProfileInfo && version < ZE_API_VERSION_1_0) ? zetKernelGetProfileInfoUnsupported : original.Kernel.pfnGetProfileInfo;
+        table.TracerExp.pfnCreate = (original.TracerExp.pfnCreate && version < ZE_API_VERSION_1_0) ? zetTracerExpCreateUnsupported : original.TracerExp.pfnCreate;
+        table.TracerExp.pfnDestroy = (original.TracerExp.pfnDestroy && version < ZE_API_VERSION_1_0) ? zetTracerExpDestroyUnsupported : original.TracerExp.pfnDestroy;
+        table.TracerExp.pfnSetPrologues = (original.TracerExp.pfnSetPrologues && version < ZE_API_VERSION_1_0) ? zetTracerExpSetProloguesUnsupported : original.TracerExp.pfnSetPrologues;
+        table.TracerExp.pfnSetEpilogues = (original.TracerExp.pfnSetEpilogues && version < ZE_API_VERSION_1_0) ? zetTracerExpSetEpiloguesUnsupported : original.TracerExp.pfnSetEpilogues;
+        table.TracerExp.pfnSetEnabled = (original.TracerExp.pfnSetEnabled && version < ZE_API_VERSION_1_0) ? zetTracerExpSetEnabledUnsupported : original.TracerExp.pfnSetEnabled;
+        table.DeviceExp.pfnGetConcurrentMetricGroupsExp = (original.DeviceExp.pfnGetConcurrentMetricGroupsExp && version < ZE_API_VERSION_1_10) ? zetDeviceGetConcurrentMetricGroupsExpUnsupported : original.DeviceExp.pfnGetConcurrentMetricGroupsExp;
+        table.MetricTracerExp.pfnCreateExp = (original.MetricTracerExp.pfnCreateExp && version < ZE_API_VERSION_1_10) ? zetMetricTracerCreateExpUnsupported : original.MetricTracerExp.pfnCreateExp;
+        table.MetricTracerExp.pfnDestroyExp = (original.MetricTracerExp.pfnDestroyExp && version < ZE_API_VERSION_1_10) ? zetMetricTracerDestroyExpUnsupported : original.MetricTracerExp.pfnDestroyExp;
+        table.MetricTracerExp.pfnEnableExp = (original.MetricTracerExp.pfnEnableExp && version < ZE_API_VERSION_1_10) ? zetMetricTracerEnableExpUnsupported : original.MetricTracerExp.pfnEnableExp;
+        table.MetricTracerExp.pfnDisableExp = (original.MetricTracerExp.pfnDisableExp && version < ZE_API_VERSION_1_10) ? zetMetricTracerDisableExpUnsupported : original.MetricTracerExp.pfnDisableExp;
+        table.MetricTracerExp.pfnReadDataExp = (original.MetricTracerExp.pfnReadDataExp && version < ZE_API_VERSION_1_10) ? zetMetricTracerReadDataExpUnsupported : original.MetricTracerExp.pfnReadDataExp;
+        table.MetricDecoderExp.pfnCreateExp = (original.MetricDecoderExp.pfnCreateExp && version < ZE_API_VERSION_1_10) ? zetMetricDecoderCreateExpUnsupported : original.MetricDecoderExp.pfnCreateExp;
+        table.MetricDecoderExp.pfnDestroyExp = (original.MetricDecoderExp.pfnDestroyExp && version < ZE_API_VERSION_1_10) ? zetMetricDecoderDestroyExpUnsupported : original.MetricDecoderExp.pfnDestroyExp;
+        table.MetricDecoderExp.pfnGetDecodableMetricsExp = (original.MetricDecoderExp.pfnGetDecodableMetricsExp && version < ZE_API_VERSION_1_10) ? zetMetricDecoderGetDecodableMetricsExpUnsupported : original.MetricDecoderExp.pfnGetDecodableMetricsExp;
+        table.MetricTracerExp.pfnDecodeExp = (original.MetricTracerExp.pfnDecodeExp && version < ZE_API_VERSION_1_10) ? zetMetricTracerDecodeExpUnsupported : original.MetricTracerExp.pfnDecodeExp;
+        table.CommandListExp.pfnAppendMarkerExp = (original.CommandListExp.pfnAppendMarkerExp && version < ZE_API_VERSION_1_13) ? zetCommandListAppendMarkerExpUnsupported : original.CommandListExp.pfnAppendMarkerExp;
+        table.DeviceExp.pfnEnableMetricsExp = (original.DeviceExp.pfnEnableMetricsExp && version < ZE_API_VERSION_1_13) ? zetDeviceEnableMetricsExpUnsupported : original.DeviceExp.pfnEnableMetricsExp;
+        table.DeviceExp.pfnDisableMetricsExp = (original.DeviceExp.pfnDisableMetricsExp && version < ZE_API_VERSION_1_13) ? zetDeviceDisableMetricsExpUnsupported : original.DeviceExp.pfnDisableMetricsExp;
+        table.MetricGroupExp.pfnCalculateMultipleMetricValuesExp = (original.MetricGroupExp.pfnCalculateMultipleMetricValuesExp && version < ZE_API_VERSION_1_2) ? zetMetricGroupCalculateMultipleMetricValuesExpUnsupported : original.MetricGroupExp.pfnCalculateMultipleMetricValuesExp;
+        table.MetricGroupExp.pfnGetGlobalTimestampsExp = (original.MetricGroupExp.pfnGetGlobalTimestampsExp && version < ZE_API_VERSION_1_5) ? zetMetricGroupGetGlobalTimestampsExpUnsupported : original.MetricGroupExp.pfnGetGlobalTimestampsExp;
+        table.MetricGroupExp.pfnGetExportDataExp = (original.MetricGroupExp.pfnGetExportDataExp && version < ZE_API_VERSION_1_6) ? zetMetricGroupGetExportDataExpUnsupported : original.MetricGroupExp.pfnGetExportDataExp;
+        table.MetricGroupExp.pfnCalculateMetricExportDataExp = (original.MetricGroupExp.pfnCalculateMetricExportDataExp && version < ZE_API_VERSION_1_6) ? zetMetricGroupCalculateMetricExportDataExpUnsupported : original.MetricGroupExp.pfnCalculateMetricExportDataExp;
+        table.MetricProgrammableExp.pfnGetExp = (original.MetricProgrammableExp.pfnGetExp && version < ZE_API_VERSION_1_9) ? zetMetricProgrammableGetExpUnsupported : original.MetricProgrammableExp.pfnGetExp;
+        table.MetricProgrammableExp.pfnGetPropertiesExp = (original.MetricProgrammableExp.pfnGetPropertiesExp && version < ZE_API_VERSION_1_9) ? zetMetricProgrammableGetPropertiesExpUnsupported : original.MetricProgrammableExp.pfnGetPropertiesExp;
+        table.MetricProgrammableExp.pfnGetParamInfoExp = (original.MetricProgrammableExp.pfnGetParamInfoExp && version < ZE_API_VERSION_1_9) ? zetMetricProgrammableGetParamInfoExpUnsupported : original.MetricProgrammableExp.pfnGetParamInfoExp;
+        table.MetricProgrammableExp.pfnGetParamValueInfoExp = (original.MetricProgrammableExp.pfnGetParamValueInfoExp && version < ZE_API_VERSION_1_9) ? zetMetricProgrammableGetParamValueInfoExpUnsupported : original.MetricProgrammableExp.pfnGetParamValueInfoExp;
+        table.MetricExp.pfnCreateFromProgrammableExp2 = (original.MetricExp.pfnCreateFromProgrammableExp2 && version < ZE_API_VERSION_1_11) ? zetMetricCreateFromProgrammableExp2Unsupported : original.MetricExp.pfnCreateFromProgrammableExp2;
+        table.MetricExp.pfnCreateFromProgrammableExp = (original.MetricExp.pfnCreateFromProgrammableExp && version < ZE_API_VERSION_1_9) ? zetMetricCreateFromProgrammableExpUnsupported : original.MetricExp.pfnCreateFromProgrammableExp;
+        table.DeviceExp.pfnCreateMetricGroupsFromMetricsExp = (original.DeviceExp.pfnCreateMetricGroupsFromMetricsExp && version < ZE_API_VERSION_1_10) ? zetDeviceCreateMetricGroupsFromMetricsExpUnsupported : original.DeviceExp.pfnCreateMetricGroupsFromMetricsExp;
+        table.MetricGroupExp.pfnCreateExp = (original.MetricGroupExp.pfnCreateExp && version < ZE_API_VERSION_1_9) ? zetMetricGroupCreateExpUnsupported : original.MetricGroupExp.pfnCreateExp;
+        table.MetricGroupExp.pfnAddMetricExp = (original.MetricGroupExp.pfnAddMetricExp && version < ZE_API_VERSION_1_9) ? zetMetricGroupAddMetricExpUnsupported : original.MetricGroupExp.pfnAddMetricExp;
+        table.MetricGroupExp.pfnRemoveMetricExp = (original.MetricGroupExp.pfnRemoveMetricExp && version < ZE_API_VERSION_1_9) ? zetMetricGroupRemoveMetricExpUnsupported : original.MetricGroupExp.pfnRemoveMetricExp;
+        table.MetricGroupExp.pfnCloseExp = (original.MetricGroupExp.pfnCloseExp && version < ZE_API_VERSION_1_9) ? zetMetricGroupCloseExpUnsupported : original.MetricGroupExp.pfnCloseExp;
+        table.MetricGroupExp.pfnDestroyExp = (original.MetricGroupExp.pfnDestroyExp && version < ZE_API_VERSION_1_9) ? zetMetricGroupDestroyExpUnsupported : original.MetricGroupExp.pfnDestroyExp;
+        table.MetricExp.pfnDestroyExp = (original.MetricExp.pfnDestroyExp && version < ZE_API_VERSION_1_9) ? zetMetricDestroyExpUnsupported : original.MetricExp.pfnDestroyExp;
     }
 };
 } // namespace validation_layer
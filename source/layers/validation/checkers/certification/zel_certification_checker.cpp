@@ -11,19 +11,10 @@
 
 namespace validation_layer {
 class certificationChecker certification_checker;
-using ze_checker = certificationChecker::ZEcertificationChecker;
 
 certificationChecker::certificationChecker() {
   enablecertification = getenv_tobool("ZEL_ENABLE_CERTIFICATION_CHECKER");
   if (enablecertification) {
-    certificationChecker::ZEcertificationChecker *zeChecker =
-        new certificationChecker::ZEcertificationChecker;
-    certificationChecker::ZEScertificationChecker *zesChecker =
-        new certificationChecker::ZEScertificationChecker;
-    certificationChecker::ZETcertificationChecker *zetChecker =
-        new certificationChecker::ZETcertificationChecker;
-    certificationChecker::ZERcertificationChecker *zerChecker =
-        new certificationChecker::ZERcertificationChecker;
     ze_api_version_t certification_version = ZE_API_VERSION_CURRENT;
     const auto certification_version_string =
         getenv_string("ZEL_CERTIFICATION_CHECKER_VERSION");
@@ -37,32 +28,65 @@ certificationChecker::certificationChecker() {
       globalCertificationState.default_mode = false;
     }
     globalCertificationState.certification_version = certification_version;
-    certification_checker.zeValidation = zeChecker;
-    certification_checker.zetValidation = zetChecker;
-    certification_checker.zesValidation = zesChecker;
-    certification_checker.zerValidation = zerChecker;
-    validation_layer::context.getInstance().validationHandlers.push_back(
-        &certification_checker);
+    validation_layer::context.getInstance().ddiTablesReadyCallbacks.push_back(
+        &certificationChecker::onDdiTablesReady);
   }
 }
 
-certificationChecker::~certificationChecker() {
-  if (enablecertification) {
-    delete certification_checker.zeValidation;
-    delete certification_checker.zetValidation;
-    delete certification_checker.zesValidation;
-    delete certification_checker.zerValidation;
+void certificationChecker::onDdiTablesReady() {
+  auto &checker = certification_checker;
+  checker.originalZeDdiTable = context.zeDdiTable;
+  checker.originalZetDdiTable = context.zetDdiTable;
+  checker.originalZesDdiTable = context.zesDdiTable;
+  checker.originalZerDdiTable = context.zerDdiTable;
+  if (checker.globalCertificationState.default_mode) {
+    checker.globalCertificationState.certification_version =
+        checker.getMinimumDriverVersion();
   }
+  const auto version = checker.globalCertificationState.certification_version;
+  context.logger->log_debug("Certification checker restricting APIs to version {}.{}",
+                            ZE_MAJOR_VERSION(version), ZE_MINOR_VERSION(version));
+  checker.applyCertification();
 }
 
-ze_result_t ze_checker::zeDriverGetApiVersionEpilogue(
-    ze_driver_handle_t hDriver, ze_api_version_t *version, ze_result_t result) {
-  auto &globalCertificationState = GlobalCertificationState::getInstance();
-  if (result == ZE_RESULT_SUCCESS && version != nullptr &&
-      globalCertificationState.default_mode) {
-    globalCertificationState.certification_version = *version;
+// The oldest version reported by any driver, or ZE_API_VERSION_CURRENT when
+// no driver can be queried (e.g. only zesInit has been called)
+ze_api_version_t certificationChecker::getMinimumDriverVersion() {
+  ze_api_version_t minimumVersion = ZE_API_VERSION_CURRENT;
+  auto pfnGet = originalZeDdiTable.Driver.pfnGet;
+  auto pfnGetApiVersion = originalZeDdiTable.Driver.pfnGetApiVersion;
+  if (pfnGet == nullptr || pfnGetApiVersion == nullptr)
+    return minimumVersion;
+
+  uint32_t driverCount = 0;
+  if (pfnGet(&driverCount, nullptr) != ZE_RESULT_SUCCESS || driverCount == 0)
+    return minimumVersion;
+  std::vector<ze_driver_handle_t> drivers(driverCount);
+  if (pfnGet(&driverCount, drivers.data()) != ZE_RESULT_SUCCESS)
+    return minimumVersion;
+
+  bool found = false;
+  for (uint32_t i = 0; i < driverCount; i++) {
+    ze_api_version_t version = ZE_API_VERSION_CURRENT;
+    if (pfnGetApiVersion(drivers[i], &version) != ZE_RESULT_SUCCESS)
+      continue;
+    if (!found || version < minimumVersion)
+      minimumVersion = version;
+    found = true;
   }
-  return ZE_RESULT_SUCCESS;
+  return minimumVersion;
+}
+
+void certificationChecker::applyCertification() {
+  const auto version = globalCertificationState.certification_version;
+  ZEcertificationCheckerGenerated::applyCertification(
+      context.zeDdiTable, originalZeDdiTable, version);
+  ZETcertificationCheckerGenerated::applyCertification(
+      context.zetDdiTable, originalZetDdiTable, version);
+  ZEScertificationCheckerGenerated::applyCertification(
+      context.zesDdiTable, originalZesDdiTable, version);
+  ZERcertificationCheckerGenerated::applyCertification(
+      context.zerDdiTable, originalZerDdiTable, version);
 }
 
 } // namespace validation_layer
@@ -18,25 +18,37 @@
 #include "ze_validation_layer.h"
 #include "zel_global_certification_state.h"
 
+#include <vector>
+
 namespace validation_layer {
 
-class __zedlllocal certificationChecker : public validationChecker {
+// The certification checker does not register prologues. After the first
+// successful zeInit, zeInitDrivers or zesInit it patches entries for APIs newer
+// than the certification version to stubs returning
+// ZE_RESULT_ERROR_UNSUPPORTED_VERSION. In default mode that version is the
+// oldest one reported by any driver. The tables are patched exactly once, so
+// no API call ever observes them being rewritten.
+class __zedlllocal certificationChecker {
 public:
   certificationChecker();
-  ~certificationChecker();
-  class ZEcertificationChecker : public ZEcertificationCheckerGenerated {
-    ze_result_t zeDriverGetApiVersionEpilogue(ze_driver_handle_t hDriver,
-                                              ze_api_version_t *version,
-                                              ze_result_t result) override;
-  };
-  class ZEScertificationChecker : public ZEScertificationCheckerGenerated {};
-  class ZETcertificationChecker : public ZETcertificationCheckerGenerated {};
-  class ZERcertificationChecker : public ZERcertificationCheckerGenerated {};
+  ~certificationChecker() = default;
+
+  static void onDdiTablesReady();
 
   bool enablecertification = false;
 
   GlobalCertificationState &globalCertificationState =
       GlobalCertificationState::getInstance();
+
+private:
+  ze_api_version_t getMinimumDriverVersion();
+  void applyCertification();
+
+  // Tables as populated by the loader, before any entries were patched
+  ze_dditable_t originalZeDdiTable = {};
+  zet_dditable_t originalZetDdiTable = {};
+  zes_dditable_t originalZesDdiTable = {};
+  zer_dditable_t originalZerDdiTable = {};
 };
 extern class certificationChecker certification_checker;
 } // namespace validation_layer
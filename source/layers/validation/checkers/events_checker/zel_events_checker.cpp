@@ -14,6 +14,18 @@
 namespace validation_layer {
 class eventsChecker events_checker;
 
+// Warnings go to the findings log when ZEL_VALIDATION_FINDINGS_LOG is set, so
+// a repeated warning only bumps a counter; otherwise they are streamed to stderr
+template <typename Describe>
+static void reportWarning(const char *finding, const void *object, const Describe &describe) {
+    auto &findings = context.getInstance().findings;
+    if (findings) {
+        findings->report("events_checker", finding, findingSeverity::warning, object, describe);
+        return;
+    }
+    std::cerr << describe() << std::endl;
+}
+
 eventsChecker::eventsChecker() {
 
     enableEvents = getenv_tobool("ZEL_ENABLE_EVENTS_CHECKER");
@@ -27,6 +39,9 @@ eventsChecker::eventsChecker() {
         events_checker.zetValidation = zetChecker;
         events_checker.zerValidation = zerChecker;
 
+        events_checker.checkerName = "events_checker";
+        // Not sampled: a skipped signal, reset or append leaves the event DAG
+        // stale, which turns into false deadlock and reuse warnings
         validation_layer::context.getInstance().validationHandlers.push_back(&events_checker);
     }
 }
@@ -289,7 +304,11 @@ void eventsChecker::ZEeventsChecker::resetEventInEventToDagID(
     auto it = eventToDagID.find(hEvent);
     // Check if user is using invalid events, hint if it doesn't exist in eventToDagID.
     if (it == eventToDagID.end()) {
-        std::cerr << "Warning: hSignalEvent {" << hEvent << "} might be an invalid event in call to " << zeCallDisc << std::endl;
+        reportWarning("invalid-event", hEvent, [&]() {
+            std::ostringstream message;
+            message << "Warning: hSignalEvent {" << hEvent << "} might be an invalid event in call to " << zeCallDisc;
+            return message.str();
+        });
         return;
     }
 
@@ -494,8 +513,12 @@ void eventsChecker::ZEeventsChecker::validateSignalEventOwnership(const std::str
     if (it != eventToDagID.end() && it->second != invalidDagID) {
         const auto actionIt = dagIDToAction.find(it->second);
         if (actionIt != dagIDToAction.end()) {
-            const std::string previousActionOwner = actionIt->second.first;
-            std::cerr << "Warning: " << zeCallDisc << " is using the same ze_event_handle_t for signal {" << hSignalEvent << "} which has been previously used by: " << previousActionOwner << std::endl;
+            const std::string &previousActionOwner = actionIt->second.first;
+            reportWarning("signal-event-reused", hSignalEvent, [&]() {
+                std::ostringstream message;
+                message << "Warning: " << zeCallDisc << " is using the same ze_event_handle_t for signal {" << hSignalEvent << "} which has been previously used by: " << previousActionOwner;
+                return message.str();
+            });
         }
     }
 }
@@ -514,7 +537,11 @@ void eventsChecker::ZEeventsChecker::checkForDeadlock(
         auto it = eventToDagID.find(hSignalEvent);
         // Check if user is using invalid events, hint if it doesn't exist in eventToDagID.
         if (it == eventToDagID.end()) {
-            std::cerr << "Warning: hSignalEvent {" << hSignalEvent << "} might be an invalid event in call to " << zeCallDisc << std::endl;
+            reportWarning("invalid-event", hSignalEvent, [&]() {
+                std::ostringstream message;
+                message << "Warning: hSignalEvent {" << hSignalEvent << "} might be an invalid event in call to " << zeCallDisc;
+                return message.str();
+            });
             return;
         }
 
@@ -531,7 +558,11 @@ void eventsChecker::ZEeventsChecker::checkForDeadlock(
 
     for (uint32_t i = 0; i < numWaitEvents; i++) {
         if (eventToDagID.find(phWaitEvents[i]) == eventToDagID.end()) {
-            std::cerr << "Warning: phWaitEvents {" << hSignalEvent << "} might be an invalid event in call to " << zeCallDisc << std::endl;
+            reportWarning("invalid-event", phWaitEvents[i], [&]() {
+                std::ostringstream message;
+                message << "Warning: phWaitEvents {" << hSignalEvent << "} might be an invalid event in call to " << zeCallDisc;
+                return message.str();
+            });
             return;
         }
     }
@@ -563,7 +594,11 @@ void eventsChecker::ZEeventsChecker::checkForDeadlock(
     for (uint32_t i = 0; i < numWaitEvents; i++) {
         auto it = eventToDagID.find(phWaitEvents[i]);
         if (it == eventToDagID.end()) {
-            std::cerr << "Warning: phWaitEvents {" << phWaitEvents[i] << "} might be an invalid event in call to " << zeCallDisc << std::endl;
+            reportWarning("invalid-event", phWaitEvents[i], [&]() {
+                std::ostringstream message;
+                message << "Warning: phWaitEvents {" << phWaitEvents[i] << "} might be an invalid event in call to " << zeCallDisc;
+                return message.str();
+            });
             return;
         }
         uint32_t dagID = it->second;
@@ -582,24 +617,28 @@ void eventsChecker::ZEeventsChecker::checkForDeadlock(
             std::string fromAction = getActionDetails(dagID);
             std::string toAction = getActionDetails(this_action_new_node_id);
 
-            std::cerr << "Warning: There may be a potential event deadlock!\n";
-            std::cerr << "Adding the following dependency would create a cycle in the DAG:\n\tFrom: " << fromAction << "\n\tTo: " << toAction << "\n";
-            std::cerr << "There is already a path:\n";
-
-            constexpr uint32_t maxPathLength = 15;
-            auto path = dag.PathDagIDs(this_action_new_node_id, dagID, maxPathLength);
-            auto dagIDsInPath = path.first;
-            std::cerr << getActionDetails(dagIDsInPath[0]) << "\n";
-            std::string spacePrefix = "";
-            for (uint32_t j = 1; j < dagIDsInPath.size(); j++) {
-                std::cerr << spacePrefix << "|\n"
-                          << spacePrefix << "-> " << getActionDetails(dagIDsInPath[j]) << "\n";
-                spacePrefix += "   ";
-            }
-            if (path.second) {
-                std::cerr << spacePrefix << "|\n"
-                          << spacePrefix << "-> ...\n";
-            }
+            reportWarning("potential-deadlock", hSignalEvent, [&]() {
+                std::ostringstream message;
+                message << "Warning: There may be a potential event deadlock!\n";
+                message << "Adding the following dependency would create a cycle in the DAG:\n\tFrom: " << fromAction << "\n\tTo: " << toAction << "\n";
+                message << "There is already a path:\n";
+
+                constexpr uint32_t maxPathLength = 15;
+                auto path = dag.PathDagIDs(this_action_new_node_id, dagID, maxPathLength);
+                auto dagIDsInPath = path.first;
+                message << getActionDetails(dagIDsInPath[0]) << "\n";
+                std::string spacePrefix = "";
+                for (uint32_t j = 1; j < dagIDsInPath.size(); j++) {
+                    message << spacePrefix << "|\n"
+                            << spacePrefix << "-> " << getActionDetails(dagIDsInPath[j]) << "\n";
+                    spacePrefix += "   ";
+                }
+                if (path.second) {
+                    message << spacePrefix << "|\n"
+                            << spacePrefix << "-> ...\n";
+                }
+                return message.str();
+            });
         }
     }
 }
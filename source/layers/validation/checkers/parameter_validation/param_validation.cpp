@@ -0,0 +1,80 @@
+/*
+ *
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file param_validation.cpp
+ *
+ */
+#include "param_validation.h"
+
+#include <cstring>
+
+namespace validation_layer
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    // Reads a check's operand: the argument itself, or a field of the struct it
+    // points to, zero-extended to 64 bits
+    static inline uint64_t readOperand(const paramCheck &check, const uint64_t *values)
+    {
+        uint64_t value = values[check.value];
+        if (check.width == 0)
+            return value;
+        auto field = reinterpret_cast<const uint8_t *>(static_cast<uintptr_t>(value)) + check.offset;
+        switch (check.width) {
+        case 1: {
+            uint8_t narrow;
+            memcpy(&narrow, field, sizeof(narrow));
+            return narrow;
+        }
+        case 2: {
+            uint16_t narrow;
+            memcpy(&narrow, field, sizeof(narrow));
+            return narrow;
+        }
+        case 4: {
+            uint32_t narrow;
+            memcpy(&narrow, field, sizeof(narrow));
+            return narrow;
+        }
+        default: {
+            uint64_t wide;
+            memcpy(&wide, field, sizeof(wide));
+            return wide;
+        }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    ze_result_t validateParamTable(const paramCheck *checks, size_t checkCount, const uint64_t *values)
+    {
+        for (size_t i = 0; i < checkCount; i++) {
+            auto &check = checks[i];
+            bool failed;
+            switch (check.kind) {
+            case paramCheck::isNull:
+            case paramCheck::isZero:
+                failed = readOperand(check, values) == 0;
+                break;
+            case paramCheck::isNullWithCount:
+                failed = readOperand(check, values) == 0 && values[check.count] != 0;
+                break;
+            case paramCheck::isAbove:
+                failed = readOperand(check, values) > check.bound;
+                break;
+            case paramCheck::isNotPowerOfTwo: {
+                auto value = readOperand(check, values);
+                failed = (value & (value - 1)) != 0;
+                break;
+            }
+            default:
+                failed = false;
+                break;
+            }
+            if (failed)
+                return check.result;
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+} // namespace validation_layer
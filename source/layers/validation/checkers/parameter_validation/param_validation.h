@@ -7,6 +7,9 @@
 #include "zet_parameter_validation.h"
 #include "zes_parameter_validation.h"
 #include "zer_parameter_validation.h"
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
 #include <vector>
 
 
@@ -21,6 +24,49 @@ namespace validation_layer
     };
     extern class parameterValidationChecker parameterChecker;
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// One entry of the check table a generated prologue passes to validateParams.
+    /// The operand is values[value], or when width is set, the field of that many
+    /// bytes at offset in the struct values[value] points to. Checks run in table
+    /// order, so a pointer is always checked for null before its fields are read.
+    /// Prologues with fewer checks than a table pays for keep them inline.
+    struct paramCheck {
+        enum checkKind : uint8_t {
+            isNull,           ///< operand is null
+            isNullWithCount,  ///< operand is null while values[count] is non-zero
+            isZero,           ///< operand is zero
+            isAbove,          ///< operand is greater than bound
+            isNotPowerOfTwo,  ///< operand has more than one bit set
+        };
+        checkKind kind;
+        uint8_t value;
+        uint8_t count;
+        uint8_t width;
+        uint16_t offset;
+        ze_result_t result;
+        uint32_t bound;
+    };
+
+    /// Converts a prologue argument to the table's value representation
+    template <typename T>
+    inline uint64_t paramValue(T *pointer) {
+        return static_cast<uint64_t>(reinterpret_cast<uintptr_t>(pointer));
+    }
+    template <typename T>
+    inline uint64_t paramValue(T value) {
+        static_assert(std::is_integral<T>::value || std::is_enum<T>::value, "only pointers, integers and enums can be checked");
+        // Zero-extended, as fields read through a pointer are
+        return static_cast<uint64_t>(static_cast<typename std::make_unsigned<T>::type>(value));
+    }
+
+    /// Runs the checks in order and returns the result of the first that fails
+    ze_result_t validateParamTable(const paramCheck *checks, size_t checkCount, const uint64_t *values);
+
+    template <size_t checkCount, size_t valueCount>
+    inline ze_result_t validateParams(const paramCheck (&checks)[checkCount], const uint64_t (&values)[valueCount]) {
+        return validateParamTable(checks, checkCount, values);
+    }
+
     class ParameterValidation {
     public:
         ZEParameterValidation zeParamValidation;
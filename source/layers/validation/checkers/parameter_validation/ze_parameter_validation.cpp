@@ -27,6 +27,8 @@ namespace validation_layer
             parameterChecker.zetValidation = zetChecker;
             parameterChecker.zesValidation = zesChecker;
             parameterChecker.zerValidation = zerChecker;
+            parameterChecker.checkerName = "parameter_validation";
+            validation_layer::context.getInstance().initSampleRate(parameterChecker, "ZEL_PARAMETER_VALIDATION_SAMPLE_RATE");
             validation_layer::context.getInstance().validationHandlers.push_back(&parameterChecker);
         }
     }
@@ -564,17 +566,15 @@ namespace validation_layer
         ze_context_handle_t* phContext                  ///< [out] pointer to handle of context object created
         )
     {
-        if( nullptr == hDriver )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == desc )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == phContext )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( 0x1 < desc->flags )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isAbove, 1, 0, sizeof(ze_context_desc_t::flags), offsetof(ze_context_desc_t, flags), ZE_RESULT_ERROR_INVALID_ENUMERATION, 0x1 },
+        };
+        const uint64_t values[] = { paramValue( hDriver ), paramValue( desc ), paramValue( phContext ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ParameterValidation::validateExtensions(desc);
     }
@@ -597,20 +597,16 @@ namespace validation_layer
         ze_context_handle_t* phContext                  ///< [out] pointer to handle of context object created
         )
     {
-        if( nullptr == hDriver )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == desc )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == phContext )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( 0x1 < desc->flags )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
-
-        if( (nullptr == phDevices) && (0 < numDevices) )
-            return ZE_RESULT_ERROR_INVALID_SIZE;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isAbove, 1, 0, sizeof(ze_context_desc_t::flags), offsetof(ze_context_desc_t, flags), ZE_RESULT_ERROR_INVALID_ENUMERATION, 0x1 },
+            { paramCheck::isNullWithCount, 3, 4, 0, 0, ZE_RESULT_ERROR_INVALID_SIZE, 0 },
+        };
+        const uint64_t values[] = { paramValue( hDriver ), paramValue( desc ), paramValue( phContext ), paramValue( phDevices ), paramValue( numDevices ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ParameterValidation::validateExtensions(desc);
     }
@@ -648,26 +644,18 @@ namespace validation_layer
         ze_command_queue_handle_t* phCommandQueue       ///< [out] pointer to handle of command queue object created
         )
     {
-        if( nullptr == hContext )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == hDevice )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == desc )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == phCommandQueue )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( 0x7 < desc->flags )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
-
-        if( ZE_COMMAND_QUEUE_MODE_ASYNCHRONOUS < desc->mode )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
-
-        if( ZE_COMMAND_QUEUE_PRIORITY_PRIORITY_HIGH < desc->priority )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 3, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isAbove, 2, 0, sizeof(ze_command_queue_desc_t::flags), offsetof(ze_command_queue_desc_t, flags), ZE_RESULT_ERROR_INVALID_ENUMERATION, 0x7 },
+            { paramCheck::isAbove, 2, 0, sizeof(ze_command_queue_desc_t::mode), offsetof(ze_command_queue_desc_t, mode), ZE_RESULT_ERROR_INVALID_ENUMERATION, ZE_COMMAND_QUEUE_MODE_ASYNCHRONOUS },
+            { paramCheck::isAbove, 2, 0, sizeof(ze_command_queue_desc_t::priority), offsetof(ze_command_queue_desc_t, priority), ZE_RESULT_ERROR_INVALID_ENUMERATION, ZE_COMMAND_QUEUE_PRIORITY_PRIORITY_HIGH },
+        };
+        const uint64_t values[] = { paramValue( hContext ), paramValue( hDevice ), paramValue( desc ), paramValue( phCommandQueue ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ParameterValidation::validateExtensions(desc);
     }
@@ -766,20 +754,16 @@ namespace validation_layer
         ze_command_list_handle_t* phCommandList         ///< [out] pointer to handle of command list object created
         )
     {
-        if( nullptr == hContext )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == hDevice )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == desc )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == phCommandList )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( 0x1f < desc->flags )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 3, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isAbove, 2, 0, sizeof(ze_command_list_desc_t::flags), offsetof(ze_command_list_desc_t, flags), ZE_RESULT_ERROR_INVALID_ENUMERATION, 0x1f },
+        };
+        const uint64_t values[] = { paramValue( hContext ), paramValue( hDevice ), paramValue( desc ), paramValue( phCommandList ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ParameterValidation::validateExtensions(desc);
     }
@@ -793,26 +777,18 @@ namespace validation_layer
         ze_command_list_handle_t* phCommandList         ///< [out] pointer to handle of command list object created
         )
     {
-        if( nullptr == hContext )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == hDevice )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == altdesc )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == phCommandList )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( 0x7 < altdesc->flags )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
-
-        if( ZE_COMMAND_QUEUE_MODE_ASYNCHRONOUS < altdesc->mode )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
-
-        if( ZE_COMMAND_QUEUE_PRIORITY_PRIORITY_HIGH < altdesc->priority )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 3, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isAbove, 2, 0, sizeof(ze_command_queue_desc_t::flags), offsetof(ze_command_queue_desc_t, flags), ZE_RESULT_ERROR_INVALID_ENUMERATION, 0x7 },
+            { paramCheck::isAbove, 2, 0, sizeof(ze_command_queue_desc_t::mode), offsetof(ze_command_queue_desc_t, mode), ZE_RESULT_ERROR_INVALID_ENUMERATION, ZE_COMMAND_QUEUE_MODE_ASYNCHRONOUS },
+            { paramCheck::isAbove, 2, 0, sizeof(ze_command_queue_desc_t::priority), offsetof(ze_command_queue_desc_t, priority), ZE_RESULT_ERROR_INVALID_ENUMERATION, ZE_COMMAND_QUEUE_PRIORITY_PRIORITY_HIGH },
+        };
+        const uint64_t values[] = { paramValue( hContext ), paramValue( hDevice ), paramValue( altdesc ), paramValue( phCommandList ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ParameterValidation::validateExtensions(altdesc);
     }
@@ -1013,17 +989,15 @@ namespace validation_layer
                                                         ///< on before executing barrier
         )
     {
-        if( nullptr == hCommandList )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == pRangeSizes )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == pRanges )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( (nullptr == phWaitEvents) && (0 < numWaitEvents) )
-            return ZE_RESULT_ERROR_INVALID_SIZE;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNullWithCount, 3, 4, 0, 0, ZE_RESULT_ERROR_INVALID_SIZE, 0 },
+        };
+        const uint64_t values[] = { paramValue( hCommandList ), paramValue( pRangeSizes ), paramValue( pRanges ), paramValue( phWaitEvents ), paramValue( numWaitEvents ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ZE_RESULT_SUCCESS;
     }
@@ -1058,17 +1032,15 @@ namespace validation_layer
                                                         ///< on before launching
         )
     {
-        if( nullptr == hCommandList )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == dstptr )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == srcptr )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( (nullptr == phWaitEvents) && (0 < numWaitEvents) )
-            return ZE_RESULT_ERROR_INVALID_SIZE;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNullWithCount, 3, 4, 0, 0, ZE_RESULT_ERROR_INVALID_SIZE, 0 },
+        };
+        const uint64_t values[] = { paramValue( hCommandList ), paramValue( dstptr ), paramValue( srcptr ), paramValue( phWaitEvents ), paramValue( numWaitEvents ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ZE_RESULT_SUCCESS;
     }
@@ -1088,17 +1060,15 @@ namespace validation_layer
                                                         ///< on before launching
         )
     {
-        if( nullptr == hCommandList )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == ptr )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == pattern )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( (nullptr == phWaitEvents) && (0 < numWaitEvents) )
-            return ZE_RESULT_ERROR_INVALID_SIZE;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNullWithCount, 3, 4, 0, 0, ZE_RESULT_ERROR_INVALID_SIZE, 0 },
+        };
+        const uint64_t values[] = { paramValue( hCommandList ), paramValue( ptr ), paramValue( pattern ), paramValue( phWaitEvents ), paramValue( numWaitEvents ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ZE_RESULT_SUCCESS;
     }
@@ -1126,23 +1096,17 @@ namespace validation_layer
                                                         ///< on before launching
         )
     {
-        if( nullptr == hCommandList )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == dstptr )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == dstRegion )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == srcptr )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == srcRegion )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( (nullptr == phWaitEvents) && (0 < numWaitEvents) )
-            return ZE_RESULT_ERROR_INVALID_SIZE;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 3, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 4, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNullWithCount, 5, 6, 0, 0, ZE_RESULT_ERROR_INVALID_SIZE, 0 },
+        };
+        const uint64_t values[] = { paramValue( hCommandList ), paramValue( dstptr ), paramValue( dstRegion ), paramValue( srcptr ), paramValue( srcRegion ), paramValue( phWaitEvents ), paramValue( numWaitEvents ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ZE_RESULT_SUCCESS;
     }
@@ -1162,20 +1126,16 @@ namespace validation_layer
                                                         ///< on before launching
         )
     {
-        if( nullptr == hCommandList )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == hContextSrc )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == dstptr )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == srcptr )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( (nullptr == phWaitEvents) && (0 < numWaitEvents) )
-            return ZE_RESULT_ERROR_INVALID_SIZE;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 3, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNullWithCount, 4, 5, 0, 0, ZE_RESULT_ERROR_INVALID_SIZE, 0 },
+        };
+        const uint64_t values[] = { paramValue( hCommandList ), paramValue( hContextSrc ), paramValue( dstptr ), paramValue( srcptr ), paramValue( phWaitEvents ), paramValue( numWaitEvents ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ZE_RESULT_SUCCESS;
     }
@@ -1193,17 +1153,15 @@ namespace validation_layer
                                                         ///< on before launching
         )
     {
-        if( nullptr == hCommandList )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == hDstImage )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == hSrcImage )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( (nullptr == phWaitEvents) && (0 < numWaitEvents) )
-            return ZE_RESULT_ERROR_INVALID_SIZE;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNullWithCount, 3, 4, 0, 0, ZE_RESULT_ERROR_INVALID_SIZE, 0 },
+        };
+        const uint64_t values[] = { paramValue( hCommandList ), paramValue( hDstImage ), paramValue( hSrcImage ), paramValue( phWaitEvents ), paramValue( numWaitEvents ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ZE_RESULT_SUCCESS;
     }
@@ -1223,17 +1181,15 @@ namespace validation_layer
                                                         ///< on before launching
         )
     {
-        if( nullptr == hCommandList )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == hDstImage )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == hSrcImage )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( (nullptr == phWaitEvents) && (0 < numWaitEvents) )
-            return ZE_RESULT_ERROR_INVALID_SIZE;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNullWithCount, 3, 4, 0, 0, ZE_RESULT_ERROR_INVALID_SIZE, 0 },
+        };
+        const uint64_t values[] = { paramValue( hCommandList ), paramValue( hDstImage ), paramValue( hSrcImage ), paramValue( phWaitEvents ), paramValue( numWaitEvents ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ZE_RESULT_SUCCESS;
     }
@@ -1252,17 +1208,15 @@ namespace validation_layer
                                                         ///< on before launching
         )
     {
-        if( nullptr == hCommandList )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == hSrcImage )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == dstptr )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( (nullptr == phWaitEvents) && (0 < numWaitEvents) )
-            return ZE_RESULT_ERROR_INVALID_SIZE;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNullWithCount, 3, 4, 0, 0, ZE_RESULT_ERROR_INVALID_SIZE, 0 },
+        };
+        const uint64_t values[] = { paramValue( hCommandList ), paramValue( hSrcImage ), paramValue( dstptr ), paramValue( phWaitEvents ), paramValue( numWaitEvents ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ZE_RESULT_SUCCESS;
     }
@@ -1281,17 +1235,15 @@ namespace validation_layer
                                                         ///< on before launching
         )
     {
-        if( nullptr == hCommandList )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == hDstImage )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == srcptr )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( (nullptr == phWaitEvents) && (0 < numWaitEvents) )
-            return ZE_RESULT_ERROR_INVALID_SIZE;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNullWithCount, 3, 4, 0, 0, ZE_RESULT_ERROR_INVALID_SIZE, 0 },
+        };
+        const uint64_t values[] = { paramValue( hCommandList ), paramValue( hDstImage ), paramValue( srcptr ), paramValue( phWaitEvents ), paramValue( numWaitEvents ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ZE_RESULT_SUCCESS;
     }
@@ -1323,17 +1275,15 @@ namespace validation_layer
         ze_memory_advice_t advice                       ///< [in] Memory advice for the memory range
         )
     {
-        if( nullptr == hCommandList )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == hDevice )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == ptr )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( ZE_MEMORY_ADVICE_CLEAR_SYSTEM_MEMORY_PREFERRED_LOCATION < advice )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isAbove, 3, 0, 0, 0, ZE_RESULT_ERROR_INVALID_ENUMERATION, ZE_MEMORY_ADVICE_CLEAR_SYSTEM_MEMORY_PREFERRED_LOCATION },
+        };
+        const uint64_t values[] = { paramValue( hCommandList ), paramValue( hDevice ), paramValue( ptr ), paramValue( advice ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ZE_RESULT_SUCCESS;
     }
@@ -1352,23 +1302,17 @@ namespace validation_layer
         ze_event_pool_handle_t* phEventPool             ///< [out] pointer handle of event pool object created
         )
     {
-        if( nullptr == hContext )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == desc )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == phEventPool )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( 0xf < desc->flags )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
-
-        if( 0 == desc->count )
-            return ZE_RESULT_ERROR_INVALID_SIZE;
-
-        if( (nullptr == phDevices) && (0 < numDevices) )
-            return ZE_RESULT_ERROR_INVALID_SIZE;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isAbove, 1, 0, sizeof(ze_event_pool_desc_t::flags), offsetof(ze_event_pool_desc_t, flags), ZE_RESULT_ERROR_INVALID_ENUMERATION, 0xf },
+            { paramCheck::isZero, 1, 0, sizeof(ze_event_pool_desc_t::count), offsetof(ze_event_pool_desc_t, count), ZE_RESULT_ERROR_INVALID_SIZE, 0 },
+            { paramCheck::isNullWithCount, 3, 4, 0, 0, ZE_RESULT_ERROR_INVALID_SIZE, 0 },
+        };
+        const uint64_t values[] = { paramValue( hContext ), paramValue( desc ), paramValue( phEventPool ), paramValue( phDevices ), paramValue( numDevices ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ParameterValidation::validateExtensions(desc);
     }
@@ -1393,20 +1337,16 @@ namespace validation_layer
         ze_event_handle_t* phEvent                      ///< [out] pointer to handle of event object created
         )
     {
-        if( nullptr == hEventPool )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == desc )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == phEvent )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( 0x7 < desc->signal )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
-
-        if( 0x7 < desc->wait )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isAbove, 1, 0, sizeof(ze_event_desc_t::signal), offsetof(ze_event_desc_t, signal), ZE_RESULT_ERROR_INVALID_ENUMERATION, 0x7 },
+            { paramCheck::isAbove, 1, 0, sizeof(ze_event_desc_t::wait), offsetof(ze_event_desc_t, wait), ZE_RESULT_ERROR_INVALID_ENUMERATION, 0x7 },
+        };
+        const uint64_t values[] = { paramValue( hEventPool ), paramValue( desc ), paramValue( phEvent ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ParameterValidation::validateExtensions(desc);
     }
@@ -1420,26 +1360,18 @@ namespace validation_layer
         ze_event_handle_t* phEvent                      ///< [out] pointer to handle of event object created
         )
     {
-        if( nullptr == hContext )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == hDevice )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == desc )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == phEvent )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( 0x3f < desc->flags )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
-
-        if( 0x7 < desc->signal )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
-
-        if( 0x7 < desc->wait )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 3, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isAbove, 2, 0, sizeof(ze_event_counter_based_desc_t::flags), offsetof(ze_event_counter_based_desc_t, flags), ZE_RESULT_ERROR_INVALID_ENUMERATION, 0x3f },
+            { paramCheck::isAbove, 2, 0, sizeof(ze_event_counter_based_desc_t::signal), offsetof(ze_event_counter_based_desc_t, signal), ZE_RESULT_ERROR_INVALID_ENUMERATION, 0x7 },
+            { paramCheck::isAbove, 2, 0, sizeof(ze_event_counter_based_desc_t::wait), offsetof(ze_event_counter_based_desc_t, wait), ZE_RESULT_ERROR_INVALID_ENUMERATION, 0x7 },
+        };
+        const uint64_t values[] = { paramValue( hContext ), paramValue( hDevice ), paramValue( desc ), paramValue( phEvent ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ParameterValidation::validateExtensions(desc);
     }
@@ -1721,17 +1653,15 @@ namespace validation_layer
                                                         ///< on before executing query
         )
     {
-        if( nullptr == hCommandList )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == phEvents )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == dstptr )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( (nullptr == phWaitEvents) && (0 < numWaitEvents) )
-            return ZE_RESULT_ERROR_INVALID_SIZE;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNullWithCount, 3, 4, 0, 0, ZE_RESULT_ERROR_INVALID_SIZE, 0 },
+        };
+        const uint64_t values[] = { paramValue( hCommandList ), paramValue( phEvents ), paramValue( dstptr ), paramValue( phWaitEvents ), paramValue( numWaitEvents ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ZE_RESULT_SUCCESS;
     }
@@ -1829,17 +1759,15 @@ namespace validation_layer
         ze_fence_handle_t* phFence                      ///< [out] pointer to handle of fence object created
         )
     {
-        if( nullptr == hCommandQueue )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == desc )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == phFence )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( 0x1 < desc->flags )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isAbove, 1, 0, sizeof(ze_fence_desc_t::flags), offsetof(ze_fence_desc_t, flags), ZE_RESULT_ERROR_INVALID_ENUMERATION, 0x1 },
+        };
+        const uint64_t values[] = { paramValue( hCommandQueue ), paramValue( desc ), paramValue( phFence ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ParameterValidation::validateExtensions(desc);
     }
@@ -1907,20 +1835,16 @@ namespace validation_layer
         ze_image_properties_t* pImageProperties         ///< [out] pointer to image properties
         )
     {
-        if( nullptr == hDevice )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == desc )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == pImageProperties )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( 0x3 < desc->flags )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
-
-        if( ZE_IMAGE_TYPE_BUFFER < desc->type )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isAbove, 1, 0, sizeof(ze_image_desc_t::flags), offsetof(ze_image_desc_t, flags), ZE_RESULT_ERROR_INVALID_ENUMERATION, 0x3 },
+            { paramCheck::isAbove, 1, 0, sizeof(ze_image_desc_t::type), offsetof(ze_image_desc_t, type), ZE_RESULT_ERROR_INVALID_ENUMERATION, ZE_IMAGE_TYPE_BUFFER },
+        };
+        const uint64_t values[] = { paramValue( hDevice ), paramValue( desc ), paramValue( pImageProperties ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         auto retVal = ZE_RESULT_SUCCESS;
         retVal = ParameterValidation::validateExtensions(desc);
@@ -1939,23 +1863,17 @@ namespace validation_layer
         ze_image_handle_t* phImage                      ///< [out] pointer to handle of image object created
         )
     {
-        if( nullptr == hContext )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == hDevice )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == desc )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == phImage )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( 0x3 < desc->flags )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
-
-        if( ZE_IMAGE_TYPE_BUFFER < desc->type )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 3, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isAbove, 2, 0, sizeof(ze_image_desc_t::flags), offsetof(ze_image_desc_t, flags), ZE_RESULT_ERROR_INVALID_ENUMERATION, 0x3 },
+            { paramCheck::isAbove, 2, 0, sizeof(ze_image_desc_t::type), offsetof(ze_image_desc_t, type), ZE_RESULT_ERROR_INVALID_ENUMERATION, ZE_IMAGE_TYPE_BUFFER },
+        };
+        const uint64_t values[] = { paramValue( hContext ), paramValue( hDevice ), paramValue( desc ), paramValue( phImage ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ParameterValidation::validateExtensions(desc);
     }
@@ -1986,29 +1904,19 @@ namespace validation_layer
         void** pptr                                     ///< [out] pointer to shared allocation
         )
     {
-        if( nullptr == hContext )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == device_desc )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == host_desc )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == pptr )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( 0x7 < device_desc->flags )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
-
-        if( 0xf < host_desc->flags )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
-
-        if( 0 == size )
-            return ZE_RESULT_ERROR_UNSUPPORTED_SIZE;
-
-        if( 0 != (alignment & (alignment - 1)) )
-            return ZE_RESULT_ERROR_UNSUPPORTED_ALIGNMENT;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 3, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isAbove, 1, 0, sizeof(ze_device_mem_alloc_desc_t::flags), offsetof(ze_device_mem_alloc_desc_t, flags), ZE_RESULT_ERROR_INVALID_ENUMERATION, 0x7 },
+            { paramCheck::isAbove, 2, 0, sizeof(ze_host_mem_alloc_desc_t::flags), offsetof(ze_host_mem_alloc_desc_t, flags), ZE_RESULT_ERROR_INVALID_ENUMERATION, 0xf },
+            { paramCheck::isZero, 4, 0, 0, 0, ZE_RESULT_ERROR_UNSUPPORTED_SIZE, 0 },
+            { paramCheck::isNotPowerOfTwo, 5, 0, 0, 0, ZE_RESULT_ERROR_UNSUPPORTED_ALIGNMENT, 0 },
+        };
+        const uint64_t values[] = { paramValue( hContext ), paramValue( device_desc ), paramValue( host_desc ), paramValue( pptr ), paramValue( size ), paramValue( alignment ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         auto retVal = ZE_RESULT_SUCCESS;
         retVal = ParameterValidation::validateExtensions(device_desc);
@@ -2031,26 +1939,18 @@ namespace validation_layer
         void** pptr                                     ///< [out] pointer to device allocation
         )
     {
-        if( nullptr == hContext )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == hDevice )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == device_desc )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == pptr )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( 0x7 < device_desc->flags )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
-
-        if( 0 == size )
-            return ZE_RESULT_ERROR_UNSUPPORTED_SIZE;
-
-        if( 0 != (alignment & (alignment - 1)) )
-            return ZE_RESULT_ERROR_UNSUPPORTED_ALIGNMENT;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 3, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isAbove, 2, 0, sizeof(ze_device_mem_alloc_desc_t::flags), offsetof(ze_device_mem_alloc_desc_t, flags), ZE_RESULT_ERROR_INVALID_ENUMERATION, 0x7 },
+            { paramCheck::isZero, 4, 0, 0, 0, ZE_RESULT_ERROR_UNSUPPORTED_SIZE, 0 },
+            { paramCheck::isNotPowerOfTwo, 5, 0, 0, 0, ZE_RESULT_ERROR_UNSUPPORTED_ALIGNMENT, 0 },
+        };
+        const uint64_t values[] = { paramValue( hContext ), paramValue( hDevice ), paramValue( device_desc ), paramValue( pptr ), paramValue( size ), paramValue( alignment ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ParameterValidation::validateExtensions(device_desc);
     }
@@ -2067,23 +1967,17 @@ namespace validation_layer
         void** pptr                                     ///< [out] pointer to host allocation
         )
     {
-        if( nullptr == hContext )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == host_desc )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == pptr )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( 0xf < host_desc->flags )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
-
-        if( 0 == size )
-            return ZE_RESULT_ERROR_UNSUPPORTED_SIZE;
-
-        if( 0 != (alignment & (alignment - 1)) )
-            return ZE_RESULT_ERROR_UNSUPPORTED_ALIGNMENT;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isAbove, 1, 0, sizeof(ze_host_mem_alloc_desc_t::flags), offsetof(ze_host_mem_alloc_desc_t, flags), ZE_RESULT_ERROR_INVALID_ENUMERATION, 0xf },
+            { paramCheck::isZero, 3, 0, 0, 0, ZE_RESULT_ERROR_UNSUPPORTED_SIZE, 0 },
+            { paramCheck::isNotPowerOfTwo, 4, 0, 0, 0, ZE_RESULT_ERROR_UNSUPPORTED_ALIGNMENT, 0 },
+        };
+        const uint64_t values[] = { paramValue( hContext ), paramValue( host_desc ), paramValue( pptr ), paramValue( size ), paramValue( alignment ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ParameterValidation::validateExtensions(host_desc);
     }
@@ -2221,17 +2115,15 @@ namespace validation_layer
         void** pptr                                     ///< [out] pointer to device allocation in this process
         )
     {
-        if( nullptr == hContext )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == hDevice )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( 0x3 < flags )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
-
-        if( nullptr == pptr )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isAbove, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_ENUMERATION, 0x3 },
+            { paramCheck::isNull, 3, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+        };
+        const uint64_t values[] = { paramValue( hContext ), paramValue( hDevice ), paramValue( flags ), paramValue( pptr ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ZE_RESULT_SUCCESS;
     }
@@ -2263,17 +2155,15 @@ namespace validation_layer
                                                         ///< Must be 0 (default) or a valid combination of ::ze_memory_atomic_attr_exp_flag_t.
         )
     {
-        if( nullptr == hContext )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == hDevice )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == ptr )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( 0x7f < attr )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isAbove, 3, 0, 0, 0, ZE_RESULT_ERROR_INVALID_ENUMERATION, 0x7f },
+        };
+        const uint64_t values[] = { paramValue( hContext ), paramValue( hDevice ), paramValue( ptr ), paramValue( attr ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ZE_RESULT_SUCCESS;
     }
@@ -2288,17 +2178,15 @@ namespace validation_layer
         ze_memory_atomic_attr_exp_flags_t* pAttr        ///< [out] Atomic access attributes for the specified range
         )
     {
-        if( nullptr == hContext )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == hDevice )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == ptr )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == pAttr )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 3, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+        };
+        const uint64_t values[] = { paramValue( hContext ), paramValue( hDevice ), paramValue( ptr ), paramValue( pAttr ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ZE_RESULT_SUCCESS;
     }
@@ -2313,26 +2201,18 @@ namespace validation_layer
         ze_module_build_log_handle_t* phBuildLog        ///< [out][optional] pointer to handle of module's build log.
         )
     {
-        if( nullptr == hContext )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == hDevice )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == desc )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == desc->pInputModule )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == phModule )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( ZE_MODULE_FORMAT_NATIVE < desc->format )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
-
-        if( 0 == desc->inputSize )
-            return ZE_RESULT_ERROR_INVALID_SIZE;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 2, 0, sizeof(ze_module_desc_t::pInputModule), offsetof(ze_module_desc_t, pInputModule), ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 3, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isAbove, 2, 0, sizeof(ze_module_desc_t::format), offsetof(ze_module_desc_t, format), ZE_RESULT_ERROR_INVALID_ENUMERATION, ZE_MODULE_FORMAT_NATIVE },
+            { paramCheck::isZero, 2, 0, sizeof(ze_module_desc_t::inputSize), offsetof(ze_module_desc_t, inputSize), ZE_RESULT_ERROR_INVALID_SIZE, 0 },
+        };
+        const uint64_t values[] = { paramValue( hContext ), paramValue( hDevice ), paramValue( desc ), paramValue( phModule ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ParameterValidation::validateExtensions(desc);
     }
@@ -2475,20 +2355,16 @@ namespace validation_layer
         ze_kernel_handle_t* phKernel                    ///< [out] handle of the Function object
         )
     {
-        if( nullptr == hModule )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == desc )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == desc->pKernelName )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == phKernel )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( 0x3 < desc->flags )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 1, 0, sizeof(ze_kernel_desc_t::pKernelName), offsetof(ze_kernel_desc_t, pKernelName), ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isAbove, 1, 0, sizeof(ze_kernel_desc_t::flags), offsetof(ze_kernel_desc_t, flags), ZE_RESULT_ERROR_INVALID_ENUMERATION, 0x3 },
+        };
+        const uint64_t values[] = { paramValue( hModule ), paramValue( desc ), paramValue( phKernel ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ParameterValidation::validateExtensions(desc);
     }
@@ -2552,17 +2428,15 @@ namespace validation_layer
         uint32_t* groupSizeZ                            ///< [out] recommended size of group for Z dimension
         )
     {
-        if( nullptr == hKernel )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == groupSizeX )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == groupSizeY )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == groupSizeZ )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 3, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+        };
+        const uint64_t values[] = { paramValue( hKernel ), paramValue( groupSizeX ), paramValue( groupSizeY ), paramValue( groupSizeZ ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ZE_RESULT_SUCCESS;
     }
@@ -2723,17 +2597,15 @@ namespace validation_layer
                                                         ///< on before launching
         )
     {
-        if( nullptr == hCommandList )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == hKernel )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == pLaunchFuncArgs )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( (nullptr == phWaitEvents) && (0 < numWaitEvents) )
-            return ZE_RESULT_ERROR_INVALID_SIZE;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNullWithCount, 3, 4, 0, 0, ZE_RESULT_ERROR_INVALID_SIZE, 0 },
+        };
+        const uint64_t values[] = { paramValue( hCommandList ), paramValue( hKernel ), paramValue( pLaunchFuncArgs ), paramValue( phWaitEvents ), paramValue( numWaitEvents ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ZE_RESULT_SUCCESS;
     }
@@ -2752,17 +2624,15 @@ namespace validation_layer
                                                         ///< on before launching
         )
     {
-        if( nullptr == hCommandList )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == hKernel )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == pGroupCounts )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( (nullptr == phWaitEvents) && (0 < numWaitEvents) )
-            return ZE_RESULT_ERROR_INVALID_SIZE;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNullWithCount, 3, 4, 0, 0, ZE_RESULT_ERROR_INVALID_SIZE, 0 },
+        };
+        const uint64_t values[] = { paramValue( hCommandList ), paramValue( hKernel ), paramValue( pGroupCounts ), paramValue( phWaitEvents ), paramValue( numWaitEvents ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ZE_RESULT_SUCCESS;
     }
@@ -2808,17 +2678,15 @@ namespace validation_layer
                                                         ///< on before launching
         )
     {
-        if( nullptr == hCommandList )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == hKernel )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == pLaunchFuncArgs )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( (nullptr == phWaitEvents) && (0 < numWaitEvents) )
-            return ZE_RESULT_ERROR_INVALID_SIZE;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNullWithCount, 3, 4, 0, 0, ZE_RESULT_ERROR_INVALID_SIZE, 0 },
+        };
+        const uint64_t values[] = { paramValue( hCommandList ), paramValue( hKernel ), paramValue( pLaunchFuncArgs ), paramValue( phWaitEvents ), paramValue( numWaitEvents ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ZE_RESULT_SUCCESS;
     }
@@ -2837,17 +2705,15 @@ namespace validation_layer
                                                         ///< on before launching
         )
     {
-        if( nullptr == hCommandList )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == hKernel )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == pLaunchArgumentsBuffer )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( (nullptr == phWaitEvents) && (0 < numWaitEvents) )
-            return ZE_RESULT_ERROR_INVALID_SIZE;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNullWithCount, 3, 4, 0, 0, ZE_RESULT_ERROR_INVALID_SIZE, 0 },
+        };
+        const uint64_t values[] = { paramValue( hCommandList ), paramValue( hKernel ), paramValue( pLaunchArgumentsBuffer ), paramValue( phWaitEvents ), paramValue( numWaitEvents ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ZE_RESULT_SUCCESS;
     }
@@ -2870,20 +2736,16 @@ namespace validation_layer
                                                         ///< on before launching
         )
     {
-        if( nullptr == hCommandList )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == phKernels )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == pCountBuffer )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == pLaunchArgumentsBuffer )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( (nullptr == phWaitEvents) && (0 < numWaitEvents) )
-            return ZE_RESULT_ERROR_INVALID_SIZE;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 3, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNullWithCount, 4, 5, 0, 0, ZE_RESULT_ERROR_INVALID_SIZE, 0 },
+        };
+        const uint64_t values[] = { paramValue( hCommandList ), paramValue( phKernels ), paramValue( pCountBuffer ), paramValue( pLaunchArgumentsBuffer ), paramValue( phWaitEvents ), paramValue( numWaitEvents ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ZE_RESULT_SUCCESS;
     }
@@ -2979,23 +2841,17 @@ namespace validation_layer
         ze_sampler_handle_t* phSampler                  ///< [out] handle of the sampler
         )
     {
-        if( nullptr == hContext )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == hDevice )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == desc )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == phSampler )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( ZE_SAMPLER_ADDRESS_MODE_MIRROR < desc->addressMode )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
-
-        if( ZE_SAMPLER_FILTER_MODE_LINEAR < desc->filterMode )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 3, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isAbove, 2, 0, sizeof(ze_sampler_desc_t::addressMode), offsetof(ze_sampler_desc_t, addressMode), ZE_RESULT_ERROR_INVALID_ENUMERATION, ZE_SAMPLER_ADDRESS_MODE_MIRROR },
+            { paramCheck::isAbove, 2, 0, sizeof(ze_sampler_desc_t::filterMode), offsetof(ze_sampler_desc_t, filterMode), ZE_RESULT_ERROR_INVALID_ENUMERATION, ZE_SAMPLER_FILTER_MODE_LINEAR },
+        };
+        const uint64_t values[] = { paramValue( hContext ), paramValue( hDevice ), paramValue( desc ), paramValue( phSampler ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ParameterValidation::validateExtensions(desc);
     }
@@ -3064,17 +2920,15 @@ namespace validation_layer
                                                         ///< alignments.
         )
     {
-        if( nullptr == hContext )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == hDevice )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == pagesize )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( 0 == size )
-            return ZE_RESULT_ERROR_UNSUPPORTED_SIZE;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isZero, 3, 0, 0, 0, ZE_RESULT_ERROR_UNSUPPORTED_SIZE, 0 },
+        };
+        const uint64_t values[] = { paramValue( hContext ), paramValue( hDevice ), paramValue( pagesize ), paramValue( size ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ZE_RESULT_SUCCESS;
     }
@@ -3109,23 +2963,17 @@ namespace validation_layer
         ze_physical_mem_handle_t* phPhysicalMemory      ///< [out] pointer to handle of physical memory object created
         )
     {
-        if( nullptr == hContext )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == hDevice )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == desc )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == phPhysicalMemory )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( 0x3 < desc->flags )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
-
-        if( 0 == desc->size )
-            return ZE_RESULT_ERROR_UNSUPPORTED_SIZE;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 3, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isAbove, 2, 0, sizeof(ze_physical_mem_desc_t::flags), offsetof(ze_physical_mem_desc_t, flags), ZE_RESULT_ERROR_INVALID_ENUMERATION, 0x3 },
+            { paramCheck::isZero, 2, 0, sizeof(ze_physical_mem_desc_t::size), offsetof(ze_physical_mem_desc_t, size), ZE_RESULT_ERROR_UNSUPPORTED_SIZE, 0 },
+        };
+        const uint64_t values[] = { paramValue( hContext ), paramValue( hDevice ), paramValue( desc ), paramValue( phPhysicalMemory ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ParameterValidation::validateExtensions(desc);
     }
@@ -3160,20 +3008,16 @@ namespace validation_layer
                                                         ///< range.
         )
     {
-        if( nullptr == hContext )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == hPhysicalMemory )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == ptr )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( ZE_MEMORY_ACCESS_ATTRIBUTE_READONLY < access )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
-
-        if( 0 == size )
-            return ZE_RESULT_ERROR_UNSUPPORTED_SIZE;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isAbove, 3, 0, 0, 0, ZE_RESULT_ERROR_INVALID_ENUMERATION, ZE_MEMORY_ACCESS_ATTRIBUTE_READONLY },
+            { paramCheck::isZero, 4, 0, 0, 0, ZE_RESULT_ERROR_UNSUPPORTED_SIZE, 0 },
+        };
+        const uint64_t values[] = { paramValue( hContext ), paramValue( hPhysicalMemory ), paramValue( ptr ), paramValue( access ), paramValue( size ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ZE_RESULT_SUCCESS;
     }
@@ -3208,17 +3052,15 @@ namespace validation_layer
                                                         ///< range.
         )
     {
-        if( nullptr == hContext )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == ptr )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( ZE_MEMORY_ACCESS_ATTRIBUTE_READONLY < access )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
-
-        if( 0 == size )
-            return ZE_RESULT_ERROR_UNSUPPORTED_SIZE;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isAbove, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_ENUMERATION, ZE_MEMORY_ACCESS_ATTRIBUTE_READONLY },
+            { paramCheck::isZero, 3, 0, 0, 0, ZE_RESULT_ERROR_UNSUPPORTED_SIZE, 0 },
+        };
+        const uint64_t values[] = { paramValue( hContext ), paramValue( ptr ), paramValue( access ), paramValue( size ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ZE_RESULT_SUCCESS;
     }
@@ -3234,20 +3076,16 @@ namespace validation_layer
                                                         ///< that shares same access attribute.
         )
     {
-        if( nullptr == hContext )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == ptr )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == access )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == outSize )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( 0 == size )
-            return ZE_RESULT_ERROR_UNSUPPORTED_SIZE;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 3, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isZero, 4, 0, 0, 0, ZE_RESULT_ERROR_UNSUPPORTED_SIZE, 0 },
+        };
+        const uint64_t values[] = { paramValue( hContext ), paramValue( ptr ), paramValue( access ), paramValue( outSize ), paramValue( size ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ZE_RESULT_SUCCESS;
     }
@@ -3295,17 +3133,15 @@ namespace validation_layer
         ze_external_semaphore_ext_handle_t* phSemaphore ///< [out] The handle of the external semaphore imported.
         )
     {
-        if( nullptr == hDevice )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == desc )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == phSemaphore )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( 0x1ff < desc->flags )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isAbove, 1, 0, sizeof(ze_external_semaphore_ext_desc_t::flags), offsetof(ze_external_semaphore_ext_desc_t, flags), ZE_RESULT_ERROR_INVALID_ENUMERATION, 0x1ff },
+        };
+        const uint64_t values[] = { paramValue( hDevice ), paramValue( desc ), paramValue( phSemaphore ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ParameterValidation::validateExtensions(desc);
     }
@@ -3337,23 +3173,17 @@ namespace validation_layer
                                                         ///< on before launching
         )
     {
-        if( nullptr == hCommandList )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == phSemaphores )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == signalParams )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( (nullptr == phWaitEvents) && (0 < numWaitEvents) )
-            return ZE_RESULT_ERROR_INVALID_SIZE;
-
-        if( (nullptr == phSemaphores) && (0 < numSemaphores) )
-            return ZE_RESULT_ERROR_INVALID_SIZE;
-
-        if( (nullptr == signalParams) && (0 < numSemaphores) )
-            return ZE_RESULT_ERROR_INVALID_SIZE;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNullWithCount, 3, 4, 0, 0, ZE_RESULT_ERROR_INVALID_SIZE, 0 },
+            { paramCheck::isNullWithCount, 1, 5, 0, 0, ZE_RESULT_ERROR_INVALID_SIZE, 0 },
+            { paramCheck::isNullWithCount, 2, 5, 0, 0, ZE_RESULT_ERROR_INVALID_SIZE, 0 },
+        };
+        const uint64_t values[] = { paramValue( hCommandList ), paramValue( phSemaphores ), paramValue( signalParams ), paramValue( phWaitEvents ), paramValue( numWaitEvents ), paramValue( numSemaphores ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ZE_RESULT_SUCCESS;
     }
@@ -3373,23 +3203,17 @@ namespace validation_layer
                                                         ///< on before launching
         )
     {
-        if( nullptr == hCommandList )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == phSemaphores )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == waitParams )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( (nullptr == phWaitEvents) && (0 < numWaitEvents) )
-            return ZE_RESULT_ERROR_INVALID_SIZE;
-
-        if( (nullptr == phSemaphores) && (0 < numSemaphores) )
-            return ZE_RESULT_ERROR_INVALID_SIZE;
-
-        if( (nullptr == waitParams) && (0 < numSemaphores) )
-            return ZE_RESULT_ERROR_INVALID_SIZE;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNullWithCount, 3, 4, 0, 0, ZE_RESULT_ERROR_INVALID_SIZE, 0 },
+            { paramCheck::isNullWithCount, 1, 5, 0, 0, ZE_RESULT_ERROR_INVALID_SIZE, 0 },
+            { paramCheck::isNullWithCount, 2, 5, 0, 0, ZE_RESULT_ERROR_INVALID_SIZE, 0 },
+        };
+        const uint64_t values[] = { paramValue( hCommandList ), paramValue( phSemaphores ), paramValue( waitParams ), paramValue( phWaitEvents ), paramValue( numWaitEvents ), paramValue( numSemaphores ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ZE_RESULT_SUCCESS;
     }
@@ -3402,17 +3226,15 @@ namespace validation_layer
         ze_rtas_builder_ext_handle_t* phBuilder         ///< [out] handle of builder object
         )
     {
-        if( nullptr == hDriver )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == pDescriptor )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == phBuilder )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( ZE_RTAS_BUILDER_EXT_VERSION_CURRENT < pDescriptor->builderVersion )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isAbove, 1, 0, sizeof(ze_rtas_builder_ext_desc_t::builderVersion), offsetof(ze_rtas_builder_ext_desc_t, builderVersion), ZE_RESULT_ERROR_INVALID_ENUMERATION, ZE_RTAS_BUILDER_EXT_VERSION_CURRENT },
+        };
+        const uint64_t values[] = { paramValue( hDriver ), paramValue( pDescriptor ), paramValue( phBuilder ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ParameterValidation::validateExtensions(pDescriptor);
     }
@@ -3425,23 +3247,17 @@ namespace validation_layer
         ze_rtas_builder_ext_properties_t* pProperties   ///< [in,out] query result for builder properties
         )
     {
-        if( nullptr == hBuilder )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == pBuildOpDescriptor )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == pProperties )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( ZE_RTAS_FORMAT_EXT_MAX < pBuildOpDescriptor->rtasFormat )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
-
-        if( ZE_RTAS_BUILDER_BUILD_QUALITY_HINT_EXT_HIGH < pBuildOpDescriptor->buildQuality )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
-
-        if( 0x3 < pBuildOpDescriptor->buildFlags )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isAbove, 1, 0, sizeof(ze_rtas_builder_build_op_ext_desc_t::rtasFormat), offsetof(ze_rtas_builder_build_op_ext_desc_t, rtasFormat), ZE_RESULT_ERROR_INVALID_ENUMERATION, ZE_RTAS_FORMAT_EXT_MAX },
+            { paramCheck::isAbove, 1, 0, sizeof(ze_rtas_builder_build_op_ext_desc_t::buildQuality), offsetof(ze_rtas_builder_build_op_ext_desc_t, buildQuality), ZE_RESULT_ERROR_INVALID_ENUMERATION, ZE_RTAS_BUILDER_BUILD_QUALITY_HINT_EXT_HIGH },
+            { paramCheck::isAbove, 1, 0, sizeof(ze_rtas_builder_build_op_ext_desc_t::buildFlags), offsetof(ze_rtas_builder_build_op_ext_desc_t, buildFlags), ZE_RESULT_ERROR_INVALID_ENUMERATION, 0x3 },
+        };
+        const uint64_t values[] = { paramValue( hBuilder ), paramValue( pBuildOpDescriptor ), paramValue( pProperties ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         auto retVal = ZE_RESULT_SUCCESS;
         retVal = ParameterValidation::validateExtensions(pBuildOpDescriptor);
@@ -3489,26 +3305,18 @@ namespace validation_layer
                                                         ///< bytes
         )
     {
-        if( nullptr == hBuilder )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == pBuildOpDescriptor )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == pScratchBuffer )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == pRtasBuffer )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( ZE_RTAS_FORMAT_EXT_MAX < pBuildOpDescriptor->rtasFormat )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
-
-        if( ZE_RTAS_BUILDER_BUILD_QUALITY_HINT_EXT_HIGH < pBuildOpDescriptor->buildQuality )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
-
-        if( 0x3 < pBuildOpDescriptor->buildFlags )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 3, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isAbove, 1, 0, sizeof(ze_rtas_builder_build_op_ext_desc_t::rtasFormat), offsetof(ze_rtas_builder_build_op_ext_desc_t, rtasFormat), ZE_RESULT_ERROR_INVALID_ENUMERATION, ZE_RTAS_FORMAT_EXT_MAX },
+            { paramCheck::isAbove, 1, 0, sizeof(ze_rtas_builder_build_op_ext_desc_t::buildQuality), offsetof(ze_rtas_builder_build_op_ext_desc_t, buildQuality), ZE_RESULT_ERROR_INVALID_ENUMERATION, ZE_RTAS_BUILDER_BUILD_QUALITY_HINT_EXT_HIGH },
+            { paramCheck::isAbove, 1, 0, sizeof(ze_rtas_builder_build_op_ext_desc_t::buildFlags), offsetof(ze_rtas_builder_build_op_ext_desc_t, buildFlags), ZE_RESULT_ERROR_INVALID_ENUMERATION, 0x3 },
+        };
+        const uint64_t values[] = { paramValue( hBuilder ), paramValue( pBuildOpDescriptor ), paramValue( pScratchBuffer ), paramValue( pRtasBuffer ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ParameterValidation::validateExtensions(pBuildOpDescriptor);
     }
@@ -3529,17 +3337,15 @@ namespace validation_layer
                                                         ///< on before launching
         )
     {
-        if( nullptr == hCommandList )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == dstptr )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == srcptr )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( (nullptr == phWaitEvents) && (0 < numWaitEvents) )
-            return ZE_RESULT_ERROR_INVALID_SIZE;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNullWithCount, 3, 4, 0, 0, ZE_RESULT_ERROR_INVALID_SIZE, 0 },
+        };
+        const uint64_t values[] = { paramValue( hCommandList ), paramValue( dstptr ), paramValue( srcptr ), paramValue( phWaitEvents ), paramValue( numWaitEvents ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ZE_RESULT_SUCCESS;
     }
@@ -3773,26 +3579,18 @@ namespace validation_layer
         ze_image_handle_t* phImageView                  ///< [out] pointer to handle of image object created for view
         )
     {
-        if( nullptr == hContext )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == hDevice )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == hImage )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == desc )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == phImageView )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( 0x3 < desc->flags )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
-
-        if( ZE_IMAGE_TYPE_BUFFER < desc->type )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 3, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 4, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isAbove, 3, 0, sizeof(ze_image_desc_t::flags), offsetof(ze_image_desc_t, flags), ZE_RESULT_ERROR_INVALID_ENUMERATION, 0x3 },
+            { paramCheck::isAbove, 3, 0, sizeof(ze_image_desc_t::type), offsetof(ze_image_desc_t, type), ZE_RESULT_ERROR_INVALID_ENUMERATION, ZE_IMAGE_TYPE_BUFFER },
+        };
+        const uint64_t values[] = { paramValue( hContext ), paramValue( hDevice ), paramValue( hImage ), paramValue( desc ), paramValue( phImageView ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ParameterValidation::validateExtensions(desc);
     }
@@ -3807,26 +3605,18 @@ namespace validation_layer
         ze_image_handle_t* phImageView                  ///< [out] pointer to handle of image object created for view
         )
     {
-        if( nullptr == hContext )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == hDevice )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == hImage )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == desc )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == phImageView )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( 0x3 < desc->flags )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
-
-        if( ZE_IMAGE_TYPE_BUFFER < desc->type )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 3, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 4, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isAbove, 3, 0, sizeof(ze_image_desc_t::flags), offsetof(ze_image_desc_t, flags), ZE_RESULT_ERROR_INVALID_ENUMERATION, 0x3 },
+            { paramCheck::isAbove, 3, 0, sizeof(ze_image_desc_t::type), offsetof(ze_image_desc_t, type), ZE_RESULT_ERROR_INVALID_ENUMERATION, ZE_IMAGE_TYPE_BUFFER },
+        };
+        const uint64_t values[] = { paramValue( hContext ), paramValue( hDevice ), paramValue( hImage ), paramValue( desc ), paramValue( phImageView ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ParameterValidation::validateExtensions(desc);
     }
@@ -3884,17 +3674,15 @@ namespace validation_layer
                                                         ///< on before launching
         )
     {
-        if( nullptr == hCommandList )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == hSrcImage )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == dstptr )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( (nullptr == phWaitEvents) && (0 < numWaitEvents) )
-            return ZE_RESULT_ERROR_INVALID_SIZE;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNullWithCount, 3, 4, 0, 0, ZE_RESULT_ERROR_INVALID_SIZE, 0 },
+        };
+        const uint64_t values[] = { paramValue( hCommandList ), paramValue( hSrcImage ), paramValue( dstptr ), paramValue( phWaitEvents ), paramValue( numWaitEvents ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ZE_RESULT_SUCCESS;
     }
@@ -3917,17 +3705,15 @@ namespace validation_layer
                                                         ///< on before launching
         )
     {
-        if( nullptr == hCommandList )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == hDstImage )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == srcptr )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( (nullptr == phWaitEvents) && (0 < numWaitEvents) )
-            return ZE_RESULT_ERROR_INVALID_SIZE;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNullWithCount, 3, 4, 0, 0, ZE_RESULT_ERROR_INVALID_SIZE, 0 },
+        };
+        const uint64_t values[] = { paramValue( hCommandList ), paramValue( hDstImage ), paramValue( srcptr ), paramValue( phWaitEvents ), paramValue( numWaitEvents ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ZE_RESULT_SUCCESS;
     }
@@ -3963,17 +3749,15 @@ namespace validation_layer
                                                         ///< contain separate lists of imports, un-resolvable imports, and exports.
         )
     {
-        if( nullptr == pInspectDesc )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == phModules )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == phLog )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( 0x7 < pInspectDesc->flags )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isAbove, 0, 0, sizeof(ze_linkage_inspection_ext_desc_t::flags), offsetof(ze_linkage_inspection_ext_desc_t, flags), ZE_RESULT_ERROR_INVALID_ENUMERATION, 0x7 },
+        };
+        const uint64_t values[] = { paramValue( pInspectDesc ), paramValue( phModules ), paramValue( phLog ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ParameterValidation::validateExtensions(pInspectDesc);
     }
@@ -3986,17 +3770,15 @@ namespace validation_layer
         void* ptr                                       ///< [in][release] pointer to memory to free
         )
     {
-        if( nullptr == hContext )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == pMemFreeDesc )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == ptr )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( 0x3 < pMemFreeDesc->freePolicy )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isAbove, 1, 0, sizeof(ze_memory_free_ext_desc_t::freePolicy), offsetof(ze_memory_free_ext_desc_t, freePolicy), ZE_RESULT_ERROR_INVALID_ENUMERATION, 0x3 },
+        };
+        const uint64_t values[] = { paramValue( hContext ), paramValue( pMemFreeDesc ), paramValue( ptr ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ParameterValidation::validateExtensions(pMemFreeDesc);
     }
@@ -4203,17 +3985,15 @@ namespace validation_layer
         ze_rtas_builder_exp_handle_t* phBuilder         ///< [out] handle of builder object
         )
     {
-        if( nullptr == hDriver )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == pDescriptor )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == phBuilder )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( ZE_RTAS_BUILDER_EXP_VERSION_CURRENT < pDescriptor->builderVersion )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isAbove, 1, 0, sizeof(ze_rtas_builder_exp_desc_t::builderVersion), offsetof(ze_rtas_builder_exp_desc_t, builderVersion), ZE_RESULT_ERROR_INVALID_ENUMERATION, ZE_RTAS_BUILDER_EXP_VERSION_CURRENT },
+        };
+        const uint64_t values[] = { paramValue( hDriver ), paramValue( pDescriptor ), paramValue( phBuilder ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ParameterValidation::validateExtensions(pDescriptor);
     }
@@ -4226,23 +4006,17 @@ namespace validation_layer
         ze_rtas_builder_exp_properties_t* pProperties   ///< [in,out] query result for builder properties
         )
     {
-        if( nullptr == hBuilder )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == pBuildOpDescriptor )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == pProperties )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( ZE_RTAS_FORMAT_EXP_MAX < pBuildOpDescriptor->rtasFormat )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
-
-        if( ZE_RTAS_BUILDER_BUILD_QUALITY_HINT_EXP_HIGH < pBuildOpDescriptor->buildQuality )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
-
-        if( 0x3 < pBuildOpDescriptor->buildFlags )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isAbove, 1, 0, sizeof(ze_rtas_builder_build_op_exp_desc_t::rtasFormat), offsetof(ze_rtas_builder_build_op_exp_desc_t, rtasFormat), ZE_RESULT_ERROR_INVALID_ENUMERATION, ZE_RTAS_FORMAT_EXP_MAX },
+            { paramCheck::isAbove, 1, 0, sizeof(ze_rtas_builder_build_op_exp_desc_t::buildQuality), offsetof(ze_rtas_builder_build_op_exp_desc_t, buildQuality), ZE_RESULT_ERROR_INVALID_ENUMERATION, ZE_RTAS_BUILDER_BUILD_QUALITY_HINT_EXP_HIGH },
+            { paramCheck::isAbove, 1, 0, sizeof(ze_rtas_builder_build_op_exp_desc_t::buildFlags), offsetof(ze_rtas_builder_build_op_exp_desc_t, buildFlags), ZE_RESULT_ERROR_INVALID_ENUMERATION, 0x3 },
+        };
+        const uint64_t values[] = { paramValue( hBuilder ), paramValue( pBuildOpDescriptor ), paramValue( pProperties ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         auto retVal = ZE_RESULT_SUCCESS;
         retVal = ParameterValidation::validateExtensions(pBuildOpDescriptor);
@@ -4290,26 +4064,18 @@ namespace validation_layer
                                                         ///< bytes
         )
     {
-        if( nullptr == hBuilder )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == pBuildOpDescriptor )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == pScratchBuffer )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == pRtasBuffer )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( ZE_RTAS_FORMAT_EXP_MAX < pBuildOpDescriptor->rtasFormat )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
-
-        if( ZE_RTAS_BUILDER_BUILD_QUALITY_HINT_EXP_HIGH < pBuildOpDescriptor->buildQuality )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
-
-        if( 0x3 < pBuildOpDescriptor->buildFlags )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 3, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isAbove, 1, 0, sizeof(ze_rtas_builder_build_op_exp_desc_t::rtasFormat), offsetof(ze_rtas_builder_build_op_exp_desc_t, rtasFormat), ZE_RESULT_ERROR_INVALID_ENUMERATION, ZE_RTAS_FORMAT_EXP_MAX },
+            { paramCheck::isAbove, 1, 0, sizeof(ze_rtas_builder_build_op_exp_desc_t::buildQuality), offsetof(ze_rtas_builder_build_op_exp_desc_t, buildQuality), ZE_RESULT_ERROR_INVALID_ENUMERATION, ZE_RTAS_BUILDER_BUILD_QUALITY_HINT_EXP_HIGH },
+            { paramCheck::isAbove, 1, 0, sizeof(ze_rtas_builder_build_op_exp_desc_t::buildFlags), offsetof(ze_rtas_builder_build_op_exp_desc_t, buildFlags), ZE_RESULT_ERROR_INVALID_ENUMERATION, 0x3 },
+        };
+        const uint64_t values[] = { paramValue( hBuilder ), paramValue( pBuildOpDescriptor ), paramValue( pScratchBuffer ), paramValue( pRtasBuffer ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ParameterValidation::validateExtensions(pBuildOpDescriptor);
     }
@@ -4468,17 +4234,15 @@ namespace validation_layer
         uint64_t* pCommandId                            ///< [out] pointer to mutable command identifier to be written
         )
     {
-        if( nullptr == hCommandList )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == desc )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == pCommandId )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( 0xff < desc->flags )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isAbove, 1, 0, sizeof(ze_mutable_command_id_exp_desc_t::flags), offsetof(ze_mutable_command_id_exp_desc_t, flags), ZE_RESULT_ERROR_INVALID_ENUMERATION, 0xff },
+        };
+        const uint64_t values[] = { paramValue( hCommandList ), paramValue( desc ), paramValue( pCommandId ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ParameterValidation::validateExtensions(desc);
     }
@@ -4495,17 +4259,15 @@ namespace validation_layer
         uint64_t* pCommandId                            ///< [out] pointer to mutable command identifier to be written
         )
     {
-        if( nullptr == hCommandList )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == desc )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == pCommandId )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( 0xff < desc->flags )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isAbove, 1, 0, sizeof(ze_mutable_command_id_exp_desc_t::flags), offsetof(ze_mutable_command_id_exp_desc_t, flags), ZE_RESULT_ERROR_INVALID_ENUMERATION, 0xff },
+        };
+        const uint64_t values[] = { paramValue( hCommandList ), paramValue( desc ), paramValue( pCommandId ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ParameterValidation::validateExtensions(desc);
     }
@@ -353,23 +353,17 @@ namespace validation_layer
         ze_bool_t* pPendingReset                        ///< [out] Pending reset 0 =manufacturing state, 1= shipped state)..
         )
     {
-        if( nullptr == hDevice )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == pOverclockMode )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == pWaiverSetting )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == pOverclockState )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == pPendingAction )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == pPendingReset )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 3, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 4, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 5, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+        };
+        const uint64_t values[] = { paramValue( hDevice ), paramValue( pOverclockMode ), paramValue( pWaiverSetting ), paramValue( pOverclockState ), paramValue( pPendingAction ), paramValue( pPendingReset ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ZE_RESULT_SUCCESS;
     }
@@ -524,17 +518,15 @@ namespace validation_layer
         zes_pending_action_t* pPendingAction            ///< [out] Pending overclock setting.
         )
     {
-        if( nullptr == hDomainHandle )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( ZES_OVERCLOCK_CONTROL_ACM_DISABLE < DomainControl )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
-
-        if( nullptr == pControlState )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == pPendingAction )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isAbove, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_ENUMERATION, ZES_OVERCLOCK_CONTROL_ACM_DISABLE },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 3, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+        };
+        const uint64_t values[] = { paramValue( hDomainHandle ), paramValue( DomainControl ), paramValue( pControlState ), paramValue( pPendingAction ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ZE_RESULT_SUCCESS;
     }
@@ -550,17 +542,15 @@ namespace validation_layer
                                                         ///< units from the custom V-F curve at the specified zero-based index 
         )
     {
-        if( nullptr == hDomainHandle )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( ZES_VF_TYPE_FREQ < VFType )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
-
-        if( ZES_VF_ARRAY_TYPE_LIVE_VF_ARRAY < VFArrayType )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
-
-        if( nullptr == PointValue )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isAbove, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_ENUMERATION, ZES_VF_TYPE_FREQ },
+            { paramCheck::isAbove, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_ENUMERATION, ZES_VF_ARRAY_TYPE_LIVE_VF_ARRAY },
+            { paramCheck::isNull, 3, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+        };
+        const uint64_t values[] = { paramValue( hDomainHandle ), paramValue( VFType ), paramValue( VFArrayType ), paramValue( PointValue ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ZE_RESULT_SUCCESS;
     }
@@ -727,17 +717,15 @@ namespace validation_layer
         zes_device_ecc_properties_t* pState             ///< [out] ECC state, pending state, and pending action for state change.
         )
     {
-        if( nullptr == hDevice )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == newState )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == pState )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( ZES_DEVICE_ECC_STATE_DISABLED < newState->state )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isAbove, 1, 0, sizeof(zes_device_ecc_desc_t::state), offsetof(zes_device_ecc_desc_t, state), ZE_RESULT_ERROR_INVALID_ENUMERATION, ZES_DEVICE_ECC_STATE_DISABLED },
+        };
+        const uint64_t values[] = { paramValue( hDevice ), paramValue( newState ), paramValue( pState ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         auto retVal = ZE_RESULT_SUCCESS;
         retVal = ParameterValidation::validateExtensions(newState);
@@ -845,17 +833,15 @@ namespace validation_layer
                                                         ///< entry will be zero.
         )
     {
-        if( nullptr == hDriver )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == phDevices )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == pNumDeviceEvents )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == pEvents )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 3, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+        };
+        const uint64_t values[] = { paramValue( hDriver ), paramValue( phDevices ), paramValue( pNumDeviceEvents ), paramValue( pEvents ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ZE_RESULT_SUCCESS;
     }
@@ -883,17 +869,15 @@ namespace validation_layer
                                                         ///< entry will be zero.
         )
     {
-        if( nullptr == hDriver )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == phDevices )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == pNumDeviceEvents )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == pEvents )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 3, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+        };
+        const uint64_t values[] = { paramValue( hDriver ), paramValue( phDevices ), paramValue( pNumDeviceEvents ), paramValue( pEvents ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ZE_RESULT_SUCCESS;
     }
@@ -2648,17 +2632,15 @@ namespace validation_layer
         uint32_t* subdeviceId                           ///< [out] If onSubdevice is true, this gives the ID of the sub-device
         )
     {
-        if( nullptr == hDriver )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == phDevice )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == onSubdevice )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == subdeviceId )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 3, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+        };
+        const uint64_t values[] = { paramValue( hDriver ), paramValue( phDevice ), paramValue( onSubdevice ), paramValue( subdeviceId ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ZE_RESULT_SUCCESS;
     }
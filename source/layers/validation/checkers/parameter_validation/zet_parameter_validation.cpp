@@ -158,17 +158,15 @@ namespace validation_layer
         void* buffer                                    ///< [in,out] a buffer to hold a copy of the memory
         )
     {
-        if( nullptr == hDebug )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == desc )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == buffer )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( ZET_DEBUG_MEMORY_SPACE_TYPE_BARRIER < desc->type )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isAbove, 1, 0, sizeof(zet_debug_memory_space_desc_t::type), offsetof(zet_debug_memory_space_desc_t, type), ZE_RESULT_ERROR_INVALID_ENUMERATION, ZET_DEBUG_MEMORY_SPACE_TYPE_BARRIER },
+        };
+        const uint64_t values[] = { paramValue( hDebug ), paramValue( desc ), paramValue( buffer ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ParameterValidation::validateExtensions(desc);
     }
@@ -183,17 +181,15 @@ namespace validation_layer
         const void* buffer                              ///< [in] a buffer holding the pattern to write
         )
     {
-        if( nullptr == hDebug )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == desc )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == buffer )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( ZET_DEBUG_MEMORY_SPACE_TYPE_BARRIER < desc->type )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isAbove, 1, 0, sizeof(zet_debug_memory_space_desc_t::type), offsetof(zet_debug_memory_space_desc_t, type), ZE_RESULT_ERROR_INVALID_ENUMERATION, ZET_DEBUG_MEMORY_SPACE_TYPE_BARRIER },
+        };
+        const uint64_t values[] = { paramValue( hDebug ), paramValue( desc ), paramValue( buffer ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ParameterValidation::validateExtensions(desc);
     }
@@ -349,17 +345,15 @@ namespace validation_layer
                                                         ///< then driver shall only calculate that number of metric values.
         )
     {
-        if( nullptr == hMetricGroup )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( ZET_METRIC_GROUP_CALCULATION_TYPE_MAX_METRIC_VALUES < type )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
-
-        if( nullptr == pRawData )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == pMetricValueCount )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isAbove, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_ENUMERATION, ZET_METRIC_GROUP_CALCULATION_TYPE_MAX_METRIC_VALUES },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 3, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+        };
+        const uint64_t values[] = { paramValue( hMetricGroup ), paramValue( type ), paramValue( pRawData ), paramValue( pMetricValueCount ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ZE_RESULT_SUCCESS;
     }
@@ -439,20 +433,16 @@ namespace validation_layer
         zet_metric_streamer_handle_t* phMetricStreamer  ///< [out] handle of metric streamer
         )
     {
-        if( nullptr == hContext )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == hDevice )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == hMetricGroup )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == desc )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == phMetricStreamer )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 3, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 4, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+        };
+        const uint64_t values[] = { paramValue( hContext ), paramValue( hDevice ), paramValue( hMetricGroup ), paramValue( desc ), paramValue( phMetricStreamer ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ParameterValidation::validateExtensions(desc);
     }
@@ -522,23 +512,17 @@ namespace validation_layer
         zet_metric_query_pool_handle_t* phMetricQueryPool   ///< [out] handle of metric query pool
         )
     {
-        if( nullptr == hContext )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == hDevice )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == hMetricGroup )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == desc )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == phMetricQueryPool )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( ZET_METRIC_QUERY_POOL_TYPE_EXECUTION < desc->type )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 3, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 4, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isAbove, 3, 0, sizeof(zet_metric_query_pool_desc_t::type), offsetof(zet_metric_query_pool_desc_t, type), ZE_RESULT_ERROR_INVALID_ENUMERATION, ZET_METRIC_QUERY_POOL_TYPE_EXECUTION },
+        };
+        const uint64_t values[] = { paramValue( hContext ), paramValue( hDevice ), paramValue( hMetricGroup ), paramValue( desc ), paramValue( phMetricQueryPool ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ParameterValidation::validateExtensions(desc);
     }
@@ -694,17 +678,15 @@ namespace validation_layer
         zet_tracer_exp_handle_t* phTracer               ///< [out] pointer to handle of tracer object created
         )
     {
-        if( nullptr == hContext )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == desc )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == desc->pUserData )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == phTracer )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 1, 0, sizeof(zet_tracer_exp_desc_t::pUserData), offsetof(zet_tracer_exp_desc_t, pUserData), ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+        };
+        const uint64_t values[] = { paramValue( hContext ), paramValue( desc ), paramValue( phTracer ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ParameterValidation::validateExtensions(desc);
     }
@@ -801,20 +783,16 @@ namespace validation_layer
         zet_metric_tracer_exp_handle_t* phMetricTracer  ///< [out] handle of the metric tracer
         )
     {
-        if( nullptr == hContext )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == hDevice )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == phMetricGroups )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == desc )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == phMetricTracer )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 3, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 4, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+        };
+        const uint64_t values[] = { paramValue( hContext ), paramValue( hDevice ), paramValue( phMetricGroups ), paramValue( desc ), paramValue( phMetricTracer ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ParameterValidation::validateExtensions(desc);
     }
@@ -992,20 +970,16 @@ namespace validation_layer
                                                         ///< decoded metric entries
         )
     {
-        if( nullptr == phMetricDecoder )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == pRawDataSize )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == phMetrics )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == pSetCount )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == pMetricEntriesCount )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 3, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 4, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+        };
+        const uint64_t values[] = { paramValue( phMetricDecoder ), paramValue( pRawDataSize ), paramValue( phMetrics ), paramValue( pSetCount ), paramValue( pMetricEntriesCount ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ZE_RESULT_SUCCESS;
     }
@@ -1081,20 +1055,16 @@ namespace validation_layer
                                                         ///< then driver shall only calculate that number of metric values.
         )
     {
-        if( nullptr == hMetricGroup )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( ZET_METRIC_GROUP_CALCULATION_TYPE_MAX_METRIC_VALUES < type )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
-
-        if( nullptr == pRawData )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == pSetCount )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == pTotalMetricValueCount )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isAbove, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_ENUMERATION, ZET_METRIC_GROUP_CALCULATION_TYPE_MAX_METRIC_VALUES },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 3, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 4, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+        };
+        const uint64_t values[] = { paramValue( hMetricGroup ), paramValue( type ), paramValue( pRawData ), paramValue( pSetCount ), paramValue( pTotalMetricValueCount ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ZE_RESULT_SUCCESS;
     }
@@ -1175,23 +1145,17 @@ namespace validation_layer
                                                         ///< then driver shall only calculate that number of metric values.
         )
     {
-        if( nullptr == hDriver )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( ZET_METRIC_GROUP_CALCULATION_TYPE_MAX_METRIC_VALUES < type )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
-
-        if( nullptr == pExportData )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == pCalculateDescriptor )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == pSetCount )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == pTotalMetricValueCount )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isAbove, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_ENUMERATION, ZET_METRIC_GROUP_CALCULATION_TYPE_MAX_METRIC_VALUES },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 3, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 4, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 5, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+        };
+        const uint64_t values[] = { paramValue( hDriver ), paramValue( type ), paramValue( pExportData ), paramValue( pCalculateDescriptor ), paramValue( pSetCount ), paramValue( pTotalMetricValueCount ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ParameterValidation::validateExtensions(pCalculateDescriptor);
     }
@@ -1311,20 +1275,16 @@ namespace validation_layer
                                                         ///< shall only retrieve that number of metric handles.
         )
     {
-        if( nullptr == hMetricProgrammable )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == pParameterValues )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == pName )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == pDescription )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == pMetricHandleCount )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 3, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 4, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+        };
+        const uint64_t values[] = { paramValue( hMetricProgrammable ), paramValue( pParameterValues ), paramValue( pName ), paramValue( pDescription ), paramValue( pMetricHandleCount ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ZE_RESULT_SUCCESS;
     }
@@ -1351,20 +1311,16 @@ namespace validation_layer
                                                         ///< shall only retrieve that number of metric handles.
         )
     {
-        if( nullptr == hMetricProgrammable )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == pParameterValues )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == pName )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == pDescription )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == pMetricHandleCount )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 3, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 4, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+        };
+        const uint64_t values[] = { paramValue( hMetricProgrammable ), paramValue( pParameterValues ), paramValue( pName ), paramValue( pDescription ), paramValue( pMetricHandleCount ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ZE_RESULT_SUCCESS;
     }
@@ -1413,20 +1369,16 @@ namespace validation_layer
         zet_metric_group_handle_t* phMetricGroup        ///< [in,out] Created Metric group handle
         )
     {
-        if( nullptr == hDevice )
-            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
-
-        if( nullptr == pName )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == pDescription )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( nullptr == phMetricGroup )
-            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-
-        if( 0x7 < samplingType )
-            return ZE_RESULT_ERROR_INVALID_ENUMERATION;
+        static constexpr paramCheck checks[] = {
+            { paramCheck::isNull, 0, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_HANDLE, 0 },
+            { paramCheck::isNull, 1, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 2, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isNull, 3, 0, 0, 0, ZE_RESULT_ERROR_INVALID_NULL_POINTER, 0 },
+            { paramCheck::isAbove, 4, 0, 0, 0, ZE_RESULT_ERROR_INVALID_ENUMERATION, 0x7 },
+        };
+        const uint64_t values[] = { paramValue( hDevice ), paramValue( pName ), paramValue( pDescription ), paramValue( phMetricGroup ), paramValue( samplingType ) };
+        if( auto result = validateParams( checks, values ) )
+            return result;
 
         return ZE_RESULT_SUCCESS;
     }
@@ -0,0 +1,431 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file zel_performance_lint_checker.cpp
+ *
+ */
+#include "zel_performance_lint_checker.h"
+#include "validation_stack.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+namespace validation_layer
+{
+    class performance_lintChecker performance_lint_checker;
+
+    performance_lintChecker::performance_lintChecker() {
+        enableperformance_lint = getenv_tobool( "ZEL_ENABLE_PERFORMANCE_LINT_CHECKER" );
+        if(enableperformance_lint) {
+            performance_lintChecker::ZEperformance_lintChecker *zeChecker = new performance_lintChecker::ZEperformance_lintChecker;
+            performance_lintChecker::ZESperformance_lintChecker *zesChecker = new performance_lintChecker::ZESperformance_lintChecker;
+            performance_lintChecker::ZETperformance_lintChecker *zetChecker = new performance_lintChecker::ZETperformance_lintChecker;
+            performance_lintChecker::ZERperformance_lintChecker *zerChecker = new performance_lintChecker::ZERperformance_lintChecker;
+            performance_lint_checker.zeValidation = zeChecker;
+            performance_lint_checker.zetValidation = zetChecker;
+            performance_lint_checker.zesValidation = zesChecker;
+            performance_lint_checker.zerValidation = zerChecker;
+            performance_lint_checker.checkerName = "performance_lint";
+            // Not sampled: the patterns compare consecutive calls, so a skipped
+            // execute or free would be reported as a wasted reset or allocation
+            validation_layer::context.validationHandlers.push_back(&performance_lint_checker);
+        }
+    }
+
+    performance_lintChecker::~performance_lintChecker() {
+        if(enableperformance_lint) {
+            delete performance_lint_checker.zeValidation;
+            delete performance_lint_checker.zetValidation;
+            delete performance_lint_checker.zesValidation;
+            delete performance_lint_checker.zerValidation;
+        }
+    }
+
+    using ZEChecker = performance_lintChecker::ZEperformance_lintChecker;
+
+    static const char *lintPatternNames[ZEChecker::lintPatternCount] = {
+        "event-pool-churn",
+        "redundant-kernel-argument",
+        "sync-after-execute",
+        "small-device-allocation",
+        "command-list-reset-churn",
+    };
+
+    // Recently destroyed event pool descriptions kept per checker for churn detection
+    static constexpr size_t recentlyDestroyedPoolCount = 16;
+
+    // Queue of the last zeCommandQueueExecuteCommandLists on this thread, cleared by the next synchronize
+    static thread_local ze_command_queue_handle_t lastExecutedQueue = nullptr;
+
+    static std::string handleString(const void *handle) {
+        std::ostringstream out;
+        out << handle;
+        return out.str();
+    }
+
+    // FNV-1a over the argument bytes; a null value (local memory size) hashes by size only
+    static uint64_t hashArgument(size_t argSize, const void *pArgValue) {
+        uint64_t hash = 14695981039346656037ull;
+        auto mix = [&hash](uint8_t byte) {
+            hash ^= byte;
+            hash *= 1099511628211ull;
+        };
+        for (size_t i = 0; i < sizeof(argSize); i++)
+            mix(static_cast<uint8_t>(argSize >> (i * 8)));
+        mix(pArgValue ? 1 : 0);
+        if (pArgValue) {
+            auto bytes = static_cast<const uint8_t *>(pArgValue);
+            for (size_t i = 0; i < argSize; i++)
+                mix(bytes[i]);
+        }
+        return hash ? hash : 1;
+    }
+
+    ZEChecker::ZEperformance_lintChecker() {
+        auto thresholdString = getenv_string( "ZEL_PERFORMANCE_LINT_THRESHOLD" );
+        if (!thresholdString.empty()) {
+            auto value = strtoull( thresholdString.c_str(), nullptr, 10 );
+            if (value > 0)
+                threshold = value;
+        }
+        auto smallAllocationString = getenv_string( "ZEL_PERFORMANCE_LINT_SMALL_ALLOCATION_BYTES" );
+        if (!smallAllocationString.empty()) {
+            auto value = strtoull( smallAllocationString.c_str(), nullptr, 10 );
+            if (value > 0)
+                smallAllocationBytes = static_cast<size_t>(value);
+        }
+    }
+
+    template <typename State, typename Handle>
+    State &ZEChecker::findOrCreate(std::unordered_map<Handle, std::unique_ptr<State>> &objects, Handle handle) {
+        {
+            std::shared_lock<std::shared_timed_mutex> lock(objectsMutex);
+            auto object = objects.find(handle);
+            if (object != objects.end())
+                return *object->second;
+        }
+        // Objects created before the checker saw them are tracked from their first use
+        std::lock_guard<std::shared_timed_mutex> lock(objectsMutex);
+        auto &object = objects[handle];
+        if (!object)
+            object.reset(new State);
+        return *object;
+    }
+
+    template <typename State, typename Handle>
+    std::unique_ptr<State> ZEChecker::release(std::unordered_map<Handle, std::unique_ptr<State>> &objects, Handle handle) {
+        std::lock_guard<std::shared_timed_mutex> lock(objectsMutex);
+        auto object = objects.find(handle);
+        if (object == objects.end())
+            return nullptr;
+        auto state = std::move(object->second);
+        objects.erase(object);
+        return state;
+    }
+
+    void ZEChecker::addFinding(lintPattern pattern, const std::string &object, uint64_t occurrences, uint64_t total, uint64_t wastedCalls, const std::string &callSite) {
+        if (occurrences < threshold)
+            return;
+        std::lock_guard<std::mutex> lock(findingsMutex);
+        auto &finding = findings[std::make_pair(pattern, object)];
+        finding.occurrences += occurrences;
+        finding.total += total;
+        finding.wastedCalls += wastedCalls;
+        if (finding.callSite.empty())
+            finding.callSite = callSite;
+    }
+
+    void ZEChecker::retireKernel(const kernelState &kernel) {
+        addFinding(redundantKernelArgument, "kernel \"" + (kernel.name.empty() ? std::string("unknown") : kernel.name) + "\"",
+                   kernel.unchangedSets, kernel.setCalls, kernel.unchangedSets, kernel.callSite);
+    }
+
+    void ZEChecker::retireQueue(ze_command_queue_handle_t hCommandQueue, const queueState &queue) {
+        // Synchronizing after each execute is only a lint when it is the dominant pattern
+        auto executes = queue.executes.load(std::memory_order_relaxed);
+        auto syncsAfterExecute = queue.syncsAfterExecute.load(std::memory_order_relaxed);
+        if (syncsAfterExecute * 10 < executes * 9)
+            return;
+        addFinding(syncAfterExecute, "command queue " + handleString(hCommandQueue), syncsAfterExecute, executes,
+                   syncsAfterExecute ? syncsAfterExecute - 1 : 0, queue.callSite);
+    }
+
+    void ZEChecker::retireCommandList(ze_command_list_handle_t hCommandList, const commandListState &commandList) {
+        addFinding(commandListResetChurn, "command list " + handleString(hCommandList), commandList.resetsWithoutExecute, commandList.resets,
+                   commandList.resetsWithoutExecute, commandList.callSite);
+    }
+
+    ZEChecker::~ZEperformance_lintChecker() {
+        {
+            std::lock_guard<std::shared_timed_mutex> lock(objectsMutex);
+            for (auto &kernel : kernels)
+                retireKernel(*kernel.second);
+            for (auto &queue : queues)
+                retireQueue(queue.first, *queue.second);
+            for (auto &commandList : commandLists)
+                retireCommandList(commandList.first, *commandList.second);
+        }
+        {
+            std::lock_guard<std::mutex> lock(churnMutex);
+            for (auto &churn : eventPoolChurnByContext)
+                addFinding(eventPoolChurn, "context " + handleString(churn.first), churn.second.occurrences, churn.second.total,
+                           churn.second.wastedCalls, churn.second.callSite);
+            for (auto &size : smallAllocationSizes) {
+                std::ostringstream object;
+                object << size.first.size << " byte allocations on device " << size.first.hDevice;
+                addFinding(smallDeviceAllocation, object.str(), size.second.reallocatedAfterFree, size.second.allocations,
+                           size.second.reallocatedAfterFree * 2, size.second.callSite);
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(findingsMutex);
+        std::vector<std::pair<std::pair<lintPattern, std::string>, lintFinding>> ranked(findings.begin(), findings.end());
+        std::sort(ranked.begin(), ranked.end(), [](const std::pair<std::pair<lintPattern, std::string>, lintFinding> &a,
+                                                   const std::pair<std::pair<lintPattern, std::string>, lintFinding> &b) {
+            return a.second.wastedCalls > b.second.wastedCalls;
+        });
+
+        std::cerr << "Performance lint report\n";
+        std::cerr << "----------------------------------------------------------\n";
+        if (ranked.empty()) {
+            std::cerr << "No performance anti-patterns found\n";
+        }
+        for (auto &entry : ranked) {
+            auto &finding = entry.second;
+            std::cerr << "[" << lintPatternNames[entry.first.first] << "] " << entry.first.second << " : ";
+            switch (entry.first.first) {
+            case eventPoolChurn:
+                std::cerr << finding.occurrences << " of " << finding.total << " zeEventPoolCreate calls recreated a pool just destroyed with the same description";
+                break;
+            case redundantKernelArgument:
+                std::cerr << finding.occurrences << " of " << finding.total << " zeKernelSetArgumentValue calls set an unchanged value";
+                break;
+            case syncAfterExecute:
+                std::cerr << finding.occurrences << " of " << finding.total << " executes were followed by zeCommandQueueSynchronize";
+                break;
+            case smallDeviceAllocation:
+                std::cerr << finding.occurrences << " of " << finding.total << " zeMemAllocDevice calls reallocated a size that was just freed";
+                break;
+            case commandListResetChurn:
+                std::cerr << finding.total << " zeCommandListReset calls, " << finding.wastedCalls << " without an execute since the previous reset";
+                break;
+            default:
+                break;
+            }
+            std::cerr << "\n    estimated wasted calls: " << finding.wastedCalls;
+            std::cerr << "\n    first seen at: " << finding.callSite << "\n";
+        }
+    }
+
+    // Call sites are captured outside of any lock, and only kept if no other
+    // thread stored one in the meantime
+    static void storeCallSite(std::mutex &stateMutex, std::string &callSite) {
+        auto site = describeCaller();
+        std::lock_guard<std::mutex> lock(stateMutex);
+        if (callSite.empty())
+            callSite = std::move(site);
+    }
+
+    ze_result_t ZEChecker::zeEventPoolCreateEpilogue(ze_context_handle_t hContext, const ze_event_pool_desc_t *desc, uint32_t, ze_device_handle_t *, ze_event_pool_handle_t *phEventPool, ze_result_t result) {
+        if (result != ZE_RESULT_SUCCESS || desc == nullptr || phEventPool == nullptr)
+            return ZE_RESULT_SUCCESS;
+        eventPoolKey key = {hContext, desc->flags, desc->count};
+        lintFinding *needsCallSite = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(churnMutex);
+            eventPools[*phEventPool] = key;
+            auto &churn = eventPoolChurnByContext[hContext];
+            churn.total++;
+            auto recent = std::find(recentlyDestroyedPools.begin(), recentlyDestroyedPools.end(), key);
+            if (recent != recentlyDestroyedPools.end()) {
+                recentlyDestroyedPools.erase(recent);
+                churn.occurrences++;
+                // The pool could have been kept, saving this create and the earlier destroy
+                churn.wastedCalls += 2;
+                if (churn.callSite.empty())
+                    needsCallSite = &churn;
+            }
+        }
+        if (needsCallSite)
+            storeCallSite(churnMutex, needsCallSite->callSite);
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t ZEChecker::zeEventPoolDestroyEpilogue(ze_event_pool_handle_t hEventPool, ze_result_t result) {
+        if (result != ZE_RESULT_SUCCESS)
+            return ZE_RESULT_SUCCESS;
+        std::lock_guard<std::mutex> lock(churnMutex);
+        auto pool = eventPools.find(hEventPool);
+        if (pool == eventPools.end())
+            return ZE_RESULT_SUCCESS;
+        if (recentlyDestroyedPools.size() == recentlyDestroyedPoolCount)
+            recentlyDestroyedPools.erase(recentlyDestroyedPools.begin());
+        recentlyDestroyedPools.push_back(pool->second);
+        eventPools.erase(pool);
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t ZEChecker::zeKernelCreateEpilogue(ze_module_handle_t, const ze_kernel_desc_t *desc, ze_kernel_handle_t *phKernel, ze_result_t result) {
+        if (result != ZE_RESULT_SUCCESS || phKernel == nullptr)
+            return ZE_RESULT_SUCCESS;
+        std::unique_ptr<kernelState> kernel(new kernelState);
+        kernel->name = (desc && desc->pKernelName) ? desc->pKernelName : "unknown";
+        std::lock_guard<std::shared_timed_mutex> lock(objectsMutex);
+        kernels[*phKernel] = std::move(kernel);
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t ZEChecker::zeKernelDestroyEpilogue(ze_kernel_handle_t hKernel, ze_result_t result) {
+        if (result != ZE_RESULT_SUCCESS)
+            return ZE_RESULT_SUCCESS;
+        auto kernel = release(kernels, hKernel);
+        if (kernel)
+            retireKernel(*kernel);
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t ZEChecker::zeKernelSetArgumentValueEpilogue(ze_kernel_handle_t hKernel, uint32_t argIndex, size_t argSize, const void *pArgValue, ze_result_t result) {
+        if (result != ZE_RESULT_SUCCESS)
+            return ZE_RESULT_SUCCESS;
+        auto hash = hashArgument(argSize, pArgValue);
+        auto &kernel = findOrCreate(kernels, hKernel);
+        bool needsCallSite = false;
+        {
+            std::lock_guard<std::mutex> lock(kernel.stateMutex);
+            if (argIndex >= kernel.argHashes.size())
+                kernel.argHashes.resize(argIndex + 1, 0);
+            kernel.setCalls++;
+            if (kernel.argHashes[argIndex] == hash) {
+                kernel.unchangedSets++;
+                needsCallSite = kernel.callSite.empty();
+            }
+            kernel.argHashes[argIndex] = hash;
+        }
+        if (needsCallSite)
+            storeCallSite(kernel.stateMutex, kernel.callSite);
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t ZEChecker::zeCommandQueueExecuteCommandListsEpilogue(ze_command_queue_handle_t hCommandQueue, uint32_t numCommandLists, ze_command_list_handle_t *phCommandLists, ze_fence_handle_t, ze_result_t result) {
+        if (result != ZE_RESULT_SUCCESS)
+            return ZE_RESULT_SUCCESS;
+        lastExecutedQueue = hCommandQueue;
+        findOrCreate(queues, hCommandQueue).executes.fetch_add(1, std::memory_order_relaxed);
+        if (phCommandLists) {
+            std::shared_lock<std::shared_timed_mutex> lock(objectsMutex);
+            for (uint32_t i = 0; i < numCommandLists; i++) {
+                auto commandList = commandLists.find(phCommandLists[i]);
+                if (commandList != commandLists.end())
+                    commandList->second->executedSinceReset.store(true, std::memory_order_relaxed);
+            }
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t ZEChecker::zeCommandQueueSynchronizePrologue(ze_command_queue_handle_t hCommandQueue, uint64_t) {
+        bool afterExecute = (lastExecutedQueue == hCommandQueue);
+        lastExecutedQueue = nullptr;
+        if (!afterExecute)
+            return ZE_RESULT_SUCCESS;
+        auto &queue = findOrCreate(queues, hCommandQueue);
+        if (queue.syncsAfterExecute.fetch_add(1, std::memory_order_relaxed) + 1 == threshold)
+            storeCallSite(queue.stateMutex, queue.callSite);
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t ZEChecker::zeCommandQueueDestroyEpilogue(ze_command_queue_handle_t hCommandQueue, ze_result_t result) {
+        if (result != ZE_RESULT_SUCCESS)
+            return ZE_RESULT_SUCCESS;
+        auto queue = release(queues, hCommandQueue);
+        if (queue)
+            retireQueue(hCommandQueue, *queue);
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t ZEChecker::zeMemAllocDeviceEpilogue(ze_context_handle_t hContext, const ze_device_mem_alloc_desc_t *, size_t size, size_t, ze_device_handle_t hDevice, void **pptr, ze_result_t result) {
+        if (result != ZE_RESULT_SUCCESS || pptr == nullptr || size > smallAllocationBytes)
+            return ZE_RESULT_SUCCESS;
+        smallAllocationKey key = {hContext, hDevice, size};
+        smallAllocationState *needsCallSite = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(churnMutex);
+            smallAllocations[*pptr] = key;
+            auto &state = smallAllocationSizes[key];
+            state.allocations++;
+            if (state.freed > 0) {
+                // A freed allocation of this size could have been reused
+                state.freed--;
+                state.reallocatedAfterFree++;
+                if (state.callSite.empty())
+                    needsCallSite = &state;
+            }
+        }
+        if (needsCallSite)
+            storeCallSite(churnMutex, needsCallSite->callSite);
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t ZEChecker::zeMemFreeEpilogue(ze_context_handle_t, void *ptr, ze_result_t result) {
+        if (result != ZE_RESULT_SUCCESS)
+            return ZE_RESULT_SUCCESS;
+        std::lock_guard<std::mutex> lock(churnMutex);
+        auto allocation = smallAllocations.find(ptr);
+        if (allocation != smallAllocations.end()) {
+            smallAllocationSizes[allocation->second].freed++;
+            smallAllocations.erase(allocation);
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t ZEChecker::zeMemFreeExtEpilogue(ze_context_handle_t hContext, const ze_memory_free_ext_desc_t *, void *ptr, ze_result_t result) {
+        return zeMemFreeEpilogue(hContext, ptr, result);
+    }
+
+    ze_result_t ZEChecker::zeCommandListCreateEpilogue(ze_context_handle_t, ze_device_handle_t, const ze_command_list_desc_t *, ze_command_list_handle_t *phCommandList, ze_result_t result) {
+        // Immediate command lists are not tracked, their reset does not discard recorded work
+        if (result != ZE_RESULT_SUCCESS || phCommandList == nullptr)
+            return ZE_RESULT_SUCCESS;
+        std::lock_guard<std::shared_timed_mutex> lock(objectsMutex);
+        commandLists[*phCommandList].reset(new commandListState);
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t ZEChecker::zeCommandListResetEpilogue(ze_command_list_handle_t hCommandList, ze_result_t result) {
+        if (result != ZE_RESULT_SUCCESS)
+            return ZE_RESULT_SUCCESS;
+        commandListState *state = nullptr;
+        {
+            std::shared_lock<std::shared_timed_mutex> lock(objectsMutex);
+            auto commandList = commandLists.find(hCommandList);
+            if (commandList == commandLists.end())
+                return ZE_RESULT_SUCCESS;
+            state = commandList->second.get();
+        }
+        bool needsCallSite = false;
+        {
+            std::lock_guard<std::mutex> lock(state->stateMutex);
+            state->resets++;
+            bool executed = state->executedSinceReset.exchange(false, std::memory_order_relaxed);
+            if (!executed)
+                state->resetsWithoutExecute++;
+            needsCallSite = state->callSite.empty() && (!executed || state->resets == threshold);
+        }
+        if (needsCallSite)
+            storeCallSite(state->stateMutex, state->callSite);
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t ZEChecker::zeCommandListDestroyEpilogue(ze_command_list_handle_t hCommandList, ze_result_t result) {
+        if (result != ZE_RESULT_SUCCESS)
+            return ZE_RESULT_SUCCESS;
+        auto commandList = release(commandLists, hCommandList);
+        if (commandList)
+            retireCommandList(hCommandList, *commandList);
+        return ZE_RESULT_SUCCESS;
+    }
+}
@@ -0,0 +1,176 @@
+/*
+ *
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file zel_performance_lint_checker.h
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ze_api.h"
+#include "ze_validation_layer.h"
+
+namespace validation_layer
+{
+    // Detects common performance anti-patterns in application code with
+    // per-object counters, and prints an aggregated report at exit.
+    //
+    // A sample output is this:
+    // ------------------------------------------------------------------------
+    // Performance lint report
+    // ------------------------------------------------------------------------
+    // [redundant-kernel-argument] kernel "add" : 4096 of 4608 zeKernelSetArgumentValue calls set an unchanged value
+    //     estimated wasted calls: 4096
+    //     first seen at: main+0x1c4 (/path/to/app)
+    // [sync-after-execute] command queue 0x5581e2c0 : 512 of 512 executes were followed by zeCommandQueueSynchronize
+    //     estimated wasted calls: 511
+    //     first seen at: main+0x23a (/path/to/app)
+    //
+    class __zedlllocal performance_lintChecker : public validationChecker{
+        public:
+            performance_lintChecker();
+            ~performance_lintChecker();
+
+            class ZEperformance_lintChecker : public ZEValidationEntryPoints {
+            public:
+                ZEperformance_lintChecker();
+                ~ZEperformance_lintChecker();
+
+                ze_result_t zeEventPoolCreateEpilogue(ze_context_handle_t hContext, const ze_event_pool_desc_t *desc, uint32_t numDevices, ze_device_handle_t *phDevices, ze_event_pool_handle_t *phEventPool, ze_result_t result) override;
+                ze_result_t zeEventPoolDestroyEpilogue(ze_event_pool_handle_t hEventPool, ze_result_t result) override;
+                ze_result_t zeKernelCreateEpilogue(ze_module_handle_t hModule, const ze_kernel_desc_t *desc, ze_kernel_handle_t *phKernel, ze_result_t result) override;
+                ze_result_t zeKernelDestroyEpilogue(ze_kernel_handle_t hKernel, ze_result_t result) override;
+                ze_result_t zeKernelSetArgumentValueEpilogue(ze_kernel_handle_t hKernel, uint32_t argIndex, size_t argSize, const void *pArgValue, ze_result_t result) override;
+                ze_result_t zeCommandQueueExecuteCommandListsEpilogue(ze_command_queue_handle_t hCommandQueue, uint32_t numCommandLists, ze_command_list_handle_t *phCommandLists, ze_fence_handle_t hFence, ze_result_t result) override;
+                ze_result_t zeCommandQueueSynchronizePrologue(ze_command_queue_handle_t hCommandQueue, uint64_t timeout) override;
+                ze_result_t zeCommandQueueDestroyEpilogue(ze_command_queue_handle_t hCommandQueue, ze_result_t result) override;
+                ze_result_t zeMemAllocDeviceEpilogue(ze_context_handle_t hContext, const ze_device_mem_alloc_desc_t *device_desc, size_t size, size_t alignment, ze_device_handle_t hDevice, void **pptr, ze_result_t result) override;
+                ze_result_t zeMemFreeEpilogue(ze_context_handle_t hContext, void *ptr, ze_result_t result) override;
+                ze_result_t zeMemFreeExtEpilogue(ze_context_handle_t hContext, const ze_memory_free_ext_desc_t *pMemFreeDesc, void *ptr, ze_result_t result) override;
+                ze_result_t zeCommandListCreateEpilogue(ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_command_list_desc_t *desc, ze_command_list_handle_t *phCommandList, ze_result_t result) override;
+                ze_result_t zeCommandListResetEpilogue(ze_command_list_handle_t hCommandList, ze_result_t result) override;
+                ze_result_t zeCommandListDestroyEpilogue(ze_command_list_handle_t hCommandList, ze_result_t result) override;
+
+                enum lintPattern : uint32_t {
+                    eventPoolChurn,
+                    redundantKernelArgument,
+                    syncAfterExecute,
+                    smallDeviceAllocation,
+                    commandListResetChurn,
+                    lintPatternCount
+                };
+
+            private:
+                // One report line, accumulated per pattern and object
+                struct lintFinding {
+                    uint64_t occurrences = 0;
+                    uint64_t total = 0;
+                    uint64_t wastedCalls = 0;
+                    std::string callSite;
+                };
+
+                // Per-object state. The API forbids concurrent calls on the same kernel or
+                // command list, so the per-object mutexes are uncontended in valid programs.
+                struct kernelState {
+                    std::mutex stateMutex;
+                    std::string name;
+                    // Hash of the last value set for each argument, 0 if never set
+                    std::vector<uint64_t> argHashes;
+                    uint64_t setCalls = 0;
+                    uint64_t unchangedSets = 0;
+                    std::string callSite;
+                };
+                struct queueState {
+                    std::atomic<uint64_t> executes{0};
+                    std::atomic<uint64_t> syncsAfterExecute{0};
+                    std::mutex stateMutex;
+                    std::string callSite;
+                };
+                struct commandListState {
+                    std::atomic<bool> executedSinceReset{false};
+                    std::mutex stateMutex;
+                    uint64_t resets = 0;
+                    uint64_t resetsWithoutExecute = 0;
+                    std::string callSite;
+                };
+                struct eventPoolKey {
+                    ze_context_handle_t hContext;
+                    ze_event_pool_flags_t flags;
+                    uint32_t count;
+                    bool operator==(const eventPoolKey &other) const {
+                        return hContext == other.hContext && flags == other.flags && count == other.count;
+                    }
+                };
+                struct smallAllocationKey {
+                    ze_context_handle_t hContext;
+                    ze_device_handle_t hDevice;
+                    size_t size;
+                    bool operator<(const smallAllocationKey &other) const {
+                        if (hContext != other.hContext)
+                            return hContext < other.hContext;
+                        if (hDevice != other.hDevice)
+                            return hDevice < other.hDevice;
+                        return size < other.size;
+                    }
+                };
+                struct smallAllocationState {
+                    uint64_t allocations = 0;
+                    uint64_t freed = 0;
+                    uint64_t reallocatedAfterFree = 0;
+                    std::string callSite;
+                };
+
+                template <typename State, typename Handle>
+                State &findOrCreate(std::unordered_map<Handle, std::unique_ptr<State>> &objects, Handle handle);
+                template <typename State, typename Handle>
+                std::unique_ptr<State> release(std::unordered_map<Handle, std::unique_ptr<State>> &objects, Handle handle);
+
+                void addFinding(lintPattern pattern, const std::string &object, uint64_t occurrences, uint64_t total, uint64_t wastedCalls, const std::string &callSite);
+                void retireKernel(const kernelState &kernel);
+                void retireQueue(ze_command_queue_handle_t hCommandQueue, const queueState &queue);
+                void retireCommandList(ze_command_list_handle_t hCommandList, const commandListState &commandList);
+
+                // Minimum occurrences of a pattern on one object before it is reported
+                uint64_t threshold = 8;
+                size_t smallAllocationBytes = 64 * 1024;
+
+                std::mutex findingsMutex;
+                std::map<std::pair<lintPattern, std::string>, lintFinding> findings;
+
+                // Event pool and small allocation churn compare calls across objects
+                std::mutex churnMutex;
+                std::vector<eventPoolKey> recentlyDestroyedPools;
+                std::unordered_map<ze_event_pool_handle_t, eventPoolKey> eventPools;
+                std::map<ze_context_handle_t, lintFinding> eventPoolChurnByContext;
+
+                // Looked up under a shared lock, so calls on different objects never
+                // serialize; only creating and destroying an object takes it exclusively
+                std::shared_timed_mutex objectsMutex;
+                std::unordered_map<ze_kernel_handle_t, std::unique_ptr<kernelState>> kernels;
+                std::unordered_map<ze_command_queue_handle_t, std::unique_ptr<queueState>> queues;
+                std::unordered_map<ze_command_list_handle_t, std::unique_ptr<commandListState>> commandLists;
+
+                std::unordered_map<void *, smallAllocationKey> smallAllocations;
+                std::map<smallAllocationKey, smallAllocationState> smallAllocationSizes;
+            };
+
+            class ZESperformance_lintChecker : public ZESValidationEntryPoints {};
+            class ZETperformance_lintChecker : public ZETValidationEntryPoints {};
+            class ZERperformance_lintChecker : public ZERValidationEntryPoints {};
+            bool enableperformance_lint = false;
+    };
+    extern class performance_lintChecker performance_lint_checker;
+}
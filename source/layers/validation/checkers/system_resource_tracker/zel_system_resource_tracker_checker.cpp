@@ -13,10 +13,16 @@
 #include <fstream>
 #include <sstream>
 #include <sys/resource.h>
+#include <fcntl.h>
 #include <unistd.h>
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
 #include <cstring>
 #include <mutex>
 #include <chrono>
+#include <memory>
 #include <thread>
 #include <unordered_map>
 
@@ -90,6 +96,144 @@ namespace validation_layer
         }
     };
 
+    // Latest metrics published by the background sampler, readable without locking
+    struct AtomicSystemResourceMetrics {
+        std::atomic<size_t> vmSize{0};
+        std::atomic<size_t> vmRSS{0};
+        std::atomic<size_t> vmData{0};
+        std::atomic<size_t> vmPeak{0};
+        std::atomic<size_t> numThreads{0};
+        std::atomic<size_t> numFDs{0};
+
+        void store(const SystemResourceMetrics& metrics) {
+            vmSize.store(metrics.vmSize, std::memory_order_relaxed);
+            vmRSS.store(metrics.vmRSS, std::memory_order_relaxed);
+            vmData.store(metrics.vmData, std::memory_order_relaxed);
+            vmPeak.store(metrics.vmPeak, std::memory_order_relaxed);
+            numThreads.store(metrics.numThreads, std::memory_order_relaxed);
+            numFDs.store(metrics.numFDs, std::memory_order_relaxed);
+        }
+
+        SystemResourceMetrics load() const {
+            SystemResourceMetrics metrics;
+            metrics.vmSize = vmSize.load(std::memory_order_relaxed);
+            metrics.vmRSS = vmRSS.load(std::memory_order_relaxed);
+            metrics.vmData = vmData.load(std::memory_order_relaxed);
+            metrics.vmPeak = vmPeak.load(std::memory_order_relaxed);
+            metrics.numThreads = numThreads.load(std::memory_order_relaxed);
+            metrics.numFDs = numFDs.load(std::memory_order_relaxed);
+            return metrics;
+        }
+    };
+
+    // Fixed-size record produced per tracked API call when the asynchronous writer is enabled.
+    // Binary output files contain a ResourceTrackerFileHeader followed by these records verbatim.
+    struct ResourceTrackerRecord {
+        uint64_t callNumber;
+        uint64_t timeMs;
+        uint64_t vmSize;
+        uint64_t vmRSS;
+        uint64_t vmData;
+        uint64_t vmPeak;
+        uint64_t numThreads;
+        uint64_t deltaVmSize;
+        uint64_t deltaVmRSS;
+        uint64_t deltaVmData;
+        uint64_t contexts;
+        uint64_t commandQueues;
+        uint64_t modules;
+        uint64_t kernels;
+        uint64_t eventPools;
+        uint64_t commandLists;
+        uint64_t events;
+        uint64_t fences;
+        uint64_t images;
+        uint64_t samplers;
+        uint64_t totalMemory;
+        char apiCall[64];
+    };
+
+    struct ResourceTrackerFileHeader {
+        char magic[8];           // "ZELRTRK\0"
+        uint32_t version;
+        uint32_t recordSize;
+    };
+
+    static constexpr char resourceTrackerMagic[8] = {'Z', 'E', 'L', 'R', 'T', 'R', 'K', '\0'};
+    static constexpr uint32_t resourceTrackerVersion = 1;
+
+    // Bounded lock-free multi-producer/single-consumer ring of records.
+    // Producers never block: when the ring is full the record is dropped and counted.
+    class ResourceTrackerRing {
+      public:
+        explicit ResourceTrackerRing(size_t requestedCapacity) {
+            capacity = 1;
+            while (capacity * 2 <= requestedCapacity) {
+                capacity *= 2;
+            }
+            mask = capacity - 1;
+            slots.reset(new Slot[capacity]);
+            for (size_t i = 0; i < capacity; i++) {
+                slots[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        bool push(const ResourceTrackerRecord& record) {
+            uint64_t position = enqueuePosition.load(std::memory_order_relaxed);
+            Slot* slot;
+            for (;;) {
+                slot = &slots[position & mask];
+                uint64_t sequence = slot->sequence.load(std::memory_order_acquire);
+                int64_t diff = static_cast<int64_t>(sequence) - static_cast<int64_t>(position);
+                if (diff == 0) {
+                    if (enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                        break;
+                    }
+                } else if (diff < 0) {
+                    dropped.fetch_add(1, std::memory_order_relaxed);
+                    return false;
+                } else {
+                    position = enqueuePosition.load(std::memory_order_relaxed);
+                }
+            }
+            slot->record = record;
+            slot->sequence.store(position + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Only called from the writer thread
+        bool pop(ResourceTrackerRecord& record) {
+            Slot& slot = slots[dequeuePosition & mask];
+            if (slot.sequence.load(std::memory_order_acquire) != dequeuePosition + 1) {
+                return false;
+            }
+            record = slot.record;
+            slot.sequence.store(dequeuePosition + capacity, std::memory_order_release);
+            dequeuePosition++;
+            return true;
+        }
+
+        size_t getCapacity() const { return capacity; }
+        uint64_t getDropped() const { return dropped.load(std::memory_order_relaxed); }
+
+      private:
+        struct Slot {
+            std::atomic<uint64_t> sequence{0};
+            ResourceTrackerRecord record;
+        };
+
+        std::unique_ptr<Slot[]> slots;
+        size_t capacity = 0;
+        size_t mask = 0;
+        // Padding keeps the producer and consumer cursors on separate cache lines
+        // (alignas would require C++17 aligned new for the heap-allocated ring)
+        char producerPadding[64];
+        std::atomic<uint64_t> enqueuePosition{0};
+        char consumerPadding[64];
+        uint64_t dequeuePosition = 0;
+        std::atomic<uint64_t> dropped{0};
+    };
+
     // Structure to track resource usage by L0 resource type
     struct ResourceTracker {
         SystemResourceMetrics baseline;
@@ -105,23 +249,49 @@ namespace validation_layer
         SystemResourceMetrics samplers;
         SystemResourceMetrics memoryAllocations;
         
-        size_t contextCount = 0;
-        size_t commandQueueCount = 0;
-        size_t moduleCount = 0;
-        size_t kernelCount = 0;
-        size_t eventPoolCount = 0;
-        size_t commandListCount = 0;
-        size_t eventCount = 0;
-        size_t fenceCount = 0;
-        size_t imageCount = 0;
-        size_t samplerCount = 0;
-        size_t totalMemoryAllocated = 0;  // in bytes
+        std::atomic<size_t> contextCount{0};
+        std::atomic<size_t> commandQueueCount{0};
+        std::atomic<size_t> moduleCount{0};
+        std::atomic<size_t> kernelCount{0};
+        std::atomic<size_t> eventPoolCount{0};
+        std::atomic<size_t> commandListCount{0};
+        std::atomic<size_t> eventCount{0};
+        std::atomic<size_t> fenceCount{0};
+        std::atomic<size_t> imageCount{0};
+        std::atomic<size_t> samplerCount{0};
+        std::atomic<size_t> totalMemoryAllocated{0};  // in bytes
 
         std::mutex trackerMutex;
         std::ofstream* csvFile = nullptr;
         bool csvEnabled = false;
-        uint64_t callCounter = 0;
+        std::atomic<uint64_t> callCounter{0};
         std::chrono::time_point<std::chrono::steady_clock> startTime;
+
+        // Background sampling mode (ZEL_SYSTEM_RESOURCE_TRACKER_SAMPLE_INTERVAL_MS).
+        // A sampler thread reads /proc/self/status through a persistent fd and
+        // API epilogues only update counters and attach the latest sample.
+        bool backgroundSampling = false;
+        int statusFd = -1;
+        size_t fdLimit = 0;
+        std::chrono::milliseconds sampleInterval{0};
+        AtomicSystemResourceMetrics latestSample;
+        AtomicSystemResourceMetrics latestDelta;
+        std::atomic<size_t> peakRSS{0};  // KB, from getrusage
+        std::thread samplerThread;
+        std::mutex samplerMutex;
+        std::condition_variable samplerCondition;
+        bool samplerStop = false;
+
+        // Asynchronous output writer (ZEL_SYSTEM_RESOURCE_TRACKER_ASYNC_WRITER / _BINARY).
+        // API threads push fixed-size records into the ring and a writer thread
+        // drains them in batches, so no disk I/O happens on the calling thread.
+        bool asyncWriter = false;
+        bool binaryOutput = false;
+        std::unique_ptr<ResourceTrackerRing> outputRing;
+        std::thread writerThread;
+        std::mutex writerMutex;
+        std::condition_variable writerCondition;
+        bool writerStop = false;
         
         // Pre-call metrics storage for CommandListAppend operations
         std::unordered_map<std::thread::id, SystemResourceMetrics> appendCallPreMetrics;
@@ -160,10 +330,14 @@ namespace validation_layer
 
     // Forward declarations
     static SystemResourceMetrics getSystemResourceMetrics();
-    static void writeCsvData(const std::string& apiCall, const SystemResourceMetrics& current, const SystemResourceMetrics& delta, bool checkLeak);
+    static void writeCsvData(const char* apiCall, const SystemResourceMetrics& current, const SystemResourceMetrics& delta, bool checkLeak);
 
     // Helper function to read system resource metrics from /proc/self/status
     static SystemResourceMetrics getSystemResourceMetrics() {
+        if (getResourceTracker().backgroundSampling) {
+            return getResourceTracker().latestSample.load();
+        }
+
         SystemResourceMetrics metrics;
         
         std::ifstream statusFile("/proc/self/status");
@@ -208,49 +382,250 @@ namespace validation_layer
         return metrics;
     }
 
-    // Helper function to write CSV data with signed deltas (assumes mutex is already held by caller)
-    static void writeCsvData(const std::string& apiCall, const SystemResourceMetrics& current, const SystemResourceMetrics& delta, bool checkLeak = false) {
-        if (!getResourceTracker().csvEnabled || !getResourceTracker().csvFile || !getResourceTracker().csvFile->is_open()) {
-            context.logger->log_debug("writeCsvData skipped: csvEnabled=" + std::string(getResourceTracker().csvEnabled ? "true" : "false") + 
-                                     ", csvFile=" + std::string(getResourceTracker().csvFile ? "not-null" : "null") +
-                                     ", is_open=" + std::string((getResourceTracker().csvFile && getResourceTracker().csvFile->is_open()) ? "true" : "false") +
-                                     ", resourceTracker@" + std::to_string(reinterpret_cast<uintptr_t>(&getResourceTracker())));
+    // Parses the numeric value following key in a /proc/self/status buffer
+    static size_t parseStatusField(const char* buffer, const char* key) {
+        const char* field = strstr(buffer, key);
+        if (field == nullptr) {
+            return 0;
+        }
+        return static_cast<size_t>(strtoull(field + strlen(key), nullptr, 10));
+    }
+
+    // Reads process metrics on the sampler thread without allocating
+    static void sampleSystemResourceMetrics() {
+        auto& tracker = getResourceTracker();
+        char buffer[4096];
+        ssize_t bytes = pread(tracker.statusFd, buffer, sizeof(buffer) - 1, 0);
+        if (bytes <= 0) {
             return;
         }
-        context.logger->log_debug("writeCsvData writing: " + apiCall + ", resourceTracker@" + std::to_string(reinterpret_cast<uintptr_t>(&getResourceTracker())));
-        
-        auto now = std::chrono::steady_clock::now();
-        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - getResourceTracker().startTime).count();
-        
-        // Build the CSV line as a string first to ensure atomic write
-        std::ostringstream csvLine;
-        csvLine << getResourceTracker().callCounter << ","
-                << elapsed << ","
-                << apiCall << ","
-                << current.vmSize << ","
-                << current.vmRSS << ","
-                << current.vmData << ","
-                << current.vmPeak << ","
-                << current.numThreads << ","
-                << delta.vmSize << ","
-                << delta.vmRSS << ","
-                << delta.vmData << ","
-                << getResourceTracker().contextCount << ","
-                << getResourceTracker().commandQueueCount << ","
-                << getResourceTracker().moduleCount << ","
-                << getResourceTracker().kernelCount << ","
-                << getResourceTracker().eventPoolCount << ","
-                << getResourceTracker().commandListCount << ","
-                << getResourceTracker().eventCount << ","
-                << getResourceTracker().fenceCount << ","
-                << getResourceTracker().imageCount << ","
-                << getResourceTracker().samplerCount << ","
-                << getResourceTracker().totalMemoryAllocated << "\n";
-        
-        // Write the complete line atomically
-        (*getResourceTracker().csvFile) << csvLine.str();
-        getResourceTracker().csvFile->flush();
-        getResourceTracker().callCounter++;
+        buffer[bytes] = '\0';
+
+        SystemResourceMetrics metrics;
+        metrics.vmSize = parseStatusField(buffer, "VmSize:");
+        metrics.vmRSS = parseStatusField(buffer, "VmRSS:");
+        metrics.vmData = parseStatusField(buffer, "VmData:");
+        metrics.vmPeak = parseStatusField(buffer, "VmPeak:");
+        metrics.numThreads = parseStatusField(buffer, "Threads:");
+        metrics.numFDs = tracker.fdLimit;
+
+        // The first sample has no predecessor, so its delta stays zero
+        SystemResourceMetrics previous = tracker.latestSample.load();
+        tracker.latestDelta.store(previous.vmSize ? metrics - previous : SystemResourceMetrics());
+        tracker.latestSample.store(metrics);
+
+        struct rusage usage;
+        if (getrusage(RUSAGE_SELF, &usage) == 0) {
+            tracker.peakRSS.store(static_cast<size_t>(usage.ru_maxrss), std::memory_order_relaxed);
+        }
+    }
+
+    static void startBackgroundSampler(std::chrono::milliseconds interval) {
+        auto& tracker = getResourceTracker();
+        tracker.statusFd = open("/proc/self/status", O_RDONLY | O_CLOEXEC);
+        if (tracker.statusFd < 0) {
+            context.logger->log_error("System Resource Tracker failed to open /proc/self/status, background sampling disabled");
+            return;
+        }
+        struct rlimit rlim;
+        if (getrlimit(RLIMIT_NOFILE, &rlim) == 0) {
+            tracker.fdLimit = rlim.rlim_cur;
+        }
+        tracker.sampleInterval = interval;
+        sampleSystemResourceMetrics();
+        tracker.backgroundSampling = true;
+
+        tracker.samplerThread = std::thread([]() {
+            auto& tracker = getResourceTracker();
+            std::unique_lock<std::mutex> lock(tracker.samplerMutex);
+            while (!tracker.samplerCondition.wait_for(lock, tracker.sampleInterval, [&tracker]() { return tracker.samplerStop; })) {
+                sampleSystemResourceMetrics();
+            }
+        });
+        context.logger->log_info("System Resource Tracker background sampling enabled, interval=" + std::to_string(interval.count()) + "ms");
+    }
+
+    static void stopBackgroundSampler() {
+        auto& tracker = getResourceTracker();
+        if (tracker.samplerThread.joinable()) {
+            {
+                std::lock_guard<std::mutex> lock(tracker.samplerMutex);
+                tracker.samplerStop = true;
+            }
+            tracker.samplerCondition.notify_all();
+            tracker.samplerThread.join();
+        }
+        if (tracker.statusFd >= 0) {
+            close(tracker.statusFd);
+            tracker.statusFd = -1;
+        }
+    }
+
+    // Decrements a resource count without going below zero
+    static void decrementCount(std::atomic<size_t>& count) {
+        size_t current = count.load(std::memory_order_relaxed);
+        while (current > 0 && !count.compare_exchange_weak(current, current - 1, std::memory_order_relaxed)) {
+        }
+    }
+
+    // Formats a record as a CSV line matching the synchronous writer's columns
+    static void appendCsvRecord(std::string& batch, const ResourceTrackerRecord& record) {
+        char line[512];
+        int length = snprintf(line, sizeof(line),
+                              "%llu,%llu,%s,%llu,%llu,%llu,%llu,%llu,%llu,%llu,%llu,%llu,%llu,%llu,%llu,%llu,%llu,%llu,%llu,%llu,%llu,%llu\n",
+                              static_cast<unsigned long long>(record.callNumber), static_cast<unsigned long long>(record.timeMs), record.apiCall,
+                              static_cast<unsigned long long>(record.vmSize), static_cast<unsigned long long>(record.vmRSS),
+                              static_cast<unsigned long long>(record.vmData), static_cast<unsigned long long>(record.vmPeak),
+                              static_cast<unsigned long long>(record.numThreads), static_cast<unsigned long long>(record.deltaVmSize),
+                              static_cast<unsigned long long>(record.deltaVmRSS), static_cast<unsigned long long>(record.deltaVmData),
+                              static_cast<unsigned long long>(record.contexts), static_cast<unsigned long long>(record.commandQueues),
+                              static_cast<unsigned long long>(record.modules), static_cast<unsigned long long>(record.kernels),
+                              static_cast<unsigned long long>(record.eventPools), static_cast<unsigned long long>(record.commandLists),
+                              static_cast<unsigned long long>(record.events), static_cast<unsigned long long>(record.fences),
+                              static_cast<unsigned long long>(record.images), static_cast<unsigned long long>(record.samplers),
+                              static_cast<unsigned long long>(record.totalMemory));
+        if (length > 0) {
+            batch.append(line, std::min(static_cast<size_t>(length), sizeof(line) - 1));
+        }
+    }
+
+    // Drains the output ring into the file; only called from the writer thread
+    static void drainOutputRing(std::string& batch) {
+        auto& tracker = getResourceTracker();
+        ResourceTrackerRecord record;
+        batch.clear();
+        while (tracker.outputRing->pop(record)) {
+            if (tracker.binaryOutput) {
+                batch.append(reinterpret_cast<const char*>(&record), sizeof(record));
+            } else {
+                appendCsvRecord(batch, record);
+            }
+        }
+        if (!batch.empty()) {
+            tracker.csvFile->write(batch.data(), batch.size());
+            tracker.csvFile->flush();
+        }
+    }
+
+    static void startAsyncWriter(size_t bufferBytes) {
+        auto& tracker = getResourceTracker();
+        tracker.outputRing.reset(new ResourceTrackerRing(std::max<size_t>(bufferBytes / sizeof(ResourceTrackerRecord), 1)));
+        tracker.asyncWriter = true;
+
+        tracker.writerThread = std::thread([]() {
+            auto& tracker = getResourceTracker();
+            std::string batch;
+            std::unique_lock<std::mutex> lock(tracker.writerMutex);
+            while (!tracker.writerCondition.wait_for(lock, std::chrono::milliseconds(10), [&tracker]() { return tracker.writerStop; })) {
+                drainOutputRing(batch);
+            }
+            drainOutputRing(batch);
+        });
+        context.logger->log_info("System Resource Tracker asynchronous writer enabled, " + std::to_string(tracker.outputRing->getCapacity()) +
+                                 " records buffered, format=" + std::string(tracker.binaryOutput ? "binary" : "csv"));
+    }
+
+    static void stopAsyncWriter() {
+        auto& tracker = getResourceTracker();
+        if (!tracker.writerThread.joinable()) {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(tracker.writerMutex);
+            tracker.writerStop = true;
+        }
+        tracker.writerCondition.notify_all();
+        tracker.writerThread.join();
+        if (tracker.outputRing->getDropped() > 0) {
+            context.logger->log_warning("System Resource Tracker dropped " + std::to_string(tracker.outputRing->getDropped()) +
+                                        " records because the output buffer was full; increase ZEL_SYSTEM_RESOURCE_TRACKER_BUFFER_KB");
+        }
+    }
+
+    // Fills a fixed-size record for the asynchronous writer
+    static void fillRecord(ResourceTrackerRecord& record, const char* apiCall, const SystemResourceMetrics& current, const SystemResourceMetrics& delta) {
+        auto& tracker = getResourceTracker();
+        record.callNumber = tracker.callCounter.fetch_add(1, std::memory_order_relaxed);
+        record.timeMs = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - tracker.startTime).count();
+        record.vmSize = current.vmSize;
+        record.vmRSS = current.vmRSS;
+        record.vmData = current.vmData;
+        record.vmPeak = current.vmPeak;
+        record.numThreads = current.numThreads;
+        record.deltaVmSize = delta.vmSize;
+        record.deltaVmRSS = delta.vmRSS;
+        record.deltaVmData = delta.vmData;
+        record.contexts = tracker.contextCount.load(std::memory_order_relaxed);
+        record.commandQueues = tracker.commandQueueCount.load(std::memory_order_relaxed);
+        record.modules = tracker.moduleCount.load(std::memory_order_relaxed);
+        record.kernels = tracker.kernelCount.load(std::memory_order_relaxed);
+        record.eventPools = tracker.eventPoolCount.load(std::memory_order_relaxed);
+        record.commandLists = tracker.commandListCount.load(std::memory_order_relaxed);
+        record.events = tracker.eventCount.load(std::memory_order_relaxed);
+        record.fences = tracker.fenceCount.load(std::memory_order_relaxed);
+        record.images = tracker.imageCount.load(std::memory_order_relaxed);
+        record.samplers = tracker.samplerCount.load(std::memory_order_relaxed);
+        record.totalMemory = tracker.totalMemoryAllocated.load(std::memory_order_relaxed);
+        size_t nameLength = std::min(strlen(apiCall), sizeof(record.apiCall) - 1);
+        memcpy(record.apiCall, apiCall, nameLength);
+        memset(record.apiCall + nameLength, 0, sizeof(record.apiCall) - nameLength);
+    }
+
+    // Hands a record to the asynchronous writer without touching the file
+    static void enqueueRecord(const ResourceTrackerRecord& record) {
+        getResourceTracker().outputRing->push(record);
+    }
+
+    // Helper function to write CSV data with signed deltas (assumes mutex is already held by caller
+    // unless the asynchronous writer is enabled)
+    static void writeCsvData(const char* apiCall, const SystemResourceMetrics& current, const SystemResourceMetrics& delta, bool checkLeak = false) {
+        if (getResourceTracker().asyncWriter) {
+            ResourceTrackerRecord record;
+            fillRecord(record, apiCall, current, delta);
+            enqueueRecord(record);
+        } else {
+            if (!getResourceTracker().csvEnabled || !getResourceTracker().csvFile || !getResourceTracker().csvFile->is_open()) {
+                context.logger->log_debug("writeCsvData skipped: csvEnabled=" + std::string(getResourceTracker().csvEnabled ? "true" : "false") + 
+                                         ", csvFile=" + std::string(getResourceTracker().csvFile ? "not-null" : "null") +
+                                         ", is_open=" + std::string((getResourceTracker().csvFile && getResourceTracker().csvFile->is_open()) ? "true" : "false") +
+                                         ", resourceTracker@" + std::to_string(reinterpret_cast<uintptr_t>(&getResourceTracker())));
+                return;
+            }
+            context.logger->log_debug("writeCsvData writing: {}, resourceTracker@{}", apiCall, static_cast<const void*>(&getResourceTracker()));
+            
+            auto now = std::chrono::steady_clock::now();
+            auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - getResourceTracker().startTime).count();
+            
+            // Build the CSV line as a string first to ensure atomic write
+            std::ostringstream csvLine;
+            csvLine << getResourceTracker().callCounter << ","
+                    << elapsed << ","
+                    << apiCall << ","
+                    << current.vmSize << ","
+                    << current.vmRSS << ","
+                    << current.vmData << ","
+                    << current.vmPeak << ","
+                    << current.numThreads << ","
+                    << delta.vmSize << ","
+                    << delta.vmRSS << ","
+                    << delta.vmData << ","
+                    << getResourceTracker().contextCount << ","
+                    << getResourceTracker().commandQueueCount << ","
+                    << getResourceTracker().moduleCount << ","
+                    << getResourceTracker().kernelCount << ","
+                    << getResourceTracker().eventPoolCount << ","
+                    << getResourceTracker().commandListCount << ","
+                    << getResourceTracker().eventCount << ","
+                    << getResourceTracker().fenceCount << ","
+                    << getResourceTracker().imageCount << ","
+                    << getResourceTracker().samplerCount << ","
+                    << getResourceTracker().totalMemoryAllocated << "\n";
+            
+            // Write the complete line atomically
+            (*getResourceTracker().csvFile) << csvLine.str();
+            getResourceTracker().csvFile->flush();
+            getResourceTracker().callCounter++;
+        }
         
         // Check for memory leaks in Append operations
         if (checkLeak && (delta.vmRSS > 1024 || delta.vmSize > 1024)) {  // Leak threshold: 1MB
@@ -263,12 +638,26 @@ namespace validation_layer
 
     // Generic Prologue handler for Append operations
     static void handleAppendPrologue() {
+        if (getResourceTracker().backgroundSampling) {
+            return;
+        }
         std::lock_guard<std::mutex> lock(getResourceTracker().trackerMutex);
         getResourceTracker().appendCallPreMetrics[std::this_thread::get_id()] = getSystemResourceMetrics();
     }
 
     // Generic Epilogue handler for Append operations with leak detection
-    static void handleAppendEpilogue(const std::string& apiName, const std::string& additionalInfo = "") {
+    static void handleAppendEpilogue(const char* apiName, const std::string& additionalInfo = "") {
+        if (getResourceTracker().backgroundSampling) {
+            // Attach the latest background sample instead of measuring this call
+            if (getResourceTracker().asyncWriter) {
+                writeCsvData(apiName, getResourceTracker().latestSample.load(), getResourceTracker().latestDelta.load(), false);
+            } else if (getResourceTracker().csvEnabled) {
+                std::lock_guard<std::mutex> lock(getResourceTracker().trackerMutex);
+                writeCsvData(apiName, getResourceTracker().latestSample.load(), getResourceTracker().latestDelta.load(), false);
+            }
+            context.logger->log_debug("{}: {}", apiName, additionalInfo);
+            return;
+        }
         std::lock_guard<std::mutex> lock(getResourceTracker().trackerMutex);
         auto threadId = std::this_thread::get_id();
         auto preIt = getResourceTracker().appendCallPreMetrics.find(threadId);
@@ -302,6 +691,10 @@ namespace validation_layer
     // Helper function to detect leaks on destroy (assumes mutex is already held)
     static void checkForLeak(const std::string& resourceType, void* handle, 
                             const SystemResourceMetrics& creationMetrics, size_t& leakCounter) {
+        // Sampled metrics are not tied to individual calls, so per-handle deltas are meaningless
+        if (getResourceTracker().backgroundSampling) {
+            return;
+        }
         SystemResourceMetrics current = getSystemResourceMetrics();
         auto signedDelta = current.signedDiff(creationMetrics);
         
@@ -398,16 +791,34 @@ namespace validation_layer
             // Capture baseline metrics
             getResourceTracker().baseline = getSystemResourceMetrics();
             getResourceTracker().startTime = std::chrono::steady_clock::now();
+
+            // Optionally sample process metrics on a background thread instead of on every API call
+            auto sampleIntervalString = getenv_string("ZEL_SYSTEM_RESOURCE_TRACKER_SAMPLE_INTERVAL_MS");
+            if (!sampleIntervalString.empty()) {
+                auto sampleIntervalMs = strtoul(sampleIntervalString.c_str(), nullptr, 10);
+                if (sampleIntervalMs > 0) {
+                    startBackgroundSampler(std::chrono::milliseconds(sampleIntervalMs));
+                }
+            }
             context.logger->log_info("System Resource Tracker initialized with baseline metrics, resourceTracker@" + 
                                    std::to_string(reinterpret_cast<uintptr_t>(&getResourceTracker())));
             
-            // Check if CSV output is requested
+            // Check if CSV or binary output is requested; binary records get their own file
             const char* csvPath = getenv("ZEL_SYSTEM_RESOURCE_TRACKER_CSV");
-            if (csvPath && csvPath[0] != '\0') {
+            const char* binaryPath = getenv("ZEL_SYSTEM_RESOURCE_TRACKER_BINARY");
+            const char* outputPath = csvPath;
+            getResourceTracker().binaryOutput = binaryPath && binaryPath[0] != '\0';
+            if (getResourceTracker().binaryOutput) {
+                if (csvPath && csvPath[0] != '\0') {
+                    context.logger->log_warning("ZEL_SYSTEM_RESOURCE_TRACKER_BINARY is set, ZEL_SYSTEM_RESOURCE_TRACKER_CSV is ignored");
+                }
+                outputPath = binaryPath;
+            }
+            if (outputPath && outputPath[0] != '\0') {
                 try {
                     // Create unique filename per process by appending PID
                     pid_t pid = getpid();
-                    std::string uniquePath(csvPath);
+                    std::string uniquePath(outputPath);
                     
                     // Insert PID before file extension or at end
                     size_t dotPos = uniquePath.find_last_of('.');
@@ -417,16 +828,39 @@ namespace validation_layer
                         uniquePath += "_pid" + std::to_string(pid);
                     }
                     
+                    // Binary output is only produced by the asynchronous writer
+                    bool asyncWriter = getResourceTracker().binaryOutput || getenv_tobool("ZEL_SYSTEM_RESOURCE_TRACKER_ASYNC_WRITER");
+
                     // Allocate and open the file stream
-                    getResourceTracker().csvFile = new std::ofstream(uniquePath, std::ios::out | std::ios::trunc);
+                    std::ios::openmode mode = std::ios::out | std::ios::trunc;
+                    if (getResourceTracker().binaryOutput) {
+                        mode |= std::ios::binary;
+                    }
+                    getResourceTracker().csvFile = new std::ofstream(uniquePath, mode);
                     if (getResourceTracker().csvFile && getResourceTracker().csvFile->is_open() && getResourceTracker().csvFile->good()) {
                         getResourceTracker().csvEnabled = true;
-                        // Write CSV header
-                        (*getResourceTracker().csvFile) << "CallNumber,TimeMs,APICall,VmSize_KB,VmRSS_KB,VmData_KB,VmPeak_KB,Threads,"
-                                               << "Delta_VmSize_KB,Delta_VmRSS_KB,Delta_VmData_KB,"
-                                               << "Contexts,CommandQueues,Modules,Kernels,EventPools,CommandLists,"
-                                               << "Events,Fences,Images,Samplers,TotalMemory_Bytes\n";
+                        if (getResourceTracker().binaryOutput) {
+                            ResourceTrackerFileHeader header;
+                            memcpy(header.magic, resourceTrackerMagic, sizeof(header.magic));
+                            header.version = resourceTrackerVersion;
+                            header.recordSize = sizeof(ResourceTrackerRecord);
+                            getResourceTracker().csvFile->write(reinterpret_cast<const char*>(&header), sizeof(header));
+                        } else {
+                            // Write CSV header
+                            (*getResourceTracker().csvFile) << "CallNumber,TimeMs,APICall,VmSize_KB,VmRSS_KB,VmData_KB,VmPeak_KB,Threads,"
+                                                   << "Delta_VmSize_KB,Delta_VmRSS_KB,Delta_VmData_KB,"
+                                                   << "Contexts,CommandQueues,Modules,Kernels,EventPools,CommandLists,"
+                                                   << "Events,Fences,Images,Samplers,TotalMemory_Bytes\n";
+                        }
                         getResourceTracker().csvFile->flush();
+                        if (asyncWriter) {
+                            size_t bufferKB = 1024;
+                            auto bufferString = getenv_string("ZEL_SYSTEM_RESOURCE_TRACKER_BUFFER_KB");
+                            if (!bufferString.empty() && strtoul(bufferString.c_str(), nullptr, 10) > 0) {
+                                bufferKB = strtoul(bufferString.c_str(), nullptr, 10);
+                            }
+                            startAsyncWriter(bufferKB * 1024);
+                        }
                         context.logger->log_info("System Resource Tracker CSV output enabled: " + uniquePath + 
                                                " [csvEnabled=" + std::string(getResourceTracker().csvEnabled ? "true" : "false") + 
                                                ", ptr=" + std::to_string(reinterpret_cast<uintptr_t>(getResourceTracker().csvFile)) + "]");
@@ -448,6 +882,8 @@ namespace validation_layer
             system_resource_tracker_checker.zetValidation = zetChecker;
             system_resource_tracker_checker.zesValidation = zesChecker;
             context.logger->log_info("Registering system_resource_tracker_checker @ " + std::to_string(reinterpret_cast<uintptr_t>(&system_resource_tracker_checker)));
+            system_resource_tracker_checker.checkerName = "system_resource_tracker";
+            validation_layer::context.initSampleRate(system_resource_tracker_checker, "ZEL_SYSTEM_RESOURCE_TRACKER_CHECKER_SAMPLE_RATE");
             validation_layer::context.validationHandlers.push_back(&system_resource_tracker_checker);
             context.logger->log_info("system_resource_tracker_checker registered successfully");
         }
@@ -455,9 +891,15 @@ namespace validation_layer
 
     system_resource_trackerChecker::~system_resource_trackerChecker() {
         if(enablesystem_resource_tracker) {
+            stopBackgroundSampler();
+            stopAsyncWriter();
+
             // Log final leak summary
             std::ostringstream leakSummary;
             leakSummary << "\n=== MEMORY LEAK SUMMARY ===\n";
+            if (getResourceTracker().backgroundSampling) {
+                leakSummary << "  Peak RSS: " << getResourceTracker().peakRSS << " KB\n";
+            }
             bool hasLeaks = false;
             
             if (getResourceTracker().totalContextLeaks > 0) {
@@ -546,14 +988,15 @@ namespace validation_layer
                                                                           ze_context_handle_t *phContext, 
                                                                           ze_result_t result) {
         if (result == ZE_RESULT_SUCCESS && phContext && *phContext) {
-            {
+            getResourceTracker().contextCount++;
+            if (!getResourceTracker().backgroundSampling) {
                 std::lock_guard<std::mutex> lock(getResourceTracker().trackerMutex);
-                getResourceTracker().contextCount++;
                 // Store creation metrics for leak detection
                 getResourceTracker().contextMetrics[*phContext] = getSystemResourceMetrics();
             }
             std::ostringstream info;
             info << "Context Count=" << getResourceTracker().contextCount << ", handle=" << *phContext;
+            context.recordAllocationSite("zeContextCreate", phContext);
             handleAppendEpilogue("zeContextCreate", info.str());
             logResourceSummary();
         }
@@ -568,9 +1011,9 @@ namespace validation_layer
     ze_result_t system_resource_trackerChecker::ZEsystem_resource_trackerChecker::zeContextDestroyEpilogue(ze_context_handle_t hContext, 
                                                                            ze_result_t result) {
         if (result == ZE_RESULT_SUCCESS) {
-            {
+            decrementCount(getResourceTracker().contextCount);
+            if (!getResourceTracker().backgroundSampling) {
                 std::lock_guard<std::mutex> lock(getResourceTracker().trackerMutex);
-                if (getResourceTracker().contextCount > 0) getResourceTracker().contextCount--;
                 
                 // Check for leak
                 auto it = getResourceTracker().contextMetrics.find(hContext);
@@ -581,6 +1024,7 @@ namespace validation_layer
             }
             std::ostringstream info;
             info << "Context Count=" << getResourceTracker().contextCount << ", handle=" << hContext;
+            context.releaseAllocationSite(hContext);
             handleAppendEpilogue("zeContextDestroy", info.str());
             logResourceSummary();
         }
@@ -602,13 +1046,14 @@ namespace validation_layer
                                                                                ze_command_queue_handle_t *phCommandQueue, 
                                                                                ze_result_t result) {
         if (result == ZE_RESULT_SUCCESS && phCommandQueue && *phCommandQueue) {
-            {
+            getResourceTracker().commandQueueCount++;
+            if (!getResourceTracker().backgroundSampling) {
                 std::lock_guard<std::mutex> lock(getResourceTracker().trackerMutex);
-                getResourceTracker().commandQueueCount++;
                 getResourceTracker().commandQueueMetrics[*phCommandQueue] = getSystemResourceMetrics();
             }
             std::ostringstream info;
             info << "CommandQueue Count=" << getResourceTracker().commandQueueCount << ", handle=" << *phCommandQueue;
+            context.recordAllocationSite("zeCommandQueueCreate", phCommandQueue);
             handleAppendEpilogue("zeCommandQueueCreate", info.str());
             logResourceSummary();
         }
@@ -623,9 +1068,9 @@ namespace validation_layer
     ze_result_t system_resource_trackerChecker::ZEsystem_resource_trackerChecker::zeCommandQueueDestroyEpilogue(ze_command_queue_handle_t hCommandQueue, 
                                                                                 ze_result_t result) {
         if (result == ZE_RESULT_SUCCESS) {
-            {
+            decrementCount(getResourceTracker().commandQueueCount);
+            if (!getResourceTracker().backgroundSampling) {
                 std::lock_guard<std::mutex> lock(getResourceTracker().trackerMutex);
-                if (getResourceTracker().commandQueueCount > 0) getResourceTracker().commandQueueCount--;
                 
                 auto it = getResourceTracker().commandQueueMetrics.find(hCommandQueue);
                 if (it != getResourceTracker().commandQueueMetrics.end()) {
@@ -635,6 +1080,7 @@ namespace validation_layer
             }
             std::ostringstream info;
             info << "CommandQueue Count=" << getResourceTracker().commandQueueCount << ", handle=" << hCommandQueue;
+            context.releaseAllocationSite(hCommandQueue);
             handleAppendEpilogue("zeCommandQueueDestroy", info.str());
             logResourceSummary();
         }
@@ -658,13 +1104,14 @@ namespace validation_layer
                                                                          ze_module_build_log_handle_t *phBuildLog, 
                                                                          ze_result_t result) {
         if (result == ZE_RESULT_SUCCESS && phModule && *phModule) {
-            {
+            getResourceTracker().moduleCount++;
+            if (!getResourceTracker().backgroundSampling) {
                 std::lock_guard<std::mutex> lock(getResourceTracker().trackerMutex);
-                getResourceTracker().moduleCount++;
                 getResourceTracker().moduleMetrics[*phModule] = getSystemResourceMetrics();
             }
             std::ostringstream info;
             info << "Module Count=" << getResourceTracker().moduleCount << ", handle=" << *phModule;
+            context.recordAllocationSite("zeModuleCreate", phModule);
             handleAppendEpilogue("zeModuleCreate", info.str());
             logResourceSummary();
         }
@@ -679,9 +1126,9 @@ namespace validation_layer
     ze_result_t system_resource_trackerChecker::ZEsystem_resource_trackerChecker::zeModuleDestroyEpilogue(ze_module_handle_t hModule, 
                                                                           ze_result_t result) {
         if (result == ZE_RESULT_SUCCESS) {
-            {
+            decrementCount(getResourceTracker().moduleCount);
+            if (!getResourceTracker().backgroundSampling) {
                 std::lock_guard<std::mutex> lock(getResourceTracker().trackerMutex);
-                if (getResourceTracker().moduleCount > 0) getResourceTracker().moduleCount--;
                 
                 auto it = getResourceTracker().moduleMetrics.find(hModule);
                 if (it != getResourceTracker().moduleMetrics.end()) {
@@ -691,6 +1138,7 @@ namespace validation_layer
             }
             std::ostringstream info;
             info << "Module Count=" << getResourceTracker().moduleCount << ", handle=" << hModule;
+            context.releaseAllocationSite(hModule);
             handleAppendEpilogue("zeModuleDestroy", info.str());
             logResourceSummary();
         }
@@ -710,13 +1158,14 @@ namespace validation_layer
                                                                          ze_kernel_handle_t *phKernel, 
                                                                          ze_result_t result) {
         if (result == ZE_RESULT_SUCCESS && phKernel && *phKernel) {
-            {
+            getResourceTracker().kernelCount++;
+            if (!getResourceTracker().backgroundSampling) {
                 std::lock_guard<std::mutex> lock(getResourceTracker().trackerMutex);
-                getResourceTracker().kernelCount++;
                 getResourceTracker().kernelMetrics[*phKernel] = getSystemResourceMetrics();
             }
             std::ostringstream info;
             info << "Kernel Count=" << getResourceTracker().kernelCount << ", handle=" << *phKernel;
+            context.recordAllocationSite("zeKernelCreate", phKernel);
             handleAppendEpilogue("zeKernelCreate", info.str());
             logResourceSummary();
         }
@@ -731,9 +1180,9 @@ namespace validation_layer
     ze_result_t system_resource_trackerChecker::ZEsystem_resource_trackerChecker::zeKernelDestroyEpilogue(ze_kernel_handle_t hKernel, 
                                                                           ze_result_t result) {
         if (result == ZE_RESULT_SUCCESS) {
-            {
+            decrementCount(getResourceTracker().kernelCount);
+            if (!getResourceTracker().backgroundSampling) {
                 std::lock_guard<std::mutex> lock(getResourceTracker().trackerMutex);
-                if (getResourceTracker().kernelCount > 0) getResourceTracker().kernelCount--;
                 
                 auto it = getResourceTracker().kernelMetrics.find(hKernel);
                 if (it != getResourceTracker().kernelMetrics.end()) {
@@ -743,6 +1192,7 @@ namespace validation_layer
             }
             std::ostringstream info;
             info << "Kernel Count=" << getResourceTracker().kernelCount << ", handle=" << hKernel;
+            context.releaseAllocationSite(hKernel);
             handleAppendEpilogue("zeKernelDestroy", info.str());
             logResourceSummary();
         }
@@ -766,13 +1216,14 @@ namespace validation_layer
                                                                             ze_event_pool_handle_t *phEventPool, 
                                                                             ze_result_t result) {
         if (result == ZE_RESULT_SUCCESS && phEventPool && *phEventPool) {
-            {
+            getResourceTracker().eventPoolCount++;
+            if (!getResourceTracker().backgroundSampling) {
                 std::lock_guard<std::mutex> lock(getResourceTracker().trackerMutex);
-                getResourceTracker().eventPoolCount++;
                 getResourceTracker().eventPoolMetrics[*phEventPool] = getSystemResourceMetrics();
             }
             std::ostringstream info;
             info << "EventPool Count=" << getResourceTracker().eventPoolCount << ", handle=" << *phEventPool;
+            context.recordAllocationSite("zeEventPoolCreate", phEventPool);
             handleAppendEpilogue("zeEventPoolCreate", info.str());
             logResourceSummary();
         }
@@ -787,9 +1238,9 @@ namespace validation_layer
     ze_result_t system_resource_trackerChecker::ZEsystem_resource_trackerChecker::zeEventPoolDestroyEpilogue(ze_event_pool_handle_t hEventPool, 
                                                                              ze_result_t result) {
         if (result == ZE_RESULT_SUCCESS) {
-            {
+            decrementCount(getResourceTracker().eventPoolCount);
+            if (!getResourceTracker().backgroundSampling) {
                 std::lock_guard<std::mutex> lock(getResourceTracker().trackerMutex);
-                if (getResourceTracker().eventPoolCount > 0) getResourceTracker().eventPoolCount--;
                 
                 auto it = getResourceTracker().eventPoolMetrics.find(hEventPool);
                 if (it != getResourceTracker().eventPoolMetrics.end()) {
@@ -799,6 +1250,7 @@ namespace validation_layer
             }
             std::ostringstream info;
             info << "EventPool Count=" << getResourceTracker().eventPoolCount << ", handle=" << hEventPool;
+            context.releaseAllocationSite(hEventPool);
             handleAppendEpilogue("zeEventPoolDestroy", info.str());
             logResourceSummary();
         }
@@ -820,13 +1272,14 @@ namespace validation_layer
                                                                                        ze_command_list_handle_t *phCommandList, 
                                                                                        ze_result_t result) {
         if (result == ZE_RESULT_SUCCESS && phCommandList && *phCommandList) {
-            {
+            getResourceTracker().commandListCount++;
+            if (!getResourceTracker().backgroundSampling) {
                 std::lock_guard<std::mutex> lock(getResourceTracker().trackerMutex);
-                getResourceTracker().commandListCount++;
                 getResourceTracker().commandListMetrics[*phCommandList] = getSystemResourceMetrics();
             }
             std::ostringstream info;
             info << "CommandList Count=" << getResourceTracker().commandListCount << ", handle=" << *phCommandList;
+            context.recordAllocationSite("zeCommandListCreateImmediate", phCommandList);
             handleAppendEpilogue("zeCommandListCreateImmediate", info.str());
             logResourceSummary();
         }
@@ -847,13 +1300,14 @@ namespace validation_layer
                                                                               ze_command_list_handle_t *phCommandList, 
                                                                               ze_result_t result) {
         if (result == ZE_RESULT_SUCCESS && phCommandList && *phCommandList) {
-            {
+            getResourceTracker().commandListCount++;
+            if (!getResourceTracker().backgroundSampling) {
                 std::lock_guard<std::mutex> lock(getResourceTracker().trackerMutex);
-                getResourceTracker().commandListCount++;
                 getResourceTracker().commandListMetrics[*phCommandList] = getSystemResourceMetrics();
             }
             std::ostringstream info;
             info << "CommandList Count=" << getResourceTracker().commandListCount << ", handle=" << *phCommandList;
+            context.recordAllocationSite("zeCommandListCreate", phCommandList);
             handleAppendEpilogue("zeCommandListCreate", info.str());
             logResourceSummary();
         }
@@ -868,9 +1322,9 @@ namespace validation_layer
     ze_result_t system_resource_trackerChecker::ZEsystem_resource_trackerChecker::zeCommandListDestroyEpilogue(ze_command_list_handle_t hCommandList, 
                                                                                ze_result_t result) {
         if (result == ZE_RESULT_SUCCESS) {
-            {
+            decrementCount(getResourceTracker().commandListCount);
+            if (!getResourceTracker().backgroundSampling) {
                 std::lock_guard<std::mutex> lock(getResourceTracker().trackerMutex);
-                if (getResourceTracker().commandListCount > 0) getResourceTracker().commandListCount--;
                 
                 auto it = getResourceTracker().commandListMetrics.find(hCommandList);
                 if (it != getResourceTracker().commandListMetrics.end()) {
@@ -880,6 +1334,7 @@ namespace validation_layer
             }
             std::ostringstream info;
             info << "CommandList Count=" << getResourceTracker().commandListCount << ", handle=" << hCommandList;
+            context.releaseAllocationSite(hCommandList);
             handleAppendEpilogue("zeCommandListDestroy", info.str());
             logResourceSummary();
         }
@@ -899,13 +1354,14 @@ namespace validation_layer
                                                                         ze_event_handle_t *phEvent, 
                                                                         ze_result_t result) {
         if (result == ZE_RESULT_SUCCESS && phEvent && *phEvent) {
-            {
+            getResourceTracker().eventCount++;
+            if (!getResourceTracker().backgroundSampling) {
                 std::lock_guard<std::mutex> lock(getResourceTracker().trackerMutex);
-                getResourceTracker().eventCount++;
                 getResourceTracker().eventMetrics[*phEvent] = getSystemResourceMetrics();
             }
             std::ostringstream info;
             info << "Event Count=" << getResourceTracker().eventCount << ", handle=" << *phEvent;
+            context.recordAllocationSite("zeEventCreate", phEvent);
             handleAppendEpilogue("zeEventCreate", info.str());
             logResourceSummary();
         }
@@ -920,9 +1376,9 @@ namespace validation_layer
     ze_result_t system_resource_trackerChecker::ZEsystem_resource_trackerChecker::zeEventDestroyEpilogue(ze_event_handle_t hEvent, 
                                                                          ze_result_t result) {
         if (result == ZE_RESULT_SUCCESS) {
-            {
+            decrementCount(getResourceTracker().eventCount);
+            if (!getResourceTracker().backgroundSampling) {
                 std::lock_guard<std::mutex> lock(getResourceTracker().trackerMutex);
-                if (getResourceTracker().eventCount > 0) getResourceTracker().eventCount--;
                 
                 auto it = getResourceTracker().eventMetrics.find(hEvent);
                 if (it != getResourceTracker().eventMetrics.end()) {
@@ -932,6 +1388,7 @@ namespace validation_layer
             }
             std::ostringstream info;
             info << "Event Count=" << getResourceTracker().eventCount << ", handle=" << hEvent;
+            context.releaseAllocationSite(hEvent);
             handleAppendEpilogue("zeEventDestroy", info.str());
             logResourceSummary();
         }
@@ -951,13 +1408,14 @@ namespace validation_layer
                                                                         ze_fence_handle_t *phFence, 
                                                                         ze_result_t result) {
         if (result == ZE_RESULT_SUCCESS && phFence && *phFence) {
-            {
+            getResourceTracker().fenceCount++;
+            if (!getResourceTracker().backgroundSampling) {
                 std::lock_guard<std::mutex> lock(getResourceTracker().trackerMutex);
-                getResourceTracker().fenceCount++;
                 getResourceTracker().fenceMetrics[*phFence] = getSystemResourceMetrics();
             }
             std::ostringstream info;
             info << "Fence Count=" << getResourceTracker().fenceCount << ", handle=" << *phFence;
+            context.recordAllocationSite("zeFenceCreate", phFence);
             handleAppendEpilogue("zeFenceCreate", info.str());
             logResourceSummary();
         }
@@ -972,9 +1430,9 @@ namespace validation_layer
     ze_result_t system_resource_trackerChecker::ZEsystem_resource_trackerChecker::zeFenceDestroyEpilogue(ze_fence_handle_t hFence, 
                                                                          ze_result_t result) {
         if (result == ZE_RESULT_SUCCESS) {
-            {
+            decrementCount(getResourceTracker().fenceCount);
+            if (!getResourceTracker().backgroundSampling) {
                 std::lock_guard<std::mutex> lock(getResourceTracker().trackerMutex);
-                if (getResourceTracker().fenceCount > 0) getResourceTracker().fenceCount--;
                 
                 auto it = getResourceTracker().fenceMetrics.find(hFence);
                 if (it != getResourceTracker().fenceMetrics.end()) {
@@ -984,6 +1442,7 @@ namespace validation_layer
             }
             std::ostringstream info;
             info << "Fence Count=" << getResourceTracker().fenceCount << ", handle=" << hFence;
+            context.releaseAllocationSite(hFence);
             handleAppendEpilogue("zeFenceDestroy", info.str());
             logResourceSummary();
         }
@@ -1005,13 +1464,14 @@ namespace validation_layer
                                                                         ze_image_handle_t *phImage, 
                                                                         ze_result_t result) {
         if (result == ZE_RESULT_SUCCESS && phImage && *phImage) {
-            {
+            getResourceTracker().imageCount++;
+            if (!getResourceTracker().backgroundSampling) {
                 std::lock_guard<std::mutex> lock(getResourceTracker().trackerMutex);
-                getResourceTracker().imageCount++;
                 getResourceTracker().imageMetrics[*phImage] = getSystemResourceMetrics();
             }
             std::ostringstream info;
             info << "Image Count=" << getResourceTracker().imageCount << ", handle=" << *phImage;
+            context.recordAllocationSite("zeImageCreate", phImage);
             handleAppendEpilogue("zeImageCreate", info.str());
             logResourceSummary();
         }
@@ -1034,13 +1494,14 @@ namespace validation_layer
                                                                                ze_image_handle_t *phImageView, 
                                                                                ze_result_t result) {
         if (result == ZE_RESULT_SUCCESS && phImageView && *phImageView) {
-            {
+            getResourceTracker().imageCount++;
+            if (!getResourceTracker().backgroundSampling) {
                 std::lock_guard<std::mutex> lock(getResourceTracker().trackerMutex);
-                getResourceTracker().imageCount++;
                 getResourceTracker().imageMetrics[*phImageView] = getSystemResourceMetrics();
             }
             std::ostringstream info;
             info << "Image Count=" << getResourceTracker().imageCount << ", handle=" << *phImageView;
+            context.recordAllocationSite("zeImageViewCreateExt", phImageView);
             handleAppendEpilogue("zeImageViewCreateExt", info.str());
             logResourceSummary();
         }
@@ -1055,9 +1516,9 @@ namespace validation_layer
     ze_result_t system_resource_trackerChecker::ZEsystem_resource_trackerChecker::zeImageDestroyEpilogue(ze_image_handle_t hImage, 
                                                                          ze_result_t result) {
         if (result == ZE_RESULT_SUCCESS) {
-            {
+            decrementCount(getResourceTracker().imageCount);
+            if (!getResourceTracker().backgroundSampling) {
                 std::lock_guard<std::mutex> lock(getResourceTracker().trackerMutex);
-                if (getResourceTracker().imageCount > 0) getResourceTracker().imageCount--;
                 
                 auto it = getResourceTracker().imageMetrics.find(hImage);
                 if (it != getResourceTracker().imageMetrics.end()) {
@@ -1067,6 +1528,7 @@ namespace validation_layer
             }
             std::ostringstream info;
             info << "Image Count=" << getResourceTracker().imageCount << ", handle=" << hImage;
+            context.releaseAllocationSite(hImage);
             handleAppendEpilogue("zeImageDestroy", info.str());
             logResourceSummary();
         }
@@ -1088,13 +1550,14 @@ namespace validation_layer
                                                                           ze_sampler_handle_t *phSampler, 
                                                                           ze_result_t result) {
         if (result == ZE_RESULT_SUCCESS && phSampler && *phSampler) {
-            {
+            getResourceTracker().samplerCount++;
+            if (!getResourceTracker().backgroundSampling) {
                 std::lock_guard<std::mutex> lock(getResourceTracker().trackerMutex);
-                getResourceTracker().samplerCount++;
                 getResourceTracker().samplerMetrics[*phSampler] = getSystemResourceMetrics();
             }
             std::ostringstream info;
             info << "Sampler Count=" << getResourceTracker().samplerCount << ", handle=" << *phSampler;
+            context.recordAllocationSite("zeSamplerCreate", phSampler);
             handleAppendEpilogue("zeSamplerCreate", info.str());
             logResourceSummary();
         }
@@ -1109,9 +1572,9 @@ namespace validation_layer
     ze_result_t system_resource_trackerChecker::ZEsystem_resource_trackerChecker::zeSamplerDestroyEpilogue(ze_sampler_handle_t hSampler, 
                                                                            ze_result_t result) {
         if (result == ZE_RESULT_SUCCESS) {
-            {
+            decrementCount(getResourceTracker().samplerCount);
+            if (!getResourceTracker().backgroundSampling) {
                 std::lock_guard<std::mutex> lock(getResourceTracker().trackerMutex);
-                if (getResourceTracker().samplerCount > 0) getResourceTracker().samplerCount--;
                 
                 auto it = getResourceTracker().samplerMetrics.find(hSampler);
                 if (it != getResourceTracker().samplerMetrics.end()) {
@@ -1121,6 +1584,7 @@ namespace validation_layer
             }
             std::ostringstream info;
             info << "Sampler Count=" << getResourceTracker().samplerCount << ", handle=" << hSampler;
+            context.releaseAllocationSite(hSampler);
             handleAppendEpilogue("zeSamplerDestroy", info.str());
             logResourceSummary();
         }
@@ -1153,6 +1617,7 @@ namespace validation_layer
             }
             std::ostringstream info;
             info << "Size=" << size << " bytes (" << (size / 1024) << " KB), Total=" << getResourceTracker().totalMemoryAllocated << ", ptr=" << *pptr;
+            context.recordAllocationSite("zeMemAllocDevice", pptr);
             handleAppendEpilogue("zeMemAllocDevice", info.str());
             logResourceSummary();
         }
@@ -1182,6 +1647,7 @@ namespace validation_layer
             }
             std::ostringstream info;
             info << "Size=" << size << " bytes (" << (size / 1024) << " KB), Total=" << getResourceTracker().totalMemoryAllocated << ", ptr=" << *pptr;
+            context.recordAllocationSite("zeMemAllocHost", pptr);
             handleAppendEpilogue("zeMemAllocHost", info.str());
             logResourceSummary();
         }
@@ -1215,6 +1681,7 @@ namespace validation_layer
             }
             std::ostringstream info;
             info << "Size=" << size << " bytes (" << (size / 1024) << " KB), Total=" << getResourceTracker().totalMemoryAllocated << ", ptr=" << *pptr;
+            context.recordAllocationSite("zeMemAllocShared", pptr);
             handleAppendEpilogue("zeMemAllocShared", info.str());
             logResourceSummary();
         }
@@ -1245,6 +1712,7 @@ namespace validation_layer
             }
             std::ostringstream info;
             info << "Total Memory=" << getResourceTracker().totalMemoryAllocated << ", ptr=" << ptr;
+            context.releaseAllocationSite(ptr);
             handleAppendEpilogue("zeMemFree", info.str());
             logResourceSummary();
         }
@@ -1277,6 +1745,7 @@ namespace validation_layer
             }
             std::ostringstream info;
             info << "Total Memory=" << getResourceTracker().totalMemoryAllocated << ", ptr=" << ptr;
+            context.releaseAllocationSite(ptr);
             handleAppendEpilogue("zeMemFreeExt", info.str());
             logResourceSummary();
         }
@@ -23,6 +23,8 @@ namespace validation_layer
             templateChecker.zetValidation = zetChecker;
             templateChecker.zesValidation = zesChecker;
             templateChecker.zerValidation = zerChecker;
+            templateChecker.checkerName = "template";
+            validation_layer::context.getInstance().initSampleRate(templateChecker, "ZEL_VALIDATION_CHECKER_TEMPLATE_SAMPLE_RATE");
             validation_layer::context.getInstance().validationHandlers.push_back(&templateChecker);
         }
     }
@@ -0,0 +1,145 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file zel_usm_bounds_checker.cpp
+ *
+ */
+#include "zel_usm_bounds_checker.h"
+
+#include <algorithm>
+#include <mutex>
+
+namespace validation_layer
+{
+    class usm_boundsChecker usm_bounds_checker;
+
+    usm_boundsChecker::usm_boundsChecker() {
+        enableusm_bounds = getenv_tobool( "ZEL_ENABLE_USM_BOUNDS_CHECKER" );
+        if(enableusm_bounds) {
+            usm_boundsChecker::ZEusm_boundsChecker *zeChecker = new usm_boundsChecker::ZEusm_boundsChecker;
+            usm_boundsChecker::ZESusm_boundsChecker *zesChecker = new usm_boundsChecker::ZESusm_boundsChecker;
+            usm_boundsChecker::ZETusm_boundsChecker *zetChecker = new usm_boundsChecker::ZETusm_boundsChecker;
+            usm_boundsChecker::ZERusm_boundsChecker *zerChecker = new usm_boundsChecker::ZERusm_boundsChecker;
+            usm_bounds_checker.zeValidation = zeChecker;
+            usm_bounds_checker.zetValidation = zetChecker;
+            usm_bounds_checker.zesValidation = zesChecker;
+            usm_bounds_checker.zerValidation = zerChecker;
+            usm_bounds_checker.checkerName = "usm_bounds";
+            validation_layer::context.initSampleRate(usm_bounds_checker, "ZEL_USM_BOUNDS_CHECKER_SAMPLE_RATE");
+            validation_layer::context.validationHandlers.push_back(&usm_bounds_checker);
+        }
+    }
+
+    usm_boundsChecker::~usm_boundsChecker() {
+        if(enableusm_bounds) {
+            delete usm_bounds_checker.zeValidation;
+            delete usm_bounds_checker.zetValidation;
+            delete usm_bounds_checker.zesValidation;
+            delete usm_bounds_checker.zerValidation;
+        }
+    }
+
+    using ZEChecker = usm_boundsChecker::ZEusm_boundsChecker;
+
+    void ZEChecker::insertInterval(const void *ptr, size_t size) {
+        auto base = reinterpret_cast<uintptr_t>(ptr);
+        std::unique_lock<std::shared_timed_mutex> lock(intervalsMutex);
+        auto position = std::lower_bound(intervals.begin(), intervals.end(), base,
+            [](const liveInterval &interval, uintptr_t value) { return interval.base < value; });
+        // An address can be handed out again before the epilogue of its free has run
+        if (position != intervals.end() && position->base == base) {
+            position->size = size;
+            return;
+        }
+        intervals.insert(position, liveInterval{base, size});
+    }
+
+    void ZEChecker::eraseInterval(const void *ptr) {
+        auto base = reinterpret_cast<uintptr_t>(ptr);
+        std::unique_lock<std::shared_timed_mutex> lock(intervalsMutex);
+        auto position = std::lower_bound(intervals.begin(), intervals.end(), base,
+            [](const liveInterval &interval, uintptr_t value) { return interval.base < value; });
+        if (position != intervals.end() && position->base == base)
+            intervals.erase(position);
+    }
+
+    ze_result_t ZEChecker::checkRange(const char *apiName, const char *argName, const void *ptr, size_t size) {
+        auto start = reinterpret_cast<uintptr_t>(ptr);
+        if (ptr == nullptr || size == 0)
+            return ZE_RESULT_SUCCESS;
+        std::shared_lock<std::shared_timed_mutex> lock(intervalsMutex);
+        // Last interval with base <= start
+        auto position = std::upper_bound(intervals.begin(), intervals.end(), start,
+            [](uintptr_t value, const liveInterval &interval) { return value < interval.base; });
+        if (position == intervals.begin())
+            return ZE_RESULT_SUCCESS;
+        --position;
+        uintptr_t offset = start - position->base;
+        // Pointers outside every live allocation may be system memory, which is not tracked
+        if (offset >= position->size)
+            return ZE_RESULT_SUCCESS;
+        if (size <= position->size - offset)
+            return ZE_RESULT_SUCCESS;
+        auto base = position->base;
+        auto allocationSize = position->size;
+        lock.unlock();
+        context.reportFinding("usm_bounds", "range-overrun", findingSeverity::error,
+                              reinterpret_cast<const void *>(base), [&]() {
+            return fmt::format("{}: {} range [{:#x}, {:#x}) overruns allocation [{:#x}, {:#x}) by {} bytes",
+                               apiName, argName, start, start + size, base, base + allocationSize,
+                               size - (allocationSize - offset));
+        });
+        return ZE_RESULT_ERROR_INVALID_SIZE;
+    }
+
+    ze_result_t ZEChecker::zeMemAllocSharedEpilogue(ze_context_handle_t, const ze_device_mem_alloc_desc_t *, const ze_host_mem_alloc_desc_t *, size_t size, size_t, ze_device_handle_t, void **pptr, ze_result_t result) {
+        if (result == ZE_RESULT_SUCCESS && pptr && *pptr)
+            insertInterval(*pptr, size);
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t ZEChecker::zeMemAllocDeviceEpilogue(ze_context_handle_t, const ze_device_mem_alloc_desc_t *, size_t size, size_t, ze_device_handle_t, void **pptr, ze_result_t result) {
+        if (result == ZE_RESULT_SUCCESS && pptr && *pptr)
+            insertInterval(*pptr, size);
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t ZEChecker::zeMemAllocHostEpilogue(ze_context_handle_t, const ze_host_mem_alloc_desc_t *, size_t size, size_t, void **pptr, ze_result_t result) {
+        if (result == ZE_RESULT_SUCCESS && pptr && *pptr)
+            insertInterval(*pptr, size);
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t ZEChecker::zeMemFreeEpilogue(ze_context_handle_t, void *ptr, ze_result_t result) {
+        if (result == ZE_RESULT_SUCCESS && ptr)
+            eraseInterval(ptr);
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t ZEChecker::zeMemFreeExtEpilogue(ze_context_handle_t, const ze_memory_free_ext_desc_t *, void *ptr, ze_result_t result) {
+        if (result == ZE_RESULT_SUCCESS && ptr)
+            eraseInterval(ptr);
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t ZEChecker::zeCommandListAppendMemoryCopyPrologue(ze_command_list_handle_t, void *dstptr, const void *srcptr, size_t size, ze_event_handle_t, uint32_t, ze_event_handle_t *) {
+        auto result = checkRange("zeCommandListAppendMemoryCopy", "dstptr", dstptr, size);
+        if (result != ZE_RESULT_SUCCESS)
+            return result;
+        return checkRange("zeCommandListAppendMemoryCopy", "srcptr", srcptr, size);
+    }
+
+    ze_result_t ZEChecker::zeCommandListAppendMemoryFillPrologue(ze_command_list_handle_t, void *ptr, const void *, size_t, size_t size, ze_event_handle_t, uint32_t, ze_event_handle_t *) {
+        return checkRange("zeCommandListAppendMemoryFill", "ptr", ptr, size);
+    }
+
+    ze_result_t ZEChecker::zeCommandListAppendMemoryPrefetchPrologue(ze_command_list_handle_t, const void *ptr, size_t size) {
+        return checkRange("zeCommandListAppendMemoryPrefetch", "ptr", ptr, size);
+    }
+
+    ze_result_t ZEChecker::zeCommandListAppendMemAdvisePrologue(ze_command_list_handle_t, ze_device_handle_t, const void *ptr, size_t size, ze_memory_advice_t) {
+        return checkRange("zeCommandListAppendMemAdvise", "ptr", ptr, size);
+    }
+}
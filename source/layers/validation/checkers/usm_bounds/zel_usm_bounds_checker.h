@@ -0,0 +1,64 @@
+/*
+ *
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file zel_usm_bounds_checker.h
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <shared_mutex>
+#include <vector>
+
+#include "ze_api.h"
+#include "ze_validation_layer.h"
+
+namespace validation_layer
+{
+    // Rejects memory copy, fill, prefetch and advise ranges that start inside a
+    // live USM allocation but run past its end. Live allocations are kept in a
+    // sorted array of intervals keyed by base address, updated by the alloc and
+    // free epilogues, so each range check is a binary search under a shared lock.
+    class __zedlllocal usm_boundsChecker : public validationChecker{
+        public:
+            usm_boundsChecker();
+            ~usm_boundsChecker();
+
+            class ZEusm_boundsChecker : public ZEValidationEntryPoints {
+            public:
+                ze_result_t zeMemAllocSharedEpilogue(ze_context_handle_t hContext, const ze_device_mem_alloc_desc_t *device_desc, const ze_host_mem_alloc_desc_t *host_desc, size_t size, size_t alignment, ze_device_handle_t hDevice, void **pptr, ze_result_t result) override;
+                ze_result_t zeMemAllocDeviceEpilogue(ze_context_handle_t hContext, const ze_device_mem_alloc_desc_t *device_desc, size_t size, size_t alignment, ze_device_handle_t hDevice, void **pptr, ze_result_t result) override;
+                ze_result_t zeMemAllocHostEpilogue(ze_context_handle_t hContext, const ze_host_mem_alloc_desc_t *host_desc, size_t size, size_t alignment, void **pptr, ze_result_t result) override;
+                ze_result_t zeMemFreeEpilogue(ze_context_handle_t hContext, void *ptr, ze_result_t result) override;
+                ze_result_t zeMemFreeExtEpilogue(ze_context_handle_t hContext, const ze_memory_free_ext_desc_t *pMemFreeDesc, void *ptr, ze_result_t result) override;
+                ze_result_t zeCommandListAppendMemoryCopyPrologue(ze_command_list_handle_t hCommandList, void *dstptr, const void *srcptr, size_t size, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) override;
+                ze_result_t zeCommandListAppendMemoryFillPrologue(ze_command_list_handle_t hCommandList, void *ptr, const void *pattern, size_t pattern_size, size_t size, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) override;
+                ze_result_t zeCommandListAppendMemoryPrefetchPrologue(ze_command_list_handle_t hCommandList, const void *ptr, size_t size) override;
+                ze_result_t zeCommandListAppendMemAdvisePrologue(ze_command_list_handle_t hCommandList, ze_device_handle_t hDevice, const void *ptr, size_t size, ze_memory_advice_t advice) override;
+
+            private:
+                struct liveInterval {
+                    uintptr_t base;
+                    size_t size;
+                };
+
+                void insertInterval(const void *ptr, size_t size);
+                void eraseInterval(const void *ptr);
+                ze_result_t checkRange(const char *apiName, const char *argName, const void *ptr, size_t size);
+
+                // Sorted by base; readers take the lock shared
+                std::shared_timed_mutex intervalsMutex;
+                std::vector<liveInterval> intervals;
+            };
+
+            class ZESusm_boundsChecker : public ZESValidationEntryPoints {};
+            class ZETusm_boundsChecker : public ZETValidationEntryPoints {};
+            class ZERusm_boundsChecker : public ZERValidationEntryPoints {};
+            bool enableusm_bounds = false;
+    };
+    extern class usm_boundsChecker usm_bounds_checker;
+}
@@ -0,0 +1,466 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file zel_usm_profiler_checker.cpp
+ *
+ */
+#include "zel_usm_profiler_checker.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+#if defined(_WIN32)
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace validation_layer
+{
+    class usm_profilerChecker usm_profiler_checker;
+
+    usm_profilerChecker::usm_profilerChecker() {
+        enableusm_profiler = getenv_tobool( "ZEL_ENABLE_USM_PROFILER_CHECKER" );
+        if(enableusm_profiler) {
+            usm_profilerChecker::ZEusm_profilerChecker *zeChecker = new usm_profilerChecker::ZEusm_profilerChecker;
+            usm_profilerChecker::ZESusm_profilerChecker *zesChecker = new usm_profilerChecker::ZESusm_profilerChecker;
+            usm_profilerChecker::ZETusm_profilerChecker *zetChecker = new usm_profilerChecker::ZETusm_profilerChecker;
+            usm_profilerChecker::ZERusm_profilerChecker *zerChecker = new usm_profilerChecker::ZERusm_profilerChecker;
+            usm_profiler_checker.zeValidation = zeChecker;
+            usm_profiler_checker.zetValidation = zetChecker;
+            usm_profiler_checker.zesValidation = zesChecker;
+            usm_profiler_checker.zerValidation = zerChecker;
+            usm_profiler_checker.checkerName = "usm_profiler";
+            validation_layer::context.initSampleRate(usm_profiler_checker, "ZEL_USM_PROFILER_CHECKER_SAMPLE_RATE");
+            validation_layer::context.validationHandlers.push_back(&usm_profiler_checker);
+        }
+    }
+
+    usm_profilerChecker::~usm_profilerChecker() {
+        if(enableusm_profiler) {
+            delete usm_profiler_checker.zeValidation;
+            delete usm_profiler_checker.zetValidation;
+            delete usm_profiler_checker.zesValidation;
+            delete usm_profiler_checker.zerValidation;
+        }
+    }
+
+    using ZEChecker = usm_profilerChecker::ZEusm_profilerChecker;
+
+    static const char *allocationTypeNames[ZEChecker::allocationTypeCount] = {
+        "host",
+        "device",
+        "shared",
+    };
+
+    // Assumed allocation granularity used for the rounding waste estimate
+    static constexpr uint64_t hostGranularity = 4 * 1024;
+    static constexpr uint64_t deviceGranularity = 64 * 1024;
+    // Allocations living less than 2^20 ns (about 1ms) are reported as short-lived
+    static constexpr size_t shortLifetimeBucket = 20;
+
+    static uint64_t nowNs() {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    static size_t log2Bucket(uint64_t value) {
+        size_t bucket = 0;
+        while (value >>= 1)
+            bucket++;
+        return bucket;
+    }
+
+    template <typename T>
+    static void increment(std::atomic<T> &counter, T value = 1) {
+        counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    }
+
+    static std::string handleString(const void *handle) {
+        std::ostringstream out;
+        out << "\"" << handle << "\"";
+        return out.str();
+    }
+
+    ZEChecker::histogramBlock::histogramBlock(const profileKey &key) : key(key) {
+        allocations.store(0, std::memory_order_relaxed);
+        frees.store(0, std::memory_order_relaxed);
+        bytesAllocated.store(0, std::memory_order_relaxed);
+        roundingWasteBytes.store(0, std::memory_order_relaxed);
+        for (auto &count : sizes)
+            count.store(0, std::memory_order_relaxed);
+        for (auto &count : alignments)
+            count.store(0, std::memory_order_relaxed);
+        for (auto &count : lifetimes)
+            count.store(0, std::memory_order_relaxed);
+    }
+
+    void ZEChecker::histogramBlock::addTo(histogramBlock &target) const {
+        increment<uint64_t>(target.allocations, allocations.load(std::memory_order_relaxed));
+        increment<uint64_t>(target.frees, frees.load(std::memory_order_relaxed));
+        increment<uint64_t>(target.bytesAllocated, bytesAllocated.load(std::memory_order_relaxed));
+        increment<uint64_t>(target.roundingWasteBytes, roundingWasteBytes.load(std::memory_order_relaxed));
+        for (size_t i = 0; i < log2BucketCount; i++) {
+            increment<uint64_t>(target.sizes[i], sizes[i].load(std::memory_order_relaxed));
+            increment<uint64_t>(target.lifetimes[i], lifetimes[i].load(std::memory_order_relaxed));
+        }
+        for (size_t i = 0; i < alignmentBucketCount; i++)
+            increment<uint64_t>(target.alignments[i], alignments[i].load(std::memory_order_relaxed));
+    }
+
+    // Checker that thread state may still be folded into; cleared when it is
+    // destroyed so threads exiting afterwards leave its blocks alone
+    static std::atomic<ZEChecker *> liveProfiler{nullptr};
+
+    ZEChecker::ZEusm_profilerChecker() {
+        liveProfiler.store(this, std::memory_order_release);
+        auto path = getenv_string( "ZEL_USM_PROFILER_JSON" );
+        if (!path.empty()) {
+            // Unique filename per process, with the PID inserted before the extension
+#if defined(_WIN32)
+            auto pid = _getpid();
+#else
+            auto pid = getpid();
+#endif
+            size_t dotPos = path.find_last_of('.');
+            if (dotPos != std::string::npos) {
+                path.insert(dotPos, "_pid" + std::to_string(pid));
+            } else {
+                path += "_pid" + std::to_string(pid);
+            }
+            jsonPath = path;
+        }
+    }
+
+    ZEChecker::~ZEusm_profilerChecker() {
+        liveProfiler.store(nullptr, std::memory_order_release);
+        if (jsonPath.empty()) {
+            printSummary();
+            return;
+        }
+        std::ofstream out(jsonPath, std::ios::out | std::ios::trunc);
+        if (out.is_open()) {
+            out << buildJson();
+        } else {
+            std::cerr << "USM profiler: failed to open " << jsonPath << "\n";
+        }
+    }
+
+    // Per-thread lookup tables, so the hot path takes no lock once a thread has
+    // seen a key and a device. Blocks are owned by allBlocks and device usage by
+    // devices, which is never pruned, so cached pointers stay valid.
+    struct ZEChecker::threadState {
+        ZEusm_profilerChecker *checker = nullptr;
+        std::unordered_map<profileKey, histogramBlock *, profileKeyHash> blocks;
+        std::unordered_map<ze_device_handle_t, deviceUsage *> devices;
+        ~threadState();
+    };
+
+    ZEChecker::threadState::~threadState() {
+        if (checker && liveProfiler.load(std::memory_order_acquire) == checker)
+            checker->retireThreadState(*this);
+    }
+
+    ZEChecker::threadState &ZEChecker::getThreadState() {
+        static thread_local threadState state;
+        if (state.checker != this) {
+            state.blocks.clear();
+            state.devices.clear();
+            state.checker = this;
+        }
+        return state;
+    }
+
+    void ZEChecker::retireThreadState(threadState &state) {
+        std::lock_guard<std::mutex> lock(blocksMutex);
+        for (auto &entry : state.blocks) {
+            auto &retired = retiredBlocks[entry.first];
+            if (!retired)
+                retired.reset(new histogramBlock(entry.first));
+            entry.second->addTo(*retired);
+            auto owned = std::find_if(allBlocks.begin(), allBlocks.end(), [&](const std::unique_ptr<histogramBlock> &block) {
+                return block.get() == entry.second;
+            });
+            if (owned != allBlocks.end()) {
+                *owned = std::move(allBlocks.back());
+                allBlocks.pop_back();
+            }
+        }
+        state.blocks.clear();
+    }
+
+    ZEChecker::histogramBlock &ZEChecker::getThreadBlock(const profileKey &key) {
+        auto &blocks = getThreadState().blocks;
+        auto block = blocks.find(key);
+        if (block != blocks.end())
+            return *block->second;
+        std::lock_guard<std::mutex> lock(blocksMutex);
+        allBlocks.emplace_back(new histogramBlock(key));
+        blocks[key] = allBlocks.back().get();
+        return *allBlocks.back();
+    }
+
+    ZEChecker::deviceUsage *ZEChecker::getDeviceUsage(ze_device_handle_t hDevice) {
+        auto &cache = getThreadState().devices;
+        auto cached = cache.find(hDevice);
+        if (cached != cache.end())
+            return cached->second;
+        std::lock_guard<std::mutex> lock(devicesMutex);
+        auto &usage = devices[hDevice];
+        if (!usage)
+            usage.reset(new deviceUsage);
+        cache[hDevice] = usage.get();
+        return usage.get();
+    }
+
+    ZEChecker::liveShard &ZEChecker::getShard(void *ptr) {
+        // Allocations are at least 64 byte aligned in practice, skip the low bits
+        return liveShards[(reinterpret_cast<uintptr_t>(ptr) >> 6) % liveShardCount];
+    }
+
+    void ZEChecker::recordAllocation(ze_context_handle_t hContext, ze_device_handle_t hDevice, allocationType type, size_t size, size_t alignment, void *ptr) {
+        profileKey key = {hContext, hDevice, type};
+        auto &block = getThreadBlock(key);
+        increment(block.allocations);
+        increment<uint64_t>(block.bytesAllocated, size);
+        increment(block.sizes[log2Bucket(size)]);
+        increment(block.alignments[alignment ? log2Bucket(alignment) + 1 : 0]);
+        uint64_t granularity = (type == hostAllocation) ? hostGranularity : deviceGranularity;
+        uint64_t rounded = ((static_cast<uint64_t>(size) + granularity - 1) / granularity) * granularity;
+        increment<uint64_t>(block.roundingWasteBytes, rounded - size);
+
+        auto usage = getDeviceUsage(hDevice);
+        int64_t live = usage->liveBytes.fetch_add(static_cast<int64_t>(size), std::memory_order_relaxed) + static_cast<int64_t>(size);
+        int64_t peak = usage->peakLiveBytes.load(std::memory_order_relaxed);
+        while (live > peak && !usage->peakLiveBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+        }
+
+        auto &shard = getShard(ptr);
+        std::lock_guard<std::mutex> lock(shard.shardMutex);
+        shard.allocations[ptr] = liveAllocation{key, size, nowNs(), usage};
+    }
+
+    void ZEChecker::recordFree(void *ptr) {
+        liveAllocation allocation;
+        {
+            auto &shard = getShard(ptr);
+            std::lock_guard<std::mutex> lock(shard.shardMutex);
+            auto found = shard.allocations.find(ptr);
+            if (found == shard.allocations.end())
+                return;
+            allocation = found->second;
+            shard.allocations.erase(found);
+        }
+        allocation.usage->liveBytes.fetch_sub(static_cast<int64_t>(allocation.size), std::memory_order_relaxed);
+
+        // Counted against the freeing thread's block for the allocation's key
+        auto &block = getThreadBlock(allocation.key);
+        increment(block.frees);
+        increment(block.lifetimes[log2Bucket(nowNs() - allocation.allocatedAtNs)]);
+    }
+
+    ze_result_t ZEChecker::zeMemAllocSharedEpilogue(ze_context_handle_t hContext, const ze_device_mem_alloc_desc_t *, const ze_host_mem_alloc_desc_t *, size_t size, size_t alignment, ze_device_handle_t hDevice, void **pptr, ze_result_t result) {
+        if (result == ZE_RESULT_SUCCESS && pptr && *pptr)
+            recordAllocation(hContext, hDevice, sharedAllocation, size, alignment, *pptr);
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t ZEChecker::zeMemAllocDeviceEpilogue(ze_context_handle_t hContext, const ze_device_mem_alloc_desc_t *, size_t size, size_t alignment, ze_device_handle_t hDevice, void **pptr, ze_result_t result) {
+        if (result == ZE_RESULT_SUCCESS && pptr && *pptr)
+            recordAllocation(hContext, hDevice, deviceAllocation, size, alignment, *pptr);
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t ZEChecker::zeMemAllocHostEpilogue(ze_context_handle_t hContext, const ze_host_mem_alloc_desc_t *, size_t size, size_t alignment, void **pptr, ze_result_t result) {
+        if (result == ZE_RESULT_SUCCESS && pptr && *pptr)
+            recordAllocation(hContext, nullptr, hostAllocation, size, alignment, *pptr);
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t ZEChecker::zeMemFreeEpilogue(ze_context_handle_t, void *ptr, ze_result_t result) {
+        if (result == ZE_RESULT_SUCCESS && ptr)
+            recordFree(ptr);
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t ZEChecker::zeMemFreeExtEpilogue(ze_context_handle_t, const ze_memory_free_ext_desc_t *, void *ptr, ze_result_t result) {
+        if (result == ZE_RESULT_SUCCESS && ptr)
+            recordFree(ptr);
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Merged view of all thread blocks for one key, only built at exit
+    namespace
+    {
+        struct mergedProfile {
+            uint64_t allocations = 0;
+            uint64_t frees = 0;
+            uint64_t bytesAllocated = 0;
+            uint64_t roundingWasteBytes = 0;
+            uint64_t sizes[64] = {};
+            uint64_t alignments[65] = {};
+            uint64_t lifetimes[64] = {};
+        };
+    }
+
+    template <typename Block, typename Merged>
+    static void mergeBlock(const Block &block, Merged &merged) {
+        auto &profile = merged[block.key];
+        profile.allocations += block.allocations.load(std::memory_order_relaxed);
+        profile.frees += block.frees.load(std::memory_order_relaxed);
+        profile.bytesAllocated += block.bytesAllocated.load(std::memory_order_relaxed);
+        profile.roundingWasteBytes += block.roundingWasteBytes.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < 64; i++) {
+            profile.sizes[i] += block.sizes[i].load(std::memory_order_relaxed);
+            profile.lifetimes[i] += block.lifetimes[i].load(std::memory_order_relaxed);
+        }
+        for (size_t i = 0; i < 65; i++)
+            profile.alignments[i] += block.alignments[i].load(std::memory_order_relaxed);
+    }
+
+    static void appendHistogram(std::ostringstream &out, const uint64_t *buckets, size_t count, bool alignment) {
+        // Keys are the lower bound of each non-empty bucket
+        out << "{";
+        bool first = true;
+        for (size_t i = 0; i < count; i++) {
+            if (!buckets[i])
+                continue;
+            uint64_t lowerBound = alignment ? (i ? (1ull << (i - 1)) : 0) : (i ? (1ull << i) : 0);
+            out << (first ? "" : ", ") << "\"" << lowerBound << "\": " << buckets[i];
+            first = false;
+        }
+        out << "}";
+    }
+
+    template <typename Merged>
+    static std::vector<std::string> buildHints(const Merged &merged) {
+        std::vector<std::string> hints;
+        for (auto &entry : merged) {
+            auto &profile = entry.second;
+            const char *typeName = allocationTypeNames[entry.first.type];
+            uint64_t small = 0;
+            size_t sizeClasses = 0;
+            for (size_t i = 0; i < 64; i++) {
+                if (i < 16)
+                    small += profile.sizes[i];
+                if (profile.sizes[i])
+                    sizeClasses++;
+            }
+            if (profile.allocations >= 16 && small * 2 > profile.allocations) {
+                std::ostringstream hint;
+                hint << (small * 100 / profile.allocations) << "% of " << typeName << " allocations on device "
+                     << entry.first.hDevice << " are smaller than 64KB; sub-allocating them from a pool would avoid an estimated "
+                     << profile.roundingWasteBytes << " bytes of rounding";
+                hints.push_back(hint.str());
+            }
+            uint64_t shortLived = 0;
+            for (size_t i = 0; i < shortLifetimeBucket; i++)
+                shortLived += profile.lifetimes[i];
+            if (profile.frees >= 16 && shortLived * 2 > profile.frees) {
+                std::ostringstream hint;
+                hint << (shortLived * 100 / profile.frees) << "% of freed " << typeName << " allocations on device "
+                     << entry.first.hDevice << " lived less than 1ms; a caching allocator would avoid the allocate/free round trips";
+                hints.push_back(hint.str());
+            }
+            if (sizeClasses >= 8) {
+                std::ostringstream hint;
+                hint << typeName << " allocations on device " << entry.first.hDevice << " span " << sizeClasses
+                     << " power-of-two size classes; a single pool for all of them is likely to fragment";
+                hints.push_back(hint.str());
+            }
+        }
+        return hints;
+    }
+
+    std::string ZEChecker::buildJson() {
+        std::map<profileKey, mergedProfile> merged;
+        {
+            std::lock_guard<std::mutex> lock(blocksMutex);
+            for (auto &block : allBlocks)
+                mergeBlock(*block, merged);
+            for (auto &retired : retiredBlocks)
+                mergeBlock(*retired.second, merged);
+        }
+#if defined(_WIN32)
+        auto pid = _getpid();
+#else
+        auto pid = getpid();
+#endif
+        std::ostringstream out;
+        out << "{\n  \"pid\": " << pid << ",\n  \"profiles\": [";
+        bool first = true;
+        for (auto &entry : merged) {
+            auto &profile = entry.second;
+            out << (first ? "\n" : ",\n") << "    {\"context\": " << handleString(entry.first.hContext)
+                << ", \"device\": " << handleString(entry.first.hDevice)
+                << ", \"type\": \"" << allocationTypeNames[entry.first.type] << "\""
+                << ", \"allocations\": " << profile.allocations
+                << ", \"frees\": " << profile.frees
+                << ", \"bytes_allocated\": " << profile.bytesAllocated
+                << ", \"rounding_waste_bytes\": " << profile.roundingWasteBytes
+                << ",\n     \"size_histogram\": ";
+            appendHistogram(out, profile.sizes, 64, false);
+            out << ",\n     \"alignment_histogram\": ";
+            appendHistogram(out, profile.alignments, 65, true);
+            out << ",\n     \"lifetime_ns_histogram\": ";
+            appendHistogram(out, profile.lifetimes, 64, false);
+            out << "}";
+            first = false;
+        }
+        out << "\n  ],\n  \"devices\": [";
+        first = true;
+        {
+            std::lock_guard<std::mutex> lock(devicesMutex);
+            for (auto &device : devices) {
+                out << (first ? "\n" : ",\n") << "    {\"device\": " << handleString(device.first)
+                    << ", \"live_bytes\": " << device.second->liveBytes.load(std::memory_order_relaxed)
+                    << ", \"peak_live_bytes\": " << device.second->peakLiveBytes.load(std::memory_order_relaxed) << "}";
+                first = false;
+            }
+        }
+        out << "\n  ],\n  \"hints\": [";
+        first = true;
+        for (auto &hint : buildHints(merged)) {
+            out << (first ? "\n" : ",\n") << "    \"" << hint << "\"";
+            first = false;
+        }
+        out << "\n  ]\n}\n";
+        return out.str();
+    }
+
+    void ZEChecker::printSummary() {
+        std::map<profileKey, mergedProfile> merged;
+        {
+            std::lock_guard<std::mutex> lock(blocksMutex);
+            for (auto &block : allBlocks)
+                mergeBlock(*block, merged);
+            for (auto &retired : retiredBlocks)
+                mergeBlock(*retired.second, merged);
+        }
+        std::cerr << "USM allocation profile\n";
+        std::cerr << "----------------------------------------------------------\n";
+        for (auto &entry : merged) {
+            auto &profile = entry.second;
+            std::cerr << allocationTypeNames[entry.first.type] << " allocations, context " << entry.first.hContext
+                      << ", device " << entry.first.hDevice << ": " << profile.allocations << " allocations, "
+                      << profile.frees << " frees, " << profile.bytesAllocated << " bytes\n";
+        }
+        {
+            std::lock_guard<std::mutex> lock(devicesMutex);
+            for (auto &device : devices) {
+                std::cerr << "device " << device.first << ": peak live bytes "
+                          << device.second->peakLiveBytes.load(std::memory_order_relaxed) << ", live at exit "
+                          << device.second->liveBytes.load(std::memory_order_relaxed) << "\n";
+            }
+        }
+        for (auto &hint : buildHints(merged))
+            std::cerr << "hint: " << hint << "\n";
+        std::cerr << "Set ZEL_USM_PROFILER_JSON to export the size, alignment and lifetime histograms\n";
+    }
+}
@@ -0,0 +1,151 @@
+/*
+ *
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file zel_usm_profiler_checker.h
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ze_api.h"
+#include "ze_validation_layer.h"
+
+namespace validation_layer
+{
+    // Profiles the distribution of zeMemAllocHost/Device/Shared calls per
+    // context, device and allocation type: log2 size, alignment and lifetime
+    // histograms, peak live bytes per device and fragmentation hints.
+    // Histograms are counted in per-thread blocks that are only merged at exit,
+    // when the profile is printed or exported as JSON.
+    class __zedlllocal usm_profilerChecker : public validationChecker{
+        public:
+            usm_profilerChecker();
+            ~usm_profilerChecker();
+
+            class ZEusm_profilerChecker : public ZEValidationEntryPoints {
+            public:
+                ZEusm_profilerChecker();
+                ~ZEusm_profilerChecker();
+
+                ze_result_t zeMemAllocSharedEpilogue(ze_context_handle_t hContext, const ze_device_mem_alloc_desc_t *device_desc, const ze_host_mem_alloc_desc_t *host_desc, size_t size, size_t alignment, ze_device_handle_t hDevice, void **pptr, ze_result_t result) override;
+                ze_result_t zeMemAllocDeviceEpilogue(ze_context_handle_t hContext, const ze_device_mem_alloc_desc_t *device_desc, size_t size, size_t alignment, ze_device_handle_t hDevice, void **pptr, ze_result_t result) override;
+                ze_result_t zeMemAllocHostEpilogue(ze_context_handle_t hContext, const ze_host_mem_alloc_desc_t *host_desc, size_t size, size_t alignment, void **pptr, ze_result_t result) override;
+                ze_result_t zeMemFreeEpilogue(ze_context_handle_t hContext, void *ptr, ze_result_t result) override;
+                ze_result_t zeMemFreeExtEpilogue(ze_context_handle_t hContext, const ze_memory_free_ext_desc_t *pMemFreeDesc, void *ptr, ze_result_t result) override;
+
+                enum allocationType : uint32_t {
+                    hostAllocation,
+                    deviceAllocation,
+                    sharedAllocation,
+                    allocationTypeCount
+                };
+
+            private:
+                static constexpr size_t log2BucketCount = 64;
+                // Bucket 0 holds the default (zero) alignment, bucket i + 1 alignment 2^i
+                static constexpr size_t alignmentBucketCount = log2BucketCount + 1;
+
+                struct profileKey {
+                    ze_context_handle_t hContext;
+                    ze_device_handle_t hDevice;
+                    allocationType type;
+                    bool operator==(const profileKey &other) const {
+                        return hContext == other.hContext && hDevice == other.hDevice && type == other.type;
+                    }
+                    bool operator<(const profileKey &other) const {
+                        if (hContext != other.hContext)
+                            return hContext < other.hContext;
+                        if (hDevice != other.hDevice)
+                            return hDevice < other.hDevice;
+                        return type < other.type;
+                    }
+                };
+                struct profileKeyHash {
+                    size_t operator()(const profileKey &key) const {
+                        return std::hash<const void *>()(key.hContext) ^
+                               (std::hash<const void *>()(key.hDevice) << 1) ^
+                               static_cast<size_t>(key.type);
+                    }
+                };
+
+                // Histograms for one key written by a single thread. Only the owning
+                // thread writes, so updates are a relaxed load/store, and the
+                // trailing padding keeps neighbouring blocks off the same cache line.
+                struct histogramBlock {
+                    profileKey key;
+                    std::atomic<uint64_t> allocations;
+                    std::atomic<uint64_t> frees;
+                    std::atomic<uint64_t> bytesAllocated;
+                    std::atomic<uint64_t> roundingWasteBytes;
+                    std::atomic<uint64_t> sizes[log2BucketCount];
+                    std::atomic<uint64_t> alignments[alignmentBucketCount];
+                    std::atomic<uint64_t> lifetimes[log2BucketCount];
+                    char padding[64];
+                    explicit histogramBlock(const profileKey &key);
+                    // Adds this block's counts to target, which no thread is writing
+                    void addTo(histogramBlock &target) const;
+                };
+
+                // Live bytes per device, shared by all threads
+                struct deviceUsage {
+                    std::atomic<int64_t> liveBytes{0};
+                    std::atomic<int64_t> peakLiveBytes{0};
+                };
+
+                // Allocation being tracked until it is freed
+                struct liveAllocation {
+                    profileKey key;
+                    size_t size;
+                    uint64_t allocatedAtNs;
+                    deviceUsage *usage;
+                };
+                static constexpr size_t liveShardCount = 64;
+                struct liveShard {
+                    std::mutex shardMutex;
+                    std::unordered_map<void *, liveAllocation> allocations;
+                    char padding[64];
+                };
+
+                void recordAllocation(ze_context_handle_t hContext, ze_device_handle_t hDevice, allocationType type, size_t size, size_t alignment, void *ptr);
+                void recordFree(void *ptr);
+                struct threadState;
+                threadState &getThreadState();
+                void retireThreadState(threadState &state);
+                histogramBlock &getThreadBlock(const profileKey &key);
+                deviceUsage *getDeviceUsage(ze_device_handle_t hDevice);
+                liveShard &getShard(void *ptr);
+                std::string buildJson();
+                void printSummary();
+
+                std::mutex blocksMutex;
+                std::vector<std::unique_ptr<histogramBlock>> allBlocks;
+                // Blocks of threads that have exited, folded together per key
+                std::map<profileKey, std::unique_ptr<histogramBlock>> retiredBlocks;
+
+                std::mutex devicesMutex;
+                std::map<ze_device_handle_t, std::unique_ptr<deviceUsage>> devices;
+
+                liveShard liveShards[liveShardCount];
+
+                std::string jsonPath;
+            };
+
+            class ZESusm_profilerChecker : public ZESValidationEntryPoints {};
+            class ZETusm_profilerChecker : public ZETValidationEntryPoints {};
+            class ZERusm_profilerChecker : public ZERValidationEntryPoints {};
+            bool enableusm_profiler = false;
+    };
+    extern class usm_profilerChecker usm_profiler_checker;
+}
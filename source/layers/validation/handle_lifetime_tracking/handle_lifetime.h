@@ -11,6 +11,7 @@
 #include "zes_handle_lifetime.h"
 #include "zet_handle_lifetime.h"
 #include "zer_handle_lifetime.h"
+#include "handle_shadow.h"
 #include <memory>
 #include <type_traits>
 #include <unordered_map>
@@ -18,10 +19,6 @@
 
 namespace validation_layer {
 
-typedef struct _zel_handle_state_t {
-  bool is_open;
-} zel_handle_state_t;
-
 class HandleLifetimeValidation {
 public:
   ZEHandleLifetimeValidation zeHandleLifetime;
@@ -29,20 +26,30 @@ public:
   ZETHandleLifetimeValidation zetHandleLifetime;
   ZERHandleLifetimeValidation zerHandleLifetime;
 
+  void enableShadowHandles() {
+    shadowHandles = std::make_unique<HandleShadowTable>();
+  }
+
   // default methods
   template <class T> void addHandle(T handle) {
     // TODO : Log warning
     untrackedHandles++;
+    if (shadowHandles)
+      return shadowHandles->add(handle);
     defaultHandleStateMap.insert({static_cast<void *>(handle), nullptr});
   }
 
   template <class T> void removeHandle(T handle) {
     // TODO: Log warning
     untrackedHandles--;
+    if (shadowHandles)
+      return shadowHandles->remove(handle);
     defaultHandleStateMap.erase(static_cast<void *>(handle));
   }
 
   template <class T> bool isHandleValid(T handle) {
+    if (shadowHandles)
+      return shadowHandles->isValid(handle);
     return defaultHandleStateMap.find(static_cast<void *>(handle)) !=
            defaultHandleStateMap.end();
   }
@@ -58,53 +65,85 @@ public:
   }
 
   void addHandle(ze_context_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->add(handle);
     contextHandleStateMap.insert({handle, nullptr});
   }
   void addHandle(ze_driver_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->add(handle);
     driverHandleStateMap.insert({handle, nullptr});
   }
   void addHandle(ze_device_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->add(handle);
     deviceHandleStateMap.insert({handle, nullptr});
   }
   void addHandle(ze_command_queue_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->add(handle);
     commandQueueHandleStateMap.insert({handle, nullptr});
   }
   void addHandle(ze_command_list_handle_t handle, bool is_open = true) {
+    if (shadowHandles)
+      return shadowHandles->add(handle, is_open);
     commandListHandleStateMap.insert(
         {handle, std::make_unique<zel_handle_state_t>()});
     commandListHandleStateMap[handle]->is_open = is_open;
   }
   void addHandle(ze_fence_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->add(handle);
     fenceHandleStateMap.insert({handle, nullptr});
   }
   void addHandle(ze_event_pool_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->add(handle);
     eventPoolHandleStateMap.insert({handle, nullptr});
   }
   void addHandle(ze_event_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->add(handle);
     eventHandleStateMap.insert({handle, nullptr});
   }
   void addHandle(ze_image_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->add(handle);
     imageHandleStateMap.insert({handle, nullptr});
   }
   void addHandle(ze_module_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->add(handle);
     moduleHandleStateMap.insert({handle, nullptr});
   }
   void addHandle(ze_module_build_log_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->add(handle);
     moduleBuildLogHandleStateMap.insert({handle, nullptr});
   }
   void addHandle(ze_kernel_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->add(handle);
     kernelHandleStateMap.insert({handle, nullptr});
   }
   void addHandle(ze_sampler_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->add(handle);
     samplerHandleStateMap.insert({handle, nullptr});
   }
   void addHandle(ze_fabric_vertex_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->add(handle);
     fabricVertexHandleStateMap.insert({handle, nullptr});
   }
   void addHandle(ze_fabric_edge_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->add(handle);
     fabricEdgeHandleStateMap.insert({handle, nullptr});
   }
   void addHandle(ze_physical_mem_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->add(handle);
     physicalMemHandleStateMap.insert({handle, nullptr});
   }
   void addHandle(ze_ipc_event_pool_handle_t handle) {
@@ -121,128 +160,210 @@ public:
   }
 
   void addHandle(zet_metric_group_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->add(handle);
     metricGroupHandleStateMap.insert({handle, nullptr});
   }
   void addHandle(zet_metric_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->add(handle);
     metricHandleStateMap.insert({handle, nullptr});
   }
   void addHandle(zet_metric_streamer_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->add(handle);
     metricStreamerHandleStateMap.insert({handle, nullptr});
   }
   void addHandle(zet_metric_query_pool_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->add(handle);
     metricQueryPoolHandleStateMap.insert({handle, nullptr});
   }
   void addHandle(zet_metric_query_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->add(handle);
     metricQueryHandleStateMap.insert({handle, nullptr});
   }
   void addHandle(zet_tracer_exp_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->add(handle);
     tracerExpHandleStateMap.insert({handle, nullptr});
   }
   void addHandle(zet_debug_session_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->add(handle);
     debugSessionHandleStateMap.insert({handle, nullptr});
   }
 
   void addHandle(zes_sched_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->add(handle);
     schedHandleStateMap.insert({handle, nullptr});
   }
   void addHandle(zes_perf_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->add(handle);
     perfHandleStateMap.insert({handle, nullptr});
   }
   void addHandle(zes_pwr_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->add(handle);
     pwrHandleStateMap.insert({handle, nullptr});
   }
   void addHandle(zes_freq_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->add(handle);
     freqHandleStateMap.insert({handle, nullptr});
   }
   void addHandle(zes_engine_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->add(handle);
     engineHandleStateMap.insert({handle, nullptr});
   }
   void addHandle(zes_standby_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->add(handle);
     standbyHandleStateMap.insert({handle, nullptr});
   }
   void addHandle(zes_firmware_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->add(handle);
     firmwareHandleStateMap.insert({handle, nullptr});
   }
   void addHandle(zes_mem_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->add(handle);
     memHandleStateMap.insert({handle, nullptr});
   }
   void addHandle(zes_fabric_port_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->add(handle);
     fabricPortHandleStateMap.insert({handle, nullptr});
   }
   void addHandle(zes_temp_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->add(handle);
     tempHandleStateMap.insert({handle, nullptr});
   }
   void addHandle(zes_psu_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->add(handle);
     psuHandleStateMap.insert({handle, nullptr});
   }
   void addHandle(zes_fan_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->add(handle);
     fanHandleStateMap.insert({handle, nullptr});
   }
   void addHandle(zes_led_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->add(handle);
     ledHandleStateMap.insert({handle, nullptr});
   }
   void addHandle(zes_ras_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->add(handle);
     rasHandleStateMap.insert({handle, nullptr});
   }
   void addHandle(zes_diag_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->add(handle);
     diagHandleStateMap.insert({handle, nullptr});
   }
   void addHandle(zes_overclock_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->add(handle);
     overclockHandleStateMap.insert({handle, nullptr});
   }
   void addHandle(ze_rtas_parallel_operation_exp_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->add(handle);
     rtasParallelOperationHandleStateMap.insert({handle, nullptr});
   }
   void addHandle(ze_rtas_builder_exp_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->add(handle);
     rtasBuilderHandleStateMap.insert({handle, nullptr});
   }
 
   void removeHandle(ze_context_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->remove(handle);
     contextHandleStateMap.erase(handle);
   }
   void removeHandle(ze_driver_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->remove(handle);
     driverHandleStateMap.erase(handle);
   }
   void removeHandle(ze_device_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->remove(handle);
     deviceHandleStateMap.erase(handle);
   }
   void removeHandle(ze_command_queue_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->remove(handle);
     commandQueueHandleStateMap.erase(handle);
   }
   void removeHandle(ze_command_list_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->remove(handle);
     commandListHandleStateMap.erase(handle);
   }
   void removeHandle(ze_fence_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->remove(handle);
     fenceHandleStateMap.erase(handle);
   }
   void removeHandle(ze_event_pool_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->remove(handle);
     eventPoolHandleStateMap.erase(handle);
   }
   void removeHandle(ze_event_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->remove(handle);
     eventHandleStateMap.erase(handle);
   }
   void removeHandle(ze_image_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->remove(handle);
     imageHandleStateMap.erase(handle);
   }
   void removeHandle(ze_module_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->remove(handle);
     moduleHandleStateMap.erase(handle);
   }
   void removeHandle(ze_module_build_log_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->remove(handle);
     moduleBuildLogHandleStateMap.erase(handle);
   }
   void removeHandle(ze_kernel_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->remove(handle);
     kernelHandleStateMap.erase(handle);
   }
   void removeHandle(ze_sampler_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->remove(handle);
     samplerHandleStateMap.erase(handle);
   }
   void removeHandle(ze_physical_mem_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->remove(handle);
     physicalMemHandleStateMap.erase(handle);
   }
   void removeHandle(ze_fabric_vertex_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->remove(handle);
     fabricVertexHandleStateMap.erase(handle);
   }
   void removeHandle(ze_fabric_edge_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->remove(handle);
     fabricEdgeHandleStateMap.erase(handle);
   }
   void removeHandle(ze_ipc_mem_handle_t &handle) {
@@ -259,134 +380,216 @@ public:
   }
 
   void removeHandle(zet_metric_group_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->remove(handle);
     metricGroupHandleStateMap.erase(handle);
   }
   void removeHandle(zet_metric_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->remove(handle);
     metricHandleStateMap.erase(handle);
   }
   void removeHandle(zet_metric_streamer_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->remove(handle);
     metricStreamerHandleStateMap.erase(handle);
   }
   void removeHandle(zet_metric_query_pool_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->remove(handle);
     metricQueryPoolHandleStateMap.erase(handle);
   }
   void removeHandle(zet_metric_query_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->remove(handle);
     metricQueryHandleStateMap.erase(handle);
   }
   void removeHandle(zet_tracer_exp_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->remove(handle);
     tracerExpHandleStateMap.erase(handle);
   }
   void removeHandle(zet_debug_session_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->remove(handle);
     debugSessionHandleStateMap.erase(handle);
   }
 
   void removeHandle(zes_sched_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->remove(handle);
     schedHandleStateMap.erase(handle);
   }
   void removeHandle(zes_perf_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->remove(handle);
     perfHandleStateMap.erase(handle);
   }
   void removeHandle(zes_pwr_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->remove(handle);
     pwrHandleStateMap.erase(handle);
   }
   void removeHandle(zes_freq_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->remove(handle);
     freqHandleStateMap.erase(handle);
   }
   void removeHandle(zes_engine_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->remove(handle);
     engineHandleStateMap.erase(handle);
   }
   void removeHandle(zes_standby_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->remove(handle);
     standbyHandleStateMap.erase(handle);
   }
   void removeHandle(zes_firmware_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->remove(handle);
     firmwareHandleStateMap.erase(handle);
   }
   void removeHandle(zes_mem_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->remove(handle);
     memHandleStateMap.erase(handle);
   }
   void removeHandle(zes_fabric_port_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->remove(handle);
     fabricPortHandleStateMap.erase(handle);
   }
   void removeHandle(zes_temp_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->remove(handle);
     tempHandleStateMap.erase(handle);
   }
   void removeHandle(zes_psu_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->remove(handle);
     psuHandleStateMap.erase(handle);
   }
   void removeHandle(zes_fan_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->remove(handle);
     fanHandleStateMap.erase(handle);
   }
   void removeHandle(zes_led_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->remove(handle);
     ledHandleStateMap.erase(handle);
   }
   void removeHandle(zes_ras_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->remove(handle);
     rasHandleStateMap.erase(handle);
   }
   void removeHandle(zes_diag_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->remove(handle);
     diagHandleStateMap.erase(handle);
   }
   void removeHandle(zes_overclock_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->remove(handle);
     overclockHandleStateMap.erase(handle);
   }
   void removeHandle(ze_rtas_parallel_operation_exp_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->remove(handle);
     rtasParallelOperationHandleStateMap.erase(handle);
   }
   void removeHandle(ze_rtas_builder_exp_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->remove(handle);
     rtasBuilderHandleStateMap.erase(handle);
   }
 
   bool isHandleValid(ze_context_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->isValid(handle);
     return contextHandleStateMap.find(handle) != contextHandleStateMap.end();
   }
   bool isHandleValid(ze_driver_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->isValid(handle);
     return driverHandleStateMap.find(handle) != driverHandleStateMap.end();
   }
   bool isHandleValid(ze_device_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->isValid(handle);
     return deviceHandleStateMap.find(handle) != deviceHandleStateMap.end();
   }
   bool isHandleValid(ze_command_queue_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->isValid(handle);
     return commandQueueHandleStateMap.find(handle) !=
            commandQueueHandleStateMap.end();
   }
   bool isHandleValid(ze_command_list_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->isValid(handle);
     return commandListHandleStateMap.find(handle) !=
            commandListHandleStateMap.end();
   }
   bool isHandleValid(ze_fence_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->isValid(handle);
     return fenceHandleStateMap.find(handle) != fenceHandleStateMap.end();
   }
   bool isHandleValid(ze_event_pool_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->isValid(handle);
     return eventPoolHandleStateMap.find(handle) !=
            eventPoolHandleStateMap.end();
   }
   bool isHandleValid(ze_event_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->isValid(handle);
     return eventHandleStateMap.find(handle) != eventHandleStateMap.end();
   }
   bool isHandleValid(ze_image_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->isValid(handle);
     return imageHandleStateMap.find(handle) != imageHandleStateMap.end();
   }
   bool isHandleValid(ze_module_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->isValid(handle);
     return moduleHandleStateMap.find(handle) != moduleHandleStateMap.end();
   }
   bool isHandleValid(ze_module_build_log_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->isValid(handle);
     return moduleBuildLogHandleStateMap.find(handle) !=
            moduleBuildLogHandleStateMap.end();
   }
   bool isHandleValid(ze_kernel_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->isValid(handle);
     return kernelHandleStateMap.find(handle) != kernelHandleStateMap.end();
   }
   bool isHandleValid(ze_sampler_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->isValid(handle);
     return samplerHandleStateMap.find(handle) != samplerHandleStateMap.end();
   }
   bool isHandleValid(ze_physical_mem_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->isValid(handle);
     return physicalMemHandleStateMap.find(handle) !=
            physicalMemHandleStateMap.end();
   }
   bool isHandleValid(ze_fabric_vertex_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->isValid(handle);
     return fabricVertexHandleStateMap.find(handle) !=
            fabricVertexHandleStateMap.end();
   }
   bool isHandleValid(ze_fabric_edge_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->isValid(handle);
     return fabricEdgeHandleStateMap.find(handle) !=
            fabricEdgeHandleStateMap.end();
   }
@@ -407,101 +610,160 @@ public:
   }
 
   bool isHandleValid(zet_metric_group_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->isValid(handle);
     return metricGroupHandleStateMap.find(handle) !=
            metricGroupHandleStateMap.end();
   }
   bool isHandleValid(zet_metric_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->isValid(handle);
     return metricHandleStateMap.find(handle) != metricHandleStateMap.end();
   }
   bool isHandleValid(zet_metric_streamer_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->isValid(handle);
     return metricStreamerHandleStateMap.find(handle) !=
            metricStreamerHandleStateMap.end();
   }
   bool isHandleValid(zet_metric_query_pool_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->isValid(handle);
     return metricQueryPoolHandleStateMap.find(handle) !=
            metricQueryPoolHandleStateMap.end();
   }
   bool isHandleValid(zet_metric_query_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->isValid(handle);
     return metricQueryHandleStateMap.find(handle) !=
            metricQueryHandleStateMap.end();
   }
   bool isHandleValid(zet_tracer_exp_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->isValid(handle);
     return tracerExpHandleStateMap.find(handle) !=
            tracerExpHandleStateMap.end();
   }
   bool isHandleValid(zet_debug_session_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->isValid(handle);
     return debugSessionHandleStateMap.find(handle) !=
            debugSessionHandleStateMap.end();
   }
 
   bool isHandleValid(zes_sched_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->isValid(handle);
     return schedHandleStateMap.find(handle) != schedHandleStateMap.end();
   }
   bool isHandleValid(zes_perf_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->isValid(handle);
     return perfHandleStateMap.find(handle) != perfHandleStateMap.end();
   }
   bool isHandleValid(zes_pwr_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->isValid(handle);
     return pwrHandleStateMap.find(handle) != pwrHandleStateMap.end();
   }
   bool isHandleValid(zes_freq_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->isValid(handle);
     return freqHandleStateMap.find(handle) != freqHandleStateMap.end();
   }
   bool isHandleValid(zes_engine_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->isValid(handle);
     return engineHandleStateMap.find(handle) != engineHandleStateMap.end();
   }
   bool isHandleValid(zes_standby_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->isValid(handle);
     return standbyHandleStateMap.find(handle) != standbyHandleStateMap.end();
   }
   bool isHandleValid(zes_firmware_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->isValid(handle);
     return firmwareHandleStateMap.find(handle) != firmwareHandleStateMap.end();
   }
   bool isHandleValid(zes_mem_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->isValid(handle);
     return memHandleStateMap.find(handle) != memHandleStateMap.end();
   }
   bool isHandleValid(zes_fabric_port_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->isValid(handle);
     return fabricPortHandleStateMap.find(handle) !=
            fabricPortHandleStateMap.end();
   }
   bool isHandleValid(zes_temp_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->isValid(handle);
     return tempHandleStateMap.find(handle) != tempHandleStateMap.end();
   }
   bool isHandleValid(zes_psu_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->isValid(handle);
     return psuHandleStateMap.find(handle) != psuHandleStateMap.end();
   }
   bool isHandleValid(zes_fan_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->isValid(handle);
     return fanHandleStateMap.find(handle) != fanHandleStateMap.end();
   }
   bool isHandleValid(zes_led_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->isValid(handle);
     return ledHandleStateMap.find(handle) != ledHandleStateMap.end();
   }
   bool isHandleValid(zes_ras_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->isValid(handle);
     return rasHandleStateMap.find(handle) != rasHandleStateMap.end();
   }
   bool isHandleValid(zes_diag_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->isValid(handle);
     return diagHandleStateMap.find(handle) != diagHandleStateMap.end();
   }
   bool isHandleValid(zes_overclock_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->isValid(handle);
     return overclockHandleStateMap.find(handle) !=
            overclockHandleStateMap.end();
   }
 
   bool isHandleValid(ze_rtas_parallel_operation_exp_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->isValid(handle);
     return rtasParallelOperationHandleStateMap.find(handle) !=
            rtasParallelOperationHandleStateMap.end();
   }
 
   bool isHandleValid(ze_rtas_builder_exp_handle_t handle) {
+    if (shadowHandles)
+      return shadowHandles->isValid(handle);
     return rtasBuilderHandleStateMap.find(handle) !=
            rtasBuilderHandleStateMap.end();
   }
 
   bool isOpen(ze_command_list_handle_t handle) {
+    if (shadowHandles) {
+      return shadowHandles->isOpen(handle);
+    }
     return commandListHandleStateMap[handle]->is_open;
   }
   void close(ze_command_list_handle_t handle) {
+    if (shadowHandles) {
+      return shadowHandles->setOpen(handle, false);
+    }
     commandListHandleStateMap[handle]->is_open = false;
   }
   void reset(ze_command_list_handle_t handle) {
+    if (shadowHandles) {
+      return shadowHandles->setOpen(handle, true);
+    }
     commandListHandleStateMap[handle]->is_open = true;
   }
 
@@ -550,6 +812,10 @@ public:
     return dependentMap.count(handle) && !dependentMap[handle].empty();
   }
 
+  // Non-null when ZEL_HANDLE_LIFETIME_SHADOW_OBJECTS is set; replaces the
+  // per-type maps below for all handle types tracked by pointer value
+  std::unique_ptr<HandleShadowTable> shadowHandles;
+
 private:
   std::unordered_map<void *, std::unique_ptr<zel_handle_state_t>>
       defaultHandleStateMap;
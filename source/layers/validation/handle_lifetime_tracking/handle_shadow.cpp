@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "handle_shadow.h"
+#include "ze_validation_layer.h"
+
+namespace validation_layer {
+
+static constexpr size_t initialShadowSlots = 1024;
+
+HandleShadowTable::HandleShadowTable()
+    : slots(initialShadowSlots, zel_handle_shadow_t{}) {}
+
+void HandleShadowTable::insert(const void *handle, const char *typeTag,
+                               bool is_open) {
+  if ((usedCount + 1) * 2 > slots.size()) {
+    // Mostly destroyed shadows: recycle them in place rather than growing
+    rehash(liveCount * 4 > slots.size() ? slots.size() * 2 : slots.size());
+  }
+
+  zel_handle_shadow_t *recycled = nullptr;
+  size_t i = homeSlot(handle, typeTag);
+  for (;; i = (i + 1) & (slots.size() - 1)) {
+    auto &slot = slots[i];
+    if (slot.status == emptyShadow)
+      break;
+    if (slot.handle == handle && slot.typeTag == typeTag) {
+      if (slot.status == destroyedShadow) {
+        slot.generation++;
+        slot.status = liveShadow;
+        liveCount++;
+      }
+      slot.state.is_open = is_open;
+      return;
+    }
+    if (slot.status == destroyedShadow && !recycled)
+      recycled = &slot;
+  }
+
+  auto &target = recycled ? *recycled : slots[i];
+  if (!recycled)
+    usedCount++;
+  target.handle = handle;
+  target.typeTag = typeTag;
+  target.generation = 1;
+  target.status = liveShadow;
+  target.state.is_open = is_open;
+  liveCount++;
+}
+
+void HandleShadowTable::rehash(size_t slotCount) {
+  std::vector<zel_handle_shadow_t> previous(slotCount, zel_handle_shadow_t{});
+  previous.swap(slots);
+  usedCount = 0;
+  for (auto &shadow : previous) {
+    if (shadow.status != liveShadow)
+      continue;
+    size_t i = homeSlot(shadow.handle, shadow.typeTag);
+    while (slots[i].status != emptyShadow)
+      i = (i + 1) & (slots.size() - 1);
+    slots[i] = shadow;
+    usedCount++;
+  }
+}
+
+void HandleShadowTable::reportUseAfterDestroy(const zel_handle_shadow_t &shadow) {
+  context.reportFinding("handle_lifetime", "use-after-destroy",
+                        findingSeverity::error, shadow.handle, [&]() {
+                          return fmt::format(
+                              "Handle {} used after it was destroyed (generation {})",
+                              shadow.handle, shadow.generation);
+                        });
+}
+
+} // namespace validation_layer
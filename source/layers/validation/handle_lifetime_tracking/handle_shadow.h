@@ -0,0 +1,126 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+#include <vector>
+
+namespace validation_layer {
+
+typedef struct _zel_handle_state_t {
+  bool is_open;
+} zel_handle_state_t;
+
+// One address per handle type, used as the type tag of a shadow object
+template <class T> struct handleShadowType { static const char tag; };
+template <class T> const char handleShadowType<T>::tag = 0;
+
+// Shadow object for one handle value of one type. Destroyed shadows keep
+// their handle and type so later uses are reported as use-after-destroy,
+// until the slot is recycled for another handle.
+struct zel_handle_shadow_t {
+  const void *handle;
+  const char *typeTag;
+  // Number of times this handle value has been created
+  uint32_t generation;
+  uint8_t status;
+  zel_handle_state_t state;
+};
+
+// Replaces the per-type hash maps of HandleLifetimeValidation when
+// ZEL_HANDLE_LIFETIME_SHADOW_OBJECTS is set. Shadows are stored inline in a
+// single open addressing table keyed by handle and type tag, so a validity
+// check is one hashed slot load and compare in the common case, with no
+// node allocation per tracked handle. Destroyed shadows are recycled by
+// later inserts, and the table is compacted when they pile up.
+//
+// Handles are not replaced by pointers to their shadows: that would need
+// every generated DDI entry to unwrap handles, including those inside arrays
+// and descriptor chains, before calling the driver.
+//
+// Lookups share a reader lock, so concurrent intercepts only contend with
+// creates and destroys. Per-handle state is read and written under the lock
+// rather than handed out by pointer, since a rehash moves the shadows.
+class HandleShadowTable {
+public:
+  enum : uint8_t { emptyShadow = 0, liveShadow = 1, destroyedShadow = 2 };
+
+  HandleShadowTable();
+
+  template <class T> void add(T handle, bool is_open = true) {
+    std::unique_lock<std::shared_timed_mutex> lock(shadowMutex);
+    insert(handle, &handleShadowType<T>::tag, is_open);
+  }
+  template <class T> void remove(T handle) {
+    std::unique_lock<std::shared_timed_mutex> lock(shadowMutex);
+    auto shadow = find(handle, &handleShadowType<T>::tag);
+    if (shadow && shadow->status == liveShadow) {
+      shadow->status = destroyedShadow;
+      liveCount--;
+    }
+  }
+  template <class T> bool isValid(T handle) {
+    zel_handle_shadow_t destroyed;
+    {
+      std::shared_lock<std::shared_timed_mutex> lock(shadowMutex);
+      auto shadow = find(handle, &handleShadowType<T>::tag);
+      if (!shadow)
+        return false;
+      if (shadow->status == liveShadow)
+        return true;
+      destroyed = *shadow;
+    }
+    reportUseAfterDestroy(destroyed);
+    return false;
+  }
+  template <class T> bool isOpen(T handle) {
+    std::shared_lock<std::shared_timed_mutex> lock(shadowMutex);
+    auto shadow = find(handle, &handleShadowType<T>::tag);
+    return shadow && shadow->status == liveShadow && shadow->state.is_open;
+  }
+  template <class T> void setOpen(T handle, bool is_open) {
+    std::unique_lock<std::shared_timed_mutex> lock(shadowMutex);
+    auto shadow = find(handle, &handleShadowType<T>::tag);
+    if (shadow && shadow->status == liveShadow)
+      shadow->state.is_open = is_open;
+  }
+
+private:
+  size_t homeSlot(const void *handle, const char *typeTag) const {
+    auto key = reinterpret_cast<uintptr_t>(handle) ^
+               (reinterpret_cast<uintptr_t>(typeTag) << 1);
+    return static_cast<size_t>((static_cast<uint64_t>(key) *
+                                0x9E3779B97F4A7C15ull) >> 32) &
+           (slots.size() - 1);
+  }
+
+  zel_handle_shadow_t *find(const void *handle, const char *typeTag) {
+    for (size_t i = homeSlot(handle, typeTag);; i = (i + 1) & (slots.size() - 1)) {
+      auto &slot = slots[i];
+      if (slot.status == emptyShadow)
+        return nullptr;
+      if (slot.handle == handle && slot.typeTag == typeTag)
+        return &slot;
+    }
+  }
+
+  void insert(const void *handle, const char *typeTag, bool is_open);
+  void rehash(size_t slotCount);
+  void reportUseAfterDestroy(const zel_handle_shadow_t &shadow);
+
+  std::shared_timed_mutex shadowMutex;
+  std::vector<zel_handle_shadow_t> slots;
+  // Non-empty slots, live or destroyed; kept at most half of the table
+  size_t usedCount = 0;
+  size_t liveCount = 0;
+};
+
+} // namespace validation_layer
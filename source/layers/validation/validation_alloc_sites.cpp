@@ -0,0 +1,147 @@
+/*
+ *
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file validation_alloc_sites.cpp
+ *
+ */
+#include "validation_alloc_sites.h"
+#include "validation_stack.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+namespace validation_layer
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    allocationSiteTracker::allocationSiteTracker(uint32_t sampleRate, size_t capacity)
+        : sampleRate(sampleRate)
+    {
+        size_t slotCount = 1;
+        while (slotCount < capacity)
+            slotCount <<= 1;
+        capacityMask = slotCount - 1;
+        slots.reset(new siteSlot[slotCount]);
+        for (size_t i = 0; i < slotCount; i++) {
+            slots[i].key.store(emptyKey, std::memory_order_relaxed);
+            slots[i].apiName = nullptr;
+            slots[i].frameCount = 0;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    size_t allocationSiteTracker::homeSlot(uintptr_t key) const
+    {
+        // Handles are at least 8 byte aligned, so mix the high bits down
+        uint64_t hash = static_cast<uint64_t>(key) * 0x9E3779B97F4A7C15ull;
+        return static_cast<size_t>(hash >> 32) & capacityMask;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    void allocationSiteTracker::recordCreate(const char *apiName, const void *handle)
+    {
+        auto key = reinterpret_cast<uintptr_t>(handle);
+        if (key <= busyKey)
+            return;
+
+        static thread_local uint32_t sampleTick = 0;
+        if (++sampleTick < sampleRate)
+            return;
+        sampleTick = 0;
+
+        // Reserve a slot first so a full arena costs no stack walk
+        auto home = homeSlot(key);
+        siteSlot *claimed = nullptr;
+        for (size_t probe = 0; probe < maxProbes && probe <= capacityMask; probe++) {
+            auto &slot = slots[(home + probe) & capacityMask];
+            auto current = slot.key.load(std::memory_order_acquire);
+            if (current == key)
+                return;
+            if (current == emptyKey || current == tombstoneKey) {
+                if (slot.key.compare_exchange_strong(current, busyKey, std::memory_order_acquire)) {
+                    claimed = &slot;
+                    break;
+                }
+            }
+        }
+        if (!claimed) {
+            droppedSamples.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        claimed->apiName = apiName;
+        claimed->frameCount = captureStack(claimed->frames, maxFrames);
+        liveSamples.fetch_add(1, std::memory_order_relaxed);
+        claimed->key.store(key, std::memory_order_release);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    void allocationSiteTracker::releaseHandle(const void *handle)
+    {
+        auto key = reinterpret_cast<uintptr_t>(handle);
+        if (key <= busyKey || liveSamples.load(std::memory_order_relaxed) == 0)
+            return;
+
+        auto home = homeSlot(key);
+        for (size_t probe = 0; probe < maxProbes && probe <= capacityMask; probe++) {
+            auto &slot = slots[(home + probe) & capacityMask];
+            auto current = slot.key.load(std::memory_order_acquire);
+            if (current == emptyKey)
+                return;
+            if (current == key) {
+                if (slot.key.compare_exchange_strong(current, tombstoneKey, std::memory_order_acq_rel))
+                    liveSamples.fetch_sub(1, std::memory_order_relaxed);
+                return;
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    std::string allocationSiteTracker::report()
+    {
+        auto dropped = droppedSamples.load(std::memory_order_relaxed);
+        if (liveSamples.load(std::memory_order_relaxed) == 0 && dropped == 0)
+            return std::string();
+
+        // Group by creating API and raw return addresses; symbolize once per site
+        using siteKey = std::pair<std::string, std::vector<void *>>;
+        std::map<siteKey, uint64_t> sites;
+        for (size_t i = 0; i <= capacityMask; i++) {
+            auto &slot = slots[i];
+            if (slot.key.load(std::memory_order_acquire) <= busyKey)
+                continue;
+            siteKey site(slot.apiName ? slot.apiName : "unknown",
+                         std::vector<void *>(slot.frames, slot.frames + slot.frameCount));
+            sites[site]++;
+        }
+
+        std::vector<std::pair<uint64_t, const siteKey *>> ranked;
+        for (auto &site : sites)
+            ranked.emplace_back(site.second, &site.first);
+        std::stable_sort(ranked.begin(), ranked.end(),
+            [](const std::pair<uint64_t, const siteKey *> &a, const std::pair<uint64_t, const siteKey *> &b) {
+                return a.first > b.first;
+            });
+
+        std::ostringstream out;
+        out << "Leaked handles by allocation site (sampled 1 in " << sampleRate << ")\n";
+        out << "----------------------------------------------------------\n";
+        for (auto &entry : ranked) {
+            out << std::setw(8) << std::right << entry.first << " leaked from " << entry.second->first << "\n";
+            auto frames = describeFrames(entry.second->second.data(), static_cast<uint32_t>(entry.second->second.size()));
+            if (frames.empty())
+                out << "        <no stack>\n";
+            for (size_t i = 0; i < frames.size(); i++)
+                out << "        #" << i << " " << frames[i] << "\n";
+        }
+        if (dropped)
+            out << dropped << " samples dropped, increase ZEL_LEAK_SITE_CAPACITY\n";
+        return out.str();
+    }
+} // namespace validation_layer
@@ -0,0 +1,62 @@
+/*
+ *
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file validation_alloc_sites.h
+ *
+ */
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace validation_layer
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    /// Records the call stack of 1 in N create calls, when ZEL_LEAK_SITE_SAMPLE_RATE
+    /// is set, so handles still alive at teardown can be reported grouped by the
+    /// site that created them. Stacks live in a fixed size open addressing arena
+    /// keyed by handle; slots are claimed and released with atomics, so create and
+    /// destroy never take a lock, and a full arena drops the sample.
+    class allocationSiteTracker
+    {
+    public:
+        static constexpr uint32_t maxFrames = 32;
+
+        allocationSiteTracker(uint32_t sampleRate, size_t capacity);
+
+        void recordCreate(const char *apiName, const void *handle);
+        void releaseHandle(const void *handle);
+
+        // Live sampled handles grouped by creation stack, most frequent site first
+        std::string report();
+
+    private:
+        // Reserved keys, never valid handles. A busy slot is being filled by a
+        // create and is skipped by lookups until its key is published.
+        static constexpr uintptr_t emptyKey = 0;
+        static constexpr uintptr_t tombstoneKey = 1;
+        static constexpr uintptr_t busyKey = 2;
+        // Bounds the work done by a destroy of an unsampled handle
+        static constexpr size_t maxProbes = 64;
+
+        struct siteSlot {
+            std::atomic<uintptr_t> key;
+            const char *apiName;
+            uint32_t frameCount;
+            void *frames[maxFrames];
+        };
+
+        size_t homeSlot(uintptr_t key) const;
+
+        uint32_t sampleRate;
+        size_t capacityMask;
+        std::unique_ptr<siteSlot[]> slots;
+        std::atomic<size_t> liveSamples{0};
+        std::atomic<size_t> droppedSamples{0};
+    };
+} // namespace validation_layer
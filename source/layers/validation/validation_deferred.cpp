@@ -0,0 +1,154 @@
+/*
+ *
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file validation_deferred.cpp
+ *
+ */
+#include "validation_deferred.h"
+
+namespace validation_layer
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    deferredEpilogueQueue::deferredEpilogueQueue(checkerTiming *timing) : timing(timing)
+    {
+        worker = std::thread(&deferredEpilogueQueue::workerLoop, this);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    deferredEpilogueQueue::~deferredEpilogueQueue()
+    {
+        shutdown();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    void deferredEpilogueQueue::shutdown()
+    {
+        closed.store(true, std::memory_order_release);
+        {
+            std::lock_guard<std::mutex> lock(workerMutex);
+            stopWorker = true;
+        }
+        workerWake.notify_one();
+        if (worker.joinable())
+            worker.join();
+        flush();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    struct deferredEpilogueQueue::threadRingHolder {
+        deferredEpilogueQueue *owner = nullptr;
+        std::shared_ptr<threadRing> ring;
+        ~threadRingHolder() {
+            // Records still queued run on the next drain, which then frees the ring
+            if (ring)
+                ring->retired.store(true, std::memory_order_release);
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    deferredEpilogueQueue::threadRing &deferredEpilogueQueue::getThreadRing()
+    {
+        static thread_local threadRingHolder holder;
+        if (holder.owner != this) {
+            if (holder.ring)
+                holder.ring->retired.store(true, std::memory_order_release);
+            holder.ring = std::make_shared<threadRing>();
+            holder.owner = this;
+            std::lock_guard<std::mutex> lock(ringsMutex);
+            rings.push_back(holder.ring);
+        }
+        return *holder.ring;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    bool deferredEpilogueQueue::drain()
+    {
+        std::lock_guard<std::mutex> drainLock(drainMutex);
+        std::vector<std::shared_ptr<threadRing>> snapshot;
+        {
+            std::lock_guard<std::mutex> lock(ringsMutex);
+            snapshot = rings;
+        }
+        bool ranAny = false;
+        bool anyRetired = false;
+        for (auto &ring : snapshot) {
+            // Read before the tail, so a retired ring seen empty stays empty
+            bool retired = ring->retired.load(std::memory_order_acquire);
+            uint64_t head = ring->head.load(std::memory_order_relaxed);
+            uint64_t tail = ring->tail.load(std::memory_order_acquire);
+            for (; head != tail; head++) {
+                auto &record = ring->records[head % ringCapacity];
+                if (timing) {
+                    checkerTimer timer(timing, record.checkerName, record.apiName, timingPhase::deferredEpilogue);
+                    record.run(record.payload);
+                } else {
+                    record.run(record.payload);
+                }
+                ring->head.store(head + 1, std::memory_order_release);
+                ranAny = true;
+            }
+            anyRetired |= retired;
+        }
+        if (anyRetired) {
+            std::lock_guard<std::mutex> lock(ringsMutex);
+            for (size_t i = 0; i < rings.size();) {
+                auto &ring = rings[i];
+                if (ring->retired.load(std::memory_order_acquire) &&
+                    ring->head.load(std::memory_order_relaxed) == ring->tail.load(std::memory_order_acquire)) {
+                    ring = std::move(rings.back());
+                    rings.pop_back();
+                } else {
+                    i++;
+                }
+            }
+        }
+        return ranAny;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    bool deferredEpilogueQueue::pending()
+    {
+        std::lock_guard<std::mutex> lock(ringsMutex);
+        for (auto &ring : rings) {
+            if (ring->head.load(std::memory_order_relaxed) != ring->tail.load(std::memory_order_relaxed))
+                return true;
+        }
+        return false;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    void deferredEpilogueQueue::wakeWorker()
+    {
+        // Taking the mutex orders the notify after the worker has started waiting
+        std::lock_guard<std::mutex> lock(workerMutex);
+        workerWake.notify_one();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    void deferredEpilogueQueue::flush()
+    {
+        while (drain()) {
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    void deferredEpilogueQueue::workerLoop()
+    {
+        std::unique_lock<std::mutex> lock(workerMutex);
+        while (!stopWorker) {
+            lock.unlock();
+            bool ranAny = drain();
+            lock.lock();
+            if (ranAny)
+                continue;
+            workerSleeping.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (!stopWorker && !pending())
+                workerWake.wait(lock);
+            workerSleeping.store(false, std::memory_order_relaxed);
+        }
+    }
+} // namespace validation_layer
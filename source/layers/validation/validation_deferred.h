@@ -0,0 +1,124 @@
+/*
+ *
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file validation_deferred.h
+ *
+ */
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "validation_timing.h"
+
+namespace validation_layer
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    /// Runs epilogues of checkers with deferEpilogues set on a background worker,
+    /// when ZEL_VALIDATION_DEFERRED_EPILOGUES is set. Each call is packed into a
+    /// fixed size record holding a trampoline and the epilogue arguments by value,
+    /// and pushed onto a single producer ring owned by the calling thread.
+    /// If the ring is full, or the queue has been shut down, the epilogue runs
+    /// inline on the calling thread. The worker sleeps while every ring is empty
+    /// and producers only wake it when they see it sleeping. A thread's ring is
+    /// freed once the thread has exited and its records have run.
+    /// When timing is given, each epilogue is timed on the thread that runs it.
+    class deferredEpilogueQueue
+    {
+    public:
+        explicit deferredEpilogueQueue(checkerTiming *timing);
+        ~deferredEpilogueQueue();
+
+        // checkerName and apiName must be string literals
+        template <typename Epilogue>
+        void defer(const char *checkerName, const char *apiName, const Epilogue &epilogue) {
+            static_assert(sizeof(Epilogue) <= sizeof(deferredRecord::payload), "epilogue arguments do not fit in a deferred record");
+            static_assert(alignof(Epilogue) <= alignof(uint64_t), "epilogue arguments are over-aligned for a deferred record");
+            static_assert(std::is_trivially_copyable<Epilogue>::value, "epilogue arguments must be captured by value");
+            if (closed.load(std::memory_order_acquire)) {
+                epilogue();
+                return;
+            }
+            auto &ring = getThreadRing();
+            uint64_t tail = ring.tail.load(std::memory_order_relaxed);
+            if (tail - ring.head.load(std::memory_order_acquire) == ringCapacity) {
+                epilogue();
+                return;
+            }
+            auto &record = ring.records[tail % ringCapacity];
+            record.run = &invoke<Epilogue>;
+            record.checkerName = checkerName;
+            record.apiName = apiName;
+            memcpy(record.payload, &epilogue, sizeof(Epilogue));
+            ring.tail.store(tail + 1, std::memory_order_release);
+
+            // Pairs with the fence in workerLoop: either the worker sees this record
+            // before it sleeps, or this thread sees it sleeping
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (workerSleeping.load(std::memory_order_relaxed))
+                wakeWorker();
+        }
+
+        // Runs every epilogue queued so far before returning
+        void flush();
+
+        // Stops the worker and runs everything still queued; later epilogues run
+        // inline. Calls racing with shutdown may still be queued and are not run.
+        void shutdown();
+
+    private:
+        static constexpr uint64_t ringCapacity = 1024;
+
+        struct deferredRecord {
+            void (*run)(const void *payload);
+            const char *checkerName;
+            const char *apiName;
+            uint64_t payload[15];
+        };
+        struct threadRing {
+            std::atomic<uint64_t> head{0};
+            char padding0[56];
+            std::atomic<uint64_t> tail{0};
+            // Set when the owning thread exits, after its last record was queued
+            std::atomic<bool> retired{false};
+            char padding1[55];
+            deferredRecord records[ringCapacity];
+        };
+        struct threadRingHolder;
+
+        template <typename Epilogue>
+        static void invoke(const void *payload) {
+            (*static_cast<const Epilogue *>(payload))();
+        }
+
+        threadRing &getThreadRing();
+        bool drain();
+        bool pending();
+        void wakeWorker();
+        void workerLoop();
+
+        checkerTiming *timing;
+        std::atomic<bool> closed{false};
+        std::mutex ringsMutex;
+        // Shared with the owning thread, so a ring can be dropped from either side
+        std::vector<std::shared_ptr<threadRing>> rings;
+
+        // Serializes consumers, the worker and callers of flush()
+        std::mutex drainMutex;
+
+        std::mutex workerMutex;
+        std::condition_variable workerWake;
+        bool stopWorker = false;
+        std::atomic<bool> workerSleeping{false};
+        std::thread worker;
+    };
+} // namespace validation_layer
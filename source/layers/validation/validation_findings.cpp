@@ -0,0 +1,247 @@
+/*
+ *
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file validation_findings.cpp
+ *
+ */
+#include "validation_findings.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+
+#if defined(_WIN32)
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace validation_layer
+{
+    static constexpr char findingsMagic[8] = {'Z', 'E', 'L', 'F', 'I', 'N', 'D', '\0'};
+    static constexpr uint32_t findingsVersion = 1;
+    static constexpr uint64_t rateWindowNs = 1000000000ull;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    findingsLog::findingsLog(const std::string &requestedPath)
+    {
+        // Unique filename per process, with the PID inserted before the extension
+#if defined(_WIN32)
+        auto pid = _getpid();
+#else
+        auto pid = getpid();
+#endif
+        std::string path = requestedPath;
+        size_t dotPos = path.find_last_of('.');
+        if (dotPos != std::string::npos) {
+            path.insert(dotPos, "_pid" + std::to_string(pid));
+        } else {
+            path += "_pid" + std::to_string(pid);
+        }
+
+        file = fopen(path.c_str(), "wb");
+        if (!file)
+            return;
+        setvbuf(file, nullptr, _IOFBF, 1 << 20);
+
+        findingFileHeader header = {};
+        memcpy(header.magic, findingsMagic, sizeof(header.magic));
+        header.version = findingsVersion;
+        header.recordSize = sizeof(findingRecord);
+        header.pid = static_cast<uint64_t>(pid);
+        fwrite(&header, sizeof(header), 1, file);
+
+        auto rateString = getenv("ZEL_VALIDATION_FINDINGS_RATE");
+        rateLimit = rateString ? static_cast<uint32_t>(strtoul(rateString, nullptr, 10)) : 0;
+        if (rateLimit == 0)
+            rateLimit = 1000;
+
+        dedupSlots.reset(new dedupSlot[dedupSlotCount]);
+        for (size_t i = 0; i < dedupSlotCount; i++) {
+            dedupSlots[i].key.store(0, std::memory_order_relaxed);
+            dedupSlots[i].repeats.store(0, std::memory_order_relaxed);
+            dedupSlots[i].findingId = 0;
+        }
+        ring.reset(new ringSlot[ringCapacity]);
+        for (size_t i = 0; i < ringCapacity; i++) {
+            ring[i].sequence.store(i, std::memory_order_relaxed);
+        }
+
+        openedAtNs = now();
+        windowStartNs.store(openedAtNs, std::memory_order_relaxed);
+        writer = std::thread(&findingsLog::writerLoop, this);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    findingsLog::~findingsLog()
+    {
+        if (!file)
+            return;
+        {
+            std::lock_guard<std::mutex> lock(writerMutex);
+            stopWriter = true;
+        }
+        writerWake.notify_one();
+        writer.join();
+
+        findingRecord record;
+        while (pop(record))
+            fwrite(&record, sizeof(record), 1, file);
+
+        // Repeat counts are only known at the end
+        auto summary = [&](uint32_t type, uint64_t findingId, uint64_t count) {
+            findingRecord total = {};
+            total.type = type;
+            total.timestampNs = now() - openedAtNs;
+            total.findingId = findingId;
+            total.count = count;
+            fwrite(&total, sizeof(total), 1, file);
+        };
+        for (size_t i = 0; i < dedupSlotCount; i++) {
+            auto repeats = dedupSlots[i].repeats.load(std::memory_order_relaxed);
+            if (repeats)
+                summary(repeatCount, dedupSlots[i].findingId, repeats);
+        }
+        if (auto count = suppressed.load(std::memory_order_relaxed))
+            summary(suppressedByRateLimit, 0, count);
+        if (auto count = dropped.load(std::memory_order_relaxed))
+            summary(droppedRingFull, 0, count);
+        fclose(file);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    uint64_t findingsLog::now() const
+    {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    bool findingsLog::isRepeat(const char *checker, const char *finding, const void *object, uint64_t &findingId)
+    {
+        uint64_t key = reinterpret_cast<uintptr_t>(checker) * 0x9E3779B97F4A7C15ull;
+        key = (key ^ reinterpret_cast<uintptr_t>(finding)) * 0xC2B2AE3D27D4EB4Full;
+        key = (key ^ reinterpret_cast<uintptr_t>(object)) * 0x165667B19E3779F9ull;
+        key ^= key >> 29;
+        if (key == 0)
+            key = 1;
+
+        for (size_t probe = 0; probe < dedupMaxProbes; probe++) {
+            auto &slot = dedupSlots[(key + probe) & (dedupSlotCount - 1)];
+            auto current = slot.key.load(std::memory_order_acquire);
+            if (current == 0 && slot.key.compare_exchange_strong(current, key, std::memory_order_acq_rel)) {
+                slot.findingId = nextFindingId.fetch_add(1, std::memory_order_relaxed);
+                findingId = slot.findingId;
+                return false;
+            }
+            if (current == key) {
+                slot.repeats.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+        // Table full: write without de-duplication, still subject to the rate limit
+        findingId = nextFindingId.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    bool findingsLog::admit()
+    {
+        auto timestamp = now();
+        auto start = windowStartNs.load(std::memory_order_relaxed);
+        if (timestamp - start >= rateWindowNs &&
+            windowStartNs.compare_exchange_strong(start, timestamp, std::memory_order_relaxed)) {
+            windowCount.store(0, std::memory_order_relaxed);
+        }
+        if (windowCount.fetch_add(1, std::memory_order_relaxed) < rateLimit)
+            return true;
+        suppressed.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    static void copyField(char *field, size_t fieldSize, const char *value, size_t valueLength)
+    {
+        auto length = valueLength < fieldSize - 1 ? valueLength : fieldSize - 1;
+        memcpy(field, value, length);
+        field[length] = '\0';
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    void findingsLog::write(const char *checker, const char *finding, findingSeverity severity, const void *object,
+                            uint64_t findingId, const std::string &message)
+    {
+        static thread_local uint32_t threadId =
+            static_cast<uint32_t>(std::hash<std::thread::id>()(std::this_thread::get_id()));
+
+        findingRecord record = {};
+        record.type = firstOccurrence;
+        record.severity = static_cast<uint32_t>(severity);
+        record.timestampNs = now() - openedAtNs;
+        record.findingId = findingId;
+        record.object = reinterpret_cast<uintptr_t>(object);
+        record.threadId = threadId;
+        copyField(record.checker, sizeof(record.checker), checker, strlen(checker));
+        copyField(record.finding, sizeof(record.finding), finding, strlen(finding));
+        copyField(record.message, sizeof(record.message), message.c_str(), message.size());
+        push(record);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    void findingsLog::push(const findingRecord &record)
+    {
+        uint64_t position = enqueuePosition.load(std::memory_order_relaxed);
+        ringSlot *slot;
+        for (;;) {
+            slot = &ring[position & (ringCapacity - 1)];
+            uint64_t sequence = slot->sequence.load(std::memory_order_acquire);
+            int64_t diff = static_cast<int64_t>(sequence) - static_cast<int64_t>(position);
+            if (diff == 0) {
+                if (enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                    break;
+            } else if (diff < 0) {
+                dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            } else {
+                position = enqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+        slot->record = record;
+        slot->sequence.store(position + 1, std::memory_order_release);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    bool findingsLog::pop(findingRecord &record)
+    {
+        auto &slot = ring[dequeuePosition & (ringCapacity - 1)];
+        if (slot.sequence.load(std::memory_order_acquire) != dequeuePosition + 1)
+            return false;
+        record = slot.record;
+        slot.sequence.store(dequeuePosition + ringCapacity, std::memory_order_release);
+        dequeuePosition++;
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    void findingsLog::writerLoop()
+    {
+        findingRecord record;
+        std::unique_lock<std::mutex> lock(writerMutex);
+        while (!stopWriter) {
+            writerWake.wait_for(lock, std::chrono::milliseconds(50));
+            lock.unlock();
+            bool wrote = false;
+            while (pop(record)) {
+                fwrite(&record, sizeof(record), 1, file);
+                wrote = true;
+            }
+            if (wrote)
+                fflush(file);
+            lock.lock();
+        }
+    }
+} // namespace validation_layer
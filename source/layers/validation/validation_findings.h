@@ -0,0 +1,137 @@
+/*
+ *
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file validation_findings.h
+ *
+ */
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace validation_layer
+{
+    enum class findingSeverity : uint32_t {
+        info,
+        warning,
+        error
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// Structured sink for checker findings, enabled with ZEL_VALIDATION_FINDINGS_LOG.
+    /// Findings are de-duplicated by checker, finding and object: the first
+    /// occurrence is written as a fixed size record, and later ones only bump a
+    /// counter that is written when the log is closed. New findings are rate
+    /// limited, and records reach the file through a bounded ring drained by a
+    /// writer thread, so a storm of warnings never blocks the calling thread.
+    /// The file is decoded with scripts/decode_validation_findings.py.
+    class findingsLog
+    {
+    public:
+        explicit findingsLog(const std::string &path);
+        ~findingsLog();
+
+        bool isOpen() const { return file != nullptr; }
+
+        // checker and finding must be string literals; describe() is only called
+        // for a first occurrence that is written to the log
+        template <typename Describe>
+        void report(const char *checker, const char *finding, findingSeverity severity, const void *object,
+                    const Describe &describe) {
+            uint64_t findingId = 0;
+            if (isRepeat(checker, finding, object, findingId))
+                return;
+            if (!admit())
+                return;
+            write(checker, finding, severity, object, findingId, describe());
+        }
+
+        enum recordType : uint32_t {
+            firstOccurrence = 1,
+            // count holds the number of repeats of findingId
+            repeatCount = 2,
+            // count holds the number of findings not written, and why
+            suppressedByRateLimit = 3,
+            droppedRingFull = 4
+        };
+
+        // Native byte order; must match decode_validation_findings.py
+        struct findingRecord {
+            uint32_t type;
+            uint32_t severity;
+            uint64_t timestampNs;
+            uint64_t findingId;
+            uint64_t object;
+            uint64_t count;
+            uint32_t threadId;
+            uint32_t reserved;
+            char checker[24];
+            char finding[40];
+            char message[144];
+        };
+        static_assert(sizeof(findingRecord) == 256, "findings file records are 256 bytes");
+
+        struct findingFileHeader {
+            char magic[8];          // "ZELFIND\0"
+            uint32_t version;
+            uint32_t recordSize;
+            uint64_t pid;
+        };
+
+    private:
+        static constexpr size_t dedupSlotCount = 1 << 16;
+        static constexpr size_t dedupMaxProbes = 32;
+        static constexpr size_t ringCapacity = 4096;
+
+        struct dedupSlot {
+            std::atomic<uint64_t> key;
+            std::atomic<uint64_t> repeats;
+            uint64_t findingId;
+        };
+
+        struct ringSlot {
+            std::atomic<uint64_t> sequence;
+            findingRecord record;
+        };
+
+        bool isRepeat(const char *checker, const char *finding, const void *object, uint64_t &findingId);
+        bool admit();
+        void write(const char *checker, const char *finding, findingSeverity severity, const void *object,
+                   uint64_t findingId, const std::string &message);
+        void push(const findingRecord &record);
+        bool pop(findingRecord &record);
+        void writerLoop();
+        uint64_t now() const;
+
+        FILE *file = nullptr;
+        uint64_t openedAtNs = 0;
+        uint32_t rateLimit = 0;
+
+        std::unique_ptr<dedupSlot[]> dedupSlots;
+        std::atomic<uint64_t> nextFindingId{1};
+
+        // Fixed one second window for the rate limit
+        std::atomic<uint64_t> windowStartNs{0};
+        std::atomic<uint32_t> windowCount{0};
+        std::atomic<uint64_t> suppressed{0};
+
+        // Bounded multi-producer ring, drained by the writer thread only
+        std::unique_ptr<ringSlot[]> ring;
+        std::atomic<uint64_t> enqueuePosition{0};
+        uint64_t dequeuePosition = 0;
+        std::atomic<uint64_t> dropped{0};
+
+        std::mutex writerMutex;
+        std::condition_variable writerWake;
+        bool stopWriter = false;
+        std::thread writer;
+    };
+} // namespace validation_layer
@@ -0,0 +1,81 @@
+/*
+ *
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file validation_stack.cpp
+ *
+ */
+#include "validation_stack.h"
+
+#include <cstring>
+#include <sstream>
+
+#if defined(__linux__)
+#include <dlfcn.h>
+#include <execinfo.h>
+#endif
+
+namespace validation_layer
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    uint32_t captureStack(void **frames, uint32_t maxFrames)
+    {
+#if defined(__linux__)
+        int count = backtrace(frames, static_cast<int>(maxFrames));
+        return count > 0 ? static_cast<uint32_t>(count) : 0;
+#else
+        (void)frames;
+        (void)maxFrames;
+        return 0;
+#endif
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    std::vector<std::string> describeFrames(void *const *frames, uint32_t frameCount, uint32_t maxDescribed)
+    {
+        std::vector<std::string> described;
+#if defined(__linux__)
+        Dl_info self = {};
+        dladdr(reinterpret_cast<void *>(&captureStack), &self);
+        for (uint32_t i = 0; i < frameCount && described.size() < maxDescribed; i++) {
+            Dl_info info = {};
+            if (!dladdr(frames[i], &info)) {
+                std::ostringstream site;
+                site << "0x" << std::hex << reinterpret_cast<uintptr_t>(frames[i]);
+                described.push_back(site.str());
+                continue;
+            }
+            if (info.dli_fbase == self.dli_fbase)
+                continue;
+            if (info.dli_fname && (strstr(info.dli_fname, "libze_loader") || strstr(info.dli_fname, "libze_tracing_layer")))
+                continue;
+            std::ostringstream site;
+            if (info.dli_sname) {
+                site << info.dli_sname << "+0x" << std::hex
+                     << (reinterpret_cast<uintptr_t>(frames[i]) - reinterpret_cast<uintptr_t>(info.dli_saddr));
+            } else {
+                site << "0x" << std::hex
+                     << (reinterpret_cast<uintptr_t>(frames[i]) - reinterpret_cast<uintptr_t>(info.dli_fbase));
+            }
+            site << " (" << (info.dli_fname ? info.dli_fname : "unknown") << ")";
+            described.push_back(site.str());
+        }
+#else
+        (void)frames;
+        (void)frameCount;
+        (void)maxDescribed;
+#endif
+        return described;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    std::string describeCaller()
+    {
+        void *frames[32];
+        auto frameCount = captureStack(frames, 32);
+        auto described = describeFrames(frames, frameCount, 1);
+        return described.empty() ? std::string("unknown") : described.front();
+    }
+} // namespace validation_layer
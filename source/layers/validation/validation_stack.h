@@ -0,0 +1,34 @@
+/*
+ *
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file validation_stack.h
+ *
+ */
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace validation_layer
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    /// Call stack capture and symbolization shared by the checkers that report
+    /// where a call came from. Frames inside the validation layer, the loader and
+    /// the tracing layer are skipped, so the first frame described belongs to the
+    /// application. Stacks are only available on Linux; elsewhere nothing is
+    /// captured and callers fall back to reporting no stack.
+
+    // Raw return addresses of the current thread, innermost first
+    uint32_t captureStack(void **frames, uint32_t maxFrames);
+
+    // Symbolized frames outside of the loader and layers, innermost first, at
+    // most maxDescribed of them
+    std::vector<std::string> describeFrames(void *const *frames, uint32_t frameCount,
+                                            uint32_t maxDescribed = UINT32_MAX);
+
+    // The innermost application frame of the current call, or "unknown"
+    std::string describeCaller();
+} // namespace validation_layer
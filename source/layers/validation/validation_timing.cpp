@@ -0,0 +1,197 @@
+/*
+ *
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file validation_timing.cpp
+ *
+ */
+#include "validation_timing.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+namespace validation_layer
+{
+    // Timing object that thread buffers may still be folded into; cleared when it
+    // is destroyed so threads exiting afterwards leave their buffers alone
+    static std::atomic<checkerTiming *> liveTiming{nullptr};
+
+    ///////////////////////////////////////////////////////////////////////////////
+    checkerTiming::checkerTiming()
+    {
+        liveTiming.store(this, std::memory_order_release);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    checkerTiming::~checkerTiming()
+    {
+        liveTiming.store(nullptr, std::memory_order_release);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    checkerTiming::threadBuffer::threadBuffer()
+    {
+        for (auto &slot : slots) {
+            slot.checkerName = nullptr;
+            slot.apiName = nullptr;
+            slot.phase = timingPhase::prologue;
+            slot.used.store(false, std::memory_order_relaxed);
+            slot.calls.store(0, std::memory_order_relaxed);
+            slot.elapsedNs.store(0, std::memory_order_relaxed);
+        }
+        overflowCalls.store(0, std::memory_order_relaxed);
+        overflowNs.store(0, std::memory_order_relaxed);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    checkerTiming::threadBuffer &checkerTiming::getThreadBuffer()
+    {
+        // Each thread registers its buffer once; when the thread exits the
+        // buffer is folded into retiredRows and freed
+        struct threadBufferOwner {
+            checkerTiming *timing = nullptr;
+            threadBuffer *buffer = nullptr;
+            ~threadBufferOwner() {
+                if (timing && liveTiming.load(std::memory_order_acquire) == timing)
+                    timing->retireThreadBuffer(buffer);
+            }
+        };
+        static thread_local threadBufferOwner owner;
+        if (owner.timing != this) {
+            std::lock_guard<std::mutex> lock(buffersMutex);
+            buffers.emplace_back(new threadBuffer);
+            owner.buffer = buffers.back().get();
+            owner.timing = this;
+        }
+        return *owner.buffer;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    void checkerTiming::retireThreadBuffer(threadBuffer *buffer)
+    {
+        std::lock_guard<std::mutex> lock(buffersMutex);
+        for (size_t i = 0; i < buffers.size(); i++) {
+            if (buffers[i].get() != buffer)
+                continue;
+            mergeBuffer(*buffer, retiredRows);
+            buffers[i] = std::move(buffers.back());
+            buffers.pop_back();
+            return;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    void checkerTiming::record(const char *checkerName, const char *apiName, timingPhase phase, uint64_t elapsedNs)
+    {
+        // Only the owning thread writes its buffer, so updates are a relaxed
+        // load/store and a slot's key is published once through used
+        auto &buffer = getThreadBuffer();
+        uint64_t hash = reinterpret_cast<uintptr_t>(checkerName) * 0x9E3779B97F4A7C15ull;
+        hash = (hash ^ reinterpret_cast<uintptr_t>(apiName)) * 0xC2B2AE3D27D4EB4Full;
+        hash ^= (hash >> 29) ^ static_cast<uint64_t>(phase);
+        for (size_t probe = 0; probe < maxProbes; probe++) {
+            auto &slot = buffer.slots[(hash + probe) & (slotCount - 1)];
+            if (!slot.used.load(std::memory_order_relaxed)) {
+                slot.checkerName = checkerName;
+                slot.apiName = apiName;
+                slot.phase = phase;
+                slot.calls.store(1, std::memory_order_relaxed);
+                slot.elapsedNs.store(elapsedNs, std::memory_order_relaxed);
+                slot.used.store(true, std::memory_order_release);
+                return;
+            }
+            if (slot.checkerName == checkerName && slot.apiName == apiName && slot.phase == phase) {
+                slot.calls.store(slot.calls.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+                slot.elapsedNs.store(slot.elapsedNs.load(std::memory_order_relaxed) + elapsedNs, std::memory_order_relaxed);
+                return;
+            }
+        }
+        buffer.overflowCalls.store(buffer.overflowCalls.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        buffer.overflowNs.store(buffer.overflowNs.load(std::memory_order_relaxed) + elapsedNs, std::memory_order_relaxed);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    void checkerTiming::mergeBuffer(const threadBuffer &buffer, std::map<rowKey, sampleTotals> &rows)
+    {
+        for (auto &slot : buffer.slots) {
+            if (!slot.used.load(std::memory_order_acquire))
+                continue;
+            auto &row = rows[rowKey(slot.checkerName, slot.apiName, slot.phase)];
+            row.calls += slot.calls.load(std::memory_order_relaxed);
+            row.elapsedNs += slot.elapsedNs.load(std::memory_order_relaxed);
+        }
+        auto overflowCalls = buffer.overflowCalls.load(std::memory_order_relaxed);
+        if (overflowCalls) {
+            auto &row = rows[rowKey("(untracked)", "(timing table full)", timingPhase::prologue)];
+            row.calls += overflowCalls;
+            row.elapsedNs += buffer.overflowNs.load(std::memory_order_relaxed);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    static const char *phaseName(timingPhase phase)
+    {
+        switch (phase) {
+        case timingPhase::prologue:
+            return "prologue";
+        case timingPhase::epilogue:
+            return "epilogue";
+        case timingPhase::handleLifetime:
+            return "lifetime";
+        case timingPhase::deferredEpilogue:
+            return "deferred";
+        }
+        return "unknown";
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    std::string checkerTiming::report()
+    {
+        std::map<rowKey, sampleTotals> rows;
+        {
+            std::lock_guard<std::mutex> lock(buffersMutex);
+            rows = retiredRows;
+            for (auto &buffer : buffers)
+                mergeBuffer(*buffer, rows);
+        }
+        std::map<std::string, sampleTotals> checkers;
+        for (auto &row : rows) {
+            auto &checker = checkers[std::get<0>(row.first)];
+            checker.calls += row.second.calls;
+            checker.elapsedNs += row.second.elapsedNs;
+        }
+
+        std::vector<std::pair<std::string, sampleTotals>> rankedCheckers(checkers.begin(), checkers.end());
+        std::sort(rankedCheckers.begin(), rankedCheckers.end(), [](const std::pair<std::string, sampleTotals> &a, const std::pair<std::string, sampleTotals> &b) {
+            return a.second.elapsedNs > b.second.elapsedNs;
+        });
+        std::vector<std::pair<rowKey, sampleTotals>> rankedRows(rows.begin(), rows.end());
+        std::sort(rankedRows.begin(), rankedRows.end(), [](const std::pair<rowKey, sampleTotals> &a, const std::pair<rowKey, sampleTotals> &b) {
+            return a.second.elapsedNs > b.second.elapsedNs;
+        });
+
+        std::ostringstream out;
+        out << "Validation checker overhead\n";
+        out << "----------------------------------------------------------------------------------------------\n";
+        out << std::setw(30) << std::left << "Checker" << std::setw(14) << std::right << "Calls"
+            << std::setw(16) << "Total(us)" << std::setw(12) << "Avg(ns)" << "\n";
+        for (auto &checker : rankedCheckers) {
+            out << std::setw(30) << std::left << checker.first << std::setw(14) << std::right << checker.second.calls
+                << std::setw(16) << checker.second.elapsedNs / 1000
+                << std::setw(12) << checker.second.elapsedNs / std::max<uint64_t>(checker.second.calls, 1) << "\n";
+        }
+        out << "----------------------------------------------------------------------------------------------\n";
+        out << std::setw(30) << std::left << "Checker" << std::setw(40) << "API" << std::setw(10) << "Phase"
+            << std::setw(10) << std::right << "Calls" << std::setw(12) << "Total(us)" << std::setw(10) << "Avg(ns)" << "\n";
+        for (auto &row : rankedRows) {
+            out << std::setw(30) << std::left << std::get<0>(row.first) << std::setw(40) << std::get<1>(row.first)
+                << std::setw(10) << phaseName(std::get<2>(row.first))
+                << std::setw(10) << std::right << row.second.calls << std::setw(12) << row.second.elapsedNs / 1000
+                << std::setw(10) << row.second.elapsedNs / std::max<uint64_t>(row.second.calls, 1) << "\n";
+        }
+        return out.str();
+    }
+} // namespace validation_layer
@@ -0,0 +1,115 @@
+/*
+ *
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file validation_timing.h
+ *
+ */
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace validation_layer
+{
+    enum class timingPhase : uint32_t {
+        prologue,
+        epilogue,
+        handleLifetime,
+        // Epilogue run by the deferred epilogue worker, see validation_deferred.h
+        deferredEpilogue
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// Accumulates time spent in each checker callback, per checker, API and
+    /// phase, when ZEL_VALIDATION_CHECKER_TIMING is set. Each thread records into
+    /// its own fixed table of slots, found by hashing the checker and API name
+    /// pointers, so recording takes no lock and never allocates. Tables are only
+    /// merged when a report is produced, or folded in when their thread exits.
+    class checkerTiming
+    {
+    public:
+        checkerTiming();
+        ~checkerTiming();
+
+        static uint64_t now() {
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+        }
+
+        // checkerName and apiName must be string literals
+        void record(const char *checkerName, const char *apiName, timingPhase phase, uint64_t elapsedNs);
+
+        // Ranked overhead table, most expensive checkers first
+        std::string report();
+
+    private:
+        static constexpr size_t slotCount = 2048;
+        static constexpr size_t maxProbes = 32;
+
+        // Key fields are written once by the owning thread before used is set
+        struct sampleSlot {
+            const char *checkerName;
+            const char *apiName;
+            timingPhase phase;
+            std::atomic<bool> used;
+            std::atomic<uint64_t> calls;
+            std::atomic<uint64_t> elapsedNs;
+        };
+        struct threadBuffer {
+            sampleSlot slots[slotCount];
+            // Samples that found no free slot within maxProbes
+            std::atomic<uint64_t> overflowCalls;
+            std::atomic<uint64_t> overflowNs;
+            threadBuffer();
+        };
+        struct sampleTotals {
+            uint64_t calls = 0;
+            uint64_t elapsedNs = 0;
+        };
+        // Merged by name, as the same literal may have different addresses across translation units
+        using rowKey = std::tuple<std::string, std::string, timingPhase>;
+
+        threadBuffer &getThreadBuffer();
+        void retireThreadBuffer(threadBuffer *buffer);
+        void mergeBuffer(const threadBuffer &buffer, std::map<rowKey, sampleTotals> &rows);
+
+        std::mutex buffersMutex;
+        std::vector<std::unique_ptr<threadBuffer>> buffers;
+        // Totals from threads that have exited
+        std::map<rowKey, sampleTotals> retiredRows;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// Scoped timer around one checker callback; does nothing when timing is null
+    class checkerTimer
+    {
+    public:
+        checkerTimer(checkerTiming *timing, const char *checkerName, const char *apiName, timingPhase phase)
+            : timing(timing), checkerName(checkerName), apiName(apiName), phase(phase) {
+            if (timing)
+                start = checkerTiming::now();
+        }
+        ~checkerTimer() {
+            if (timing)
+                timing->record(checkerName, apiName, phase, checkerTiming::now() - start);
+        }
+        checkerTimer(const checkerTimer &) = delete;
+        checkerTimer &operator=(const checkerTimer &) = delete;
+
+    private:
+        checkerTiming *timing;
+        const char *checkerName;
+        const char *apiName;
+        timingPhase phase;
+        uint64_t start = 0;
+    };
+} // namespace validation_layer
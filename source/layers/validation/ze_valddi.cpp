@@ -23,8 +23,8 @@ namespace validation_layer
     );
 
     static ze_result_t logAndPropagateResult(const char* fname, ze_result_t result) {
-        if (result != ZE_RESULT_SUCCESS) {
-            context.logger->log_trace("Error (" + loader::to_string(result) + ") in " + std::string(fname));
+        if (result != ZE_RESULT_SUCCESS && context.logger->should_log(spdlog::level::trace)) {
+            context.logger->log_trace("Error ({}) in {}", loader::to_string(result), fname);
         }
         return result;
     }
@@ -45,7 +45,10 @@ namespace validation_layer
             return logAndPropagateResult("zeInit", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeInit", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeInitPrologue( flags );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeInit", result);
         }
@@ -57,13 +60,24 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeInit", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeInitPrologue( flags );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeInit", result);
         }
 
         auto driver_result = pfnInit( flags );
 
+        if( driver_result == ZE_RESULT_SUCCESS )
+            context.notifyDdiTablesReady();
+
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeInit", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeInit", [=]() { handler->zeInitEpilogue( flags ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeInitEpilogue( flags ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeInit", result);
         }
@@ -93,7 +107,10 @@ namespace validation_layer
             return logAndPropagateResult("zeDriverGet", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDriverGet", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeDriverGetPrologue( pCount, phDrivers );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDriverGet", result);
         }
@@ -105,6 +122,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeDriverGet", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeDriverGetPrologue( pCount, phDrivers );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDriverGet", result);
         }
@@ -112,6 +130,13 @@ namespace validation_layer
         auto driver_result = pfnGet( pCount, phDrivers );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDriverGet", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeDriverGet", [=]() { handler->zeDriverGetEpilogue( pCount, phDrivers ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeDriverGetEpilogue( pCount, phDrivers ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDriverGet", result);
         }
@@ -153,7 +178,10 @@ namespace validation_layer
             return logAndPropagateResult("zeInitDrivers", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeInitDrivers", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeInitDriversPrologue( pCount, phDrivers, desc );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeInitDrivers", result);
         }
@@ -165,13 +193,24 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeInitDrivers", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeInitDriversPrologue( pCount, phDrivers, desc );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeInitDrivers", result);
         }
 
         auto driver_result = pfnInitDrivers( pCount, phDrivers, desc );
 
+        if( driver_result == ZE_RESULT_SUCCESS )
+            context.notifyDdiTablesReady();
+
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeInitDrivers", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeInitDrivers", [=]() { handler->zeInitDriversEpilogue( pCount, phDrivers, desc ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeInitDriversEpilogue( pCount, phDrivers, desc ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeInitDrivers", result);
         }
@@ -195,7 +234,10 @@ namespace validation_layer
             return logAndPropagateResult("zeDriverGetApiVersion", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDriverGetApiVersion", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeDriverGetApiVersionPrologue( hDriver, version );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDriverGetApiVersion", result);
         }
@@ -207,6 +249,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeDriverGetApiVersion", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeDriverGetApiVersionPrologue( hDriver, version );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDriverGetApiVersion", result);
         }
@@ -214,6 +257,13 @@ namespace validation_layer
         auto driver_result = pfnGetApiVersion( hDriver, version );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDriverGetApiVersion", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeDriverGetApiVersion", [=]() { handler->zeDriverGetApiVersionEpilogue( hDriver, version ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeDriverGetApiVersionEpilogue( hDriver, version ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDriverGetApiVersion", result);
         }
@@ -237,7 +287,10 @@ namespace validation_layer
             return logAndPropagateResult("zeDriverGetProperties", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDriverGetProperties", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeDriverGetPropertiesPrologue( hDriver, pDriverProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDriverGetProperties", result);
         }
@@ -249,6 +302,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeDriverGetProperties", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeDriverGetPropertiesPrologue( hDriver, pDriverProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDriverGetProperties", result);
         }
@@ -256,6 +310,13 @@ namespace validation_layer
         auto driver_result = pfnGetProperties( hDriver, pDriverProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDriverGetProperties", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeDriverGetProperties", [=]() { handler->zeDriverGetPropertiesEpilogue( hDriver, pDriverProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeDriverGetPropertiesEpilogue( hDriver, pDriverProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDriverGetProperties", result);
         }
@@ -279,7 +340,10 @@ namespace validation_layer
             return logAndPropagateResult("zeDriverGetIpcProperties", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDriverGetIpcProperties", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeDriverGetIpcPropertiesPrologue( hDriver, pIpcProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDriverGetIpcProperties", result);
         }
@@ -291,6 +355,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeDriverGetIpcProperties", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeDriverGetIpcPropertiesPrologue( hDriver, pIpcProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDriverGetIpcProperties", result);
         }
@@ -298,6 +363,13 @@ namespace validation_layer
         auto driver_result = pfnGetIpcProperties( hDriver, pIpcProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDriverGetIpcProperties", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeDriverGetIpcProperties", [=]() { handler->zeDriverGetIpcPropertiesEpilogue( hDriver, pIpcProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeDriverGetIpcPropertiesEpilogue( hDriver, pIpcProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDriverGetIpcProperties", result);
         }
@@ -330,7 +402,10 @@ namespace validation_layer
             return logAndPropagateResult("zeDriverGetExtensionProperties", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDriverGetExtensionProperties", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeDriverGetExtensionPropertiesPrologue( hDriver, pCount, pExtensionProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDriverGetExtensionProperties", result);
         }
@@ -342,6 +417,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeDriverGetExtensionProperties", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeDriverGetExtensionPropertiesPrologue( hDriver, pCount, pExtensionProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDriverGetExtensionProperties", result);
         }
@@ -349,6 +425,13 @@ namespace validation_layer
         auto driver_result = pfnGetExtensionProperties( hDriver, pCount, pExtensionProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDriverGetExtensionProperties", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeDriverGetExtensionProperties", [=]() { handler->zeDriverGetExtensionPropertiesEpilogue( hDriver, pCount, pExtensionProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeDriverGetExtensionPropertiesEpilogue( hDriver, pCount, pExtensionProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDriverGetExtensionProperties", result);
         }
@@ -373,7 +456,10 @@ namespace validation_layer
             return logAndPropagateResult("zeDriverGetExtensionFunctionAddress", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDriverGetExtensionFunctionAddress", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeDriverGetExtensionFunctionAddressPrologue( hDriver, name, ppFunctionAddress );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDriverGetExtensionFunctionAddress", result);
         }
@@ -385,6 +471,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeDriverGetExtensionFunctionAddress", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeDriverGetExtensionFunctionAddressPrologue( hDriver, name, ppFunctionAddress );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDriverGetExtensionFunctionAddress", result);
         }
@@ -401,6 +488,13 @@ namespace validation_layer
         }
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDriverGetExtensionFunctionAddress", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeDriverGetExtensionFunctionAddress", [=]() { handler->zeDriverGetExtensionFunctionAddressEpilogue( hDriver, name, ppFunctionAddress ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeDriverGetExtensionFunctionAddressEpilogue( hDriver, name, ppFunctionAddress ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDriverGetExtensionFunctionAddress", result);
         }
@@ -425,7 +519,10 @@ namespace validation_layer
             return logAndPropagateResult("zeDriverGetLastErrorDescription", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDriverGetLastErrorDescription", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeDriverGetLastErrorDescriptionPrologue( hDriver, ppString );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDriverGetLastErrorDescription", result);
         }
@@ -437,6 +534,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeDriverGetLastErrorDescription", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeDriverGetLastErrorDescriptionPrologue( hDriver, ppString );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDriverGetLastErrorDescription", result);
         }
@@ -444,6 +542,13 @@ namespace validation_layer
         auto driver_result = pfnGetLastErrorDescription( hDriver, ppString );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDriverGetLastErrorDescription", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeDriverGetLastErrorDescription", [=]() { handler->zeDriverGetLastErrorDescriptionEpilogue( hDriver, ppString ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeDriverGetLastErrorDescriptionEpilogue( hDriver, ppString ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDriverGetLastErrorDescription", result);
         }
@@ -466,7 +571,10 @@ namespace validation_layer
             return nullptr;
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDriverGetDefaultContext", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeDriverGetDefaultContextPrologue( hDriver );
             if(result!=ZE_RESULT_SUCCESS) return nullptr;
         }
@@ -478,6 +586,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeDriverGetDefaultContext", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeDriverGetDefaultContextPrologue( hDriver );
             if(result!=ZE_RESULT_SUCCESS) return nullptr;
         }
@@ -485,6 +594,13 @@ namespace validation_layer
         auto driver_result = pfnGetDefaultContext( hDriver );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDriverGetDefaultContext", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeDriverGetDefaultContext", [=]() { handler->zeDriverGetDefaultContextEpilogue( hDriver ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeDriverGetDefaultContextEpilogue( hDriver ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return nullptr;
         }
@@ -515,7 +631,10 @@ namespace validation_layer
             return logAndPropagateResult("zeDeviceGet", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDeviceGet", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetPrologue( hDriver, pCount, phDevices );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceGet", result);
         }
@@ -527,6 +646,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeDeviceGet", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceGetPrologue( hDriver, pCount, phDevices );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceGet", result);
         }
@@ -534,6 +654,13 @@ namespace validation_layer
         auto driver_result = pfnGet( hDriver, pCount, phDevices );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDeviceGet", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeDeviceGet", [=]() { handler->zeDeviceGetEpilogue( hDriver, pCount, phDevices ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetEpilogue( hDriver, pCount, phDevices ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceGet", result);
         }
@@ -567,7 +694,10 @@ namespace validation_layer
             return logAndPropagateResult("zeDeviceGetRootDevice", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDeviceGetRootDevice", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetRootDevicePrologue( hDevice, phRootDevice );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceGetRootDevice", result);
         }
@@ -579,6 +709,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeDeviceGetRootDevice", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceGetRootDevicePrologue( hDevice, phRootDevice );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceGetRootDevice", result);
         }
@@ -586,6 +717,13 @@ namespace validation_layer
         auto driver_result = pfnGetRootDevice( hDevice, phRootDevice );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDeviceGetRootDevice", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeDeviceGetRootDevice", [=]() { handler->zeDeviceGetRootDeviceEpilogue( hDevice, phRootDevice ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetRootDeviceEpilogue( hDevice, phRootDevice ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceGetRootDevice", result);
         }
@@ -616,7 +754,10 @@ namespace validation_layer
             return logAndPropagateResult("zeDeviceGetSubDevices", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDeviceGetSubDevices", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetSubDevicesPrologue( hDevice, pCount, phSubdevices );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceGetSubDevices", result);
         }
@@ -628,6 +769,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeDeviceGetSubDevices", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceGetSubDevicesPrologue( hDevice, pCount, phSubdevices );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceGetSubDevices", result);
         }
@@ -635,6 +777,13 @@ namespace validation_layer
         auto driver_result = pfnGetSubDevices( hDevice, pCount, phSubdevices );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDeviceGetSubDevices", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeDeviceGetSubDevices", [=]() { handler->zeDeviceGetSubDevicesEpilogue( hDevice, pCount, phSubdevices ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetSubDevicesEpilogue( hDevice, pCount, phSubdevices ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceGetSubDevices", result);
         }
@@ -668,7 +817,10 @@ namespace validation_layer
             return logAndPropagateResult("zeDeviceGetProperties", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDeviceGetProperties", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetPropertiesPrologue( hDevice, pDeviceProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceGetProperties", result);
         }
@@ -680,6 +832,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeDeviceGetProperties", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceGetPropertiesPrologue( hDevice, pDeviceProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceGetProperties", result);
         }
@@ -687,6 +840,13 @@ namespace validation_layer
         auto driver_result = pfnGetProperties( hDevice, pDeviceProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDeviceGetProperties", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeDeviceGetProperties", [=]() { handler->zeDeviceGetPropertiesEpilogue( hDevice, pDeviceProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetPropertiesEpilogue( hDevice, pDeviceProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceGetProperties", result);
         }
@@ -710,7 +870,10 @@ namespace validation_layer
             return logAndPropagateResult("zeDeviceGetComputeProperties", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDeviceGetComputeProperties", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetComputePropertiesPrologue( hDevice, pComputeProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceGetComputeProperties", result);
         }
@@ -722,6 +885,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeDeviceGetComputeProperties", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceGetComputePropertiesPrologue( hDevice, pComputeProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceGetComputeProperties", result);
         }
@@ -729,6 +893,13 @@ namespace validation_layer
         auto driver_result = pfnGetComputeProperties( hDevice, pComputeProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDeviceGetComputeProperties", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeDeviceGetComputeProperties", [=]() { handler->zeDeviceGetComputePropertiesEpilogue( hDevice, pComputeProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetComputePropertiesEpilogue( hDevice, pComputeProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceGetComputeProperties", result);
         }
@@ -752,7 +923,10 @@ namespace validation_layer
             return logAndPropagateResult("zeDeviceGetModuleProperties", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDeviceGetModuleProperties", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetModulePropertiesPrologue( hDevice, pModuleProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceGetModuleProperties", result);
         }
@@ -764,6 +938,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeDeviceGetModuleProperties", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceGetModulePropertiesPrologue( hDevice, pModuleProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceGetModuleProperties", result);
         }
@@ -771,6 +946,13 @@ namespace validation_layer
         auto driver_result = pfnGetModuleProperties( hDevice, pModuleProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDeviceGetModuleProperties", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeDeviceGetModuleProperties", [=]() { handler->zeDeviceGetModulePropertiesEpilogue( hDevice, pModuleProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetModulePropertiesEpilogue( hDevice, pModuleProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceGetModuleProperties", result);
         }
@@ -808,7 +990,10 @@ namespace validation_layer
             return logAndPropagateResult("zeDeviceGetCommandQueueGroupProperties", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDeviceGetCommandQueueGroupProperties", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetCommandQueueGroupPropertiesPrologue( hDevice, pCount, pCommandQueueGroupProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceGetCommandQueueGroupProperties", result);
         }
@@ -820,6 +1005,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeDeviceGetCommandQueueGroupProperties", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceGetCommandQueueGroupPropertiesPrologue( hDevice, pCount, pCommandQueueGroupProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceGetCommandQueueGroupProperties", result);
         }
@@ -827,6 +1013,13 @@ namespace validation_layer
         auto driver_result = pfnGetCommandQueueGroupProperties( hDevice, pCount, pCommandQueueGroupProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDeviceGetCommandQueueGroupProperties", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeDeviceGetCommandQueueGroupProperties", [=]() { handler->zeDeviceGetCommandQueueGroupPropertiesEpilogue( hDevice, pCount, pCommandQueueGroupProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetCommandQueueGroupPropertiesEpilogue( hDevice, pCount, pCommandQueueGroupProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceGetCommandQueueGroupProperties", result);
         }
@@ -859,7 +1052,10 @@ namespace validation_layer
             return logAndPropagateResult("zeDeviceGetMemoryProperties", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDeviceGetMemoryProperties", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetMemoryPropertiesPrologue( hDevice, pCount, pMemProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceGetMemoryProperties", result);
         }
@@ -871,6 +1067,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeDeviceGetMemoryProperties", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceGetMemoryPropertiesPrologue( hDevice, pCount, pMemProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceGetMemoryProperties", result);
         }
@@ -878,6 +1075,13 @@ namespace validation_layer
         auto driver_result = pfnGetMemoryProperties( hDevice, pCount, pMemProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDeviceGetMemoryProperties", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeDeviceGetMemoryProperties", [=]() { handler->zeDeviceGetMemoryPropertiesEpilogue( hDevice, pCount, pMemProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetMemoryPropertiesEpilogue( hDevice, pCount, pMemProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceGetMemoryProperties", result);
         }
@@ -901,7 +1105,10 @@ namespace validation_layer
             return logAndPropagateResult("zeDeviceGetMemoryAccessProperties", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDeviceGetMemoryAccessProperties", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetMemoryAccessPropertiesPrologue( hDevice, pMemAccessProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceGetMemoryAccessProperties", result);
         }
@@ -913,6 +1120,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeDeviceGetMemoryAccessProperties", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceGetMemoryAccessPropertiesPrologue( hDevice, pMemAccessProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceGetMemoryAccessProperties", result);
         }
@@ -920,6 +1128,13 @@ namespace validation_layer
         auto driver_result = pfnGetMemoryAccessProperties( hDevice, pMemAccessProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDeviceGetMemoryAccessProperties", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeDeviceGetMemoryAccessProperties", [=]() { handler->zeDeviceGetMemoryAccessPropertiesEpilogue( hDevice, pMemAccessProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetMemoryAccessPropertiesEpilogue( hDevice, pMemAccessProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceGetMemoryAccessProperties", result);
         }
@@ -951,7 +1166,10 @@ namespace validation_layer
             return logAndPropagateResult("zeDeviceGetCacheProperties", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDeviceGetCacheProperties", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetCachePropertiesPrologue( hDevice, pCount, pCacheProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceGetCacheProperties", result);
         }
@@ -963,6 +1181,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeDeviceGetCacheProperties", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceGetCachePropertiesPrologue( hDevice, pCount, pCacheProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceGetCacheProperties", result);
         }
@@ -970,6 +1189,13 @@ namespace validation_layer
         auto driver_result = pfnGetCacheProperties( hDevice, pCount, pCacheProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDeviceGetCacheProperties", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeDeviceGetCacheProperties", [=]() { handler->zeDeviceGetCachePropertiesEpilogue( hDevice, pCount, pCacheProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetCachePropertiesEpilogue( hDevice, pCount, pCacheProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceGetCacheProperties", result);
         }
@@ -993,7 +1219,10 @@ namespace validation_layer
             return logAndPropagateResult("zeDeviceGetImageProperties", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDeviceGetImageProperties", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetImagePropertiesPrologue( hDevice, pImageProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceGetImageProperties", result);
         }
@@ -1005,6 +1234,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeDeviceGetImageProperties", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceGetImagePropertiesPrologue( hDevice, pImageProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceGetImageProperties", result);
         }
@@ -1012,6 +1242,13 @@ namespace validation_layer
         auto driver_result = pfnGetImageProperties( hDevice, pImageProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDeviceGetImageProperties", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeDeviceGetImageProperties", [=]() { handler->zeDeviceGetImagePropertiesEpilogue( hDevice, pImageProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetImagePropertiesEpilogue( hDevice, pImageProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceGetImageProperties", result);
         }
@@ -1035,7 +1272,10 @@ namespace validation_layer
             return logAndPropagateResult("zeDeviceGetExternalMemoryProperties", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDeviceGetExternalMemoryProperties", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetExternalMemoryPropertiesPrologue( hDevice, pExternalMemoryProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceGetExternalMemoryProperties", result);
         }
@@ -1047,6 +1287,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeDeviceGetExternalMemoryProperties", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceGetExternalMemoryPropertiesPrologue( hDevice, pExternalMemoryProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceGetExternalMemoryProperties", result);
         }
@@ -1054,6 +1295,13 @@ namespace validation_layer
         auto driver_result = pfnGetExternalMemoryProperties( hDevice, pExternalMemoryProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDeviceGetExternalMemoryProperties", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeDeviceGetExternalMemoryProperties", [=]() { handler->zeDeviceGetExternalMemoryPropertiesEpilogue( hDevice, pExternalMemoryProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetExternalMemoryPropertiesEpilogue( hDevice, pExternalMemoryProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceGetExternalMemoryProperties", result);
         }
@@ -1078,7 +1326,10 @@ namespace validation_layer
             return logAndPropagateResult("zeDeviceGetP2PProperties", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDeviceGetP2PProperties", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetP2PPropertiesPrologue( hDevice, hPeerDevice, pP2PProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceGetP2PProperties", result);
         }
@@ -1090,6 +1341,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeDeviceGetP2PProperties", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceGetP2PPropertiesPrologue( hDevice, hPeerDevice, pP2PProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceGetP2PProperties", result);
         }
@@ -1097,6 +1349,13 @@ namespace validation_layer
         auto driver_result = pfnGetP2PProperties( hDevice, hPeerDevice, pP2PProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDeviceGetP2PProperties", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeDeviceGetP2PProperties", [=]() { handler->zeDeviceGetP2PPropertiesEpilogue( hDevice, hPeerDevice, pP2PProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetP2PPropertiesEpilogue( hDevice, hPeerDevice, pP2PProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceGetP2PProperties", result);
         }
@@ -1121,7 +1380,10 @@ namespace validation_layer
             return logAndPropagateResult("zeDeviceCanAccessPeer", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDeviceCanAccessPeer", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeDeviceCanAccessPeerPrologue( hDevice, hPeerDevice, value );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceCanAccessPeer", result);
         }
@@ -1133,6 +1395,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeDeviceCanAccessPeer", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceCanAccessPeerPrologue( hDevice, hPeerDevice, value );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceCanAccessPeer", result);
         }
@@ -1140,6 +1403,13 @@ namespace validation_layer
         auto driver_result = pfnCanAccessPeer( hDevice, hPeerDevice, value );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDeviceCanAccessPeer", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeDeviceCanAccessPeer", [=]() { handler->zeDeviceCanAccessPeerEpilogue( hDevice, hPeerDevice, value ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeDeviceCanAccessPeerEpilogue( hDevice, hPeerDevice, value ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceCanAccessPeer", result);
         }
@@ -1162,7 +1432,10 @@ namespace validation_layer
             return logAndPropagateResult("zeDeviceGetStatus", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDeviceGetStatus", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetStatusPrologue( hDevice );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceGetStatus", result);
         }
@@ -1174,6 +1447,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeDeviceGetStatus", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceGetStatusPrologue( hDevice );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceGetStatus", result);
         }
@@ -1181,6 +1455,13 @@ namespace validation_layer
         auto driver_result = pfnGetStatus( hDevice );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDeviceGetStatus", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeDeviceGetStatus", [=]() { handler->zeDeviceGetStatusEpilogue( hDevice ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetStatusEpilogue( hDevice ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceGetStatus", result);
         }
@@ -1207,7 +1488,10 @@ namespace validation_layer
             return logAndPropagateResult("zeDeviceGetGlobalTimestamps", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDeviceGetGlobalTimestamps", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetGlobalTimestampsPrologue( hDevice, hostTimestamp, deviceTimestamp );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceGetGlobalTimestamps", result);
         }
@@ -1219,6 +1503,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeDeviceGetGlobalTimestamps", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceGetGlobalTimestampsPrologue( hDevice, hostTimestamp, deviceTimestamp );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceGetGlobalTimestamps", result);
         }
@@ -1226,6 +1511,13 @@ namespace validation_layer
         auto driver_result = pfnGetGlobalTimestamps( hDevice, hostTimestamp, deviceTimestamp );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDeviceGetGlobalTimestamps", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeDeviceGetGlobalTimestamps", [=]() { handler->zeDeviceGetGlobalTimestampsEpilogue( hDevice, hostTimestamp, deviceTimestamp ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetGlobalTimestampsEpilogue( hDevice, hostTimestamp, deviceTimestamp ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceGetGlobalTimestamps", result);
         }
@@ -1248,7 +1540,10 @@ namespace validation_layer
             return logAndPropagateResult("zeDeviceSynchronize", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDeviceSynchronize", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeDeviceSynchronizePrologue( hDevice );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceSynchronize", result);
         }
@@ -1260,6 +1555,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeDeviceSynchronize", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceSynchronizePrologue( hDevice );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceSynchronize", result);
         }
@@ -1267,6 +1563,13 @@ namespace validation_layer
         auto driver_result = pfnSynchronize( hDevice );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDeviceSynchronize", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeDeviceSynchronize", [=]() { handler->zeDeviceSynchronizeEpilogue( hDevice ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeDeviceSynchronizeEpilogue( hDevice ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceSynchronize", result);
         }
@@ -1290,7 +1593,10 @@ namespace validation_layer
             return logAndPropagateResult("zeDeviceGetAggregatedCopyOffloadIncrementValue", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDeviceGetAggregatedCopyOffloadIncrementValue", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetAggregatedCopyOffloadIncrementValuePrologue( hDevice, incrementValue );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceGetAggregatedCopyOffloadIncrementValue", result);
         }
@@ -1302,6 +1608,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeDeviceGetAggregatedCopyOffloadIncrementValue", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceGetAggregatedCopyOffloadIncrementValuePrologue( hDevice, incrementValue );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceGetAggregatedCopyOffloadIncrementValue", result);
         }
@@ -1309,6 +1616,13 @@ namespace validation_layer
         auto driver_result = pfnGetAggregatedCopyOffloadIncrementValue( hDevice, incrementValue );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDeviceGetAggregatedCopyOffloadIncrementValue", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeDeviceGetAggregatedCopyOffloadIncrementValue", [=]() { handler->zeDeviceGetAggregatedCopyOffloadIncrementValueEpilogue( hDevice, incrementValue ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetAggregatedCopyOffloadIncrementValueEpilogue( hDevice, incrementValue ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceGetAggregatedCopyOffloadIncrementValue", result);
         }
@@ -1334,6 +1648,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeContextCreate", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeContextCreatePrologue( hDriver, desc, phContext );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeContextCreate", result);
         }
@@ -1345,6 +1660,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeContextCreate", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeContextCreatePrologue( hDriver, desc, phContext );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeContextCreate", result);
         }
@@ -1352,6 +1668,12 @@ namespace validation_layer
         auto driver_result = pfnCreate( hDriver, desc, phContext );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeContextCreate", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeContextCreate", [=]() { handler->zeContextCreateEpilogue( hDriver, desc, phContext ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeContextCreateEpilogue( hDriver, desc, phContext ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeContextCreate", result);
         }
@@ -1396,6 +1718,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeContextCreateEx", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeContextCreateExPrologue( hDriver, desc, numDevices, phDevices, phContext );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeContextCreateEx", result);
         }
@@ -1407,6 +1730,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeContextCreateEx", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeContextCreateExPrologue( hDriver, desc, numDevices, phDevices, phContext );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeContextCreateEx", result);
         }
@@ -1414,6 +1738,12 @@ namespace validation_layer
         auto driver_result = pfnCreateEx( hDriver, desc, numDevices, phDevices, phContext );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeContextCreateEx", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeContextCreateEx", [=]() { handler->zeContextCreateExEpilogue( hDriver, desc, numDevices, phDevices, phContext ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeContextCreateExEpilogue( hDriver, desc, numDevices, phDevices, phContext ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeContextCreateEx", result);
         }
@@ -1446,6 +1776,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeContextDestroy", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeContextDestroyPrologue( hContext );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeContextDestroy", result);
         }
@@ -1457,6 +1788,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeContextDestroy", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeContextDestroyPrologue( hContext );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeContextDestroy", result);
         }
@@ -1464,6 +1796,12 @@ namespace validation_layer
         auto driver_result = pfnDestroy( hContext );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeContextDestroy", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeContextDestroy", [=]() { handler->zeContextDestroyEpilogue( hContext ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeContextDestroyEpilogue( hContext ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeContextDestroy", result);
         }
@@ -1486,7 +1824,10 @@ namespace validation_layer
             return logAndPropagateResult("zeContextGetStatus", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeContextGetStatus", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeContextGetStatusPrologue( hContext );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeContextGetStatus", result);
         }
@@ -1498,6 +1839,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeContextGetStatus", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeContextGetStatusPrologue( hContext );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeContextGetStatus", result);
         }
@@ -1505,6 +1847,13 @@ namespace validation_layer
         auto driver_result = pfnGetStatus( hContext );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeContextGetStatus", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeContextGetStatus", [=]() { handler->zeContextGetStatusEpilogue( hContext ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeContextGetStatusEpilogue( hContext ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeContextGetStatus", result);
         }
@@ -1531,6 +1880,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandQueueCreate", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeCommandQueueCreatePrologue( hContext, hDevice, desc, phCommandQueue );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandQueueCreate", result);
         }
@@ -1542,6 +1892,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeCommandQueueCreate", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandQueueCreatePrologue( hContext, hDevice, desc, phCommandQueue );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandQueueCreate", result);
         }
@@ -1549,6 +1900,12 @@ namespace validation_layer
         auto driver_result = pfnCreate( hContext, hDevice, desc, phCommandQueue );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandQueueCreate", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeCommandQueueCreate", [=]() { handler->zeCommandQueueCreateEpilogue( hContext, hDevice, desc, phCommandQueue ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeCommandQueueCreateEpilogue( hContext, hDevice, desc, phCommandQueue ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandQueueCreate", result);
         }
@@ -1581,6 +1938,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandQueueDestroy", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeCommandQueueDestroyPrologue( hCommandQueue );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandQueueDestroy", result);
         }
@@ -1592,6 +1950,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeCommandQueueDestroy", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandQueueDestroyPrologue( hCommandQueue );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandQueueDestroy", result);
         }
@@ -1599,6 +1958,12 @@ namespace validation_layer
         auto driver_result = pfnDestroy( hCommandQueue );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandQueueDestroy", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeCommandQueueDestroy", [=]() { handler->zeCommandQueueDestroyEpilogue( hCommandQueue ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeCommandQueueDestroyEpilogue( hCommandQueue ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandQueueDestroy", result);
         }
@@ -1625,7 +1990,10 @@ namespace validation_layer
             return logAndPropagateResult("zeCommandQueueExecuteCommandLists", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandQueueExecuteCommandLists", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeCommandQueueExecuteCommandListsPrologue( hCommandQueue, numCommandLists, phCommandLists, hFence );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandQueueExecuteCommandLists", result);
         }
@@ -1637,6 +2005,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeCommandQueueExecuteCommandLists", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandQueueExecuteCommandListsPrologue( hCommandQueue, numCommandLists, phCommandLists, hFence );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandQueueExecuteCommandLists", result);
         }
@@ -1644,6 +2013,13 @@ namespace validation_layer
         auto driver_result = pfnExecuteCommandLists( hCommandQueue, numCommandLists, phCommandLists, hFence );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandQueueExecuteCommandLists", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeCommandQueueExecuteCommandLists", [=]() { handler->zeCommandQueueExecuteCommandListsEpilogue( hCommandQueue, numCommandLists, phCommandLists, hFence ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeCommandQueueExecuteCommandListsEpilogue( hCommandQueue, numCommandLists, phCommandLists, hFence ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandQueueExecuteCommandLists", result);
         }
@@ -1673,7 +2049,10 @@ namespace validation_layer
             return logAndPropagateResult("zeCommandQueueSynchronize", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandQueueSynchronize", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeCommandQueueSynchronizePrologue( hCommandQueue, timeout );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandQueueSynchronize", result);
         }
@@ -1685,6 +2064,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeCommandQueueSynchronize", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandQueueSynchronizePrologue( hCommandQueue, timeout );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandQueueSynchronize", result);
         }
@@ -1692,6 +2072,13 @@ namespace validation_layer
         auto driver_result = pfnSynchronize( hCommandQueue, timeout );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandQueueSynchronize", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeCommandQueueSynchronize", [=]() { handler->zeCommandQueueSynchronizeEpilogue( hCommandQueue, timeout ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeCommandQueueSynchronizeEpilogue( hCommandQueue, timeout ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandQueueSynchronize", result);
         }
@@ -1715,7 +2102,10 @@ namespace validation_layer
             return logAndPropagateResult("zeCommandQueueGetOrdinal", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandQueueGetOrdinal", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeCommandQueueGetOrdinalPrologue( hCommandQueue, pOrdinal );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandQueueGetOrdinal", result);
         }
@@ -1727,6 +2117,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeCommandQueueGetOrdinal", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandQueueGetOrdinalPrologue( hCommandQueue, pOrdinal );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandQueueGetOrdinal", result);
         }
@@ -1734,6 +2125,13 @@ namespace validation_layer
         auto driver_result = pfnGetOrdinal( hCommandQueue, pOrdinal );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandQueueGetOrdinal", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeCommandQueueGetOrdinal", [=]() { handler->zeCommandQueueGetOrdinalEpilogue( hCommandQueue, pOrdinal ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeCommandQueueGetOrdinalEpilogue( hCommandQueue, pOrdinal ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandQueueGetOrdinal", result);
         }
@@ -1757,7 +2155,10 @@ namespace validation_layer
             return logAndPropagateResult("zeCommandQueueGetIndex", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandQueueGetIndex", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeCommandQueueGetIndexPrologue( hCommandQueue, pIndex );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandQueueGetIndex", result);
         }
@@ -1769,6 +2170,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeCommandQueueGetIndex", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandQueueGetIndexPrologue( hCommandQueue, pIndex );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandQueueGetIndex", result);
         }
@@ -1776,6 +2178,13 @@ namespace validation_layer
         auto driver_result = pfnGetIndex( hCommandQueue, pIndex );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandQueueGetIndex", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeCommandQueueGetIndex", [=]() { handler->zeCommandQueueGetIndexEpilogue( hCommandQueue, pIndex ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeCommandQueueGetIndexEpilogue( hCommandQueue, pIndex ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandQueueGetIndex", result);
         }
@@ -1802,6 +2211,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListCreate", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListCreatePrologue( hContext, hDevice, desc, phCommandList );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListCreate", result);
         }
@@ -1813,6 +2223,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeCommandListCreate", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandListCreatePrologue( hContext, hDevice, desc, phCommandList );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListCreate", result);
         }
@@ -1820,6 +2231,12 @@ namespace validation_layer
         auto driver_result = pfnCreate( hContext, hDevice, desc, phCommandList );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListCreate", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeCommandListCreate", [=]() { handler->zeCommandListCreateEpilogue( hContext, hDevice, desc, phCommandList ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListCreateEpilogue( hContext, hDevice, desc, phCommandList ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListCreate", result);
         }
@@ -1855,6 +2272,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListCreateImmediate", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListCreateImmediatePrologue( hContext, hDevice, altdesc, phCommandList );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListCreateImmediate", result);
         }
@@ -1866,6 +2284,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeCommandListCreateImmediate", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandListCreateImmediatePrologue( hContext, hDevice, altdesc, phCommandList );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListCreateImmediate", result);
         }
@@ -1873,6 +2292,12 @@ namespace validation_layer
         auto driver_result = pfnCreateImmediate( hContext, hDevice, altdesc, phCommandList );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListCreateImmediate", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeCommandListCreateImmediate", [=]() { handler->zeCommandListCreateImmediateEpilogue( hContext, hDevice, altdesc, phCommandList ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListCreateImmediateEpilogue( hContext, hDevice, altdesc, phCommandList ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListCreateImmediate", result);
         }
@@ -1903,6 +2328,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListDestroy", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListDestroyPrologue( hCommandList );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListDestroy", result);
         }
@@ -1914,6 +2340,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeCommandListDestroy", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandListDestroyPrologue( hCommandList );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListDestroy", result);
         }
@@ -1921,6 +2348,12 @@ namespace validation_layer
         auto driver_result = pfnDestroy( hCommandList );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListDestroy", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeCommandListDestroy", [=]() { handler->zeCommandListDestroyEpilogue( hCommandList ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListDestroyEpilogue( hCommandList ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListDestroy", result);
         }
@@ -1943,7 +2376,10 @@ namespace validation_layer
             return logAndPropagateResult("zeCommandListClose", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListClose", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListClosePrologue( hCommandList );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListClose", result);
         }
@@ -1955,6 +2391,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeCommandListClose", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandListClosePrologue( hCommandList );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListClose", result);
         }
@@ -1962,6 +2399,13 @@ namespace validation_layer
         auto driver_result = pfnClose( hCommandList );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListClose", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeCommandListClose", [=]() { handler->zeCommandListCloseEpilogue( hCommandList ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListCloseEpilogue( hCommandList ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListClose", result);
         }
@@ -1984,7 +2428,10 @@ namespace validation_layer
             return logAndPropagateResult("zeCommandListReset", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListReset", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListResetPrologue( hCommandList );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListReset", result);
         }
@@ -1996,6 +2443,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeCommandListReset", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandListResetPrologue( hCommandList );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListReset", result);
         }
@@ -2003,6 +2451,13 @@ namespace validation_layer
         auto driver_result = pfnReset( hCommandList );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListReset", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeCommandListReset", [=]() { handler->zeCommandListResetEpilogue( hCommandList ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListResetEpilogue( hCommandList ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListReset", result);
         }
@@ -2032,7 +2487,10 @@ namespace validation_layer
             return logAndPropagateResult("zeCommandListAppendWriteGlobalTimestamp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListAppendWriteGlobalTimestamp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendWriteGlobalTimestampPrologue( hCommandList, dstptr, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendWriteGlobalTimestamp", result);
         }
@@ -2044,6 +2502,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeCommandListAppendWriteGlobalTimestamp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandListAppendWriteGlobalTimestampPrologue( hCommandList, dstptr, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendWriteGlobalTimestamp", result);
         }
@@ -2051,6 +2510,13 @@ namespace validation_layer
         auto driver_result = pfnAppendWriteGlobalTimestamp( hCommandList, dstptr, hSignalEvent, numWaitEvents, phWaitEvents );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListAppendWriteGlobalTimestamp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeCommandListAppendWriteGlobalTimestamp", [=]() { handler->zeCommandListAppendWriteGlobalTimestampEpilogue( hCommandList, dstptr, hSignalEvent, numWaitEvents, phWaitEvents ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendWriteGlobalTimestampEpilogue( hCommandList, dstptr, hSignalEvent, numWaitEvents, phWaitEvents ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendWriteGlobalTimestamp", result);
         }
@@ -2080,7 +2546,10 @@ namespace validation_layer
             return logAndPropagateResult("zeCommandListHostSynchronize", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListHostSynchronize", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListHostSynchronizePrologue( hCommandList, timeout );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListHostSynchronize", result);
         }
@@ -2092,6 +2561,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeCommandListHostSynchronize", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandListHostSynchronizePrologue( hCommandList, timeout );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListHostSynchronize", result);
         }
@@ -2099,6 +2569,13 @@ namespace validation_layer
         auto driver_result = pfnHostSynchronize( hCommandList, timeout );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListHostSynchronize", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeCommandListHostSynchronize", [=]() { handler->zeCommandListHostSynchronizeEpilogue( hCommandList, timeout ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListHostSynchronizeEpilogue( hCommandList, timeout ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListHostSynchronize", result);
         }
@@ -2122,7 +2599,10 @@ namespace validation_layer
             return logAndPropagateResult("zeCommandListGetDeviceHandle", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListGetDeviceHandle", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListGetDeviceHandlePrologue( hCommandList, phDevice );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListGetDeviceHandle", result);
         }
@@ -2134,6 +2614,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeCommandListGetDeviceHandle", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandListGetDeviceHandlePrologue( hCommandList, phDevice );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListGetDeviceHandle", result);
         }
@@ -2141,6 +2622,13 @@ namespace validation_layer
         auto driver_result = pfnGetDeviceHandle( hCommandList, phDevice );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListGetDeviceHandle", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeCommandListGetDeviceHandle", [=]() { handler->zeCommandListGetDeviceHandleEpilogue( hCommandList, phDevice ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListGetDeviceHandleEpilogue( hCommandList, phDevice ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListGetDeviceHandle", result);
         }
@@ -2164,7 +2652,10 @@ namespace validation_layer
             return logAndPropagateResult("zeCommandListGetContextHandle", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListGetContextHandle", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListGetContextHandlePrologue( hCommandList, phContext );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListGetContextHandle", result);
         }
@@ -2176,6 +2667,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeCommandListGetContextHandle", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandListGetContextHandlePrologue( hCommandList, phContext );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListGetContextHandle", result);
         }
@@ -2183,6 +2675,13 @@ namespace validation_layer
         auto driver_result = pfnGetContextHandle( hCommandList, phContext );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListGetContextHandle", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeCommandListGetContextHandle", [=]() { handler->zeCommandListGetContextHandleEpilogue( hCommandList, phContext ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListGetContextHandleEpilogue( hCommandList, phContext ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListGetContextHandle", result);
         }
@@ -2206,7 +2705,10 @@ namespace validation_layer
             return logAndPropagateResult("zeCommandListGetOrdinal", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListGetOrdinal", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListGetOrdinalPrologue( hCommandList, pOrdinal );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListGetOrdinal", result);
         }
@@ -2218,6 +2720,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeCommandListGetOrdinal", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandListGetOrdinalPrologue( hCommandList, pOrdinal );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListGetOrdinal", result);
         }
@@ -2225,6 +2728,13 @@ namespace validation_layer
         auto driver_result = pfnGetOrdinal( hCommandList, pOrdinal );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListGetOrdinal", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeCommandListGetOrdinal", [=]() { handler->zeCommandListGetOrdinalEpilogue( hCommandList, pOrdinal ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListGetOrdinalEpilogue( hCommandList, pOrdinal ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListGetOrdinal", result);
         }
@@ -2249,7 +2759,10 @@ namespace validation_layer
             return logAndPropagateResult("zeCommandListImmediateGetIndex", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListImmediateGetIndex", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListImmediateGetIndexPrologue( hCommandListImmediate, pIndex );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListImmediateGetIndex", result);
         }
@@ -2261,6 +2774,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeCommandListImmediateGetIndex", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandListImmediateGetIndexPrologue( hCommandListImmediate, pIndex );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListImmediateGetIndex", result);
         }
@@ -2268,6 +2782,13 @@ namespace validation_layer
         auto driver_result = pfnImmediateGetIndex( hCommandListImmediate, pIndex );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListImmediateGetIndex", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeCommandListImmediateGetIndex", [=]() { handler->zeCommandListImmediateGetIndexEpilogue( hCommandListImmediate, pIndex ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListImmediateGetIndexEpilogue( hCommandListImmediate, pIndex ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListImmediateGetIndex", result);
         }
@@ -2292,7 +2813,10 @@ namespace validation_layer
             return logAndPropagateResult("zeCommandListIsImmediate", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListIsImmediate", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListIsImmediatePrologue( hCommandList, pIsImmediate );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListIsImmediate", result);
         }
@@ -2304,6 +2828,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeCommandListIsImmediate", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandListIsImmediatePrologue( hCommandList, pIsImmediate );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListIsImmediate", result);
         }
@@ -2311,6 +2836,13 @@ namespace validation_layer
         auto driver_result = pfnIsImmediate( hCommandList, pIsImmediate );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListIsImmediate", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeCommandListIsImmediate", [=]() { handler->zeCommandListIsImmediateEpilogue( hCommandList, pIsImmediate ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListIsImmediateEpilogue( hCommandList, pIsImmediate ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListIsImmediate", result);
         }
@@ -2338,7 +2870,10 @@ namespace validation_layer
             return logAndPropagateResult("zeCommandListAppendBarrier", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListAppendBarrier", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendBarrierPrologue( hCommandList, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendBarrier", result);
         }
@@ -2350,6 +2885,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeCommandListAppendBarrier", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandListAppendBarrierPrologue( hCommandList, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendBarrier", result);
         }
@@ -2357,6 +2893,13 @@ namespace validation_layer
         auto driver_result = pfnAppendBarrier( hCommandList, hSignalEvent, numWaitEvents, phWaitEvents );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListAppendBarrier", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeCommandListAppendBarrier", [=]() { handler->zeCommandListAppendBarrierEpilogue( hCommandList, hSignalEvent, numWaitEvents, phWaitEvents ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendBarrierEpilogue( hCommandList, hSignalEvent, numWaitEvents, phWaitEvents ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendBarrier", result);
         }
@@ -2387,7 +2930,10 @@ namespace validation_layer
             return logAndPropagateResult("zeCommandListAppendMemoryRangesBarrier", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListAppendMemoryRangesBarrier", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendMemoryRangesBarrierPrologue( hCommandList, numRanges, pRangeSizes, pRanges, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendMemoryRangesBarrier", result);
         }
@@ -2399,6 +2945,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeCommandListAppendMemoryRangesBarrier", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandListAppendMemoryRangesBarrierPrologue( hCommandList, numRanges, pRangeSizes, pRanges, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendMemoryRangesBarrier", result);
         }
@@ -2406,6 +2953,13 @@ namespace validation_layer
         auto driver_result = pfnAppendMemoryRangesBarrier( hCommandList, numRanges, pRangeSizes, pRanges, hSignalEvent, numWaitEvents, phWaitEvents );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListAppendMemoryRangesBarrier", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeCommandListAppendMemoryRangesBarrier", [=]() { handler->zeCommandListAppendMemoryRangesBarrierEpilogue( hCommandList, numRanges, pRangeSizes, pRanges, hSignalEvent, numWaitEvents, phWaitEvents ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendMemoryRangesBarrierEpilogue( hCommandList, numRanges, pRangeSizes, pRanges, hSignalEvent, numWaitEvents, phWaitEvents ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendMemoryRangesBarrier", result);
         }
@@ -2429,7 +2983,10 @@ namespace validation_layer
             return logAndPropagateResult("zeContextSystemBarrier", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeContextSystemBarrier", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeContextSystemBarrierPrologue( hContext, hDevice );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeContextSystemBarrier", result);
         }
@@ -2441,6 +2998,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeContextSystemBarrier", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeContextSystemBarrierPrologue( hContext, hDevice );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeContextSystemBarrier", result);
         }
@@ -2448,6 +3006,13 @@ namespace validation_layer
         auto driver_result = pfnSystemBarrier( hContext, hDevice );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeContextSystemBarrier", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeContextSystemBarrier", [=]() { handler->zeContextSystemBarrierEpilogue( hContext, hDevice ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeContextSystemBarrierEpilogue( hContext, hDevice ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeContextSystemBarrier", result);
         }
@@ -2478,7 +3043,10 @@ namespace validation_layer
             return logAndPropagateResult("zeCommandListAppendMemoryCopy", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListAppendMemoryCopy", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendMemoryCopyPrologue( hCommandList, dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendMemoryCopy", result);
         }
@@ -2490,6 +3058,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeCommandListAppendMemoryCopy", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandListAppendMemoryCopyPrologue( hCommandList, dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendMemoryCopy", result);
         }
@@ -2497,6 +3066,13 @@ namespace validation_layer
         auto driver_result = pfnAppendMemoryCopy( hCommandList, dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListAppendMemoryCopy", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeCommandListAppendMemoryCopy", [=]() { handler->zeCommandListAppendMemoryCopyEpilogue( hCommandList, dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendMemoryCopyEpilogue( hCommandList, dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendMemoryCopy", result);
         }
@@ -2528,7 +3104,10 @@ namespace validation_layer
             return logAndPropagateResult("zeCommandListAppendMemoryFill", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListAppendMemoryFill", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendMemoryFillPrologue( hCommandList, ptr, pattern, pattern_size, size, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendMemoryFill", result);
         }
@@ -2540,6 +3119,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeCommandListAppendMemoryFill", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandListAppendMemoryFillPrologue( hCommandList, ptr, pattern, pattern_size, size, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendMemoryFill", result);
         }
@@ -2547,6 +3127,13 @@ namespace validation_layer
         auto driver_result = pfnAppendMemoryFill( hCommandList, ptr, pattern, pattern_size, size, hSignalEvent, numWaitEvents, phWaitEvents );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListAppendMemoryFill", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeCommandListAppendMemoryFill", [=]() { handler->zeCommandListAppendMemoryFillEpilogue( hCommandList, ptr, pattern, pattern_size, size, hSignalEvent, numWaitEvents, phWaitEvents ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendMemoryFillEpilogue( hCommandList, ptr, pattern, pattern_size, size, hSignalEvent, numWaitEvents, phWaitEvents ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendMemoryFill", result);
         }
@@ -2586,7 +3173,10 @@ namespace validation_layer
             return logAndPropagateResult("zeCommandListAppendMemoryCopyRegion", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListAppendMemoryCopyRegion", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendMemoryCopyRegionPrologue( hCommandList, dstptr, dstRegion, dstPitch, dstSlicePitch, srcptr, srcRegion, srcPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendMemoryCopyRegion", result);
         }
@@ -2598,6 +3188,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeCommandListAppendMemoryCopyRegion", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandListAppendMemoryCopyRegionPrologue( hCommandList, dstptr, dstRegion, dstPitch, dstSlicePitch, srcptr, srcRegion, srcPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendMemoryCopyRegion", result);
         }
@@ -2605,6 +3196,13 @@ namespace validation_layer
         auto driver_result = pfnAppendMemoryCopyRegion( hCommandList, dstptr, dstRegion, dstPitch, dstSlicePitch, srcptr, srcRegion, srcPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListAppendMemoryCopyRegion", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeCommandListAppendMemoryCopyRegion", [=]() { handler->zeCommandListAppendMemoryCopyRegionEpilogue( hCommandList, dstptr, dstRegion, dstPitch, dstSlicePitch, srcptr, srcRegion, srcPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendMemoryCopyRegionEpilogue( hCommandList, dstptr, dstRegion, dstPitch, dstSlicePitch, srcptr, srcRegion, srcPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendMemoryCopyRegion", result);
         }
@@ -2636,7 +3234,10 @@ namespace validation_layer
             return logAndPropagateResult("zeCommandListAppendMemoryCopyFromContext", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListAppendMemoryCopyFromContext", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendMemoryCopyFromContextPrologue( hCommandList, dstptr, hContextSrc, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendMemoryCopyFromContext", result);
         }
@@ -2648,6 +3249,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeCommandListAppendMemoryCopyFromContext", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandListAppendMemoryCopyFromContextPrologue( hCommandList, dstptr, hContextSrc, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendMemoryCopyFromContext", result);
         }
@@ -2655,6 +3257,13 @@ namespace validation_layer
         auto driver_result = pfnAppendMemoryCopyFromContext( hCommandList, dstptr, hContextSrc, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListAppendMemoryCopyFromContext", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeCommandListAppendMemoryCopyFromContext", [=]() { handler->zeCommandListAppendMemoryCopyFromContextEpilogue( hCommandList, dstptr, hContextSrc, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendMemoryCopyFromContextEpilogue( hCommandList, dstptr, hContextSrc, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendMemoryCopyFromContext", result);
         }
@@ -2684,7 +3293,10 @@ namespace validation_layer
             return logAndPropagateResult("zeCommandListAppendImageCopy", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListAppendImageCopy", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendImageCopyPrologue( hCommandList, hDstImage, hSrcImage, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendImageCopy", result);
         }
@@ -2696,6 +3308,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeCommandListAppendImageCopy", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandListAppendImageCopyPrologue( hCommandList, hDstImage, hSrcImage, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendImageCopy", result);
         }
@@ -2703,6 +3316,13 @@ namespace validation_layer
         auto driver_result = pfnAppendImageCopy( hCommandList, hDstImage, hSrcImage, hSignalEvent, numWaitEvents, phWaitEvents );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListAppendImageCopy", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeCommandListAppendImageCopy", [=]() { handler->zeCommandListAppendImageCopyEpilogue( hCommandList, hDstImage, hSrcImage, hSignalEvent, numWaitEvents, phWaitEvents ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendImageCopyEpilogue( hCommandList, hDstImage, hSrcImage, hSignalEvent, numWaitEvents, phWaitEvents ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendImageCopy", result);
         }
@@ -2734,7 +3354,10 @@ namespace validation_layer
             return logAndPropagateResult("zeCommandListAppendImageCopyRegion", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListAppendImageCopyRegion", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendImageCopyRegionPrologue( hCommandList, hDstImage, hSrcImage, pDstRegion, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendImageCopyRegion", result);
         }
@@ -2746,6 +3369,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeCommandListAppendImageCopyRegion", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandListAppendImageCopyRegionPrologue( hCommandList, hDstImage, hSrcImage, pDstRegion, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendImageCopyRegion", result);
         }
@@ -2753,6 +3377,13 @@ namespace validation_layer
         auto driver_result = pfnAppendImageCopyRegion( hCommandList, hDstImage, hSrcImage, pDstRegion, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListAppendImageCopyRegion", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeCommandListAppendImageCopyRegion", [=]() { handler->zeCommandListAppendImageCopyRegionEpilogue( hCommandList, hDstImage, hSrcImage, pDstRegion, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendImageCopyRegionEpilogue( hCommandList, hDstImage, hSrcImage, pDstRegion, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendImageCopyRegion", result);
         }
@@ -2783,7 +3414,10 @@ namespace validation_layer
             return logAndPropagateResult("zeCommandListAppendImageCopyToMemory", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListAppendImageCopyToMemory", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendImageCopyToMemoryPrologue( hCommandList, dstptr, hSrcImage, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendImageCopyToMemory", result);
         }
@@ -2795,6 +3429,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeCommandListAppendImageCopyToMemory", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandListAppendImageCopyToMemoryPrologue( hCommandList, dstptr, hSrcImage, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendImageCopyToMemory", result);
         }
@@ -2802,6 +3437,13 @@ namespace validation_layer
         auto driver_result = pfnAppendImageCopyToMemory( hCommandList, dstptr, hSrcImage, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListAppendImageCopyToMemory", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeCommandListAppendImageCopyToMemory", [=]() { handler->zeCommandListAppendImageCopyToMemoryEpilogue( hCommandList, dstptr, hSrcImage, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendImageCopyToMemoryEpilogue( hCommandList, dstptr, hSrcImage, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendImageCopyToMemory", result);
         }
@@ -2832,7 +3474,10 @@ namespace validation_layer
             return logAndPropagateResult("zeCommandListAppendImageCopyFromMemory", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListAppendImageCopyFromMemory", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendImageCopyFromMemoryPrologue( hCommandList, hDstImage, srcptr, pDstRegion, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendImageCopyFromMemory", result);
         }
@@ -2844,6 +3489,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeCommandListAppendImageCopyFromMemory", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandListAppendImageCopyFromMemoryPrologue( hCommandList, hDstImage, srcptr, pDstRegion, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendImageCopyFromMemory", result);
         }
@@ -2851,6 +3497,13 @@ namespace validation_layer
         auto driver_result = pfnAppendImageCopyFromMemory( hCommandList, hDstImage, srcptr, pDstRegion, hSignalEvent, numWaitEvents, phWaitEvents );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListAppendImageCopyFromMemory", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeCommandListAppendImageCopyFromMemory", [=]() { handler->zeCommandListAppendImageCopyFromMemoryEpilogue( hCommandList, hDstImage, srcptr, pDstRegion, hSignalEvent, numWaitEvents, phWaitEvents ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendImageCopyFromMemoryEpilogue( hCommandList, hDstImage, srcptr, pDstRegion, hSignalEvent, numWaitEvents, phWaitEvents ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendImageCopyFromMemory", result);
         }
@@ -2875,7 +3528,10 @@ namespace validation_layer
             return logAndPropagateResult("zeCommandListAppendMemoryPrefetch", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListAppendMemoryPrefetch", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendMemoryPrefetchPrologue( hCommandList, ptr, size );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendMemoryPrefetch", result);
         }
@@ -2887,6 +3543,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeCommandListAppendMemoryPrefetch", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandListAppendMemoryPrefetchPrologue( hCommandList, ptr, size );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendMemoryPrefetch", result);
         }
@@ -2894,6 +3551,13 @@ namespace validation_layer
         auto driver_result = pfnAppendMemoryPrefetch( hCommandList, ptr, size );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListAppendMemoryPrefetch", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeCommandListAppendMemoryPrefetch", [=]() { handler->zeCommandListAppendMemoryPrefetchEpilogue( hCommandList, ptr, size ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendMemoryPrefetchEpilogue( hCommandList, ptr, size ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendMemoryPrefetch", result);
         }
@@ -2920,7 +3584,10 @@ namespace validation_layer
             return logAndPropagateResult("zeCommandListAppendMemAdvise", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListAppendMemAdvise", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendMemAdvisePrologue( hCommandList, hDevice, ptr, size, advice );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendMemAdvise", result);
         }
@@ -2932,6 +3599,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeCommandListAppendMemAdvise", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandListAppendMemAdvisePrologue( hCommandList, hDevice, ptr, size, advice );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendMemAdvise", result);
         }
@@ -2939,6 +3607,13 @@ namespace validation_layer
         auto driver_result = pfnAppendMemAdvise( hCommandList, hDevice, ptr, size, advice );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListAppendMemAdvise", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeCommandListAppendMemAdvise", [=]() { handler->zeCommandListAppendMemAdviseEpilogue( hCommandList, hDevice, ptr, size, advice ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendMemAdviseEpilogue( hCommandList, hDevice, ptr, size, advice ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendMemAdvise", result);
         }
@@ -2970,6 +3645,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeEventPoolCreate", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeEventPoolCreatePrologue( hContext, desc, numDevices, phDevices, phEventPool );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventPoolCreate", result);
         }
@@ -2981,6 +3657,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeEventPoolCreate", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeEventPoolCreatePrologue( hContext, desc, numDevices, phDevices, phEventPool );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventPoolCreate", result);
         }
@@ -2988,6 +3665,12 @@ namespace validation_layer
         auto driver_result = pfnCreate( hContext, desc, numDevices, phDevices, phEventPool );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeEventPoolCreate", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeEventPoolCreate", [=]() { handler->zeEventPoolCreateEpilogue( hContext, desc, numDevices, phDevices, phEventPool ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeEventPoolCreateEpilogue( hContext, desc, numDevices, phDevices, phEventPool ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventPoolCreate", result);
         }
@@ -3020,6 +3703,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeEventPoolDestroy", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeEventPoolDestroyPrologue( hEventPool );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventPoolDestroy", result);
         }
@@ -3031,6 +3715,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeEventPoolDestroy", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeEventPoolDestroyPrologue( hEventPool );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventPoolDestroy", result);
         }
@@ -3038,6 +3723,12 @@ namespace validation_layer
         auto driver_result = pfnDestroy( hEventPool );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeEventPoolDestroy", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeEventPoolDestroy", [=]() { handler->zeEventPoolDestroyEpilogue( hEventPool ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeEventPoolDestroyEpilogue( hEventPool ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventPoolDestroy", result);
         }
@@ -3063,6 +3754,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeEventCreate", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeEventCreatePrologue( hEventPool, desc, phEvent );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventCreate", result);
         }
@@ -3074,6 +3766,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeEventCreate", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeEventCreatePrologue( hEventPool, desc, phEvent );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventCreate", result);
         }
@@ -3081,6 +3774,12 @@ namespace validation_layer
         auto driver_result = pfnCreate( hEventPool, desc, phEvent );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeEventCreate", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeEventCreate", [=]() { handler->zeEventCreateEpilogue( hEventPool, desc, phEvent ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeEventCreateEpilogue( hEventPool, desc, phEvent ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventCreate", result);
         }
@@ -3116,6 +3815,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeEventCounterBasedCreate", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeEventCounterBasedCreatePrologue( hContext, hDevice, desc, phEvent );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventCounterBasedCreate", result);
         }
@@ -3127,6 +3827,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeEventCounterBasedCreate", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeEventCounterBasedCreatePrologue( hContext, hDevice, desc, phEvent );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventCounterBasedCreate", result);
         }
@@ -3134,6 +3835,12 @@ namespace validation_layer
         auto driver_result = pfnCounterBasedCreate( hContext, hDevice, desc, phEvent );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeEventCounterBasedCreate", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeEventCounterBasedCreate", [=]() { handler->zeEventCounterBasedCreateEpilogue( hContext, hDevice, desc, phEvent ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeEventCounterBasedCreateEpilogue( hContext, hDevice, desc, phEvent ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventCounterBasedCreate", result);
         }
@@ -3166,6 +3873,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeEventDestroy", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeEventDestroyPrologue( hEvent );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventDestroy", result);
         }
@@ -3177,6 +3885,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeEventDestroy", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeEventDestroyPrologue( hEvent );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventDestroy", result);
         }
@@ -3184,6 +3893,12 @@ namespace validation_layer
         auto driver_result = pfnDestroy( hEvent );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeEventDestroy", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeEventDestroy", [=]() { handler->zeEventDestroyEpilogue( hEvent ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeEventDestroyEpilogue( hEvent ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventDestroy", result);
         }
@@ -3207,7 +3922,10 @@ namespace validation_layer
             return logAndPropagateResult("zeEventPoolGetIpcHandle", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeEventPoolGetIpcHandle", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeEventPoolGetIpcHandlePrologue( hEventPool, phIpc );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventPoolGetIpcHandle", result);
         }
@@ -3219,6 +3937,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeEventPoolGetIpcHandle", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeEventPoolGetIpcHandlePrologue( hEventPool, phIpc );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventPoolGetIpcHandle", result);
         }
@@ -3226,6 +3945,13 @@ namespace validation_layer
         auto driver_result = pfnGetIpcHandle( hEventPool, phIpc );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeEventPoolGetIpcHandle", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeEventPoolGetIpcHandle", [=]() { handler->zeEventPoolGetIpcHandleEpilogue( hEventPool, phIpc ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeEventPoolGetIpcHandleEpilogue( hEventPool, phIpc ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventPoolGetIpcHandle", result);
         }
@@ -3254,7 +3980,10 @@ namespace validation_layer
             return logAndPropagateResult("zeEventPoolPutIpcHandle", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeEventPoolPutIpcHandle", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeEventPoolPutIpcHandlePrologue( hContext, hIpc );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventPoolPutIpcHandle", result);
         }
@@ -3266,6 +3995,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeEventPoolPutIpcHandle", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeEventPoolPutIpcHandlePrologue( hContext, hIpc );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventPoolPutIpcHandle", result);
         }
@@ -3273,6 +4003,13 @@ namespace validation_layer
         auto driver_result = pfnPutIpcHandle( hContext, hIpc );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeEventPoolPutIpcHandle", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeEventPoolPutIpcHandle", [=]() { handler->zeEventPoolPutIpcHandleEpilogue( hContext, hIpc ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeEventPoolPutIpcHandleEpilogue( hContext, hIpc ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventPoolPutIpcHandle", result);
         }
@@ -3298,7 +4035,10 @@ namespace validation_layer
             return logAndPropagateResult("zeEventPoolOpenIpcHandle", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeEventPoolOpenIpcHandle", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeEventPoolOpenIpcHandlePrologue( hContext, hIpc, phEventPool );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventPoolOpenIpcHandle", result);
         }
@@ -3310,6 +4050,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeEventPoolOpenIpcHandle", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeEventPoolOpenIpcHandlePrologue( hContext, hIpc, phEventPool );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventPoolOpenIpcHandle", result);
         }
@@ -3317,6 +4058,13 @@ namespace validation_layer
         auto driver_result = pfnOpenIpcHandle( hContext, hIpc, phEventPool );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeEventPoolOpenIpcHandle", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeEventPoolOpenIpcHandle", [=]() { handler->zeEventPoolOpenIpcHandleEpilogue( hContext, hIpc, phEventPool ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeEventPoolOpenIpcHandleEpilogue( hContext, hIpc, phEventPool ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventPoolOpenIpcHandle", result);
         }
@@ -3339,7 +4087,10 @@ namespace validation_layer
             return logAndPropagateResult("zeEventPoolCloseIpcHandle", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeEventPoolCloseIpcHandle", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeEventPoolCloseIpcHandlePrologue( hEventPool );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventPoolCloseIpcHandle", result);
         }
@@ -3351,6 +4102,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeEventPoolCloseIpcHandle", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeEventPoolCloseIpcHandlePrologue( hEventPool );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventPoolCloseIpcHandle", result);
         }
@@ -3358,6 +4110,13 @@ namespace validation_layer
         auto driver_result = pfnCloseIpcHandle( hEventPool );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeEventPoolCloseIpcHandle", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeEventPoolCloseIpcHandle", [=]() { handler->zeEventPoolCloseIpcHandleEpilogue( hEventPool ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeEventPoolCloseIpcHandleEpilogue( hEventPool ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventPoolCloseIpcHandle", result);
         }
@@ -3381,7 +4140,10 @@ namespace validation_layer
             return logAndPropagateResult("zeEventCounterBasedGetIpcHandle", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeEventCounterBasedGetIpcHandle", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeEventCounterBasedGetIpcHandlePrologue( hEvent, phIpc );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventCounterBasedGetIpcHandle", result);
         }
@@ -3393,6 +4155,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeEventCounterBasedGetIpcHandle", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeEventCounterBasedGetIpcHandlePrologue( hEvent, phIpc );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventCounterBasedGetIpcHandle", result);
         }
@@ -3400,6 +4163,13 @@ namespace validation_layer
         auto driver_result = pfnCounterBasedGetIpcHandle( hEvent, phIpc );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeEventCounterBasedGetIpcHandle", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeEventCounterBasedGetIpcHandle", [=]() { handler->zeEventCounterBasedGetIpcHandleEpilogue( hEvent, phIpc ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeEventCounterBasedGetIpcHandleEpilogue( hEvent, phIpc ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventCounterBasedGetIpcHandle", result);
         }
@@ -3429,7 +4199,10 @@ namespace validation_layer
             return logAndPropagateResult("zeEventCounterBasedOpenIpcHandle", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeEventCounterBasedOpenIpcHandle", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeEventCounterBasedOpenIpcHandlePrologue( hContext, hIpc, phEvent );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventCounterBasedOpenIpcHandle", result);
         }
@@ -3441,6 +4214,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeEventCounterBasedOpenIpcHandle", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeEventCounterBasedOpenIpcHandlePrologue( hContext, hIpc, phEvent );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventCounterBasedOpenIpcHandle", result);
         }
@@ -3448,6 +4222,13 @@ namespace validation_layer
         auto driver_result = pfnCounterBasedOpenIpcHandle( hContext, hIpc, phEvent );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeEventCounterBasedOpenIpcHandle", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeEventCounterBasedOpenIpcHandle", [=]() { handler->zeEventCounterBasedOpenIpcHandleEpilogue( hContext, hIpc, phEvent ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeEventCounterBasedOpenIpcHandleEpilogue( hContext, hIpc, phEvent ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventCounterBasedOpenIpcHandle", result);
         }
@@ -3470,7 +4251,10 @@ namespace validation_layer
             return logAndPropagateResult("zeEventCounterBasedCloseIpcHandle", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeEventCounterBasedCloseIpcHandle", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeEventCounterBasedCloseIpcHandlePrologue( hEvent );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventCounterBasedCloseIpcHandle", result);
         }
@@ -3482,6 +4266,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeEventCounterBasedCloseIpcHandle", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeEventCounterBasedCloseIpcHandlePrologue( hEvent );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventCounterBasedCloseIpcHandle", result);
         }
@@ -3489,6 +4274,13 @@ namespace validation_layer
         auto driver_result = pfnCounterBasedCloseIpcHandle( hEvent );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeEventCounterBasedCloseIpcHandle", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeEventCounterBasedCloseIpcHandle", [=]() { handler->zeEventCounterBasedCloseIpcHandleEpilogue( hEvent ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeEventCounterBasedCloseIpcHandleEpilogue( hEvent ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventCounterBasedCloseIpcHandle", result);
         }
@@ -3513,7 +4305,10 @@ namespace validation_layer
             return logAndPropagateResult("zeEventCounterBasedGetDeviceAddress", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeEventCounterBasedGetDeviceAddress", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeEventCounterBasedGetDeviceAddressPrologue( hEvent, completionValue, deviceAddress );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventCounterBasedGetDeviceAddress", result);
         }
@@ -3525,6 +4320,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeEventCounterBasedGetDeviceAddress", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeEventCounterBasedGetDeviceAddressPrologue( hEvent, completionValue, deviceAddress );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventCounterBasedGetDeviceAddress", result);
         }
@@ -3532,6 +4328,13 @@ namespace validation_layer
         auto driver_result = pfnCounterBasedGetDeviceAddress( hEvent, completionValue, deviceAddress );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeEventCounterBasedGetDeviceAddress", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeEventCounterBasedGetDeviceAddress", [=]() { handler->zeEventCounterBasedGetDeviceAddressEpilogue( hEvent, completionValue, deviceAddress ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeEventCounterBasedGetDeviceAddressEpilogue( hEvent, completionValue, deviceAddress ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventCounterBasedGetDeviceAddress", result);
         }
@@ -3555,7 +4358,10 @@ namespace validation_layer
             return logAndPropagateResult("zeCommandListAppendSignalEvent", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListAppendSignalEvent", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendSignalEventPrologue( hCommandList, hEvent );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendSignalEvent", result);
         }
@@ -3567,6 +4373,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeCommandListAppendSignalEvent", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandListAppendSignalEventPrologue( hCommandList, hEvent );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendSignalEvent", result);
         }
@@ -3574,6 +4381,13 @@ namespace validation_layer
         auto driver_result = pfnAppendSignalEvent( hCommandList, hEvent );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListAppendSignalEvent", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeCommandListAppendSignalEvent", [=]() { handler->zeCommandListAppendSignalEventEpilogue( hCommandList, hEvent ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendSignalEventEpilogue( hCommandList, hEvent ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendSignalEvent", result);
         }
@@ -3599,7 +4413,10 @@ namespace validation_layer
             return logAndPropagateResult("zeCommandListAppendWaitOnEvents", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListAppendWaitOnEvents", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendWaitOnEventsPrologue( hCommandList, numEvents, phEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendWaitOnEvents", result);
         }
@@ -3611,6 +4428,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeCommandListAppendWaitOnEvents", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandListAppendWaitOnEventsPrologue( hCommandList, numEvents, phEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendWaitOnEvents", result);
         }
@@ -3618,6 +4436,13 @@ namespace validation_layer
         auto driver_result = pfnAppendWaitOnEvents( hCommandList, numEvents, phEvents );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListAppendWaitOnEvents", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeCommandListAppendWaitOnEvents", [=]() { handler->zeCommandListAppendWaitOnEventsEpilogue( hCommandList, numEvents, phEvents ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendWaitOnEventsEpilogue( hCommandList, numEvents, phEvents ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendWaitOnEvents", result);
         }
@@ -3640,7 +4465,10 @@ namespace validation_layer
             return logAndPropagateResult("zeEventHostSignal", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeEventHostSignal", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeEventHostSignalPrologue( hEvent );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventHostSignal", result);
         }
@@ -3652,6 +4480,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeEventHostSignal", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeEventHostSignalPrologue( hEvent );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventHostSignal", result);
         }
@@ -3659,6 +4488,13 @@ namespace validation_layer
         auto driver_result = pfnHostSignal( hEvent );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeEventHostSignal", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeEventHostSignal", [=]() { handler->zeEventHostSignalEpilogue( hEvent ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeEventHostSignalEpilogue( hEvent ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventHostSignal", result);
         }
@@ -3688,7 +4524,10 @@ namespace validation_layer
             return logAndPropagateResult("zeEventHostSynchronize", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeEventHostSynchronize", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeEventHostSynchronizePrologue( hEvent, timeout );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventHostSynchronize", result);
         }
@@ -3700,6 +4539,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeEventHostSynchronize", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeEventHostSynchronizePrologue( hEvent, timeout );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventHostSynchronize", result);
         }
@@ -3707,6 +4547,13 @@ namespace validation_layer
         auto driver_result = pfnHostSynchronize( hEvent, timeout );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeEventHostSynchronize", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeEventHostSynchronize", [=]() { handler->zeEventHostSynchronizeEpilogue( hEvent, timeout ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeEventHostSynchronizeEpilogue( hEvent, timeout ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventHostSynchronize", result);
         }
@@ -3729,7 +4576,10 @@ namespace validation_layer
             return logAndPropagateResult("zeEventQueryStatus", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeEventQueryStatus", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeEventQueryStatusPrologue( hEvent );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventQueryStatus", result);
         }
@@ -3741,6 +4591,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeEventQueryStatus", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeEventQueryStatusPrologue( hEvent );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventQueryStatus", result);
         }
@@ -3748,6 +4599,13 @@ namespace validation_layer
         auto driver_result = pfnQueryStatus( hEvent );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeEventQueryStatus", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeEventQueryStatus", [=]() { handler->zeEventQueryStatusEpilogue( hEvent ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeEventQueryStatusEpilogue( hEvent ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventQueryStatus", result);
         }
@@ -3771,7 +4629,10 @@ namespace validation_layer
             return logAndPropagateResult("zeCommandListAppendEventReset", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListAppendEventReset", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendEventResetPrologue( hCommandList, hEvent );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendEventReset", result);
         }
@@ -3783,6 +4644,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeCommandListAppendEventReset", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandListAppendEventResetPrologue( hCommandList, hEvent );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendEventReset", result);
         }
@@ -3790,6 +4652,13 @@ namespace validation_layer
         auto driver_result = pfnAppendEventReset( hCommandList, hEvent );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListAppendEventReset", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeCommandListAppendEventReset", [=]() { handler->zeCommandListAppendEventResetEpilogue( hCommandList, hEvent ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendEventResetEpilogue( hCommandList, hEvent ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendEventReset", result);
         }
@@ -3812,7 +4681,10 @@ namespace validation_layer
             return logAndPropagateResult("zeEventHostReset", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeEventHostReset", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeEventHostResetPrologue( hEvent );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventHostReset", result);
         }
@@ -3824,6 +4696,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeEventHostReset", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeEventHostResetPrologue( hEvent );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventHostReset", result);
         }
@@ -3831,6 +4704,13 @@ namespace validation_layer
         auto driver_result = pfnHostReset( hEvent );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeEventHostReset", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeEventHostReset", [=]() { handler->zeEventHostResetEpilogue( hEvent ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeEventHostResetEpilogue( hEvent ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventHostReset", result);
         }
@@ -3854,7 +4734,10 @@ namespace validation_layer
             return logAndPropagateResult("zeEventQueryKernelTimestamp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeEventQueryKernelTimestamp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeEventQueryKernelTimestampPrologue( hEvent, dstptr );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventQueryKernelTimestamp", result);
         }
@@ -3866,6 +4749,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeEventQueryKernelTimestamp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeEventQueryKernelTimestampPrologue( hEvent, dstptr );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventQueryKernelTimestamp", result);
         }
@@ -3873,6 +4757,13 @@ namespace validation_layer
         auto driver_result = pfnQueryKernelTimestamp( hEvent, dstptr );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeEventQueryKernelTimestamp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeEventQueryKernelTimestamp", [=]() { handler->zeEventQueryKernelTimestampEpilogue( hEvent, dstptr ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeEventQueryKernelTimestampEpilogue( hEvent, dstptr ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventQueryKernelTimestamp", result);
         }
@@ -3907,7 +4798,10 @@ namespace validation_layer
             return logAndPropagateResult("zeCommandListAppendQueryKernelTimestamps", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListAppendQueryKernelTimestamps", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendQueryKernelTimestampsPrologue( hCommandList, numEvents, phEvents, dstptr, pOffsets, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendQueryKernelTimestamps", result);
         }
@@ -3919,6 +4813,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeCommandListAppendQueryKernelTimestamps", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandListAppendQueryKernelTimestampsPrologue( hCommandList, numEvents, phEvents, dstptr, pOffsets, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendQueryKernelTimestamps", result);
         }
@@ -3926,6 +4821,13 @@ namespace validation_layer
         auto driver_result = pfnAppendQueryKernelTimestamps( hCommandList, numEvents, phEvents, dstptr, pOffsets, hSignalEvent, numWaitEvents, phWaitEvents );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListAppendQueryKernelTimestamps", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeCommandListAppendQueryKernelTimestamps", [=]() { handler->zeCommandListAppendQueryKernelTimestampsEpilogue( hCommandList, numEvents, phEvents, dstptr, pOffsets, hSignalEvent, numWaitEvents, phWaitEvents ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendQueryKernelTimestampsEpilogue( hCommandList, numEvents, phEvents, dstptr, pOffsets, hSignalEvent, numWaitEvents, phWaitEvents ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendQueryKernelTimestamps", result);
         }
@@ -3949,7 +4851,10 @@ namespace validation_layer
             return logAndPropagateResult("zeEventGetEventPool", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeEventGetEventPool", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeEventGetEventPoolPrologue( hEvent, phEventPool );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventGetEventPool", result);
         }
@@ -3961,6 +4866,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeEventGetEventPool", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeEventGetEventPoolPrologue( hEvent, phEventPool );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventGetEventPool", result);
         }
@@ -3968,6 +4874,13 @@ namespace validation_layer
         auto driver_result = pfnGetEventPool( hEvent, phEventPool );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeEventGetEventPool", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeEventGetEventPool", [=]() { handler->zeEventGetEventPoolEpilogue( hEvent, phEventPool ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeEventGetEventPoolEpilogue( hEvent, phEventPool ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventGetEventPool", result);
         }
@@ -3993,7 +4906,10 @@ namespace validation_layer
             return logAndPropagateResult("zeEventGetSignalScope", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeEventGetSignalScope", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeEventGetSignalScopePrologue( hEvent, pSignalScope );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventGetSignalScope", result);
         }
@@ -4005,6 +4921,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeEventGetSignalScope", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeEventGetSignalScopePrologue( hEvent, pSignalScope );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventGetSignalScope", result);
         }
@@ -4012,6 +4929,13 @@ namespace validation_layer
         auto driver_result = pfnGetSignalScope( hEvent, pSignalScope );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeEventGetSignalScope", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeEventGetSignalScope", [=]() { handler->zeEventGetSignalScopeEpilogue( hEvent, pSignalScope ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeEventGetSignalScopeEpilogue( hEvent, pSignalScope ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventGetSignalScope", result);
         }
@@ -4037,7 +4961,10 @@ namespace validation_layer
             return logAndPropagateResult("zeEventGetWaitScope", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeEventGetWaitScope", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeEventGetWaitScopePrologue( hEvent, pWaitScope );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventGetWaitScope", result);
         }
@@ -4049,6 +4976,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeEventGetWaitScope", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeEventGetWaitScopePrologue( hEvent, pWaitScope );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventGetWaitScope", result);
         }
@@ -4056,6 +4984,13 @@ namespace validation_layer
         auto driver_result = pfnGetWaitScope( hEvent, pWaitScope );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeEventGetWaitScope", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeEventGetWaitScope", [=]() { handler->zeEventGetWaitScopeEpilogue( hEvent, pWaitScope ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeEventGetWaitScopeEpilogue( hEvent, pWaitScope ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventGetWaitScope", result);
         }
@@ -4079,7 +5014,10 @@ namespace validation_layer
             return logAndPropagateResult("zeEventPoolGetContextHandle", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeEventPoolGetContextHandle", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeEventPoolGetContextHandlePrologue( hEventPool, phContext );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventPoolGetContextHandle", result);
         }
@@ -4091,6 +5029,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeEventPoolGetContextHandle", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeEventPoolGetContextHandlePrologue( hEventPool, phContext );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventPoolGetContextHandle", result);
         }
@@ -4098,6 +5037,13 @@ namespace validation_layer
         auto driver_result = pfnGetContextHandle( hEventPool, phContext );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeEventPoolGetContextHandle", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeEventPoolGetContextHandle", [=]() { handler->zeEventPoolGetContextHandleEpilogue( hEventPool, phContext ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeEventPoolGetContextHandleEpilogue( hEventPool, phContext ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventPoolGetContextHandle", result);
         }
@@ -4122,7 +5068,10 @@ namespace validation_layer
             return logAndPropagateResult("zeEventPoolGetFlags", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeEventPoolGetFlags", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeEventPoolGetFlagsPrologue( hEventPool, pFlags );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventPoolGetFlags", result);
         }
@@ -4134,6 +5083,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeEventPoolGetFlags", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeEventPoolGetFlagsPrologue( hEventPool, pFlags );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventPoolGetFlags", result);
         }
@@ -4141,6 +5091,13 @@ namespace validation_layer
         auto driver_result = pfnGetFlags( hEventPool, pFlags );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeEventPoolGetFlags", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeEventPoolGetFlags", [=]() { handler->zeEventPoolGetFlagsEpilogue( hEventPool, pFlags ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeEventPoolGetFlagsEpilogue( hEventPool, pFlags ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventPoolGetFlags", result);
         }
@@ -4166,6 +5123,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeFenceCreate", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeFenceCreatePrologue( hCommandQueue, desc, phFence );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeFenceCreate", result);
         }
@@ -4177,6 +5135,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeFenceCreate", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeFenceCreatePrologue( hCommandQueue, desc, phFence );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeFenceCreate", result);
         }
@@ -4184,6 +5143,12 @@ namespace validation_layer
         auto driver_result = pfnCreate( hCommandQueue, desc, phFence );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeFenceCreate", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeFenceCreate", [=]() { handler->zeFenceCreateEpilogue( hCommandQueue, desc, phFence ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeFenceCreateEpilogue( hCommandQueue, desc, phFence ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeFenceCreate", result);
         }
@@ -4216,6 +5181,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeFenceDestroy", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeFenceDestroyPrologue( hFence );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeFenceDestroy", result);
         }
@@ -4227,6 +5193,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeFenceDestroy", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeFenceDestroyPrologue( hFence );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeFenceDestroy", result);
         }
@@ -4234,6 +5201,12 @@ namespace validation_layer
         auto driver_result = pfnDestroy( hFence );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeFenceDestroy", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeFenceDestroy", [=]() { handler->zeFenceDestroyEpilogue( hFence ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeFenceDestroyEpilogue( hFence ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeFenceDestroy", result);
         }
@@ -4263,7 +5236,10 @@ namespace validation_layer
             return logAndPropagateResult("zeFenceHostSynchronize", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeFenceHostSynchronize", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeFenceHostSynchronizePrologue( hFence, timeout );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeFenceHostSynchronize", result);
         }
@@ -4275,6 +5251,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeFenceHostSynchronize", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeFenceHostSynchronizePrologue( hFence, timeout );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeFenceHostSynchronize", result);
         }
@@ -4282,6 +5259,13 @@ namespace validation_layer
         auto driver_result = pfnHostSynchronize( hFence, timeout );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeFenceHostSynchronize", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeFenceHostSynchronize", [=]() { handler->zeFenceHostSynchronizeEpilogue( hFence, timeout ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeFenceHostSynchronizeEpilogue( hFence, timeout ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeFenceHostSynchronize", result);
         }
@@ -4304,7 +5288,10 @@ namespace validation_layer
             return logAndPropagateResult("zeFenceQueryStatus", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeFenceQueryStatus", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeFenceQueryStatusPrologue( hFence );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeFenceQueryStatus", result);
         }
@@ -4316,6 +5303,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeFenceQueryStatus", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeFenceQueryStatusPrologue( hFence );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeFenceQueryStatus", result);
         }
@@ -4323,6 +5311,13 @@ namespace validation_layer
         auto driver_result = pfnQueryStatus( hFence );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeFenceQueryStatus", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeFenceQueryStatus", [=]() { handler->zeFenceQueryStatusEpilogue( hFence ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeFenceQueryStatusEpilogue( hFence ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeFenceQueryStatus", result);
         }
@@ -4345,7 +5340,10 @@ namespace validation_layer
             return logAndPropagateResult("zeFenceReset", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeFenceReset", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeFenceResetPrologue( hFence );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeFenceReset", result);
         }
@@ -4357,6 +5355,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeFenceReset", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeFenceResetPrologue( hFence );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeFenceReset", result);
         }
@@ -4364,6 +5363,13 @@ namespace validation_layer
         auto driver_result = pfnReset( hFence );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeFenceReset", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeFenceReset", [=]() { handler->zeFenceResetEpilogue( hFence ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeFenceResetEpilogue( hFence ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeFenceReset", result);
         }
@@ -4388,7 +5394,10 @@ namespace validation_layer
             return logAndPropagateResult("zeImageGetProperties", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeImageGetProperties", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeImageGetPropertiesPrologue( hDevice, desc, pImageProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeImageGetProperties", result);
         }
@@ -4400,6 +5409,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeImageGetProperties", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeImageGetPropertiesPrologue( hDevice, desc, pImageProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeImageGetProperties", result);
         }
@@ -4407,6 +5417,13 @@ namespace validation_layer
         auto driver_result = pfnGetProperties( hDevice, desc, pImageProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeImageGetProperties", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeImageGetProperties", [=]() { handler->zeImageGetPropertiesEpilogue( hDevice, desc, pImageProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeImageGetPropertiesEpilogue( hDevice, desc, pImageProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeImageGetProperties", result);
         }
@@ -4433,6 +5450,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeImageCreate", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeImageCreatePrologue( hContext, hDevice, desc, phImage );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeImageCreate", result);
         }
@@ -4444,6 +5462,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeImageCreate", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeImageCreatePrologue( hContext, hDevice, desc, phImage );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeImageCreate", result);
         }
@@ -4451,6 +5470,12 @@ namespace validation_layer
         auto driver_result = pfnCreate( hContext, hDevice, desc, phImage );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeImageCreate", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeImageCreate", [=]() { handler->zeImageCreateEpilogue( hContext, hDevice, desc, phImage ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeImageCreateEpilogue( hContext, hDevice, desc, phImage ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeImageCreate", result);
         }
@@ -4483,6 +5508,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeImageDestroy", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeImageDestroyPrologue( hImage );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeImageDestroy", result);
         }
@@ -4494,6 +5520,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeImageDestroy", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeImageDestroyPrologue( hImage );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeImageDestroy", result);
         }
@@ -4501,6 +5528,12 @@ namespace validation_layer
         auto driver_result = pfnDestroy( hImage );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeImageDestroy", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeImageDestroy", [=]() { handler->zeImageDestroyEpilogue( hImage ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeImageDestroyEpilogue( hImage ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeImageDestroy", result);
         }
@@ -4532,6 +5565,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeMemAllocShared", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeMemAllocSharedPrologue( hContext, device_desc, host_desc, size, alignment, hDevice, pptr );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeMemAllocShared", result);
         }
@@ -4543,6 +5577,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeMemAllocShared", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeMemAllocSharedPrologue( hContext, device_desc, host_desc, size, alignment, hDevice, pptr );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeMemAllocShared", result);
         }
@@ -4550,6 +5585,12 @@ namespace validation_layer
         auto driver_result = pfnAllocShared( hContext, device_desc, host_desc, size, alignment, hDevice, pptr );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeMemAllocShared", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeMemAllocShared", [=]() { handler->zeMemAllocSharedEpilogue( hContext, device_desc, host_desc, size, alignment, hDevice, pptr ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeMemAllocSharedEpilogue( hContext, device_desc, host_desc, size, alignment, hDevice, pptr ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeMemAllocShared", result);
         }
@@ -4580,6 +5621,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeMemAllocDevice", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeMemAllocDevicePrologue( hContext, device_desc, size, alignment, hDevice, pptr );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeMemAllocDevice", result);
         }
@@ -4591,6 +5633,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeMemAllocDevice", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeMemAllocDevicePrologue( hContext, device_desc, size, alignment, hDevice, pptr );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeMemAllocDevice", result);
         }
@@ -4598,6 +5641,12 @@ namespace validation_layer
         auto driver_result = pfnAllocDevice( hContext, device_desc, size, alignment, hDevice, pptr );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeMemAllocDevice", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeMemAllocDevice", [=]() { handler->zeMemAllocDeviceEpilogue( hContext, device_desc, size, alignment, hDevice, pptr ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeMemAllocDeviceEpilogue( hContext, device_desc, size, alignment, hDevice, pptr ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeMemAllocDevice", result);
         }
@@ -4627,6 +5676,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeMemAllocHost", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeMemAllocHostPrologue( hContext, host_desc, size, alignment, pptr );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeMemAllocHost", result);
         }
@@ -4638,6 +5688,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeMemAllocHost", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeMemAllocHostPrologue( hContext, host_desc, size, alignment, pptr );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeMemAllocHost", result);
         }
@@ -4645,6 +5696,12 @@ namespace validation_layer
         auto driver_result = pfnAllocHost( hContext, host_desc, size, alignment, pptr );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeMemAllocHost", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeMemAllocHost", [=]() { handler->zeMemAllocHostEpilogue( hContext, host_desc, size, alignment, pptr ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeMemAllocHostEpilogue( hContext, host_desc, size, alignment, pptr ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeMemAllocHost", result);
         }
@@ -4669,6 +5726,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeMemFree", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeMemFreePrologue( hContext, ptr );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeMemFree", result);
         }
@@ -4680,6 +5738,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeMemFree", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeMemFreePrologue( hContext, ptr );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeMemFree", result);
         }
@@ -4687,6 +5746,12 @@ namespace validation_layer
         auto driver_result = pfnFree( hContext, ptr );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeMemFree", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeMemFree", [=]() { handler->zeMemFreeEpilogue( hContext, ptr ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeMemFreeEpilogue( hContext, ptr ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeMemFree", result);
         }
@@ -4712,7 +5777,10 @@ namespace validation_layer
             return logAndPropagateResult("zeMemGetAllocProperties", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeMemGetAllocProperties", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeMemGetAllocPropertiesPrologue( hContext, ptr, pMemAllocProperties, phDevice );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeMemGetAllocProperties", result);
         }
@@ -4724,6 +5792,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeMemGetAllocProperties", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeMemGetAllocPropertiesPrologue( hContext, ptr, pMemAllocProperties, phDevice );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeMemGetAllocProperties", result);
         }
@@ -4731,6 +5800,13 @@ namespace validation_layer
         auto driver_result = pfnGetAllocProperties( hContext, ptr, pMemAllocProperties, phDevice );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeMemGetAllocProperties", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeMemGetAllocProperties", [=]() { handler->zeMemGetAllocPropertiesEpilogue( hContext, ptr, pMemAllocProperties, phDevice ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeMemGetAllocPropertiesEpilogue( hContext, ptr, pMemAllocProperties, phDevice ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeMemGetAllocProperties", result);
         }
@@ -4756,7 +5832,10 @@ namespace validation_layer
             return logAndPropagateResult("zeMemGetAddressRange", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeMemGetAddressRange", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeMemGetAddressRangePrologue( hContext, ptr, pBase, pSize );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeMemGetAddressRange", result);
         }
@@ -4768,6 +5847,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeMemGetAddressRange", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeMemGetAddressRangePrologue( hContext, ptr, pBase, pSize );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeMemGetAddressRange", result);
         }
@@ -4775,6 +5855,13 @@ namespace validation_layer
         auto driver_result = pfnGetAddressRange( hContext, ptr, pBase, pSize );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeMemGetAddressRange", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeMemGetAddressRange", [=]() { handler->zeMemGetAddressRangeEpilogue( hContext, ptr, pBase, pSize ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeMemGetAddressRangeEpilogue( hContext, ptr, pBase, pSize ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeMemGetAddressRange", result);
         }
@@ -4799,7 +5886,10 @@ namespace validation_layer
             return logAndPropagateResult("zeMemGetIpcHandle", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeMemGetIpcHandle", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeMemGetIpcHandlePrologue( hContext, ptr, pIpcHandle );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeMemGetIpcHandle", result);
         }
@@ -4811,6 +5901,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeMemGetIpcHandle", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeMemGetIpcHandlePrologue( hContext, ptr, pIpcHandle );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeMemGetIpcHandle", result);
         }
@@ -4818,6 +5909,13 @@ namespace validation_layer
         auto driver_result = pfnGetIpcHandle( hContext, ptr, pIpcHandle );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeMemGetIpcHandle", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeMemGetIpcHandle", [=]() { handler->zeMemGetIpcHandleEpilogue( hContext, ptr, pIpcHandle ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeMemGetIpcHandleEpilogue( hContext, ptr, pIpcHandle ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeMemGetIpcHandle", result);
         }
@@ -4846,7 +5944,10 @@ namespace validation_layer
             return logAndPropagateResult("zeMemGetIpcHandleFromFileDescriptorExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeMemGetIpcHandleFromFileDescriptorExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeMemGetIpcHandleFromFileDescriptorExpPrologue( hContext, handle, pIpcHandle );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeMemGetIpcHandleFromFileDescriptorExp", result);
         }
@@ -4858,6 +5959,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeMemGetIpcHandleFromFileDescriptorExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeMemGetIpcHandleFromFileDescriptorExpPrologue( hContext, handle, pIpcHandle );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeMemGetIpcHandleFromFileDescriptorExp", result);
         }
@@ -4865,6 +5967,13 @@ namespace validation_layer
         auto driver_result = pfnGetIpcHandleFromFileDescriptorExp( hContext, handle, pIpcHandle );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeMemGetIpcHandleFromFileDescriptorExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeMemGetIpcHandleFromFileDescriptorExp", [=]() { handler->zeMemGetIpcHandleFromFileDescriptorExpEpilogue( hContext, handle, pIpcHandle ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeMemGetIpcHandleFromFileDescriptorExpEpilogue( hContext, handle, pIpcHandle ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeMemGetIpcHandleFromFileDescriptorExp", result);
         }
@@ -4893,7 +6002,10 @@ namespace validation_layer
             return logAndPropagateResult("zeMemGetFileDescriptorFromIpcHandleExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeMemGetFileDescriptorFromIpcHandleExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeMemGetFileDescriptorFromIpcHandleExpPrologue( hContext, ipcHandle, pHandle );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeMemGetFileDescriptorFromIpcHandleExp", result);
         }
@@ -4905,6 +6017,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeMemGetFileDescriptorFromIpcHandleExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeMemGetFileDescriptorFromIpcHandleExpPrologue( hContext, ipcHandle, pHandle );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeMemGetFileDescriptorFromIpcHandleExp", result);
         }
@@ -4912,6 +6025,13 @@ namespace validation_layer
         auto driver_result = pfnGetFileDescriptorFromIpcHandleExp( hContext, ipcHandle, pHandle );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeMemGetFileDescriptorFromIpcHandleExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeMemGetFileDescriptorFromIpcHandleExp", [=]() { handler->zeMemGetFileDescriptorFromIpcHandleExpEpilogue( hContext, ipcHandle, pHandle ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeMemGetFileDescriptorFromIpcHandleExpEpilogue( hContext, ipcHandle, pHandle ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeMemGetFileDescriptorFromIpcHandleExp", result);
         }
@@ -4939,7 +6059,10 @@ namespace validation_layer
             return logAndPropagateResult("zeMemPutIpcHandle", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeMemPutIpcHandle", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeMemPutIpcHandlePrologue( hContext, handle );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeMemPutIpcHandle", result);
         }
@@ -4951,6 +6074,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeMemPutIpcHandle", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeMemPutIpcHandlePrologue( hContext, handle );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeMemPutIpcHandle", result);
         }
@@ -4958,6 +6082,13 @@ namespace validation_layer
         auto driver_result = pfnPutIpcHandle( hContext, handle );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeMemPutIpcHandle", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeMemPutIpcHandle", [=]() { handler->zeMemPutIpcHandleEpilogue( hContext, handle ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeMemPutIpcHandleEpilogue( hContext, handle ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeMemPutIpcHandle", result);
         }
@@ -4985,7 +6116,10 @@ namespace validation_layer
             return logAndPropagateResult("zeMemOpenIpcHandle", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeMemOpenIpcHandle", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeMemOpenIpcHandlePrologue( hContext, hDevice, handle, flags, pptr );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeMemOpenIpcHandle", result);
         }
@@ -4997,6 +6131,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeMemOpenIpcHandle", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeMemOpenIpcHandlePrologue( hContext, hDevice, handle, flags, pptr );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeMemOpenIpcHandle", result);
         }
@@ -5004,6 +6139,13 @@ namespace validation_layer
         auto driver_result = pfnOpenIpcHandle( hContext, hDevice, handle, flags, pptr );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeMemOpenIpcHandle", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeMemOpenIpcHandle", [=]() { handler->zeMemOpenIpcHandleEpilogue( hContext, hDevice, handle, flags, pptr ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeMemOpenIpcHandleEpilogue( hContext, hDevice, handle, flags, pptr ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeMemOpenIpcHandle", result);
         }
@@ -5027,7 +6169,10 @@ namespace validation_layer
             return logAndPropagateResult("zeMemCloseIpcHandle", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeMemCloseIpcHandle", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeMemCloseIpcHandlePrologue( hContext, ptr );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeMemCloseIpcHandle", result);
         }
@@ -5039,6 +6184,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeMemCloseIpcHandle", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeMemCloseIpcHandlePrologue( hContext, ptr );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeMemCloseIpcHandle", result);
         }
@@ -5046,6 +6192,13 @@ namespace validation_layer
         auto driver_result = pfnCloseIpcHandle( hContext, ptr );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeMemCloseIpcHandle", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeMemCloseIpcHandle", [=]() { handler->zeMemCloseIpcHandleEpilogue( hContext, ptr ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeMemCloseIpcHandleEpilogue( hContext, ptr ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeMemCloseIpcHandle", result);
         }
@@ -5073,7 +6226,10 @@ namespace validation_layer
             return logAndPropagateResult("zeMemSetAtomicAccessAttributeExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeMemSetAtomicAccessAttributeExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeMemSetAtomicAccessAttributeExpPrologue( hContext, hDevice, ptr, size, attr );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeMemSetAtomicAccessAttributeExp", result);
         }
@@ -5085,6 +6241,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeMemSetAtomicAccessAttributeExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeMemSetAtomicAccessAttributeExpPrologue( hContext, hDevice, ptr, size, attr );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeMemSetAtomicAccessAttributeExp", result);
         }
@@ -5092,6 +6249,13 @@ namespace validation_layer
         auto driver_result = pfnSetAtomicAccessAttributeExp( hContext, hDevice, ptr, size, attr );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeMemSetAtomicAccessAttributeExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeMemSetAtomicAccessAttributeExp", [=]() { handler->zeMemSetAtomicAccessAttributeExpEpilogue( hContext, hDevice, ptr, size, attr ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeMemSetAtomicAccessAttributeExpEpilogue( hContext, hDevice, ptr, size, attr ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeMemSetAtomicAccessAttributeExp", result);
         }
@@ -5118,7 +6282,10 @@ namespace validation_layer
             return logAndPropagateResult("zeMemGetAtomicAccessAttributeExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeMemGetAtomicAccessAttributeExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeMemGetAtomicAccessAttributeExpPrologue( hContext, hDevice, ptr, size, pAttr );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeMemGetAtomicAccessAttributeExp", result);
         }
@@ -5130,6 +6297,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeMemGetAtomicAccessAttributeExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeMemGetAtomicAccessAttributeExpPrologue( hContext, hDevice, ptr, size, pAttr );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeMemGetAtomicAccessAttributeExp", result);
         }
@@ -5137,6 +6305,13 @@ namespace validation_layer
         auto driver_result = pfnGetAtomicAccessAttributeExp( hContext, hDevice, ptr, size, pAttr );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeMemGetAtomicAccessAttributeExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeMemGetAtomicAccessAttributeExp", [=]() { handler->zeMemGetAtomicAccessAttributeExpEpilogue( hContext, hDevice, ptr, size, pAttr ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeMemGetAtomicAccessAttributeExpEpilogue( hContext, hDevice, ptr, size, pAttr ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeMemGetAtomicAccessAttributeExp", result);
         }
@@ -5168,6 +6343,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeModuleCreate", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeModuleCreatePrologue( hContext, hDevice, desc, phModule, phBuildLog );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeModuleCreate", result);
         }
@@ -5179,6 +6355,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeModuleCreate", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeModuleCreatePrologue( hContext, hDevice, desc, phModule, phBuildLog );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeModuleCreate", result);
         }
@@ -5186,6 +6363,12 @@ namespace validation_layer
         auto driver_result = pfnCreate( hContext, hDevice, desc, phModule, phBuildLog );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeModuleCreate", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeModuleCreate", [=]() { handler->zeModuleCreateEpilogue( hContext, hDevice, desc, phModule, phBuildLog ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeModuleCreateEpilogue( hContext, hDevice, desc, phModule, phBuildLog ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeModuleCreate", result);
         }
@@ -5223,6 +6406,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeModuleDestroy", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeModuleDestroyPrologue( hModule );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeModuleDestroy", result);
         }
@@ -5234,6 +6418,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeModuleDestroy", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeModuleDestroyPrologue( hModule );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeModuleDestroy", result);
         }
@@ -5241,6 +6426,12 @@ namespace validation_layer
         auto driver_result = pfnDestroy( hModule );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeModuleDestroy", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeModuleDestroy", [=]() { handler->zeModuleDestroyEpilogue( hModule ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeModuleDestroyEpilogue( hModule ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeModuleDestroy", result);
         }
@@ -5266,7 +6457,10 @@ namespace validation_layer
             return logAndPropagateResult("zeModuleDynamicLink", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeModuleDynamicLink", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeModuleDynamicLinkPrologue( numModules, phModules, phLinkLog );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeModuleDynamicLink", result);
         }
@@ -5278,6 +6472,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeModuleDynamicLink", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeModuleDynamicLinkPrologue( numModules, phModules, phLinkLog );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeModuleDynamicLink", result);
         }
@@ -5285,6 +6480,13 @@ namespace validation_layer
         auto driver_result = pfnDynamicLink( numModules, phModules, phLinkLog );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeModuleDynamicLink", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeModuleDynamicLink", [=]() { handler->zeModuleDynamicLinkEpilogue( numModules, phModules, phLinkLog ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeModuleDynamicLinkEpilogue( numModules, phModules, phLinkLog ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeModuleDynamicLink", result);
         }
@@ -5308,6 +6510,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeModuleBuildLogDestroy", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeModuleBuildLogDestroyPrologue( hModuleBuildLog );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeModuleBuildLogDestroy", result);
         }
@@ -5319,6 +6522,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeModuleBuildLogDestroy", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeModuleBuildLogDestroyPrologue( hModuleBuildLog );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeModuleBuildLogDestroy", result);
         }
@@ -5326,6 +6530,12 @@ namespace validation_layer
         auto driver_result = pfnDestroy( hModuleBuildLog );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeModuleBuildLogDestroy", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeModuleBuildLogDestroy", [=]() { handler->zeModuleBuildLogDestroyEpilogue( hModuleBuildLog ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeModuleBuildLogDestroyEpilogue( hModuleBuildLog ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeModuleBuildLogDestroy", result);
         }
@@ -5350,7 +6560,10 @@ namespace validation_layer
             return logAndPropagateResult("zeModuleBuildLogGetString", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeModuleBuildLogGetString", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeModuleBuildLogGetStringPrologue( hModuleBuildLog, pSize, pBuildLog );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeModuleBuildLogGetString", result);
         }
@@ -5362,6 +6575,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeModuleBuildLogGetString", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeModuleBuildLogGetStringPrologue( hModuleBuildLog, pSize, pBuildLog );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeModuleBuildLogGetString", result);
         }
@@ -5369,6 +6583,13 @@ namespace validation_layer
         auto driver_result = pfnGetString( hModuleBuildLog, pSize, pBuildLog );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeModuleBuildLogGetString", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeModuleBuildLogGetString", [=]() { handler->zeModuleBuildLogGetStringEpilogue( hModuleBuildLog, pSize, pBuildLog ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeModuleBuildLogGetStringEpilogue( hModuleBuildLog, pSize, pBuildLog ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeModuleBuildLogGetString", result);
         }
@@ -5393,7 +6614,10 @@ namespace validation_layer
             return logAndPropagateResult("zeModuleGetNativeBinary", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeModuleGetNativeBinary", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeModuleGetNativeBinaryPrologue( hModule, pSize, pModuleNativeBinary );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeModuleGetNativeBinary", result);
         }
@@ -5405,6 +6629,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeModuleGetNativeBinary", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeModuleGetNativeBinaryPrologue( hModule, pSize, pModuleNativeBinary );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeModuleGetNativeBinary", result);
         }
@@ -5412,6 +6637,13 @@ namespace validation_layer
         auto driver_result = pfnGetNativeBinary( hModule, pSize, pModuleNativeBinary );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeModuleGetNativeBinary", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeModuleGetNativeBinary", [=]() { handler->zeModuleGetNativeBinaryEpilogue( hModule, pSize, pModuleNativeBinary ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeModuleGetNativeBinaryEpilogue( hModule, pSize, pModuleNativeBinary ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeModuleGetNativeBinary", result);
         }
@@ -5437,7 +6669,10 @@ namespace validation_layer
             return logAndPropagateResult("zeModuleGetGlobalPointer", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeModuleGetGlobalPointer", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeModuleGetGlobalPointerPrologue( hModule, pGlobalName, pSize, pptr );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeModuleGetGlobalPointer", result);
         }
@@ -5449,6 +6684,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeModuleGetGlobalPointer", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeModuleGetGlobalPointerPrologue( hModule, pGlobalName, pSize, pptr );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeModuleGetGlobalPointer", result);
         }
@@ -5456,6 +6692,13 @@ namespace validation_layer
         auto driver_result = pfnGetGlobalPointer( hModule, pGlobalName, pSize, pptr );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeModuleGetGlobalPointer", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeModuleGetGlobalPointer", [=]() { handler->zeModuleGetGlobalPointerEpilogue( hModule, pGlobalName, pSize, pptr ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeModuleGetGlobalPointerEpilogue( hModule, pGlobalName, pSize, pptr ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeModuleGetGlobalPointer", result);
         }
@@ -5486,7 +6729,10 @@ namespace validation_layer
             return logAndPropagateResult("zeModuleGetKernelNames", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeModuleGetKernelNames", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeModuleGetKernelNamesPrologue( hModule, pCount, pNames );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeModuleGetKernelNames", result);
         }
@@ -5498,6 +6744,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeModuleGetKernelNames", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeModuleGetKernelNamesPrologue( hModule, pCount, pNames );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeModuleGetKernelNames", result);
         }
@@ -5505,6 +6752,13 @@ namespace validation_layer
         auto driver_result = pfnGetKernelNames( hModule, pCount, pNames );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeModuleGetKernelNames", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeModuleGetKernelNames", [=]() { handler->zeModuleGetKernelNamesEpilogue( hModule, pCount, pNames ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeModuleGetKernelNamesEpilogue( hModule, pCount, pNames ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeModuleGetKernelNames", result);
         }
@@ -5528,7 +6782,10 @@ namespace validation_layer
             return logAndPropagateResult("zeModuleGetProperties", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeModuleGetProperties", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeModuleGetPropertiesPrologue( hModule, pModuleProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeModuleGetProperties", result);
         }
@@ -5540,6 +6797,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeModuleGetProperties", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeModuleGetPropertiesPrologue( hModule, pModuleProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeModuleGetProperties", result);
         }
@@ -5547,6 +6805,13 @@ namespace validation_layer
         auto driver_result = pfnGetProperties( hModule, pModuleProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeModuleGetProperties", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeModuleGetProperties", [=]() { handler->zeModuleGetPropertiesEpilogue( hModule, pModuleProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeModuleGetPropertiesEpilogue( hModule, pModuleProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeModuleGetProperties", result);
         }
@@ -5572,6 +6837,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeKernelCreate", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeKernelCreatePrologue( hModule, desc, phKernel );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeKernelCreate", result);
         }
@@ -5583,6 +6849,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeKernelCreate", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeKernelCreatePrologue( hModule, desc, phKernel );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeKernelCreate", result);
         }
@@ -5590,6 +6857,12 @@ namespace validation_layer
         auto driver_result = pfnCreate( hModule, desc, phKernel );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeKernelCreate", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeKernelCreate", [=]() { handler->zeKernelCreateEpilogue( hModule, desc, phKernel ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeKernelCreateEpilogue( hModule, desc, phKernel ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeKernelCreate", result);
         }
@@ -5622,6 +6895,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeKernelDestroy", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeKernelDestroyPrologue( hKernel );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeKernelDestroy", result);
         }
@@ -5633,6 +6907,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeKernelDestroy", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeKernelDestroyPrologue( hKernel );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeKernelDestroy", result);
         }
@@ -5640,6 +6915,12 @@ namespace validation_layer
         auto driver_result = pfnDestroy( hKernel );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeKernelDestroy", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeKernelDestroy", [=]() { handler->zeKernelDestroyEpilogue( hKernel ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeKernelDestroyEpilogue( hKernel ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeKernelDestroy", result);
         }
@@ -5664,7 +6945,10 @@ namespace validation_layer
             return logAndPropagateResult("zeModuleGetFunctionPointer", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeModuleGetFunctionPointer", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeModuleGetFunctionPointerPrologue( hModule, pFunctionName, pfnFunction );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeModuleGetFunctionPointer", result);
         }
@@ -5676,6 +6960,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeModuleGetFunctionPointer", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeModuleGetFunctionPointerPrologue( hModule, pFunctionName, pfnFunction );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeModuleGetFunctionPointer", result);
         }
@@ -5683,6 +6968,13 @@ namespace validation_layer
         auto driver_result = pfnGetFunctionPointer( hModule, pFunctionName, pfnFunction );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeModuleGetFunctionPointer", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeModuleGetFunctionPointer", [=]() { handler->zeModuleGetFunctionPointerEpilogue( hModule, pFunctionName, pfnFunction ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeModuleGetFunctionPointerEpilogue( hModule, pFunctionName, pfnFunction ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeModuleGetFunctionPointer", result);
         }
@@ -5708,7 +7000,10 @@ namespace validation_layer
             return logAndPropagateResult("zeKernelSetGroupSize", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeKernelSetGroupSize", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeKernelSetGroupSizePrologue( hKernel, groupSizeX, groupSizeY, groupSizeZ );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeKernelSetGroupSize", result);
         }
@@ -5720,6 +7015,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeKernelSetGroupSize", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeKernelSetGroupSizePrologue( hKernel, groupSizeX, groupSizeY, groupSizeZ );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeKernelSetGroupSize", result);
         }
@@ -5727,6 +7023,13 @@ namespace validation_layer
         auto driver_result = pfnSetGroupSize( hKernel, groupSizeX, groupSizeY, groupSizeZ );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeKernelSetGroupSize", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeKernelSetGroupSize", [=]() { handler->zeKernelSetGroupSizeEpilogue( hKernel, groupSizeX, groupSizeY, groupSizeZ ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeKernelSetGroupSizeEpilogue( hKernel, groupSizeX, groupSizeY, groupSizeZ ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeKernelSetGroupSize", result);
         }
@@ -5755,7 +7058,10 @@ namespace validation_layer
             return logAndPropagateResult("zeKernelSuggestGroupSize", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeKernelSuggestGroupSize", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeKernelSuggestGroupSizePrologue( hKernel, globalSizeX, globalSizeY, globalSizeZ, groupSizeX, groupSizeY, groupSizeZ );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeKernelSuggestGroupSize", result);
         }
@@ -5767,6 +7073,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeKernelSuggestGroupSize", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeKernelSuggestGroupSizePrologue( hKernel, globalSizeX, globalSizeY, globalSizeZ, groupSizeX, groupSizeY, groupSizeZ );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeKernelSuggestGroupSize", result);
         }
@@ -5774,6 +7081,13 @@ namespace validation_layer
         auto driver_result = pfnSuggestGroupSize( hKernel, globalSizeX, globalSizeY, globalSizeZ, groupSizeX, groupSizeY, groupSizeZ );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeKernelSuggestGroupSize", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeKernelSuggestGroupSize", [=]() { handler->zeKernelSuggestGroupSizeEpilogue( hKernel, globalSizeX, globalSizeY, globalSizeZ, groupSizeX, groupSizeY, groupSizeZ ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeKernelSuggestGroupSizeEpilogue( hKernel, globalSizeX, globalSizeY, globalSizeZ, groupSizeX, groupSizeY, groupSizeZ ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeKernelSuggestGroupSize", result);
         }
@@ -5797,7 +7111,10 @@ namespace validation_layer
             return logAndPropagateResult("zeKernelSuggestMaxCooperativeGroupCount", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeKernelSuggestMaxCooperativeGroupCount", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeKernelSuggestMaxCooperativeGroupCountPrologue( hKernel, totalGroupCount );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeKernelSuggestMaxCooperativeGroupCount", result);
         }
@@ -5809,6 +7126,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeKernelSuggestMaxCooperativeGroupCount", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeKernelSuggestMaxCooperativeGroupCountPrologue( hKernel, totalGroupCount );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeKernelSuggestMaxCooperativeGroupCount", result);
         }
@@ -5816,6 +7134,13 @@ namespace validation_layer
         auto driver_result = pfnSuggestMaxCooperativeGroupCount( hKernel, totalGroupCount );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeKernelSuggestMaxCooperativeGroupCount", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeKernelSuggestMaxCooperativeGroupCount", [=]() { handler->zeKernelSuggestMaxCooperativeGroupCountEpilogue( hKernel, totalGroupCount ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeKernelSuggestMaxCooperativeGroupCountEpilogue( hKernel, totalGroupCount ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeKernelSuggestMaxCooperativeGroupCount", result);
         }
@@ -5842,7 +7167,10 @@ namespace validation_layer
             return logAndPropagateResult("zeKernelSetArgumentValue", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeKernelSetArgumentValue", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeKernelSetArgumentValuePrologue( hKernel, argIndex, argSize, pArgValue );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeKernelSetArgumentValue", result);
         }
@@ -5854,6 +7182,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeKernelSetArgumentValue", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeKernelSetArgumentValuePrologue( hKernel, argIndex, argSize, pArgValue );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeKernelSetArgumentValue", result);
         }
@@ -5861,6 +7190,13 @@ namespace validation_layer
         auto driver_result = pfnSetArgumentValue( hKernel, argIndex, argSize, pArgValue );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeKernelSetArgumentValue", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeKernelSetArgumentValue", [=]() { handler->zeKernelSetArgumentValueEpilogue( hKernel, argIndex, argSize, pArgValue ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeKernelSetArgumentValueEpilogue( hKernel, argIndex, argSize, pArgValue ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeKernelSetArgumentValue", result);
         }
@@ -5884,7 +7220,10 @@ namespace validation_layer
             return logAndPropagateResult("zeKernelSetIndirectAccess", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeKernelSetIndirectAccess", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeKernelSetIndirectAccessPrologue( hKernel, flags );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeKernelSetIndirectAccess", result);
         }
@@ -5896,6 +7235,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeKernelSetIndirectAccess", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeKernelSetIndirectAccessPrologue( hKernel, flags );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeKernelSetIndirectAccess", result);
         }
@@ -5903,6 +7243,13 @@ namespace validation_layer
         auto driver_result = pfnSetIndirectAccess( hKernel, flags );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeKernelSetIndirectAccess", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeKernelSetIndirectAccess", [=]() { handler->zeKernelSetIndirectAccessEpilogue( hKernel, flags ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeKernelSetIndirectAccessEpilogue( hKernel, flags ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeKernelSetIndirectAccess", result);
         }
@@ -5926,7 +7273,10 @@ namespace validation_layer
             return logAndPropagateResult("zeKernelGetIndirectAccess", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeKernelGetIndirectAccess", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeKernelGetIndirectAccessPrologue( hKernel, pFlags );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeKernelGetIndirectAccess", result);
         }
@@ -5938,6 +7288,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeKernelGetIndirectAccess", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeKernelGetIndirectAccessPrologue( hKernel, pFlags );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeKernelGetIndirectAccess", result);
         }
@@ -5945,6 +7296,13 @@ namespace validation_layer
         auto driver_result = pfnGetIndirectAccess( hKernel, pFlags );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeKernelGetIndirectAccess", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeKernelGetIndirectAccess", [=]() { handler->zeKernelGetIndirectAccessEpilogue( hKernel, pFlags ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeKernelGetIndirectAccessEpilogue( hKernel, pFlags ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeKernelGetIndirectAccess", result);
         }
@@ -5980,7 +7338,10 @@ namespace validation_layer
             return logAndPropagateResult("zeKernelGetSourceAttributes", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeKernelGetSourceAttributes", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeKernelGetSourceAttributesPrologue( hKernel, pSize, pString );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeKernelGetSourceAttributes", result);
         }
@@ -5992,6 +7353,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeKernelGetSourceAttributes", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeKernelGetSourceAttributesPrologue( hKernel, pSize, pString );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeKernelGetSourceAttributes", result);
         }
@@ -5999,6 +7361,13 @@ namespace validation_layer
         auto driver_result = pfnGetSourceAttributes( hKernel, pSize, pString );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeKernelGetSourceAttributes", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeKernelGetSourceAttributes", [=]() { handler->zeKernelGetSourceAttributesEpilogue( hKernel, pSize, pString ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeKernelGetSourceAttributesEpilogue( hKernel, pSize, pString ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeKernelGetSourceAttributes", result);
         }
@@ -6023,7 +7392,10 @@ namespace validation_layer
             return logAndPropagateResult("zeKernelSetCacheConfig", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeKernelSetCacheConfig", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeKernelSetCacheConfigPrologue( hKernel, flags );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeKernelSetCacheConfig", result);
         }
@@ -6035,6 +7407,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeKernelSetCacheConfig", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeKernelSetCacheConfigPrologue( hKernel, flags );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeKernelSetCacheConfig", result);
         }
@@ -6042,6 +7415,13 @@ namespace validation_layer
         auto driver_result = pfnSetCacheConfig( hKernel, flags );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeKernelSetCacheConfig", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeKernelSetCacheConfig", [=]() { handler->zeKernelSetCacheConfigEpilogue( hKernel, flags ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeKernelSetCacheConfigEpilogue( hKernel, flags ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeKernelSetCacheConfig", result);
         }
@@ -6065,7 +7445,10 @@ namespace validation_layer
             return logAndPropagateResult("zeKernelGetProperties", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeKernelGetProperties", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeKernelGetPropertiesPrologue( hKernel, pKernelProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeKernelGetProperties", result);
         }
@@ -6077,6 +7460,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeKernelGetProperties", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeKernelGetPropertiesPrologue( hKernel, pKernelProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeKernelGetProperties", result);
         }
@@ -6084,6 +7468,13 @@ namespace validation_layer
         auto driver_result = pfnGetProperties( hKernel, pKernelProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeKernelGetProperties", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeKernelGetProperties", [=]() { handler->zeKernelGetPropertiesEpilogue( hKernel, pKernelProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeKernelGetPropertiesEpilogue( hKernel, pKernelProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeKernelGetProperties", result);
         }
@@ -6109,7 +7500,10 @@ namespace validation_layer
             return logAndPropagateResult("zeKernelGetName", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeKernelGetName", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeKernelGetNamePrologue( hKernel, pSize, pName );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeKernelGetName", result);
         }
@@ -6121,6 +7515,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeKernelGetName", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeKernelGetNamePrologue( hKernel, pSize, pName );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeKernelGetName", result);
         }
@@ -6128,6 +7523,13 @@ namespace validation_layer
         auto driver_result = pfnGetName( hKernel, pSize, pName );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeKernelGetName", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeKernelGetName", [=]() { handler->zeKernelGetNameEpilogue( hKernel, pSize, pName ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeKernelGetNameEpilogue( hKernel, pSize, pName ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeKernelGetName", result);
         }
@@ -6157,7 +7559,10 @@ namespace validation_layer
             return logAndPropagateResult("zeCommandListAppendLaunchKernel", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListAppendLaunchKernel", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendLaunchKernelPrologue( hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendLaunchKernel", result);
         }
@@ -6169,6 +7574,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeCommandListAppendLaunchKernel", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandListAppendLaunchKernelPrologue( hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendLaunchKernel", result);
         }
@@ -6176,6 +7582,13 @@ namespace validation_layer
         auto driver_result = pfnAppendLaunchKernel( hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListAppendLaunchKernel", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeCommandListAppendLaunchKernel", [=]() { handler->zeCommandListAppendLaunchKernelEpilogue( hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendLaunchKernelEpilogue( hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendLaunchKernel", result);
         }
@@ -6206,7 +7619,10 @@ namespace validation_layer
             return logAndPropagateResult("zeCommandListAppendLaunchKernelWithParameters", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListAppendLaunchKernelWithParameters", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendLaunchKernelWithParametersPrologue( hCommandList, hKernel, pGroupCounts, pNext, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendLaunchKernelWithParameters", result);
         }
@@ -6218,6 +7634,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeCommandListAppendLaunchKernelWithParameters", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandListAppendLaunchKernelWithParametersPrologue( hCommandList, hKernel, pGroupCounts, pNext, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendLaunchKernelWithParameters", result);
         }
@@ -6225,6 +7642,13 @@ namespace validation_layer
         auto driver_result = pfnAppendLaunchKernelWithParameters( hCommandList, hKernel, pGroupCounts, pNext, hSignalEvent, numWaitEvents, phWaitEvents );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListAppendLaunchKernelWithParameters", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeCommandListAppendLaunchKernelWithParameters", [=]() { handler->zeCommandListAppendLaunchKernelWithParametersEpilogue( hCommandList, hKernel, pGroupCounts, pNext, hSignalEvent, numWaitEvents, phWaitEvents ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendLaunchKernelWithParametersEpilogue( hCommandList, hKernel, pGroupCounts, pNext, hSignalEvent, numWaitEvents, phWaitEvents ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendLaunchKernelWithParameters", result);
         }
@@ -6257,7 +7681,10 @@ namespace validation_layer
             return logAndPropagateResult("zeCommandListAppendLaunchKernelWithArguments", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListAppendLaunchKernelWithArguments", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendLaunchKernelWithArgumentsPrologue( hCommandList, hKernel, groupCounts, groupSizes, pArguments, pNext, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendLaunchKernelWithArguments", result);
         }
@@ -6269,6 +7696,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeCommandListAppendLaunchKernelWithArguments", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandListAppendLaunchKernelWithArgumentsPrologue( hCommandList, hKernel, groupCounts, groupSizes, pArguments, pNext, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendLaunchKernelWithArguments", result);
         }
@@ -6276,6 +7704,13 @@ namespace validation_layer
         auto driver_result = pfnAppendLaunchKernelWithArguments( hCommandList, hKernel, groupCounts, groupSizes, pArguments, pNext, hSignalEvent, numWaitEvents, phWaitEvents );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListAppendLaunchKernelWithArguments", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeCommandListAppendLaunchKernelWithArguments", [=]() { handler->zeCommandListAppendLaunchKernelWithArgumentsEpilogue( hCommandList, hKernel, groupCounts, groupSizes, pArguments, pNext, hSignalEvent, numWaitEvents, phWaitEvents ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendLaunchKernelWithArgumentsEpilogue( hCommandList, hKernel, groupCounts, groupSizes, pArguments, pNext, hSignalEvent, numWaitEvents, phWaitEvents ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendLaunchKernelWithArguments", result);
         }
@@ -6305,7 +7740,10 @@ namespace validation_layer
             return logAndPropagateResult("zeCommandListAppendLaunchCooperativeKernel", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListAppendLaunchCooperativeKernel", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendLaunchCooperativeKernelPrologue( hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendLaunchCooperativeKernel", result);
         }
@@ -6317,6 +7755,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeCommandListAppendLaunchCooperativeKernel", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandListAppendLaunchCooperativeKernelPrologue( hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendLaunchCooperativeKernel", result);
         }
@@ -6324,6 +7763,13 @@ namespace validation_layer
         auto driver_result = pfnAppendLaunchCooperativeKernel( hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListAppendLaunchCooperativeKernel", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeCommandListAppendLaunchCooperativeKernel", [=]() { handler->zeCommandListAppendLaunchCooperativeKernelEpilogue( hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendLaunchCooperativeKernelEpilogue( hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendLaunchCooperativeKernel", result);
         }
@@ -6354,7 +7800,10 @@ namespace validation_layer
             return logAndPropagateResult("zeCommandListAppendLaunchKernelIndirect", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListAppendLaunchKernelIndirect", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendLaunchKernelIndirectPrologue( hCommandList, hKernel, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendLaunchKernelIndirect", result);
         }
@@ -6366,6 +7815,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeCommandListAppendLaunchKernelIndirect", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandListAppendLaunchKernelIndirectPrologue( hCommandList, hKernel, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendLaunchKernelIndirect", result);
         }
@@ -6373,6 +7823,13 @@ namespace validation_layer
         auto driver_result = pfnAppendLaunchKernelIndirect( hCommandList, hKernel, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListAppendLaunchKernelIndirect", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeCommandListAppendLaunchKernelIndirect", [=]() { handler->zeCommandListAppendLaunchKernelIndirectEpilogue( hCommandList, hKernel, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendLaunchKernelIndirectEpilogue( hCommandList, hKernel, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendLaunchKernelIndirect", result);
         }
@@ -6407,7 +7864,10 @@ namespace validation_layer
             return logAndPropagateResult("zeCommandListAppendLaunchMultipleKernelsIndirect", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListAppendLaunchMultipleKernelsIndirect", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendLaunchMultipleKernelsIndirectPrologue( hCommandList, numKernels, phKernels, pCountBuffer, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendLaunchMultipleKernelsIndirect", result);
         }
@@ -6419,6 +7879,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeCommandListAppendLaunchMultipleKernelsIndirect", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandListAppendLaunchMultipleKernelsIndirectPrologue( hCommandList, numKernels, phKernels, pCountBuffer, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendLaunchMultipleKernelsIndirect", result);
         }
@@ -6426,6 +7887,13 @@ namespace validation_layer
         auto driver_result = pfnAppendLaunchMultipleKernelsIndirect( hCommandList, numKernels, phKernels, pCountBuffer, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListAppendLaunchMultipleKernelsIndirect", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeCommandListAppendLaunchMultipleKernelsIndirect", [=]() { handler->zeCommandListAppendLaunchMultipleKernelsIndirectEpilogue( hCommandList, numKernels, phKernels, pCountBuffer, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendLaunchMultipleKernelsIndirectEpilogue( hCommandList, numKernels, phKernels, pCountBuffer, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendLaunchMultipleKernelsIndirect", result);
         }
@@ -6451,7 +7919,10 @@ namespace validation_layer
             return logAndPropagateResult("zeContextMakeMemoryResident", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeContextMakeMemoryResident", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeContextMakeMemoryResidentPrologue( hContext, hDevice, ptr, size );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeContextMakeMemoryResident", result);
         }
@@ -6463,6 +7934,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeContextMakeMemoryResident", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeContextMakeMemoryResidentPrologue( hContext, hDevice, ptr, size );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeContextMakeMemoryResident", result);
         }
@@ -6470,6 +7942,13 @@ namespace validation_layer
         auto driver_result = pfnMakeMemoryResident( hContext, hDevice, ptr, size );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeContextMakeMemoryResident", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeContextMakeMemoryResident", [=]() { handler->zeContextMakeMemoryResidentEpilogue( hContext, hDevice, ptr, size ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeContextMakeMemoryResidentEpilogue( hContext, hDevice, ptr, size ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeContextMakeMemoryResident", result);
         }
@@ -6495,7 +7974,10 @@ namespace validation_layer
             return logAndPropagateResult("zeContextEvictMemory", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeContextEvictMemory", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeContextEvictMemoryPrologue( hContext, hDevice, ptr, size );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeContextEvictMemory", result);
         }
@@ -6507,6 +7989,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeContextEvictMemory", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeContextEvictMemoryPrologue( hContext, hDevice, ptr, size );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeContextEvictMemory", result);
         }
@@ -6514,6 +7997,13 @@ namespace validation_layer
         auto driver_result = pfnEvictMemory( hContext, hDevice, ptr, size );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeContextEvictMemory", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeContextEvictMemory", [=]() { handler->zeContextEvictMemoryEpilogue( hContext, hDevice, ptr, size ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeContextEvictMemoryEpilogue( hContext, hDevice, ptr, size ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeContextEvictMemory", result);
         }
@@ -6538,7 +8028,10 @@ namespace validation_layer
             return logAndPropagateResult("zeContextMakeImageResident", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeContextMakeImageResident", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeContextMakeImageResidentPrologue( hContext, hDevice, hImage );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeContextMakeImageResident", result);
         }
@@ -6550,6 +8043,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeContextMakeImageResident", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeContextMakeImageResidentPrologue( hContext, hDevice, hImage );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeContextMakeImageResident", result);
         }
@@ -6557,6 +8051,13 @@ namespace validation_layer
         auto driver_result = pfnMakeImageResident( hContext, hDevice, hImage );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeContextMakeImageResident", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeContextMakeImageResident", [=]() { handler->zeContextMakeImageResidentEpilogue( hContext, hDevice, hImage ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeContextMakeImageResidentEpilogue( hContext, hDevice, hImage ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeContextMakeImageResident", result);
         }
@@ -6581,7 +8082,10 @@ namespace validation_layer
             return logAndPropagateResult("zeContextEvictImage", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeContextEvictImage", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeContextEvictImagePrologue( hContext, hDevice, hImage );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeContextEvictImage", result);
         }
@@ -6593,6 +8097,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeContextEvictImage", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeContextEvictImagePrologue( hContext, hDevice, hImage );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeContextEvictImage", result);
         }
@@ -6600,6 +8105,13 @@ namespace validation_layer
         auto driver_result = pfnEvictImage( hContext, hDevice, hImage );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeContextEvictImage", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeContextEvictImage", [=]() { handler->zeContextEvictImageEpilogue( hContext, hDevice, hImage ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeContextEvictImageEpilogue( hContext, hDevice, hImage ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeContextEvictImage", result);
         }
@@ -6626,6 +8138,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeSamplerCreate", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeSamplerCreatePrologue( hContext, hDevice, desc, phSampler );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeSamplerCreate", result);
         }
@@ -6637,6 +8150,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeSamplerCreate", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeSamplerCreatePrologue( hContext, hDevice, desc, phSampler );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeSamplerCreate", result);
         }
@@ -6644,6 +8158,12 @@ namespace validation_layer
         auto driver_result = pfnCreate( hContext, hDevice, desc, phSampler );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeSamplerCreate", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeSamplerCreate", [=]() { handler->zeSamplerCreateEpilogue( hContext, hDevice, desc, phSampler ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeSamplerCreateEpilogue( hContext, hDevice, desc, phSampler ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeSamplerCreate", result);
         }
@@ -6676,6 +8196,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeSamplerDestroy", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeSamplerDestroyPrologue( hSampler );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeSamplerDestroy", result);
         }
@@ -6687,6 +8208,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeSamplerDestroy", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeSamplerDestroyPrologue( hSampler );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeSamplerDestroy", result);
         }
@@ -6694,6 +8216,12 @@ namespace validation_layer
         auto driver_result = pfnDestroy( hSampler );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeSamplerDestroy", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeSamplerDestroy", [=]() { handler->zeSamplerDestroyEpilogue( hSampler ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeSamplerDestroyEpilogue( hSampler ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeSamplerDestroy", result);
         }
@@ -6720,7 +8248,10 @@ namespace validation_layer
             return logAndPropagateResult("zeVirtualMemReserve", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeVirtualMemReserve", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeVirtualMemReservePrologue( hContext, pStart, size, pptr );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeVirtualMemReserve", result);
         }
@@ -6732,6 +8263,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeVirtualMemReserve", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeVirtualMemReservePrologue( hContext, pStart, size, pptr );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeVirtualMemReserve", result);
         }
@@ -6739,6 +8271,13 @@ namespace validation_layer
         auto driver_result = pfnReserve( hContext, pStart, size, pptr );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeVirtualMemReserve", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeVirtualMemReserve", [=]() { handler->zeVirtualMemReserveEpilogue( hContext, pStart, size, pptr ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeVirtualMemReserveEpilogue( hContext, pStart, size, pptr ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeVirtualMemReserve", result);
         }
@@ -6764,6 +8303,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeVirtualMemFree", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeVirtualMemFreePrologue( hContext, ptr, size );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeVirtualMemFree", result);
         }
@@ -6775,6 +8315,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeVirtualMemFree", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeVirtualMemFreePrologue( hContext, ptr, size );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeVirtualMemFree", result);
         }
@@ -6782,6 +8323,12 @@ namespace validation_layer
         auto driver_result = pfnFree( hContext, ptr, size );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeVirtualMemFree", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeVirtualMemFree", [=]() { handler->zeVirtualMemFreeEpilogue( hContext, ptr, size ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeVirtualMemFreeEpilogue( hContext, ptr, size ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeVirtualMemFree", result);
         }
@@ -6808,7 +8355,10 @@ namespace validation_layer
             return logAndPropagateResult("zeVirtualMemQueryPageSize", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeVirtualMemQueryPageSize", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeVirtualMemQueryPageSizePrologue( hContext, hDevice, size, pagesize );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeVirtualMemQueryPageSize", result);
         }
@@ -6820,6 +8370,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeVirtualMemQueryPageSize", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeVirtualMemQueryPageSizePrologue( hContext, hDevice, size, pagesize );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeVirtualMemQueryPageSize", result);
         }
@@ -6827,6 +8378,13 @@ namespace validation_layer
         auto driver_result = pfnQueryPageSize( hContext, hDevice, size, pagesize );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeVirtualMemQueryPageSize", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeVirtualMemQueryPageSize", [=]() { handler->zeVirtualMemQueryPageSizeEpilogue( hContext, hDevice, size, pagesize ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeVirtualMemQueryPageSizeEpilogue( hContext, hDevice, size, pagesize ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeVirtualMemQueryPageSize", result);
         }
@@ -6851,7 +8409,10 @@ namespace validation_layer
             return logAndPropagateResult("zePhysicalMemGetProperties", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zePhysicalMemGetProperties", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zePhysicalMemGetPropertiesPrologue( hContext, hPhysicalMem, pMemProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zePhysicalMemGetProperties", result);
         }
@@ -6863,6 +8424,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zePhysicalMemGetProperties", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zePhysicalMemGetPropertiesPrologue( hContext, hPhysicalMem, pMemProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zePhysicalMemGetProperties", result);
         }
@@ -6870,6 +8432,13 @@ namespace validation_layer
         auto driver_result = pfnGetProperties( hContext, hPhysicalMem, pMemProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zePhysicalMemGetProperties", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zePhysicalMemGetProperties", [=]() { handler->zePhysicalMemGetPropertiesEpilogue( hContext, hPhysicalMem, pMemProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zePhysicalMemGetPropertiesEpilogue( hContext, hPhysicalMem, pMemProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zePhysicalMemGetProperties", result);
         }
@@ -6897,6 +8466,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zePhysicalMemCreate", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zePhysicalMemCreatePrologue( hContext, hDevice, desc, phPhysicalMemory );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zePhysicalMemCreate", result);
         }
@@ -6908,6 +8478,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zePhysicalMemCreate", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zePhysicalMemCreatePrologue( hContext, hDevice, desc, phPhysicalMemory );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zePhysicalMemCreate", result);
         }
@@ -6915,6 +8486,12 @@ namespace validation_layer
         auto driver_result = pfnCreate( hContext, hDevice, desc, phPhysicalMemory );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zePhysicalMemCreate", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zePhysicalMemCreate", [=]() { handler->zePhysicalMemCreateEpilogue( hContext, hDevice, desc, phPhysicalMemory ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zePhysicalMemCreateEpilogue( hContext, hDevice, desc, phPhysicalMemory ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zePhysicalMemCreate", result);
         }
@@ -6948,6 +8525,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zePhysicalMemDestroy", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zePhysicalMemDestroyPrologue( hContext, hPhysicalMemory );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zePhysicalMemDestroy", result);
         }
@@ -6959,6 +8537,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zePhysicalMemDestroy", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zePhysicalMemDestroyPrologue( hContext, hPhysicalMemory );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zePhysicalMemDestroy", result);
         }
@@ -6966,6 +8545,12 @@ namespace validation_layer
         auto driver_result = pfnDestroy( hContext, hPhysicalMemory );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zePhysicalMemDestroy", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zePhysicalMemDestroy", [=]() { handler->zePhysicalMemDestroyEpilogue( hContext, hPhysicalMemory ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zePhysicalMemDestroyEpilogue( hContext, hPhysicalMemory ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zePhysicalMemDestroy", result);
         }
@@ -6996,7 +8581,10 @@ namespace validation_layer
             return logAndPropagateResult("zeVirtualMemMap", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeVirtualMemMap", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeVirtualMemMapPrologue( hContext, ptr, size, hPhysicalMemory, offset, access );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeVirtualMemMap", result);
         }
@@ -7008,6 +8596,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeVirtualMemMap", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeVirtualMemMapPrologue( hContext, ptr, size, hPhysicalMemory, offset, access );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeVirtualMemMap", result);
         }
@@ -7015,6 +8604,13 @@ namespace validation_layer
         auto driver_result = pfnMap( hContext, ptr, size, hPhysicalMemory, offset, access );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeVirtualMemMap", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeVirtualMemMap", [=]() { handler->zeVirtualMemMapEpilogue( hContext, ptr, size, hPhysicalMemory, offset, access ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeVirtualMemMapEpilogue( hContext, ptr, size, hPhysicalMemory, offset, access ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeVirtualMemMap", result);
         }
@@ -7039,7 +8635,10 @@ namespace validation_layer
             return logAndPropagateResult("zeVirtualMemUnmap", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeVirtualMemUnmap", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeVirtualMemUnmapPrologue( hContext, ptr, size );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeVirtualMemUnmap", result);
         }
@@ -7051,6 +8650,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeVirtualMemUnmap", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeVirtualMemUnmapPrologue( hContext, ptr, size );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeVirtualMemUnmap", result);
         }
@@ -7058,6 +8658,13 @@ namespace validation_layer
         auto driver_result = pfnUnmap( hContext, ptr, size );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeVirtualMemUnmap", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeVirtualMemUnmap", [=]() { handler->zeVirtualMemUnmapEpilogue( hContext, ptr, size ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeVirtualMemUnmapEpilogue( hContext, ptr, size ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeVirtualMemUnmap", result);
         }
@@ -7084,7 +8691,10 @@ namespace validation_layer
             return logAndPropagateResult("zeVirtualMemSetAccessAttribute", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeVirtualMemSetAccessAttribute", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeVirtualMemSetAccessAttributePrologue( hContext, ptr, size, access );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeVirtualMemSetAccessAttribute", result);
         }
@@ -7096,6 +8706,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeVirtualMemSetAccessAttribute", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeVirtualMemSetAccessAttributePrologue( hContext, ptr, size, access );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeVirtualMemSetAccessAttribute", result);
         }
@@ -7103,6 +8714,13 @@ namespace validation_layer
         auto driver_result = pfnSetAccessAttribute( hContext, ptr, size, access );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeVirtualMemSetAccessAttribute", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeVirtualMemSetAccessAttribute", [=]() { handler->zeVirtualMemSetAccessAttributeEpilogue( hContext, ptr, size, access ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeVirtualMemSetAccessAttributeEpilogue( hContext, ptr, size, access ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeVirtualMemSetAccessAttribute", result);
         }
@@ -7130,7 +8748,10 @@ namespace validation_layer
             return logAndPropagateResult("zeVirtualMemGetAccessAttribute", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeVirtualMemGetAccessAttribute", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeVirtualMemGetAccessAttributePrologue( hContext, ptr, size, access, outSize );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeVirtualMemGetAccessAttribute", result);
         }
@@ -7142,6 +8763,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeVirtualMemGetAccessAttribute", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeVirtualMemGetAccessAttributePrologue( hContext, ptr, size, access, outSize );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeVirtualMemGetAccessAttribute", result);
         }
@@ -7149,6 +8771,13 @@ namespace validation_layer
         auto driver_result = pfnGetAccessAttribute( hContext, ptr, size, access, outSize );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeVirtualMemGetAccessAttribute", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeVirtualMemGetAccessAttribute", [=]() { handler->zeVirtualMemGetAccessAttributeEpilogue( hContext, ptr, size, access, outSize ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeVirtualMemGetAccessAttributeEpilogue( hContext, ptr, size, access, outSize ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeVirtualMemGetAccessAttribute", result);
         }
@@ -7174,7 +8803,10 @@ namespace validation_layer
             return logAndPropagateResult("zeKernelSetGlobalOffsetExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeKernelSetGlobalOffsetExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeKernelSetGlobalOffsetExpPrologue( hKernel, offsetX, offsetY, offsetZ );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeKernelSetGlobalOffsetExp", result);
         }
@@ -7186,6 +8818,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeKernelSetGlobalOffsetExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeKernelSetGlobalOffsetExpPrologue( hKernel, offsetX, offsetY, offsetZ );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeKernelSetGlobalOffsetExp", result);
         }
@@ -7193,6 +8826,13 @@ namespace validation_layer
         auto driver_result = pfnSetGlobalOffsetExp( hKernel, offsetX, offsetY, offsetZ );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeKernelSetGlobalOffsetExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeKernelSetGlobalOffsetExp", [=]() { handler->zeKernelSetGlobalOffsetExpEpilogue( hKernel, offsetX, offsetY, offsetZ ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeKernelSetGlobalOffsetExpEpilogue( hKernel, offsetX, offsetY, offsetZ ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeKernelSetGlobalOffsetExp", result);
         }
@@ -7217,7 +8857,10 @@ namespace validation_layer
             return logAndPropagateResult("zeKernelGetBinaryExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeKernelGetBinaryExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeKernelGetBinaryExpPrologue( hKernel, pSize, pKernelBinary );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeKernelGetBinaryExp", result);
         }
@@ -7229,6 +8872,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeKernelGetBinaryExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeKernelGetBinaryExpPrologue( hKernel, pSize, pKernelBinary );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeKernelGetBinaryExp", result);
         }
@@ -7236,6 +8880,13 @@ namespace validation_layer
         auto driver_result = pfnGetBinaryExp( hKernel, pSize, pKernelBinary );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeKernelGetBinaryExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeKernelGetBinaryExp", [=]() { handler->zeKernelGetBinaryExpEpilogue( hKernel, pSize, pKernelBinary ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeKernelGetBinaryExpEpilogue( hKernel, pSize, pKernelBinary ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeKernelGetBinaryExp", result);
         }
@@ -7264,7 +8915,10 @@ namespace validation_layer
             return logAndPropagateResult("zeDeviceImportExternalSemaphoreExt", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDeviceImportExternalSemaphoreExt", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeDeviceImportExternalSemaphoreExtPrologue( hDevice, desc, phSemaphore );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceImportExternalSemaphoreExt", result);
         }
@@ -7276,6 +8930,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeDeviceImportExternalSemaphoreExt", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceImportExternalSemaphoreExtPrologue( hDevice, desc, phSemaphore );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceImportExternalSemaphoreExt", result);
         }
@@ -7283,6 +8938,13 @@ namespace validation_layer
         auto driver_result = pfnImportExternalSemaphoreExt( hDevice, desc, phSemaphore );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDeviceImportExternalSemaphoreExt", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeDeviceImportExternalSemaphoreExt", [=]() { handler->zeDeviceImportExternalSemaphoreExtEpilogue( hDevice, desc, phSemaphore ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeDeviceImportExternalSemaphoreExtEpilogue( hDevice, desc, phSemaphore ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceImportExternalSemaphoreExt", result);
         }
@@ -7305,7 +8967,10 @@ namespace validation_layer
             return logAndPropagateResult("zeDeviceReleaseExternalSemaphoreExt", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDeviceReleaseExternalSemaphoreExt", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeDeviceReleaseExternalSemaphoreExtPrologue( hSemaphore );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceReleaseExternalSemaphoreExt", result);
         }
@@ -7317,6 +8982,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeDeviceReleaseExternalSemaphoreExt", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceReleaseExternalSemaphoreExtPrologue( hSemaphore );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceReleaseExternalSemaphoreExt", result);
         }
@@ -7324,6 +8990,13 @@ namespace validation_layer
         auto driver_result = pfnReleaseExternalSemaphoreExt( hSemaphore );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDeviceReleaseExternalSemaphoreExt", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeDeviceReleaseExternalSemaphoreExt", [=]() { handler->zeDeviceReleaseExternalSemaphoreExtEpilogue( hSemaphore ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeDeviceReleaseExternalSemaphoreExtEpilogue( hSemaphore ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceReleaseExternalSemaphoreExt", result);
         }
@@ -7355,7 +9028,10 @@ namespace validation_layer
             return logAndPropagateResult("zeCommandListAppendSignalExternalSemaphoreExt", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListAppendSignalExternalSemaphoreExt", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendSignalExternalSemaphoreExtPrologue( hCommandList, numSemaphores, phSemaphores, signalParams, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendSignalExternalSemaphoreExt", result);
         }
@@ -7367,6 +9043,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeCommandListAppendSignalExternalSemaphoreExt", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandListAppendSignalExternalSemaphoreExtPrologue( hCommandList, numSemaphores, phSemaphores, signalParams, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendSignalExternalSemaphoreExt", result);
         }
@@ -7374,6 +9051,13 @@ namespace validation_layer
         auto driver_result = pfnAppendSignalExternalSemaphoreExt( hCommandList, numSemaphores, phSemaphores, signalParams, hSignalEvent, numWaitEvents, phWaitEvents );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListAppendSignalExternalSemaphoreExt", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeCommandListAppendSignalExternalSemaphoreExt", [=]() { handler->zeCommandListAppendSignalExternalSemaphoreExtEpilogue( hCommandList, numSemaphores, phSemaphores, signalParams, hSignalEvent, numWaitEvents, phWaitEvents ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendSignalExternalSemaphoreExtEpilogue( hCommandList, numSemaphores, phSemaphores, signalParams, hSignalEvent, numWaitEvents, phWaitEvents ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendSignalExternalSemaphoreExt", result);
         }
@@ -7405,7 +9089,10 @@ namespace validation_layer
             return logAndPropagateResult("zeCommandListAppendWaitExternalSemaphoreExt", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListAppendWaitExternalSemaphoreExt", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendWaitExternalSemaphoreExtPrologue( hCommandList, numSemaphores, phSemaphores, waitParams, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendWaitExternalSemaphoreExt", result);
         }
@@ -7417,6 +9104,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeCommandListAppendWaitExternalSemaphoreExt", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandListAppendWaitExternalSemaphoreExtPrologue( hCommandList, numSemaphores, phSemaphores, waitParams, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendWaitExternalSemaphoreExt", result);
         }
@@ -7424,6 +9112,13 @@ namespace validation_layer
         auto driver_result = pfnAppendWaitExternalSemaphoreExt( hCommandList, numSemaphores, phSemaphores, waitParams, hSignalEvent, numWaitEvents, phWaitEvents );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListAppendWaitExternalSemaphoreExt", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeCommandListAppendWaitExternalSemaphoreExt", [=]() { handler->zeCommandListAppendWaitExternalSemaphoreExtEpilogue( hCommandList, numSemaphores, phSemaphores, waitParams, hSignalEvent, numWaitEvents, phWaitEvents ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendWaitExternalSemaphoreExtEpilogue( hCommandList, numSemaphores, phSemaphores, waitParams, hSignalEvent, numWaitEvents, phWaitEvents ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendWaitExternalSemaphoreExt", result);
         }
@@ -7449,6 +9144,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeRTASBuilderCreateExt", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeRTASBuilderCreateExtPrologue( hDriver, pDescriptor, phBuilder );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeRTASBuilderCreateExt", result);
         }
@@ -7460,6 +9156,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeRTASBuilderCreateExt", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeRTASBuilderCreateExtPrologue( hDriver, pDescriptor, phBuilder );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeRTASBuilderCreateExt", result);
         }
@@ -7467,6 +9164,12 @@ namespace validation_layer
         auto driver_result = pfnCreateExt( hDriver, pDescriptor, phBuilder );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeRTASBuilderCreateExt", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeRTASBuilderCreateExt", [=]() { handler->zeRTASBuilderCreateExtEpilogue( hDriver, pDescriptor, phBuilder ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeRTASBuilderCreateExtEpilogue( hDriver, pDescriptor, phBuilder ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeRTASBuilderCreateExt", result);
         }
@@ -7500,7 +9203,10 @@ namespace validation_layer
             return logAndPropagateResult("zeRTASBuilderGetBuildPropertiesExt", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeRTASBuilderGetBuildPropertiesExt", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeRTASBuilderGetBuildPropertiesExtPrologue( hBuilder, pBuildOpDescriptor, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeRTASBuilderGetBuildPropertiesExt", result);
         }
@@ -7512,6 +9218,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeRTASBuilderGetBuildPropertiesExt", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeRTASBuilderGetBuildPropertiesExtPrologue( hBuilder, pBuildOpDescriptor, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeRTASBuilderGetBuildPropertiesExt", result);
         }
@@ -7519,6 +9226,13 @@ namespace validation_layer
         auto driver_result = pfnGetBuildPropertiesExt( hBuilder, pBuildOpDescriptor, pProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeRTASBuilderGetBuildPropertiesExt", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeRTASBuilderGetBuildPropertiesExt", [=]() { handler->zeRTASBuilderGetBuildPropertiesExtEpilogue( hBuilder, pBuildOpDescriptor, pProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeRTASBuilderGetBuildPropertiesExtEpilogue( hBuilder, pBuildOpDescriptor, pProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeRTASBuilderGetBuildPropertiesExt", result);
         }
@@ -7543,7 +9257,10 @@ namespace validation_layer
             return logAndPropagateResult("zeDriverRTASFormatCompatibilityCheckExt", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDriverRTASFormatCompatibilityCheckExt", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeDriverRTASFormatCompatibilityCheckExtPrologue( hDriver, rtasFormatA, rtasFormatB );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDriverRTASFormatCompatibilityCheckExt", result);
         }
@@ -7555,6 +9272,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeDriverRTASFormatCompatibilityCheckExt", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeDriverRTASFormatCompatibilityCheckExtPrologue( hDriver, rtasFormatA, rtasFormatB );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDriverRTASFormatCompatibilityCheckExt", result);
         }
@@ -7562,6 +9280,13 @@ namespace validation_layer
         auto driver_result = pfnRTASFormatCompatibilityCheckExt( hDriver, rtasFormatA, rtasFormatB );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDriverRTASFormatCompatibilityCheckExt", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeDriverRTASFormatCompatibilityCheckExt", [=]() { handler->zeDriverRTASFormatCompatibilityCheckExtEpilogue( hDriver, rtasFormatA, rtasFormatB ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeDriverRTASFormatCompatibilityCheckExtEpilogue( hDriver, rtasFormatA, rtasFormatB ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDriverRTASFormatCompatibilityCheckExt", result);
         }
@@ -7596,7 +9321,10 @@ namespace validation_layer
             return logAndPropagateResult("zeRTASBuilderBuildExt", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeRTASBuilderBuildExt", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeRTASBuilderBuildExtPrologue( hBuilder, pBuildOpDescriptor, pScratchBuffer, scratchBufferSizeBytes, pRtasBuffer, rtasBufferSizeBytes, hParallelOperation, pBuildUserPtr, pBounds, pRtasBufferSizeBytes );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeRTASBuilderBuildExt", result);
         }
@@ -7608,6 +9336,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeRTASBuilderBuildExt", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeRTASBuilderBuildExtPrologue( hBuilder, pBuildOpDescriptor, pScratchBuffer, scratchBufferSizeBytes, pRtasBuffer, rtasBufferSizeBytes, hParallelOperation, pBuildUserPtr, pBounds, pRtasBufferSizeBytes );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeRTASBuilderBuildExt", result);
         }
@@ -7615,6 +9344,13 @@ namespace validation_layer
         auto driver_result = pfnBuildExt( hBuilder, pBuildOpDescriptor, pScratchBuffer, scratchBufferSizeBytes, pRtasBuffer, rtasBufferSizeBytes, hParallelOperation, pBuildUserPtr, pBounds, pRtasBufferSizeBytes );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeRTASBuilderBuildExt", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeRTASBuilderBuildExt", [=]() { handler->zeRTASBuilderBuildExtEpilogue( hBuilder, pBuildOpDescriptor, pScratchBuffer, scratchBufferSizeBytes, pRtasBuffer, rtasBufferSizeBytes, hParallelOperation, pBuildUserPtr, pBounds, pRtasBufferSizeBytes ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeRTASBuilderBuildExtEpilogue( hBuilder, pBuildOpDescriptor, pScratchBuffer, scratchBufferSizeBytes, pRtasBuffer, rtasBufferSizeBytes, hParallelOperation, pBuildUserPtr, pBounds, pRtasBufferSizeBytes ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeRTASBuilderBuildExt", result);
         }
@@ -7647,7 +9383,10 @@ namespace validation_layer
             return logAndPropagateResult("zeRTASBuilderCommandListAppendCopyExt", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeRTASBuilderCommandListAppendCopyExt", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeRTASBuilderCommandListAppendCopyExtPrologue( hCommandList, dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeRTASBuilderCommandListAppendCopyExt", result);
         }
@@ -7659,6 +9398,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeRTASBuilderCommandListAppendCopyExt", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeRTASBuilderCommandListAppendCopyExtPrologue( hCommandList, dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeRTASBuilderCommandListAppendCopyExt", result);
         }
@@ -7666,6 +9406,13 @@ namespace validation_layer
         auto driver_result = pfnCommandListAppendCopyExt( hCommandList, dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeRTASBuilderCommandListAppendCopyExt", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeRTASBuilderCommandListAppendCopyExt", [=]() { handler->zeRTASBuilderCommandListAppendCopyExtEpilogue( hCommandList, dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeRTASBuilderCommandListAppendCopyExtEpilogue( hCommandList, dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeRTASBuilderCommandListAppendCopyExt", result);
         }
@@ -7689,6 +9436,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeRTASBuilderDestroyExt", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeRTASBuilderDestroyExtPrologue( hBuilder );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeRTASBuilderDestroyExt", result);
         }
@@ -7700,6 +9448,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeRTASBuilderDestroyExt", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeRTASBuilderDestroyExtPrologue( hBuilder );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeRTASBuilderDestroyExt", result);
         }
@@ -7707,6 +9456,12 @@ namespace validation_layer
         auto driver_result = pfnDestroyExt( hBuilder );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeRTASBuilderDestroyExt", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeRTASBuilderDestroyExt", [=]() { handler->zeRTASBuilderDestroyExtEpilogue( hBuilder ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeRTASBuilderDestroyExtEpilogue( hBuilder ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeRTASBuilderDestroyExt", result);
         }
@@ -7731,6 +9486,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeRTASParallelOperationCreateExt", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeRTASParallelOperationCreateExtPrologue( hDriver, phParallelOperation );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeRTASParallelOperationCreateExt", result);
         }
@@ -7742,6 +9498,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeRTASParallelOperationCreateExt", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeRTASParallelOperationCreateExtPrologue( hDriver, phParallelOperation );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeRTASParallelOperationCreateExt", result);
         }
@@ -7749,6 +9506,12 @@ namespace validation_layer
         auto driver_result = pfnCreateExt( hDriver, phParallelOperation );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeRTASParallelOperationCreateExt", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeRTASParallelOperationCreateExt", [=]() { handler->zeRTASParallelOperationCreateExtEpilogue( hDriver, phParallelOperation ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeRTASParallelOperationCreateExtEpilogue( hDriver, phParallelOperation ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeRTASParallelOperationCreateExt", result);
         }
@@ -7781,7 +9544,10 @@ namespace validation_layer
             return logAndPropagateResult("zeRTASParallelOperationGetPropertiesExt", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeRTASParallelOperationGetPropertiesExt", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeRTASParallelOperationGetPropertiesExtPrologue( hParallelOperation, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeRTASParallelOperationGetPropertiesExt", result);
         }
@@ -7793,6 +9559,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeRTASParallelOperationGetPropertiesExt", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeRTASParallelOperationGetPropertiesExtPrologue( hParallelOperation, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeRTASParallelOperationGetPropertiesExt", result);
         }
@@ -7800,6 +9567,13 @@ namespace validation_layer
         auto driver_result = pfnGetPropertiesExt( hParallelOperation, pProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeRTASParallelOperationGetPropertiesExt", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeRTASParallelOperationGetPropertiesExt", [=]() { handler->zeRTASParallelOperationGetPropertiesExtEpilogue( hParallelOperation, pProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeRTASParallelOperationGetPropertiesExtEpilogue( hParallelOperation, pProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeRTASParallelOperationGetPropertiesExt", result);
         }
@@ -7822,7 +9596,10 @@ namespace validation_layer
             return logAndPropagateResult("zeRTASParallelOperationJoinExt", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeRTASParallelOperationJoinExt", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeRTASParallelOperationJoinExtPrologue( hParallelOperation );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeRTASParallelOperationJoinExt", result);
         }
@@ -7834,6 +9611,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeRTASParallelOperationJoinExt", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeRTASParallelOperationJoinExtPrologue( hParallelOperation );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeRTASParallelOperationJoinExt", result);
         }
@@ -7841,6 +9619,13 @@ namespace validation_layer
         auto driver_result = pfnJoinExt( hParallelOperation );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeRTASParallelOperationJoinExt", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeRTASParallelOperationJoinExt", [=]() { handler->zeRTASParallelOperationJoinExtEpilogue( hParallelOperation ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeRTASParallelOperationJoinExtEpilogue( hParallelOperation ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeRTASParallelOperationJoinExt", result);
         }
@@ -7864,6 +9649,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeRTASParallelOperationDestroyExt", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeRTASParallelOperationDestroyExtPrologue( hParallelOperation );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeRTASParallelOperationDestroyExt", result);
         }
@@ -7875,6 +9661,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeRTASParallelOperationDestroyExt", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeRTASParallelOperationDestroyExtPrologue( hParallelOperation );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeRTASParallelOperationDestroyExt", result);
         }
@@ -7882,6 +9669,12 @@ namespace validation_layer
         auto driver_result = pfnDestroyExt( hParallelOperation );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeRTASParallelOperationDestroyExt", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeRTASParallelOperationDestroyExt", [=]() { handler->zeRTASParallelOperationDestroyExtEpilogue( hParallelOperation ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeRTASParallelOperationDestroyExtEpilogue( hParallelOperation ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeRTASParallelOperationDestroyExt", result);
         }
@@ -7913,7 +9706,10 @@ namespace validation_layer
             return logAndPropagateResult("zeDeviceGetVectorWidthPropertiesExt", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDeviceGetVectorWidthPropertiesExt", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetVectorWidthPropertiesExtPrologue( hDevice, pCount, pVectorWidthProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceGetVectorWidthPropertiesExt", result);
         }
@@ -7925,6 +9721,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeDeviceGetVectorWidthPropertiesExt", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceGetVectorWidthPropertiesExtPrologue( hDevice, pCount, pVectorWidthProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceGetVectorWidthPropertiesExt", result);
         }
@@ -7932,6 +9729,13 @@ namespace validation_layer
         auto driver_result = pfnGetVectorWidthPropertiesExt( hDevice, pCount, pVectorWidthProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDeviceGetVectorWidthPropertiesExt", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeDeviceGetVectorWidthPropertiesExt", [=]() { handler->zeDeviceGetVectorWidthPropertiesExtEpilogue( hDevice, pCount, pVectorWidthProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetVectorWidthPropertiesExtEpilogue( hDevice, pCount, pVectorWidthProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceGetVectorWidthPropertiesExt", result);
         }
@@ -7964,7 +9768,10 @@ namespace validation_layer
             return logAndPropagateResult("zeKernelGetAllocationPropertiesExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeKernelGetAllocationPropertiesExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeKernelGetAllocationPropertiesExpPrologue( hKernel, pCount, pAllocationProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeKernelGetAllocationPropertiesExp", result);
         }
@@ -7976,6 +9783,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeKernelGetAllocationPropertiesExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeKernelGetAllocationPropertiesExpPrologue( hKernel, pCount, pAllocationProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeKernelGetAllocationPropertiesExp", result);
         }
@@ -7983,6 +9791,13 @@ namespace validation_layer
         auto driver_result = pfnGetAllocationPropertiesExp( hKernel, pCount, pAllocationProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeKernelGetAllocationPropertiesExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeKernelGetAllocationPropertiesExp", [=]() { handler->zeKernelGetAllocationPropertiesExpEpilogue( hKernel, pCount, pAllocationProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeKernelGetAllocationPropertiesExpEpilogue( hKernel, pCount, pAllocationProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeKernelGetAllocationPropertiesExp", result);
         }
@@ -8012,7 +9827,10 @@ namespace validation_layer
             return logAndPropagateResult("zeMemGetIpcHandleWithProperties", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeMemGetIpcHandleWithProperties", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeMemGetIpcHandleWithPropertiesPrologue( hContext, ptr, pNext, pIpcHandle );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeMemGetIpcHandleWithProperties", result);
         }
@@ -8024,6 +9842,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeMemGetIpcHandleWithProperties", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeMemGetIpcHandleWithPropertiesPrologue( hContext, ptr, pNext, pIpcHandle );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeMemGetIpcHandleWithProperties", result);
         }
@@ -8031,6 +9850,13 @@ namespace validation_layer
         auto driver_result = pfnGetIpcHandleWithProperties( hContext, ptr, pNext, pIpcHandle );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeMemGetIpcHandleWithProperties", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeMemGetIpcHandleWithProperties", [=]() { handler->zeMemGetIpcHandleWithPropertiesEpilogue( hContext, ptr, pNext, pIpcHandle ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeMemGetIpcHandleWithPropertiesEpilogue( hContext, ptr, pNext, pIpcHandle ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeMemGetIpcHandleWithProperties", result);
         }
@@ -8058,7 +9884,10 @@ namespace validation_layer
             return logAndPropagateResult("zeDeviceReserveCacheExt", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDeviceReserveCacheExt", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeDeviceReserveCacheExtPrologue( hDevice, cacheLevel, cacheReservationSize );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceReserveCacheExt", result);
         }
@@ -8070,6 +9899,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeDeviceReserveCacheExt", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceReserveCacheExtPrologue( hDevice, cacheLevel, cacheReservationSize );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceReserveCacheExt", result);
         }
@@ -8077,6 +9907,13 @@ namespace validation_layer
         auto driver_result = pfnReserveCacheExt( hDevice, cacheLevel, cacheReservationSize );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDeviceReserveCacheExt", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeDeviceReserveCacheExt", [=]() { handler->zeDeviceReserveCacheExtEpilogue( hDevice, cacheLevel, cacheReservationSize ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeDeviceReserveCacheExtEpilogue( hDevice, cacheLevel, cacheReservationSize ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceReserveCacheExt", result);
         }
@@ -8102,7 +9939,10 @@ namespace validation_layer
             return logAndPropagateResult("zeDeviceSetCacheAdviceExt", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDeviceSetCacheAdviceExt", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeDeviceSetCacheAdviceExtPrologue( hDevice, ptr, regionSize, cacheRegion );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceSetCacheAdviceExt", result);
         }
@@ -8114,6 +9954,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeDeviceSetCacheAdviceExt", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceSetCacheAdviceExtPrologue( hDevice, ptr, regionSize, cacheRegion );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceSetCacheAdviceExt", result);
         }
@@ -8121,6 +9962,13 @@ namespace validation_layer
         auto driver_result = pfnSetCacheAdviceExt( hDevice, ptr, regionSize, cacheRegion );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDeviceSetCacheAdviceExt", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeDeviceSetCacheAdviceExt", [=]() { handler->zeDeviceSetCacheAdviceExtEpilogue( hDevice, ptr, regionSize, cacheRegion ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeDeviceSetCacheAdviceExtEpilogue( hDevice, ptr, regionSize, cacheRegion ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceSetCacheAdviceExt", result);
         }
@@ -8152,7 +10000,10 @@ namespace validation_layer
             return logAndPropagateResult("zeEventQueryTimestampsExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeEventQueryTimestampsExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeEventQueryTimestampsExpPrologue( hEvent, hDevice, pCount, pTimestamps );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventQueryTimestampsExp", result);
         }
@@ -8164,6 +10015,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeEventQueryTimestampsExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeEventQueryTimestampsExpPrologue( hEvent, hDevice, pCount, pTimestamps );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventQueryTimestampsExp", result);
         }
@@ -8171,6 +10023,13 @@ namespace validation_layer
         auto driver_result = pfnQueryTimestampsExp( hEvent, hDevice, pCount, pTimestamps );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeEventQueryTimestampsExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeEventQueryTimestampsExp", [=]() { handler->zeEventQueryTimestampsExpEpilogue( hEvent, hDevice, pCount, pTimestamps ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeEventQueryTimestampsExpEpilogue( hEvent, hDevice, pCount, pTimestamps ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventQueryTimestampsExp", result);
         }
@@ -8194,7 +10053,10 @@ namespace validation_layer
             return logAndPropagateResult("zeImageGetMemoryPropertiesExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeImageGetMemoryPropertiesExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeImageGetMemoryPropertiesExpPrologue( hImage, pMemoryProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeImageGetMemoryPropertiesExp", result);
         }
@@ -8206,6 +10068,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeImageGetMemoryPropertiesExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeImageGetMemoryPropertiesExpPrologue( hImage, pMemoryProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeImageGetMemoryPropertiesExp", result);
         }
@@ -8213,6 +10076,13 @@ namespace validation_layer
         auto driver_result = pfnGetMemoryPropertiesExp( hImage, pMemoryProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeImageGetMemoryPropertiesExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeImageGetMemoryPropertiesExp", [=]() { handler->zeImageGetMemoryPropertiesExpEpilogue( hImage, pMemoryProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeImageGetMemoryPropertiesExpEpilogue( hImage, pMemoryProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeImageGetMemoryPropertiesExp", result);
         }
@@ -8244,6 +10114,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeImageViewCreateExt", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeImageViewCreateExtPrologue( hContext, hDevice, desc, hImage, phImageView );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeImageViewCreateExt", result);
         }
@@ -8255,6 +10126,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeImageViewCreateExt", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeImageViewCreateExtPrologue( hContext, hDevice, desc, hImage, phImageView );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeImageViewCreateExt", result);
         }
@@ -8262,6 +10134,12 @@ namespace validation_layer
         auto driver_result = pfnViewCreateExt( hContext, hDevice, desc, hImage, phImageView );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeImageViewCreateExt", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeImageViewCreateExt", [=]() { handler->zeImageViewCreateExtEpilogue( hContext, hDevice, desc, hImage, phImageView ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeImageViewCreateExtEpilogue( hContext, hDevice, desc, hImage, phImageView ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeImageViewCreateExt", result);
         }
@@ -8298,6 +10176,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeImageViewCreateExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeImageViewCreateExpPrologue( hContext, hDevice, desc, hImage, phImageView );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeImageViewCreateExp", result);
         }
@@ -8309,6 +10188,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeImageViewCreateExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeImageViewCreateExpPrologue( hContext, hDevice, desc, hImage, phImageView );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeImageViewCreateExp", result);
         }
@@ -8316,6 +10196,12 @@ namespace validation_layer
         auto driver_result = pfnViewCreateExp( hContext, hDevice, desc, hImage, phImageView );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeImageViewCreateExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeImageViewCreateExp", [=]() { handler->zeImageViewCreateExpEpilogue( hContext, hDevice, desc, hImage, phImageView ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeImageViewCreateExpEpilogue( hContext, hDevice, desc, hImage, phImageView ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeImageViewCreateExp", result);
         }
@@ -8348,7 +10234,10 @@ namespace validation_layer
             return logAndPropagateResult("zeKernelSchedulingHintExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeKernelSchedulingHintExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeKernelSchedulingHintExpPrologue( hKernel, pHint );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeKernelSchedulingHintExp", result);
         }
@@ -8360,6 +10249,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeKernelSchedulingHintExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeKernelSchedulingHintExpPrologue( hKernel, pHint );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeKernelSchedulingHintExp", result);
         }
@@ -8367,6 +10257,13 @@ namespace validation_layer
         auto driver_result = pfnSchedulingHintExp( hKernel, pHint );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeKernelSchedulingHintExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeKernelSchedulingHintExp", [=]() { handler->zeKernelSchedulingHintExpEpilogue( hKernel, pHint ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeKernelSchedulingHintExpEpilogue( hKernel, pHint ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeKernelSchedulingHintExp", result);
         }
@@ -8390,7 +10287,10 @@ namespace validation_layer
             return logAndPropagateResult("zeDevicePciGetPropertiesExt", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDevicePciGetPropertiesExt", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeDevicePciGetPropertiesExtPrologue( hDevice, pPciProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDevicePciGetPropertiesExt", result);
         }
@@ -8402,6 +10302,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeDevicePciGetPropertiesExt", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeDevicePciGetPropertiesExtPrologue( hDevice, pPciProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDevicePciGetPropertiesExt", result);
         }
@@ -8409,6 +10310,13 @@ namespace validation_layer
         auto driver_result = pfnPciGetPropertiesExt( hDevice, pPciProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDevicePciGetPropertiesExt", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeDevicePciGetPropertiesExt", [=]() { handler->zeDevicePciGetPropertiesExtEpilogue( hDevice, pPciProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeDevicePciGetPropertiesExtEpilogue( hDevice, pPciProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDevicePciGetPropertiesExt", result);
         }
@@ -8443,7 +10351,10 @@ namespace validation_layer
             return logAndPropagateResult("zeCommandListAppendImageCopyToMemoryExt", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListAppendImageCopyToMemoryExt", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendImageCopyToMemoryExtPrologue( hCommandList, dstptr, hSrcImage, pSrcRegion, destRowPitch, destSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendImageCopyToMemoryExt", result);
         }
@@ -8455,6 +10366,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeCommandListAppendImageCopyToMemoryExt", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandListAppendImageCopyToMemoryExtPrologue( hCommandList, dstptr, hSrcImage, pSrcRegion, destRowPitch, destSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendImageCopyToMemoryExt", result);
         }
@@ -8462,6 +10374,13 @@ namespace validation_layer
         auto driver_result = pfnAppendImageCopyToMemoryExt( hCommandList, dstptr, hSrcImage, pSrcRegion, destRowPitch, destSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListAppendImageCopyToMemoryExt", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeCommandListAppendImageCopyToMemoryExt", [=]() { handler->zeCommandListAppendImageCopyToMemoryExtEpilogue( hCommandList, dstptr, hSrcImage, pSrcRegion, destRowPitch, destSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendImageCopyToMemoryExtEpilogue( hCommandList, dstptr, hSrcImage, pSrcRegion, destRowPitch, destSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendImageCopyToMemoryExt", result);
         }
@@ -8496,7 +10415,10 @@ namespace validation_layer
             return logAndPropagateResult("zeCommandListAppendImageCopyFromMemoryExt", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListAppendImageCopyFromMemoryExt", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendImageCopyFromMemoryExtPrologue( hCommandList, hDstImage, srcptr, pDstRegion, srcRowPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendImageCopyFromMemoryExt", result);
         }
@@ -8508,6 +10430,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeCommandListAppendImageCopyFromMemoryExt", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandListAppendImageCopyFromMemoryExtPrologue( hCommandList, hDstImage, srcptr, pDstRegion, srcRowPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendImageCopyFromMemoryExt", result);
         }
@@ -8515,6 +10438,13 @@ namespace validation_layer
         auto driver_result = pfnAppendImageCopyFromMemoryExt( hCommandList, hDstImage, srcptr, pDstRegion, srcRowPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListAppendImageCopyFromMemoryExt", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeCommandListAppendImageCopyFromMemoryExt", [=]() { handler->zeCommandListAppendImageCopyFromMemoryExtEpilogue( hCommandList, hDstImage, srcptr, pDstRegion, srcRowPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListAppendImageCopyFromMemoryExtEpilogue( hCommandList, hDstImage, srcptr, pDstRegion, srcRowPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListAppendImageCopyFromMemoryExt", result);
         }
@@ -8539,7 +10469,10 @@ namespace validation_layer
             return logAndPropagateResult("zeImageGetAllocPropertiesExt", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeImageGetAllocPropertiesExt", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeImageGetAllocPropertiesExtPrologue( hContext, hImage, pImageAllocProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeImageGetAllocPropertiesExt", result);
         }
@@ -8551,6 +10484,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeImageGetAllocPropertiesExt", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeImageGetAllocPropertiesExtPrologue( hContext, hImage, pImageAllocProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeImageGetAllocPropertiesExt", result);
         }
@@ -8558,6 +10492,13 @@ namespace validation_layer
         auto driver_result = pfnGetAllocPropertiesExt( hContext, hImage, pImageAllocProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeImageGetAllocPropertiesExt", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeImageGetAllocPropertiesExt", [=]() { handler->zeImageGetAllocPropertiesExtEpilogue( hContext, hImage, pImageAllocProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeImageGetAllocPropertiesExtEpilogue( hContext, hImage, pImageAllocProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeImageGetAllocPropertiesExt", result);
         }
@@ -8585,7 +10526,10 @@ namespace validation_layer
             return logAndPropagateResult("zeModuleInspectLinkageExt", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeModuleInspectLinkageExt", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeModuleInspectLinkageExtPrologue( pInspectDesc, numModules, phModules, phLog );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeModuleInspectLinkageExt", result);
         }
@@ -8597,6 +10541,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeModuleInspectLinkageExt", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeModuleInspectLinkageExtPrologue( pInspectDesc, numModules, phModules, phLog );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeModuleInspectLinkageExt", result);
         }
@@ -8604,6 +10549,13 @@ namespace validation_layer
         auto driver_result = pfnInspectLinkageExt( pInspectDesc, numModules, phModules, phLog );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeModuleInspectLinkageExt", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeModuleInspectLinkageExt", [=]() { handler->zeModuleInspectLinkageExtEpilogue( pInspectDesc, numModules, phModules, phLog ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeModuleInspectLinkageExtEpilogue( pInspectDesc, numModules, phModules, phLog ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeModuleInspectLinkageExt", result);
         }
@@ -8629,6 +10581,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeMemFreeExt", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeMemFreeExtPrologue( hContext, pMemFreeDesc, ptr );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeMemFreeExt", result);
         }
@@ -8640,6 +10593,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeMemFreeExt", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeMemFreeExtPrologue( hContext, pMemFreeDesc, ptr );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeMemFreeExt", result);
         }
@@ -8647,6 +10601,12 @@ namespace validation_layer
         auto driver_result = pfnFreeExt( hContext, pMemFreeDesc, ptr );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeMemFreeExt", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeMemFreeExt", [=]() { handler->zeMemFreeExtEpilogue( hContext, pMemFreeDesc, ptr ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeMemFreeExtEpilogue( hContext, pMemFreeDesc, ptr ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeMemFreeExt", result);
         }
@@ -8678,7 +10638,10 @@ namespace validation_layer
             return logAndPropagateResult("zeFabricVertexGetExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeFabricVertexGetExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeFabricVertexGetExpPrologue( hDriver, pCount, phVertices );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeFabricVertexGetExp", result);
         }
@@ -8690,6 +10653,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeFabricVertexGetExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeFabricVertexGetExpPrologue( hDriver, pCount, phVertices );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeFabricVertexGetExp", result);
         }
@@ -8697,6 +10661,13 @@ namespace validation_layer
         auto driver_result = pfnGetExp( hDriver, pCount, phVertices );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeFabricVertexGetExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeFabricVertexGetExp", [=]() { handler->zeFabricVertexGetExpEpilogue( hDriver, pCount, phVertices ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeFabricVertexGetExpEpilogue( hDriver, pCount, phVertices ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeFabricVertexGetExp", result);
         }
@@ -8738,7 +10709,10 @@ namespace validation_layer
             return logAndPropagateResult("zeFabricVertexGetSubVerticesExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeFabricVertexGetSubVerticesExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeFabricVertexGetSubVerticesExpPrologue( hVertex, pCount, phSubvertices );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeFabricVertexGetSubVerticesExp", result);
         }
@@ -8750,6 +10724,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeFabricVertexGetSubVerticesExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeFabricVertexGetSubVerticesExpPrologue( hVertex, pCount, phSubvertices );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeFabricVertexGetSubVerticesExp", result);
         }
@@ -8757,6 +10732,13 @@ namespace validation_layer
         auto driver_result = pfnGetSubVerticesExp( hVertex, pCount, phSubvertices );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeFabricVertexGetSubVerticesExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeFabricVertexGetSubVerticesExp", [=]() { handler->zeFabricVertexGetSubVerticesExpEpilogue( hVertex, pCount, phSubvertices ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeFabricVertexGetSubVerticesExpEpilogue( hVertex, pCount, phSubvertices ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeFabricVertexGetSubVerticesExp", result);
         }
@@ -8790,7 +10772,10 @@ namespace validation_layer
             return logAndPropagateResult("zeFabricVertexGetPropertiesExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeFabricVertexGetPropertiesExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeFabricVertexGetPropertiesExpPrologue( hVertex, pVertexProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeFabricVertexGetPropertiesExp", result);
         }
@@ -8802,6 +10787,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeFabricVertexGetPropertiesExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeFabricVertexGetPropertiesExpPrologue( hVertex, pVertexProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeFabricVertexGetPropertiesExp", result);
         }
@@ -8809,6 +10795,13 @@ namespace validation_layer
         auto driver_result = pfnGetPropertiesExp( hVertex, pVertexProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeFabricVertexGetPropertiesExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeFabricVertexGetPropertiesExp", [=]() { handler->zeFabricVertexGetPropertiesExpEpilogue( hVertex, pVertexProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeFabricVertexGetPropertiesExpEpilogue( hVertex, pVertexProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeFabricVertexGetPropertiesExp", result);
         }
@@ -8836,7 +10829,10 @@ namespace validation_layer
             return logAndPropagateResult("zeFabricVertexGetDeviceExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeFabricVertexGetDeviceExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeFabricVertexGetDeviceExpPrologue( hVertex, phDevice );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeFabricVertexGetDeviceExp", result);
         }
@@ -8848,6 +10844,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeFabricVertexGetDeviceExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeFabricVertexGetDeviceExpPrologue( hVertex, phDevice );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeFabricVertexGetDeviceExp", result);
         }
@@ -8855,6 +10852,13 @@ namespace validation_layer
         auto driver_result = pfnGetDeviceExp( hVertex, phDevice );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeFabricVertexGetDeviceExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeFabricVertexGetDeviceExp", [=]() { handler->zeFabricVertexGetDeviceExpEpilogue( hVertex, phDevice ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeFabricVertexGetDeviceExpEpilogue( hVertex, phDevice ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeFabricVertexGetDeviceExp", result);
         }
@@ -8887,7 +10891,10 @@ namespace validation_layer
             return logAndPropagateResult("zeDeviceGetFabricVertexExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDeviceGetFabricVertexExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetFabricVertexExpPrologue( hDevice, phVertex );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceGetFabricVertexExp", result);
         }
@@ -8899,6 +10906,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeDeviceGetFabricVertexExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceGetFabricVertexExpPrologue( hDevice, phVertex );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceGetFabricVertexExp", result);
         }
@@ -8906,6 +10914,13 @@ namespace validation_layer
         auto driver_result = pfnGetFabricVertexExp( hDevice, phVertex );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDeviceGetFabricVertexExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeDeviceGetFabricVertexExp", [=]() { handler->zeDeviceGetFabricVertexExpEpilogue( hDevice, phVertex ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeDeviceGetFabricVertexExpEpilogue( hDevice, phVertex ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDeviceGetFabricVertexExp", result);
         }
@@ -8947,7 +10962,10 @@ namespace validation_layer
             return logAndPropagateResult("zeFabricEdgeGetExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeFabricEdgeGetExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeFabricEdgeGetExpPrologue( hVertexA, hVertexB, pCount, phEdges );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeFabricEdgeGetExp", result);
         }
@@ -8959,6 +10977,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeFabricEdgeGetExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeFabricEdgeGetExpPrologue( hVertexA, hVertexB, pCount, phEdges );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeFabricEdgeGetExp", result);
         }
@@ -8966,6 +10985,13 @@ namespace validation_layer
         auto driver_result = pfnGetExp( hVertexA, hVertexB, pCount, phEdges );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeFabricEdgeGetExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeFabricEdgeGetExp", [=]() { handler->zeFabricEdgeGetExpEpilogue( hVertexA, hVertexB, pCount, phEdges ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeFabricEdgeGetExpEpilogue( hVertexA, hVertexB, pCount, phEdges ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeFabricEdgeGetExp", result);
         }
@@ -9000,7 +11026,10 @@ namespace validation_layer
             return logAndPropagateResult("zeFabricEdgeGetVerticesExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeFabricEdgeGetVerticesExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeFabricEdgeGetVerticesExpPrologue( hEdge, phVertexA, phVertexB );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeFabricEdgeGetVerticesExp", result);
         }
@@ -9012,6 +11041,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeFabricEdgeGetVerticesExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeFabricEdgeGetVerticesExpPrologue( hEdge, phVertexA, phVertexB );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeFabricEdgeGetVerticesExp", result);
         }
@@ -9019,6 +11049,13 @@ namespace validation_layer
         auto driver_result = pfnGetVerticesExp( hEdge, phVertexA, phVertexB );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeFabricEdgeGetVerticesExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeFabricEdgeGetVerticesExp", [=]() { handler->zeFabricEdgeGetVerticesExpEpilogue( hEdge, phVertexA, phVertexB ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeFabricEdgeGetVerticesExpEpilogue( hEdge, phVertexA, phVertexB ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeFabricEdgeGetVerticesExp", result);
         }
@@ -9056,7 +11093,10 @@ namespace validation_layer
             return logAndPropagateResult("zeFabricEdgeGetPropertiesExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeFabricEdgeGetPropertiesExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeFabricEdgeGetPropertiesExpPrologue( hEdge, pEdgeProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeFabricEdgeGetPropertiesExp", result);
         }
@@ -9068,6 +11108,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeFabricEdgeGetPropertiesExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeFabricEdgeGetPropertiesExpPrologue( hEdge, pEdgeProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeFabricEdgeGetPropertiesExp", result);
         }
@@ -9075,6 +11116,13 @@ namespace validation_layer
         auto driver_result = pfnGetPropertiesExp( hEdge, pEdgeProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeFabricEdgeGetPropertiesExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeFabricEdgeGetPropertiesExp", [=]() { handler->zeFabricEdgeGetPropertiesExpEpilogue( hEdge, pEdgeProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeFabricEdgeGetPropertiesExpEpilogue( hEdge, pEdgeProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeFabricEdgeGetPropertiesExp", result);
         }
@@ -9117,7 +11165,10 @@ namespace validation_layer
             return logAndPropagateResult("zeEventQueryKernelTimestampsExt", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeEventQueryKernelTimestampsExt", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeEventQueryKernelTimestampsExtPrologue( hEvent, hDevice, pCount, pResults );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventQueryKernelTimestampsExt", result);
         }
@@ -9129,6 +11180,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeEventQueryKernelTimestampsExt", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeEventQueryKernelTimestampsExtPrologue( hEvent, hDevice, pCount, pResults );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventQueryKernelTimestampsExt", result);
         }
@@ -9136,6 +11188,13 @@ namespace validation_layer
         auto driver_result = pfnQueryKernelTimestampsExt( hEvent, hDevice, pCount, pResults );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeEventQueryKernelTimestampsExt", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeEventQueryKernelTimestampsExt", [=]() { handler->zeEventQueryKernelTimestampsExtEpilogue( hEvent, hDevice, pCount, pResults ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeEventQueryKernelTimestampsExtEpilogue( hEvent, hDevice, pCount, pResults ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeEventQueryKernelTimestampsExt", result);
         }
@@ -9161,6 +11220,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeRTASBuilderCreateExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeRTASBuilderCreateExpPrologue( hDriver, pDescriptor, phBuilder );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeRTASBuilderCreateExp", result);
         }
@@ -9172,6 +11232,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeRTASBuilderCreateExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeRTASBuilderCreateExpPrologue( hDriver, pDescriptor, phBuilder );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeRTASBuilderCreateExp", result);
         }
@@ -9179,6 +11240,12 @@ namespace validation_layer
         auto driver_result = pfnCreateExp( hDriver, pDescriptor, phBuilder );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeRTASBuilderCreateExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeRTASBuilderCreateExp", [=]() { handler->zeRTASBuilderCreateExpEpilogue( hDriver, pDescriptor, phBuilder ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeRTASBuilderCreateExpEpilogue( hDriver, pDescriptor, phBuilder ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeRTASBuilderCreateExp", result);
         }
@@ -9212,7 +11279,10 @@ namespace validation_layer
             return logAndPropagateResult("zeRTASBuilderGetBuildPropertiesExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeRTASBuilderGetBuildPropertiesExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeRTASBuilderGetBuildPropertiesExpPrologue( hBuilder, pBuildOpDescriptor, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeRTASBuilderGetBuildPropertiesExp", result);
         }
@@ -9224,6 +11294,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeRTASBuilderGetBuildPropertiesExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeRTASBuilderGetBuildPropertiesExpPrologue( hBuilder, pBuildOpDescriptor, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeRTASBuilderGetBuildPropertiesExp", result);
         }
@@ -9231,6 +11302,13 @@ namespace validation_layer
         auto driver_result = pfnGetBuildPropertiesExp( hBuilder, pBuildOpDescriptor, pProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeRTASBuilderGetBuildPropertiesExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeRTASBuilderGetBuildPropertiesExp", [=]() { handler->zeRTASBuilderGetBuildPropertiesExpEpilogue( hBuilder, pBuildOpDescriptor, pProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeRTASBuilderGetBuildPropertiesExpEpilogue( hBuilder, pBuildOpDescriptor, pProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeRTASBuilderGetBuildPropertiesExp", result);
         }
@@ -9259,7 +11337,10 @@ namespace validation_layer
             return logAndPropagateResult("zeDriverRTASFormatCompatibilityCheckExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDriverRTASFormatCompatibilityCheckExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeDriverRTASFormatCompatibilityCheckExpPrologue( hDriver, rtasFormatA, rtasFormatB );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDriverRTASFormatCompatibilityCheckExp", result);
         }
@@ -9271,6 +11352,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeDriverRTASFormatCompatibilityCheckExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeDriverRTASFormatCompatibilityCheckExpPrologue( hDriver, rtasFormatA, rtasFormatB );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDriverRTASFormatCompatibilityCheckExp", result);
         }
@@ -9278,6 +11360,13 @@ namespace validation_layer
         auto driver_result = pfnRTASFormatCompatibilityCheckExp( hDriver, rtasFormatA, rtasFormatB );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeDriverRTASFormatCompatibilityCheckExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeDriverRTASFormatCompatibilityCheckExp", [=]() { handler->zeDriverRTASFormatCompatibilityCheckExpEpilogue( hDriver, rtasFormatA, rtasFormatB ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeDriverRTASFormatCompatibilityCheckExpEpilogue( hDriver, rtasFormatA, rtasFormatB ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeDriverRTASFormatCompatibilityCheckExp", result);
         }
@@ -9312,7 +11401,10 @@ namespace validation_layer
             return logAndPropagateResult("zeRTASBuilderBuildExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeRTASBuilderBuildExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeRTASBuilderBuildExpPrologue( hBuilder, pBuildOpDescriptor, pScratchBuffer, scratchBufferSizeBytes, pRtasBuffer, rtasBufferSizeBytes, hParallelOperation, pBuildUserPtr, pBounds, pRtasBufferSizeBytes );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeRTASBuilderBuildExp", result);
         }
@@ -9324,6 +11416,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeRTASBuilderBuildExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeRTASBuilderBuildExpPrologue( hBuilder, pBuildOpDescriptor, pScratchBuffer, scratchBufferSizeBytes, pRtasBuffer, rtasBufferSizeBytes, hParallelOperation, pBuildUserPtr, pBounds, pRtasBufferSizeBytes );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeRTASBuilderBuildExp", result);
         }
@@ -9331,6 +11424,13 @@ namespace validation_layer
         auto driver_result = pfnBuildExp( hBuilder, pBuildOpDescriptor, pScratchBuffer, scratchBufferSizeBytes, pRtasBuffer, rtasBufferSizeBytes, hParallelOperation, pBuildUserPtr, pBounds, pRtasBufferSizeBytes );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeRTASBuilderBuildExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeRTASBuilderBuildExp", [=]() { handler->zeRTASBuilderBuildExpEpilogue( hBuilder, pBuildOpDescriptor, pScratchBuffer, scratchBufferSizeBytes, pRtasBuffer, rtasBufferSizeBytes, hParallelOperation, pBuildUserPtr, pBounds, pRtasBufferSizeBytes ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeRTASBuilderBuildExpEpilogue( hBuilder, pBuildOpDescriptor, pScratchBuffer, scratchBufferSizeBytes, pRtasBuffer, rtasBufferSizeBytes, hParallelOperation, pBuildUserPtr, pBounds, pRtasBufferSizeBytes ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeRTASBuilderBuildExp", result);
         }
@@ -9354,6 +11454,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeRTASBuilderDestroyExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeRTASBuilderDestroyExpPrologue( hBuilder );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeRTASBuilderDestroyExp", result);
         }
@@ -9365,6 +11466,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeRTASBuilderDestroyExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeRTASBuilderDestroyExpPrologue( hBuilder );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeRTASBuilderDestroyExp", result);
         }
@@ -9372,6 +11474,12 @@ namespace validation_layer
         auto driver_result = pfnDestroyExp( hBuilder );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeRTASBuilderDestroyExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeRTASBuilderDestroyExp", [=]() { handler->zeRTASBuilderDestroyExpEpilogue( hBuilder ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeRTASBuilderDestroyExpEpilogue( hBuilder ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeRTASBuilderDestroyExp", result);
         }
@@ -9396,6 +11504,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeRTASParallelOperationCreateExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeRTASParallelOperationCreateExpPrologue( hDriver, phParallelOperation );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeRTASParallelOperationCreateExp", result);
         }
@@ -9407,6 +11516,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeRTASParallelOperationCreateExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeRTASParallelOperationCreateExpPrologue( hDriver, phParallelOperation );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeRTASParallelOperationCreateExp", result);
         }
@@ -9414,6 +11524,12 @@ namespace validation_layer
         auto driver_result = pfnCreateExp( hDriver, phParallelOperation );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeRTASParallelOperationCreateExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeRTASParallelOperationCreateExp", [=]() { handler->zeRTASParallelOperationCreateExpEpilogue( hDriver, phParallelOperation ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeRTASParallelOperationCreateExpEpilogue( hDriver, phParallelOperation ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeRTASParallelOperationCreateExp", result);
         }
@@ -9446,7 +11562,10 @@ namespace validation_layer
             return logAndPropagateResult("zeRTASParallelOperationGetPropertiesExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeRTASParallelOperationGetPropertiesExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeRTASParallelOperationGetPropertiesExpPrologue( hParallelOperation, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeRTASParallelOperationGetPropertiesExp", result);
         }
@@ -9458,6 +11577,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeRTASParallelOperationGetPropertiesExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeRTASParallelOperationGetPropertiesExpPrologue( hParallelOperation, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeRTASParallelOperationGetPropertiesExp", result);
         }
@@ -9465,6 +11585,13 @@ namespace validation_layer
         auto driver_result = pfnGetPropertiesExp( hParallelOperation, pProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeRTASParallelOperationGetPropertiesExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeRTASParallelOperationGetPropertiesExp", [=]() { handler->zeRTASParallelOperationGetPropertiesExpEpilogue( hParallelOperation, pProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeRTASParallelOperationGetPropertiesExpEpilogue( hParallelOperation, pProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeRTASParallelOperationGetPropertiesExp", result);
         }
@@ -9491,7 +11618,10 @@ namespace validation_layer
             return logAndPropagateResult("zeRTASParallelOperationJoinExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeRTASParallelOperationJoinExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeRTASParallelOperationJoinExpPrologue( hParallelOperation );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeRTASParallelOperationJoinExp", result);
         }
@@ -9503,6 +11633,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeRTASParallelOperationJoinExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeRTASParallelOperationJoinExpPrologue( hParallelOperation );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeRTASParallelOperationJoinExp", result);
         }
@@ -9510,6 +11641,13 @@ namespace validation_layer
         auto driver_result = pfnJoinExp( hParallelOperation );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeRTASParallelOperationJoinExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeRTASParallelOperationJoinExp", [=]() { handler->zeRTASParallelOperationJoinExpEpilogue( hParallelOperation ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeRTASParallelOperationJoinExpEpilogue( hParallelOperation ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeRTASParallelOperationJoinExp", result);
         }
@@ -9533,6 +11671,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeRTASParallelOperationDestroyExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeRTASParallelOperationDestroyExpPrologue( hParallelOperation );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeRTASParallelOperationDestroyExp", result);
         }
@@ -9544,6 +11683,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeRTASParallelOperationDestroyExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeRTASParallelOperationDestroyExpPrologue( hParallelOperation );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeRTASParallelOperationDestroyExp", result);
         }
@@ -9551,6 +11691,12 @@ namespace validation_layer
         auto driver_result = pfnDestroyExp( hParallelOperation );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeRTASParallelOperationDestroyExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeRTASParallelOperationDestroyExp", [=]() { handler->zeRTASParallelOperationDestroyExpEpilogue( hParallelOperation ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeRTASParallelOperationDestroyExpEpilogue( hParallelOperation ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeRTASParallelOperationDestroyExp", result);
         }
@@ -9578,7 +11724,10 @@ namespace validation_layer
             return logAndPropagateResult("zeMemGetPitchFor2dImage", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeMemGetPitchFor2dImage", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeMemGetPitchFor2dImagePrologue( hContext, hDevice, imageWidth, imageHeight, elementSizeInBytes, rowPitch );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeMemGetPitchFor2dImage", result);
         }
@@ -9590,6 +11739,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeMemGetPitchFor2dImage", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeMemGetPitchFor2dImagePrologue( hContext, hDevice, imageWidth, imageHeight, elementSizeInBytes, rowPitch );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeMemGetPitchFor2dImage", result);
         }
@@ -9597,6 +11747,13 @@ namespace validation_layer
         auto driver_result = pfnGetPitchFor2dImage( hContext, hDevice, imageWidth, imageHeight, elementSizeInBytes, rowPitch );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeMemGetPitchFor2dImage", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeMemGetPitchFor2dImage", [=]() { handler->zeMemGetPitchFor2dImageEpilogue( hContext, hDevice, imageWidth, imageHeight, elementSizeInBytes, rowPitch ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeMemGetPitchFor2dImageEpilogue( hContext, hDevice, imageWidth, imageHeight, elementSizeInBytes, rowPitch ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeMemGetPitchFor2dImage", result);
         }
@@ -9620,7 +11777,10 @@ namespace validation_layer
             return logAndPropagateResult("zeImageGetDeviceOffsetExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeImageGetDeviceOffsetExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeImageGetDeviceOffsetExpPrologue( hImage, pDeviceOffset );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeImageGetDeviceOffsetExp", result);
         }
@@ -9632,6 +11792,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeImageGetDeviceOffsetExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeImageGetDeviceOffsetExpPrologue( hImage, pDeviceOffset );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeImageGetDeviceOffsetExp", result);
         }
@@ -9639,6 +11800,13 @@ namespace validation_layer
         auto driver_result = pfnGetDeviceOffsetExp( hImage, pDeviceOffset );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeImageGetDeviceOffsetExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeImageGetDeviceOffsetExp", [=]() { handler->zeImageGetDeviceOffsetExpEpilogue( hImage, pDeviceOffset ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeImageGetDeviceOffsetExpEpilogue( hImage, pDeviceOffset ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeImageGetDeviceOffsetExp", result);
         }
@@ -9667,6 +11835,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListCreateCloneExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListCreateCloneExpPrologue( hCommandList, phClonedCommandList );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListCreateCloneExp", result);
         }
@@ -9678,6 +11847,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeCommandListCreateCloneExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandListCreateCloneExpPrologue( hCommandList, phClonedCommandList );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListCreateCloneExp", result);
         }
@@ -9685,6 +11855,12 @@ namespace validation_layer
         auto driver_result = pfnCreateCloneExp( hCommandList, phClonedCommandList );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListCreateCloneExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeCommandListCreateCloneExp", [=]() { handler->zeCommandListCreateCloneExpEpilogue( hCommandList, phClonedCommandList ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListCreateCloneExpEpilogue( hCommandList, phClonedCommandList ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListCreateCloneExp", result);
         }
@@ -9727,7 +11903,10 @@ namespace validation_layer
             return logAndPropagateResult("zeCommandListImmediateAppendCommandListsExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListImmediateAppendCommandListsExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListImmediateAppendCommandListsExpPrologue( hCommandListImmediate, numCommandLists, phCommandLists, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListImmediateAppendCommandListsExp", result);
         }
@@ -9739,6 +11918,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeCommandListImmediateAppendCommandListsExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandListImmediateAppendCommandListsExpPrologue( hCommandListImmediate, numCommandLists, phCommandLists, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListImmediateAppendCommandListsExp", result);
         }
@@ -9746,6 +11926,13 @@ namespace validation_layer
         auto driver_result = pfnImmediateAppendCommandListsExp( hCommandListImmediate, numCommandLists, phCommandLists, hSignalEvent, numWaitEvents, phWaitEvents );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListImmediateAppendCommandListsExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeCommandListImmediateAppendCommandListsExp", [=]() { handler->zeCommandListImmediateAppendCommandListsExpEpilogue( hCommandListImmediate, numCommandLists, phCommandLists, hSignalEvent, numWaitEvents, phWaitEvents ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListImmediateAppendCommandListsExpEpilogue( hCommandListImmediate, numCommandLists, phCommandLists, hSignalEvent, numWaitEvents, phWaitEvents ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListImmediateAppendCommandListsExp", result);
         }
@@ -9770,7 +11957,10 @@ namespace validation_layer
             return logAndPropagateResult("zeCommandListGetNextCommandIdExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListGetNextCommandIdExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListGetNextCommandIdExpPrologue( hCommandList, desc, pCommandId );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListGetNextCommandIdExp", result);
         }
@@ -9782,6 +11972,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeCommandListGetNextCommandIdExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandListGetNextCommandIdExpPrologue( hCommandList, desc, pCommandId );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListGetNextCommandIdExp", result);
         }
@@ -9789,6 +11980,13 @@ namespace validation_layer
         auto driver_result = pfnGetNextCommandIdExp( hCommandList, desc, pCommandId );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListGetNextCommandIdExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeCommandListGetNextCommandIdExp", [=]() { handler->zeCommandListGetNextCommandIdExpEpilogue( hCommandList, desc, pCommandId ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListGetNextCommandIdExpEpilogue( hCommandList, desc, pCommandId ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListGetNextCommandIdExp", result);
         }
@@ -9821,7 +12019,10 @@ namespace validation_layer
             return logAndPropagateResult("zeCommandListGetNextCommandIdWithKernelsExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListGetNextCommandIdWithKernelsExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListGetNextCommandIdWithKernelsExpPrologue( hCommandList, desc, numKernels, phKernels, pCommandId );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListGetNextCommandIdWithKernelsExp", result);
         }
@@ -9833,6 +12034,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeCommandListGetNextCommandIdWithKernelsExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandListGetNextCommandIdWithKernelsExpPrologue( hCommandList, desc, numKernels, phKernels, pCommandId );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListGetNextCommandIdWithKernelsExp", result);
         }
@@ -9840,6 +12042,13 @@ namespace validation_layer
         auto driver_result = pfnGetNextCommandIdWithKernelsExp( hCommandList, desc, numKernels, phKernels, pCommandId );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListGetNextCommandIdWithKernelsExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeCommandListGetNextCommandIdWithKernelsExp", [=]() { handler->zeCommandListGetNextCommandIdWithKernelsExpEpilogue( hCommandList, desc, numKernels, phKernels, pCommandId ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListGetNextCommandIdWithKernelsExpEpilogue( hCommandList, desc, numKernels, phKernels, pCommandId ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListGetNextCommandIdWithKernelsExp", result);
         }
@@ -9868,7 +12077,10 @@ namespace validation_layer
             return logAndPropagateResult("zeCommandListUpdateMutableCommandsExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListUpdateMutableCommandsExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListUpdateMutableCommandsExpPrologue( hCommandList, desc );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListUpdateMutableCommandsExp", result);
         }
@@ -9880,6 +12092,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeCommandListUpdateMutableCommandsExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandListUpdateMutableCommandsExpPrologue( hCommandList, desc );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListUpdateMutableCommandsExp", result);
         }
@@ -9887,6 +12100,13 @@ namespace validation_layer
         auto driver_result = pfnUpdateMutableCommandsExp( hCommandList, desc );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListUpdateMutableCommandsExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeCommandListUpdateMutableCommandsExp", [=]() { handler->zeCommandListUpdateMutableCommandsExpEpilogue( hCommandList, desc ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListUpdateMutableCommandsExpEpilogue( hCommandList, desc ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListUpdateMutableCommandsExp", result);
         }
@@ -9911,7 +12131,10 @@ namespace validation_layer
             return logAndPropagateResult("zeCommandListUpdateMutableCommandSignalEventExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListUpdateMutableCommandSignalEventExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListUpdateMutableCommandSignalEventExpPrologue( hCommandList, commandId, hSignalEvent );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListUpdateMutableCommandSignalEventExp", result);
         }
@@ -9923,6 +12146,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeCommandListUpdateMutableCommandSignalEventExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandListUpdateMutableCommandSignalEventExpPrologue( hCommandList, commandId, hSignalEvent );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListUpdateMutableCommandSignalEventExp", result);
         }
@@ -9930,6 +12154,13 @@ namespace validation_layer
         auto driver_result = pfnUpdateMutableCommandSignalEventExp( hCommandList, commandId, hSignalEvent );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListUpdateMutableCommandSignalEventExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeCommandListUpdateMutableCommandSignalEventExp", [=]() { handler->zeCommandListUpdateMutableCommandSignalEventExpEpilogue( hCommandList, commandId, hSignalEvent ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListUpdateMutableCommandSignalEventExpEpilogue( hCommandList, commandId, hSignalEvent ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListUpdateMutableCommandSignalEventExp", result);
         }
@@ -9956,7 +12187,10 @@ namespace validation_layer
             return logAndPropagateResult("zeCommandListUpdateMutableCommandWaitEventsExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListUpdateMutableCommandWaitEventsExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListUpdateMutableCommandWaitEventsExpPrologue( hCommandList, commandId, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListUpdateMutableCommandWaitEventsExp", result);
         }
@@ -9968,6 +12202,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeCommandListUpdateMutableCommandWaitEventsExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandListUpdateMutableCommandWaitEventsExpPrologue( hCommandList, commandId, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListUpdateMutableCommandWaitEventsExp", result);
         }
@@ -9975,6 +12210,13 @@ namespace validation_layer
         auto driver_result = pfnUpdateMutableCommandWaitEventsExp( hCommandList, commandId, numWaitEvents, phWaitEvents );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListUpdateMutableCommandWaitEventsExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeCommandListUpdateMutableCommandWaitEventsExp", [=]() { handler->zeCommandListUpdateMutableCommandWaitEventsExpEpilogue( hCommandList, commandId, numWaitEvents, phWaitEvents ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListUpdateMutableCommandWaitEventsExpEpilogue( hCommandList, commandId, numWaitEvents, phWaitEvents ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListUpdateMutableCommandWaitEventsExp", result);
         }
@@ -10001,7 +12243,10 @@ namespace validation_layer
             return logAndPropagateResult("zeCommandListUpdateMutableCommandKernelsExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListUpdateMutableCommandKernelsExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListUpdateMutableCommandKernelsExpPrologue( hCommandList, numKernels, pCommandId, phKernels );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListUpdateMutableCommandKernelsExp", result);
         }
@@ -10013,6 +12258,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zeCommandListUpdateMutableCommandKernelsExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandListUpdateMutableCommandKernelsExpPrologue( hCommandList, numKernels, pCommandId, phKernels );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListUpdateMutableCommandKernelsExp", result);
         }
@@ -10020,6 +12266,13 @@ namespace validation_layer
         auto driver_result = pfnUpdateMutableCommandKernelsExp( hCommandList, numKernels, pCommandId, phKernels );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zeCommandListUpdateMutableCommandKernelsExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zeCommandListUpdateMutableCommandKernelsExp", [=]() { handler->zeCommandListUpdateMutableCommandKernelsExpEpilogue( hCommandList, numKernels, pCommandId, phKernels ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zeCommandListUpdateMutableCommandKernelsExpEpilogue( hCommandList, numKernels, pCommandId, phKernels ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zeCommandListUpdateMutableCommandKernelsExp", result);
         }
@@ -10045,6 +12298,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zexCounterBasedEventCreate2", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zeValidation->zexCounterBasedEventCreate2Prologue( hContext, hDevice, desc, phEvent );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zexCounterBasedEventCreate2", result);
         }
@@ -10054,6 +12308,7 @@ namespace validation_layer
         }
 
         if(context.enableHandleLifetime){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zexCounterBasedEventCreate2", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zeHandleLifetime.zexCounterBasedEventCreate2Prologue( hContext, hDevice, desc, phEvent );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zexCounterBasedEventCreate2", result);
         }
@@ -10096,6 +12351,12 @@ namespace validation_layer
         }
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zexCounterBasedEventCreate2", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zeValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zexCounterBasedEventCreate2", [=]() { handler->zexCounterBasedEventCreate2Epilogue( hContext, hDevice, desc, phEvent, driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zeValidation->zexCounterBasedEventCreate2Epilogue( hContext, hDevice, desc, phEvent, driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zexCounterBasedEventCreate2", result);
         }
@@ -9,27 +9,84 @@
  */
 #include "ze_validation_layer.h"
 #include "param_validation.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
 #include <memory>
 
 namespace validation_layer
 {
     context_t& context = context_t::getInstance();
 
+    ///////////////////////////////////////////////////////////////////////////////
+    static uint32_t getenv_sample_rate( const char *name, uint32_t defaultRate )
+    {
+        auto rateString = getenv_string( name );
+        if (rateString.empty())
+            return defaultRate;
+        auto rate = strtoul( rateString.c_str(), nullptr, 10 );
+        if (rate == 0 || rate > UINT32_MAX)
+            return defaultRate;
+        return static_cast<uint32_t>(rate);
+    }
+
     ///////////////////////////////////////////////////////////////////////////////
     context_t::context_t()
     {
         enableHandleLifetime = getenv_tobool( "ZE_ENABLE_HANDLE_LIFETIME" );
         if (enableHandleLifetime) {
             handleLifetime = std::make_unique<HandleLifetimeValidation>();
+            if (getenv_tobool( "ZEL_HANDLE_LIFETIME_SHADOW_OBJECTS" ))
+                handleLifetime->enableShadowHandles();
         }
         enableThreadingValidation = getenv_tobool( "ZE_ENABLE_THREADING_VALIDATION" );
 
+        validationSampleRate = getenv_sample_rate( "ZEL_VALIDATION_SAMPLE_RATE", 1 );
+        enableSampling = validationSampleRate > 1;
+
+        if (getenv_tobool( "ZEL_VALIDATION_CHECKER_TIMING" )) {
+            timing = std::make_unique<checkerTiming>();
+        }
+        if (getenv_tobool( "ZEL_VALIDATION_DEFERRED_EPILOGUES" )) {
+            deferredEpilogues = std::make_unique<deferredEpilogueQueue>(timing.get());
+        }
+        auto leakSiteSampleRate = getenv_sample_rate( "ZEL_LEAK_SITE_SAMPLE_RATE", 0 );
+        if (leakSiteSampleRate) {
+            allocationSites = std::make_unique<allocationSiteTracker>(
+                leakSiteSampleRate, getenv_sample_rate( "ZEL_LEAK_SITE_CAPACITY", 16384 ));
+        }
+
+        auto findingsPath = getenv( "ZEL_VALIDATION_FINDINGS_LOG" );
+        if (findingsPath && *findingsPath) {
+            findings = std::make_unique<findingsLog>(findingsPath);
+            if (!findings->isOpen())
+                findings.reset();
+        }
+
         logger = loader::createLogger();
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    void context_t::initSampleRate(validationChecker &checker, const char *sampleRateEnv)
+    {
+        checker.sampleRate = getenv_sample_rate( sampleRateEnv, validationSampleRate );
+        if (checker.sampleRate > 1)
+            enableSampling = true;
+    }
+
     ///////////////////////////////////////////////////////////////////////////////
     context_t::~context_t()
     {
+        // Run outstanding epilogues first so their time is in the report
+        deferredEpilogues.reset();
+        if (timing) {
+            std::cerr << timing->report();
+        }
+        if (allocationSites) {
+            std::cerr << allocationSites->report();
+        }
+        findings.reset();
         validationHandlers.clear();
     }
 } // namespace validation_layer
@@ -53,6 +110,26 @@ zelLoaderGetVersion(zel_component_version_t *version)
     return ZE_RESULT_SUCCESS;
 }
 
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zelGetValidationCheckerTimingReport(size_t *pSize, char *pReport)
+{
+    if(pSize == nullptr)
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+    if(!validation_layer::context.timing)
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+    auto report = validation_layer::context.timing->report();
+    if(pReport == nullptr || *pSize == 0) {
+        *pSize = report.size() + 1;
+        return ZE_RESULT_SUCCESS;
+    }
+    size_t length = std::min(*pSize - 1, report.size());
+    memcpy(pReport, report.data(), length);
+    pReport[length] = '\0';
+    *pSize = length + 1;
+    return ZE_RESULT_SUCCESS;
+}
+
 #if defined(__cplusplus)
 };
 #endif
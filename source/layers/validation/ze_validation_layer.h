@@ -20,7 +20,12 @@
 #include "zes_entry_points.h"
 #include "zer_entry_points.h"
 #include "logging.h"
+#include "validation_timing.h"
+#include "validation_deferred.h"
+#include "validation_alloc_sites.h"
+#include "validation_findings.h"
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #define VALIDATION_COMP_NAME "validation layer"
@@ -35,6 +40,22 @@ namespace validation_layer
         ZESValidationEntryPoints *zesValidation;
         ZETValidationEntryPoints *zetValidation;
         ZERValidationEntryPoints *zerValidation;
+
+        // Label used in the ZEL_VALIDATION_CHECKER_TIMING report
+        const char *checkerName = "unnamed";
+
+        // Prologues and epilogues run on 1 in sampleRate calls of each thread.
+        // Create/destroy style APIs are never sampled, see valddi.cpp.mako.
+        uint32_t sampleRate = 1;
+        bool isSampled(uint64_t sampleTick) const {
+            return (sampleRate <= 1) || (sampleTick % sampleRate == 0);
+        }
+
+        // Set by checkers whose epilogues only record state and never read
+        // caller memory through pointer arguments. Under
+        // ZEL_VALIDATION_DEFERRED_EPILOGUES their epilogues run on a background
+        // worker and their return values are ignored.
+        bool deferEpilogues = false;
     };
     class __zedlllocal context_t
     {
@@ -44,20 +65,87 @@ namespace validation_layer
         bool enableHandleLifetime = false;
         bool enableThreadingValidation = false;
 
+        uint32_t validationSampleRate = 1;
+        bool enableSampling = false;
+
         ze_dditable_t   zeDdiTable = {};
         zet_dditable_t  zetDdiTable = {};
         zes_dditable_t  zesDdiTable = {};
         zer_dditable_t  zerDdiTable = {};
 
         std::vector<validationChecker *> validationHandlers;
+
+        // Run once from the first zeInit/zeInitDrivers/zesInit intercept that
+        // succeeds, so the drivers can be queried; no other API can have been
+        // dispatched through the tables above yet
+        std::vector<void (*)()> ddiTablesReadyCallbacks;
+        std::once_flag ddiTablesReadyFlag;
+        void notifyDdiTablesReady() {
+            std::call_once(ddiTablesReadyFlag, [this]() {
+                for (auto callback : ddiTablesReadyCallbacks)
+                    callback();
+            });
+        }
         std::unique_ptr<HandleLifetimeValidation> handleLifetime;
-        
+
+        // Non-null when ZEL_VALIDATION_CHECKER_TIMING is enabled
+        std::unique_ptr<checkerTiming> timing;
+
+        // Non-null when ZEL_VALIDATION_DEFERRED_EPILOGUES is enabled
+        std::unique_ptr<deferredEpilogueQueue> deferredEpilogues;
+        // Runs everything queued so far; epilogues deferred afterwards run inline
+        void stopDeferredEpilogues() {
+            if (deferredEpilogues)
+                deferredEpilogues->shutdown();
+        }
+
+        // Non-null when ZEL_LEAK_SITE_SAMPLE_RATE is set
+        std::unique_ptr<allocationSiteTracker> allocationSites;
+        // Takes the output parameter, which is only read when tracking is enabled
+        template <typename T>
+        void recordAllocationSite(const char *apiName, T *phHandle) {
+            if (allocationSites && phHandle)
+                allocationSites->recordCreate(apiName, *phHandle);
+        }
+        void releaseAllocationSite(const void *handle) {
+            if (allocationSites)
+                allocationSites->releaseHandle(handle);
+        }
+
+        // Non-null when ZEL_VALIDATION_FINDINGS_LOG is set
+        std::unique_ptr<findingsLog> findings;
+        // Sends a finding to the findings log if enabled, or to the logger.
+        // describe() builds the message and is not called for repeats.
+        template <typename Describe>
+        void reportFinding(const char *checker, const char *finding, findingSeverity severity,
+                           const void *object, const Describe &describe) {
+            if (findings) {
+                findings->report(checker, finding, severity, object, describe);
+            } else if (severity == findingSeverity::error) {
+                logger->log_error(describe());
+            } else if (severity == findingSeverity::warning) {
+                logger->log_warning(describe());
+            } else {
+                logger->log_info(describe());
+            }
+        }
+
         std::shared_ptr<loader::Logger> logger;
 
         static context_t& getInstance() {
             static context_t instance;
             return instance;
         }
+        void initSampleRate(validationChecker &checker, const char *sampleRateEnv);
+
+        // Single per-thread increment shared by all checkers of a call
+        uint64_t nextSampleTick() {
+            if (!enableSampling)
+                return 0;
+            thread_local uint64_t sampleTick = 0;
+            return ++sampleTick;
+        }
+
         context_t();
         ~context_t();
     };
@@ -14,8 +14,8 @@
 namespace validation_layer
 {
     static ze_result_t logAndPropagateResult(const char* fname, ze_result_t result) {
-        if (result != ZE_RESULT_SUCCESS) {
-            context.logger->log_trace("Error (" + loader::to_string(result) + ") in " + std::string(fname));
+        if (result != ZE_RESULT_SUCCESS && context.logger->should_log(spdlog::level::trace)) {
+            context.logger->log_trace("Error ({}) in {}", loader::to_string(result), fname);
         }
         return result;
     }
@@ -36,7 +36,10 @@ namespace validation_layer
             return logAndPropagateResult("zerGetLastErrorDescription", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zerGetLastErrorDescription", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zerValidation->zerGetLastErrorDescriptionPrologue( ppString );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zerGetLastErrorDescription", result);
         }
@@ -48,6 +51,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zerGetLastErrorDescription", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zerHandleLifetime.zerGetLastErrorDescriptionPrologue( ppString );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zerGetLastErrorDescription", result);
         }
@@ -55,6 +59,13 @@ namespace validation_layer
         auto driver_result = pfnGetLastErrorDescription( ppString );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zerGetLastErrorDescription", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zerValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zerGetLastErrorDescription", [=]() { handler->zerGetLastErrorDescriptionEpilogue( ppString ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zerValidation->zerGetLastErrorDescriptionEpilogue( ppString ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zerGetLastErrorDescription", result);
         }
@@ -77,7 +88,10 @@ namespace validation_layer
             return UINT32_MAX;
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zerTranslateDeviceHandleToIdentifier", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zerValidation->zerTranslateDeviceHandleToIdentifierPrologue( hDevice );
             if(result!=ZE_RESULT_SUCCESS) return UINT32_MAX;
         }
@@ -89,6 +103,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zerTranslateDeviceHandleToIdentifier", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zerHandleLifetime.zerTranslateDeviceHandleToIdentifierPrologue( hDevice );
             if(result!=ZE_RESULT_SUCCESS) return UINT32_MAX;
         }
@@ -96,6 +111,13 @@ namespace validation_layer
         auto driver_result = pfnTranslateDeviceHandleToIdentifier( hDevice );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zerTranslateDeviceHandleToIdentifier", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zerValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zerTranslateDeviceHandleToIdentifier", [=]() { handler->zerTranslateDeviceHandleToIdentifierEpilogue( hDevice ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zerValidation->zerTranslateDeviceHandleToIdentifierEpilogue( hDevice ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return UINT32_MAX;
         }
@@ -118,7 +140,10 @@ namespace validation_layer
             return nullptr;
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zerTranslateIdentifierToDeviceHandle", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zerValidation->zerTranslateIdentifierToDeviceHandlePrologue( identifier );
             if(result!=ZE_RESULT_SUCCESS) return nullptr;
         }
@@ -130,6 +155,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zerTranslateIdentifierToDeviceHandle", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zerHandleLifetime.zerTranslateIdentifierToDeviceHandlePrologue( identifier );
             if(result!=ZE_RESULT_SUCCESS) return nullptr;
         }
@@ -137,6 +163,13 @@ namespace validation_layer
         auto driver_result = pfnTranslateIdentifierToDeviceHandle( identifier );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zerTranslateIdentifierToDeviceHandle", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zerValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zerTranslateIdentifierToDeviceHandle", [=]() { handler->zerTranslateIdentifierToDeviceHandleEpilogue( identifier ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zerValidation->zerTranslateIdentifierToDeviceHandleEpilogue( identifier ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return nullptr;
         }
@@ -159,7 +192,10 @@ namespace validation_layer
             return nullptr;
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zerGetDefaultContext", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zerValidation->zerGetDefaultContextPrologue( );
             if(result!=ZE_RESULT_SUCCESS) return nullptr;
         }
@@ -171,6 +207,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zerGetDefaultContext", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zerHandleLifetime.zerGetDefaultContextPrologue( );
             if(result!=ZE_RESULT_SUCCESS) return nullptr;
         }
@@ -178,6 +215,13 @@ namespace validation_layer
         auto driver_result = pfnGetDefaultContext(  );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zerGetDefaultContext", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zerValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zerGetDefaultContext", [=]() { handler->zerGetDefaultContextEpilogue( driver_result ); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zerValidation->zerGetDefaultContextEpilogue( driver_result );
             if(result!=ZE_RESULT_SUCCESS) return nullptr;
         }
@@ -14,8 +14,8 @@
 namespace validation_layer
 {
     static ze_result_t logAndPropagateResult(const char* fname, ze_result_t result) {
-        if (result != ZE_RESULT_SUCCESS) {
-            context.logger->log_trace("Error (" + loader::to_string(result) + ") in " + std::string(fname));
+        if (result != ZE_RESULT_SUCCESS && context.logger->should_log(spdlog::level::trace)) {
+            context.logger->log_trace("Error ({}) in {}", loader::to_string(result), fname);
         }
         return result;
     }
@@ -36,7 +36,10 @@ namespace validation_layer
             return logAndPropagateResult("zesInit", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesInit", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesInitPrologue( flags );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesInit", result);
         }
@@ -48,13 +51,24 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesInit", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesInitPrologue( flags );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesInit", result);
         }
 
         auto driver_result = pfnInit( flags );
 
+        if( driver_result == ZE_RESULT_SUCCESS )
+            context.notifyDdiTablesReady();
+
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesInit", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesInit", [=]() { handler->zesInitEpilogue( flags ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesInitEpilogue( flags ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesInit", result);
         }
@@ -85,7 +99,10 @@ namespace validation_layer
             return logAndPropagateResult("zesDriverGet", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDriverGet", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesDriverGetPrologue( pCount, phDrivers );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDriverGet", result);
         }
@@ -97,6 +114,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesDriverGet", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesDriverGetPrologue( pCount, phDrivers );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDriverGet", result);
         }
@@ -104,6 +122,13 @@ namespace validation_layer
         auto driver_result = pfnGet( pCount, phDrivers );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDriverGet", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesDriverGet", [=]() { handler->zesDriverGetEpilogue( pCount, phDrivers ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesDriverGetEpilogue( pCount, phDrivers ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDriverGet", result);
         }
@@ -146,7 +171,10 @@ namespace validation_layer
             return logAndPropagateResult("zesDriverGetExtensionProperties", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDriverGetExtensionProperties", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesDriverGetExtensionPropertiesPrologue( hDriver, pCount, pExtensionProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDriverGetExtensionProperties", result);
         }
@@ -158,6 +186,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesDriverGetExtensionProperties", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesDriverGetExtensionPropertiesPrologue( hDriver, pCount, pExtensionProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDriverGetExtensionProperties", result);
         }
@@ -165,6 +194,13 @@ namespace validation_layer
         auto driver_result = pfnGetExtensionProperties( hDriver, pCount, pExtensionProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDriverGetExtensionProperties", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesDriverGetExtensionProperties", [=]() { handler->zesDriverGetExtensionPropertiesEpilogue( hDriver, pCount, pExtensionProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesDriverGetExtensionPropertiesEpilogue( hDriver, pCount, pExtensionProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDriverGetExtensionProperties", result);
         }
@@ -189,7 +225,10 @@ namespace validation_layer
             return logAndPropagateResult("zesDriverGetExtensionFunctionAddress", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDriverGetExtensionFunctionAddress", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesDriverGetExtensionFunctionAddressPrologue( hDriver, name, ppFunctionAddress );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDriverGetExtensionFunctionAddress", result);
         }
@@ -201,6 +240,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesDriverGetExtensionFunctionAddress", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesDriverGetExtensionFunctionAddressPrologue( hDriver, name, ppFunctionAddress );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDriverGetExtensionFunctionAddress", result);
         }
@@ -208,6 +248,13 @@ namespace validation_layer
         auto driver_result = pfnGetExtensionFunctionAddress( hDriver, name, ppFunctionAddress );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDriverGetExtensionFunctionAddress", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesDriverGetExtensionFunctionAddress", [=]() { handler->zesDriverGetExtensionFunctionAddressEpilogue( hDriver, name, ppFunctionAddress ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesDriverGetExtensionFunctionAddressEpilogue( hDriver, name, ppFunctionAddress ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDriverGetExtensionFunctionAddress", result);
         }
@@ -239,7 +286,10 @@ namespace validation_layer
             return logAndPropagateResult("zesDeviceGet", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceGet", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceGetPrologue( hDriver, pCount, phDevices );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceGet", result);
         }
@@ -251,6 +301,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesDeviceGet", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceGetPrologue( hDriver, pCount, phDevices );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceGet", result);
         }
@@ -258,6 +309,13 @@ namespace validation_layer
         auto driver_result = pfnGet( hDriver, pCount, phDevices );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceGet", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesDeviceGet", [=]() { handler->zesDeviceGetEpilogue( hDriver, pCount, phDevices ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceGetEpilogue( hDriver, pCount, phDevices ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceGet", result);
         }
@@ -291,7 +349,10 @@ namespace validation_layer
             return logAndPropagateResult("zesDeviceGetProperties", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceGetProperties", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceGetPropertiesPrologue( hDevice, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceGetProperties", result);
         }
@@ -303,6 +364,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesDeviceGetProperties", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceGetPropertiesPrologue( hDevice, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceGetProperties", result);
         }
@@ -310,6 +372,13 @@ namespace validation_layer
         auto driver_result = pfnGetProperties( hDevice, pProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceGetProperties", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesDeviceGetProperties", [=]() { handler->zesDeviceGetPropertiesEpilogue( hDevice, pProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceGetPropertiesEpilogue( hDevice, pProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceGetProperties", result);
         }
@@ -333,7 +402,10 @@ namespace validation_layer
             return logAndPropagateResult("zesDeviceGetState", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceGetState", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceGetStatePrologue( hDevice, pState );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceGetState", result);
         }
@@ -345,6 +417,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesDeviceGetState", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceGetStatePrologue( hDevice, pState );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceGetState", result);
         }
@@ -352,6 +425,13 @@ namespace validation_layer
         auto driver_result = pfnGetState( hDevice, pState );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceGetState", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesDeviceGetState", [=]() { handler->zesDeviceGetStateEpilogue( hDevice, pState ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceGetStateEpilogue( hDevice, pState ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceGetState", result);
         }
@@ -376,7 +456,10 @@ namespace validation_layer
             return logAndPropagateResult("zesDeviceReset", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceReset", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceResetPrologue( hDevice, force );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceReset", result);
         }
@@ -388,6 +471,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesDeviceReset", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceResetPrologue( hDevice, force );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceReset", result);
         }
@@ -395,6 +479,13 @@ namespace validation_layer
         auto driver_result = pfnReset( hDevice, force );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceReset", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesDeviceReset", [=]() { handler->zesDeviceResetEpilogue( hDevice, force ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceResetEpilogue( hDevice, force ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceReset", result);
         }
@@ -418,7 +509,10 @@ namespace validation_layer
             return logAndPropagateResult("zesDeviceResetExt", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceResetExt", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceResetExtPrologue( hDevice, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceResetExt", result);
         }
@@ -430,6 +524,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesDeviceResetExt", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceResetExtPrologue( hDevice, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceResetExt", result);
         }
@@ -437,6 +532,13 @@ namespace validation_layer
         auto driver_result = pfnResetExt( hDevice, pProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceResetExt", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesDeviceResetExt", [=]() { handler->zesDeviceResetExtEpilogue( hDevice, pProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceResetExtEpilogue( hDevice, pProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceResetExt", result);
         }
@@ -469,7 +571,10 @@ namespace validation_layer
             return logAndPropagateResult("zesDeviceProcessesGetState", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceProcessesGetState", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceProcessesGetStatePrologue( hDevice, pCount, pProcesses );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceProcessesGetState", result);
         }
@@ -481,6 +586,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesDeviceProcessesGetState", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceProcessesGetStatePrologue( hDevice, pCount, pProcesses );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceProcessesGetState", result);
         }
@@ -488,6 +594,13 @@ namespace validation_layer
         auto driver_result = pfnProcessesGetState( hDevice, pCount, pProcesses );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceProcessesGetState", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesDeviceProcessesGetState", [=]() { handler->zesDeviceProcessesGetStateEpilogue( hDevice, pCount, pProcesses ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceProcessesGetStateEpilogue( hDevice, pCount, pProcesses ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceProcessesGetState", result);
         }
@@ -511,7 +624,10 @@ namespace validation_layer
             return logAndPropagateResult("zesDevicePciGetProperties", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDevicePciGetProperties", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesDevicePciGetPropertiesPrologue( hDevice, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDevicePciGetProperties", result);
         }
@@ -523,6 +639,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesDevicePciGetProperties", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesDevicePciGetPropertiesPrologue( hDevice, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDevicePciGetProperties", result);
         }
@@ -530,6 +647,13 @@ namespace validation_layer
         auto driver_result = pfnPciGetProperties( hDevice, pProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDevicePciGetProperties", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesDevicePciGetProperties", [=]() { handler->zesDevicePciGetPropertiesEpilogue( hDevice, pProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesDevicePciGetPropertiesEpilogue( hDevice, pProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDevicePciGetProperties", result);
         }
@@ -553,7 +677,10 @@ namespace validation_layer
             return logAndPropagateResult("zesDevicePciGetState", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDevicePciGetState", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesDevicePciGetStatePrologue( hDevice, pState );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDevicePciGetState", result);
         }
@@ -565,6 +692,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesDevicePciGetState", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesDevicePciGetStatePrologue( hDevice, pState );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDevicePciGetState", result);
         }
@@ -572,6 +700,13 @@ namespace validation_layer
         auto driver_result = pfnPciGetState( hDevice, pState );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDevicePciGetState", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesDevicePciGetState", [=]() { handler->zesDevicePciGetStateEpilogue( hDevice, pState ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesDevicePciGetStateEpilogue( hDevice, pState ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDevicePciGetState", result);
         }
@@ -603,7 +738,10 @@ namespace validation_layer
             return logAndPropagateResult("zesDevicePciGetBars", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDevicePciGetBars", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesDevicePciGetBarsPrologue( hDevice, pCount, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDevicePciGetBars", result);
         }
@@ -615,6 +753,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesDevicePciGetBars", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesDevicePciGetBarsPrologue( hDevice, pCount, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDevicePciGetBars", result);
         }
@@ -622,6 +761,13 @@ namespace validation_layer
         auto driver_result = pfnPciGetBars( hDevice, pCount, pProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDevicePciGetBars", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesDevicePciGetBars", [=]() { handler->zesDevicePciGetBarsEpilogue( hDevice, pCount, pProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesDevicePciGetBarsEpilogue( hDevice, pCount, pProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDevicePciGetBars", result);
         }
@@ -645,7 +791,10 @@ namespace validation_layer
             return logAndPropagateResult("zesDevicePciGetStats", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDevicePciGetStats", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesDevicePciGetStatsPrologue( hDevice, pStats );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDevicePciGetStats", result);
         }
@@ -657,6 +806,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesDevicePciGetStats", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesDevicePciGetStatsPrologue( hDevice, pStats );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDevicePciGetStats", result);
         }
@@ -664,6 +814,13 @@ namespace validation_layer
         auto driver_result = pfnPciGetStats( hDevice, pStats );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDevicePciGetStats", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesDevicePciGetStats", [=]() { handler->zesDevicePciGetStatsEpilogue( hDevice, pStats ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesDevicePciGetStatsEpilogue( hDevice, pStats ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDevicePciGetStats", result);
         }
@@ -686,7 +843,10 @@ namespace validation_layer
             return logAndPropagateResult("zesDeviceSetOverclockWaiver", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceSetOverclockWaiver", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceSetOverclockWaiverPrologue( hDevice );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceSetOverclockWaiver", result);
         }
@@ -698,6 +858,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesDeviceSetOverclockWaiver", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceSetOverclockWaiverPrologue( hDevice );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceSetOverclockWaiver", result);
         }
@@ -705,6 +866,13 @@ namespace validation_layer
         auto driver_result = pfnSetOverclockWaiver( hDevice );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceSetOverclockWaiver", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesDeviceSetOverclockWaiver", [=]() { handler->zesDeviceSetOverclockWaiverEpilogue( hDevice ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceSetOverclockWaiverEpilogue( hDevice ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceSetOverclockWaiver", result);
         }
@@ -730,7 +898,10 @@ namespace validation_layer
             return logAndPropagateResult("zesDeviceGetOverclockDomains", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceGetOverclockDomains", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceGetOverclockDomainsPrologue( hDevice, pOverclockDomains );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceGetOverclockDomains", result);
         }
@@ -742,6 +913,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesDeviceGetOverclockDomains", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceGetOverclockDomainsPrologue( hDevice, pOverclockDomains );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceGetOverclockDomains", result);
         }
@@ -749,6 +921,13 @@ namespace validation_layer
         auto driver_result = pfnGetOverclockDomains( hDevice, pOverclockDomains );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceGetOverclockDomains", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesDeviceGetOverclockDomains", [=]() { handler->zesDeviceGetOverclockDomainsEpilogue( hDevice, pOverclockDomains ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceGetOverclockDomainsEpilogue( hDevice, pOverclockDomains ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceGetOverclockDomains", result);
         }
@@ -775,7 +954,10 @@ namespace validation_layer
             return logAndPropagateResult("zesDeviceGetOverclockControls", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceGetOverclockControls", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceGetOverclockControlsPrologue( hDevice, domainType, pAvailableControls );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceGetOverclockControls", result);
         }
@@ -787,6 +969,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesDeviceGetOverclockControls", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceGetOverclockControlsPrologue( hDevice, domainType, pAvailableControls );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceGetOverclockControls", result);
         }
@@ -794,6 +977,13 @@ namespace validation_layer
         auto driver_result = pfnGetOverclockControls( hDevice, domainType, pAvailableControls );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceGetOverclockControls", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesDeviceGetOverclockControls", [=]() { handler->zesDeviceGetOverclockControlsEpilogue( hDevice, domainType, pAvailableControls ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceGetOverclockControlsEpilogue( hDevice, domainType, pAvailableControls ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceGetOverclockControls", result);
         }
@@ -818,7 +1008,10 @@ namespace validation_layer
             return logAndPropagateResult("zesDeviceResetOverclockSettings", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceResetOverclockSettings", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceResetOverclockSettingsPrologue( hDevice, onShippedState );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceResetOverclockSettings", result);
         }
@@ -830,6 +1023,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesDeviceResetOverclockSettings", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceResetOverclockSettingsPrologue( hDevice, onShippedState );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceResetOverclockSettings", result);
         }
@@ -837,6 +1031,13 @@ namespace validation_layer
         auto driver_result = pfnResetOverclockSettings( hDevice, onShippedState );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceResetOverclockSettings", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesDeviceResetOverclockSettings", [=]() { handler->zesDeviceResetOverclockSettingsEpilogue( hDevice, onShippedState ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceResetOverclockSettingsEpilogue( hDevice, onShippedState ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceResetOverclockSettings", result);
         }
@@ -865,7 +1066,10 @@ namespace validation_layer
             return logAndPropagateResult("zesDeviceReadOverclockState", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceReadOverclockState", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceReadOverclockStatePrologue( hDevice, pOverclockMode, pWaiverSetting, pOverclockState, pPendingAction, pPendingReset );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceReadOverclockState", result);
         }
@@ -877,6 +1081,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesDeviceReadOverclockState", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceReadOverclockStatePrologue( hDevice, pOverclockMode, pWaiverSetting, pOverclockState, pPendingAction, pPendingReset );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceReadOverclockState", result);
         }
@@ -884,6 +1089,13 @@ namespace validation_layer
         auto driver_result = pfnReadOverclockState( hDevice, pOverclockMode, pWaiverSetting, pOverclockState, pPendingAction, pPendingReset );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceReadOverclockState", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesDeviceReadOverclockState", [=]() { handler->zesDeviceReadOverclockStateEpilogue( hDevice, pOverclockMode, pWaiverSetting, pOverclockState, pPendingAction, pPendingReset ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceReadOverclockStateEpilogue( hDevice, pOverclockMode, pWaiverSetting, pOverclockState, pPendingAction, pPendingReset ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceReadOverclockState", result);
         }
@@ -917,7 +1129,10 @@ namespace validation_layer
             return logAndPropagateResult("zesDeviceEnumOverclockDomains", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceEnumOverclockDomains", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumOverclockDomainsPrologue( hDevice, pCount, phDomainHandle );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEnumOverclockDomains", result);
         }
@@ -929,6 +1144,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesDeviceEnumOverclockDomains", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumOverclockDomainsPrologue( hDevice, pCount, phDomainHandle );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEnumOverclockDomains", result);
         }
@@ -936,6 +1152,13 @@ namespace validation_layer
         auto driver_result = pfnEnumOverclockDomains( hDevice, pCount, phDomainHandle );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceEnumOverclockDomains", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesDeviceEnumOverclockDomains", [=]() { handler->zesDeviceEnumOverclockDomainsEpilogue( hDevice, pCount, phDomainHandle ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumOverclockDomainsEpilogue( hDevice, pCount, phDomainHandle ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEnumOverclockDomains", result);
         }
@@ -959,7 +1182,10 @@ namespace validation_layer
             return logAndPropagateResult("zesOverclockGetDomainProperties", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesOverclockGetDomainProperties", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesOverclockGetDomainPropertiesPrologue( hDomainHandle, pDomainProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesOverclockGetDomainProperties", result);
         }
@@ -971,6 +1197,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesOverclockGetDomainProperties", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesOverclockGetDomainPropertiesPrologue( hDomainHandle, pDomainProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesOverclockGetDomainProperties", result);
         }
@@ -978,6 +1205,13 @@ namespace validation_layer
         auto driver_result = pfnGetDomainProperties( hDomainHandle, pDomainProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesOverclockGetDomainProperties", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesOverclockGetDomainProperties", [=]() { handler->zesOverclockGetDomainPropertiesEpilogue( hDomainHandle, pDomainProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesOverclockGetDomainPropertiesEpilogue( hDomainHandle, pDomainProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesOverclockGetDomainProperties", result);
         }
@@ -1001,7 +1235,10 @@ namespace validation_layer
             return logAndPropagateResult("zesOverclockGetDomainVFProperties", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesOverclockGetDomainVFProperties", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesOverclockGetDomainVFPropertiesPrologue( hDomainHandle, pVFProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesOverclockGetDomainVFProperties", result);
         }
@@ -1013,6 +1250,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesOverclockGetDomainVFProperties", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesOverclockGetDomainVFPropertiesPrologue( hDomainHandle, pVFProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesOverclockGetDomainVFProperties", result);
         }
@@ -1020,6 +1258,13 @@ namespace validation_layer
         auto driver_result = pfnGetDomainVFProperties( hDomainHandle, pVFProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesOverclockGetDomainVFProperties", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesOverclockGetDomainVFProperties", [=]() { handler->zesOverclockGetDomainVFPropertiesEpilogue( hDomainHandle, pVFProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesOverclockGetDomainVFPropertiesEpilogue( hDomainHandle, pVFProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesOverclockGetDomainVFProperties", result);
         }
@@ -1044,7 +1289,10 @@ namespace validation_layer
             return logAndPropagateResult("zesOverclockGetDomainControlProperties", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesOverclockGetDomainControlProperties", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesOverclockGetDomainControlPropertiesPrologue( hDomainHandle, DomainControl, pControlProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesOverclockGetDomainControlProperties", result);
         }
@@ -1056,6 +1304,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesOverclockGetDomainControlProperties", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesOverclockGetDomainControlPropertiesPrologue( hDomainHandle, DomainControl, pControlProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesOverclockGetDomainControlProperties", result);
         }
@@ -1063,6 +1312,13 @@ namespace validation_layer
         auto driver_result = pfnGetDomainControlProperties( hDomainHandle, DomainControl, pControlProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesOverclockGetDomainControlProperties", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesOverclockGetDomainControlProperties", [=]() { handler->zesOverclockGetDomainControlPropertiesEpilogue( hDomainHandle, DomainControl, pControlProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesOverclockGetDomainControlPropertiesEpilogue( hDomainHandle, DomainControl, pControlProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesOverclockGetDomainControlProperties", result);
         }
@@ -1087,7 +1343,10 @@ namespace validation_layer
             return logAndPropagateResult("zesOverclockGetControlCurrentValue", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesOverclockGetControlCurrentValue", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesOverclockGetControlCurrentValuePrologue( hDomainHandle, DomainControl, pValue );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesOverclockGetControlCurrentValue", result);
         }
@@ -1099,6 +1358,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesOverclockGetControlCurrentValue", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesOverclockGetControlCurrentValuePrologue( hDomainHandle, DomainControl, pValue );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesOverclockGetControlCurrentValue", result);
         }
@@ -1106,6 +1366,13 @@ namespace validation_layer
         auto driver_result = pfnGetControlCurrentValue( hDomainHandle, DomainControl, pValue );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesOverclockGetControlCurrentValue", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesOverclockGetControlCurrentValue", [=]() { handler->zesOverclockGetControlCurrentValueEpilogue( hDomainHandle, DomainControl, pValue ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesOverclockGetControlCurrentValueEpilogue( hDomainHandle, DomainControl, pValue ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesOverclockGetControlCurrentValue", result);
         }
@@ -1131,7 +1398,10 @@ namespace validation_layer
             return logAndPropagateResult("zesOverclockGetControlPendingValue", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesOverclockGetControlPendingValue", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesOverclockGetControlPendingValuePrologue( hDomainHandle, DomainControl, pValue );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesOverclockGetControlPendingValue", result);
         }
@@ -1143,6 +1413,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesOverclockGetControlPendingValue", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesOverclockGetControlPendingValuePrologue( hDomainHandle, DomainControl, pValue );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesOverclockGetControlPendingValue", result);
         }
@@ -1150,6 +1421,13 @@ namespace validation_layer
         auto driver_result = pfnGetControlPendingValue( hDomainHandle, DomainControl, pValue );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesOverclockGetControlPendingValue", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesOverclockGetControlPendingValue", [=]() { handler->zesOverclockGetControlPendingValueEpilogue( hDomainHandle, DomainControl, pValue ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesOverclockGetControlPendingValueEpilogue( hDomainHandle, DomainControl, pValue ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesOverclockGetControlPendingValue", result);
         }
@@ -1176,7 +1454,10 @@ namespace validation_layer
             return logAndPropagateResult("zesOverclockSetControlUserValue", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesOverclockSetControlUserValue", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesOverclockSetControlUserValuePrologue( hDomainHandle, DomainControl, pValue, pPendingAction );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesOverclockSetControlUserValue", result);
         }
@@ -1188,6 +1469,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesOverclockSetControlUserValue", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesOverclockSetControlUserValuePrologue( hDomainHandle, DomainControl, pValue, pPendingAction );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesOverclockSetControlUserValue", result);
         }
@@ -1195,6 +1477,13 @@ namespace validation_layer
         auto driver_result = pfnSetControlUserValue( hDomainHandle, DomainControl, pValue, pPendingAction );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesOverclockSetControlUserValue", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesOverclockSetControlUserValue", [=]() { handler->zesOverclockSetControlUserValueEpilogue( hDomainHandle, DomainControl, pValue, pPendingAction ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesOverclockSetControlUserValueEpilogue( hDomainHandle, DomainControl, pValue, pPendingAction ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesOverclockSetControlUserValue", result);
         }
@@ -1220,7 +1509,10 @@ namespace validation_layer
             return logAndPropagateResult("zesOverclockGetControlState", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesOverclockGetControlState", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesOverclockGetControlStatePrologue( hDomainHandle, DomainControl, pControlState, pPendingAction );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesOverclockGetControlState", result);
         }
@@ -1232,6 +1524,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesOverclockGetControlState", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesOverclockGetControlStatePrologue( hDomainHandle, DomainControl, pControlState, pPendingAction );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesOverclockGetControlState", result);
         }
@@ -1239,6 +1532,13 @@ namespace validation_layer
         auto driver_result = pfnGetControlState( hDomainHandle, DomainControl, pControlState, pPendingAction );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesOverclockGetControlState", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesOverclockGetControlState", [=]() { handler->zesOverclockGetControlStateEpilogue( hDomainHandle, DomainControl, pControlState, pPendingAction ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesOverclockGetControlStateEpilogue( hDomainHandle, DomainControl, pControlState, pPendingAction ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesOverclockGetControlState", result);
         }
@@ -1266,7 +1566,10 @@ namespace validation_layer
             return logAndPropagateResult("zesOverclockGetVFPointValues", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesOverclockGetVFPointValues", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesOverclockGetVFPointValuesPrologue( hDomainHandle, VFType, VFArrayType, PointIndex, PointValue );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesOverclockGetVFPointValues", result);
         }
@@ -1278,6 +1581,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesOverclockGetVFPointValues", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesOverclockGetVFPointValuesPrologue( hDomainHandle, VFType, VFArrayType, PointIndex, PointValue );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesOverclockGetVFPointValues", result);
         }
@@ -1285,6 +1589,13 @@ namespace validation_layer
         auto driver_result = pfnGetVFPointValues( hDomainHandle, VFType, VFArrayType, PointIndex, PointValue );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesOverclockGetVFPointValues", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesOverclockGetVFPointValues", [=]() { handler->zesOverclockGetVFPointValuesEpilogue( hDomainHandle, VFType, VFArrayType, PointIndex, PointValue ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesOverclockGetVFPointValuesEpilogue( hDomainHandle, VFType, VFArrayType, PointIndex, PointValue ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesOverclockGetVFPointValues", result);
         }
@@ -1311,7 +1622,10 @@ namespace validation_layer
             return logAndPropagateResult("zesOverclockSetVFPointValues", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesOverclockSetVFPointValues", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesOverclockSetVFPointValuesPrologue( hDomainHandle, VFType, PointIndex, PointValue );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesOverclockSetVFPointValues", result);
         }
@@ -1323,6 +1637,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesOverclockSetVFPointValues", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesOverclockSetVFPointValuesPrologue( hDomainHandle, VFType, PointIndex, PointValue );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesOverclockSetVFPointValues", result);
         }
@@ -1330,6 +1645,13 @@ namespace validation_layer
         auto driver_result = pfnSetVFPointValues( hDomainHandle, VFType, PointIndex, PointValue );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesOverclockSetVFPointValues", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesOverclockSetVFPointValues", [=]() { handler->zesOverclockSetVFPointValuesEpilogue( hDomainHandle, VFType, PointIndex, PointValue ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesOverclockSetVFPointValuesEpilogue( hDomainHandle, VFType, PointIndex, PointValue ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesOverclockSetVFPointValues", result);
         }
@@ -1363,7 +1685,10 @@ namespace validation_layer
             return logAndPropagateResult("zesDeviceEnumDiagnosticTestSuites", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceEnumDiagnosticTestSuites", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumDiagnosticTestSuitesPrologue( hDevice, pCount, phDiagnostics );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEnumDiagnosticTestSuites", result);
         }
@@ -1375,6 +1700,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesDeviceEnumDiagnosticTestSuites", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumDiagnosticTestSuitesPrologue( hDevice, pCount, phDiagnostics );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEnumDiagnosticTestSuites", result);
         }
@@ -1382,6 +1708,13 @@ namespace validation_layer
         auto driver_result = pfnEnumDiagnosticTestSuites( hDevice, pCount, phDiagnostics );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceEnumDiagnosticTestSuites", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesDeviceEnumDiagnosticTestSuites", [=]() { handler->zesDeviceEnumDiagnosticTestSuitesEpilogue( hDevice, pCount, phDiagnostics ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumDiagnosticTestSuitesEpilogue( hDevice, pCount, phDiagnostics ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEnumDiagnosticTestSuites", result);
         }
@@ -1406,7 +1739,10 @@ namespace validation_layer
             return logAndPropagateResult("zesDiagnosticsGetProperties", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDiagnosticsGetProperties", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesDiagnosticsGetPropertiesPrologue( hDiagnostics, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDiagnosticsGetProperties", result);
         }
@@ -1418,6 +1754,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesDiagnosticsGetProperties", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesDiagnosticsGetPropertiesPrologue( hDiagnostics, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDiagnosticsGetProperties", result);
         }
@@ -1425,6 +1762,13 @@ namespace validation_layer
         auto driver_result = pfnGetProperties( hDiagnostics, pProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDiagnosticsGetProperties", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesDiagnosticsGetProperties", [=]() { handler->zesDiagnosticsGetPropertiesEpilogue( hDiagnostics, pProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesDiagnosticsGetPropertiesEpilogue( hDiagnostics, pProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDiagnosticsGetProperties", result);
         }
@@ -1456,7 +1800,10 @@ namespace validation_layer
             return logAndPropagateResult("zesDiagnosticsGetTests", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDiagnosticsGetTests", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesDiagnosticsGetTestsPrologue( hDiagnostics, pCount, pTests );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDiagnosticsGetTests", result);
         }
@@ -1468,6 +1815,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesDiagnosticsGetTests", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesDiagnosticsGetTestsPrologue( hDiagnostics, pCount, pTests );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDiagnosticsGetTests", result);
         }
@@ -1475,6 +1823,13 @@ namespace validation_layer
         auto driver_result = pfnGetTests( hDiagnostics, pCount, pTests );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDiagnosticsGetTests", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesDiagnosticsGetTests", [=]() { handler->zesDiagnosticsGetTestsEpilogue( hDiagnostics, pCount, pTests ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesDiagnosticsGetTestsEpilogue( hDiagnostics, pCount, pTests ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDiagnosticsGetTests", result);
         }
@@ -1502,7 +1857,10 @@ namespace validation_layer
             return logAndPropagateResult("zesDiagnosticsRunTests", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDiagnosticsRunTests", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesDiagnosticsRunTestsPrologue( hDiagnostics, startIndex, endIndex, pResult );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDiagnosticsRunTests", result);
         }
@@ -1514,6 +1872,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesDiagnosticsRunTests", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesDiagnosticsRunTestsPrologue( hDiagnostics, startIndex, endIndex, pResult );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDiagnosticsRunTests", result);
         }
@@ -1521,6 +1880,13 @@ namespace validation_layer
         auto driver_result = pfnRunTests( hDiagnostics, startIndex, endIndex, pResult );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDiagnosticsRunTests", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesDiagnosticsRunTests", [=]() { handler->zesDiagnosticsRunTestsEpilogue( hDiagnostics, startIndex, endIndex, pResult ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesDiagnosticsRunTestsEpilogue( hDiagnostics, startIndex, endIndex, pResult ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDiagnosticsRunTests", result);
         }
@@ -1544,7 +1910,10 @@ namespace validation_layer
             return logAndPropagateResult("zesDeviceEccAvailable", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceEccAvailable", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceEccAvailablePrologue( hDevice, pAvailable );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEccAvailable", result);
         }
@@ -1556,6 +1925,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesDeviceEccAvailable", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEccAvailablePrologue( hDevice, pAvailable );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEccAvailable", result);
         }
@@ -1563,6 +1933,13 @@ namespace validation_layer
         auto driver_result = pfnEccAvailable( hDevice, pAvailable );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceEccAvailable", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesDeviceEccAvailable", [=]() { handler->zesDeviceEccAvailableEpilogue( hDevice, pAvailable ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceEccAvailableEpilogue( hDevice, pAvailable ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEccAvailable", result);
         }
@@ -1586,7 +1963,10 @@ namespace validation_layer
             return logAndPropagateResult("zesDeviceEccConfigurable", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceEccConfigurable", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceEccConfigurablePrologue( hDevice, pConfigurable );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEccConfigurable", result);
         }
@@ -1598,6 +1978,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesDeviceEccConfigurable", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEccConfigurablePrologue( hDevice, pConfigurable );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEccConfigurable", result);
         }
@@ -1605,6 +1986,13 @@ namespace validation_layer
         auto driver_result = pfnEccConfigurable( hDevice, pConfigurable );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceEccConfigurable", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesDeviceEccConfigurable", [=]() { handler->zesDeviceEccConfigurableEpilogue( hDevice, pConfigurable ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceEccConfigurableEpilogue( hDevice, pConfigurable ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEccConfigurable", result);
         }
@@ -1628,7 +2016,10 @@ namespace validation_layer
             return logAndPropagateResult("zesDeviceGetEccState", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceGetEccState", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceGetEccStatePrologue( hDevice, pState );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceGetEccState", result);
         }
@@ -1640,6 +2031,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesDeviceGetEccState", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceGetEccStatePrologue( hDevice, pState );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceGetEccState", result);
         }
@@ -1647,6 +2039,13 @@ namespace validation_layer
         auto driver_result = pfnGetEccState( hDevice, pState );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceGetEccState", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesDeviceGetEccState", [=]() { handler->zesDeviceGetEccStateEpilogue( hDevice, pState ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceGetEccStateEpilogue( hDevice, pState ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceGetEccState", result);
         }
@@ -1671,7 +2070,10 @@ namespace validation_layer
             return logAndPropagateResult("zesDeviceSetEccState", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceSetEccState", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceSetEccStatePrologue( hDevice, newState, pState );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceSetEccState", result);
         }
@@ -1683,6 +2085,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesDeviceSetEccState", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceSetEccStatePrologue( hDevice, newState, pState );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceSetEccState", result);
         }
@@ -1690,6 +2093,13 @@ namespace validation_layer
         auto driver_result = pfnSetEccState( hDevice, newState, pState );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceSetEccState", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesDeviceSetEccState", [=]() { handler->zesDeviceSetEccStateEpilogue( hDevice, newState, pState ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceSetEccStateEpilogue( hDevice, newState, pState ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceSetEccState", result);
         }
@@ -1723,7 +2133,10 @@ namespace validation_layer
             return logAndPropagateResult("zesDeviceEnumEngineGroups", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceEnumEngineGroups", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumEngineGroupsPrologue( hDevice, pCount, phEngine );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEnumEngineGroups", result);
         }
@@ -1735,6 +2148,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesDeviceEnumEngineGroups", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumEngineGroupsPrologue( hDevice, pCount, phEngine );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEnumEngineGroups", result);
         }
@@ -1742,6 +2156,13 @@ namespace validation_layer
         auto driver_result = pfnEnumEngineGroups( hDevice, pCount, phEngine );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceEnumEngineGroups", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesDeviceEnumEngineGroups", [=]() { handler->zesDeviceEnumEngineGroupsEpilogue( hDevice, pCount, phEngine ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumEngineGroupsEpilogue( hDevice, pCount, phEngine ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEnumEngineGroups", result);
         }
@@ -1765,7 +2186,10 @@ namespace validation_layer
             return logAndPropagateResult("zesEngineGetProperties", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesEngineGetProperties", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesEngineGetPropertiesPrologue( hEngine, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesEngineGetProperties", result);
         }
@@ -1777,6 +2201,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesEngineGetProperties", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesEngineGetPropertiesPrologue( hEngine, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesEngineGetProperties", result);
         }
@@ -1784,6 +2209,13 @@ namespace validation_layer
         auto driver_result = pfnGetProperties( hEngine, pProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesEngineGetProperties", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesEngineGetProperties", [=]() { handler->zesEngineGetPropertiesEpilogue( hEngine, pProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesEngineGetPropertiesEpilogue( hEngine, pProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesEngineGetProperties", result);
         }
@@ -1808,7 +2240,10 @@ namespace validation_layer
             return logAndPropagateResult("zesEngineGetActivity", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesEngineGetActivity", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesEngineGetActivityPrologue( hEngine, pStats );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesEngineGetActivity", result);
         }
@@ -1820,6 +2255,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesEngineGetActivity", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesEngineGetActivityPrologue( hEngine, pStats );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesEngineGetActivity", result);
         }
@@ -1827,6 +2263,13 @@ namespace validation_layer
         auto driver_result = pfnGetActivity( hEngine, pStats );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesEngineGetActivity", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesEngineGetActivity", [=]() { handler->zesEngineGetActivityEpilogue( hEngine, pStats ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesEngineGetActivityEpilogue( hEngine, pStats ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesEngineGetActivity", result);
         }
@@ -1850,7 +2293,10 @@ namespace validation_layer
             return logAndPropagateResult("zesDeviceEventRegister", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceEventRegister", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceEventRegisterPrologue( hDevice, events );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEventRegister", result);
         }
@@ -1862,6 +2308,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesDeviceEventRegister", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEventRegisterPrologue( hDevice, events );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEventRegister", result);
         }
@@ -1869,6 +2316,13 @@ namespace validation_layer
         auto driver_result = pfnEventRegister( hDevice, events );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceEventRegister", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesDeviceEventRegister", [=]() { handler->zesDeviceEventRegisterEpilogue( hDevice, events ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceEventRegisterEpilogue( hDevice, events ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEventRegister", result);
         }
@@ -1908,7 +2362,10 @@ namespace validation_layer
             return logAndPropagateResult("zesDriverEventListen", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDriverEventListen", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesDriverEventListenPrologue( hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDriverEventListen", result);
         }
@@ -1920,6 +2377,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesDriverEventListen", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesDriverEventListenPrologue( hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDriverEventListen", result);
         }
@@ -1927,6 +2385,13 @@ namespace validation_layer
         auto driver_result = pfnEventListen( hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDriverEventListen", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesDriverEventListen", [=]() { handler->zesDriverEventListenEpilogue( hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesDriverEventListenEpilogue( hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDriverEventListen", result);
         }
@@ -1966,7 +2431,10 @@ namespace validation_layer
             return logAndPropagateResult("zesDriverEventListenEx", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDriverEventListenEx", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesDriverEventListenExPrologue( hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDriverEventListenEx", result);
         }
@@ -1978,6 +2446,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesDriverEventListenEx", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesDriverEventListenExPrologue( hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDriverEventListenEx", result);
         }
@@ -1985,6 +2454,13 @@ namespace validation_layer
         auto driver_result = pfnEventListenEx( hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDriverEventListenEx", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesDriverEventListenEx", [=]() { handler->zesDriverEventListenExEpilogue( hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesDriverEventListenExEpilogue( hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDriverEventListenEx", result);
         }
@@ -2018,7 +2494,10 @@ namespace validation_layer
             return logAndPropagateResult("zesDeviceEnumFabricPorts", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceEnumFabricPorts", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumFabricPortsPrologue( hDevice, pCount, phPort );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEnumFabricPorts", result);
         }
@@ -2030,6 +2509,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesDeviceEnumFabricPorts", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumFabricPortsPrologue( hDevice, pCount, phPort );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEnumFabricPorts", result);
         }
@@ -2037,6 +2517,13 @@ namespace validation_layer
         auto driver_result = pfnEnumFabricPorts( hDevice, pCount, phPort );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceEnumFabricPorts", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesDeviceEnumFabricPorts", [=]() { handler->zesDeviceEnumFabricPortsEpilogue( hDevice, pCount, phPort ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumFabricPortsEpilogue( hDevice, pCount, phPort ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEnumFabricPorts", result);
         }
@@ -2060,7 +2547,10 @@ namespace validation_layer
             return logAndPropagateResult("zesFabricPortGetProperties", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFabricPortGetProperties", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesFabricPortGetPropertiesPrologue( hPort, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFabricPortGetProperties", result);
         }
@@ -2072,6 +2562,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesFabricPortGetProperties", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesFabricPortGetPropertiesPrologue( hPort, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFabricPortGetProperties", result);
         }
@@ -2079,6 +2570,13 @@ namespace validation_layer
         auto driver_result = pfnGetProperties( hPort, pProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFabricPortGetProperties", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesFabricPortGetProperties", [=]() { handler->zesFabricPortGetPropertiesEpilogue( hPort, pProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesFabricPortGetPropertiesEpilogue( hPort, pProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFabricPortGetProperties", result);
         }
@@ -2103,7 +2601,10 @@ namespace validation_layer
             return logAndPropagateResult("zesFabricPortGetLinkType", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFabricPortGetLinkType", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesFabricPortGetLinkTypePrologue( hPort, pLinkType );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFabricPortGetLinkType", result);
         }
@@ -2115,6 +2616,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesFabricPortGetLinkType", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesFabricPortGetLinkTypePrologue( hPort, pLinkType );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFabricPortGetLinkType", result);
         }
@@ -2122,6 +2624,13 @@ namespace validation_layer
         auto driver_result = pfnGetLinkType( hPort, pLinkType );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFabricPortGetLinkType", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesFabricPortGetLinkType", [=]() { handler->zesFabricPortGetLinkTypeEpilogue( hPort, pLinkType ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesFabricPortGetLinkTypeEpilogue( hPort, pLinkType ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFabricPortGetLinkType", result);
         }
@@ -2145,7 +2654,10 @@ namespace validation_layer
             return logAndPropagateResult("zesFabricPortGetConfig", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFabricPortGetConfig", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesFabricPortGetConfigPrologue( hPort, pConfig );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFabricPortGetConfig", result);
         }
@@ -2157,6 +2669,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesFabricPortGetConfig", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesFabricPortGetConfigPrologue( hPort, pConfig );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFabricPortGetConfig", result);
         }
@@ -2164,6 +2677,13 @@ namespace validation_layer
         auto driver_result = pfnGetConfig( hPort, pConfig );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFabricPortGetConfig", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesFabricPortGetConfig", [=]() { handler->zesFabricPortGetConfigEpilogue( hPort, pConfig ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesFabricPortGetConfigEpilogue( hPort, pConfig ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFabricPortGetConfig", result);
         }
@@ -2187,7 +2707,10 @@ namespace validation_layer
             return logAndPropagateResult("zesFabricPortSetConfig", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFabricPortSetConfig", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesFabricPortSetConfigPrologue( hPort, pConfig );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFabricPortSetConfig", result);
         }
@@ -2199,6 +2722,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesFabricPortSetConfig", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesFabricPortSetConfigPrologue( hPort, pConfig );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFabricPortSetConfig", result);
         }
@@ -2206,6 +2730,13 @@ namespace validation_layer
         auto driver_result = pfnSetConfig( hPort, pConfig );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFabricPortSetConfig", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesFabricPortSetConfig", [=]() { handler->zesFabricPortSetConfigEpilogue( hPort, pConfig ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesFabricPortSetConfigEpilogue( hPort, pConfig ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFabricPortSetConfig", result);
         }
@@ -2229,7 +2760,10 @@ namespace validation_layer
             return logAndPropagateResult("zesFabricPortGetState", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFabricPortGetState", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesFabricPortGetStatePrologue( hPort, pState );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFabricPortGetState", result);
         }
@@ -2241,6 +2775,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesFabricPortGetState", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesFabricPortGetStatePrologue( hPort, pState );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFabricPortGetState", result);
         }
@@ -2248,6 +2783,13 @@ namespace validation_layer
         auto driver_result = pfnGetState( hPort, pState );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFabricPortGetState", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesFabricPortGetState", [=]() { handler->zesFabricPortGetStateEpilogue( hPort, pState ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesFabricPortGetStateEpilogue( hPort, pState ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFabricPortGetState", result);
         }
@@ -2271,7 +2813,10 @@ namespace validation_layer
             return logAndPropagateResult("zesFabricPortGetThroughput", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFabricPortGetThroughput", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesFabricPortGetThroughputPrologue( hPort, pThroughput );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFabricPortGetThroughput", result);
         }
@@ -2283,6 +2828,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesFabricPortGetThroughput", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesFabricPortGetThroughputPrologue( hPort, pThroughput );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFabricPortGetThroughput", result);
         }
@@ -2290,6 +2836,13 @@ namespace validation_layer
         auto driver_result = pfnGetThroughput( hPort, pThroughput );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFabricPortGetThroughput", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesFabricPortGetThroughput", [=]() { handler->zesFabricPortGetThroughputEpilogue( hPort, pThroughput ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesFabricPortGetThroughputEpilogue( hPort, pThroughput ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFabricPortGetThroughput", result);
         }
@@ -2313,7 +2866,10 @@ namespace validation_layer
             return logAndPropagateResult("zesFabricPortGetFabricErrorCounters", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFabricPortGetFabricErrorCounters", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesFabricPortGetFabricErrorCountersPrologue( hPort, pErrors );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFabricPortGetFabricErrorCounters", result);
         }
@@ -2325,6 +2881,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesFabricPortGetFabricErrorCounters", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesFabricPortGetFabricErrorCountersPrologue( hPort, pErrors );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFabricPortGetFabricErrorCounters", result);
         }
@@ -2332,6 +2889,13 @@ namespace validation_layer
         auto driver_result = pfnGetFabricErrorCounters( hPort, pErrors );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFabricPortGetFabricErrorCounters", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesFabricPortGetFabricErrorCounters", [=]() { handler->zesFabricPortGetFabricErrorCountersEpilogue( hPort, pErrors ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesFabricPortGetFabricErrorCountersEpilogue( hPort, pErrors ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFabricPortGetFabricErrorCounters", result);
         }
@@ -2359,7 +2923,10 @@ namespace validation_layer
             return logAndPropagateResult("zesFabricPortGetMultiPortThroughput", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFabricPortGetMultiPortThroughput", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesFabricPortGetMultiPortThroughputPrologue( hDevice, numPorts, phPort, pThroughput );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFabricPortGetMultiPortThroughput", result);
         }
@@ -2371,6 +2938,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesFabricPortGetMultiPortThroughput", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesFabricPortGetMultiPortThroughputPrologue( hDevice, numPorts, phPort, pThroughput );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFabricPortGetMultiPortThroughput", result);
         }
@@ -2378,6 +2946,13 @@ namespace validation_layer
         auto driver_result = pfnGetMultiPortThroughput( hDevice, numPorts, phPort, pThroughput );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFabricPortGetMultiPortThroughput", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesFabricPortGetMultiPortThroughput", [=]() { handler->zesFabricPortGetMultiPortThroughputEpilogue( hDevice, numPorts, phPort, pThroughput ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesFabricPortGetMultiPortThroughputEpilogue( hDevice, numPorts, phPort, pThroughput ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFabricPortGetMultiPortThroughput", result);
         }
@@ -2411,7 +2986,10 @@ namespace validation_layer
             return logAndPropagateResult("zesDeviceEnumFans", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceEnumFans", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumFansPrologue( hDevice, pCount, phFan );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEnumFans", result);
         }
@@ -2423,6 +3001,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesDeviceEnumFans", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumFansPrologue( hDevice, pCount, phFan );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEnumFans", result);
         }
@@ -2430,6 +3009,13 @@ namespace validation_layer
         auto driver_result = pfnEnumFans( hDevice, pCount, phFan );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceEnumFans", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesDeviceEnumFans", [=]() { handler->zesDeviceEnumFansEpilogue( hDevice, pCount, phFan ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumFansEpilogue( hDevice, pCount, phFan ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEnumFans", result);
         }
@@ -2453,7 +3039,10 @@ namespace validation_layer
             return logAndPropagateResult("zesFanGetProperties", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFanGetProperties", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesFanGetPropertiesPrologue( hFan, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFanGetProperties", result);
         }
@@ -2465,6 +3054,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesFanGetProperties", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesFanGetPropertiesPrologue( hFan, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFanGetProperties", result);
         }
@@ -2472,6 +3062,13 @@ namespace validation_layer
         auto driver_result = pfnGetProperties( hFan, pProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFanGetProperties", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesFanGetProperties", [=]() { handler->zesFanGetPropertiesEpilogue( hFan, pProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesFanGetPropertiesEpilogue( hFan, pProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFanGetProperties", result);
         }
@@ -2495,7 +3092,10 @@ namespace validation_layer
             return logAndPropagateResult("zesFanGetConfig", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFanGetConfig", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesFanGetConfigPrologue( hFan, pConfig );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFanGetConfig", result);
         }
@@ -2507,6 +3107,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesFanGetConfig", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesFanGetConfigPrologue( hFan, pConfig );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFanGetConfig", result);
         }
@@ -2514,6 +3115,13 @@ namespace validation_layer
         auto driver_result = pfnGetConfig( hFan, pConfig );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFanGetConfig", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesFanGetConfig", [=]() { handler->zesFanGetConfigEpilogue( hFan, pConfig ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesFanGetConfigEpilogue( hFan, pConfig ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFanGetConfig", result);
         }
@@ -2536,7 +3144,10 @@ namespace validation_layer
             return logAndPropagateResult("zesFanSetDefaultMode", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFanSetDefaultMode", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesFanSetDefaultModePrologue( hFan );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFanSetDefaultMode", result);
         }
@@ -2548,6 +3159,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesFanSetDefaultMode", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesFanSetDefaultModePrologue( hFan );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFanSetDefaultMode", result);
         }
@@ -2555,6 +3167,13 @@ namespace validation_layer
         auto driver_result = pfnSetDefaultMode( hFan );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFanSetDefaultMode", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesFanSetDefaultMode", [=]() { handler->zesFanSetDefaultModeEpilogue( hFan ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesFanSetDefaultModeEpilogue( hFan ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFanSetDefaultMode", result);
         }
@@ -2578,7 +3197,10 @@ namespace validation_layer
             return logAndPropagateResult("zesFanSetFixedSpeedMode", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFanSetFixedSpeedMode", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesFanSetFixedSpeedModePrologue( hFan, speed );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFanSetFixedSpeedMode", result);
         }
@@ -2590,6 +3212,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesFanSetFixedSpeedMode", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesFanSetFixedSpeedModePrologue( hFan, speed );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFanSetFixedSpeedMode", result);
         }
@@ -2597,6 +3220,13 @@ namespace validation_layer
         auto driver_result = pfnSetFixedSpeedMode( hFan, speed );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFanSetFixedSpeedMode", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesFanSetFixedSpeedMode", [=]() { handler->zesFanSetFixedSpeedModeEpilogue( hFan, speed ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesFanSetFixedSpeedModeEpilogue( hFan, speed ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFanSetFixedSpeedMode", result);
         }
@@ -2620,7 +3250,10 @@ namespace validation_layer
             return logAndPropagateResult("zesFanSetSpeedTableMode", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFanSetSpeedTableMode", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesFanSetSpeedTableModePrologue( hFan, speedTable );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFanSetSpeedTableMode", result);
         }
@@ -2632,6 +3265,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesFanSetSpeedTableMode", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesFanSetSpeedTableModePrologue( hFan, speedTable );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFanSetSpeedTableMode", result);
         }
@@ -2639,6 +3273,13 @@ namespace validation_layer
         auto driver_result = pfnSetSpeedTableMode( hFan, speedTable );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFanSetSpeedTableMode", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesFanSetSpeedTableMode", [=]() { handler->zesFanSetSpeedTableModeEpilogue( hFan, speedTable ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesFanSetSpeedTableModeEpilogue( hFan, speedTable ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFanSetSpeedTableMode", result);
         }
@@ -2665,7 +3306,10 @@ namespace validation_layer
             return logAndPropagateResult("zesFanGetState", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFanGetState", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesFanGetStatePrologue( hFan, units, pSpeed );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFanGetState", result);
         }
@@ -2677,6 +3321,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesFanGetState", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesFanGetStatePrologue( hFan, units, pSpeed );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFanGetState", result);
         }
@@ -2684,6 +3329,13 @@ namespace validation_layer
         auto driver_result = pfnGetState( hFan, units, pSpeed );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFanGetState", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesFanGetState", [=]() { handler->zesFanGetStateEpilogue( hFan, units, pSpeed ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesFanGetStateEpilogue( hFan, units, pSpeed ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFanGetState", result);
         }
@@ -2717,7 +3369,10 @@ namespace validation_layer
             return logAndPropagateResult("zesDeviceEnumFirmwares", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceEnumFirmwares", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumFirmwaresPrologue( hDevice, pCount, phFirmware );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEnumFirmwares", result);
         }
@@ -2729,6 +3384,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesDeviceEnumFirmwares", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumFirmwaresPrologue( hDevice, pCount, phFirmware );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEnumFirmwares", result);
         }
@@ -2736,6 +3392,13 @@ namespace validation_layer
         auto driver_result = pfnEnumFirmwares( hDevice, pCount, phFirmware );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceEnumFirmwares", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesDeviceEnumFirmwares", [=]() { handler->zesDeviceEnumFirmwaresEpilogue( hDevice, pCount, phFirmware ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumFirmwaresEpilogue( hDevice, pCount, phFirmware ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEnumFirmwares", result);
         }
@@ -2760,7 +3423,10 @@ namespace validation_layer
             return logAndPropagateResult("zesFirmwareGetProperties", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFirmwareGetProperties", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesFirmwareGetPropertiesPrologue( hFirmware, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFirmwareGetProperties", result);
         }
@@ -2772,6 +3438,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesFirmwareGetProperties", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesFirmwareGetPropertiesPrologue( hFirmware, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFirmwareGetProperties", result);
         }
@@ -2779,6 +3446,13 @@ namespace validation_layer
         auto driver_result = pfnGetProperties( hFirmware, pProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFirmwareGetProperties", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesFirmwareGetProperties", [=]() { handler->zesFirmwareGetPropertiesEpilogue( hFirmware, pProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesFirmwareGetPropertiesEpilogue( hFirmware, pProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFirmwareGetProperties", result);
         }
@@ -2803,7 +3477,10 @@ namespace validation_layer
             return logAndPropagateResult("zesFirmwareFlash", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFirmwareFlash", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesFirmwareFlashPrologue( hFirmware, pImage, size );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFirmwareFlash", result);
         }
@@ -2815,6 +3492,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesFirmwareFlash", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesFirmwareFlashPrologue( hFirmware, pImage, size );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFirmwareFlash", result);
         }
@@ -2822,6 +3500,13 @@ namespace validation_layer
         auto driver_result = pfnFlash( hFirmware, pImage, size );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFirmwareFlash", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesFirmwareFlash", [=]() { handler->zesFirmwareFlashEpilogue( hFirmware, pImage, size ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesFirmwareFlashEpilogue( hFirmware, pImage, size ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFirmwareFlash", result);
         }
@@ -2845,7 +3530,10 @@ namespace validation_layer
             return logAndPropagateResult("zesFirmwareGetFlashProgress", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFirmwareGetFlashProgress", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesFirmwareGetFlashProgressPrologue( hFirmware, pCompletionPercent );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFirmwareGetFlashProgress", result);
         }
@@ -2857,6 +3545,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesFirmwareGetFlashProgress", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesFirmwareGetFlashProgressPrologue( hFirmware, pCompletionPercent );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFirmwareGetFlashProgress", result);
         }
@@ -2864,6 +3553,13 @@ namespace validation_layer
         auto driver_result = pfnGetFlashProgress( hFirmware, pCompletionPercent );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFirmwareGetFlashProgress", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesFirmwareGetFlashProgress", [=]() { handler->zesFirmwareGetFlashProgressEpilogue( hFirmware, pCompletionPercent ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesFirmwareGetFlashProgressEpilogue( hFirmware, pCompletionPercent ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFirmwareGetFlashProgress", result);
         }
@@ -2888,7 +3584,10 @@ namespace validation_layer
             return logAndPropagateResult("zesFirmwareGetConsoleLogs", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFirmwareGetConsoleLogs", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesFirmwareGetConsoleLogsPrologue( hFirmware, pSize, pFirmwareLog );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFirmwareGetConsoleLogs", result);
         }
@@ -2900,6 +3599,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesFirmwareGetConsoleLogs", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesFirmwareGetConsoleLogsPrologue( hFirmware, pSize, pFirmwareLog );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFirmwareGetConsoleLogs", result);
         }
@@ -2907,6 +3607,13 @@ namespace validation_layer
         auto driver_result = pfnGetConsoleLogs( hFirmware, pSize, pFirmwareLog );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFirmwareGetConsoleLogs", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesFirmwareGetConsoleLogs", [=]() { handler->zesFirmwareGetConsoleLogsEpilogue( hFirmware, pSize, pFirmwareLog ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesFirmwareGetConsoleLogsEpilogue( hFirmware, pSize, pFirmwareLog ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFirmwareGetConsoleLogs", result);
         }
@@ -2940,7 +3647,10 @@ namespace validation_layer
             return logAndPropagateResult("zesDeviceEnumFrequencyDomains", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceEnumFrequencyDomains", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumFrequencyDomainsPrologue( hDevice, pCount, phFrequency );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEnumFrequencyDomains", result);
         }
@@ -2952,6 +3662,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesDeviceEnumFrequencyDomains", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumFrequencyDomainsPrologue( hDevice, pCount, phFrequency );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEnumFrequencyDomains", result);
         }
@@ -2959,6 +3670,13 @@ namespace validation_layer
         auto driver_result = pfnEnumFrequencyDomains( hDevice, pCount, phFrequency );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceEnumFrequencyDomains", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesDeviceEnumFrequencyDomains", [=]() { handler->zesDeviceEnumFrequencyDomainsEpilogue( hDevice, pCount, phFrequency ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumFrequencyDomainsEpilogue( hDevice, pCount, phFrequency ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEnumFrequencyDomains", result);
         }
@@ -2982,7 +3700,10 @@ namespace validation_layer
             return logAndPropagateResult("zesFrequencyGetProperties", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFrequencyGetProperties", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesFrequencyGetPropertiesPrologue( hFrequency, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFrequencyGetProperties", result);
         }
@@ -2994,6 +3715,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesFrequencyGetProperties", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyGetPropertiesPrologue( hFrequency, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFrequencyGetProperties", result);
         }
@@ -3001,6 +3723,13 @@ namespace validation_layer
         auto driver_result = pfnGetProperties( hFrequency, pProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFrequencyGetProperties", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesFrequencyGetProperties", [=]() { handler->zesFrequencyGetPropertiesEpilogue( hFrequency, pProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesFrequencyGetPropertiesEpilogue( hFrequency, pProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFrequencyGetProperties", result);
         }
@@ -3032,7 +3761,10 @@ namespace validation_layer
             return logAndPropagateResult("zesFrequencyGetAvailableClocks", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFrequencyGetAvailableClocks", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesFrequencyGetAvailableClocksPrologue( hFrequency, pCount, phFrequency );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFrequencyGetAvailableClocks", result);
         }
@@ -3044,6 +3776,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesFrequencyGetAvailableClocks", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyGetAvailableClocksPrologue( hFrequency, pCount, phFrequency );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFrequencyGetAvailableClocks", result);
         }
@@ -3051,6 +3784,13 @@ namespace validation_layer
         auto driver_result = pfnGetAvailableClocks( hFrequency, pCount, phFrequency );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFrequencyGetAvailableClocks", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesFrequencyGetAvailableClocks", [=]() { handler->zesFrequencyGetAvailableClocksEpilogue( hFrequency, pCount, phFrequency ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesFrequencyGetAvailableClocksEpilogue( hFrequency, pCount, phFrequency ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFrequencyGetAvailableClocks", result);
         }
@@ -3075,7 +3815,10 @@ namespace validation_layer
             return logAndPropagateResult("zesFrequencyGetRange", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFrequencyGetRange", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesFrequencyGetRangePrologue( hFrequency, pLimits );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFrequencyGetRange", result);
         }
@@ -3087,6 +3830,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesFrequencyGetRange", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyGetRangePrologue( hFrequency, pLimits );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFrequencyGetRange", result);
         }
@@ -3094,6 +3838,13 @@ namespace validation_layer
         auto driver_result = pfnGetRange( hFrequency, pLimits );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFrequencyGetRange", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesFrequencyGetRange", [=]() { handler->zesFrequencyGetRangeEpilogue( hFrequency, pLimits ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesFrequencyGetRangeEpilogue( hFrequency, pLimits ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFrequencyGetRange", result);
         }
@@ -3118,7 +3869,10 @@ namespace validation_layer
             return logAndPropagateResult("zesFrequencySetRange", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFrequencySetRange", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesFrequencySetRangePrologue( hFrequency, pLimits );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFrequencySetRange", result);
         }
@@ -3130,6 +3884,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesFrequencySetRange", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencySetRangePrologue( hFrequency, pLimits );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFrequencySetRange", result);
         }
@@ -3137,6 +3892,13 @@ namespace validation_layer
         auto driver_result = pfnSetRange( hFrequency, pLimits );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFrequencySetRange", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesFrequencySetRange", [=]() { handler->zesFrequencySetRangeEpilogue( hFrequency, pLimits ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesFrequencySetRangeEpilogue( hFrequency, pLimits ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFrequencySetRange", result);
         }
@@ -3160,7 +3922,10 @@ namespace validation_layer
             return logAndPropagateResult("zesFrequencyGetState", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFrequencyGetState", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesFrequencyGetStatePrologue( hFrequency, pState );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFrequencyGetState", result);
         }
@@ -3172,6 +3937,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesFrequencyGetState", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyGetStatePrologue( hFrequency, pState );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFrequencyGetState", result);
         }
@@ -3179,6 +3945,13 @@ namespace validation_layer
         auto driver_result = pfnGetState( hFrequency, pState );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFrequencyGetState", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesFrequencyGetState", [=]() { handler->zesFrequencyGetStateEpilogue( hFrequency, pState ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesFrequencyGetStateEpilogue( hFrequency, pState ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFrequencyGetState", result);
         }
@@ -3203,7 +3976,10 @@ namespace validation_layer
             return logAndPropagateResult("zesFrequencyGetThrottleTime", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFrequencyGetThrottleTime", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesFrequencyGetThrottleTimePrologue( hFrequency, pThrottleTime );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFrequencyGetThrottleTime", result);
         }
@@ -3215,6 +3991,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesFrequencyGetThrottleTime", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyGetThrottleTimePrologue( hFrequency, pThrottleTime );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFrequencyGetThrottleTime", result);
         }
@@ -3222,6 +3999,13 @@ namespace validation_layer
         auto driver_result = pfnGetThrottleTime( hFrequency, pThrottleTime );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFrequencyGetThrottleTime", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesFrequencyGetThrottleTime", [=]() { handler->zesFrequencyGetThrottleTimeEpilogue( hFrequency, pThrottleTime ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesFrequencyGetThrottleTimeEpilogue( hFrequency, pThrottleTime ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFrequencyGetThrottleTime", result);
         }
@@ -3245,7 +4029,10 @@ namespace validation_layer
             return logAndPropagateResult("zesFrequencyOcGetCapabilities", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFrequencyOcGetCapabilities", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcGetCapabilitiesPrologue( hFrequency, pOcCapabilities );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFrequencyOcGetCapabilities", result);
         }
@@ -3257,6 +4044,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesFrequencyOcGetCapabilities", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyOcGetCapabilitiesPrologue( hFrequency, pOcCapabilities );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFrequencyOcGetCapabilities", result);
         }
@@ -3264,6 +4052,13 @@ namespace validation_layer
         auto driver_result = pfnOcGetCapabilities( hFrequency, pOcCapabilities );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFrequencyOcGetCapabilities", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesFrequencyOcGetCapabilities", [=]() { handler->zesFrequencyOcGetCapabilitiesEpilogue( hFrequency, pOcCapabilities ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcGetCapabilitiesEpilogue( hFrequency, pOcCapabilities ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFrequencyOcGetCapabilities", result);
         }
@@ -3290,7 +4085,10 @@ namespace validation_layer
             return logAndPropagateResult("zesFrequencyOcGetFrequencyTarget", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFrequencyOcGetFrequencyTarget", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcGetFrequencyTargetPrologue( hFrequency, pCurrentOcFrequency );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFrequencyOcGetFrequencyTarget", result);
         }
@@ -3302,6 +4100,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesFrequencyOcGetFrequencyTarget", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyOcGetFrequencyTargetPrologue( hFrequency, pCurrentOcFrequency );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFrequencyOcGetFrequencyTarget", result);
         }
@@ -3309,6 +4108,13 @@ namespace validation_layer
         auto driver_result = pfnOcGetFrequencyTarget( hFrequency, pCurrentOcFrequency );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFrequencyOcGetFrequencyTarget", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesFrequencyOcGetFrequencyTarget", [=]() { handler->zesFrequencyOcGetFrequencyTargetEpilogue( hFrequency, pCurrentOcFrequency ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcGetFrequencyTargetEpilogue( hFrequency, pCurrentOcFrequency ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFrequencyOcGetFrequencyTarget", result);
         }
@@ -3335,7 +4141,10 @@ namespace validation_layer
             return logAndPropagateResult("zesFrequencyOcSetFrequencyTarget", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFrequencyOcSetFrequencyTarget", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcSetFrequencyTargetPrologue( hFrequency, CurrentOcFrequency );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFrequencyOcSetFrequencyTarget", result);
         }
@@ -3347,6 +4156,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesFrequencyOcSetFrequencyTarget", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyOcSetFrequencyTargetPrologue( hFrequency, CurrentOcFrequency );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFrequencyOcSetFrequencyTarget", result);
         }
@@ -3354,6 +4164,13 @@ namespace validation_layer
         auto driver_result = pfnOcSetFrequencyTarget( hFrequency, CurrentOcFrequency );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFrequencyOcSetFrequencyTarget", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesFrequencyOcSetFrequencyTarget", [=]() { handler->zesFrequencyOcSetFrequencyTargetEpilogue( hFrequency, CurrentOcFrequency ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcSetFrequencyTargetEpilogue( hFrequency, CurrentOcFrequency ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFrequencyOcSetFrequencyTarget", result);
         }
@@ -3382,7 +4199,10 @@ namespace validation_layer
             return logAndPropagateResult("zesFrequencyOcGetVoltageTarget", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFrequencyOcGetVoltageTarget", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcGetVoltageTargetPrologue( hFrequency, pCurrentVoltageTarget, pCurrentVoltageOffset );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFrequencyOcGetVoltageTarget", result);
         }
@@ -3394,6 +4214,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesFrequencyOcGetVoltageTarget", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyOcGetVoltageTargetPrologue( hFrequency, pCurrentVoltageTarget, pCurrentVoltageOffset );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFrequencyOcGetVoltageTarget", result);
         }
@@ -3401,6 +4222,13 @@ namespace validation_layer
         auto driver_result = pfnOcGetVoltageTarget( hFrequency, pCurrentVoltageTarget, pCurrentVoltageOffset );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFrequencyOcGetVoltageTarget", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesFrequencyOcGetVoltageTarget", [=]() { handler->zesFrequencyOcGetVoltageTargetEpilogue( hFrequency, pCurrentVoltageTarget, pCurrentVoltageOffset ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcGetVoltageTargetEpilogue( hFrequency, pCurrentVoltageTarget, pCurrentVoltageOffset ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFrequencyOcGetVoltageTarget", result);
         }
@@ -3429,7 +4257,10 @@ namespace validation_layer
             return logAndPropagateResult("zesFrequencyOcSetVoltageTarget", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFrequencyOcSetVoltageTarget", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcSetVoltageTargetPrologue( hFrequency, CurrentVoltageTarget, CurrentVoltageOffset );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFrequencyOcSetVoltageTarget", result);
         }
@@ -3441,6 +4272,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesFrequencyOcSetVoltageTarget", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyOcSetVoltageTargetPrologue( hFrequency, CurrentVoltageTarget, CurrentVoltageOffset );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFrequencyOcSetVoltageTarget", result);
         }
@@ -3448,6 +4280,13 @@ namespace validation_layer
         auto driver_result = pfnOcSetVoltageTarget( hFrequency, CurrentVoltageTarget, CurrentVoltageOffset );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFrequencyOcSetVoltageTarget", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesFrequencyOcSetVoltageTarget", [=]() { handler->zesFrequencyOcSetVoltageTargetEpilogue( hFrequency, CurrentVoltageTarget, CurrentVoltageOffset ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcSetVoltageTargetEpilogue( hFrequency, CurrentVoltageTarget, CurrentVoltageOffset ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFrequencyOcSetVoltageTarget", result);
         }
@@ -3471,7 +4310,10 @@ namespace validation_layer
             return logAndPropagateResult("zesFrequencyOcSetMode", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFrequencyOcSetMode", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcSetModePrologue( hFrequency, CurrentOcMode );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFrequencyOcSetMode", result);
         }
@@ -3483,6 +4325,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesFrequencyOcSetMode", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyOcSetModePrologue( hFrequency, CurrentOcMode );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFrequencyOcSetMode", result);
         }
@@ -3490,6 +4333,13 @@ namespace validation_layer
         auto driver_result = pfnOcSetMode( hFrequency, CurrentOcMode );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFrequencyOcSetMode", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesFrequencyOcSetMode", [=]() { handler->zesFrequencyOcSetModeEpilogue( hFrequency, CurrentOcMode ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcSetModeEpilogue( hFrequency, CurrentOcMode ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFrequencyOcSetMode", result);
         }
@@ -3513,7 +4363,10 @@ namespace validation_layer
             return logAndPropagateResult("zesFrequencyOcGetMode", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFrequencyOcGetMode", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcGetModePrologue( hFrequency, pCurrentOcMode );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFrequencyOcGetMode", result);
         }
@@ -3525,6 +4378,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesFrequencyOcGetMode", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyOcGetModePrologue( hFrequency, pCurrentOcMode );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFrequencyOcGetMode", result);
         }
@@ -3532,6 +4386,13 @@ namespace validation_layer
         auto driver_result = pfnOcGetMode( hFrequency, pCurrentOcMode );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFrequencyOcGetMode", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesFrequencyOcGetMode", [=]() { handler->zesFrequencyOcGetModeEpilogue( hFrequency, pCurrentOcMode ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcGetModeEpilogue( hFrequency, pCurrentOcMode ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFrequencyOcGetMode", result);
         }
@@ -3556,7 +4417,10 @@ namespace validation_layer
             return logAndPropagateResult("zesFrequencyOcGetIccMax", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFrequencyOcGetIccMax", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcGetIccMaxPrologue( hFrequency, pOcIccMax );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFrequencyOcGetIccMax", result);
         }
@@ -3568,6 +4432,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesFrequencyOcGetIccMax", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyOcGetIccMaxPrologue( hFrequency, pOcIccMax );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFrequencyOcGetIccMax", result);
         }
@@ -3575,6 +4440,13 @@ namespace validation_layer
         auto driver_result = pfnOcGetIccMax( hFrequency, pOcIccMax );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFrequencyOcGetIccMax", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesFrequencyOcGetIccMax", [=]() { handler->zesFrequencyOcGetIccMaxEpilogue( hFrequency, pOcIccMax ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcGetIccMaxEpilogue( hFrequency, pOcIccMax ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFrequencyOcGetIccMax", result);
         }
@@ -3598,7 +4470,10 @@ namespace validation_layer
             return logAndPropagateResult("zesFrequencyOcSetIccMax", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFrequencyOcSetIccMax", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcSetIccMaxPrologue( hFrequency, ocIccMax );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFrequencyOcSetIccMax", result);
         }
@@ -3610,6 +4485,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesFrequencyOcSetIccMax", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyOcSetIccMaxPrologue( hFrequency, ocIccMax );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFrequencyOcSetIccMax", result);
         }
@@ -3617,6 +4493,13 @@ namespace validation_layer
         auto driver_result = pfnOcSetIccMax( hFrequency, ocIccMax );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFrequencyOcSetIccMax", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesFrequencyOcSetIccMax", [=]() { handler->zesFrequencyOcSetIccMaxEpilogue( hFrequency, ocIccMax ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcSetIccMaxEpilogue( hFrequency, ocIccMax ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFrequencyOcSetIccMax", result);
         }
@@ -3641,7 +4524,10 @@ namespace validation_layer
             return logAndPropagateResult("zesFrequencyOcGetTjMax", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFrequencyOcGetTjMax", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcGetTjMaxPrologue( hFrequency, pOcTjMax );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFrequencyOcGetTjMax", result);
         }
@@ -3653,6 +4539,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesFrequencyOcGetTjMax", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyOcGetTjMaxPrologue( hFrequency, pOcTjMax );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFrequencyOcGetTjMax", result);
         }
@@ -3660,6 +4547,13 @@ namespace validation_layer
         auto driver_result = pfnOcGetTjMax( hFrequency, pOcTjMax );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFrequencyOcGetTjMax", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesFrequencyOcGetTjMax", [=]() { handler->zesFrequencyOcGetTjMaxEpilogue( hFrequency, pOcTjMax ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcGetTjMaxEpilogue( hFrequency, pOcTjMax ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFrequencyOcGetTjMax", result);
         }
@@ -3683,7 +4577,10 @@ namespace validation_layer
             return logAndPropagateResult("zesFrequencyOcSetTjMax", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFrequencyOcSetTjMax", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcSetTjMaxPrologue( hFrequency, ocTjMax );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFrequencyOcSetTjMax", result);
         }
@@ -3695,6 +4592,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesFrequencyOcSetTjMax", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyOcSetTjMaxPrologue( hFrequency, ocTjMax );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFrequencyOcSetTjMax", result);
         }
@@ -3702,6 +4600,13 @@ namespace validation_layer
         auto driver_result = pfnOcSetTjMax( hFrequency, ocTjMax );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFrequencyOcSetTjMax", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesFrequencyOcSetTjMax", [=]() { handler->zesFrequencyOcSetTjMaxEpilogue( hFrequency, ocTjMax ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesFrequencyOcSetTjMaxEpilogue( hFrequency, ocTjMax ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFrequencyOcSetTjMax", result);
         }
@@ -3735,7 +4640,10 @@ namespace validation_layer
             return logAndPropagateResult("zesDeviceEnumLeds", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceEnumLeds", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumLedsPrologue( hDevice, pCount, phLed );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEnumLeds", result);
         }
@@ -3747,6 +4655,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesDeviceEnumLeds", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumLedsPrologue( hDevice, pCount, phLed );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEnumLeds", result);
         }
@@ -3754,6 +4663,13 @@ namespace validation_layer
         auto driver_result = pfnEnumLeds( hDevice, pCount, phLed );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceEnumLeds", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesDeviceEnumLeds", [=]() { handler->zesDeviceEnumLedsEpilogue( hDevice, pCount, phLed ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumLedsEpilogue( hDevice, pCount, phLed ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEnumLeds", result);
         }
@@ -3777,7 +4693,10 @@ namespace validation_layer
             return logAndPropagateResult("zesLedGetProperties", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesLedGetProperties", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesLedGetPropertiesPrologue( hLed, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesLedGetProperties", result);
         }
@@ -3789,6 +4708,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesLedGetProperties", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesLedGetPropertiesPrologue( hLed, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesLedGetProperties", result);
         }
@@ -3796,6 +4716,13 @@ namespace validation_layer
         auto driver_result = pfnGetProperties( hLed, pProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesLedGetProperties", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesLedGetProperties", [=]() { handler->zesLedGetPropertiesEpilogue( hLed, pProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesLedGetPropertiesEpilogue( hLed, pProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesLedGetProperties", result);
         }
@@ -3819,7 +4746,10 @@ namespace validation_layer
             return logAndPropagateResult("zesLedGetState", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesLedGetState", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesLedGetStatePrologue( hLed, pState );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesLedGetState", result);
         }
@@ -3831,6 +4761,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesLedGetState", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesLedGetStatePrologue( hLed, pState );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesLedGetState", result);
         }
@@ -3838,6 +4769,13 @@ namespace validation_layer
         auto driver_result = pfnGetState( hLed, pState );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesLedGetState", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesLedGetState", [=]() { handler->zesLedGetStateEpilogue( hLed, pState ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesLedGetStateEpilogue( hLed, pState ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesLedGetState", result);
         }
@@ -3861,7 +4799,10 @@ namespace validation_layer
             return logAndPropagateResult("zesLedSetState", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesLedSetState", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesLedSetStatePrologue( hLed, enable );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesLedSetState", result);
         }
@@ -3873,6 +4814,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesLedSetState", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesLedSetStatePrologue( hLed, enable );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesLedSetState", result);
         }
@@ -3880,6 +4822,13 @@ namespace validation_layer
         auto driver_result = pfnSetState( hLed, enable );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesLedSetState", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesLedSetState", [=]() { handler->zesLedSetStateEpilogue( hLed, enable ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesLedSetStateEpilogue( hLed, enable ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesLedSetState", result);
         }
@@ -3903,7 +4852,10 @@ namespace validation_layer
             return logAndPropagateResult("zesLedSetColor", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesLedSetColor", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesLedSetColorPrologue( hLed, pColor );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesLedSetColor", result);
         }
@@ -3915,6 +4867,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesLedSetColor", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesLedSetColorPrologue( hLed, pColor );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesLedSetColor", result);
         }
@@ -3922,6 +4875,13 @@ namespace validation_layer
         auto driver_result = pfnSetColor( hLed, pColor );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesLedSetColor", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesLedSetColor", [=]() { handler->zesLedSetColorEpilogue( hLed, pColor ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesLedSetColorEpilogue( hLed, pColor ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesLedSetColor", result);
         }
@@ -3955,7 +4915,10 @@ namespace validation_layer
             return logAndPropagateResult("zesDeviceEnumMemoryModules", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceEnumMemoryModules", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumMemoryModulesPrologue( hDevice, pCount, phMemory );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEnumMemoryModules", result);
         }
@@ -3967,6 +4930,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesDeviceEnumMemoryModules", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumMemoryModulesPrologue( hDevice, pCount, phMemory );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEnumMemoryModules", result);
         }
@@ -3974,6 +4938,13 @@ namespace validation_layer
         auto driver_result = pfnEnumMemoryModules( hDevice, pCount, phMemory );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceEnumMemoryModules", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesDeviceEnumMemoryModules", [=]() { handler->zesDeviceEnumMemoryModulesEpilogue( hDevice, pCount, phMemory ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumMemoryModulesEpilogue( hDevice, pCount, phMemory ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEnumMemoryModules", result);
         }
@@ -3997,7 +4968,10 @@ namespace validation_layer
             return logAndPropagateResult("zesMemoryGetProperties", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesMemoryGetProperties", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesMemoryGetPropertiesPrologue( hMemory, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesMemoryGetProperties", result);
         }
@@ -4009,6 +4983,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesMemoryGetProperties", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesMemoryGetPropertiesPrologue( hMemory, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesMemoryGetProperties", result);
         }
@@ -4016,6 +4991,13 @@ namespace validation_layer
         auto driver_result = pfnGetProperties( hMemory, pProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesMemoryGetProperties", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesMemoryGetProperties", [=]() { handler->zesMemoryGetPropertiesEpilogue( hMemory, pProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesMemoryGetPropertiesEpilogue( hMemory, pProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesMemoryGetProperties", result);
         }
@@ -4039,7 +5021,10 @@ namespace validation_layer
             return logAndPropagateResult("zesMemoryGetState", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesMemoryGetState", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesMemoryGetStatePrologue( hMemory, pState );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesMemoryGetState", result);
         }
@@ -4051,6 +5036,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesMemoryGetState", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesMemoryGetStatePrologue( hMemory, pState );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesMemoryGetState", result);
         }
@@ -4058,6 +5044,13 @@ namespace validation_layer
         auto driver_result = pfnGetState( hMemory, pState );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesMemoryGetState", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesMemoryGetState", [=]() { handler->zesMemoryGetStateEpilogue( hMemory, pState ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesMemoryGetStateEpilogue( hMemory, pState ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesMemoryGetState", result);
         }
@@ -4082,7 +5075,10 @@ namespace validation_layer
             return logAndPropagateResult("zesMemoryGetBandwidth", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesMemoryGetBandwidth", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesMemoryGetBandwidthPrologue( hMemory, pBandwidth );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesMemoryGetBandwidth", result);
         }
@@ -4094,6 +5090,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesMemoryGetBandwidth", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesMemoryGetBandwidthPrologue( hMemory, pBandwidth );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesMemoryGetBandwidth", result);
         }
@@ -4101,6 +5098,13 @@ namespace validation_layer
         auto driver_result = pfnGetBandwidth( hMemory, pBandwidth );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesMemoryGetBandwidth", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesMemoryGetBandwidth", [=]() { handler->zesMemoryGetBandwidthEpilogue( hMemory, pBandwidth ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesMemoryGetBandwidthEpilogue( hMemory, pBandwidth ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesMemoryGetBandwidth", result);
         }
@@ -4134,7 +5138,10 @@ namespace validation_layer
             return logAndPropagateResult("zesDeviceEnumPerformanceFactorDomains", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceEnumPerformanceFactorDomains", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumPerformanceFactorDomainsPrologue( hDevice, pCount, phPerf );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEnumPerformanceFactorDomains", result);
         }
@@ -4146,6 +5153,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesDeviceEnumPerformanceFactorDomains", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumPerformanceFactorDomainsPrologue( hDevice, pCount, phPerf );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEnumPerformanceFactorDomains", result);
         }
@@ -4153,6 +5161,13 @@ namespace validation_layer
         auto driver_result = pfnEnumPerformanceFactorDomains( hDevice, pCount, phPerf );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceEnumPerformanceFactorDomains", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesDeviceEnumPerformanceFactorDomains", [=]() { handler->zesDeviceEnumPerformanceFactorDomainsEpilogue( hDevice, pCount, phPerf ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumPerformanceFactorDomainsEpilogue( hDevice, pCount, phPerf ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEnumPerformanceFactorDomains", result);
         }
@@ -4177,7 +5192,10 @@ namespace validation_layer
             return logAndPropagateResult("zesPerformanceFactorGetProperties", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesPerformanceFactorGetProperties", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesPerformanceFactorGetPropertiesPrologue( hPerf, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesPerformanceFactorGetProperties", result);
         }
@@ -4189,6 +5207,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesPerformanceFactorGetProperties", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesPerformanceFactorGetPropertiesPrologue( hPerf, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesPerformanceFactorGetProperties", result);
         }
@@ -4196,6 +5215,13 @@ namespace validation_layer
         auto driver_result = pfnGetProperties( hPerf, pProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesPerformanceFactorGetProperties", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesPerformanceFactorGetProperties", [=]() { handler->zesPerformanceFactorGetPropertiesEpilogue( hPerf, pProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesPerformanceFactorGetPropertiesEpilogue( hPerf, pProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesPerformanceFactorGetProperties", result);
         }
@@ -4220,7 +5246,10 @@ namespace validation_layer
             return logAndPropagateResult("zesPerformanceFactorGetConfig", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesPerformanceFactorGetConfig", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesPerformanceFactorGetConfigPrologue( hPerf, pFactor );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesPerformanceFactorGetConfig", result);
         }
@@ -4232,6 +5261,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesPerformanceFactorGetConfig", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesPerformanceFactorGetConfigPrologue( hPerf, pFactor );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesPerformanceFactorGetConfig", result);
         }
@@ -4239,6 +5269,13 @@ namespace validation_layer
         auto driver_result = pfnGetConfig( hPerf, pFactor );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesPerformanceFactorGetConfig", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesPerformanceFactorGetConfig", [=]() { handler->zesPerformanceFactorGetConfigEpilogue( hPerf, pFactor ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesPerformanceFactorGetConfigEpilogue( hPerf, pFactor ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesPerformanceFactorGetConfig", result);
         }
@@ -4262,7 +5299,10 @@ namespace validation_layer
             return logAndPropagateResult("zesPerformanceFactorSetConfig", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesPerformanceFactorSetConfig", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesPerformanceFactorSetConfigPrologue( hPerf, factor );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesPerformanceFactorSetConfig", result);
         }
@@ -4274,6 +5314,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesPerformanceFactorSetConfig", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesPerformanceFactorSetConfigPrologue( hPerf, factor );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesPerformanceFactorSetConfig", result);
         }
@@ -4281,6 +5322,13 @@ namespace validation_layer
         auto driver_result = pfnSetConfig( hPerf, factor );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesPerformanceFactorSetConfig", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesPerformanceFactorSetConfig", [=]() { handler->zesPerformanceFactorSetConfigEpilogue( hPerf, factor ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesPerformanceFactorSetConfigEpilogue( hPerf, factor ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesPerformanceFactorSetConfig", result);
         }
@@ -4314,7 +5362,10 @@ namespace validation_layer
             return logAndPropagateResult("zesDeviceEnumPowerDomains", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceEnumPowerDomains", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumPowerDomainsPrologue( hDevice, pCount, phPower );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEnumPowerDomains", result);
         }
@@ -4326,6 +5377,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesDeviceEnumPowerDomains", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumPowerDomainsPrologue( hDevice, pCount, phPower );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEnumPowerDomains", result);
         }
@@ -4333,6 +5385,13 @@ namespace validation_layer
         auto driver_result = pfnEnumPowerDomains( hDevice, pCount, phPower );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceEnumPowerDomains", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesDeviceEnumPowerDomains", [=]() { handler->zesDeviceEnumPowerDomainsEpilogue( hDevice, pCount, phPower ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumPowerDomainsEpilogue( hDevice, pCount, phPower ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEnumPowerDomains", result);
         }
@@ -4356,7 +5415,10 @@ namespace validation_layer
             return logAndPropagateResult("zesDeviceGetCardPowerDomain", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceGetCardPowerDomain", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceGetCardPowerDomainPrologue( hDevice, phPower );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceGetCardPowerDomain", result);
         }
@@ -4368,6 +5430,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesDeviceGetCardPowerDomain", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceGetCardPowerDomainPrologue( hDevice, phPower );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceGetCardPowerDomain", result);
         }
@@ -4375,6 +5438,13 @@ namespace validation_layer
         auto driver_result = pfnGetCardPowerDomain( hDevice, phPower );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceGetCardPowerDomain", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesDeviceGetCardPowerDomain", [=]() { handler->zesDeviceGetCardPowerDomainEpilogue( hDevice, phPower ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceGetCardPowerDomainEpilogue( hDevice, phPower ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceGetCardPowerDomain", result);
         }
@@ -4398,7 +5468,10 @@ namespace validation_layer
             return logAndPropagateResult("zesPowerGetProperties", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesPowerGetProperties", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesPowerGetPropertiesPrologue( hPower, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesPowerGetProperties", result);
         }
@@ -4410,6 +5483,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesPowerGetProperties", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesPowerGetPropertiesPrologue( hPower, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesPowerGetProperties", result);
         }
@@ -4417,6 +5491,13 @@ namespace validation_layer
         auto driver_result = pfnGetProperties( hPower, pProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesPowerGetProperties", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesPowerGetProperties", [=]() { handler->zesPowerGetPropertiesEpilogue( hPower, pProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesPowerGetPropertiesEpilogue( hPower, pProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesPowerGetProperties", result);
         }
@@ -4441,7 +5522,10 @@ namespace validation_layer
             return logAndPropagateResult("zesPowerGetEnergyCounter", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesPowerGetEnergyCounter", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesPowerGetEnergyCounterPrologue( hPower, pEnergy );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesPowerGetEnergyCounter", result);
         }
@@ -4453,6 +5537,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesPowerGetEnergyCounter", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesPowerGetEnergyCounterPrologue( hPower, pEnergy );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesPowerGetEnergyCounter", result);
         }
@@ -4460,6 +5545,13 @@ namespace validation_layer
         auto driver_result = pfnGetEnergyCounter( hPower, pEnergy );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesPowerGetEnergyCounter", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesPowerGetEnergyCounter", [=]() { handler->zesPowerGetEnergyCounterEpilogue( hPower, pEnergy ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesPowerGetEnergyCounterEpilogue( hPower, pEnergy ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesPowerGetEnergyCounter", result);
         }
@@ -4488,7 +5580,10 @@ namespace validation_layer
             return logAndPropagateResult("zesPowerGetLimits", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesPowerGetLimits", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesPowerGetLimitsPrologue( hPower, pSustained, pBurst, pPeak );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesPowerGetLimits", result);
         }
@@ -4500,6 +5595,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesPowerGetLimits", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesPowerGetLimitsPrologue( hPower, pSustained, pBurst, pPeak );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesPowerGetLimits", result);
         }
@@ -4507,6 +5603,13 @@ namespace validation_layer
         auto driver_result = pfnGetLimits( hPower, pSustained, pBurst, pPeak );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesPowerGetLimits", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesPowerGetLimits", [=]() { handler->zesPowerGetLimitsEpilogue( hPower, pSustained, pBurst, pPeak ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesPowerGetLimitsEpilogue( hPower, pSustained, pBurst, pPeak ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesPowerGetLimits", result);
         }
@@ -4535,7 +5638,10 @@ namespace validation_layer
             return logAndPropagateResult("zesPowerSetLimits", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesPowerSetLimits", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesPowerSetLimitsPrologue( hPower, pSustained, pBurst, pPeak );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesPowerSetLimits", result);
         }
@@ -4547,6 +5653,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesPowerSetLimits", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesPowerSetLimitsPrologue( hPower, pSustained, pBurst, pPeak );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesPowerSetLimits", result);
         }
@@ -4554,6 +5661,13 @@ namespace validation_layer
         auto driver_result = pfnSetLimits( hPower, pSustained, pBurst, pPeak );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesPowerSetLimits", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesPowerSetLimits", [=]() { handler->zesPowerSetLimitsEpilogue( hPower, pSustained, pBurst, pPeak ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesPowerSetLimitsEpilogue( hPower, pSustained, pBurst, pPeak ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesPowerSetLimits", result);
         }
@@ -4578,7 +5692,10 @@ namespace validation_layer
             return logAndPropagateResult("zesPowerGetEnergyThreshold", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesPowerGetEnergyThreshold", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesPowerGetEnergyThresholdPrologue( hPower, pThreshold );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesPowerGetEnergyThreshold", result);
         }
@@ -4590,6 +5707,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesPowerGetEnergyThreshold", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesPowerGetEnergyThresholdPrologue( hPower, pThreshold );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesPowerGetEnergyThreshold", result);
         }
@@ -4597,6 +5715,13 @@ namespace validation_layer
         auto driver_result = pfnGetEnergyThreshold( hPower, pThreshold );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesPowerGetEnergyThreshold", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesPowerGetEnergyThreshold", [=]() { handler->zesPowerGetEnergyThresholdEpilogue( hPower, pThreshold ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesPowerGetEnergyThresholdEpilogue( hPower, pThreshold ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesPowerGetEnergyThreshold", result);
         }
@@ -4620,7 +5745,10 @@ namespace validation_layer
             return logAndPropagateResult("zesPowerSetEnergyThreshold", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesPowerSetEnergyThreshold", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesPowerSetEnergyThresholdPrologue( hPower, threshold );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesPowerSetEnergyThreshold", result);
         }
@@ -4632,6 +5760,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesPowerSetEnergyThreshold", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesPowerSetEnergyThresholdPrologue( hPower, threshold );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesPowerSetEnergyThreshold", result);
         }
@@ -4639,6 +5768,13 @@ namespace validation_layer
         auto driver_result = pfnSetEnergyThreshold( hPower, threshold );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesPowerSetEnergyThreshold", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesPowerSetEnergyThreshold", [=]() { handler->zesPowerSetEnergyThresholdEpilogue( hPower, threshold ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesPowerSetEnergyThresholdEpilogue( hPower, threshold ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesPowerSetEnergyThreshold", result);
         }
@@ -4672,7 +5808,10 @@ namespace validation_layer
             return logAndPropagateResult("zesDeviceEnumPsus", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceEnumPsus", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumPsusPrologue( hDevice, pCount, phPsu );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEnumPsus", result);
         }
@@ -4684,6 +5823,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesDeviceEnumPsus", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumPsusPrologue( hDevice, pCount, phPsu );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEnumPsus", result);
         }
@@ -4691,6 +5831,13 @@ namespace validation_layer
         auto driver_result = pfnEnumPsus( hDevice, pCount, phPsu );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceEnumPsus", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesDeviceEnumPsus", [=]() { handler->zesDeviceEnumPsusEpilogue( hDevice, pCount, phPsu ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumPsusEpilogue( hDevice, pCount, phPsu ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEnumPsus", result);
         }
@@ -4714,7 +5861,10 @@ namespace validation_layer
             return logAndPropagateResult("zesPsuGetProperties", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesPsuGetProperties", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesPsuGetPropertiesPrologue( hPsu, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesPsuGetProperties", result);
         }
@@ -4726,6 +5876,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesPsuGetProperties", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesPsuGetPropertiesPrologue( hPsu, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesPsuGetProperties", result);
         }
@@ -4733,6 +5884,13 @@ namespace validation_layer
         auto driver_result = pfnGetProperties( hPsu, pProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesPsuGetProperties", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesPsuGetProperties", [=]() { handler->zesPsuGetPropertiesEpilogue( hPsu, pProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesPsuGetPropertiesEpilogue( hPsu, pProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesPsuGetProperties", result);
         }
@@ -4756,7 +5914,10 @@ namespace validation_layer
             return logAndPropagateResult("zesPsuGetState", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesPsuGetState", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesPsuGetStatePrologue( hPsu, pState );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesPsuGetState", result);
         }
@@ -4768,6 +5929,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesPsuGetState", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesPsuGetStatePrologue( hPsu, pState );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesPsuGetState", result);
         }
@@ -4775,6 +5937,13 @@ namespace validation_layer
         auto driver_result = pfnGetState( hPsu, pState );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesPsuGetState", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesPsuGetState", [=]() { handler->zesPsuGetStateEpilogue( hPsu, pState ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesPsuGetStateEpilogue( hPsu, pState ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesPsuGetState", result);
         }
@@ -4808,7 +5977,10 @@ namespace validation_layer
             return logAndPropagateResult("zesDeviceEnumRasErrorSets", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceEnumRasErrorSets", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumRasErrorSetsPrologue( hDevice, pCount, phRas );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEnumRasErrorSets", result);
         }
@@ -4820,6 +5992,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesDeviceEnumRasErrorSets", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumRasErrorSetsPrologue( hDevice, pCount, phRas );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEnumRasErrorSets", result);
         }
@@ -4827,6 +6000,13 @@ namespace validation_layer
         auto driver_result = pfnEnumRasErrorSets( hDevice, pCount, phRas );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceEnumRasErrorSets", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesDeviceEnumRasErrorSets", [=]() { handler->zesDeviceEnumRasErrorSetsEpilogue( hDevice, pCount, phRas ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumRasErrorSetsEpilogue( hDevice, pCount, phRas ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEnumRasErrorSets", result);
         }
@@ -4850,7 +6030,10 @@ namespace validation_layer
             return logAndPropagateResult("zesRasGetProperties", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesRasGetProperties", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesRasGetPropertiesPrologue( hRas, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesRasGetProperties", result);
         }
@@ -4862,6 +6045,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesRasGetProperties", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesRasGetPropertiesPrologue( hRas, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesRasGetProperties", result);
         }
@@ -4869,6 +6053,13 @@ namespace validation_layer
         auto driver_result = pfnGetProperties( hRas, pProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesRasGetProperties", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesRasGetProperties", [=]() { handler->zesRasGetPropertiesEpilogue( hRas, pProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesRasGetPropertiesEpilogue( hRas, pProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesRasGetProperties", result);
         }
@@ -4893,7 +6084,10 @@ namespace validation_layer
             return logAndPropagateResult("zesRasGetConfig", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesRasGetConfig", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesRasGetConfigPrologue( hRas, pConfig );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesRasGetConfig", result);
         }
@@ -4905,6 +6099,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesRasGetConfig", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesRasGetConfigPrologue( hRas, pConfig );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesRasGetConfig", result);
         }
@@ -4912,6 +6107,13 @@ namespace validation_layer
         auto driver_result = pfnGetConfig( hRas, pConfig );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesRasGetConfig", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesRasGetConfig", [=]() { handler->zesRasGetConfigEpilogue( hRas, pConfig ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesRasGetConfigEpilogue( hRas, pConfig ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesRasGetConfig", result);
         }
@@ -4935,7 +6137,10 @@ namespace validation_layer
             return logAndPropagateResult("zesRasSetConfig", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesRasSetConfig", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesRasSetConfigPrologue( hRas, pConfig );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesRasSetConfig", result);
         }
@@ -4947,6 +6152,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesRasSetConfig", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesRasSetConfigPrologue( hRas, pConfig );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesRasSetConfig", result);
         }
@@ -4954,6 +6160,13 @@ namespace validation_layer
         auto driver_result = pfnSetConfig( hRas, pConfig );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesRasSetConfig", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesRasSetConfig", [=]() { handler->zesRasSetConfigEpilogue( hRas, pConfig ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesRasSetConfigEpilogue( hRas, pConfig ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesRasSetConfig", result);
         }
@@ -4978,7 +6191,10 @@ namespace validation_layer
             return logAndPropagateResult("zesRasGetState", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesRasGetState", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesRasGetStatePrologue( hRas, clear, pState );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesRasGetState", result);
         }
@@ -4990,6 +6206,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesRasGetState", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesRasGetStatePrologue( hRas, clear, pState );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesRasGetState", result);
         }
@@ -4997,6 +6214,13 @@ namespace validation_layer
         auto driver_result = pfnGetState( hRas, clear, pState );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesRasGetState", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesRasGetState", [=]() { handler->zesRasGetStateEpilogue( hRas, clear, pState ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesRasGetStateEpilogue( hRas, clear, pState ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesRasGetState", result);
         }
@@ -5030,7 +6254,10 @@ namespace validation_layer
             return logAndPropagateResult("zesDeviceEnumSchedulers", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceEnumSchedulers", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumSchedulersPrologue( hDevice, pCount, phScheduler );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEnumSchedulers", result);
         }
@@ -5042,6 +6269,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesDeviceEnumSchedulers", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumSchedulersPrologue( hDevice, pCount, phScheduler );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEnumSchedulers", result);
         }
@@ -5049,6 +6277,13 @@ namespace validation_layer
         auto driver_result = pfnEnumSchedulers( hDevice, pCount, phScheduler );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceEnumSchedulers", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesDeviceEnumSchedulers", [=]() { handler->zesDeviceEnumSchedulersEpilogue( hDevice, pCount, phScheduler ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumSchedulersEpilogue( hDevice, pCount, phScheduler ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEnumSchedulers", result);
         }
@@ -5072,7 +6307,10 @@ namespace validation_layer
             return logAndPropagateResult("zesSchedulerGetProperties", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesSchedulerGetProperties", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesSchedulerGetPropertiesPrologue( hScheduler, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesSchedulerGetProperties", result);
         }
@@ -5084,6 +6322,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesSchedulerGetProperties", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesSchedulerGetPropertiesPrologue( hScheduler, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesSchedulerGetProperties", result);
         }
@@ -5091,6 +6330,13 @@ namespace validation_layer
         auto driver_result = pfnGetProperties( hScheduler, pProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesSchedulerGetProperties", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesSchedulerGetProperties", [=]() { handler->zesSchedulerGetPropertiesEpilogue( hScheduler, pProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesSchedulerGetPropertiesEpilogue( hScheduler, pProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesSchedulerGetProperties", result);
         }
@@ -5114,7 +6360,10 @@ namespace validation_layer
             return logAndPropagateResult("zesSchedulerGetCurrentMode", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesSchedulerGetCurrentMode", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesSchedulerGetCurrentModePrologue( hScheduler, pMode );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesSchedulerGetCurrentMode", result);
         }
@@ -5126,6 +6375,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesSchedulerGetCurrentMode", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesSchedulerGetCurrentModePrologue( hScheduler, pMode );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesSchedulerGetCurrentMode", result);
         }
@@ -5133,6 +6383,13 @@ namespace validation_layer
         auto driver_result = pfnGetCurrentMode( hScheduler, pMode );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesSchedulerGetCurrentMode", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesSchedulerGetCurrentMode", [=]() { handler->zesSchedulerGetCurrentModeEpilogue( hScheduler, pMode ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesSchedulerGetCurrentModeEpilogue( hScheduler, pMode ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesSchedulerGetCurrentMode", result);
         }
@@ -5158,7 +6415,10 @@ namespace validation_layer
             return logAndPropagateResult("zesSchedulerGetTimeoutModeProperties", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesSchedulerGetTimeoutModeProperties", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesSchedulerGetTimeoutModePropertiesPrologue( hScheduler, getDefaults, pConfig );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesSchedulerGetTimeoutModeProperties", result);
         }
@@ -5170,6 +6430,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesSchedulerGetTimeoutModeProperties", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesSchedulerGetTimeoutModePropertiesPrologue( hScheduler, getDefaults, pConfig );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesSchedulerGetTimeoutModeProperties", result);
         }
@@ -5177,6 +6438,13 @@ namespace validation_layer
         auto driver_result = pfnGetTimeoutModeProperties( hScheduler, getDefaults, pConfig );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesSchedulerGetTimeoutModeProperties", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesSchedulerGetTimeoutModeProperties", [=]() { handler->zesSchedulerGetTimeoutModePropertiesEpilogue( hScheduler, getDefaults, pConfig ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesSchedulerGetTimeoutModePropertiesEpilogue( hScheduler, getDefaults, pConfig ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesSchedulerGetTimeoutModeProperties", result);
         }
@@ -5202,7 +6470,10 @@ namespace validation_layer
             return logAndPropagateResult("zesSchedulerGetTimesliceModeProperties", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesSchedulerGetTimesliceModeProperties", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesSchedulerGetTimesliceModePropertiesPrologue( hScheduler, getDefaults, pConfig );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesSchedulerGetTimesliceModeProperties", result);
         }
@@ -5214,6 +6485,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesSchedulerGetTimesliceModeProperties", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesSchedulerGetTimesliceModePropertiesPrologue( hScheduler, getDefaults, pConfig );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesSchedulerGetTimesliceModeProperties", result);
         }
@@ -5221,6 +6493,13 @@ namespace validation_layer
         auto driver_result = pfnGetTimesliceModeProperties( hScheduler, getDefaults, pConfig );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesSchedulerGetTimesliceModeProperties", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesSchedulerGetTimesliceModeProperties", [=]() { handler->zesSchedulerGetTimesliceModePropertiesEpilogue( hScheduler, getDefaults, pConfig ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesSchedulerGetTimesliceModePropertiesEpilogue( hScheduler, getDefaults, pConfig ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesSchedulerGetTimesliceModeProperties", result);
         }
@@ -5246,7 +6525,10 @@ namespace validation_layer
             return logAndPropagateResult("zesSchedulerSetTimeoutMode", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesSchedulerSetTimeoutMode", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesSchedulerSetTimeoutModePrologue( hScheduler, pProperties, pNeedReload );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesSchedulerSetTimeoutMode", result);
         }
@@ -5258,6 +6540,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesSchedulerSetTimeoutMode", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesSchedulerSetTimeoutModePrologue( hScheduler, pProperties, pNeedReload );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesSchedulerSetTimeoutMode", result);
         }
@@ -5265,6 +6548,13 @@ namespace validation_layer
         auto driver_result = pfnSetTimeoutMode( hScheduler, pProperties, pNeedReload );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesSchedulerSetTimeoutMode", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesSchedulerSetTimeoutMode", [=]() { handler->zesSchedulerSetTimeoutModeEpilogue( hScheduler, pProperties, pNeedReload ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesSchedulerSetTimeoutModeEpilogue( hScheduler, pProperties, pNeedReload ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesSchedulerSetTimeoutMode", result);
         }
@@ -5290,7 +6580,10 @@ namespace validation_layer
             return logAndPropagateResult("zesSchedulerSetTimesliceMode", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesSchedulerSetTimesliceMode", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesSchedulerSetTimesliceModePrologue( hScheduler, pProperties, pNeedReload );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesSchedulerSetTimesliceMode", result);
         }
@@ -5302,6 +6595,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesSchedulerSetTimesliceMode", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesSchedulerSetTimesliceModePrologue( hScheduler, pProperties, pNeedReload );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesSchedulerSetTimesliceMode", result);
         }
@@ -5309,6 +6603,13 @@ namespace validation_layer
         auto driver_result = pfnSetTimesliceMode( hScheduler, pProperties, pNeedReload );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesSchedulerSetTimesliceMode", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesSchedulerSetTimesliceMode", [=]() { handler->zesSchedulerSetTimesliceModeEpilogue( hScheduler, pProperties, pNeedReload ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesSchedulerSetTimesliceModeEpilogue( hScheduler, pProperties, pNeedReload ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesSchedulerSetTimesliceMode", result);
         }
@@ -5333,7 +6634,10 @@ namespace validation_layer
             return logAndPropagateResult("zesSchedulerSetExclusiveMode", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesSchedulerSetExclusiveMode", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesSchedulerSetExclusiveModePrologue( hScheduler, pNeedReload );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesSchedulerSetExclusiveMode", result);
         }
@@ -5345,6 +6649,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesSchedulerSetExclusiveMode", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesSchedulerSetExclusiveModePrologue( hScheduler, pNeedReload );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesSchedulerSetExclusiveMode", result);
         }
@@ -5352,6 +6657,13 @@ namespace validation_layer
         auto driver_result = pfnSetExclusiveMode( hScheduler, pNeedReload );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesSchedulerSetExclusiveMode", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesSchedulerSetExclusiveMode", [=]() { handler->zesSchedulerSetExclusiveModeEpilogue( hScheduler, pNeedReload ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesSchedulerSetExclusiveModeEpilogue( hScheduler, pNeedReload ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesSchedulerSetExclusiveMode", result);
         }
@@ -5376,7 +6688,10 @@ namespace validation_layer
             return logAndPropagateResult("zesSchedulerSetComputeUnitDebugMode", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesSchedulerSetComputeUnitDebugMode", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesSchedulerSetComputeUnitDebugModePrologue( hScheduler, pNeedReload );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesSchedulerSetComputeUnitDebugMode", result);
         }
@@ -5388,6 +6703,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesSchedulerSetComputeUnitDebugMode", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesSchedulerSetComputeUnitDebugModePrologue( hScheduler, pNeedReload );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesSchedulerSetComputeUnitDebugMode", result);
         }
@@ -5395,6 +6711,13 @@ namespace validation_layer
         auto driver_result = pfnSetComputeUnitDebugMode( hScheduler, pNeedReload );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesSchedulerSetComputeUnitDebugMode", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesSchedulerSetComputeUnitDebugMode", [=]() { handler->zesSchedulerSetComputeUnitDebugModeEpilogue( hScheduler, pNeedReload ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesSchedulerSetComputeUnitDebugModeEpilogue( hScheduler, pNeedReload ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesSchedulerSetComputeUnitDebugMode", result);
         }
@@ -5428,7 +6751,10 @@ namespace validation_layer
             return logAndPropagateResult("zesDeviceEnumStandbyDomains", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceEnumStandbyDomains", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumStandbyDomainsPrologue( hDevice, pCount, phStandby );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEnumStandbyDomains", result);
         }
@@ -5440,6 +6766,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesDeviceEnumStandbyDomains", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumStandbyDomainsPrologue( hDevice, pCount, phStandby );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEnumStandbyDomains", result);
         }
@@ -5447,6 +6774,13 @@ namespace validation_layer
         auto driver_result = pfnEnumStandbyDomains( hDevice, pCount, phStandby );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceEnumStandbyDomains", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesDeviceEnumStandbyDomains", [=]() { handler->zesDeviceEnumStandbyDomainsEpilogue( hDevice, pCount, phStandby ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumStandbyDomainsEpilogue( hDevice, pCount, phStandby ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEnumStandbyDomains", result);
         }
@@ -5470,7 +6804,10 @@ namespace validation_layer
             return logAndPropagateResult("zesStandbyGetProperties", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesStandbyGetProperties", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesStandbyGetPropertiesPrologue( hStandby, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesStandbyGetProperties", result);
         }
@@ -5482,6 +6819,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesStandbyGetProperties", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesStandbyGetPropertiesPrologue( hStandby, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesStandbyGetProperties", result);
         }
@@ -5489,6 +6827,13 @@ namespace validation_layer
         auto driver_result = pfnGetProperties( hStandby, pProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesStandbyGetProperties", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesStandbyGetProperties", [=]() { handler->zesStandbyGetPropertiesEpilogue( hStandby, pProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesStandbyGetPropertiesEpilogue( hStandby, pProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesStandbyGetProperties", result);
         }
@@ -5512,7 +6857,10 @@ namespace validation_layer
             return logAndPropagateResult("zesStandbyGetMode", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesStandbyGetMode", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesStandbyGetModePrologue( hStandby, pMode );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesStandbyGetMode", result);
         }
@@ -5524,6 +6872,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesStandbyGetMode", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesStandbyGetModePrologue( hStandby, pMode );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesStandbyGetMode", result);
         }
@@ -5531,6 +6880,13 @@ namespace validation_layer
         auto driver_result = pfnGetMode( hStandby, pMode );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesStandbyGetMode", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesStandbyGetMode", [=]() { handler->zesStandbyGetModeEpilogue( hStandby, pMode ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesStandbyGetModeEpilogue( hStandby, pMode ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesStandbyGetMode", result);
         }
@@ -5554,7 +6910,10 @@ namespace validation_layer
             return logAndPropagateResult("zesStandbySetMode", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesStandbySetMode", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesStandbySetModePrologue( hStandby, mode );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesStandbySetMode", result);
         }
@@ -5566,6 +6925,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesStandbySetMode", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesStandbySetModePrologue( hStandby, mode );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesStandbySetMode", result);
         }
@@ -5573,6 +6933,13 @@ namespace validation_layer
         auto driver_result = pfnSetMode( hStandby, mode );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesStandbySetMode", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesStandbySetMode", [=]() { handler->zesStandbySetModeEpilogue( hStandby, mode ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesStandbySetModeEpilogue( hStandby, mode ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesStandbySetMode", result);
         }
@@ -5606,7 +6973,10 @@ namespace validation_layer
             return logAndPropagateResult("zesDeviceEnumTemperatureSensors", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceEnumTemperatureSensors", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumTemperatureSensorsPrologue( hDevice, pCount, phTemperature );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEnumTemperatureSensors", result);
         }
@@ -5618,6 +6988,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesDeviceEnumTemperatureSensors", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumTemperatureSensorsPrologue( hDevice, pCount, phTemperature );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEnumTemperatureSensors", result);
         }
@@ -5625,6 +6996,13 @@ namespace validation_layer
         auto driver_result = pfnEnumTemperatureSensors( hDevice, pCount, phTemperature );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceEnumTemperatureSensors", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesDeviceEnumTemperatureSensors", [=]() { handler->zesDeviceEnumTemperatureSensorsEpilogue( hDevice, pCount, phTemperature ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumTemperatureSensorsEpilogue( hDevice, pCount, phTemperature ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEnumTemperatureSensors", result);
         }
@@ -5648,7 +7026,10 @@ namespace validation_layer
             return logAndPropagateResult("zesTemperatureGetProperties", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesTemperatureGetProperties", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesTemperatureGetPropertiesPrologue( hTemperature, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesTemperatureGetProperties", result);
         }
@@ -5660,6 +7041,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesTemperatureGetProperties", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesTemperatureGetPropertiesPrologue( hTemperature, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesTemperatureGetProperties", result);
         }
@@ -5667,6 +7049,13 @@ namespace validation_layer
         auto driver_result = pfnGetProperties( hTemperature, pProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesTemperatureGetProperties", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesTemperatureGetProperties", [=]() { handler->zesTemperatureGetPropertiesEpilogue( hTemperature, pProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesTemperatureGetPropertiesEpilogue( hTemperature, pProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesTemperatureGetProperties", result);
         }
@@ -5690,7 +7079,10 @@ namespace validation_layer
             return logAndPropagateResult("zesTemperatureGetConfig", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesTemperatureGetConfig", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesTemperatureGetConfigPrologue( hTemperature, pConfig );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesTemperatureGetConfig", result);
         }
@@ -5702,6 +7094,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesTemperatureGetConfig", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesTemperatureGetConfigPrologue( hTemperature, pConfig );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesTemperatureGetConfig", result);
         }
@@ -5709,6 +7102,13 @@ namespace validation_layer
         auto driver_result = pfnGetConfig( hTemperature, pConfig );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesTemperatureGetConfig", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesTemperatureGetConfig", [=]() { handler->zesTemperatureGetConfigEpilogue( hTemperature, pConfig ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesTemperatureGetConfigEpilogue( hTemperature, pConfig ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesTemperatureGetConfig", result);
         }
@@ -5732,7 +7132,10 @@ namespace validation_layer
             return logAndPropagateResult("zesTemperatureSetConfig", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesTemperatureSetConfig", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesTemperatureSetConfigPrologue( hTemperature, pConfig );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesTemperatureSetConfig", result);
         }
@@ -5744,6 +7147,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesTemperatureSetConfig", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesTemperatureSetConfigPrologue( hTemperature, pConfig );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesTemperatureSetConfig", result);
         }
@@ -5751,6 +7155,13 @@ namespace validation_layer
         auto driver_result = pfnSetConfig( hTemperature, pConfig );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesTemperatureSetConfig", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesTemperatureSetConfig", [=]() { handler->zesTemperatureSetConfigEpilogue( hTemperature, pConfig ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesTemperatureSetConfigEpilogue( hTemperature, pConfig ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesTemperatureSetConfig", result);
         }
@@ -5775,7 +7186,10 @@ namespace validation_layer
             return logAndPropagateResult("zesTemperatureGetState", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesTemperatureGetState", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesTemperatureGetStatePrologue( hTemperature, pTemperature );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesTemperatureGetState", result);
         }
@@ -5787,6 +7201,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesTemperatureGetState", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesTemperatureGetStatePrologue( hTemperature, pTemperature );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesTemperatureGetState", result);
         }
@@ -5794,6 +7209,13 @@ namespace validation_layer
         auto driver_result = pfnGetState( hTemperature, pTemperature );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesTemperatureGetState", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesTemperatureGetState", [=]() { handler->zesTemperatureGetStateEpilogue( hTemperature, pTemperature ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesTemperatureGetStateEpilogue( hTemperature, pTemperature ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesTemperatureGetState", result);
         }
@@ -5819,7 +7241,10 @@ namespace validation_layer
             return logAndPropagateResult("zesDevicePciLinkSpeedUpdateExt", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDevicePciLinkSpeedUpdateExt", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesDevicePciLinkSpeedUpdateExtPrologue( hDevice, shouldDowngrade, pendingAction );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDevicePciLinkSpeedUpdateExt", result);
         }
@@ -5831,6 +7256,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesDevicePciLinkSpeedUpdateExt", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesDevicePciLinkSpeedUpdateExtPrologue( hDevice, shouldDowngrade, pendingAction );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDevicePciLinkSpeedUpdateExt", result);
         }
@@ -5838,6 +7264,13 @@ namespace validation_layer
         auto driver_result = pfnPciLinkSpeedUpdateExt( hDevice, shouldDowngrade, pendingAction );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDevicePciLinkSpeedUpdateExt", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesDevicePciLinkSpeedUpdateExt", [=]() { handler->zesDevicePciLinkSpeedUpdateExtEpilogue( hDevice, shouldDowngrade, pendingAction ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesDevicePciLinkSpeedUpdateExtEpilogue( hDevice, shouldDowngrade, pendingAction ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDevicePciLinkSpeedUpdateExt", result);
         }
@@ -5869,7 +7302,10 @@ namespace validation_layer
             return logAndPropagateResult("zesPowerGetLimitsExt", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesPowerGetLimitsExt", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesPowerGetLimitsExtPrologue( hPower, pCount, pSustained );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesPowerGetLimitsExt", result);
         }
@@ -5881,6 +7317,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesPowerGetLimitsExt", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesPowerGetLimitsExtPrologue( hPower, pCount, pSustained );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesPowerGetLimitsExt", result);
         }
@@ -5888,6 +7325,13 @@ namespace validation_layer
         auto driver_result = pfnGetLimitsExt( hPower, pCount, pSustained );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesPowerGetLimitsExt", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesPowerGetLimitsExt", [=]() { handler->zesPowerGetLimitsExtEpilogue( hPower, pCount, pSustained ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesPowerGetLimitsExtEpilogue( hPower, pCount, pSustained ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesPowerGetLimitsExt", result);
         }
@@ -5912,7 +7356,10 @@ namespace validation_layer
             return logAndPropagateResult("zesPowerSetLimitsExt", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesPowerSetLimitsExt", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesPowerSetLimitsExtPrologue( hPower, pCount, pSustained );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesPowerSetLimitsExt", result);
         }
@@ -5924,6 +7371,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesPowerSetLimitsExt", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesPowerSetLimitsExtPrologue( hPower, pCount, pSustained );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesPowerSetLimitsExt", result);
         }
@@ -5931,6 +7379,13 @@ namespace validation_layer
         auto driver_result = pfnSetLimitsExt( hPower, pCount, pSustained );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesPowerSetLimitsExt", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesPowerSetLimitsExt", [=]() { handler->zesPowerSetLimitsExtEpilogue( hPower, pCount, pSustained ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesPowerSetLimitsExtEpilogue( hPower, pCount, pSustained ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesPowerSetLimitsExt", result);
         }
@@ -5967,7 +7422,10 @@ namespace validation_layer
             return logAndPropagateResult("zesEngineGetActivityExt", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesEngineGetActivityExt", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesEngineGetActivityExtPrologue( hEngine, pCount, pStats );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesEngineGetActivityExt", result);
         }
@@ -5979,6 +7437,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesEngineGetActivityExt", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesEngineGetActivityExtPrologue( hEngine, pCount, pStats );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesEngineGetActivityExt", result);
         }
@@ -5986,6 +7445,13 @@ namespace validation_layer
         auto driver_result = pfnGetActivityExt( hEngine, pCount, pStats );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesEngineGetActivityExt", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesEngineGetActivityExt", [=]() { handler->zesEngineGetActivityExtEpilogue( hEngine, pCount, pStats ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesEngineGetActivityExtEpilogue( hEngine, pCount, pStats ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesEngineGetActivityExt", result);
         }
@@ -6017,7 +7483,10 @@ namespace validation_layer
             return logAndPropagateResult("zesRasGetStateExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesRasGetStateExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesRasGetStateExpPrologue( hRas, pCount, pState );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesRasGetStateExp", result);
         }
@@ -6029,6 +7498,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesRasGetStateExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesRasGetStateExpPrologue( hRas, pCount, pState );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesRasGetStateExp", result);
         }
@@ -6036,6 +7506,13 @@ namespace validation_layer
         auto driver_result = pfnGetStateExp( hRas, pCount, pState );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesRasGetStateExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesRasGetStateExp", [=]() { handler->zesRasGetStateExpEpilogue( hRas, pCount, pState ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesRasGetStateExpEpilogue( hRas, pCount, pState ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesRasGetStateExp", result);
         }
@@ -6063,7 +7540,10 @@ namespace validation_layer
             return logAndPropagateResult("zesRasClearStateExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesRasClearStateExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesRasClearStateExpPrologue( hRas, category );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesRasClearStateExp", result);
         }
@@ -6075,6 +7555,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesRasClearStateExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesRasClearStateExpPrologue( hRas, category );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesRasClearStateExp", result);
         }
@@ -6082,6 +7563,13 @@ namespace validation_layer
         auto driver_result = pfnClearStateExp( hRas, category );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesRasClearStateExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesRasClearStateExp", [=]() { handler->zesRasClearStateExpEpilogue( hRas, category ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesRasClearStateExpEpilogue( hRas, category ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesRasClearStateExp", result);
         }
@@ -6106,7 +7594,10 @@ namespace validation_layer
             return logAndPropagateResult("zesFirmwareGetSecurityVersionExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFirmwareGetSecurityVersionExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesFirmwareGetSecurityVersionExpPrologue( hFirmware, pVersion );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFirmwareGetSecurityVersionExp", result);
         }
@@ -6118,6 +7609,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesFirmwareGetSecurityVersionExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesFirmwareGetSecurityVersionExpPrologue( hFirmware, pVersion );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFirmwareGetSecurityVersionExp", result);
         }
@@ -6125,6 +7617,13 @@ namespace validation_layer
         auto driver_result = pfnGetSecurityVersionExp( hFirmware, pVersion );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFirmwareGetSecurityVersionExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesFirmwareGetSecurityVersionExp", [=]() { handler->zesFirmwareGetSecurityVersionExpEpilogue( hFirmware, pVersion ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesFirmwareGetSecurityVersionExpEpilogue( hFirmware, pVersion ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFirmwareGetSecurityVersionExp", result);
         }
@@ -6151,7 +7650,10 @@ namespace validation_layer
             return logAndPropagateResult("zesFirmwareSetSecurityVersionExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFirmwareSetSecurityVersionExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesFirmwareSetSecurityVersionExpPrologue( hFirmware );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFirmwareSetSecurityVersionExp", result);
         }
@@ -6163,6 +7665,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesFirmwareSetSecurityVersionExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesFirmwareSetSecurityVersionExpPrologue( hFirmware );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFirmwareSetSecurityVersionExp", result);
         }
@@ -6170,6 +7673,13 @@ namespace validation_layer
         auto driver_result = pfnSetSecurityVersionExp( hFirmware );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesFirmwareSetSecurityVersionExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesFirmwareSetSecurityVersionExp", [=]() { handler->zesFirmwareSetSecurityVersionExpEpilogue( hFirmware ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesFirmwareSetSecurityVersionExpEpilogue( hFirmware ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesFirmwareSetSecurityVersionExp", result);
         }
@@ -6201,7 +7711,10 @@ namespace validation_layer
             return logAndPropagateResult("zesDeviceGetSubDevicePropertiesExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceGetSubDevicePropertiesExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceGetSubDevicePropertiesExpPrologue( hDevice, pCount, pSubdeviceProps );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceGetSubDevicePropertiesExp", result);
         }
@@ -6213,6 +7726,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesDeviceGetSubDevicePropertiesExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceGetSubDevicePropertiesExpPrologue( hDevice, pCount, pSubdeviceProps );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceGetSubDevicePropertiesExp", result);
         }
@@ -6220,6 +7734,13 @@ namespace validation_layer
         auto driver_result = pfnGetSubDevicePropertiesExp( hDevice, pCount, pSubdeviceProps );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceGetSubDevicePropertiesExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesDeviceGetSubDevicePropertiesExp", [=]() { handler->zesDeviceGetSubDevicePropertiesExpEpilogue( hDevice, pCount, pSubdeviceProps ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceGetSubDevicePropertiesExpEpilogue( hDevice, pCount, pSubdeviceProps ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceGetSubDevicePropertiesExp", result);
         }
@@ -6251,7 +7772,10 @@ namespace validation_layer
             return logAndPropagateResult("zesDriverGetDeviceByUuidExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDriverGetDeviceByUuidExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesDriverGetDeviceByUuidExpPrologue( hDriver, uuid, phDevice, onSubdevice, subdeviceId );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDriverGetDeviceByUuidExp", result);
         }
@@ -6263,6 +7787,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesDriverGetDeviceByUuidExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesDriverGetDeviceByUuidExpPrologue( hDriver, uuid, phDevice, onSubdevice, subdeviceId );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDriverGetDeviceByUuidExp", result);
         }
@@ -6270,6 +7795,13 @@ namespace validation_layer
         auto driver_result = pfnGetDeviceByUuidExp( hDriver, uuid, phDevice, onSubdevice, subdeviceId );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDriverGetDeviceByUuidExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesDriverGetDeviceByUuidExp", [=]() { handler->zesDriverGetDeviceByUuidExpEpilogue( hDriver, uuid, phDevice, onSubdevice, subdeviceId ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesDriverGetDeviceByUuidExpEpilogue( hDriver, uuid, phDevice, onSubdevice, subdeviceId ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDriverGetDeviceByUuidExp", result);
         }
@@ -6312,7 +7844,10 @@ namespace validation_layer
             return logAndPropagateResult("zesDeviceEnumActiveVFExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceEnumActiveVFExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumActiveVFExpPrologue( hDevice, pCount, phVFhandle );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEnumActiveVFExp", result);
         }
@@ -6324,6 +7859,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesDeviceEnumActiveVFExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumActiveVFExpPrologue( hDevice, pCount, phVFhandle );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEnumActiveVFExp", result);
         }
@@ -6331,6 +7867,13 @@ namespace validation_layer
         auto driver_result = pfnEnumActiveVFExp( hDevice, pCount, phVFhandle );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceEnumActiveVFExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesDeviceEnumActiveVFExp", [=]() { handler->zesDeviceEnumActiveVFExpEpilogue( hDevice, pCount, phVFhandle ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumActiveVFExpEpilogue( hDevice, pCount, phVFhandle ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEnumActiveVFExp", result);
         }
@@ -6354,7 +7897,10 @@ namespace validation_layer
             return logAndPropagateResult("zesVFManagementGetVFPropertiesExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesVFManagementGetVFPropertiesExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesVFManagementGetVFPropertiesExpPrologue( hVFhandle, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesVFManagementGetVFPropertiesExp", result);
         }
@@ -6366,6 +7912,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesVFManagementGetVFPropertiesExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesVFManagementGetVFPropertiesExpPrologue( hVFhandle, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesVFManagementGetVFPropertiesExp", result);
         }
@@ -6373,6 +7920,13 @@ namespace validation_layer
         auto driver_result = pfnGetVFPropertiesExp( hVFhandle, pProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesVFManagementGetVFPropertiesExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesVFManagementGetVFPropertiesExp", [=]() { handler->zesVFManagementGetVFPropertiesExpEpilogue( hVFhandle, pProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesVFManagementGetVFPropertiesExpEpilogue( hVFhandle, pProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesVFManagementGetVFPropertiesExp", result);
         }
@@ -6412,7 +7966,10 @@ namespace validation_layer
             return logAndPropagateResult("zesVFManagementGetVFMemoryUtilizationExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesVFManagementGetVFMemoryUtilizationExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesVFManagementGetVFMemoryUtilizationExpPrologue( hVFhandle, pCount, pMemUtil );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesVFManagementGetVFMemoryUtilizationExp", result);
         }
@@ -6424,6 +7981,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesVFManagementGetVFMemoryUtilizationExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesVFManagementGetVFMemoryUtilizationExpPrologue( hVFhandle, pCount, pMemUtil );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesVFManagementGetVFMemoryUtilizationExp", result);
         }
@@ -6431,6 +7989,13 @@ namespace validation_layer
         auto driver_result = pfnGetVFMemoryUtilizationExp( hVFhandle, pCount, pMemUtil );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesVFManagementGetVFMemoryUtilizationExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesVFManagementGetVFMemoryUtilizationExp", [=]() { handler->zesVFManagementGetVFMemoryUtilizationExpEpilogue( hVFhandle, pCount, pMemUtil ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesVFManagementGetVFMemoryUtilizationExpEpilogue( hVFhandle, pCount, pMemUtil ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesVFManagementGetVFMemoryUtilizationExp", result);
         }
@@ -6470,7 +8035,10 @@ namespace validation_layer
             return logAndPropagateResult("zesVFManagementGetVFEngineUtilizationExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesVFManagementGetVFEngineUtilizationExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesVFManagementGetVFEngineUtilizationExpPrologue( hVFhandle, pCount, pEngineUtil );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesVFManagementGetVFEngineUtilizationExp", result);
         }
@@ -6482,6 +8050,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesVFManagementGetVFEngineUtilizationExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesVFManagementGetVFEngineUtilizationExpPrologue( hVFhandle, pCount, pEngineUtil );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesVFManagementGetVFEngineUtilizationExp", result);
         }
@@ -6489,6 +8058,13 @@ namespace validation_layer
         auto driver_result = pfnGetVFEngineUtilizationExp( hVFhandle, pCount, pEngineUtil );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesVFManagementGetVFEngineUtilizationExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesVFManagementGetVFEngineUtilizationExp", [=]() { handler->zesVFManagementGetVFEngineUtilizationExpEpilogue( hVFhandle, pCount, pEngineUtil ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesVFManagementGetVFEngineUtilizationExpEpilogue( hVFhandle, pCount, pEngineUtil ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesVFManagementGetVFEngineUtilizationExp", result);
         }
@@ -6518,7 +8094,10 @@ namespace validation_layer
             return logAndPropagateResult("zesVFManagementSetVFTelemetryModeExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesVFManagementSetVFTelemetryModeExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesVFManagementSetVFTelemetryModeExpPrologue( hVFhandle, flags, enable );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesVFManagementSetVFTelemetryModeExp", result);
         }
@@ -6530,6 +8109,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesVFManagementSetVFTelemetryModeExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesVFManagementSetVFTelemetryModeExpPrologue( hVFhandle, flags, enable );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesVFManagementSetVFTelemetryModeExp", result);
         }
@@ -6537,6 +8117,13 @@ namespace validation_layer
         auto driver_result = pfnSetVFTelemetryModeExp( hVFhandle, flags, enable );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesVFManagementSetVFTelemetryModeExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesVFManagementSetVFTelemetryModeExp", [=]() { handler->zesVFManagementSetVFTelemetryModeExpEpilogue( hVFhandle, flags, enable ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesVFManagementSetVFTelemetryModeExpEpilogue( hVFhandle, flags, enable ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesVFManagementSetVFTelemetryModeExp", result);
         }
@@ -6562,7 +8149,10 @@ namespace validation_layer
             return logAndPropagateResult("zesVFManagementSetVFTelemetrySamplingIntervalExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesVFManagementSetVFTelemetrySamplingIntervalExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesVFManagementSetVFTelemetrySamplingIntervalExpPrologue( hVFhandle, flag, samplingInterval );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesVFManagementSetVFTelemetrySamplingIntervalExp", result);
         }
@@ -6574,6 +8164,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesVFManagementSetVFTelemetrySamplingIntervalExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesVFManagementSetVFTelemetrySamplingIntervalExpPrologue( hVFhandle, flag, samplingInterval );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesVFManagementSetVFTelemetrySamplingIntervalExp", result);
         }
@@ -6581,6 +8172,13 @@ namespace validation_layer
         auto driver_result = pfnSetVFTelemetrySamplingIntervalExp( hVFhandle, flag, samplingInterval );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesVFManagementSetVFTelemetrySamplingIntervalExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesVFManagementSetVFTelemetrySamplingIntervalExp", [=]() { handler->zesVFManagementSetVFTelemetrySamplingIntervalExpEpilogue( hVFhandle, flag, samplingInterval ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesVFManagementSetVFTelemetrySamplingIntervalExpEpilogue( hVFhandle, flag, samplingInterval ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesVFManagementSetVFTelemetrySamplingIntervalExp", result);
         }
@@ -6614,7 +8212,10 @@ namespace validation_layer
             return logAndPropagateResult("zesDeviceEnumEnabledVFExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceEnumEnabledVFExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumEnabledVFExpPrologue( hDevice, pCount, phVFhandle );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEnumEnabledVFExp", result);
         }
@@ -6626,6 +8227,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesDeviceEnumEnabledVFExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumEnabledVFExpPrologue( hDevice, pCount, phVFhandle );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEnumEnabledVFExp", result);
         }
@@ -6633,6 +8235,13 @@ namespace validation_layer
         auto driver_result = pfnEnumEnabledVFExp( hDevice, pCount, phVFhandle );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesDeviceEnumEnabledVFExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesDeviceEnumEnabledVFExp", [=]() { handler->zesDeviceEnumEnabledVFExpEpilogue( hDevice, pCount, phVFhandle ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesDeviceEnumEnabledVFExpEpilogue( hDevice, pCount, phVFhandle ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesDeviceEnumEnabledVFExp", result);
         }
@@ -6656,7 +8265,10 @@ namespace validation_layer
             return logAndPropagateResult("zesVFManagementGetVFCapabilitiesExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesVFManagementGetVFCapabilitiesExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesVFManagementGetVFCapabilitiesExpPrologue( hVFhandle, pCapability );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesVFManagementGetVFCapabilitiesExp", result);
         }
@@ -6668,6 +8280,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesVFManagementGetVFCapabilitiesExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesVFManagementGetVFCapabilitiesExpPrologue( hVFhandle, pCapability );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesVFManagementGetVFCapabilitiesExp", result);
         }
@@ -6675,6 +8288,13 @@ namespace validation_layer
         auto driver_result = pfnGetVFCapabilitiesExp( hVFhandle, pCapability );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesVFManagementGetVFCapabilitiesExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesVFManagementGetVFCapabilitiesExp", [=]() { handler->zesVFManagementGetVFCapabilitiesExpEpilogue( hVFhandle, pCapability ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesVFManagementGetVFCapabilitiesExpEpilogue( hVFhandle, pCapability ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesVFManagementGetVFCapabilitiesExp", result);
         }
@@ -6712,7 +8332,10 @@ namespace validation_layer
             return logAndPropagateResult("zesVFManagementGetVFMemoryUtilizationExp2", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesVFManagementGetVFMemoryUtilizationExp2", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesVFManagementGetVFMemoryUtilizationExp2Prologue( hVFhandle, pCount, pMemUtil );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesVFManagementGetVFMemoryUtilizationExp2", result);
         }
@@ -6724,6 +8347,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesVFManagementGetVFMemoryUtilizationExp2", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesVFManagementGetVFMemoryUtilizationExp2Prologue( hVFhandle, pCount, pMemUtil );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesVFManagementGetVFMemoryUtilizationExp2", result);
         }
@@ -6731,6 +8355,13 @@ namespace validation_layer
         auto driver_result = pfnGetVFMemoryUtilizationExp2( hVFhandle, pCount, pMemUtil );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesVFManagementGetVFMemoryUtilizationExp2", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesVFManagementGetVFMemoryUtilizationExp2", [=]() { handler->zesVFManagementGetVFMemoryUtilizationExp2Epilogue( hVFhandle, pCount, pMemUtil ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesVFManagementGetVFMemoryUtilizationExp2Epilogue( hVFhandle, pCount, pMemUtil ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesVFManagementGetVFMemoryUtilizationExp2", result);
         }
@@ -6764,7 +8395,10 @@ namespace validation_layer
             return logAndPropagateResult("zesVFManagementGetVFEngineUtilizationExp2", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesVFManagementGetVFEngineUtilizationExp2", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesVFManagementGetVFEngineUtilizationExp2Prologue( hVFhandle, pCount, pEngineUtil );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesVFManagementGetVFEngineUtilizationExp2", result);
         }
@@ -6776,6 +8410,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesVFManagementGetVFEngineUtilizationExp2", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesVFManagementGetVFEngineUtilizationExp2Prologue( hVFhandle, pCount, pEngineUtil );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesVFManagementGetVFEngineUtilizationExp2", result);
         }
@@ -6783,6 +8418,13 @@ namespace validation_layer
         auto driver_result = pfnGetVFEngineUtilizationExp2( hVFhandle, pCount, pEngineUtil );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesVFManagementGetVFEngineUtilizationExp2", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesVFManagementGetVFEngineUtilizationExp2", [=]() { handler->zesVFManagementGetVFEngineUtilizationExp2Epilogue( hVFhandle, pCount, pEngineUtil ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesVFManagementGetVFEngineUtilizationExp2Epilogue( hVFhandle, pCount, pEngineUtil ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesVFManagementGetVFEngineUtilizationExp2", result);
         }
@@ -6806,7 +8448,10 @@ namespace validation_layer
             return logAndPropagateResult("zesVFManagementGetVFCapabilitiesExp2", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesVFManagementGetVFCapabilitiesExp2", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zesValidation->zesVFManagementGetVFCapabilitiesExp2Prologue( hVFhandle, pCapability );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesVFManagementGetVFCapabilitiesExp2", result);
         }
@@ -6818,6 +8463,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zesVFManagementGetVFCapabilitiesExp2", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zesHandleLifetime.zesVFManagementGetVFCapabilitiesExp2Prologue( hVFhandle, pCapability );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesVFManagementGetVFCapabilitiesExp2", result);
         }
@@ -6825,6 +8471,13 @@ namespace validation_layer
         auto driver_result = pfnGetVFCapabilitiesExp2( hVFhandle, pCapability );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zesVFManagementGetVFCapabilitiesExp2", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zesValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zesVFManagementGetVFCapabilitiesExp2", [=]() { handler->zesVFManagementGetVFCapabilitiesExp2Epilogue( hVFhandle, pCapability ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zesValidation->zesVFManagementGetVFCapabilitiesExp2Epilogue( hVFhandle, pCapability ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zesVFManagementGetVFCapabilitiesExp2", result);
         }
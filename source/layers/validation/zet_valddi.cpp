@@ -14,8 +14,8 @@
 namespace validation_layer
 {
     static ze_result_t logAndPropagateResult(const char* fname, ze_result_t result) {
-        if (result != ZE_RESULT_SUCCESS) {
-            context.logger->log_trace("Error (" + loader::to_string(result) + ") in " + std::string(fname));
+        if (result != ZE_RESULT_SUCCESS && context.logger->should_log(spdlog::level::trace)) {
+            context.logger->log_trace("Error ({}) in {}", loader::to_string(result), fname);
         }
         return result;
     }
@@ -38,7 +38,10 @@ namespace validation_layer
             return logAndPropagateResult("zetModuleGetDebugInfo", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetModuleGetDebugInfo", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetModuleGetDebugInfoPrologue( hModule, format, pSize, pDebugInfo );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetModuleGetDebugInfo", result);
         }
@@ -50,6 +53,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetModuleGetDebugInfo", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetModuleGetDebugInfoPrologue( hModule, format, pSize, pDebugInfo );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetModuleGetDebugInfo", result);
         }
@@ -57,6 +61,13 @@ namespace validation_layer
         auto driver_result = pfnGetDebugInfo( hModule, format, pSize, pDebugInfo );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetModuleGetDebugInfo", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetModuleGetDebugInfo", [=]() { handler->zetModuleGetDebugInfoEpilogue( hModule, format, pSize, pDebugInfo ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetModuleGetDebugInfoEpilogue( hModule, format, pSize, pDebugInfo ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetModuleGetDebugInfo", result);
         }
@@ -80,7 +91,10 @@ namespace validation_layer
             return logAndPropagateResult("zetDeviceGetDebugProperties", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetDeviceGetDebugProperties", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetDeviceGetDebugPropertiesPrologue( hDevice, pDebugProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetDeviceGetDebugProperties", result);
         }
@@ -92,6 +106,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetDeviceGetDebugProperties", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetDeviceGetDebugPropertiesPrologue( hDevice, pDebugProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetDeviceGetDebugProperties", result);
         }
@@ -99,6 +114,13 @@ namespace validation_layer
         auto driver_result = pfnGetDebugProperties( hDevice, pDebugProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetDeviceGetDebugProperties", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetDeviceGetDebugProperties", [=]() { handler->zetDeviceGetDebugPropertiesEpilogue( hDevice, pDebugProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetDeviceGetDebugPropertiesEpilogue( hDevice, pDebugProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetDeviceGetDebugProperties", result);
         }
@@ -123,7 +145,10 @@ namespace validation_layer
             return logAndPropagateResult("zetDebugAttach", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetDebugAttach", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetDebugAttachPrologue( hDevice, config, phDebug );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetDebugAttach", result);
         }
@@ -135,6 +160,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetDebugAttach", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetDebugAttachPrologue( hDevice, config, phDebug );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetDebugAttach", result);
         }
@@ -142,6 +168,13 @@ namespace validation_layer
         auto driver_result = pfnAttach( hDevice, config, phDebug );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetDebugAttach", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetDebugAttach", [=]() { handler->zetDebugAttachEpilogue( hDevice, config, phDebug ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetDebugAttachEpilogue( hDevice, config, phDebug ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetDebugAttach", result);
         }
@@ -164,7 +197,10 @@ namespace validation_layer
             return logAndPropagateResult("zetDebugDetach", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetDebugDetach", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetDebugDetachPrologue( hDebug );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetDebugDetach", result);
         }
@@ -176,6 +212,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetDebugDetach", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetDebugDetachPrologue( hDebug );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetDebugDetach", result);
         }
@@ -183,6 +220,13 @@ namespace validation_layer
         auto driver_result = pfnDetach( hDebug );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetDebugDetach", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetDebugDetach", [=]() { handler->zetDebugDetachEpilogue( hDebug ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetDebugDetachEpilogue( hDebug ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetDebugDetach", result);
         }
@@ -213,7 +257,10 @@ namespace validation_layer
             return logAndPropagateResult("zetDebugReadEvent", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetDebugReadEvent", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetDebugReadEventPrologue( hDebug, timeout, event );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetDebugReadEvent", result);
         }
@@ -225,6 +272,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetDebugReadEvent", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetDebugReadEventPrologue( hDebug, timeout, event );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetDebugReadEvent", result);
         }
@@ -232,6 +280,13 @@ namespace validation_layer
         auto driver_result = pfnReadEvent( hDebug, timeout, event );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetDebugReadEvent", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetDebugReadEvent", [=]() { handler->zetDebugReadEventEpilogue( hDebug, timeout, event ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetDebugReadEventEpilogue( hDebug, timeout, event ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetDebugReadEvent", result);
         }
@@ -255,7 +310,10 @@ namespace validation_layer
             return logAndPropagateResult("zetDebugAcknowledgeEvent", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetDebugAcknowledgeEvent", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetDebugAcknowledgeEventPrologue( hDebug, event );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetDebugAcknowledgeEvent", result);
         }
@@ -267,6 +325,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetDebugAcknowledgeEvent", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetDebugAcknowledgeEventPrologue( hDebug, event );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetDebugAcknowledgeEvent", result);
         }
@@ -274,6 +333,13 @@ namespace validation_layer
         auto driver_result = pfnAcknowledgeEvent( hDebug, event );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetDebugAcknowledgeEvent", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetDebugAcknowledgeEvent", [=]() { handler->zetDebugAcknowledgeEventEpilogue( hDebug, event ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetDebugAcknowledgeEventEpilogue( hDebug, event ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetDebugAcknowledgeEvent", result);
         }
@@ -297,7 +363,10 @@ namespace validation_layer
             return logAndPropagateResult("zetDebugInterrupt", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetDebugInterrupt", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetDebugInterruptPrologue( hDebug, thread );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetDebugInterrupt", result);
         }
@@ -309,6 +378,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetDebugInterrupt", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetDebugInterruptPrologue( hDebug, thread );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetDebugInterrupt", result);
         }
@@ -316,6 +386,13 @@ namespace validation_layer
         auto driver_result = pfnInterrupt( hDebug, thread );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetDebugInterrupt", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetDebugInterrupt", [=]() { handler->zetDebugInterruptEpilogue( hDebug, thread ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetDebugInterruptEpilogue( hDebug, thread ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetDebugInterrupt", result);
         }
@@ -339,7 +416,10 @@ namespace validation_layer
             return logAndPropagateResult("zetDebugResume", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetDebugResume", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetDebugResumePrologue( hDebug, thread );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetDebugResume", result);
         }
@@ -351,6 +431,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetDebugResume", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetDebugResumePrologue( hDebug, thread );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetDebugResume", result);
         }
@@ -358,6 +439,13 @@ namespace validation_layer
         auto driver_result = pfnResume( hDebug, thread );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetDebugResume", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetDebugResume", [=]() { handler->zetDebugResumeEpilogue( hDebug, thread ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetDebugResumeEpilogue( hDebug, thread ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetDebugResume", result);
         }
@@ -384,7 +472,10 @@ namespace validation_layer
             return logAndPropagateResult("zetDebugReadMemory", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetDebugReadMemory", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetDebugReadMemoryPrologue( hDebug, thread, desc, size, buffer );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetDebugReadMemory", result);
         }
@@ -396,6 +487,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetDebugReadMemory", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetDebugReadMemoryPrologue( hDebug, thread, desc, size, buffer );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetDebugReadMemory", result);
         }
@@ -403,6 +495,13 @@ namespace validation_layer
         auto driver_result = pfnReadMemory( hDebug, thread, desc, size, buffer );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetDebugReadMemory", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetDebugReadMemory", [=]() { handler->zetDebugReadMemoryEpilogue( hDebug, thread, desc, size, buffer ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetDebugReadMemoryEpilogue( hDebug, thread, desc, size, buffer ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetDebugReadMemory", result);
         }
@@ -429,7 +528,10 @@ namespace validation_layer
             return logAndPropagateResult("zetDebugWriteMemory", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetDebugWriteMemory", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetDebugWriteMemoryPrologue( hDebug, thread, desc, size, buffer );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetDebugWriteMemory", result);
         }
@@ -441,6 +543,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetDebugWriteMemory", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetDebugWriteMemoryPrologue( hDebug, thread, desc, size, buffer );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetDebugWriteMemory", result);
         }
@@ -448,6 +551,13 @@ namespace validation_layer
         auto driver_result = pfnWriteMemory( hDebug, thread, desc, size, buffer );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetDebugWriteMemory", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetDebugWriteMemory", [=]() { handler->zetDebugWriteMemoryEpilogue( hDebug, thread, desc, size, buffer ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetDebugWriteMemoryEpilogue( hDebug, thread, desc, size, buffer ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetDebugWriteMemory", result);
         }
@@ -480,7 +590,10 @@ namespace validation_layer
             return logAndPropagateResult("zetDebugGetRegisterSetProperties", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetDebugGetRegisterSetProperties", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetDebugGetRegisterSetPropertiesPrologue( hDevice, pCount, pRegisterSetProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetDebugGetRegisterSetProperties", result);
         }
@@ -492,6 +605,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetDebugGetRegisterSetProperties", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetDebugGetRegisterSetPropertiesPrologue( hDevice, pCount, pRegisterSetProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetDebugGetRegisterSetProperties", result);
         }
@@ -499,6 +613,13 @@ namespace validation_layer
         auto driver_result = pfnGetRegisterSetProperties( hDevice, pCount, pRegisterSetProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetDebugGetRegisterSetProperties", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetDebugGetRegisterSetProperties", [=]() { handler->zetDebugGetRegisterSetPropertiesEpilogue( hDevice, pCount, pRegisterSetProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetDebugGetRegisterSetPropertiesEpilogue( hDevice, pCount, pRegisterSetProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetDebugGetRegisterSetProperties", result);
         }
@@ -532,7 +653,10 @@ namespace validation_layer
             return logAndPropagateResult("zetDebugGetThreadRegisterSetProperties", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetDebugGetThreadRegisterSetProperties", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetDebugGetThreadRegisterSetPropertiesPrologue( hDebug, thread, pCount, pRegisterSetProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetDebugGetThreadRegisterSetProperties", result);
         }
@@ -544,6 +668,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetDebugGetThreadRegisterSetProperties", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetDebugGetThreadRegisterSetPropertiesPrologue( hDebug, thread, pCount, pRegisterSetProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetDebugGetThreadRegisterSetProperties", result);
         }
@@ -551,6 +676,13 @@ namespace validation_layer
         auto driver_result = pfnGetThreadRegisterSetProperties( hDebug, thread, pCount, pRegisterSetProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetDebugGetThreadRegisterSetProperties", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetDebugGetThreadRegisterSetProperties", [=]() { handler->zetDebugGetThreadRegisterSetPropertiesEpilogue( hDebug, thread, pCount, pRegisterSetProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetDebugGetThreadRegisterSetPropertiesEpilogue( hDebug, thread, pCount, pRegisterSetProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetDebugGetThreadRegisterSetProperties", result);
         }
@@ -582,7 +714,10 @@ namespace validation_layer
             return logAndPropagateResult("zetDebugReadRegisters", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetDebugReadRegisters", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetDebugReadRegistersPrologue( hDebug, thread, type, start, count, pRegisterValues );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetDebugReadRegisters", result);
         }
@@ -594,6 +729,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetDebugReadRegisters", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetDebugReadRegistersPrologue( hDebug, thread, type, start, count, pRegisterValues );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetDebugReadRegisters", result);
         }
@@ -601,6 +737,13 @@ namespace validation_layer
         auto driver_result = pfnReadRegisters( hDebug, thread, type, start, count, pRegisterValues );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetDebugReadRegisters", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetDebugReadRegisters", [=]() { handler->zetDebugReadRegistersEpilogue( hDebug, thread, type, start, count, pRegisterValues ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetDebugReadRegistersEpilogue( hDebug, thread, type, start, count, pRegisterValues ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetDebugReadRegisters", result);
         }
@@ -632,7 +775,10 @@ namespace validation_layer
             return logAndPropagateResult("zetDebugWriteRegisters", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetDebugWriteRegisters", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetDebugWriteRegistersPrologue( hDebug, thread, type, start, count, pRegisterValues );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetDebugWriteRegisters", result);
         }
@@ -644,6 +790,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetDebugWriteRegisters", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetDebugWriteRegistersPrologue( hDebug, thread, type, start, count, pRegisterValues );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetDebugWriteRegisters", result);
         }
@@ -651,6 +798,13 @@ namespace validation_layer
         auto driver_result = pfnWriteRegisters( hDebug, thread, type, start, count, pRegisterValues );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetDebugWriteRegisters", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetDebugWriteRegisters", [=]() { handler->zetDebugWriteRegistersEpilogue( hDebug, thread, type, start, count, pRegisterValues ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetDebugWriteRegistersEpilogue( hDebug, thread, type, start, count, pRegisterValues ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetDebugWriteRegisters", result);
         }
@@ -682,7 +836,10 @@ namespace validation_layer
             return logAndPropagateResult("zetMetricGroupGet", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricGroupGet", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupGetPrologue( hDevice, pCount, phMetricGroups );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricGroupGet", result);
         }
@@ -694,6 +851,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetMetricGroupGet", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricGroupGetPrologue( hDevice, pCount, phMetricGroups );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricGroupGet", result);
         }
@@ -701,6 +859,13 @@ namespace validation_layer
         auto driver_result = pfnGet( hDevice, pCount, phMetricGroups );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricGroupGet", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetMetricGroupGet", [=]() { handler->zetMetricGroupGetEpilogue( hDevice, pCount, phMetricGroups ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupGetEpilogue( hDevice, pCount, phMetricGroups ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricGroupGet", result);
         }
@@ -734,7 +899,10 @@ namespace validation_layer
             return logAndPropagateResult("zetMetricGroupGetProperties", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricGroupGetProperties", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupGetPropertiesPrologue( hMetricGroup, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricGroupGetProperties", result);
         }
@@ -746,6 +914,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetMetricGroupGetProperties", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricGroupGetPropertiesPrologue( hMetricGroup, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricGroupGetProperties", result);
         }
@@ -753,6 +922,13 @@ namespace validation_layer
         auto driver_result = pfnGetProperties( hMetricGroup, pProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricGroupGetProperties", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetMetricGroupGetProperties", [=]() { handler->zetMetricGroupGetPropertiesEpilogue( hMetricGroup, pProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupGetPropertiesEpilogue( hMetricGroup, pProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricGroupGetProperties", result);
         }
@@ -787,7 +963,10 @@ namespace validation_layer
             return logAndPropagateResult("zetMetricGroupCalculateMetricValues", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricGroupCalculateMetricValues", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupCalculateMetricValuesPrologue( hMetricGroup, type, rawDataSize, pRawData, pMetricValueCount, pMetricValues );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricGroupCalculateMetricValues", result);
         }
@@ -799,6 +978,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetMetricGroupCalculateMetricValues", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricGroupCalculateMetricValuesPrologue( hMetricGroup, type, rawDataSize, pRawData, pMetricValueCount, pMetricValues );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricGroupCalculateMetricValues", result);
         }
@@ -806,6 +986,13 @@ namespace validation_layer
         auto driver_result = pfnCalculateMetricValues( hMetricGroup, type, rawDataSize, pRawData, pMetricValueCount, pMetricValues );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricGroupCalculateMetricValues", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetMetricGroupCalculateMetricValues", [=]() { handler->zetMetricGroupCalculateMetricValuesEpilogue( hMetricGroup, type, rawDataSize, pRawData, pMetricValueCount, pMetricValues ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupCalculateMetricValuesEpilogue( hMetricGroup, type, rawDataSize, pRawData, pMetricValueCount, pMetricValues ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricGroupCalculateMetricValues", result);
         }
@@ -836,7 +1023,10 @@ namespace validation_layer
             return logAndPropagateResult("zetMetricGet", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricGet", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetMetricGetPrologue( hMetricGroup, pCount, phMetrics );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricGet", result);
         }
@@ -848,6 +1038,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetMetricGet", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricGetPrologue( hMetricGroup, pCount, phMetrics );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricGet", result);
         }
@@ -855,6 +1046,13 @@ namespace validation_layer
         auto driver_result = pfnGet( hMetricGroup, pCount, phMetrics );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricGet", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetMetricGet", [=]() { handler->zetMetricGetEpilogue( hMetricGroup, pCount, phMetrics ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetMetricGetEpilogue( hMetricGroup, pCount, phMetrics ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricGet", result);
         }
@@ -888,7 +1086,10 @@ namespace validation_layer
             return logAndPropagateResult("zetMetricGetProperties", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricGetProperties", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetMetricGetPropertiesPrologue( hMetric, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricGetProperties", result);
         }
@@ -900,6 +1101,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetMetricGetProperties", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricGetPropertiesPrologue( hMetric, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricGetProperties", result);
         }
@@ -907,6 +1109,13 @@ namespace validation_layer
         auto driver_result = pfnGetProperties( hMetric, pProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricGetProperties", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetMetricGetProperties", [=]() { handler->zetMetricGetPropertiesEpilogue( hMetric, pProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetMetricGetPropertiesEpilogue( hMetric, pProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricGetProperties", result);
         }
@@ -936,7 +1145,10 @@ namespace validation_layer
             return logAndPropagateResult("zetContextActivateMetricGroups", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetContextActivateMetricGroups", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetContextActivateMetricGroupsPrologue( hContext, hDevice, count, phMetricGroups );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetContextActivateMetricGroups", result);
         }
@@ -948,6 +1160,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetContextActivateMetricGroups", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetContextActivateMetricGroupsPrologue( hContext, hDevice, count, phMetricGroups );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetContextActivateMetricGroups", result);
         }
@@ -955,6 +1168,13 @@ namespace validation_layer
         auto driver_result = pfnActivateMetricGroups( hContext, hDevice, count, phMetricGroups );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetContextActivateMetricGroups", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetContextActivateMetricGroups", [=]() { handler->zetContextActivateMetricGroupsEpilogue( hContext, hDevice, count, phMetricGroups ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetContextActivateMetricGroupsEpilogue( hContext, hDevice, count, phMetricGroups ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetContextActivateMetricGroups", result);
         }
@@ -982,7 +1202,10 @@ namespace validation_layer
             return logAndPropagateResult("zetMetricStreamerOpen", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricStreamerOpen", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetMetricStreamerOpenPrologue( hContext, hDevice, hMetricGroup, desc, hNotificationEvent, phMetricStreamer );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricStreamerOpen", result);
         }
@@ -994,6 +1217,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetMetricStreamerOpen", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricStreamerOpenPrologue( hContext, hDevice, hMetricGroup, desc, hNotificationEvent, phMetricStreamer );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricStreamerOpen", result);
         }
@@ -1001,6 +1225,13 @@ namespace validation_layer
         auto driver_result = pfnOpen( hContext, hDevice, hMetricGroup, desc, hNotificationEvent, phMetricStreamer );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricStreamerOpen", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetMetricStreamerOpen", [=]() { handler->zetMetricStreamerOpenEpilogue( hContext, hDevice, hMetricGroup, desc, hNotificationEvent, phMetricStreamer ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetMetricStreamerOpenEpilogue( hContext, hDevice, hMetricGroup, desc, hNotificationEvent, phMetricStreamer ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricStreamerOpen", result);
         }
@@ -1025,7 +1256,10 @@ namespace validation_layer
             return logAndPropagateResult("zetCommandListAppendMetricStreamerMarker", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetCommandListAppendMetricStreamerMarker", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetCommandListAppendMetricStreamerMarkerPrologue( hCommandList, hMetricStreamer, value );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetCommandListAppendMetricStreamerMarker", result);
         }
@@ -1037,6 +1271,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetCommandListAppendMetricStreamerMarker", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetCommandListAppendMetricStreamerMarkerPrologue( hCommandList, hMetricStreamer, value );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetCommandListAppendMetricStreamerMarker", result);
         }
@@ -1044,6 +1279,13 @@ namespace validation_layer
         auto driver_result = pfnAppendMetricStreamerMarker( hCommandList, hMetricStreamer, value );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetCommandListAppendMetricStreamerMarker", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetCommandListAppendMetricStreamerMarker", [=]() { handler->zetCommandListAppendMetricStreamerMarkerEpilogue( hCommandList, hMetricStreamer, value ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetCommandListAppendMetricStreamerMarkerEpilogue( hCommandList, hMetricStreamer, value ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetCommandListAppendMetricStreamerMarker", result);
         }
@@ -1066,7 +1308,10 @@ namespace validation_layer
             return logAndPropagateResult("zetMetricStreamerClose", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricStreamerClose", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetMetricStreamerClosePrologue( hMetricStreamer );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricStreamerClose", result);
         }
@@ -1078,6 +1323,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetMetricStreamerClose", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricStreamerClosePrologue( hMetricStreamer );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricStreamerClose", result);
         }
@@ -1085,6 +1331,13 @@ namespace validation_layer
         auto driver_result = pfnClose( hMetricStreamer );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricStreamerClose", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetMetricStreamerClose", [=]() { handler->zetMetricStreamerCloseEpilogue( hMetricStreamer ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetMetricStreamerCloseEpilogue( hMetricStreamer ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricStreamerClose", result);
         }
@@ -1118,7 +1371,10 @@ namespace validation_layer
             return logAndPropagateResult("zetMetricStreamerReadData", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricStreamerReadData", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetMetricStreamerReadDataPrologue( hMetricStreamer, maxReportCount, pRawDataSize, pRawData );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricStreamerReadData", result);
         }
@@ -1130,6 +1386,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetMetricStreamerReadData", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricStreamerReadDataPrologue( hMetricStreamer, maxReportCount, pRawDataSize, pRawData );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricStreamerReadData", result);
         }
@@ -1137,6 +1394,13 @@ namespace validation_layer
         auto driver_result = pfnReadData( hMetricStreamer, maxReportCount, pRawDataSize, pRawData );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricStreamerReadData", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetMetricStreamerReadData", [=]() { handler->zetMetricStreamerReadDataEpilogue( hMetricStreamer, maxReportCount, pRawDataSize, pRawData ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetMetricStreamerReadDataEpilogue( hMetricStreamer, maxReportCount, pRawDataSize, pRawData ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricStreamerReadData", result);
         }
@@ -1164,6 +1428,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricQueryPoolCreate", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetMetricQueryPoolCreatePrologue( hContext, hDevice, hMetricGroup, desc, phMetricQueryPool );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricQueryPoolCreate", result);
         }
@@ -1175,6 +1440,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetMetricQueryPoolCreate", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricQueryPoolCreatePrologue( hContext, hDevice, hMetricGroup, desc, phMetricQueryPool );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricQueryPoolCreate", result);
         }
@@ -1182,6 +1448,12 @@ namespace validation_layer
         auto driver_result = pfnCreate( hContext, hDevice, hMetricGroup, desc, phMetricQueryPool );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricQueryPoolCreate", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetMetricQueryPoolCreate", [=]() { handler->zetMetricQueryPoolCreateEpilogue( hContext, hDevice, hMetricGroup, desc, phMetricQueryPool ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetMetricQueryPoolCreateEpilogue( hContext, hDevice, hMetricGroup, desc, phMetricQueryPool ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricQueryPoolCreate", result);
         }
@@ -1214,6 +1486,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricQueryPoolDestroy", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetMetricQueryPoolDestroyPrologue( hMetricQueryPool );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricQueryPoolDestroy", result);
         }
@@ -1225,6 +1498,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetMetricQueryPoolDestroy", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricQueryPoolDestroyPrologue( hMetricQueryPool );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricQueryPoolDestroy", result);
         }
@@ -1232,6 +1506,12 @@ namespace validation_layer
         auto driver_result = pfnDestroy( hMetricQueryPool );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricQueryPoolDestroy", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetMetricQueryPoolDestroy", [=]() { handler->zetMetricQueryPoolDestroyEpilogue( hMetricQueryPool ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetMetricQueryPoolDestroyEpilogue( hMetricQueryPool ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricQueryPoolDestroy", result);
         }
@@ -1257,6 +1537,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricQueryCreate", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetMetricQueryCreatePrologue( hMetricQueryPool, index, phMetricQuery );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricQueryCreate", result);
         }
@@ -1268,6 +1549,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetMetricQueryCreate", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricQueryCreatePrologue( hMetricQueryPool, index, phMetricQuery );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricQueryCreate", result);
         }
@@ -1275,6 +1557,12 @@ namespace validation_layer
         auto driver_result = pfnCreate( hMetricQueryPool, index, phMetricQuery );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricQueryCreate", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetMetricQueryCreate", [=]() { handler->zetMetricQueryCreateEpilogue( hMetricQueryPool, index, phMetricQuery ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetMetricQueryCreateEpilogue( hMetricQueryPool, index, phMetricQuery ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricQueryCreate", result);
         }
@@ -1307,6 +1595,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricQueryDestroy", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetMetricQueryDestroyPrologue( hMetricQuery );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricQueryDestroy", result);
         }
@@ -1318,6 +1607,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetMetricQueryDestroy", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricQueryDestroyPrologue( hMetricQuery );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricQueryDestroy", result);
         }
@@ -1325,6 +1615,12 @@ namespace validation_layer
         auto driver_result = pfnDestroy( hMetricQuery );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricQueryDestroy", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetMetricQueryDestroy", [=]() { handler->zetMetricQueryDestroyEpilogue( hMetricQuery ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetMetricQueryDestroyEpilogue( hMetricQuery ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricQueryDestroy", result);
         }
@@ -1347,7 +1643,10 @@ namespace validation_layer
             return logAndPropagateResult("zetMetricQueryReset", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricQueryReset", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetMetricQueryResetPrologue( hMetricQuery );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricQueryReset", result);
         }
@@ -1359,6 +1658,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetMetricQueryReset", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricQueryResetPrologue( hMetricQuery );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricQueryReset", result);
         }
@@ -1366,6 +1666,13 @@ namespace validation_layer
         auto driver_result = pfnReset( hMetricQuery );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricQueryReset", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetMetricQueryReset", [=]() { handler->zetMetricQueryResetEpilogue( hMetricQuery ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetMetricQueryResetEpilogue( hMetricQuery ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricQueryReset", result);
         }
@@ -1389,7 +1696,10 @@ namespace validation_layer
             return logAndPropagateResult("zetCommandListAppendMetricQueryBegin", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetCommandListAppendMetricQueryBegin", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetCommandListAppendMetricQueryBeginPrologue( hCommandList, hMetricQuery );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetCommandListAppendMetricQueryBegin", result);
         }
@@ -1401,6 +1711,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetCommandListAppendMetricQueryBegin", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetCommandListAppendMetricQueryBeginPrologue( hCommandList, hMetricQuery );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetCommandListAppendMetricQueryBegin", result);
         }
@@ -1408,6 +1719,13 @@ namespace validation_layer
         auto driver_result = pfnAppendMetricQueryBegin( hCommandList, hMetricQuery );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetCommandListAppendMetricQueryBegin", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetCommandListAppendMetricQueryBegin", [=]() { handler->zetCommandListAppendMetricQueryBeginEpilogue( hCommandList, hMetricQuery ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetCommandListAppendMetricQueryBeginEpilogue( hCommandList, hMetricQuery ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetCommandListAppendMetricQueryBegin", result);
         }
@@ -1434,7 +1752,10 @@ namespace validation_layer
             return logAndPropagateResult("zetCommandListAppendMetricQueryEnd", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetCommandListAppendMetricQueryEnd", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetCommandListAppendMetricQueryEndPrologue( hCommandList, hMetricQuery, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetCommandListAppendMetricQueryEnd", result);
         }
@@ -1446,6 +1767,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetCommandListAppendMetricQueryEnd", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetCommandListAppendMetricQueryEndPrologue( hCommandList, hMetricQuery, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetCommandListAppendMetricQueryEnd", result);
         }
@@ -1453,6 +1775,13 @@ namespace validation_layer
         auto driver_result = pfnAppendMetricQueryEnd( hCommandList, hMetricQuery, hSignalEvent, numWaitEvents, phWaitEvents );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetCommandListAppendMetricQueryEnd", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetCommandListAppendMetricQueryEnd", [=]() { handler->zetCommandListAppendMetricQueryEndEpilogue( hCommandList, hMetricQuery, hSignalEvent, numWaitEvents, phWaitEvents ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetCommandListAppendMetricQueryEndEpilogue( hCommandList, hMetricQuery, hSignalEvent, numWaitEvents, phWaitEvents ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetCommandListAppendMetricQueryEnd", result);
         }
@@ -1475,7 +1804,10 @@ namespace validation_layer
             return logAndPropagateResult("zetCommandListAppendMetricMemoryBarrier", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetCommandListAppendMetricMemoryBarrier", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetCommandListAppendMetricMemoryBarrierPrologue( hCommandList );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetCommandListAppendMetricMemoryBarrier", result);
         }
@@ -1487,6 +1819,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetCommandListAppendMetricMemoryBarrier", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetCommandListAppendMetricMemoryBarrierPrologue( hCommandList );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetCommandListAppendMetricMemoryBarrier", result);
         }
@@ -1494,6 +1827,13 @@ namespace validation_layer
         auto driver_result = pfnAppendMetricMemoryBarrier( hCommandList );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetCommandListAppendMetricMemoryBarrier", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetCommandListAppendMetricMemoryBarrier", [=]() { handler->zetCommandListAppendMetricMemoryBarrierEpilogue( hCommandList ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetCommandListAppendMetricMemoryBarrierEpilogue( hCommandList ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetCommandListAppendMetricMemoryBarrier", result);
         }
@@ -1525,7 +1865,10 @@ namespace validation_layer
             return logAndPropagateResult("zetMetricQueryGetData", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricQueryGetData", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetMetricQueryGetDataPrologue( hMetricQuery, pRawDataSize, pRawData );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricQueryGetData", result);
         }
@@ -1537,6 +1880,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetMetricQueryGetData", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricQueryGetDataPrologue( hMetricQuery, pRawDataSize, pRawData );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricQueryGetData", result);
         }
@@ -1544,6 +1888,13 @@ namespace validation_layer
         auto driver_result = pfnGetData( hMetricQuery, pRawDataSize, pRawData );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricQueryGetData", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetMetricQueryGetData", [=]() { handler->zetMetricQueryGetDataEpilogue( hMetricQuery, pRawDataSize, pRawData ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetMetricQueryGetDataEpilogue( hMetricQuery, pRawDataSize, pRawData ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricQueryGetData", result);
         }
@@ -1567,7 +1918,10 @@ namespace validation_layer
             return logAndPropagateResult("zetKernelGetProfileInfo", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetKernelGetProfileInfo", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetKernelGetProfileInfoPrologue( hKernel, pProfileProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetKernelGetProfileInfo", result);
         }
@@ -1579,6 +1933,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetKernelGetProfileInfo", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetKernelGetProfileInfoPrologue( hKernel, pProfileProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetKernelGetProfileInfo", result);
         }
@@ -1586,6 +1941,13 @@ namespace validation_layer
         auto driver_result = pfnGetProfileInfo( hKernel, pProfileProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetKernelGetProfileInfo", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetKernelGetProfileInfo", [=]() { handler->zetKernelGetProfileInfoEpilogue( hKernel, pProfileProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetKernelGetProfileInfoEpilogue( hKernel, pProfileProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetKernelGetProfileInfo", result);
         }
@@ -1611,6 +1973,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetTracerExpCreate", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetTracerExpCreatePrologue( hContext, desc, phTracer );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetTracerExpCreate", result);
         }
@@ -1622,6 +1985,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetTracerExpCreate", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetTracerExpCreatePrologue( hContext, desc, phTracer );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetTracerExpCreate", result);
         }
@@ -1629,6 +1993,12 @@ namespace validation_layer
         auto driver_result = pfnCreate( hContext, desc, phTracer );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetTracerExpCreate", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetTracerExpCreate", [=]() { handler->zetTracerExpCreateEpilogue( hContext, desc, phTracer ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetTracerExpCreateEpilogue( hContext, desc, phTracer ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetTracerExpCreate", result);
         }
@@ -1661,6 +2031,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetTracerExpDestroy", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetTracerExpDestroyPrologue( hTracer );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetTracerExpDestroy", result);
         }
@@ -1672,6 +2043,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetTracerExpDestroy", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetTracerExpDestroyPrologue( hTracer );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetTracerExpDestroy", result);
         }
@@ -1679,6 +2051,12 @@ namespace validation_layer
         auto driver_result = pfnDestroy( hTracer );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetTracerExpDestroy", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetTracerExpDestroy", [=]() { handler->zetTracerExpDestroyEpilogue( hTracer ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetTracerExpDestroyEpilogue( hTracer ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetTracerExpDestroy", result);
         }
@@ -1702,7 +2080,10 @@ namespace validation_layer
             return logAndPropagateResult("zetTracerExpSetPrologues", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetTracerExpSetPrologues", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetTracerExpSetProloguesPrologue( hTracer, pCoreCbs );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetTracerExpSetPrologues", result);
         }
@@ -1714,6 +2095,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetTracerExpSetPrologues", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetTracerExpSetProloguesPrologue( hTracer, pCoreCbs );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetTracerExpSetPrologues", result);
         }
@@ -1721,6 +2103,13 @@ namespace validation_layer
         auto driver_result = pfnSetPrologues( hTracer, pCoreCbs );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetTracerExpSetPrologues", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetTracerExpSetPrologues", [=]() { handler->zetTracerExpSetProloguesEpilogue( hTracer, pCoreCbs ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetTracerExpSetProloguesEpilogue( hTracer, pCoreCbs ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetTracerExpSetPrologues", result);
         }
@@ -1744,7 +2133,10 @@ namespace validation_layer
             return logAndPropagateResult("zetTracerExpSetEpilogues", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetTracerExpSetEpilogues", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetTracerExpSetEpiloguesPrologue( hTracer, pCoreCbs );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetTracerExpSetEpilogues", result);
         }
@@ -1756,6 +2148,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetTracerExpSetEpilogues", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetTracerExpSetEpiloguesPrologue( hTracer, pCoreCbs );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetTracerExpSetEpilogues", result);
         }
@@ -1763,6 +2156,13 @@ namespace validation_layer
         auto driver_result = pfnSetEpilogues( hTracer, pCoreCbs );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetTracerExpSetEpilogues", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetTracerExpSetEpilogues", [=]() { handler->zetTracerExpSetEpiloguesEpilogue( hTracer, pCoreCbs ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetTracerExpSetEpiloguesEpilogue( hTracer, pCoreCbs ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetTracerExpSetEpilogues", result);
         }
@@ -1786,7 +2186,10 @@ namespace validation_layer
             return logAndPropagateResult("zetTracerExpSetEnabled", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetTracerExpSetEnabled", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetTracerExpSetEnabledPrologue( hTracer, enable );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetTracerExpSetEnabled", result);
         }
@@ -1798,6 +2201,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetTracerExpSetEnabled", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetTracerExpSetEnabledPrologue( hTracer, enable );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetTracerExpSetEnabled", result);
         }
@@ -1805,6 +2209,13 @@ namespace validation_layer
         auto driver_result = pfnSetEnabled( hTracer, enable );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetTracerExpSetEnabled", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetTracerExpSetEnabled", [=]() { handler->zetTracerExpSetEnabledEpilogue( hTracer, enable ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetTracerExpSetEnabledEpilogue( hTracer, enable ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetTracerExpSetEnabled", result);
         }
@@ -1835,7 +2246,10 @@ namespace validation_layer
             return logAndPropagateResult("zetDeviceGetConcurrentMetricGroupsExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetDeviceGetConcurrentMetricGroupsExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetDeviceGetConcurrentMetricGroupsExpPrologue( hDevice, metricGroupCount, phMetricGroups, pMetricGroupsCountPerConcurrentGroup, pConcurrentGroupCount );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetDeviceGetConcurrentMetricGroupsExp", result);
         }
@@ -1847,6 +2261,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetDeviceGetConcurrentMetricGroupsExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetDeviceGetConcurrentMetricGroupsExpPrologue( hDevice, metricGroupCount, phMetricGroups, pMetricGroupsCountPerConcurrentGroup, pConcurrentGroupCount );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetDeviceGetConcurrentMetricGroupsExp", result);
         }
@@ -1854,6 +2269,13 @@ namespace validation_layer
         auto driver_result = pfnGetConcurrentMetricGroupsExp( hDevice, metricGroupCount, phMetricGroups, pMetricGroupsCountPerConcurrentGroup, pConcurrentGroupCount );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetDeviceGetConcurrentMetricGroupsExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetDeviceGetConcurrentMetricGroupsExp", [=]() { handler->zetDeviceGetConcurrentMetricGroupsExpEpilogue( hDevice, metricGroupCount, phMetricGroups, pMetricGroupsCountPerConcurrentGroup, pConcurrentGroupCount ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetDeviceGetConcurrentMetricGroupsExpEpilogue( hDevice, metricGroupCount, phMetricGroups, pMetricGroupsCountPerConcurrentGroup, pConcurrentGroupCount ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetDeviceGetConcurrentMetricGroupsExp", result);
         }
@@ -1890,6 +2312,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricTracerCreateExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetMetricTracerCreateExpPrologue( hContext, hDevice, metricGroupCount, phMetricGroups, desc, hNotificationEvent, phMetricTracer );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricTracerCreateExp", result);
         }
@@ -1901,6 +2324,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetMetricTracerCreateExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricTracerCreateExpPrologue( hContext, hDevice, metricGroupCount, phMetricGroups, desc, hNotificationEvent, phMetricTracer );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricTracerCreateExp", result);
         }
@@ -1908,6 +2332,12 @@ namespace validation_layer
         auto driver_result = pfnCreateExp( hContext, hDevice, metricGroupCount, phMetricGroups, desc, hNotificationEvent, phMetricTracer );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricTracerCreateExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetMetricTracerCreateExp", [=]() { handler->zetMetricTracerCreateExpEpilogue( hContext, hDevice, metricGroupCount, phMetricGroups, desc, hNotificationEvent, phMetricTracer ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetMetricTracerCreateExpEpilogue( hContext, hDevice, metricGroupCount, phMetricGroups, desc, hNotificationEvent, phMetricTracer ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricTracerCreateExp", result);
         }
@@ -1940,6 +2370,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricTracerDestroyExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetMetricTracerDestroyExpPrologue( hMetricTracer );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricTracerDestroyExp", result);
         }
@@ -1951,6 +2382,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetMetricTracerDestroyExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricTracerDestroyExpPrologue( hMetricTracer );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricTracerDestroyExp", result);
         }
@@ -1958,6 +2390,12 @@ namespace validation_layer
         auto driver_result = pfnDestroyExp( hMetricTracer );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricTracerDestroyExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetMetricTracerDestroyExp", [=]() { handler->zetMetricTracerDestroyExpEpilogue( hMetricTracer ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetMetricTracerDestroyExpEpilogue( hMetricTracer ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricTracerDestroyExp", result);
         }
@@ -1985,7 +2423,10 @@ namespace validation_layer
             return logAndPropagateResult("zetMetricTracerEnableExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricTracerEnableExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetMetricTracerEnableExpPrologue( hMetricTracer, synchronous );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricTracerEnableExp", result);
         }
@@ -1997,6 +2438,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetMetricTracerEnableExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricTracerEnableExpPrologue( hMetricTracer, synchronous );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricTracerEnableExp", result);
         }
@@ -2004,6 +2446,13 @@ namespace validation_layer
         auto driver_result = pfnEnableExp( hMetricTracer, synchronous );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricTracerEnableExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetMetricTracerEnableExp", [=]() { handler->zetMetricTracerEnableExpEpilogue( hMetricTracer, synchronous ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetMetricTracerEnableExpEpilogue( hMetricTracer, synchronous ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricTracerEnableExp", result);
         }
@@ -2032,7 +2481,10 @@ namespace validation_layer
             return logAndPropagateResult("zetMetricTracerDisableExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricTracerDisableExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetMetricTracerDisableExpPrologue( hMetricTracer, synchronous );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricTracerDisableExp", result);
         }
@@ -2044,6 +2496,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetMetricTracerDisableExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricTracerDisableExpPrologue( hMetricTracer, synchronous );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricTracerDisableExp", result);
         }
@@ -2051,6 +2504,13 @@ namespace validation_layer
         auto driver_result = pfnDisableExp( hMetricTracer, synchronous );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricTracerDisableExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetMetricTracerDisableExp", [=]() { handler->zetMetricTracerDisableExpEpilogue( hMetricTracer, synchronous ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetMetricTracerDisableExpEpilogue( hMetricTracer, synchronous ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricTracerDisableExp", result);
         }
@@ -2082,7 +2542,10 @@ namespace validation_layer
             return logAndPropagateResult("zetMetricTracerReadDataExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricTracerReadDataExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetMetricTracerReadDataExpPrologue( hMetricTracer, pRawDataSize, pRawData );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricTracerReadDataExp", result);
         }
@@ -2094,6 +2557,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetMetricTracerReadDataExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricTracerReadDataExpPrologue( hMetricTracer, pRawDataSize, pRawData );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricTracerReadDataExp", result);
         }
@@ -2101,6 +2565,13 @@ namespace validation_layer
         auto driver_result = pfnReadDataExp( hMetricTracer, pRawDataSize, pRawData );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricTracerReadDataExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetMetricTracerReadDataExp", [=]() { handler->zetMetricTracerReadDataExpEpilogue( hMetricTracer, pRawDataSize, pRawData ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetMetricTracerReadDataExpEpilogue( hMetricTracer, pRawDataSize, pRawData ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricTracerReadDataExp", result);
         }
@@ -2125,6 +2596,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricDecoderCreateExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetMetricDecoderCreateExpPrologue( hMetricTracer, phMetricDecoder );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricDecoderCreateExp", result);
         }
@@ -2136,6 +2608,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetMetricDecoderCreateExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricDecoderCreateExpPrologue( hMetricTracer, phMetricDecoder );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricDecoderCreateExp", result);
         }
@@ -2143,6 +2616,12 @@ namespace validation_layer
         auto driver_result = pfnCreateExp( hMetricTracer, phMetricDecoder );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricDecoderCreateExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetMetricDecoderCreateExp", [=]() { handler->zetMetricDecoderCreateExpEpilogue( hMetricTracer, phMetricDecoder ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetMetricDecoderCreateExpEpilogue( hMetricTracer, phMetricDecoder ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricDecoderCreateExp", result);
         }
@@ -2175,6 +2654,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricDecoderDestroyExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetMetricDecoderDestroyExpPrologue( phMetricDecoder );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricDecoderDestroyExp", result);
         }
@@ -2186,6 +2666,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetMetricDecoderDestroyExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricDecoderDestroyExpPrologue( phMetricDecoder );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricDecoderDestroyExp", result);
         }
@@ -2193,6 +2674,12 @@ namespace validation_layer
         auto driver_result = pfnDestroyExp( phMetricDecoder );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricDecoderDestroyExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetMetricDecoderDestroyExp", [=]() { handler->zetMetricDecoderDestroyExpEpilogue( phMetricDecoder ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetMetricDecoderDestroyExpEpilogue( phMetricDecoder ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricDecoderDestroyExp", result);
         }
@@ -2226,7 +2713,10 @@ namespace validation_layer
             return logAndPropagateResult("zetMetricDecoderGetDecodableMetricsExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricDecoderGetDecodableMetricsExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetMetricDecoderGetDecodableMetricsExpPrologue( hMetricDecoder, pCount, phMetrics );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricDecoderGetDecodableMetricsExp", result);
         }
@@ -2238,6 +2728,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetMetricDecoderGetDecodableMetricsExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricDecoderGetDecodableMetricsExpPrologue( hMetricDecoder, pCount, phMetrics );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricDecoderGetDecodableMetricsExp", result);
         }
@@ -2245,6 +2736,13 @@ namespace validation_layer
         auto driver_result = pfnGetDecodableMetricsExp( hMetricDecoder, pCount, phMetrics );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricDecoderGetDecodableMetricsExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetMetricDecoderGetDecodableMetricsExp", [=]() { handler->zetMetricDecoderGetDecodableMetricsExpEpilogue( hMetricDecoder, pCount, phMetrics ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetMetricDecoderGetDecodableMetricsExpEpilogue( hMetricDecoder, pCount, phMetrics ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricDecoderGetDecodableMetricsExp", result);
         }
@@ -2316,7 +2814,10 @@ namespace validation_layer
             return logAndPropagateResult("zetMetricTracerDecodeExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricTracerDecodeExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetMetricTracerDecodeExpPrologue( phMetricDecoder, pRawDataSize, pRawData, metricsCount, phMetrics, pSetCount, pMetricEntriesCountPerSet, pMetricEntriesCount, pMetricEntries );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricTracerDecodeExp", result);
         }
@@ -2328,6 +2829,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetMetricTracerDecodeExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricTracerDecodeExpPrologue( phMetricDecoder, pRawDataSize, pRawData, metricsCount, phMetrics, pSetCount, pMetricEntriesCountPerSet, pMetricEntriesCount, pMetricEntries );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricTracerDecodeExp", result);
         }
@@ -2335,6 +2837,13 @@ namespace validation_layer
         auto driver_result = pfnDecodeExp( phMetricDecoder, pRawDataSize, pRawData, metricsCount, phMetrics, pSetCount, pMetricEntriesCountPerSet, pMetricEntriesCount, pMetricEntries );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricTracerDecodeExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetMetricTracerDecodeExp", [=]() { handler->zetMetricTracerDecodeExpEpilogue( phMetricDecoder, pRawDataSize, pRawData, metricsCount, phMetrics, pSetCount, pMetricEntriesCountPerSet, pMetricEntriesCount, pMetricEntries ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetMetricTracerDecodeExpEpilogue( phMetricDecoder, pRawDataSize, pRawData, metricsCount, phMetrics, pSetCount, pMetricEntriesCountPerSet, pMetricEntriesCount, pMetricEntries ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricTracerDecodeExp", result);
         }
@@ -2361,7 +2870,10 @@ namespace validation_layer
             return logAndPropagateResult("zetCommandListAppendMarkerExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetCommandListAppendMarkerExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetCommandListAppendMarkerExpPrologue( hCommandList, hMetricGroup, value );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetCommandListAppendMarkerExp", result);
         }
@@ -2373,6 +2885,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetCommandListAppendMarkerExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetCommandListAppendMarkerExpPrologue( hCommandList, hMetricGroup, value );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetCommandListAppendMarkerExp", result);
         }
@@ -2380,6 +2893,13 @@ namespace validation_layer
         auto driver_result = pfnAppendMarkerExp( hCommandList, hMetricGroup, value );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetCommandListAppendMarkerExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetCommandListAppendMarkerExp", [=]() { handler->zetCommandListAppendMarkerExpEpilogue( hCommandList, hMetricGroup, value ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetCommandListAppendMarkerExpEpilogue( hCommandList, hMetricGroup, value ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetCommandListAppendMarkerExp", result);
         }
@@ -2402,7 +2922,10 @@ namespace validation_layer
             return logAndPropagateResult("zetDeviceEnableMetricsExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetDeviceEnableMetricsExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetDeviceEnableMetricsExpPrologue( hDevice );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetDeviceEnableMetricsExp", result);
         }
@@ -2414,6 +2937,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetDeviceEnableMetricsExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetDeviceEnableMetricsExpPrologue( hDevice );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetDeviceEnableMetricsExp", result);
         }
@@ -2421,6 +2945,13 @@ namespace validation_layer
         auto driver_result = pfnEnableMetricsExp( hDevice );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetDeviceEnableMetricsExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetDeviceEnableMetricsExp", [=]() { handler->zetDeviceEnableMetricsExpEpilogue( hDevice ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetDeviceEnableMetricsExpEpilogue( hDevice ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetDeviceEnableMetricsExp", result);
         }
@@ -2443,7 +2974,10 @@ namespace validation_layer
             return logAndPropagateResult("zetDeviceDisableMetricsExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetDeviceDisableMetricsExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetDeviceDisableMetricsExpPrologue( hDevice );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetDeviceDisableMetricsExp", result);
         }
@@ -2455,6 +2989,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetDeviceDisableMetricsExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetDeviceDisableMetricsExpPrologue( hDevice );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetDeviceDisableMetricsExp", result);
         }
@@ -2462,6 +2997,13 @@ namespace validation_layer
         auto driver_result = pfnDisableMetricsExp( hDevice );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetDeviceDisableMetricsExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetDeviceDisableMetricsExp", [=]() { handler->zetDeviceDisableMetricsExpEpilogue( hDevice ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetDeviceDisableMetricsExpEpilogue( hDevice ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetDeviceDisableMetricsExp", result);
         }
@@ -2506,7 +3048,10 @@ namespace validation_layer
             return logAndPropagateResult("zetMetricGroupCalculateMultipleMetricValuesExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricGroupCalculateMultipleMetricValuesExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupCalculateMultipleMetricValuesExpPrologue( hMetricGroup, type, rawDataSize, pRawData, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricGroupCalculateMultipleMetricValuesExp", result);
         }
@@ -2518,6 +3063,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetMetricGroupCalculateMultipleMetricValuesExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricGroupCalculateMultipleMetricValuesExpPrologue( hMetricGroup, type, rawDataSize, pRawData, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricGroupCalculateMultipleMetricValuesExp", result);
         }
@@ -2525,6 +3071,13 @@ namespace validation_layer
         auto driver_result = pfnCalculateMultipleMetricValuesExp( hMetricGroup, type, rawDataSize, pRawData, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricGroupCalculateMultipleMetricValuesExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetMetricGroupCalculateMultipleMetricValuesExp", [=]() { handler->zetMetricGroupCalculateMultipleMetricValuesExpEpilogue( hMetricGroup, type, rawDataSize, pRawData, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupCalculateMultipleMetricValuesExpEpilogue( hMetricGroup, type, rawDataSize, pRawData, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricGroupCalculateMultipleMetricValuesExp", result);
         }
@@ -2550,7 +3103,10 @@ namespace validation_layer
             return logAndPropagateResult("zetMetricGroupGetGlobalTimestampsExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricGroupGetGlobalTimestampsExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupGetGlobalTimestampsExpPrologue( hMetricGroup, synchronizedWithHost, globalTimestamp, metricTimestamp );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricGroupGetGlobalTimestampsExp", result);
         }
@@ -2562,6 +3118,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetMetricGroupGetGlobalTimestampsExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricGroupGetGlobalTimestampsExpPrologue( hMetricGroup, synchronizedWithHost, globalTimestamp, metricTimestamp );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricGroupGetGlobalTimestampsExp", result);
         }
@@ -2569,6 +3126,13 @@ namespace validation_layer
         auto driver_result = pfnGetGlobalTimestampsExp( hMetricGroup, synchronizedWithHost, globalTimestamp, metricTimestamp );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricGroupGetGlobalTimestampsExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetMetricGroupGetGlobalTimestampsExp", [=]() { handler->zetMetricGroupGetGlobalTimestampsExpEpilogue( hMetricGroup, synchronizedWithHost, globalTimestamp, metricTimestamp ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupGetGlobalTimestampsExpEpilogue( hMetricGroup, synchronizedWithHost, globalTimestamp, metricTimestamp ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricGroupGetGlobalTimestampsExp", result);
         }
@@ -2603,7 +3167,10 @@ namespace validation_layer
             return logAndPropagateResult("zetMetricGroupGetExportDataExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricGroupGetExportDataExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupGetExportDataExpPrologue( hMetricGroup, pRawData, rawDataSize, pExportDataSize, pExportData );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricGroupGetExportDataExp", result);
         }
@@ -2615,6 +3182,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetMetricGroupGetExportDataExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricGroupGetExportDataExpPrologue( hMetricGroup, pRawData, rawDataSize, pExportDataSize, pExportData );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricGroupGetExportDataExp", result);
         }
@@ -2622,6 +3190,13 @@ namespace validation_layer
         auto driver_result = pfnGetExportDataExp( hMetricGroup, pRawData, rawDataSize, pExportDataSize, pExportData );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricGroupGetExportDataExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetMetricGroupGetExportDataExp", [=]() { handler->zetMetricGroupGetExportDataExpEpilogue( hMetricGroup, pRawData, rawDataSize, pExportDataSize, pExportData ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupGetExportDataExpEpilogue( hMetricGroup, pRawData, rawDataSize, pExportDataSize, pExportData ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricGroupGetExportDataExp", result);
         }
@@ -2671,7 +3246,10 @@ namespace validation_layer
             return logAndPropagateResult("zetMetricGroupCalculateMetricExportDataExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricGroupCalculateMetricExportDataExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupCalculateMetricExportDataExpPrologue( hDriver, type, exportDataSize, pExportData, pCalculateDescriptor, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricGroupCalculateMetricExportDataExp", result);
         }
@@ -2683,6 +3261,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetMetricGroupCalculateMetricExportDataExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricGroupCalculateMetricExportDataExpPrologue( hDriver, type, exportDataSize, pExportData, pCalculateDescriptor, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricGroupCalculateMetricExportDataExp", result);
         }
@@ -2690,6 +3269,13 @@ namespace validation_layer
         auto driver_result = pfnCalculateMetricExportDataExp( hDriver, type, exportDataSize, pExportData, pCalculateDescriptor, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricGroupCalculateMetricExportDataExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetMetricGroupCalculateMetricExportDataExp", [=]() { handler->zetMetricGroupCalculateMetricExportDataExpEpilogue( hDriver, type, exportDataSize, pExportData, pCalculateDescriptor, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupCalculateMetricExportDataExpEpilogue( hDriver, type, exportDataSize, pExportData, pCalculateDescriptor, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricGroupCalculateMetricExportDataExp", result);
         }
@@ -2721,7 +3307,10 @@ namespace validation_layer
             return logAndPropagateResult("zetMetricProgrammableGetExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricProgrammableGetExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetMetricProgrammableGetExpPrologue( hDevice, pCount, phMetricProgrammables );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricProgrammableGetExp", result);
         }
@@ -2733,6 +3322,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetMetricProgrammableGetExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricProgrammableGetExpPrologue( hDevice, pCount, phMetricProgrammables );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricProgrammableGetExp", result);
         }
@@ -2740,6 +3330,13 @@ namespace validation_layer
         auto driver_result = pfnGetExp( hDevice, pCount, phMetricProgrammables );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricProgrammableGetExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetMetricProgrammableGetExp", [=]() { handler->zetMetricProgrammableGetExpEpilogue( hDevice, pCount, phMetricProgrammables ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetMetricProgrammableGetExpEpilogue( hDevice, pCount, phMetricProgrammables ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricProgrammableGetExp", result);
         }
@@ -2773,7 +3370,10 @@ namespace validation_layer
             return logAndPropagateResult("zetMetricProgrammableGetPropertiesExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricProgrammableGetPropertiesExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetMetricProgrammableGetPropertiesExpPrologue( hMetricProgrammable, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricProgrammableGetPropertiesExp", result);
         }
@@ -2785,6 +3385,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetMetricProgrammableGetPropertiesExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricProgrammableGetPropertiesExpPrologue( hMetricProgrammable, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricProgrammableGetPropertiesExp", result);
         }
@@ -2792,6 +3393,13 @@ namespace validation_layer
         auto driver_result = pfnGetPropertiesExp( hMetricProgrammable, pProperties );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricProgrammableGetPropertiesExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetMetricProgrammableGetPropertiesExp", [=]() { handler->zetMetricProgrammableGetPropertiesExpEpilogue( hMetricProgrammable, pProperties ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetMetricProgrammableGetPropertiesExpEpilogue( hMetricProgrammable, pProperties ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricProgrammableGetPropertiesExp", result);
         }
@@ -2826,7 +3434,10 @@ namespace validation_layer
             return logAndPropagateResult("zetMetricProgrammableGetParamInfoExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricProgrammableGetParamInfoExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetMetricProgrammableGetParamInfoExpPrologue( hMetricProgrammable, pParameterCount, pParameterInfo );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricProgrammableGetParamInfoExp", result);
         }
@@ -2838,6 +3449,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetMetricProgrammableGetParamInfoExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricProgrammableGetParamInfoExpPrologue( hMetricProgrammable, pParameterCount, pParameterInfo );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricProgrammableGetParamInfoExp", result);
         }
@@ -2845,6 +3457,13 @@ namespace validation_layer
         auto driver_result = pfnGetParamInfoExp( hMetricProgrammable, pParameterCount, pParameterInfo );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricProgrammableGetParamInfoExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetMetricProgrammableGetParamInfoExp", [=]() { handler->zetMetricProgrammableGetParamInfoExpEpilogue( hMetricProgrammable, pParameterCount, pParameterInfo ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetMetricProgrammableGetParamInfoExpEpilogue( hMetricProgrammable, pParameterCount, pParameterInfo ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricProgrammableGetParamInfoExp", result);
         }
@@ -2880,7 +3499,10 @@ namespace validation_layer
             return logAndPropagateResult("zetMetricProgrammableGetParamValueInfoExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricProgrammableGetParamValueInfoExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetMetricProgrammableGetParamValueInfoExpPrologue( hMetricProgrammable, parameterOrdinal, pValueInfoCount, pValueInfo );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricProgrammableGetParamValueInfoExp", result);
         }
@@ -2892,6 +3514,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetMetricProgrammableGetParamValueInfoExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricProgrammableGetParamValueInfoExpPrologue( hMetricProgrammable, parameterOrdinal, pValueInfoCount, pValueInfo );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricProgrammableGetParamValueInfoExp", result);
         }
@@ -2899,6 +3522,13 @@ namespace validation_layer
         auto driver_result = pfnGetParamValueInfoExp( hMetricProgrammable, parameterOrdinal, pValueInfoCount, pValueInfo );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricProgrammableGetParamValueInfoExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetMetricProgrammableGetParamValueInfoExp", [=]() { handler->zetMetricProgrammableGetParamValueInfoExpEpilogue( hMetricProgrammable, parameterOrdinal, pValueInfoCount, pValueInfo ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetMetricProgrammableGetParamValueInfoExpEpilogue( hMetricProgrammable, parameterOrdinal, pValueInfoCount, pValueInfo ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricProgrammableGetParamValueInfoExp", result);
         }
@@ -2942,6 +3572,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricCreateFromProgrammableExp2", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetMetricCreateFromProgrammableExp2Prologue( hMetricProgrammable, parameterCount, pParameterValues, pName, pDescription, pMetricHandleCount, phMetricHandles );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricCreateFromProgrammableExp2", result);
         }
@@ -2953,6 +3584,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetMetricCreateFromProgrammableExp2", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricCreateFromProgrammableExp2Prologue( hMetricProgrammable, parameterCount, pParameterValues, pName, pDescription, pMetricHandleCount, phMetricHandles );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricCreateFromProgrammableExp2", result);
         }
@@ -2960,6 +3592,12 @@ namespace validation_layer
         auto driver_result = pfnCreateFromProgrammableExp2( hMetricProgrammable, parameterCount, pParameterValues, pName, pDescription, pMetricHandleCount, phMetricHandles );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricCreateFromProgrammableExp2", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetMetricCreateFromProgrammableExp2", [=]() { handler->zetMetricCreateFromProgrammableExp2Epilogue( hMetricProgrammable, parameterCount, pParameterValues, pName, pDescription, pMetricHandleCount, phMetricHandles ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetMetricCreateFromProgrammableExp2Epilogue( hMetricProgrammable, parameterCount, pParameterValues, pName, pDescription, pMetricHandleCount, phMetricHandles ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricCreateFromProgrammableExp2", result);
         }
@@ -3009,6 +3647,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricCreateFromProgrammableExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetMetricCreateFromProgrammableExpPrologue( hMetricProgrammable, pParameterValues, parameterCount, pName, pDescription, pMetricHandleCount, phMetricHandles );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricCreateFromProgrammableExp", result);
         }
@@ -3020,6 +3659,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetMetricCreateFromProgrammableExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricCreateFromProgrammableExpPrologue( hMetricProgrammable, pParameterValues, parameterCount, pName, pDescription, pMetricHandleCount, phMetricHandles );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricCreateFromProgrammableExp", result);
         }
@@ -3027,6 +3667,12 @@ namespace validation_layer
         auto driver_result = pfnCreateFromProgrammableExp( hMetricProgrammable, pParameterValues, parameterCount, pName, pDescription, pMetricHandleCount, phMetricHandles );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricCreateFromProgrammableExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetMetricCreateFromProgrammableExp", [=]() { handler->zetMetricCreateFromProgrammableExpEpilogue( hMetricProgrammable, pParameterValues, parameterCount, pName, pDescription, pMetricHandleCount, phMetricHandles ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetMetricCreateFromProgrammableExpEpilogue( hMetricProgrammable, pParameterValues, parameterCount, pName, pDescription, pMetricHandleCount, phMetricHandles ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricCreateFromProgrammableExp", result);
         }
@@ -3079,6 +3725,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetDeviceCreateMetricGroupsFromMetricsExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetDeviceCreateMetricGroupsFromMetricsExpPrologue( hDevice, metricCount, phMetrics, pMetricGroupNamePrefix, pDescription, pMetricGroupCount, phMetricGroup );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetDeviceCreateMetricGroupsFromMetricsExp", result);
         }
@@ -3090,6 +3737,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetDeviceCreateMetricGroupsFromMetricsExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetDeviceCreateMetricGroupsFromMetricsExpPrologue( hDevice, metricCount, phMetrics, pMetricGroupNamePrefix, pDescription, pMetricGroupCount, phMetricGroup );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetDeviceCreateMetricGroupsFromMetricsExp", result);
         }
@@ -3097,6 +3745,12 @@ namespace validation_layer
         auto driver_result = pfnCreateMetricGroupsFromMetricsExp( hDevice, metricCount, phMetrics, pMetricGroupNamePrefix, pDescription, pMetricGroupCount, phMetricGroup );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetDeviceCreateMetricGroupsFromMetricsExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetDeviceCreateMetricGroupsFromMetricsExp", [=]() { handler->zetDeviceCreateMetricGroupsFromMetricsExpEpilogue( hDevice, metricCount, phMetrics, pMetricGroupNamePrefix, pDescription, pMetricGroupCount, phMetricGroup ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetDeviceCreateMetricGroupsFromMetricsExpEpilogue( hDevice, metricCount, phMetrics, pMetricGroupNamePrefix, pDescription, pMetricGroupCount, phMetricGroup ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetDeviceCreateMetricGroupsFromMetricsExp", result);
         }
@@ -3137,6 +3791,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricGroupCreateExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupCreateExpPrologue( hDevice, pName, pDescription, samplingType, phMetricGroup );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricGroupCreateExp", result);
         }
@@ -3148,6 +3803,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetMetricGroupCreateExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricGroupCreateExpPrologue( hDevice, pName, pDescription, samplingType, phMetricGroup );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricGroupCreateExp", result);
         }
@@ -3155,6 +3811,12 @@ namespace validation_layer
         auto driver_result = pfnCreateExp( hDevice, pName, pDescription, samplingType, phMetricGroup );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricGroupCreateExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetMetricGroupCreateExp", [=]() { handler->zetMetricGroupCreateExpEpilogue( hDevice, pName, pDescription, samplingType, phMetricGroup ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupCreateExpEpilogue( hDevice, pName, pDescription, samplingType, phMetricGroup ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricGroupCreateExp", result);
         }
@@ -3194,7 +3856,10 @@ namespace validation_layer
             return logAndPropagateResult("zetMetricGroupAddMetricExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricGroupAddMetricExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupAddMetricExpPrologue( hMetricGroup, hMetric, pErrorStringSize, pErrorString );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricGroupAddMetricExp", result);
         }
@@ -3206,6 +3871,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetMetricGroupAddMetricExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricGroupAddMetricExpPrologue( hMetricGroup, hMetric, pErrorStringSize, pErrorString );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricGroupAddMetricExp", result);
         }
@@ -3213,6 +3879,13 @@ namespace validation_layer
         auto driver_result = pfnAddMetricExp( hMetricGroup, hMetric, pErrorStringSize, pErrorString );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricGroupAddMetricExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetMetricGroupAddMetricExp", [=]() { handler->zetMetricGroupAddMetricExpEpilogue( hMetricGroup, hMetric, pErrorStringSize, pErrorString ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupAddMetricExpEpilogue( hMetricGroup, hMetric, pErrorStringSize, pErrorString ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricGroupAddMetricExp", result);
         }
@@ -3236,7 +3909,10 @@ namespace validation_layer
             return logAndPropagateResult("zetMetricGroupRemoveMetricExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricGroupRemoveMetricExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupRemoveMetricExpPrologue( hMetricGroup, hMetric );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricGroupRemoveMetricExp", result);
         }
@@ -3248,6 +3924,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetMetricGroupRemoveMetricExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricGroupRemoveMetricExpPrologue( hMetricGroup, hMetric );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricGroupRemoveMetricExp", result);
         }
@@ -3255,6 +3932,13 @@ namespace validation_layer
         auto driver_result = pfnRemoveMetricExp( hMetricGroup, hMetric );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricGroupRemoveMetricExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetMetricGroupRemoveMetricExp", [=]() { handler->zetMetricGroupRemoveMetricExpEpilogue( hMetricGroup, hMetric ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupRemoveMetricExpEpilogue( hMetricGroup, hMetric ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricGroupRemoveMetricExp", result);
         }
@@ -3277,7 +3961,10 @@ namespace validation_layer
             return logAndPropagateResult("zetMetricGroupCloseExp", ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
         auto numValHandlers = context.validationHandlers.size();
+        const auto sampleTick = context.nextSampleTick();
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricGroupCloseExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupCloseExpPrologue( hMetricGroup );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricGroupCloseExp", result);
         }
@@ -3289,6 +3976,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetMetricGroupCloseExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricGroupCloseExpPrologue( hMetricGroup );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricGroupCloseExp", result);
         }
@@ -3296,6 +3984,13 @@ namespace validation_layer
         auto driver_result = pfnCloseExp( hMetricGroup );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            if (!context.validationHandlers[i]->isSampled(sampleTick)) continue;
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricGroupCloseExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetMetricGroupCloseExp", [=]() { handler->zetMetricGroupCloseExpEpilogue( hMetricGroup ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupCloseExpEpilogue( hMetricGroup ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricGroupCloseExp", result);
         }
@@ -3319,6 +4014,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricGroupDestroyExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupDestroyExpPrologue( hMetricGroup );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricGroupDestroyExp", result);
         }
@@ -3330,6 +4026,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetMetricGroupDestroyExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricGroupDestroyExpPrologue( hMetricGroup );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricGroupDestroyExp", result);
         }
@@ -3337,6 +4034,12 @@ namespace validation_layer
         auto driver_result = pfnDestroyExp( hMetricGroup );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricGroupDestroyExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetMetricGroupDestroyExp", [=]() { handler->zetMetricGroupDestroyExpEpilogue( hMetricGroup ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetMetricGroupDestroyExpEpilogue( hMetricGroup ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricGroupDestroyExp", result);
         }
@@ -3360,6 +4063,7 @@ namespace validation_layer
 
         auto numValHandlers = context.validationHandlers.size();
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricDestroyExp", timingPhase::prologue);
             auto result = context.validationHandlers[i]->zetValidation->zetMetricDestroyExpPrologue( hMetric );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricDestroyExp", result);
         }
@@ -3371,6 +4075,7 @@ namespace validation_layer
 
         
         if(context.enableHandleLifetime ){
+            checkerTimer timer(context.timing.get(), "handle_lifetime", "zetMetricDestroyExp", timingPhase::handleLifetime);
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricDestroyExpPrologue( hMetric );
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricDestroyExp", result);
         }
@@ -3378,6 +4083,12 @@ namespace validation_layer
         auto driver_result = pfnDestroyExp( hMetric );
 
         for (size_t i = 0; i < numValHandlers; i++) {
+            checkerTimer timer(context.timing.get(), context.validationHandlers[i]->checkerName, "zetMetricDestroyExp", timingPhase::epilogue);
+            if (context.validationHandlers[i]->deferEpilogues && context.deferredEpilogues) {
+                auto handler = context.validationHandlers[i]->zetValidation;
+                context.deferredEpilogues->defer(context.validationHandlers[i]->checkerName, "zetMetricDestroyExp", [=]() { handler->zetMetricDestroyExpEpilogue( hMetric ,driver_result); });
+                continue;
+            }
             auto result = context.validationHandlers[i]->zetValidation->zetMetricDestroyExpEpilogue( hMetric ,driver_result);
             if(result!=ZE_RESULT_SUCCESS) return logAndPropagateResult("zetMetricDestroyExp", result);
         }
@@ -689,4 +689,29 @@ zelDisableTracingLayer()
     return ZE_RESULT_SUCCESS;
 }
 
+ze_result_t ZE_APICALL
+zelGetValidationCheckerTimingReport(size_t *pSize, char *pReport)
+{
+    if (pSize == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+    typedef ze_result_t (ZE_APICALL *zelGetValidationCheckerTimingReportInternal_t)(size_t *pSize, char *pReport);
+    #ifdef L0_STATIC_LOADER_BUILD
+    if(nullptr == ze_lib::context->loader)
+        return ZE_RESULT_ERROR_UNINITIALIZED;
+    auto getTimingReport = reinterpret_cast<zelGetValidationCheckerTimingReportInternal_t>(
+            GET_FUNCTION_PTR(ze_lib::context->loader, "zelGetValidationCheckerTimingReport") );
+    #else
+    if (loader::context == nullptr || loader::context->validationLayer == nullptr) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+    auto getTimingReport = reinterpret_cast<zelGetValidationCheckerTimingReportInternal_t>(
+            GET_FUNCTION_PTR(loader::context->validationLayer, "zelGetValidationCheckerTimingReport") );
+    #endif
+    if (getTimingReport == nullptr) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+    return getTimingReport(pSize, pReport);
+}
+
 } //extern "c"
\ No newline at end of file
@@ -104,37 +104,53 @@ public:
     if (!logging_enabled)
       return;
     _logger->set_level(log_level);
+    active_level = log_level;
   }
 
-  void log_trace(std::string msg) {
-    if (!logging_enabled)
-      return;
-    _logger->trace(msg);
+  // Cached level check so that filtered messages return before any
+  // formatting or string construction happens
+  bool should_log(spdlog::level::level_enum log_level) const {
+    return log_level >= active_level;
   }
-  void log_debug(std::string msg) {
-    if (!logging_enabled)
-      return;
-    _logger->debug(msg);
+
+  void log_trace(const char *msg) { log(spdlog::level::trace, msg); }
+  void log_trace(const std::string &msg) { log(spdlog::level::trace, msg); }
+  void log_debug(const char *msg) { log(spdlog::level::debug, msg); }
+  void log_debug(const std::string &msg) { log(spdlog::level::debug, msg); }
+  void log_info(const char *msg) { log(spdlog::level::info, msg); }
+  void log_info(const std::string &msg) { log(spdlog::level::info, msg); }
+  void log_warning(const char *msg) { log(spdlog::level::warn, msg); }
+  void log_warning(const std::string &msg) { log(spdlog::level::warn, msg); }
+  void log_error(const char *msg) { log(spdlog::level::err, msg); }
+  void log_error(const std::string &msg) { log(spdlog::level::err, msg); }
+  void log_fatal(const char *msg) { log(spdlog::level::critical, msg); }
+  void log_fatal(const std::string &msg) { log(spdlog::level::critical, msg); }
+
+  // fmt-style overloads, e.g. log_trace("{} returned {}", name, value).
+  // Arguments are only formatted if the level is enabled.
+  template <typename Arg, typename... Args>
+  void log_trace(const char *format, const Arg &arg, const Args &...args) {
+    log_formatted(spdlog::level::trace, format, arg, args...);
   }
-  void log_info(std::string msg) {
-    if (!logging_enabled)
-      return;
-    _logger->info(msg);
+  template <typename Arg, typename... Args>
+  void log_debug(const char *format, const Arg &arg, const Args &...args) {
+    log_formatted(spdlog::level::debug, format, arg, args...);
   }
-  void log_warning(std::string msg) {
-    if (!logging_enabled)
-      return;
-    _logger->warn(msg);
+  template <typename Arg, typename... Args>
+  void log_info(const char *format, const Arg &arg, const Args &...args) {
+    log_formatted(spdlog::level::info, format, arg, args...);
   }
-  void log_error(std::string msg) {
-    if (!logging_enabled)
-      return;
-    _logger->error(msg);
+  template <typename Arg, typename... Args>
+  void log_warning(const char *format, const Arg &arg, const Args &...args) {
+    log_formatted(spdlog::level::warn, format, arg, args...);
   }
-  void log_fatal(std::string msg) {
-    if (!logging_enabled)
-      return;
-    _logger->critical(msg);
+  template <typename Arg, typename... Args>
+  void log_error(const char *format, const Arg &arg, const Args &...args) {
+    log_formatted(spdlog::level::err, format, arg, args...);
+  }
+  template <typename Arg, typename... Args>
+  void log_fatal(const char *format, const Arg &arg, const Args &...args) {
+    log_formatted(spdlog::level::critical, format, arg, args...);
   }
 
   std::shared_ptr<spdlog::logger> get_base_logger(){
@@ -144,6 +160,20 @@ public:
 bool log_to_console = true;
 bool logging_enabled = false;
 private:
+  template <typename T>
+  void log(spdlog::level::level_enum log_level, const T &msg) {
+    if (!should_log(log_level))
+      return;
+    _logger->log(log_level, msg);
+  }
+
+  template <typename Arg, typename... Args>
+  void log_formatted(spdlog::level::level_enum log_level, const char *format, const Arg &arg, const Args &...args) {
+    if (!should_log(log_level))
+      return;
+    _logger->log(log_level, SPDLOG_FMT_RUNTIME(format), arg, args...);
+  }
+
   void setLogLevel(std::string log_level) {
     // validate log level
     if ("trace" == log_level) {
@@ -161,13 +191,15 @@ private:
     } else if ("off" == log_level) {
       _logger->set_level(spdlog::level::off);
     } else {
-      _logger->warn("Invalid logging level set: ", log_level);
+      _logger->warn("Invalid logging level set: {}", log_level);
     }
+    active_level = _logger->level();
 
     spdlog::flush_on(spdlog::level::trace);
   }
 
   std::shared_ptr<spdlog::logger> _logger = nullptr;
+  spdlog::level::level_enum active_level = spdlog::level::off;
 };
 
 inline std::shared_ptr<Logger> createLogger() {
@@ -13,10 +13,17 @@
 #include "zes_api.h"
 #include "zer_api.h"
 
+#include <chrono>
+#include <cstring>
 #include <fstream>
+#include <iostream>
+#include <sstream>
+#include <thread>
+#include <vector>
 
 #if defined(_WIN32)
     #include <io.h>
+    #include <process.h>
     #include <cstdio>
     #include <fcntl.h>
     #include <windows.h>
@@ -2852,6 +2859,482 @@ TEST_F(DriverOrderingTest,
     (void)defaultContext;
   }
 
+  TEST(
+      RuntimeApiLoaderDriverInteraction,
+      GivenCertificationCheckerVersionOlderThanRuntimeApisWhenCallingRuntimeApisAfterZeInitDriversThenExpectUnsupportedVersion)
+  {
+    uint32_t pInitDriversCount = 0;
+    ze_init_driver_type_desc_t desc = {ZE_STRUCTURE_TYPE_INIT_DRIVER_TYPE_DESC};
+    desc.flags = UINT32_MAX;
+    desc.pNext = nullptr;
+    putenv_safe(const_cast<char *>("ZE_ENABLE_LOADER_INTERCEPT=1"));
+    putenv_safe(const_cast<char *>("ZEL_TEST_NULL_DRIVER_DISABLE_DDI_EXT=0"));
+    std::vector<ze_driver_handle_t> drivers;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeInitDrivers(&pInitDriversCount, nullptr, &desc));
+    drivers.resize(pInitDriversCount);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeInitDrivers(&pInitDriversCount, drivers.data(), &desc));
+    EXPECT_GT(pInitDriversCount, 0);
+
+    // APIs within the certification version still reach the driver
+    uint32_t device_count = 1;
+    std::vector<ze_device_handle_t> devices(device_count);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeDeviceGet(drivers[0], &device_count, devices.data()));
+
+    // Runtime APIs were introduced in 1.14 and are rejected without reaching the driver
+    const char *errorString = nullptr;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_VERSION, zerGetLastErrorDescription(&errorString));
+    EXPECT_FALSE(compare_env("zerGetLastErrorDescription", "1"));
+    EXPECT_EQ(UINT32_MAX, zerTranslateDeviceHandleToIdentifier(devices[0]));
+    EXPECT_EQ(nullptr, zerGetDefaultContext());
+  }
+
+  TEST(
+      ValidationLayerCheckerTiming,
+      GivenCheckerTimingEnabledWhenCallingApisThenTimingReportListsCheckersAndApis)
+  {
+    uint32_t pInitDriversCount = 0;
+    ze_init_driver_type_desc_t desc = {ZE_STRUCTURE_TYPE_INIT_DRIVER_TYPE_DESC};
+    desc.flags = UINT32_MAX;
+    desc.pNext = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeInitDrivers(&pInitDriversCount, nullptr, &desc));
+    std::vector<ze_driver_handle_t> drivers(pInitDriversCount);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeInitDrivers(&pInitDriversCount, drivers.data(), &desc));
+    EXPECT_GT(pInitDriversCount, 0);
+
+    uint32_t deviceCount = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeDeviceGet(drivers[0], &deviceCount, nullptr));
+
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_POINTER, zelGetValidationCheckerTimingReport(nullptr, nullptr));
+
+    size_t size = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zelGetValidationCheckerTimingReport(&size, nullptr));
+    EXPECT_GT(size, 1);
+    std::vector<char> report(size);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zelGetValidationCheckerTimingReport(&size, report.data()));
+    std::string reportString(report.data());
+    EXPECT_NE(std::string::npos, reportString.find("parameter_validation"));
+    EXPECT_NE(std::string::npos, reportString.find("basic_leak"));
+    EXPECT_NE(std::string::npos, reportString.find("zeDeviceGet"));
+  }
+
+  TEST(
+      ValidationLayerCheckerTiming,
+      GivenCheckerTimingAndDeferredEpiloguesEnabledWhenCallingApisThenDeferredEpiloguesAreTimedWhereTheyRun)
+  {
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeInit(0));
+    uint32_t driverCount = 1;
+    ze_driver_handle_t driver;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGet(&driverCount, &driver));
+
+    ze_context_desc_t contextDesc = {ZE_STRUCTURE_TYPE_CONTEXT_DESC, nullptr, 0};
+    ze_context_handle_t context;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextCreate(driver, &contextDesc, &context));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextDestroy(context));
+
+    // The worker runs the leak checker's epilogues asynchronously
+    std::string reportString;
+    for (int attempt = 0; attempt < 100; attempt++) {
+      size_t size = 0;
+      EXPECT_EQ(ZE_RESULT_SUCCESS, zelGetValidationCheckerTimingReport(&size, nullptr));
+      std::vector<char> report(size);
+      EXPECT_EQ(ZE_RESULT_SUCCESS, zelGetValidationCheckerTimingReport(&size, report.data()));
+      reportString = report.data();
+      if (reportString.find("zeContextDestroy") != std::string::npos &&
+          reportString.find("deferred") != std::string::npos)
+        break;
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    std::istringstream rows(reportString);
+    std::string row;
+    bool foundDeferredRow = false;
+    while (std::getline(rows, row)) {
+      if (row.find("basic_leak") != std::string::npos && row.find("zeContextCreate") != std::string::npos &&
+          row.find("deferred") != std::string::npos)
+        foundDeferredRow = true;
+    }
+    EXPECT_TRUE(foundDeferredRow) << reportString;
+  }
+
+  TEST(
+      ValidationLayerHandleLifetime,
+      GivenHandleLifetimeEnabledWhenUsingDestroyedHandlesThenInvalidNullHandleIsReturned)
+  {
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeInit(0));
+    uint32_t driverCount = 1;
+    ze_driver_handle_t driver;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGet(&driverCount, &driver));
+    uint32_t deviceCount = 1;
+    ze_device_handle_t device;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeDeviceGet(driver, &deviceCount, &device));
+    ze_context_desc_t contextDesc = {ZE_STRUCTURE_TYPE_CONTEXT_DESC};
+    ze_context_handle_t context;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextCreate(driver, &contextDesc, &context));
+    ze_command_list_desc_t listDesc = {ZE_STRUCTURE_TYPE_COMMAND_LIST_DESC};
+    ze_command_list_handle_t commandList;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListCreate(context, device, &listDesc, &commandList));
+
+    uint8_t buffer[64] = {};
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListClose(commandList));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, zeCommandListAppendMemoryPrefetch(commandList, buffer, sizeof(buffer)));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListReset(commandList));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListAppendMemoryPrefetch(commandList, buffer, sizeof(buffer)));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListDestroy(commandList));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_HANDLE, zeCommandListAppendMemoryPrefetch(commandList, buffer, sizeof(buffer)));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextGetStatus(context));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextDestroy(context));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_HANDLE, zeContextGetStatus(context));
+  }
+
+  TEST(
+      ValidationLayerUsmBoundsChecker,
+      GivenUsmBoundsCheckerEnabledWhenAppendingRangesPastAnAllocationThenInvalidSizeIsReturned)
+  {
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeInit(0));
+    uint32_t driverCount = 1;
+    ze_driver_handle_t driver;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGet(&driverCount, &driver));
+    uint32_t deviceCount = 1;
+    ze_device_handle_t device;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeDeviceGet(driver, &deviceCount, &device));
+    ze_context_desc_t contextDesc = {ZE_STRUCTURE_TYPE_CONTEXT_DESC};
+    ze_context_handle_t context;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextCreate(driver, &contextDesc, &context));
+    ze_command_list_desc_t listDesc = {ZE_STRUCTURE_TYPE_COMMAND_LIST_DESC};
+    ze_command_list_handle_t commandList;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListCreate(context, device, &listDesc, &commandList));
+
+    ze_device_mem_alloc_desc_t allocDesc = {ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC};
+    void *ptr = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeMemAllocDevice(context, &allocDesc, 256, 8, device, &ptr));
+    uint32_t pattern = 0;
+    uint8_t hostBuffer[512] = {};
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListAppendMemoryFill(commandList, ptr, &pattern, sizeof(pattern), 256, nullptr, 0, nullptr));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_SIZE, zeCommandListAppendMemoryFill(commandList, static_cast<uint8_t *>(ptr) + 128, &pattern, sizeof(pattern), 256, nullptr, 0, nullptr));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListAppendMemoryCopy(commandList, hostBuffer, ptr, 256, nullptr, 0, nullptr));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_SIZE, zeCommandListAppendMemoryCopy(commandList, hostBuffer, ptr, 512, nullptr, 0, nullptr));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_SIZE, zeCommandListAppendMemoryPrefetch(commandList, ptr, 257));
+
+    // Once freed, the range is no longer tracked
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeMemFree(context, ptr));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListAppendMemoryPrefetch(commandList, ptr, 257));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListDestroy(commandList));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextDestroy(context));
+  }
+
+  TEST(
+      ValidationLayerSampling,
+      GivenCheckerSampleRateOfTwoWhenRepeatingAnInvalidCallThenEverySecondCallIsChecked)
+  {
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeInit(0));
+    uint32_t driverCount = 1;
+    ze_driver_handle_t driver;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGet(&driverCount, &driver));
+    uint32_t deviceCount = 1;
+    ze_device_handle_t device;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeDeviceGet(driver, &deviceCount, &device));
+    ze_context_desc_t contextDesc = {ZE_STRUCTURE_TYPE_CONTEXT_DESC};
+    ze_context_handle_t context;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextCreate(driver, &contextDesc, &context));
+    ze_command_list_desc_t listDesc = {ZE_STRUCTURE_TYPE_COMMAND_LIST_DESC};
+    ze_command_list_handle_t commandList;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListCreate(context, device, &listDesc, &commandList));
+
+    // Allocations are never sampled, so the range is always tracked
+    ze_device_mem_alloc_desc_t allocDesc = {ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC};
+    void *ptr = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeMemAllocDevice(context, &allocDesc, 256, 8, device, &ptr));
+
+    int checkedCalls = 0;
+    for (int i = 0; i < 8; i++) {
+      auto result = zeCommandListAppendMemoryPrefetch(commandList, ptr, 512);
+      if (result == ZE_RESULT_ERROR_INVALID_SIZE)
+        checkedCalls++;
+      else
+        EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    }
+    EXPECT_EQ(checkedCalls, 4);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeMemFree(context, ptr));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListDestroy(commandList));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextDestroy(context));
+  }
+
+  TEST(
+      ValidationLayerPerformanceLint,
+      GivenPerformanceLintEnabledWhenResettingCommandListsThenOnlyResetsWithoutExecuteAreReported)
+  {
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeInit(0));
+    uint32_t driverCount = 1;
+    ze_driver_handle_t driver;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGet(&driverCount, &driver));
+    uint32_t deviceCount = 1;
+    ze_device_handle_t device;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeDeviceGet(driver, &deviceCount, &device));
+    ze_context_desc_t contextDesc = {ZE_STRUCTURE_TYPE_CONTEXT_DESC};
+    ze_context_handle_t context;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextCreate(driver, &contextDesc, &context));
+    ze_command_queue_desc_t queueDesc = {ZE_STRUCTURE_TYPE_COMMAND_QUEUE_DESC};
+    ze_command_queue_handle_t queue;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandQueueCreate(context, device, &queueDesc, &queue));
+    ze_command_list_desc_t listDesc = {ZE_STRUCTURE_TYPE_COMMAND_LIST_DESC};
+    ze_command_list_handle_t wastedResets;
+    ze_command_list_handle_t executedResets;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListCreate(context, device, &listDesc, &wastedResets));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListCreate(context, device, &listDesc, &executedResets));
+
+    // The report is printed when the layer is unloaded, and checked by the CTest pass expression
+    for (int i = 0; i < 12; i++) {
+      EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListReset(wastedResets));
+      EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListClose(executedResets));
+      EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandQueueExecuteCommandLists(queue, 1, &executedResets, nullptr));
+      EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListReset(executedResets));
+    }
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListDestroy(wastedResets));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListDestroy(executedResets));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandQueueDestroy(queue));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextDestroy(context));
+  }
+
+  TEST(
+      ValidationLayerUsmProfiler,
+      GivenUsmProfilerEnabledWhenAThreadAllocatesAndExitsThenItsAllocationsAreKeptInTheSummary)
+  {
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeInit(0));
+    uint32_t driverCount = 1;
+    ze_driver_handle_t driver;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGet(&driverCount, &driver));
+    uint32_t deviceCount = 1;
+    ze_device_handle_t device;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeDeviceGet(driver, &deviceCount, &device));
+    ze_context_desc_t contextDesc = {ZE_STRUCTURE_TYPE_CONTEXT_DESC};
+    ze_context_handle_t context;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextCreate(driver, &contextDesc, &context));
+
+    ze_device_mem_alloc_desc_t deviceDesc = {ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC};
+    void *allocations[4] = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeMemAllocDevice(context, &deviceDesc, 1024, 64, device, &allocations[0]));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeMemAllocDevice(context, &deviceDesc, 1024, 64, device, &allocations[1]));
+    // The second thread's counts are folded into the retired totals when it exits
+    std::thread worker([&]() {
+      EXPECT_EQ(ZE_RESULT_SUCCESS, zeMemAllocDevice(context, &deviceDesc, 1024, 64, device, &allocations[2]));
+      EXPECT_EQ(ZE_RESULT_SUCCESS, zeMemAllocDevice(context, &deviceDesc, 1024, 64, device, &allocations[3]));
+    });
+    worker.join();
+
+    // The summary is printed when the layer is unloaded, and checked by the CTest pass expression
+    for (auto ptr : allocations)
+      EXPECT_EQ(ZE_RESULT_SUCCESS, zeMemFree(context, ptr));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextDestroy(context));
+  }
+
+  TEST(
+      ValidationLayerBasicLeakChecker,
+      GivenThreadsThatCreateContextsAndExitWhenCountingLeaksThenEveryCallIsCounted)
+  {
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeInit(0));
+    uint32_t driverCount = 1;
+    ze_driver_handle_t driver;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGet(&driverCount, &driver));
+
+    // Each thread leaks a quarter of its contexts. The leak report is printed when the
+    // layer is unloaded, and checked by the CTest pass expression, with and without
+    // ZEL_VALIDATION_DEFERRED_EPILOGUES.
+    std::vector<std::thread> workers;
+    for (int t = 0; t < 4; t++) {
+      workers.emplace_back([driver]() {
+        ze_context_desc_t contextDesc = {ZE_STRUCTURE_TYPE_CONTEXT_DESC};
+        for (int i = 0; i < 64; i++) {
+          ze_context_handle_t context;
+          EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextCreate(driver, &contextDesc, &context));
+          if (i % 4 != 0) {
+            EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextDestroy(context));
+          }
+        }
+      });
+    }
+    for (auto &worker : workers)
+      worker.join();
+  }
+
+  TEST(
+      ValidationLayerLeakSites,
+      GivenLeakSitesEnabledWhenLeakingContextsFromTwoSitesThenLeaksAreGroupedBySite)
+  {
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeInit(0));
+    uint32_t driverCount = 1;
+    ze_driver_handle_t driver;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGet(&driverCount, &driver));
+    ze_context_desc_t contextDesc = {ZE_STRUCTURE_TYPE_CONTEXT_DESC};
+
+    // The report is printed when the layer is unloaded, and checked by the CTest pass expression
+    for (int i = 0; i < 3; i++) {
+      ze_context_handle_t leaked;
+      EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextCreate(driver, &contextDesc, &leaked));
+    }
+    ze_context_handle_t leakedOnce;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextCreate(driver, &contextDesc, &leakedOnce));
+    ze_context_handle_t destroyed;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextCreate(driver, &contextDesc, &destroyed));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextDestroy(destroyed));
+  }
+
+  TEST(
+      ValidationLayerParameterValidation,
+      GivenParameterValidationEnabledWhenCallingApisWithInvalidArgumentsThenEachKindOfCheckIsReported)
+  {
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeInit(0));
+    uint32_t driverCount = 1;
+    ze_driver_handle_t driver;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGet(&driverCount, &driver));
+    uint32_t deviceCount = 1;
+    ze_device_handle_t device;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeDeviceGet(driver, &deviceCount, &device));
+    ze_context_desc_t contextDesc = {ZE_STRUCTURE_TYPE_CONTEXT_DESC};
+    ze_context_handle_t context;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextCreate(driver, &contextDesc, &context));
+
+    ze_device_mem_alloc_desc_t deviceDesc = {ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC};
+    void *ptr = nullptr;
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_POINTER, zeMemAllocDevice(context, nullptr, 64, 64, device, &ptr));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_POINTER, zeMemAllocDevice(context, &deviceDesc, 64, 64, device, nullptr));
+    deviceDesc.flags = 0x8;
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ENUMERATION, zeMemAllocDevice(context, &deviceDesc, 64, 64, device, &ptr));
+    deviceDesc.flags = 0;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_SIZE, zeMemAllocDevice(context, &deviceDesc, 0, 64, device, &ptr));
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_ALIGNMENT, zeMemAllocDevice(context, &deviceDesc, 64, 3, device, &ptr));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeMemAllocDevice(context, &deviceDesc, 64, 64, device, &ptr));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeMemFree(context, ptr));
+
+    ze_command_list_desc_t listDesc = {ZE_STRUCTURE_TYPE_COMMAND_LIST_DESC};
+    ze_command_list_handle_t list;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListCreate(context, device, &listDesc, &list));
+    char src[64] = {};
+    char dst[64] = {};
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_SIZE, zeCommandListAppendMemoryCopy(list, dst, src, 64, nullptr, 1, nullptr));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListAppendMemoryCopy(list, dst, src, 64, nullptr, 0, nullptr));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_SIZE, zeCommandListAppendBarrier(list, nullptr, 1, nullptr));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListAppendBarrier(list, nullptr, 0, nullptr));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListDestroy(list));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextDestroy(context));
+  }
+
+  TEST(
+      ValidationLayerParameterValidation,
+      GivenParameterValidationEnabledWhenRepeatingACallThatFailsItsLastCheckThenPerCallCostIsReported)
+  {
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeInit(0));
+    uint32_t driverCount = 1;
+    ze_driver_handle_t driver;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGet(&driverCount, &driver));
+    uint32_t deviceCount = 1;
+    ze_device_handle_t device;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeDeviceGet(driver, &deviceCount, &device));
+    ze_context_desc_t contextDesc = {ZE_STRUCTURE_TYPE_CONTEXT_DESC};
+    ze_context_handle_t context;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextCreate(driver, &contextDesc, &context));
+
+    // Every check of zeMemAllocDevice runs and the call never reaches the driver,
+    // so this measures the loader, the layer and the parameter checks alone
+    ze_device_mem_alloc_desc_t deviceDesc = {ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC};
+    void *ptr = nullptr;
+    constexpr int iterations = 1000000;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+      if (zeMemAllocDevice(context, &deviceDesc, 64, 3, device, &ptr) != ZE_RESULT_ERROR_UNSUPPORTED_ALIGNMENT) {
+        FAIL() << "unexpected result on iteration " << i;
+      }
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+    std::cout << "zeMemAllocDevice with parameter validation: "
+              << static_cast<double>(elapsed.count()) / iterations << " ns per call" << std::endl;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextDestroy(context));
+  }
+
+  TEST(
+      ValidationLayerFindingsLog,
+      GivenFindingsLogEnabledWhenAnEventsWarningRepeatsThenOneRecordIsWrittenAndNothingIsPrinted)
+  {
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeInit(0));
+    uint32_t driverCount = 1;
+    ze_driver_handle_t driver;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGet(&driverCount, &driver));
+    uint32_t deviceCount = 1;
+    ze_device_handle_t device;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeDeviceGet(driver, &deviceCount, &device));
+    ze_context_desc_t contextDesc = {ZE_STRUCTURE_TYPE_CONTEXT_DESC};
+    ze_context_handle_t context;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextCreate(driver, &contextDesc, &context));
+    ze_command_list_desc_t listDesc = {ZE_STRUCTURE_TYPE_COMMAND_LIST_DESC};
+    ze_command_list_handle_t commandList;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListCreate(context, device, &listDesc, &commandList));
+    ze_event_pool_desc_t poolDesc = {ZE_STRUCTURE_TYPE_EVENT_POOL_DESC};
+    poolDesc.count = 1;
+    ze_event_pool_handle_t eventPool;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeEventPoolCreate(context, &poolDesc, 1, &device, &eventPool));
+    ze_event_desc_t eventDesc = {ZE_STRUCTURE_TYPE_EVENT_DESC};
+    ze_event_handle_t event;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeEventCreate(eventPool, &eventDesc, &event));
+
+    // Every signal after the first reuses the event, which the events checker warns about
+    std::stringstream capture;
+    auto oldBuffer = std::cerr.rdbuf(capture.rdbuf());
+    for (int i = 0; i < 100; i++)
+      EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListAppendSignalEvent(commandList, event));
+    std::cerr.rdbuf(oldBuffer);
+    EXPECT_EQ(capture.str().find("Warning"), std::string::npos);
+
+    // Must match findingsLog::findingRecord in the validation layer
+    struct findingRecord {
+      uint32_t type;
+      uint32_t severity;
+      uint64_t timestampNs;
+      uint64_t findingId;
+      uint64_t object;
+      uint64_t count;
+      uint32_t threadId;
+      uint32_t reserved;
+      char checker[24];
+      char finding[40];
+      char message[144];
+    };
+    const size_t headerSize = 24;
+
+#if defined(_WIN32)
+    auto pid = _getpid();
+#else
+    auto pid = getpid();
+#endif
+    std::string path = getenv_string("ZEL_VALIDATION_FINDINGS_LOG");
+    path.insert(path.find_last_of('.'), "_pid" + std::to_string(pid));
+
+    // The writer thread flushes new records within 50ms
+    std::vector<findingRecord> records;
+    for (int attempt = 0; attempt < 40 && records.empty(); attempt++) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(50));
+      std::ifstream file(path, std::ios::binary);
+      file.seekg(headerSize);
+      findingRecord record;
+      while (file.read(reinterpret_cast<char *>(&record), sizeof(record)))
+        records.push_back(record);
+    }
+    ASSERT_EQ(records.size(), 1u);
+    EXPECT_EQ(records[0].type, 1u);
+    EXPECT_STREQ(records[0].checker, "events_checker");
+    EXPECT_STREQ(records[0].finding, "signal-event-reused");
+    EXPECT_EQ(records[0].object, reinterpret_cast<uint64_t>(event));
+    EXPECT_NE(strstr(records[0].message, "zeCommandListAppendSignalEvent"), nullptr);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeEventDestroy(event));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeEventPoolDestroy(eventPool));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListDestroy(commandList));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeContextDestroy(context));
+  }
+
   TEST(
       RuntimeApiLoaderDriverInteraction,
       GivenLevelZeroLoaderPresentWithLoaderInterceptEnabledAndDdiExtSupportedWhenCallingRuntimeApisAfterZeInitThenExpectNullDriverIsReachedSuccessfully)
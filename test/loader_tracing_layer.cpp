@@ -17,12 +17,18 @@
 #include <vector>
 #include <map>
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <thread>
 
 #if defined(_WIN32)
 #include <windows.h>
+#include <process.h>
 #define putenv_safe _putenv
 #else
 #include <cstdlib>
+#include <unistd.h>
 #define putenv_safe putenv
 #endif
 
@@ -1012,6 +1018,252 @@ namespace
         destroyTracer(hTracer);
     }
 
+    TEST_P(TracingParameterizedTest,
+           GivenLoaderWithStaticTracingEnabledAndMoreTracersThanFitOnTheStackWhenCallingZeApisThenEachTracerKeepsItsOwnInstanceData)
+    {
+        InitMethod initMethod = GetParam();
+
+        setupTracing(TracingMode::STATIC_TRACING);
+
+        std::vector<ze_driver_handle_t> drivers;
+        initializeLevelZero(initMethod, drivers);
+
+        struct InstanceData
+        {
+            uint32_t prologueCount = 0;
+            uint32_t matchedEpilogueCount = 0;
+        };
+
+        // More tracers than the tracing layer keeps instance data for on the stack
+        std::vector<InstanceData> instanceData(12);
+        std::vector<zel_tracer_handle_t> tracers;
+        for (auto &data : instanceData)
+        {
+            zel_tracer_desc_t tracerDesc = {};
+            tracerDesc.stype = ZEL_STRUCTURE_TYPE_TRACER_DESC;
+            tracerDesc.pUserData = &data;
+            zel_tracer_handle_t hTracer = nullptr;
+            EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerCreate(&tracerDesc, &hTracer));
+            EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerDeviceGetCommandQueueGroupPropertiesRegisterCallback(hTracer, ZEL_REGISTER_PROLOGUE,
+                +[](ze_device_get_command_queue_group_properties_params_t *, ze_result_t, void *pTracerUserData, void **ppTracerInstanceUserData)
+                {
+                    static_cast<InstanceData *>(pTracerUserData)->prologueCount++;
+                    *ppTracerInstanceUserData = pTracerUserData;
+                }));
+            EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerDeviceGetCommandQueueGroupPropertiesRegisterCallback(hTracer, ZEL_REGISTER_EPILOGUE,
+                +[](ze_device_get_command_queue_group_properties_params_t *, ze_result_t, void *pTracerUserData, void **ppTracerInstanceUserData)
+                {
+                    if (*ppTracerInstanceUserData == pTracerUserData)
+                        static_cast<InstanceData *>(pTracerUserData)->matchedEpilogueCount++;
+                }));
+            EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerSetEnabled(hTracer, true));
+            tracers.push_back(hTracer);
+        }
+
+        uint32_t deviceCount = 1;
+        ze_device_handle_t device = nullptr;
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zeDeviceGet(drivers[0], &deviceCount, &device));
+        for (int i = 0; i < 3; i++)
+        {
+            uint32_t queueGroupCount = 0;
+            EXPECT_EQ(ZE_RESULT_SUCCESS, zeDeviceGetCommandQueueGroupProperties(device, &queueGroupCount, nullptr));
+        }
+
+        for (auto &data : instanceData)
+        {
+            EXPECT_EQ(3, data.prologueCount);
+            EXPECT_EQ(3, data.matchedEpilogueCount);
+        }
+
+        for (auto hTracer : tracers)
+        {
+            destroyTracer(hTracer);
+        }
+    }
+
+    TEST_P(TracingParameterizedTest,
+           GivenLoaderWithStaticTracingEnabledAndTracersInterestedInDifferentApisWhenDisablingOneTracerThenOnlyItsApisStopBeingTraced)
+    {
+        InitMethod initMethod = GetParam();
+
+        setupTracing(TracingMode::STATIC_TRACING);
+
+        std::vector<ze_driver_handle_t> drivers;
+        initializeLevelZero(initMethod, drivers);
+
+        zel_tracer_handle_t hQueueGroupTracer = createTracer();
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerDeviceGetCommandQueueGroupPropertiesRegisterCallback(hQueueGroupTracer, ZEL_REGISTER_PROLOGUE,
+                                                                                                   +TracingTest::zeDeviceGetCommandQueueGroupPropertiesPrologueCallback));
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerSetEnabled(hQueueGroupTracer, true));
+
+        zel_tracer_handle_t hMemoryTracer = createTracer();
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerDeviceGetMemoryPropertiesRegisterCallback(hMemoryTracer, ZEL_REGISTER_EPILOGUE,
+                                                                                        +TracingTest::zeDeviceGetMemoryPropertiesEpilogueCallback));
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerSetEnabled(hMemoryTracer, true));
+
+        callBasicZeApis(drivers);
+        EXPECT_EQ(1, tracingData.getZePrologueCallCount("zeDeviceGetCommandQueueGroupProperties"));
+        EXPECT_EQ(0, tracingData.getZeEpilogueCallCount("zeDeviceGetCommandQueueGroupProperties"));
+        EXPECT_EQ(0, tracingData.getZePrologueCallCount("zeDeviceGetMemoryProperties"));
+        EXPECT_EQ(1, tracingData.getZeEpilogueCallCount("zeDeviceGetMemoryProperties"));
+        EXPECT_EQ(0, tracingData.getZePrologueCallCount("zeDeviceGetMemoryAccessProperties"));
+        EXPECT_EQ(0, tracingData.getZeEpilogueCallCount("zeDeviceGetMemoryAccessProperties"));
+
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerSetEnabled(hQueueGroupTracer, false));
+
+        callBasicZeApis(drivers);
+        EXPECT_EQ(1, tracingData.getZePrologueCallCount("zeDeviceGetCommandQueueGroupProperties"));
+        EXPECT_EQ(2, tracingData.getZeEpilogueCallCount("zeDeviceGetMemoryProperties"));
+
+        destroyTracer(hQueueGroupTracer);
+        destroyTracer(hMemoryTracer);
+    }
+
+    TEST_P(TracingParameterizedTest,
+           GivenLoaderWithStaticTracingEnabledAndShortLivedThreadsMakingTracedCallsWhenEnablingAndDestroyingTracersThenCallbacksStayPairedAndDestroySucceeds)
+    {
+        InitMethod initMethod = GetParam();
+
+        setupTracing(TracingMode::STATIC_TRACING);
+
+        std::vector<ze_driver_handle_t> drivers;
+        initializeLevelZero(initMethod, drivers);
+
+        uint32_t deviceCount = 1;
+        ze_device_handle_t device = nullptr;
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zeDeviceGet(drivers[0], &deviceCount, &device));
+
+        struct CallCounts
+        {
+            std::atomic<uint32_t> prologueCount{0};
+            std::atomic<uint32_t> epilogueCount{0};
+        };
+        auto createCountingTracer = [](CallCounts &counts)
+        {
+            zel_tracer_desc_t tracerDesc = {};
+            tracerDesc.stype = ZEL_STRUCTURE_TYPE_TRACER_DESC;
+            tracerDesc.pUserData = &counts;
+            zel_tracer_handle_t hTracer = nullptr;
+            EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerCreate(&tracerDesc, &hTracer));
+            EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerDeviceGetMemoryPropertiesRegisterCallback(hTracer, ZEL_REGISTER_PROLOGUE,
+                +[](ze_device_get_memory_properties_params_t *, ze_result_t, void *pTracerUserData, void **)
+                {
+                    static_cast<CallCounts *>(pTracerUserData)->prologueCount++;
+                }));
+            EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerDeviceGetMemoryPropertiesRegisterCallback(hTracer, ZEL_REGISTER_EPILOGUE,
+                +[](ze_device_get_memory_properties_params_t *, ze_result_t, void *pTracerUserData, void **)
+                {
+                    static_cast<CallCounts *>(pTracerUserData)->epilogueCount++;
+                }));
+            return hTracer;
+        };
+
+        CallCounts steadyCounts;
+        zel_tracer_handle_t hSteadyTracer = createCountingTracer(steadyCounts);
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerSetEnabled(hSteadyTracer, true));
+
+        const uint32_t roundCount = 8;
+        const uint32_t threadCount = 16;
+        const uint32_t callsPerThread = 16;
+        for (uint32_t round = 0; round < roundCount; round++)
+        {
+            std::vector<std::thread> threads;
+            for (uint32_t t = 0; t < threadCount; t++)
+            {
+                threads.emplace_back([device]()
+                                     {
+                    for (uint32_t i = 0; i < callsPerThread; i++)
+                    {
+                        uint32_t memoryCount = 0;
+                        EXPECT_EQ(ZE_RESULT_SUCCESS, zeDeviceGetMemoryProperties(device, &memoryCount, nullptr));
+                    } });
+            }
+
+            // Swap tracer arrays while the threads are calling; destroy waits
+            // only for the calls that may still use the retired arrays
+            CallCounts toggledCounts;
+            zel_tracer_handle_t hToggledTracer = createCountingTracer(toggledCounts);
+            EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerSetEnabled(hToggledTracer, true));
+            EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerSetEnabled(hToggledTracer, false));
+            EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerDestroy(hToggledTracer));
+            EXPECT_EQ(toggledCounts.prologueCount.load(), toggledCounts.epilogueCount.load());
+
+            for (auto &thread : threads)
+            {
+                thread.join();
+            }
+        }
+
+        EXPECT_EQ(roundCount * threadCount * callsPerThread, steadyCounts.prologueCount.load());
+        EXPECT_EQ(roundCount * threadCount * callsPerThread, steadyCounts.epilogueCount.load());
+
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerSetEnabled(hSteadyTracer, false));
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zelTracerDestroy(hSteadyTracer));
+    }
+
+    TEST_P(TracingParameterizedTest,
+           GivenLoaderWithStaticTracingEnabledAndRecordFileSetWhenCallingApisWithoutTracersThenEachCallIsRecorded)
+    {
+        InitMethod initMethod = GetParam();
+
+        setupTracing(TracingMode::STATIC_TRACING);
+
+        std::vector<ze_driver_handle_t> drivers;
+        initializeLevelZero(initMethod, drivers);
+
+        uint32_t deviceCount = 1;
+        ze_device_handle_t device = nullptr;
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zeDeviceGet(drivers[0], &deviceCount, &device));
+
+        const uint32_t callCount = 100;
+        for (uint32_t i = 0; i < callCount; i++)
+        {
+            uint32_t memoryCount = 0;
+            EXPECT_EQ(ZE_RESULT_SUCCESS, zeDeviceGetMemoryProperties(device, &memoryCount, nullptr));
+        }
+
+        // Must match traceRecorder::callRecord in the tracing layer
+        struct callRecord
+        {
+            uint64_t startTicks;
+            uint64_t endTicks;
+            uint64_t handle;
+            uint64_t result;
+            uint32_t threadId;
+            uint16_t apiId;
+            uint16_t reserved;
+        };
+        const size_t headerSize = 24;
+
+#if defined(_WIN32)
+        auto pid = _getpid();
+#else
+        auto pid = getpid();
+#endif
+        std::string path = getenv_string("ZEL_TRACING_RECORD_FILE");
+        path.insert(path.find_last_of('.'), "_pid" + std::to_string(pid));
+
+        // The flusher thread writes new records within 20ms
+        uint32_t deviceCalls = 0;
+        for (int attempt = 0; attempt < 40 && deviceCalls < callCount; attempt++)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            std::ifstream file(path, std::ios::binary);
+            file.seekg(headerSize);
+            callRecord record;
+            deviceCalls = 0;
+            while (file.read(reinterpret_cast<char *>(&record), sizeof(record)))
+            {
+                if (record.handle != reinterpret_cast<uint64_t>(device))
+                    continue;
+                EXPECT_LE(record.startTicks, record.endTicks);
+                EXPECT_EQ(record.result, static_cast<uint64_t>(ZE_RESULT_SUCCESS));
+                deviceCalls++;
+            }
+        }
+        EXPECT_GE(deviceCalls, callCount);
+    }
+
     INSTANTIATE_TEST_SUITE_P(
         InitMethods,
         TracingParameterizedTest,